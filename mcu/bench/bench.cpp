@@ -0,0 +1,102 @@
+#include "bench.h"
+
+#ifndef ESP_PLATFORM
+#include <chrono>
+#endif
+
+namespace Bench {
+
+// ============================================================================
+// Timing
+// ============================================================================
+
+#ifdef ESP_PLATFORM
+static const char *PLATFORM = "esp32";
+
+// CPU cycles; a 32-bit counter wraps after ~17 s at 240 MHz, far above a
+// batch
+static uint64_t elapsedTicks(CaseFn fn, void *context, uint32_t iterations) {
+  uint32_t start = ESP.getCycleCount();
+  fn(context, iterations);
+  return (uint32_t)(ESP.getCycleCount() - start);
+}
+
+static double ticksToNs(uint64_t ticks) {
+  return ticks * 1000.0 / getCpuFrequencyMhz();
+}
+#else
+static const char *PLATFORM = "host";
+
+static uint64_t elapsedTicks(CaseFn fn, void *context, uint32_t iterations) {
+  auto start = std::chrono::steady_clock::now();
+  fn(context, iterations);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+      .count();
+}
+
+static double ticksToNs(uint64_t ticks) { return (double)ticks; }
+#endif
+
+// ============================================================================
+// Runner
+// ============================================================================
+
+Result run(const char *name, CaseFn fn, void *context) {
+  // Warm-up: first-use allocations and caches stay out of the numbers
+  fn(context, 1);
+
+  const double minBatchNs = MIN_BATCH_US * 1000.0;
+  uint32_t iterations = 1;
+  for (;;) {
+    double ns = ticksToNs(elapsedTicks(fn, context, iterations));
+    if (ns >= minBatchNs || iterations >= (1UL << 28))
+      break;
+
+    // Aim a little past the target, growing at most 16x per step
+    double scale = ns > 0 ? minBatchNs * 1.2 / ns : 16.0;
+    iterations = (uint32_t)(iterations * (scale < 16.0 ? scale : 16.0)) + 1;
+  }
+
+  Result result = {name, iterations, 0, 0, 0};
+  uint32_t allocStart = allocationCount();
+  double best = 0;
+  for (uint8_t b = 0; b < BATCHES; b++) {
+    double ns = ticksToNs(elapsedTicks(fn, context, iterations)) / iterations;
+    if (b == 0 || ns < best)
+      best = ns;
+  }
+  uint32_t allocs = allocationCount() - allocStart;
+
+  result.nsPerOp = best;
+  result.allocsPerOp = (double)allocs / ((double)iterations * BATCHES);
+#ifdef ESP_PLATFORM
+  result.cyclesPerOp = best * getCpuFrequencyMhz() / 1000.0;
+#endif
+  return result;
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+void printHeader(Print &out) {
+  out.printf("%-28s %12s %10s %10s %12s\n", "benchmark", "ns/op", "cycles/op",
+             "allocs/op", "iterations");
+}
+
+void printResult(Print &out, const Result &result) {
+  out.printf("%-28s %12.1f %10.0f %10.2f %12lu\n", result.name,
+             result.nsPerOp, result.cyclesPerOp, result.allocsPerOp,
+             (unsigned long)result.iterations);
+}
+
+void printJson(Print &out, const Result &result) {
+  out.printf("{\"benchmark\":\"%s\",\"platform\":\"%s\",\"ns_per_op\":%.2f,"
+             "\"cycles_per_op\":%.1f,\"allocs_per_op\":%.3f,"
+             "\"iterations\":%lu}\n",
+             result.name, PLATFORM, result.nsPerOp, result.cyclesPerOp,
+             result.allocsPerOp, (unsigned long)result.iterations);
+}
+
+} // namespace Bench
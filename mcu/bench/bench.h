@@ -0,0 +1,45 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <Arduino.h>
+
+// Micro-benchmark harness for the firmware hot paths. Builds on the host
+// (env:bench_native, steady clock) and on the ESP32 (env:bench_esp32, CPU
+// cycle counter). A case runs its body `iterations` times per call, so the
+// call through the function pointer is amortized.
+namespace Bench {
+
+typedef void (*CaseFn)(void *context, uint32_t iterations);
+
+struct Result {
+  const char *name;
+  uint32_t iterations; // Per measured batch
+  double nsPerOp;      // Fastest batch
+  double cyclesPerOp;  // Device only, 0 on the host
+  double allocsPerOp;  // Heap allocations (malloc/new) per op
+};
+
+// A batch grows until it runs at least this long; the fastest of BATCHES
+// batches is reported
+static const uint32_t MIN_BATCH_US = 20000;
+static const uint8_t BATCHES = 5;
+
+Result run(const char *name, CaseFn fn, void *context);
+
+void printHeader(Print &out);
+void printResult(Print &out, const Result &result);
+
+// One JSON object per line
+void printJson(Print &out, const Result &result);
+
+// Heap allocations since start (bench_alloc.cpp)
+uint32_t allocationCount();
+
+// Keeps a computed value alive without adding work
+template <typename T> inline void doNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace Bench
+
+#endif
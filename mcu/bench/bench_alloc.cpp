@@ -0,0 +1,52 @@
+#include "bench.h"
+#include <new>
+#include <stdlib.h>
+
+static volatile uint32_t allocations = 0;
+
+uint32_t Bench::allocationCount() { return allocations; }
+
+#ifdef ESP_PLATFORM
+
+// env:bench_esp32 links with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,
+// so every heap allocation (operator new and Arduino String included) from
+// any task passes through here
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+  allocations = allocations + 1;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  allocations = allocations + 1;
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  allocations = allocations + 1;
+  return __real_realloc(ptr, size);
+}
+}
+
+#else
+
+// The host shims allocate only through operator new (std::string, vector)
+void *operator new(size_t size) {
+  allocations = allocations + 1;
+  void *ptr = malloc(size ? size : 1);
+  if (!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t size) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t size) noexcept { free(ptr); }
+
+#endif
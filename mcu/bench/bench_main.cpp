@@ -0,0 +1,320 @@
+/*********
+  Micro-benchmarks for the sample -> result path
+
+  env:bench_native   .pio/build/bench_native/program [--json FILE]
+  env:bench_esp32    results on the serial port after boot
+
+  Prints a table and one JSON line per benchmark (to FILE on the host,
+  after the table on the device).
+*********/
+#include "acquisition_task.h"
+#include "bench.h"
+#include "ble_packet.h"
+#include "calibration_store.h"
+#include "color_lab.h"
+#include "color_naming_reference.h"
+#include "color_sampler.h"
+#include "color_sensor.h"
+#include "display.h"
+#include "frequency_capture.h"
+#include "metrics.h"
+#include "replay_frequency_capture.h"
+#include <Arduino.h>
+
+// Same wiring as main.cpp; the capture is fed from memory, not the pin
+ReplayFrequencyCapture capture;
+ColorSensor sensor(27, 25, 32, 33, 35, 26, capture);
+Display display(128, 32, 21, 22);
+static bool displayReady = false;
+
+// Fixed pseudo-random surface colors, so every run sees the same inputs
+static const int COLOR_COUNT = 64;
+static RGBColor colors[COLOR_COUNT];
+
+static void makeColors() {
+  uint32_t state = 12345;
+  for (int i = 0; i < COLOR_COUNT; i++) {
+    state = state * 1664525UL + 1013904223UL;
+    colors[i] = {(int)(state >> 24), (int)((state >> 16) & 0xFF),
+                 (int)((state >> 8) & 0xFF)};
+  }
+}
+
+// ============================================================================
+// Cases
+// ============================================================================
+
+static void benchDetectColorId(void *context, uint32_t iterations) {
+  for (uint32_t i = 0; i < iterations; i++) {
+    uint16_t id = sensor.detectColorId(colors[i % COLOR_COUNT]);
+    Bench::doNotOptimize(id);
+  }
+}
+
+// Fixed-point sRGB -> Lab alone (conversions/s = 1e9 / ns per op)
+static void benchRgbToLab(void *context, uint32_t iterations) {
+  for (uint32_t i = 0; i < iterations; i++) {
+    LabColor lab = rgbToLab(colors[i % COLOR_COUNT]);
+    Bench::doNotOptimize(lab);
+  }
+}
+
+// The RGB threshold chain the palette lookup replaced, for comparison
+static void benchThresholdChain(void *context, uint32_t iterations) {
+  for (uint32_t i = 0; i < iterations; i++) {
+    uint8_t id = ColorNamingReference::thresholdChain(colors[i % COLOR_COUNT]);
+    Bench::doNotOptimize(id);
+  }
+}
+
+static void benchDetectColorName(void *context, uint32_t iterations) {
+  for (uint32_t i = 0; i < iterations; i++) {
+    String name = sensor.detectColorName(colors[i % COLOR_COUNT]);
+    Bench::doNotOptimize(name.length());
+  }
+}
+
+// One R/G/B gate result set -> RGB: capture callbacks, half-period and the
+// calibration tables (the mapping readColor() runs once the gates close)
+static void benchRawToRgb(void *context, uint32_t iterations) {
+  static const TraceRecord reading[3] = {
+      {0, 166, 10000, 0}, {0, 125, 10000, 1}, {0, 100, 10000, 2}};
+  RGBColor color;
+  for (uint32_t i = 0; i < iterations; i++) {
+    capture.load(reading, 3);
+    sensor.startReading();
+    capture.drain();
+    sensor.takeReading(color);
+    Bench::doNotOptimize(color);
+  }
+}
+
+// Gate result -> half-period at 20% scaling, as every capture step does it
+// (CaptureMath, 64-bit divide)
+static void benchCaptureMath(void *context, uint32_t iterations) {
+  CaptureResult result = {0, 10000};
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < iterations; i++) {
+    result.edges = 100 + (i & 0xFF);
+    sum += CaptureMath::scaledHalfPeriodUs(result, 100, 20);
+  }
+  Bench::doNotOptimize(sum);
+}
+
+// One reading through the task -> loop queue: push then pop, same thread
+static void benchRingPushPop(void *context, uint32_t iterations) {
+  auto &ring = *static_cast<
+      SpscRingBuffer<SampleRecord, AcquisitionTask::RING_CAPACITY> *>(context);
+  SampleRecord record = {};
+  for (uint32_t i = 0; i < iterations; i++) {
+    record.timestamp = i;
+    ring.push(record);
+    ring.pop(record);
+  }
+  Bench::doNotOptimize(record.timestamp);
+}
+
+// Steady state: the window is full and rejection is active
+static void benchSamplerAddSample(void *context, uint32_t iterations) {
+  ColorSampler &sampler = *static_cast<ColorSampler *>(context);
+  RawFrequencies raw = {60, 80, 100};
+  for (uint32_t i = 0; i < iterations; i++) {
+    RGBColor color = {120 + (int)(i % 5), 80 + (int)(i % 3), 40};
+    bool accepted = sampler.addSample(color, raw);
+    Bench::doNotOptimize(accepted);
+  }
+}
+
+static void benchSamplerGetAverage(void *context, uint32_t iterations) {
+  ColorSampler &sampler = *static_cast<ColorSampler *>(context);
+  for (uint32_t i = 0; i < iterations; i++) {
+    RGBColor avg = sampler.getAverage();
+    Bench::doNotOptimize(avg);
+  }
+}
+
+// Composes the sampling screen and hands it to the flush task: the loop's
+// share of a display update (no I2C)
+static void benchDisplaySampling(void *context, uint32_t iterations) {
+  const String &name = *static_cast<const String *>(context);
+  for (uint32_t i = 0; i < iterations; i++) {
+    const RGBColor &c = colors[i % COLOR_COUNT];
+    display.showSamplingMode(i % 16, c.red, c.green, c.blue, name);
+  }
+}
+
+// Fills one notification at a 247-byte MTU, as the stream path does
+static void benchBlePacketFill(void *context, uint32_t iterations) {
+  PacketEncoder &encoder = *static_cast<PacketEncoder *>(context);
+  ColorRecord record = {0, 0, 0, 0, 0, RECORD_FLAG_STREAM, 60, 80, 100, 0};
+  for (uint32_t i = 0; i < iterations; i++) {
+    encoder.begin(247);
+    while (!encoder.isFull()) {
+      record.sequence++;
+      record.timestamp += 20;
+      record.red = record.sequence & 0xFF;
+      encoder.add(record);
+    }
+    Bench::doNotOptimize(encoder.data()[encoder.size() - 1]);
+  }
+}
+
+static void benchBlePacketDecode(void *context, uint32_t iterations) {
+  const PacketEncoder &encoder = *static_cast<const PacketEncoder *>(context);
+  ColorRecord records[BLE_MAX_PACKET_SIZE / BLE_RECORD_SIZE];
+  for (uint32_t i = 0; i < iterations; i++) {
+    size_t count = decodePacket(encoder.data(), encoder.size(), records,
+                                sizeof(records) / sizeof(records[0]));
+    Bench::doNotOptimize(count);
+  }
+}
+
+// Registry updates as the firmware makes them: one counter event, one
+// histogram sample (spread over the buckets)
+static void benchMetricsCount(void *context, uint32_t iterations) {
+  for (uint32_t i = 0; i < iterations; i++) {
+    metrics.count(COUNTER_BLE_NOTIFIED);
+  }
+  Bench::doNotOptimize(metrics.get(COUNTER_BLE_NOTIFIED));
+}
+
+static void benchMetricsRecord(void *context, uint32_t iterations) {
+  for (uint32_t i = 0; i < iterations; i++) {
+    metrics.record(HISTOGRAM_LOOP_PERIOD_US, (i * 2654435761UL) >> 14);
+  }
+  Bench::doNotOptimize(metrics.get(COUNTER_BLE_NOTIFIED));
+}
+
+// ============================================================================
+// Runner
+// ============================================================================
+
+// Over an RGB grid: how often the chain had no name, and how often the
+// palette entry picked is in the chain's class where it had one
+static void printNamingAgreement(Print &out) {
+  uint32_t total = 0;
+  uint32_t named = 0;
+  uint32_t agreed = 0;
+  for (int r = 0; r < 256; r += 5) {
+    for (int g = 0; g < 256; g += 5) {
+      for (int b = 0; b < 256; b += 5) {
+        RGBColor color = {r, g, b};
+        ColorNamingReference::ChainClass expected =
+            ColorNamingReference::thresholdChain(color);
+        total++;
+        if (expected == ColorNamingReference::CHAIN_UNKNOWN)
+          continue;
+        named++;
+        if (ColorNamingReference::paletteClass(sensor.detectColorId(color)) ==
+            expected)
+          agreed++;
+      }
+    }
+  }
+  out.printf("naming vs threshold chain: chain unnamed %.1f%%, agreement "
+             "%.1f%% of %u named\n",
+             100.0 * (total - named) / total, 100.0 * agreed / named,
+             (unsigned)named);
+}
+
+static void runAll(Print &out, Print *json) {
+  makeColors();
+  sensor.begin();
+  sensor.setCalibration(CalibrationStore::defaultProfile(0));
+
+  ColorSampler addSampler;
+  ColorSampler fullSampler;
+  RawFrequencies raw = {60, 80, 100};
+  for (int i = 0; i < ColorSampler::WINDOW_SIZE; i++) {
+    RGBColor color = {120 + i % 5, 80 + i % 3, 40};
+    fullSampler.addSample(color, raw);
+  }
+  String colorName = sensor.detectColorName(colors[0]);
+  SpscRingBuffer<SampleRecord, AcquisitionTask::RING_CAPACITY> ring;
+  PacketEncoder encoder;
+  PacketEncoder filled;
+  benchBlePacketFill(&filled, 1);
+
+  const struct {
+    const char *name;
+    Bench::CaseFn fn;
+    void *context;
+    bool needsDisplay;
+  } cases[] = {
+      {"rgb_to_lab", benchRgbToLab, nullptr, false},
+      {"detect_color_id", benchDetectColorId, nullptr, false},
+      {"threshold_chain_id", benchThresholdChain, nullptr, false},
+      {"detect_color_name", benchDetectColorName, nullptr, false},
+      {"raw_to_rgb", benchRawToRgb, nullptr, false},
+      {"capture_half_period", benchCaptureMath, nullptr, false},
+      {"ring_push_pop", benchRingPushPop, &ring, false},
+      {"sampler_add_sample", benchSamplerAddSample, &addSampler, false},
+      {"sampler_get_average", benchSamplerGetAverage, &fullSampler, false},
+      {"display_show_sampling", benchDisplaySampling, &colorName, true},
+      {"ble_packet_fill_mtu247", benchBlePacketFill, &encoder, false},
+      {"ble_packet_decode", benchBlePacketDecode, &filled, false},
+      {"metrics_count", benchMetricsCount, nullptr, false},
+      {"metrics_record", benchMetricsRecord, nullptr, false},
+  };
+
+  Bench::Result results[sizeof(cases) / sizeof(cases[0])];
+  size_t resultCount = 0;
+
+  Bench::printHeader(out);
+  for (const auto &c : cases) {
+    if (c.needsDisplay && !displayReady) {
+      out.printf("%-28s skipped (no display)\n", c.name);
+      continue;
+    }
+    results[resultCount] = Bench::run(c.name, c.fn, c.context);
+    Bench::printResult(out, results[resultCount]);
+    resultCount++;
+  }
+  printNamingAgreement(out);
+
+  if (json) {
+    for (size_t i = 0; i < resultCount; i++) {
+      Bench::printJson(*json, results[i]);
+    }
+  }
+}
+
+#ifdef ESP_PLATFORM
+
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+  displayReady = display.begin();
+
+  Serial.printf("CPU %lu MHz\n", (unsigned long)getCpuFrequencyMhz());
+  runAll(Serial, &Serial);
+}
+
+void loop() { delay(1000); }
+
+#else
+
+#include "trace_replay.h"
+
+int main(int argc, char **argv) {
+  const char *jsonPath = nullptr;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--json") == 0)
+      jsonPath = argv[i + 1];
+  }
+
+  displayReady = display.begin();
+
+  FILE *jsonFile = jsonPath ? fopen(jsonPath, "w") : nullptr;
+  if (jsonPath && !jsonFile) {
+    fprintf(stderr, "Cannot create %s\n", jsonPath);
+    return 1;
+  }
+  FilePrint json(jsonFile);
+  runAll(Serial, jsonFile ? &json : nullptr);
+  if (jsonFile)
+    fclose(jsonFile);
+  return 0;
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef ADAFRUIT_SSD1306_H
+#define ADAFRUIT_SSD1306_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <string>
+#include <vector>
+
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+
+#define SSD1306_MEMORYMODE 0x20
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+#define SSD1306_DISPLAYOFF 0xAE
+#define SSD1306_DISPLAYON 0xAF
+
+// Stand-in for the SSD1306 driver and panel.
+//
+// Drawing fills a page-ordered framebuffer (getBuffer()) like the real
+// driver, but glyphs are fixed per-character bit patterns, not the real
+// font: enough for code that diffs the buffer, not for looking at. For
+// that, the driver also keeps what was printed at each cursor position
+// (and bars), as text.
+//
+// The panel is modelled behind I2C: commands and data written to the
+// address given to begin() update its RAM. Whenever the RAM matches the
+// framebuffer, the panel is showing the last composed frame, and that
+// frame's text (one line per row) goes to the display sink (sim_hal.h).
+class Adafruit_SSD1306 : public Print {
+public:
+  Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi = &Wire,
+                   int8_t rstPin = -1, uint32_t clkDuring = 400000UL,
+                   uint32_t clkAfter = 100000UL);
+
+  bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0,
+             bool reset = true, bool periphBegin = true);
+
+  void clearDisplay();
+  // Sends the whole framebuffer
+  void display();
+  void ssd1306_command(uint8_t c);
+  uint8_t *getBuffer() { return buffer.data(); }
+
+  void setTextSize(uint8_t size) { textSize = size ? size : 1; }
+  void setTextColor(uint16_t color) {}
+  void setCursor(int16_t x, int16_t y);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w,
+                  int16_t h, uint16_t color) {}
+
+  int16_t width() const { return screenWidth; }
+  int16_t height() const { return screenHeight; }
+
+  using Print::write;
+  size_t write(uint8_t c) override;
+
+private:
+  // One run of text (or a bar) anchored at a cursor position
+  struct Item {
+    int16_t x;
+    int16_t y;
+    std::string text;
+  };
+
+  TwoWire *wire;
+  uint32_t wireClk;
+  uint32_t restoreClk;
+  uint8_t address;
+
+  uint8_t screenWidth;
+  uint8_t screenHeight;
+  uint8_t textSize;
+  int16_t cursorX;
+  int16_t cursorY;
+  std::vector<Item> items;
+  std::vector<uint8_t> buffer;
+  uint32_t revision; // Bumped by every drawing call
+  uint32_t shownRevision;
+  std::string lastFrame;
+
+  // Panel side
+  std::vector<uint8_t> ram;
+  uint8_t pageStart, pageEnd, columnStart, columnEnd;
+  uint8_t page, column;
+  uint8_t command;
+  uint8_t argsNeeded;
+  uint8_t argCount;
+  uint8_t args[2];
+
+  void setPixel(int16_t x, int16_t y, uint16_t color);
+  void drawGlyph(uint8_t c);
+  void sendCommands(const uint8_t *commands, size_t count);
+  void emitFrame();
+
+  static void onI2c(void *context, const uint8_t *data, size_t length);
+  void receive(const uint8_t *data, size_t length);
+  void commandByte(uint8_t c);
+  void runCommand();
+  void writeRam(uint8_t value);
+  bool showsBuffer() const;
+};
+
+#endif
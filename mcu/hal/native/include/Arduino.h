@@ -0,0 +1,186 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host-native subset of the Arduino core used by the firmware. Time and
+// GPIO are simulated (see sim_hal.h); Serial writes to the serial sink.
+
+#include <algorithm>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(string_literal) (string_literal)
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define constrain(amt, low, high)                                              \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// ============================================================================
+// String
+// ============================================================================
+
+class String {
+public:
+  String() {}
+  String(const char *cstr) : buffer(cstr ? cstr : "") {}
+  String(const std::string &str) : buffer(str) {}
+  explicit String(char c) : buffer(1, c) {}
+  String(int value, unsigned char base = 10);
+  String(unsigned int value, unsigned char base = 10);
+  String(long value, unsigned char base = 10);
+  String(unsigned long value, unsigned char base = 10);
+  String(float value, unsigned int decimals = 2);
+  String(double value, unsigned int decimals = 2);
+
+  const char *c_str() const { return buffer.c_str(); }
+  unsigned int length() const { return buffer.size(); }
+  bool isEmpty() const { return buffer.empty(); }
+  bool reserve(unsigned int size) {
+    buffer.reserve(size);
+    return true;
+  }
+
+  char operator[](unsigned int index) const { return buffer[index]; }
+  bool operator==(const String &other) const { return buffer == other.buffer; }
+  bool operator!=(const String &other) const { return buffer != other.buffer; }
+  String &operator+=(const String &other) {
+    buffer += other.buffer;
+    return *this;
+  }
+  String &operator+=(const char *cstr) {
+    buffer += cstr;
+    return *this;
+  }
+  String &operator+=(char c) {
+    buffer += c;
+    return *this;
+  }
+
+  int indexOf(char c) const;
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+  bool startsWith(const String &prefix) const;
+  long toInt() const { return atol(buffer.c_str()); }
+  void trim();
+
+private:
+  std::string buffer;
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+
+// ============================================================================
+// Print / Serial
+// ============================================================================
+
+#define DEC 10
+#define HEX 16
+
+class Print {
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *data, size_t length);
+  size_t write(const char *str) {
+    return str ? write((const uint8_t *)str, strlen(str)) : 0;
+  }
+
+  size_t print(const char *str) { return write(str); }
+  size_t print(const String &str) { return write(str.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char value, int base = DEC);
+  size_t print(int value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC);
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(double value, int digits = 2);
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T &value) {
+    size_t n = print(value);
+    return n + println();
+  }
+  template <typename T> size_t println(const T &value, int format) {
+    size_t n = print(value, format);
+    return n + println();
+  }
+
+  size_t printf(const char *format, ...)
+      __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int peek() { return -1; }
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud) { this->baud = baud; }
+  void end() {}
+  void flush() {}
+  operator bool() const { return true; }
+
+  int available() override;
+  int read() override;
+
+  using Print::write;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *data, size_t length) override;
+
+private:
+  unsigned long baud = 0;
+};
+
+extern HardwareSerial Serial;
+
+// ============================================================================
+// Time / GPIO
+// ============================================================================
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+
+// Handlers run synchronously when the simulation changes an input level
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterruptArg(uint8_t pin, void (*fn)(void *), void *arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef BLE2902_H
+#define BLE2902_H
+
+#include <BLEDevice.h>
+
+// Client Characteristic Configuration descriptor
+class BLE2902 : public BLEDescriptor {
+public:
+  BLE2902() : BLEDescriptor("2902") {}
+};
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef BLE_DEVICE_H
+#define BLE_DEVICE_H
+
+#include <Arduino.h>
+#include <esp_gap_ble_api.h>
+#include <esp_gatts_api.h>
+#include <string>
+#include <vector>
+
+// Host-native subset of the ESP32 BLE library. One server, no radio:
+// notifications go to the simulated link and connections, writes and CCCD
+// changes come from the SimHal::ble* central calls (sim_hal.h). Attribute
+// handles are numbered in creation order.
+
+typedef void (*gatts_event_handler)(esp_gatts_cb_event_t event,
+                                    esp_gatt_if_t gatts_if,
+                                    esp_ble_gatts_cb_param_t *param);
+
+class BLEServer;
+class BLEService;
+class BLECharacteristic;
+
+class BLEServerCallbacks {
+public:
+  virtual ~BLEServerCallbacks() {}
+  virtual void onConnect(BLEServer *pServer) {}
+  virtual void onConnect(BLEServer *pServer, esp_ble_gatts_cb_param_t *param) {
+  }
+  virtual void onDisconnect(BLEServer *pServer) {}
+  virtual void onDisconnect(BLEServer *pServer,
+                            esp_ble_gatts_cb_param_t *param) {}
+  virtual void onMtuChanged(BLEServer *pServer,
+                            esp_ble_gatts_cb_param_t *param) {}
+};
+
+class BLECharacteristicCallbacks {
+public:
+  virtual ~BLECharacteristicCallbacks() {}
+  virtual void onWrite(BLECharacteristic *pCharacteristic) {}
+  virtual void onWrite(BLECharacteristic *pCharacteristic,
+                       esp_ble_gatts_cb_param_t *param) {
+    onWrite(pCharacteristic);
+  }
+};
+
+class BLEDescriptor {
+public:
+  explicit BLEDescriptor(const char *uuid) : uuid(uuid), handle(0) {}
+  virtual ~BLEDescriptor() {}
+
+  const char *getUUIDString() const { return uuid.c_str(); }
+  uint16_t getHandle() const { return handle; }
+  void setHandle(uint16_t h) { handle = h; }
+
+private:
+  std::string uuid;
+  uint16_t handle;
+};
+
+class BLECharacteristic {
+public:
+  static const uint32_t PROPERTY_READ = 1 << 0;
+  static const uint32_t PROPERTY_WRITE = 1 << 1;
+  static const uint32_t PROPERTY_NOTIFY = 1 << 2;
+  static const uint32_t PROPERTY_INDICATE = 1 << 3;
+  static const uint32_t PROPERTY_WRITE_NR = 1 << 4;
+
+  BLECharacteristic(const char *uuid, uint32_t properties, uint16_t handle,
+                    BLEService *service)
+      : uuid(uuid), properties(properties), handle(handle), service(service) {
+  }
+
+  void setValue(const char *str) {
+    value.assign(str, str + strlen(str));
+  }
+  void setValue(uint8_t *data, size_t length) {
+    value.assign(data, data + length);
+  }
+  void notify(bool isNotification = true);
+  void indicate() { notify(false); }
+  void addDescriptor(BLEDescriptor *descriptor);
+  BLEDescriptor *getDescriptorByUUID(const char *descriptorUuid);
+  void setCallbacks(BLECharacteristicCallbacks *cb) { callbacks = cb; }
+  BLECharacteristicCallbacks *getCallbacks() { return callbacks; }
+
+  const char *getUUIDString() const { return uuid.c_str(); }
+  uint16_t getHandle() const { return handle; }
+  uint8_t *getData() { return value.data(); }
+  size_t getLength() const { return value.size(); }
+
+private:
+  std::string uuid;
+  uint32_t properties;
+  uint16_t handle; // Value handle, 0 if the service had none left
+  BLEService *service;
+  std::vector<uint8_t> value;
+  std::vector<BLEDescriptor *> descriptors;
+  BLECharacteristicCallbacks *callbacks = nullptr;
+};
+
+// Like Bluedroid, a service reserves numHandles attribute handles when it
+// is created (one for its declaration); an attribute that does not fit is
+// not added and gets handle 0
+class BLEService {
+public:
+  explicit BLEService(uint32_t numHandles)
+      : handlesLeft(numHandles > 0 ? numHandles - 1 : 0) {}
+
+  BLECharacteristic *createCharacteristic(const char *uuid,
+                                          uint32_t properties);
+  void start() {}
+  bool reserveHandles(uint32_t count);
+
+private:
+  uint32_t handlesLeft;
+};
+
+class BLEServer {
+public:
+  void setCallbacks(BLEServerCallbacks *cb) { callbacks = cb; }
+  BLEServerCallbacks *getCallbacks() { return callbacks; }
+  BLEService *createService(const char *uuid, uint32_t numHandles = 15,
+                            uint8_t instId = 0) {
+    return new BLEService(numHandles);
+  }
+  void startAdvertising();
+  uint32_t getConnectedCount();
+  uint16_t getGattsIf() { return 3; }
+  void disconnect(uint16_t connId);
+  void updateConnParams(esp_bd_addr_t remote_bda, uint16_t minInterval,
+                        uint16_t maxInterval, uint16_t latency,
+                        uint16_t timeout);
+
+private:
+  BLEServerCallbacks *callbacks = nullptr;
+};
+
+class BLEAdvertising {
+public:
+  void addServiceUUID(const char *uuid) {}
+  void setScanResponse(bool enabled) {}
+  void setMinPreferred(uint16_t interval) {}
+  void setMaxPreferred(uint16_t interval) {}
+  void start();
+  void stop();
+};
+
+class BLEDevice {
+public:
+  static void init(const char *deviceName) {}
+  static BLEServer *createServer();
+  static BLEServer *getServer();
+  static BLEAdvertising *getAdvertising();
+  static void startAdvertising();
+  static void stopAdvertising();
+  static int setMTU(uint16_t mtu) { return 0; }
+  static void setCustomGattsHandler(gatts_event_handler handler);
+};
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef BLE_SERVER_H
+#define BLE_SERVER_H
+
+#include <BLEDevice.h>
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef BLE_UTILS_H
+#define BLE_UTILS_H
+
+#include <BLEDevice.h>
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef PREFERENCES_H
+#define PREFERENCES_H
+
+#include <Arduino.h>
+#include <string>
+
+// NVS stand-in backed by process memory. Namespaces and keys behave like
+// the ESP32 library; contents live until the process exits.
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false,
+             const char *partitionLabel = nullptr);
+  void end() { open = false; }
+
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putUChar(const char *key, uint8_t value);
+  uint8_t getUChar(const char *key, uint8_t defaultValue = 0);
+  size_t putUShort(const char *key, uint16_t value);
+  uint16_t getUShort(const char *key, uint16_t defaultValue = 0);
+  size_t putUInt(const char *key, uint32_t value);
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0);
+  size_t putBool(const char *key, bool value);
+  bool getBool(const char *key, bool defaultValue = false);
+
+  size_t putBytes(const char *key, const void *value, size_t length);
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buffer, size_t maxLength);
+
+private:
+  std::string ns;
+  bool open = false;
+  bool readOnly = false;
+
+  std::string path(const char *key) const { return ns + "/" + key; }
+};
+
+#endif
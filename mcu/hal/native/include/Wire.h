@@ -0,0 +1,37 @@
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <Arduino.h>
+
+// I2C master. A transmission is handed to the device model attached at its
+// address (SimHal::attachI2cDevice) and advances the simulated clock by its
+// bus time at the current clock, as the blocking ESP32 driver would.
+class TwoWire : public Print {
+public:
+  static const size_t BUFFER_LENGTH = 128; // Same as the ESP32 core
+
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+    if (frequency)
+      clock = frequency;
+    return true;
+  }
+  void setClock(uint32_t frequency) { clock = frequency; }
+  uint32_t getClock() const { return clock; }
+
+  void beginTransmission(uint8_t address);
+  // 0 on success, 2 if no device acknowledged the address
+  uint8_t endTransmission(bool sendStop = true);
+
+  using Print::write;
+  size_t write(uint8_t c) override;
+
+private:
+  uint32_t clock = 100000;
+  uint8_t address = 0;
+  uint8_t buffer[BUFFER_LENGTH];
+  size_t length = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef ESP_BT_H
+#define ESP_BT_H
+
+typedef enum {
+  ESP_BLE_PWR_TYPE_ADV = 9,
+  ESP_BLE_PWR_TYPE_DEFAULT = 12,
+} esp_ble_power_type_t;
+
+typedef enum {
+  ESP_PWR_LVL_P9 = 7,
+} esp_power_level_t;
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+inline esp_err_t esp_ble_tx_power_set(esp_ble_power_type_t type,
+                                      esp_power_level_t level) {
+  return ESP_OK;
+}
+
+#endif
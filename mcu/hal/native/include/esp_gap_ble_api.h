@@ -0,0 +1,9 @@
+#ifndef ESP_GAP_BLE_API_H
+#define ESP_GAP_BLE_API_H
+
+#include <stdint.h>
+
+// Free controller buffers for the connection (sim_hal.h link model)
+uint16_t esp_ble_get_cur_sendable_packets_num(uint16_t connid);
+
+#endif
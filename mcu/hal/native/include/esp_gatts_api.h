@@ -0,0 +1,49 @@
+#ifndef ESP_GATTS_API_H
+#define ESP_GATTS_API_H
+
+#include <stdint.h>
+
+// Host-native subset of the Bluedroid GATT server API: the event parameters
+// the BLE shims pass to callbacks, and per-connection notifications (queued
+// on the simulated link, sim_hal.h)
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef uint8_t esp_bd_addr_t[6];
+typedef uint8_t esp_gatt_if_t;
+
+typedef enum {
+  ESP_GATTS_WRITE_EVT = 2,
+  ESP_GATTS_MTU_EVT = 4,
+  ESP_GATTS_CONNECT_EVT = 14,
+  ESP_GATTS_DISCONNECT_EVT = 15,
+} esp_gatts_cb_event_t;
+
+struct esp_ble_gatts_cb_param_t {
+  struct {
+    uint16_t conn_id;
+    uint16_t handle;
+    uint16_t len;
+    uint8_t *value;
+  } write;
+  struct {
+    uint16_t conn_id;
+    uint16_t mtu;
+  } mtu;
+  struct {
+    uint16_t conn_id;
+    esp_bd_addr_t remote_bda;
+  } connect;
+  struct {
+    uint16_t conn_id;
+  } disconnect;
+};
+
+// ESP_FAIL if the connection is gone or its controller queue is full
+esp_err_t esp_ble_gatts_send_indicate(esp_gatt_if_t gatts_if, uint16_t conn_id,
+                                      uint16_t attr_handle, uint16_t value_len,
+                                      uint8_t *value, bool need_confirm);
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef LINK_CAPTURE_H
+#define LINK_CAPTURE_H
+
+#include <stdint.h>
+
+// Host side of the binary serial link (serial_link.h)
+
+struct CaptureOptions {
+  const char *port;    // Serial device (or a FIFO / pty for testing)
+  const char *outPath; // CSV, appended to
+  const char *label;   // Written on every row
+  uint32_t baud;
+  int rateHz;          // START_STREAM rate, 0 = back to back
+  int scaling;         // SET_SCALING argument, -1 = leave as is
+  uint32_t count;      // Readings to keep, 0 = until interrupted
+};
+
+// Configures the port, streams readings into the CSV (one row per reading,
+// header if the file is new) until count is reached or SIGINT, then stops
+// the stream and prints a summary to stderr. Text logs from the device go
+// to stderr as they arrive. Returns non-zero if the port or file could not
+// be opened or a command was refused.
+int captureLink(const CaptureOptions &options);
+
+#endif
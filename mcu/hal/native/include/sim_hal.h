@@ -0,0 +1,171 @@
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Control side of the host-native HAL. The firmware keeps calling the
+// Arduino, Wire, SSD1306, BLE and Preferences APIs; in the native env those
+// headers come from hal/native/include and are backed by this module:
+//
+//   clock    simulated; only advanceMicros() (or delay()) moves it
+//   GPIO     outputs are recorded, inputs are set by the simulation
+//   capture  tickers (e.g. SimFrequencyCapture::advance) run on the clock
+//   I2C      transmissions go to the device model at their address and
+//            take bus time at the Wire clock
+//   flash    data partitions for the esp_partition API
+//   sinks    serial bytes, OLED frames and BLE notifications
+//   serial   input typed by the simulation, read through Serial
+//   BLE link notifications queue in the controller and go out at
+//            connection events; the central can write characteristics
+//
+// Nothing here blocks or touches real time, so a run is deterministic.
+namespace SimHal {
+
+static const uint8_t PIN_COUNT = 40;
+static const uint8_t MAX_TICKERS = 4;
+static const uint8_t MAX_I2C_DEVICES = 4;
+
+// BLE link model, per central: notifications the controller buffers, how
+// many go out per connection event, and the interval until the peripheral
+// asks for one (a typical phone default)
+static const uint8_t BLE_MAX_CENTRALS = 4;
+static const uint16_t BLE_NO_CONNECTION = 0xFFFF;
+static const size_t BLE_TX_QUEUE_SIZE = 12;
+static const uint8_t BLE_PACKETS_PER_EVENT = 4;
+static const uint16_t BLE_DEFAULT_INTERVAL = 24; // 30 ms
+
+// Connection parameters in BLE units, as requested by the peripheral
+struct BleConnParams {
+  uint16_t minInterval; // 1.25 ms
+  uint16_t maxInterval;
+  uint16_t latency;     // Connection events the peripheral may skip
+  uint16_t timeout;     // 10 ms
+};
+
+typedef void (*Ticker)(void *context, uint32_t us);
+typedef void (*PinHandler)(void *arg);
+typedef void (*I2cDevice)(void *context, const uint8_t *data, size_t length);
+typedef void (*SerialSink)(void *context, const uint8_t *data, size_t length);
+typedef void (*DisplaySink)(void *context, const char *frame);
+typedef void (*BleSink)(void *context, uint16_t connId, const char *uuid,
+                        const uint8_t *data, size_t length);
+
+// ============================================================================
+// Clock
+// ============================================================================
+
+uint64_t nowMicros();
+
+// Moves time forward and hands the step to every ticker
+void advanceMicros(uint32_t us);
+
+bool addTicker(Ticker fn, void *context);
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+void setInput(uint8_t pin, uint8_t level);
+uint8_t getOutput(uint8_t pin);
+uint8_t getMode(uint8_t pin);
+
+// Used by the shims
+void setMode(uint8_t pin, uint8_t mode);
+void writePin(uint8_t pin, uint8_t level);
+uint8_t readPin(uint8_t pin);
+
+// Used by the shims: the handler runs inside setInput() on a matching edge
+// (mode RISING, FALLING or CHANGE); a null handler detaches
+void attachPinInterrupt(uint8_t pin, PinHandler fn, void *arg, int mode);
+
+// ============================================================================
+// I2C
+// ============================================================================
+
+// Used by the shims: a device model receives each transmission addressed
+// to it (the bytes after the address byte)
+bool attachI2cDevice(uint8_t address, I2cDevice fn, void *context);
+
+// Returns false (NACK) if nothing is attached at the address
+bool deliverI2c(uint8_t address, const uint8_t *data, size_t length);
+
+// ============================================================================
+// Sinks (serial defaults to stdout; the others drop output until set)
+// ============================================================================
+
+void setSerialSink(SerialSink fn, void *context);
+void setDisplaySink(DisplaySink fn, void *context);
+void setBleSink(BleSink fn, void *context);
+
+// Bytes Serial.read() returns next, in order
+void serialInput(const char *text);
+void serialInput(const uint8_t *data, size_t length);
+
+// Used by the shims
+void emitSerial(const uint8_t *data, size_t length);
+int serialAvailable();
+int serialRead();
+void emitFrame(const char *frame);
+// Queues a notification to one central; false if it is not connected or
+// its controller queue is full
+bool emitNotification(uint16_t connId, const char *uuid, const uint8_t *data,
+                      size_t length);
+size_t bleSendable(uint16_t connId);
+
+// ============================================================================
+// BLE central
+// ============================================================================
+
+// Connects a simulated client while the peripheral advertises, reports the
+// negotiated ATT MTU and returns the connection id (BLE_NO_CONNECTION if
+// not advertising or every central is in use). Each connection has its own
+// link queue and parameters.
+uint16_t bleConnect(uint16_t mtu);
+void bleDisconnect(uint16_t connId);
+bool bleConnected(); // Any central
+bool bleConnected(uint16_t connId);
+uint8_t bleConnectionCount();
+bool bleAdvertising();
+
+// Client write to a characteristic; false if it does not exist
+bool bleWrite(uint16_t connId, const char *uuid, const uint8_t *data,
+              size_t length);
+
+// Client writes the characteristic's CCCD; false if it has none
+bool bleSubscribe(uint16_t connId, const char *uuid, bool enabled);
+
+// Notifications refused because a controller queue was full
+uint32_t bleDroppedNotifications();
+
+// Last parameters the firmware asked for on the connection (all zero until
+// it asks)
+BleConnParams bleConnParams(uint16_t connId);
+
+// Used by the shims
+void setBleAdvertising(bool active);
+void updateBleConnParams(const uint8_t *address, const BleConnParams &params);
+
+// ============================================================================
+// Flash
+// ============================================================================
+
+// Adds an erased data partition. Like NOR flash, writes can only clear
+// bits and erases set whole 4 KB sectors back to 0xFF; contents live until
+// the process exits. Writes and erases take typical SPI NOR time on the
+// clock: the flash cache is off on both cores meanwhile, so nothing else
+// runs either.
+static const uint32_t FLASH_PAGE_PROGRAM_US = 700;    // Per 256-byte page
+static const uint32_t FLASH_SECTOR_ERASE_US = 45000;  // Per 4 KB sector
+
+bool addFlashPartition(const char *label, uint8_t subtype, size_t size);
+
+// Power cut: the next `bytes` programmed bytes still land, then writes and
+// erases fail (a write cut short is left partly programmed) until
+// restoreFlashPower()
+void cutFlashPowerAfter(size_t bytes);
+void restoreFlashPower();
+
+} // namespace SimHal
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+#include <Arduino.h>
+#include <stdio.h>
+
+// Host side of the raw capture trace (sensor_trace.h)
+
+// Print that appends to a file, for TraceRecorder on the host
+class FilePrint : public Print {
+public:
+  explicit FilePrint(FILE *f) : file(f) {}
+
+  using Print::write;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *data, size_t length) override {
+    return file ? fwrite(data, 1, length, file) : 0;
+  }
+
+private:
+  FILE *file;
+};
+
+// Readings further apart than this start a new measurement
+static const unsigned long REPLAY_DEFAULT_GAP_MS = 1500;
+
+// Replays a trace file (or a raw serial capture containing one) through
+// ColorSensor -> ColorSampler -> naming as fast as possible. Prints one CSV
+// line per measurement and a throughput summary; returns non-zero if the
+// file could not be read or held no complete reading.
+int replayTrace(const char *path, unsigned long gapMs);
+
+#endif
@@ -0,0 +1,320 @@
+#include "sim_hal.h"
+#include <Adafruit_SSD1306.h>
+#include <algorithm>
+
+// Default 6x8 font cell, scaled by the text size
+static const int16_t CHAR_WIDTH = 6;
+static const int16_t CHAR_HEIGHT = 8;
+
+// Controller RAM: 8 pages of 128 columns, whatever the panel shows
+static const uint8_t RAM_PAGES = 8;
+static const uint8_t RAM_COLUMNS = 128;
+
+static const uint8_t CONTROL_DATA = 0x40;
+
+// Parameter bytes that follow each command the driver sends
+static uint8_t argumentCount(uint8_t c) {
+  switch (c) {
+  case SSD1306_COLUMNADDR:
+  case SSD1306_PAGEADDR:
+    return 2;
+  case SSD1306_MEMORYMODE:
+  case 0x81: // Contrast
+  case 0x8D: // Charge pump
+  case 0xA8: // Multiplex
+  case 0xD3: // Display offset
+  case 0xD5: // Clock divide
+  case 0xD9: // Precharge
+  case 0xDA: // COM pins
+  case 0xDB: // VCOMH
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi,
+                                   int8_t rstPin, uint32_t clkDuring,
+                                   uint32_t clkAfter)
+    : wire(twi), wireClk(clkDuring), restoreClk(clkAfter), address(0),
+      screenWidth(w), screenHeight(h), textSize(1), cursorX(0), cursorY(0),
+      buffer(w * ((h + 7) / 8)), revision(0), shownRevision(0),
+      ram(RAM_PAGES * RAM_COLUMNS), pageStart(0), pageEnd(RAM_PAGES - 1),
+      columnStart(0), columnEnd(RAM_COLUMNS - 1), page(0), column(0),
+      command(0), argsNeeded(0), argCount(0), args() {}
+
+bool Adafruit_SSD1306::begin(uint8_t switchvcc, uint8_t i2caddr, bool reset,
+                             bool periphBegin) {
+  if (periphBegin)
+    wire->begin();
+  address = i2caddr ? i2caddr : (screenHeight == 32 ? 0x3C : 0x3D);
+  SimHal::attachI2cDevice(address, onI2c, this);
+  clearDisplay();
+
+  static const uint8_t init[] = {SSD1306_DISPLAYOFF, SSD1306_MEMORYMODE, 0x00,
+                                 SSD1306_DISPLAYON};
+  sendCommands(init, sizeof(init));
+  return true;
+}
+
+// ============================================================================
+// Drawing
+// ============================================================================
+
+void Adafruit_SSD1306::clearDisplay() {
+  items.clear();
+  std::fill(buffer.begin(), buffer.end(), 0);
+  revision++;
+}
+
+void Adafruit_SSD1306::setCursor(int16_t x, int16_t y) {
+  cursorX = x;
+  cursorY = y;
+}
+
+void Adafruit_SSD1306::setPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= screenWidth || y >= screenHeight)
+    return;
+  uint8_t &cell = buffer[x + (y / 8) * screenWidth];
+  uint8_t bit = 1 << (y & 7);
+  cell = color == SSD1306_WHITE ? cell | bit : cell & ~bit;
+}
+
+void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  setPixel(x, y, color);
+  revision++;
+}
+
+// Five columns of seven rows derived from the character code; blank for
+// spaces, like the real font
+void Adafruit_SSD1306::drawGlyph(uint8_t c) {
+  if (c == ' ')
+    return;
+  uint64_t pattern = (uint64_t)(c + 1) * 0x9E3779B97F4A7C15ULL;
+  for (int16_t col = 0; col < 5; col++) {
+    uint8_t bits = (pattern >> (col * 12)) & 0x7F;
+    for (int16_t row = 0; row < 7; row++) {
+      if (!(bits & (1 << row)))
+        continue;
+      for (int16_t sx = 0; sx < textSize; sx++) {
+        for (int16_t sy = 0; sy < textSize; sy++) {
+          setPixel(cursorX + col * textSize + sx,
+                   cursorY + row * textSize + sy, SSD1306_WHITE);
+        }
+      }
+    }
+  }
+}
+
+size_t Adafruit_SSD1306::write(uint8_t c) {
+  if (c == '\r')
+    return 1;
+  if (c == '\n') {
+    cursorX = 0;
+    cursorY += CHAR_HEIGHT * textSize;
+    return 1;
+  }
+
+  // Continue the run that ends at the cursor, or start a new one
+  Item *run = nullptr;
+  for (Item &item : items) {
+    int16_t end = item.x + (int16_t)item.text.size() * CHAR_WIDTH * textSize;
+    if (item.y == cursorY && end == cursorX) {
+      run = &item;
+      break;
+    }
+  }
+  if (!run) {
+    items.push_back({cursorX, cursorY, std::string()});
+    run = &items.back();
+  }
+
+  run->text += (char)c;
+  drawGlyph(c);
+  revision++;
+  cursorX += CHAR_WIDTH * textSize;
+  return 1;
+}
+
+void Adafruit_SSD1306::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                uint16_t color) {
+  for (int16_t i = 0; i < w; i++) {
+    setPixel(x + i, y, color);
+    setPixel(x + i, y + h - 1, color);
+  }
+  for (int16_t i = 0; i < h; i++) {
+    setPixel(x, y + i, color);
+    setPixel(x + w - 1, y + i, color);
+  }
+  revision++;
+
+  int16_t cells = std::max<int16_t>(1, w / CHAR_WIDTH - 2);
+  items.push_back({x, y, "[" + std::string(cells, '.') + "]"});
+}
+
+// Only fills inside an outline drawn by drawRect() show up in the text
+// (bars)
+void Adafruit_SSD1306::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                uint16_t color) {
+  for (int16_t i = 0; i < w; i++) {
+    for (int16_t j = 0; j < h; j++) {
+      setPixel(x + i, y + j, color);
+    }
+  }
+  revision++;
+
+  for (Item &item : items) {
+    if (item.x != x || item.y != y || item.text.size() < 3 ||
+        item.text[0] != '[')
+      continue;
+
+    size_t cells = item.text.size() - 2;
+    size_t outline = (cells + 2) * CHAR_WIDTH;
+    size_t filled = std::min(cells, (size_t)std::max<int16_t>(0, w) * cells /
+                                        outline);
+    std::fill(item.text.begin() + 1, item.text.begin() + 1 + filled, '#');
+    return;
+  }
+}
+
+// ============================================================================
+// Transfers
+// ============================================================================
+
+void Adafruit_SSD1306::sendCommands(const uint8_t *commands, size_t count) {
+  wire->setClock(wireClk);
+  wire->beginTransmission(address);
+  wire->write((uint8_t)0x00);
+  for (size_t i = 0; i < count; i++) {
+    wire->write(commands[i]);
+  }
+  wire->endTransmission();
+  wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::ssd1306_command(uint8_t c) { sendCommands(&c, 1); }
+
+void Adafruit_SSD1306::display() {
+  const uint8_t window[] = {SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0,
+                            (uint8_t)(screenWidth - 1)};
+  sendCommands(window, sizeof(window));
+
+  wire->setClock(wireClk);
+  size_t sent = 0;
+  while (sent < buffer.size()) {
+    wire->beginTransmission(address);
+    wire->write(CONTROL_DATA);
+    size_t chunk =
+        std::min(buffer.size() - sent, TwoWire::BUFFER_LENGTH - 1);
+    wire->write(buffer.data() + sent, chunk);
+    wire->endTransmission();
+    sent += chunk;
+  }
+  wire->setClock(restoreClk);
+}
+
+// ============================================================================
+// Panel
+// ============================================================================
+
+void Adafruit_SSD1306::onI2c(void *context, const uint8_t *data,
+                             size_t length) {
+  static_cast<Adafruit_SSD1306 *>(context)->receive(data, length);
+}
+
+void Adafruit_SSD1306::receive(const uint8_t *data, size_t length) {
+  if (length == 0)
+    return;
+
+  if (!(data[0] & CONTROL_DATA)) {
+    for (size_t i = 1; i < length; i++) {
+      commandByte(data[i]);
+    }
+    return;
+  }
+
+  for (size_t i = 1; i < length; i++) {
+    writeRam(data[i]);
+  }
+  if (revision != shownRevision && showsBuffer()) {
+    shownRevision = revision;
+    emitFrame();
+  }
+}
+
+void Adafruit_SSD1306::commandByte(uint8_t c) {
+  if (argsNeeded == 0) {
+    command = c;
+    argCount = 0;
+    argsNeeded = argumentCount(c);
+    if (argsNeeded == 0)
+      runCommand();
+    return;
+  }
+  args[argCount++] = c;
+  if (--argsNeeded == 0)
+    runCommand();
+}
+
+// Only the addressing window matters for the model (horizontal mode)
+void Adafruit_SSD1306::runCommand() {
+  if (command == SSD1306_COLUMNADDR) {
+    columnStart = std::min<uint8_t>(args[0], RAM_COLUMNS - 1);
+    columnEnd = std::min<uint8_t>(args[1], RAM_COLUMNS - 1);
+    column = columnStart;
+  } else if (command == SSD1306_PAGEADDR) {
+    pageStart = std::min<uint8_t>(args[0], RAM_PAGES - 1);
+    pageEnd = std::min<uint8_t>(args[1], RAM_PAGES - 1);
+    page = pageStart;
+  }
+}
+
+void Adafruit_SSD1306::writeRam(uint8_t value) {
+  ram[page * RAM_COLUMNS + column] = value;
+  if (column < columnEnd) {
+    column++;
+    return;
+  }
+  column = columnStart;
+  page = page < pageEnd ? page + 1 : pageStart;
+}
+
+bool Adafruit_SSD1306::showsBuffer() const {
+  for (size_t p = 0; p < (size_t)(screenHeight + 7) / 8; p++) {
+    if (!std::equal(buffer.begin() + p * screenWidth,
+                    buffer.begin() + (p + 1) * screenWidth,
+                    ram.begin() + p * RAM_COLUMNS))
+      return false;
+  }
+  return true;
+}
+
+void Adafruit_SSD1306::emitFrame() {
+  std::vector<Item> sorted(items);
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const Item &a, const Item &b) {
+                     return a.y != b.y ? a.y < b.y : a.x < b.x;
+                   });
+
+  // One text line per distinct y, runs placed at their character column
+  std::string frame;
+  std::string line;
+  int16_t lineY = -1;
+  for (const Item &item : sorted) {
+    if (item.y != lineY) {
+      if (lineY >= 0)
+        frame += line + "\n";
+      line.clear();
+      lineY = item.y;
+    }
+    size_t cell = std::max<int16_t>(0, item.x) / CHAR_WIDTH;
+    if (line.size() < cell)
+      line.resize(cell, ' ');
+    line += item.text;
+  }
+  if (lineY >= 0)
+    frame += line + "\n";
+
+  lastFrame = frame;
+  SimHal::emitFrame(lastFrame.c_str());
+}
@@ -0,0 +1,230 @@
+#include "sim_hal.h"
+#include <Arduino.h>
+#include <Wire.h>
+
+HardwareSerial Serial;
+TwoWire Wire;
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ============================================================================
+// Wire
+// ============================================================================
+
+void TwoWire::beginTransmission(uint8_t addr) {
+  address = addr;
+  length = 0;
+}
+
+size_t TwoWire::write(uint8_t c) {
+  if (length >= BUFFER_LENGTH)
+    return 0;
+  buffer[length++] = c;
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  // 9 clocks per byte (8 bits + ACK) plus the address byte, start and stop
+  uint64_t bits = (length + 1) * 9 + 2;
+  SimHal::advanceMicros((uint32_t)((bits * 1000000 + clock - 1) / clock));
+
+  bool acked = SimHal::deliverI2c(address, buffer, length);
+  length = 0;
+  return acked ? 0 : 2;
+}
+
+// ============================================================================
+// String
+// ============================================================================
+
+static std::string formatInteger(unsigned long value, bool negative,
+                                 unsigned char base) {
+  if (base < 2 || base > 16)
+    base = 10;
+
+  char digits[sizeof(unsigned long) * 8 + 2];
+  size_t pos = sizeof(digits);
+  digits[--pos] = '\0';
+  do {
+    digits[--pos] = "0123456789ABCDEF"[value % base];
+    value /= base;
+  } while (value > 0);
+  if (negative)
+    digits[--pos] = '-';
+  return std::string(digits + pos);
+}
+
+static std::string formatSigned(long value, unsigned char base) {
+  // Like the Arduino core, only base 10 prints a sign
+  if (base == 10 && value < 0)
+    return formatInteger(0UL - (unsigned long)value, true, base);
+  return formatInteger((unsigned long)value, false, base);
+}
+
+static std::string formatFloat(double value, unsigned int decimals) {
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, value);
+  return std::string(buffer);
+}
+
+String::String(int value, unsigned char base)
+    : buffer(formatSigned(value, base)) {}
+
+String::String(unsigned int value, unsigned char base)
+    : buffer(formatInteger(value, false, base)) {}
+
+String::String(long value, unsigned char base)
+    : buffer(formatSigned(value, base)) {}
+
+String::String(unsigned long value, unsigned char base)
+    : buffer(formatInteger(value, false, base)) {}
+
+String::String(float value, unsigned int decimals)
+    : buffer(formatFloat(value, decimals)) {}
+
+String::String(double value, unsigned int decimals)
+    : buffer(formatFloat(value, decimals)) {}
+
+int String::indexOf(char c) const {
+  size_t pos = buffer.find(c);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from) const {
+  return from >= buffer.size() ? String() : String(buffer.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to)
+    std::swap(from, to);
+  if (from >= buffer.size())
+    return String();
+  return String(buffer.substr(from, to - from));
+}
+
+bool String::startsWith(const String &prefix) const {
+  return buffer.compare(0, prefix.buffer.size(), prefix.buffer) == 0;
+}
+
+void String::trim() {
+  size_t first = buffer.find_first_not_of(" \t\r\n");
+  size_t last = buffer.find_last_not_of(" \t\r\n");
+  buffer = first == std::string::npos
+               ? std::string()
+               : buffer.substr(first, last - first + 1);
+}
+
+String operator+(const String &lhs, const String &rhs) {
+  String result(lhs);
+  result += rhs;
+  return result;
+}
+
+String operator+(const String &lhs, const char *rhs) {
+  String result(lhs);
+  result += rhs;
+  return result;
+}
+
+String operator+(const char *lhs, const String &rhs) {
+  String result(lhs);
+  result += rhs;
+  return result;
+}
+
+// ============================================================================
+// Print / Serial
+// ============================================================================
+
+size_t Print::write(const uint8_t *data, size_t length) {
+  size_t n = 0;
+  while (length--) {
+    n += write(*data++);
+  }
+  return n;
+}
+
+size_t Print::print(unsigned char value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(int value, int base) { return print((long)value, base); }
+
+size_t Print::print(unsigned int value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base) {
+  return write(formatSigned(value, base).c_str());
+}
+
+size_t Print::print(unsigned long value, int base) {
+  return write(formatInteger(value, false, base).c_str());
+}
+
+size_t Print::print(double value, int digits) {
+  return write(formatFloat(value, digits).c_str());
+}
+
+size_t Print::printf(const char *format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0)
+    return 0;
+  return write((const uint8_t *)buffer,
+               min((size_t)length, sizeof(buffer) - 1));
+}
+
+int HardwareSerial::available() { return SimHal::serialAvailable(); }
+
+int HardwareSerial::read() { return SimHal::serialRead(); }
+
+size_t HardwareSerial::write(uint8_t c) { return write(&c, 1); }
+
+size_t HardwareSerial::write(const uint8_t *data, size_t length) {
+  SimHal::emitSerial(data, length);
+  return length;
+}
+
+// ============================================================================
+// Time / GPIO
+// ============================================================================
+
+unsigned long millis() {
+  return (unsigned long)(SimHal::nowMicros() / 1000ULL);
+}
+
+unsigned long micros() { return (unsigned long)SimHal::nowMicros(); }
+
+void delay(unsigned long ms) {
+  // One millisecond per step so tickers see the same granularity as loop()
+  while (ms--) {
+    SimHal::advanceMicros(1000);
+  }
+}
+
+void delayMicroseconds(unsigned int us) { SimHal::advanceMicros(us); }
+
+void yield() {}
+
+void pinMode(uint8_t pin, uint8_t mode) { SimHal::setMode(pin, mode); }
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  SimHal::writePin(pin, level ? HIGH : LOW);
+}
+
+int digitalRead(uint8_t pin) { return SimHal::readPin(pin); }
+
+void attachInterruptArg(uint8_t pin, void (*fn)(void *), void *arg,
+                        int mode) {
+  SimHal::attachPinInterrupt(pin, fn, arg, mode);
+}
+
+void detachInterrupt(uint8_t pin) {
+  SimHal::attachPinInterrupt(pin, nullptr, nullptr, 0);
+}
@@ -0,0 +1,161 @@
+#include "sim_hal.h"
+#include <BLEDevice.h>
+
+static BLEServer *server = nullptr;
+static BLEAdvertising advertising;
+static std::vector<BLECharacteristic *> characteristics;
+static gatts_event_handler customHandler = nullptr;
+static uint16_t nextHandle = 1;
+
+// What a central can discover: attributes left out of the table are not
+static BLECharacteristic *findCharacteristic(const char *uuid) {
+  for (BLECharacteristic *characteristic : characteristics) {
+    if (characteristic->getHandle() != 0 &&
+        strcmp(characteristic->getUUIDString(), uuid) == 0)
+      return characteristic;
+  }
+  return nullptr;
+}
+
+bool BLEService::reserveHandles(uint32_t count) {
+  if (count > handlesLeft) {
+    Serial.println("[ble] service out of attribute handles");
+    return false;
+  }
+  handlesLeft -= count;
+  return true;
+}
+
+BLECharacteristic *BLEService::createCharacteristic(const char *uuid,
+                                                    uint32_t properties) {
+  // Declaration, then value
+  uint16_t handle = 0;
+  if (reserveHandles(2)) {
+    nextHandle++;
+    handle = nextHandle++;
+  }
+  BLECharacteristic *characteristic =
+      new BLECharacteristic(uuid, properties, handle, this);
+  characteristics.push_back(characteristic);
+  return characteristic;
+}
+
+void BLECharacteristic::addDescriptor(BLEDescriptor *descriptor) {
+  if (handle != 0 && service->reserveHandles(1))
+    descriptor->setHandle(nextHandle++);
+  descriptors.push_back(descriptor);
+}
+
+BLEDescriptor *BLECharacteristic::getDescriptorByUUID(const char *uuid) {
+  for (BLEDescriptor *descriptor : descriptors) {
+    if (strcmp(descriptor->getUUIDString(), uuid) == 0)
+      return descriptor;
+  }
+  return nullptr;
+}
+
+// The library notifies every connected central (its one CCCD value is not
+// modelled)
+void BLECharacteristic::notify(bool isNotification) {
+  for (uint16_t id = 0; id < SimHal::BLE_MAX_CENTRALS; id++) {
+    SimHal::emitNotification(id, uuid.c_str(), value.data(), value.size());
+  }
+}
+
+void BLEServer::startAdvertising() { SimHal::setBleAdvertising(true); }
+
+uint32_t BLEServer::getConnectedCount() {
+  return SimHal::bleConnectionCount();
+}
+
+void BLEServer::disconnect(uint16_t connId) { SimHal::bleDisconnect(connId); }
+
+void BLEServer::updateConnParams(esp_bd_addr_t remote_bda,
+                                 uint16_t minInterval, uint16_t maxInterval,
+                                 uint16_t latency, uint16_t timeout) {
+  SimHal::updateBleConnParams(remote_bda,
+                              {minInterval, maxInterval, latency, timeout});
+}
+
+void BLEAdvertising::start() { SimHal::setBleAdvertising(true); }
+
+void BLEAdvertising::stop() { SimHal::setBleAdvertising(false); }
+
+BLEServer *BLEDevice::createServer() {
+  if (!server)
+    server = new BLEServer();
+  return server;
+}
+
+BLEServer *BLEDevice::getServer() { return server; }
+
+BLEAdvertising *BLEDevice::getAdvertising() { return &advertising; }
+
+void BLEDevice::startAdvertising() { SimHal::setBleAdvertising(true); }
+
+void BLEDevice::stopAdvertising() { SimHal::setBleAdvertising(false); }
+
+void BLEDevice::setCustomGattsHandler(gatts_event_handler handler) {
+  customHandler = handler;
+}
+
+esp_err_t esp_ble_gatts_send_indicate(esp_gatt_if_t gatts_if, uint16_t conn_id,
+                                      uint16_t attr_handle, uint16_t value_len,
+                                      uint8_t *value, bool need_confirm) {
+  for (BLECharacteristic *characteristic : characteristics) {
+    if (attr_handle == 0 || characteristic->getHandle() != attr_handle)
+      continue;
+    return SimHal::emitNotification(conn_id, characteristic->getUUIDString(),
+                                    value, value_len)
+               ? ESP_OK
+               : ESP_FAIL;
+  }
+  return ESP_FAIL;
+}
+
+uint16_t esp_ble_get_cur_sendable_packets_num(uint16_t connid) {
+  return SimHal::bleSendable(connid);
+}
+
+// ============================================================================
+// Central side of writes (sim_hal.h)
+// ============================================================================
+
+bool SimHal::bleWrite(uint16_t connId, const char *uuid, const uint8_t *data,
+                      size_t length) {
+  BLECharacteristic *characteristic = findCharacteristic(uuid);
+  if (!bleConnected(connId) || !characteristic)
+    return false;
+
+  esp_ble_gatts_cb_param_t param = {};
+  param.write.conn_id = connId;
+  param.write.handle = characteristic->getHandle();
+  param.write.len = length;
+  param.write.value = const_cast<uint8_t *>(data);
+  if (customHandler)
+    customHandler(ESP_GATTS_WRITE_EVT, server->getGattsIf(), &param);
+
+  characteristic->setValue(const_cast<uint8_t *>(data), length);
+  if (characteristic->getCallbacks())
+    characteristic->getCallbacks()->onWrite(characteristic, &param);
+  return true;
+}
+
+bool SimHal::bleSubscribe(uint16_t connId, const char *uuid, bool enabled) {
+  BLECharacteristic *characteristic = findCharacteristic(uuid);
+  if (!bleConnected(connId) || !characteristic)
+    return false;
+  BLEDescriptor *cccd = characteristic->getDescriptorByUUID("2902");
+  if (!cccd || cccd->getHandle() == 0)
+    return false;
+
+  uint8_t value[2] = {(uint8_t)(enabled ? 0x01 : 0x00), 0x00};
+  esp_ble_gatts_cb_param_t param = {};
+  param.write.conn_id = connId;
+  param.write.handle = cccd->getHandle();
+  param.write.len = sizeof(value);
+  param.write.value = value;
+  if (customHandler)
+    customHandler(ESP_GATTS_WRITE_EVT, server->getGattsIf(), &param);
+  return true;
+}
@@ -0,0 +1,138 @@
+#include "sim_hal.h"
+#include <esp_partition.h>
+#include <string.h>
+#include <vector>
+
+namespace {
+
+const size_t MAX_PARTITIONS = 4;
+const size_t FLASH_SECTOR_SIZE = 4096;
+const size_t FLASH_PAGE_SIZE = 256;
+
+struct Partition {
+  esp_partition_t info;
+  std::vector<uint8_t> data;
+};
+
+Partition partitions[MAX_PARTITIONS];
+size_t partitionCount = 0;
+uint32_t nextAddress = 0x10000;
+
+bool powerCut = false;
+size_t bytesUntilCut = 0;
+
+std::vector<uint8_t> *dataOf(const esp_partition_t *partition) {
+  for (size_t i = 0; i < partitionCount; i++) {
+    if (&partitions[i].info == partition)
+      return &partitions[i].data;
+  }
+  return nullptr;
+}
+
+} // namespace
+
+// ============================================================================
+// Control (SimHal)
+// ============================================================================
+
+namespace SimHal {
+
+bool addFlashPartition(const char *label, uint8_t subtype, size_t size) {
+  if (partitionCount == MAX_PARTITIONS || size % FLASH_SECTOR_SIZE != 0 ||
+      strlen(label) >= sizeof(esp_partition_t::label))
+    return false;
+
+  Partition &p = partitions[partitionCount++];
+  p.info.type = ESP_PARTITION_TYPE_DATA;
+  p.info.subtype = (esp_partition_subtype_t)subtype;
+  p.info.address = nextAddress;
+  p.info.size = size;
+  strcpy(p.info.label, label);
+  p.info.encrypted = false;
+  p.data.assign(size, 0xFF);
+  nextAddress += size;
+  return true;
+}
+
+void cutFlashPowerAfter(size_t bytes) {
+  powerCut = true;
+  bytesUntilCut = bytes;
+}
+
+void restoreFlashPower() { powerCut = false; }
+
+} // namespace SimHal
+
+// ============================================================================
+// esp_partition API
+// ============================================================================
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char *label) {
+  for (size_t i = 0; i < partitionCount; i++) {
+    const esp_partition_t &info = partitions[i].info;
+    if (info.type != type)
+      continue;
+    if (subtype != ESP_PARTITION_SUBTYPE_ANY && info.subtype != subtype)
+      continue;
+    if (label && strcmp(info.label, label) != 0)
+      continue;
+    return &info;
+  }
+  return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition,
+                             size_t src_offset, void *dst, size_t size) {
+  std::vector<uint8_t> *data = dataOf(partition);
+  if (!data)
+    return ESP_ERR_INVALID_ARG;
+  if (src_offset > data->size() || size > data->size() - src_offset)
+    return ESP_ERR_INVALID_SIZE;
+  memcpy(dst, data->data() + src_offset, size);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition,
+                              size_t dst_offset, const void *src, size_t size) {
+  std::vector<uint8_t> *data = dataOf(partition);
+  if (!data)
+    return ESP_ERR_INVALID_ARG;
+  if (dst_offset > data->size() || size > data->size() - dst_offset)
+    return ESP_ERR_INVALID_SIZE;
+
+  // Each page the range touches is programmed separately
+  size_t pages = size == 0 ? 0
+                           : (dst_offset + size - 1) / FLASH_PAGE_SIZE -
+                                 dst_offset / FLASH_PAGE_SIZE + 1;
+  SimHal::advanceMicros(pages * SimHal::FLASH_PAGE_PROGRAM_US);
+
+  const uint8_t *bytes = static_cast<const uint8_t *>(src);
+  for (size_t i = 0; i < size; i++) {
+    if (powerCut) {
+      if (bytesUntilCut == 0)
+        return ESP_FAIL;
+      bytesUntilCut--;
+    }
+    (*data)[dst_offset + i] &= bytes[i];
+  }
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition,
+                                    size_t offset, size_t size) {
+  std::vector<uint8_t> *data = dataOf(partition);
+  if (!data)
+    return ESP_ERR_INVALID_ARG;
+  if (offset % FLASH_SECTOR_SIZE != 0 || size % FLASH_SECTOR_SIZE != 0 ||
+      offset > data->size() || size > data->size() - offset)
+    return ESP_ERR_INVALID_SIZE;
+  if (powerCut && bytesUntilCut == 0)
+    return ESP_FAIL;
+
+  SimHal::advanceMicros(size / FLASH_SECTOR_SIZE *
+                        SimHal::FLASH_SECTOR_ERASE_US);
+  memset(data->data() + offset, 0xFF, size);
+  return ESP_OK;
+}
@@ -0,0 +1,261 @@
+#include "link_capture.h"
+#include "serial_link.h"
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace {
+
+// Time the device gets to answer a command
+const int ACK_TIMEOUT_MS = 2000;
+
+volatile sig_atomic_t interrupted = 0;
+
+void onInterrupt(int) { interrupted = 1; }
+
+// Print that writes straight to the port, for writeLinkFrame()
+class FdPrint : public Print {
+public:
+  explicit FdPrint(int fd) : fd(fd) {}
+
+  using Print::write;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *data, size_t length) override {
+    size_t written = 0;
+    while (written < length) {
+      ssize_t n = ::write(fd, data + written, length - written);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        break;
+      written += n;
+    }
+    return written;
+  }
+
+private:
+  int fd;
+};
+
+struct CaptureState {
+  FILE *out;
+  const CaptureOptions *options;
+  LinkReader reader;
+  uint32_t rows;
+  uint32_t lost; // Sequence gaps: frames lost on the wire
+  uint16_t nextSequence;
+  uint32_t firstMs;
+  uint32_t lastMs;
+  bool acked;
+  uint8_t ackOpcode;
+  uint8_t ackStatus;
+  uint32_t ackValue;
+};
+
+speed_t baudConstant(uint32_t baud) {
+  switch (baud) {
+  case 115200:
+    return B115200;
+  case 230400:
+    return B230400;
+#ifdef B460800
+  case 460800:
+    return B460800;
+#endif
+#ifdef B921600
+  case 921600:
+    return B921600;
+#endif
+  default:
+    return 0;
+  }
+}
+
+// Raw 8N1 at the given rate; anything that is not a tty is left alone
+bool configurePort(int fd, uint32_t baud) {
+  if (!isatty(fd))
+    return true;
+
+  speed_t speed = baudConstant(baud);
+  termios tty;
+  if (speed == 0 || tcgetattr(fd, &tty) != 0) {
+    fprintf(stderr, "Unsupported baud rate %u\n", baud);
+    return false;
+  }
+  cfmakeraw(&tty);
+  cfsetispeed(&tty, speed);
+  cfsetospeed(&tty, speed);
+  tty.c_cflag |= CLOCAL | CREAD;
+  tty.c_cc[VMIN] = 0;
+  tty.c_cc[VTIME] = 0;
+  return tcsetattr(fd, TCSANOW, &tty) == 0 && tcflush(fd, TCIFLUSH) == 0;
+}
+
+void writeReadings(CaptureState &state) {
+  const CaptureOptions &options = *state.options;
+  size_t count = state.reader.getLength() / LINK_READING_SIZE;
+  for (size_t i = 0; i < count; i++) {
+    LinkReading r;
+    decodeLinkReading(state.reader.getPayload() + i * LINK_READING_SIZE, r);
+    if (state.rows > 0) {
+      state.lost += (uint16_t)(r.sequence - state.nextSequence);
+    } else {
+      state.firstMs = r.timestamp;
+    }
+    state.nextSequence = r.sequence + 1;
+    if (options.count > 0 && state.rows >= options.count)
+      continue;
+
+    fprintf(state.out, "%s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+            options.label, r.sequence, r.timestamp, r.red, r.green, r.blue,
+            r.raw[0], r.raw[1], r.raw[2], r.info & LINK_INFO_SCALING_MASK,
+            (r.info & LINK_INFO_AUTO_RANGE) ? 1 : 0,
+            (r.info & LINK_INFO_AMBIENT) ? 1 : 0,
+            (r.info & LINK_INFO_STREAMED) ? 1 : 0,
+            (r.info & LINK_INFO_LED) ? 1 : 0);
+    state.lastMs = r.timestamp;
+    state.rows++;
+  }
+}
+
+void handleFrame(CaptureState &state) {
+  const uint8_t *payload = state.reader.getPayload();
+  if (state.reader.getType() == LINK_FRAME_READINGS &&
+      state.reader.getLength() % LINK_READING_SIZE == 0) {
+    writeReadings(state);
+  } else if (state.reader.getType() == LINK_FRAME_ACK &&
+             state.reader.getLength() == LINK_ACK_SIZE) {
+    state.acked = true;
+    state.ackOpcode = payload[0];
+    state.ackStatus = payload[1];
+    state.ackValue = (uint32_t)payload[2] | ((uint32_t)payload[3] << 8) |
+                     ((uint32_t)payload[4] << 16) |
+                     ((uint32_t)payload[5] << 24);
+  }
+}
+
+// Reads what is there (up to timeoutMs for the first byte); text between
+// frames goes to stderr
+bool pump(int fd, CaptureState &state, int timeoutMs) {
+  pollfd pfd = {fd, POLLIN, 0};
+  int ready = poll(&pfd, 1, timeoutMs);
+  if (ready <= 0)
+    return ready == 0 || errno == EINTR;
+
+  uint8_t buffer[4096];
+  ssize_t n = read(fd, buffer, sizeof(buffer));
+  if (n < 0)
+    return errno == EINTR || errno == EAGAIN;
+  if (n == 0) {
+    usleep(timeoutMs * 1000); // A FIFO without a writer
+    return true;
+  }
+
+  for (ssize_t i = 0; i < n; i++) {
+    if (state.reader.isIdle() && buffer[i] != LINK_SYNC) {
+      fputc(buffer[i], stderr);
+    }
+    if (state.reader.feed(buffer[i])) {
+      handleFrame(state);
+    }
+  }
+  return true;
+}
+
+// Sends a command and waits for its ACK, storing readings meanwhile
+bool command(int fd, CaptureState &state, uint8_t opcode, const uint8_t *args,
+             uint8_t length) {
+  uint8_t payload[1 + LINK_MAX_COMMAND_ARGS];
+  payload[0] = opcode;
+  if (length > 0) {
+    memcpy(payload + 1, args, length);
+  }
+  FdPrint port(fd);
+  writeLinkFrame(port, LINK_FRAME_COMMAND, payload, 1 + length);
+
+  state.acked = false;
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(ACK_TIMEOUT_MS);
+  while (!(state.acked && state.ackOpcode == opcode)) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      fprintf(stderr, "\nNo answer to command 0x%02X\n", opcode);
+      return false;
+    }
+    state.acked = false;
+    if (!pump(fd, state, 50))
+      return false;
+  }
+  if (state.ackStatus != LINK_OK) {
+    fprintf(stderr, "\nCommand 0x%02X refused (status %u)\n", opcode,
+            state.ackStatus);
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+int captureLink(const CaptureOptions &options) {
+  int fd = open(options.port, O_RDWR | O_NOCTTY);
+  if (fd < 0) {
+    fprintf(stderr, "Cannot open %s\n", options.port);
+    return 1;
+  }
+  if (!configurePort(fd, options.baud)) {
+    close(fd);
+    return 1;
+  }
+
+  FILE *out = fopen(options.outPath, "a");
+  if (!out) {
+    fprintf(stderr, "Cannot open %s\n", options.outPath);
+    close(fd);
+    return 1;
+  }
+  if (ftell(out) == 0) {
+    fprintf(out, "label,sequence,time_ms,red,green,blue,raw_red,raw_green,"
+                 "raw_blue,scaling,auto_range,ambient,streamed,led\n");
+  }
+
+  CaptureState state = {};
+  state.out = out;
+  state.options = &options;
+  signal(SIGINT, onInterrupt);
+
+  bool ok = true;
+  if (options.scaling >= 0) {
+    uint8_t scaling = options.scaling;
+    ok = command(fd, state, LINK_CMD_SET_SCALING, &scaling, 1);
+  }
+  uint8_t rate = options.rateHz;
+  ok = ok && command(fd, state, LINK_CMD_START_STREAM, &rate, 1);
+
+  auto start = std::chrono::steady_clock::now();
+  while (ok && !interrupted &&
+         (options.count == 0 || state.rows < options.count)) {
+    ok = pump(fd, state, 200);
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+  // Whatever the device still had is read (and dropped past the count)
+  bool stopped = command(fd, state, LINK_CMD_STOP_STREAM, nullptr, 0);
+  uint32_t dropped = stopped ? state.ackValue : 0;
+  fclose(out);
+  close(fd);
+
+  uint32_t spanMs = state.lastMs - state.firstMs;
+  fprintf(stderr,
+          "\n%u readings (%s) to %s in %.1f s, %.1f readings/s; %u lost on "
+          "the wire, %u dropped on the device, %u bytes outside frames\n",
+          state.rows, options.label, options.outPath, seconds,
+          state.rows > 1 && spanMs > 0 ? (state.rows - 1) * 1000.0 / spanMs
+                                       : 0.0,
+          state.lost, dropped, state.reader.getSkippedBytes());
+  return ok && stopped ? 0 : 1;
+}
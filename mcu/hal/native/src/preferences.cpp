@@ -0,0 +1,111 @@
+#include <Preferences.h>
+#include <map>
+#include <vector>
+
+// Shared by every Preferences instance, keyed "namespace/key"
+static std::map<std::string, std::vector<uint8_t>> &storage() {
+  static std::map<std::string, std::vector<uint8_t>> entries;
+  return entries;
+}
+
+bool Preferences::begin(const char *name, bool readOnly,
+                        const char *partitionLabel) {
+  // NVS namespace names are limited to 15 characters
+  if (!name || strlen(name) > 15)
+    return false;
+  ns = name;
+  open = true;
+  this->readOnly = readOnly;
+  return true;
+}
+
+bool Preferences::clear() {
+  if (!open || readOnly)
+    return false;
+  std::string prefix = ns + "/";
+  auto &entries = storage();
+  for (auto it = entries.begin(); it != entries.end();) {
+    if (it->first.compare(0, prefix.size(), prefix) == 0)
+      it = entries.erase(it);
+    else
+      ++it;
+  }
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  if (!open || readOnly)
+    return false;
+  return storage().erase(path(key)) > 0;
+}
+
+bool Preferences::isKey(const char *key) {
+  return open && storage().count(path(key)) > 0;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value,
+                             size_t length) {
+  if (!open || readOnly || !key || !value)
+    return 0;
+  const uint8_t *bytes = static_cast<const uint8_t *>(value);
+  storage()[path(key)].assign(bytes, bytes + length);
+  return length;
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  if (!open)
+    return 0;
+  auto it = storage().find(path(key));
+  return it == storage().end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char *key, void *buffer,
+                             size_t maxLength) {
+  size_t length = getBytesLength(key);
+  if (length == 0 || length > maxLength)
+    return 0;
+  memcpy(buffer, storage()[path(key)].data(), length);
+  return length;
+}
+
+// Scalars are stored as their bytes and read back only at the same size
+template <typename T>
+static T readScalar(Preferences &prefs, const char *key, T defaultValue) {
+  T value;
+  return prefs.getBytesLength(key) == sizeof(T) &&
+                 prefs.getBytes(key, &value, sizeof(T)) == sizeof(T)
+             ? value
+             : defaultValue;
+}
+
+size_t Preferences::putUChar(const char *key, uint8_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+uint8_t Preferences::getUChar(const char *key, uint8_t defaultValue) {
+  return readScalar(*this, key, defaultValue);
+}
+
+size_t Preferences::putUShort(const char *key, uint16_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+uint16_t Preferences::getUShort(const char *key, uint16_t defaultValue) {
+  return readScalar(*this, key, defaultValue);
+}
+
+size_t Preferences::putUInt(const char *key, uint32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t defaultValue) {
+  return readScalar(*this, key, defaultValue);
+}
+
+size_t Preferences::putBool(const char *key, bool value) {
+  return putUChar(key, value ? 1 : 0);
+}
+
+bool Preferences::getBool(const char *key, bool defaultValue) {
+  return getUChar(key, defaultValue ? 1 : 0) != 0;
+}
@@ -0,0 +1,355 @@
+#include "sim_hal.h"
+#include <BLEDevice.h>
+#include <deque>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace SimHal {
+
+namespace {
+
+struct TickerSlot {
+  Ticker fn;
+  void *context;
+};
+
+uint64_t clockUs = 0;
+TickerSlot tickers[MAX_TICKERS];
+uint8_t tickerCount = 0;
+
+struct I2cSlot {
+  uint8_t address;
+  I2cDevice fn;
+  void *context;
+};
+
+I2cSlot i2cDevices[MAX_I2C_DEVICES];
+uint8_t i2cDeviceCount = 0;
+
+uint8_t inputs[PIN_COUNT];
+uint8_t outputs[PIN_COUNT];
+uint8_t modes[PIN_COUNT];
+
+struct PinInterrupt {
+  PinHandler fn;
+  void *arg;
+  int mode;
+};
+
+PinInterrupt interrupts[PIN_COUNT];
+
+void writeStdout(void *context, const uint8_t *data, size_t length) {
+  fwrite(data, 1, length, stdout);
+}
+
+SerialSink serialSink = writeStdout;
+std::string serialRx;
+void *serialContext = nullptr;
+DisplaySink displaySink = nullptr;
+void *displayContext = nullptr;
+BleSink bleSink = nullptr;
+void *bleContext = nullptr;
+
+bool advertising = false;
+uint32_t droppedNotifications = 0;
+
+struct Notification {
+  std::string uuid;
+  std::vector<uint8_t> data;
+};
+
+struct Central {
+  bool connected;
+  BleConnParams params;
+  std::deque<Notification> txQueue;
+  uint64_t nextEventUs;
+};
+
+Central centrals[BLE_MAX_CENTRALS];
+
+Central *findCentral(uint16_t connId) {
+  if (connId >= BLE_MAX_CENTRALS || !centrals[connId].connected)
+    return nullptr;
+  return &centrals[connId];
+}
+
+uint64_t intervalUs(const Central &central) {
+  uint16_t interval = central.params.minInterval ? central.params.minInterval
+                                                 : BLE_DEFAULT_INTERVAL;
+  return interval * 1250ULL;
+}
+
+// Sends what each controller queue holds at every connection event that
+// has passed
+void serviceLink() {
+  for (uint16_t id = 0; id < BLE_MAX_CENTRALS; id++) {
+    Central &central = centrals[id];
+    while (central.connected && clockUs >= central.nextEventUs) {
+      for (uint8_t i = 0;
+           i < BLE_PACKETS_PER_EVENT && !central.txQueue.empty(); i++) {
+        Notification n = central.txQueue.front();
+        central.txQueue.pop_front();
+        if (bleSink)
+          bleSink(bleContext, id, n.uuid.c_str(), n.data.data(),
+                  n.data.size());
+      }
+      central.nextEventUs += intervalUs(central);
+    }
+  }
+}
+
+} // namespace
+
+// ============================================================================
+// Clock
+// ============================================================================
+
+uint64_t nowMicros() { return clockUs; }
+
+void advanceMicros(uint32_t us) {
+  clockUs += us;
+  for (uint8_t i = 0; i < tickerCount; i++) {
+    tickers[i].fn(tickers[i].context, us);
+  }
+  serviceLink();
+}
+
+bool addTicker(Ticker fn, void *context) {
+  if (tickerCount >= MAX_TICKERS)
+    return false;
+  tickers[tickerCount].fn = fn;
+  tickers[tickerCount].context = context;
+  tickerCount++;
+  return true;
+}
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+void setInput(uint8_t pin, uint8_t level) {
+  if (pin >= PIN_COUNT)
+    return;
+  uint8_t previous = inputs[pin];
+  inputs[pin] = level;
+
+  const PinInterrupt &irq = interrupts[pin];
+  if (!irq.fn || level == previous)
+    return;
+  if (irq.mode == CHANGE || (irq.mode == RISING && level == HIGH) ||
+      (irq.mode == FALLING && level == LOW)) {
+    irq.fn(irq.arg);
+  }
+}
+
+uint8_t getOutput(uint8_t pin) { return pin < PIN_COUNT ? outputs[pin] : 0; }
+
+uint8_t getMode(uint8_t pin) { return pin < PIN_COUNT ? modes[pin] : 0; }
+
+void writePin(uint8_t pin, uint8_t level) {
+  if (pin < PIN_COUNT)
+    outputs[pin] = level;
+}
+
+uint8_t readPin(uint8_t pin) {
+  if (pin >= PIN_COUNT)
+    return 0;
+  return modes[pin] == OUTPUT ? outputs[pin] : inputs[pin];
+}
+
+void attachPinInterrupt(uint8_t pin, PinHandler fn, void *arg, int mode) {
+  if (pin < PIN_COUNT)
+    interrupts[pin] = {fn, arg, mode};
+}
+
+void setMode(uint8_t pin, uint8_t mode) {
+  if (pin >= PIN_COUNT)
+    return;
+  modes[pin] = mode;
+  // Pull-ups idle high until the simulation drives the pin
+  if (mode == INPUT_PULLUP)
+    inputs[pin] = HIGH;
+}
+
+// ============================================================================
+// I2C
+// ============================================================================
+
+bool attachI2cDevice(uint8_t address, I2cDevice fn, void *context) {
+  for (uint8_t i = 0; i < i2cDeviceCount; i++) {
+    if (i2cDevices[i].address == address) {
+      i2cDevices[i].fn = fn;
+      i2cDevices[i].context = context;
+      return true;
+    }
+  }
+  if (i2cDeviceCount >= MAX_I2C_DEVICES)
+    return false;
+  i2cDevices[i2cDeviceCount++] = {address, fn, context};
+  return true;
+}
+
+bool deliverI2c(uint8_t address, const uint8_t *data, size_t length) {
+  for (uint8_t i = 0; i < i2cDeviceCount; i++) {
+    if (i2cDevices[i].address == address) {
+      i2cDevices[i].fn(i2cDevices[i].context, data, length);
+      return true;
+    }
+  }
+  return false;
+}
+
+// ============================================================================
+// Sinks
+// ============================================================================
+
+void setSerialSink(SerialSink fn, void *context) {
+  serialSink = fn;
+  serialContext = context;
+}
+
+void setDisplaySink(DisplaySink fn, void *context) {
+  displaySink = fn;
+  displayContext = context;
+}
+
+void setBleSink(BleSink fn, void *context) {
+  bleSink = fn;
+  bleContext = context;
+}
+
+void emitSerial(const uint8_t *data, size_t length) {
+  if (serialSink)
+    serialSink(serialContext, data, length);
+}
+
+void serialInput(const char *text) { serialRx += text; }
+
+void serialInput(const uint8_t *data, size_t length) {
+  serialRx.append((const char *)data, length);
+}
+
+int serialAvailable() { return serialRx.size(); }
+
+int serialRead() {
+  if (serialRx.empty())
+    return -1;
+  uint8_t c = serialRx[0];
+  serialRx.erase(0, 1);
+  return c;
+}
+
+void emitFrame(const char *frame) {
+  if (displaySink)
+    displaySink(displayContext, frame);
+}
+
+bool emitNotification(uint16_t connId, const char *uuid, const uint8_t *data,
+                      size_t length) {
+  Central *central = findCentral(connId);
+  if (!central)
+    return false;
+  if (central->txQueue.size() >= BLE_TX_QUEUE_SIZE) {
+    droppedNotifications++;
+    return false;
+  }
+  central->txQueue.push_back(
+      {uuid, std::vector<uint8_t>(data, data + length)});
+  return true;
+}
+
+size_t bleSendable(uint16_t connId) {
+  Central *central = findCentral(connId);
+  return central ? BLE_TX_QUEUE_SIZE - central->txQueue.size() : 0;
+}
+
+// ============================================================================
+// BLE central
+// ============================================================================
+
+uint16_t bleConnect(uint16_t mtu) {
+  BLEServer *server = BLEDevice::getServer();
+  if (!advertising || !server)
+    return BLE_NO_CONNECTION;
+  uint16_t id = 0;
+  while (id < BLE_MAX_CENTRALS && centrals[id].connected) {
+    id++;
+  }
+  if (id == BLE_MAX_CENTRALS)
+    return BLE_NO_CONNECTION;
+
+  // Advertising stops once a central connects
+  Central &central = centrals[id];
+  central.connected = true;
+  central.params = {};
+  central.nextEventUs = clockUs + intervalUs(central);
+  advertising = false;
+
+  esp_ble_gatts_cb_param_t param = {};
+  param.connect.conn_id = id;
+  static const esp_bd_addr_t CENTRAL = {0x5A, 0x11, 0x22, 0x33, 0x44, 0x50};
+  memcpy(param.connect.remote_bda, CENTRAL, sizeof(CENTRAL));
+  param.connect.remote_bda[5] += id;
+  param.mtu.conn_id = id;
+  param.mtu.mtu = mtu;
+
+  BLEServerCallbacks *callbacks = server->getCallbacks();
+  if (callbacks) {
+    callbacks->onConnect(server);
+    callbacks->onConnect(server, &param);
+    callbacks->onMtuChanged(server, &param);
+  }
+  return id;
+}
+
+void bleDisconnect(uint16_t connId) {
+  BLEServer *server = BLEDevice::getServer();
+  Central *central = findCentral(connId);
+  if (!central || !server)
+    return;
+
+  central->connected = false;
+  central->txQueue.clear();
+  esp_ble_gatts_cb_param_t param = {};
+  param.disconnect.conn_id = connId;
+
+  BLEServerCallbacks *callbacks = server->getCallbacks();
+  if (callbacks) {
+    callbacks->onDisconnect(server);
+    callbacks->onDisconnect(server, &param);
+  }
+}
+
+bool bleConnected() { return bleConnectionCount() > 0; }
+
+bool bleConnected(uint16_t connId) { return findCentral(connId) != nullptr; }
+
+uint8_t bleConnectionCount() {
+  uint8_t count = 0;
+  for (const Central &central : centrals) {
+    if (central.connected)
+      count++;
+  }
+  return count;
+}
+
+bool bleAdvertising() { return advertising; }
+
+uint32_t bleDroppedNotifications() { return droppedNotifications; }
+
+BleConnParams bleConnParams(uint16_t connId) {
+  Central *central = findCentral(connId);
+  return central ? central->params : BleConnParams{};
+}
+
+void setBleAdvertising(bool active) { advertising = active; }
+
+void updateBleConnParams(const uint8_t *address, const BleConnParams &params) {
+  Central *central = findCentral(address[5] - 0x50);
+  if (central)
+    central->params = params;
+}
+
+} // namespace SimHal
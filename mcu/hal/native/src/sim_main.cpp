@@ -0,0 +1,992 @@
+/*********
+  Host-native simulation of the color detector (env:native)
+
+  Same objects and wiring as main.cpp, with the PCNT capture replaced by
+  SimFrequencyCapture and a simulated surface under the sensor. Runs a
+  scripted session (samples, finalize, streaming, sleep and wake) on the
+  simulated clock and prints serial output, OLED frames and decoded BLE
+  records. Two clients are connected: an operator's phone and a
+  supervisor's tablet that only subscribes to results and stats. The phone
+  also pulls the journal over the sync characteristic (journal_sync.h),
+  through a disconnect and a lost packet.
+
+    program                     scripted session
+    program --record FILE       same, writing a raw capture trace to FILE
+    program --replay FILE [--gap MS]
+                                replay a trace (trace_replay.h)
+    program --capture PORT --out FILE [--label NAME] [--rate HZ]
+            [--scaling 0-2|auto] [--count N] [--baud BAUD]
+                                stream a device's readings into a CSV
+                                (link_capture.h)
+*********/
+#include "acquisition_task.h"
+#include "ble_packet.h"
+#include "ble_service.h"
+#include "boot_log.h"
+#include "button.h"
+#include "calibration_store.h"
+#include "color_sampler.h"
+#include "color_sensor.h"
+#include "config_store.h"
+#include "display.h"
+#include "journal_sync.h"
+#include "link_capture.h"
+#include "measurement_journal.h"
+#include "power_manager.h"
+#include "sampling_controller.h"
+#include "sensor_trace.h"
+#include "serial_link.h"
+#include "sim_frequency_capture.h"
+#include "sim_hal.h"
+#include "trace_replay.h"
+#include <Arduino.h>
+
+// Hardware configuration (same pins as main.cpp)
+static const uint8_t PIN_S0 = 27;
+static const uint8_t PIN_S1 = 25;
+static const uint8_t PIN_S2 = 32;
+static const uint8_t PIN_S3 = 33;
+static const uint8_t PIN_LED = 26;
+static const uint8_t PIN_BUTTON = 13;
+
+Display display(128, 32, 21, 22);
+SimFrequencyCapture capture;
+ColorSensor sensor(PIN_S0, PIN_S1, PIN_S2, PIN_S3, 35, PIN_LED, capture);
+AcquisitionTask acquisition(sensor);
+CalibrationStore calibration;
+ColorSampler sampler;
+Button button(PIN_BUTTON);
+Bluetooth ble;
+PowerManager power(PIN_BUTTON, ble);
+MeasurementJournal journal;
+JournalSync journalSync(journal, ble);
+ConfigStore settings(ble);
+
+SamplingController controller(display, sensor, acquisition, calibration,
+                              sampler, button, ble, power, journal,
+                              settings);
+
+TraceRecorder recorder(sensor);
+static FILE *traceFile = nullptr;
+
+// Matches the delay(30) in main.cpp's loop()
+static const unsigned long LOOP_PERIOD_MS = 30;
+
+// Same size as the "journal" entry in partitions.csv
+static const size_t JOURNAL_PARTITION_SIZE = 0x100000;
+
+// Power-on to the controller taking input (first sample well within it)
+static const uint32_t BOOT_READY_MAX_MS = 1000;
+
+// Stored measurements the phone syncs in one go
+static const uint32_t SYNC_BACKLOG = 3000;
+
+// ============================================================================
+// Simulated Surface
+// ============================================================================
+
+// The surface is given as the RGB the active calibration should report;
+// the model inverts that calibration to the OUT frequency the LED light
+// produces per filter (at 20% scaling, like the calibration). Ambient light
+// adds to it, the clear photodiode sees the sum of the three, and S0/S1
+// scale the result.
+struct Surface {
+  uint8_t rgb[3];
+  uint8_t noisePercent; // Peak period jitter
+};
+
+static Surface surface = {{0, 0, 0}, 0};
+static uint32_t ambientMhz[3] = {0, 0, 0}; // Per color filter, at 20%
+static uint32_t noiseState = 1;
+
+// Deterministic jitter in [-percent, +percent] of value
+static long jitter(long value, uint8_t percent) {
+  noiseState = noiseState * 1664525UL + 1013904223UL;
+  long span = value * percent / 100;
+  if (span == 0)
+    return 0;
+  return (long)((noiseState >> 8) % (2 * span + 1)) - span;
+}
+
+// Reflected LED light through one color filter, mHz at 20%
+static uint64_t litMhz(uint8_t channel, bool noisy) {
+  const CalibrationProfile &profile = calibration.getActive();
+  uint8_t value = surface.rgb[channel];
+
+  // Half-period in 1/255 us
+  long white = profile.white[channel];
+  long black = profile.black[channel];
+  long period = white * 255 + (255 - value) * (black - white);
+  if (noisy)
+    period += jitter(period, surface.noisePercent);
+
+  return 255000000000LL / (2 * period);
+}
+
+static uint32_t surfaceFrequency(void *context) {
+  // Filter select: S2/S3 = L/L red, H/H green, L/H blue, H/L clear
+  bool s2 = SimHal::getOutput(PIN_S2) == HIGH;
+  bool s3 = SimHal::getOutput(PIN_S3) == HIGH;
+  uint8_t filter = s3 ? (s2 ? 1 : 2) : (s2 ? 3 : 0);
+  bool led = SimHal::getOutput(PIN_LED) == HIGH;
+
+  uint64_t mhz = 0;
+  if (filter < 3) {
+    mhz = ambientMhz[filter] + (led ? litMhz(filter, true) : 0);
+  } else {
+    for (uint8_t c = 0; c < 3; c++) {
+      mhz += ambientMhz[c] + (led ? litMhz(c, false) : 0);
+    }
+  }
+
+  // Scaling S0/S1 = L/H 2%, H/L 20%, H/H 100% (L/L powers down)
+  bool s0 = SimHal::getOutput(PIN_S0) == HIGH;
+  bool s1 = SimHal::getOutput(PIN_S1) == HIGH;
+  long percent = s0 ? (s1 ? 100 : 20) : (s1 ? 2 : 0);
+
+  return (uint32_t)(mhz * percent / (20 * 1000));
+}
+
+static void setSurface(uint8_t red, uint8_t green, uint8_t blue,
+                       uint8_t noisePercent) {
+  surface = {{red, green, blue}, noisePercent};
+  Serial.printf("[sim] surface %u,%u,%u (noise %u%%)\n", red, green, blue,
+                noisePercent);
+}
+
+// Ambient light per color filter, Hz at 20% scaling
+static void setAmbient(uint32_t red, uint32_t green, uint32_t blue) {
+  ambientMhz[0] = red * 1000;
+  ambientMhz[1] = green * 1000;
+  ambientMhz[2] = blue * 1000;
+  Serial.printf("[sim] ambient %lu,%lu,%lu Hz\n", (unsigned long)red,
+                (unsigned long)green, (unsigned long)blue);
+}
+
+// ============================================================================
+// Sinks
+// ============================================================================
+
+static String lastFrame;
+static unsigned long frameCount = 0;
+// Per connection id
+static unsigned long notificationCount = 0;
+static unsigned long streamRecords[SimHal::BLE_MAX_CENTRALS] = {};
+static unsigned long finalRecords[SimHal::BLE_MAX_CENTRALS] = {};
+static unsigned long statsSnapshots[SimHal::BLE_MAX_CENTRALS] = {};
+static StatsSnapshot lastStats = {};
+
+static uint16_t phone = SimHal::BLE_NO_CONNECTION;
+static uint16_t tablet = SimHal::BLE_NO_CONNECTION;
+
+// A result published by the script itself (not counted as a final record)
+static const uint16_t PROBE_SEQUENCE = 0xFFFF;
+static uint64_t probeSentUs = 0;
+static uint32_t probeLatencyUs = 0;
+
+// Last config value the tablet was notified of, and how long after its
+// write
+static uint8_t configStatus = 0xFF;
+static uint8_t configField = 0;
+static uint64_t configWrittenUs = 0;
+static uint32_t configLatencyUs = 0;
+
+// Bench host on the serial port: link frames it decoded
+struct LinkHost {
+  LinkReader reader;
+  uint32_t streamed;  // Readings flagged streamed
+  uint32_t triggered; // Single readings
+  uint32_t gaps;      // Missing sequence numbers
+  uint32_t wrongInfo; // Streamed readings not at the scaling asked for
+  uint16_t next;
+  uint32_t firstMs; // Streamed reading timestamps
+  uint32_t lastMs;
+  uint8_t triggeredInfo;
+  uint32_t acked; // LINK_OK
+  uint32_t refused;
+  uint8_t refusedStatus;
+  uint32_t stopDropped;
+};
+
+static LinkHost linkHost = {};
+static uint8_t linkScaling = SCALING_20; // Fixed scaling the host set
+
+static void onLinkFrame() {
+  const uint8_t *payload = linkHost.reader.getPayload();
+  uint8_t length = linkHost.reader.getLength();
+  if (linkHost.reader.getType() == LINK_FRAME_ACK && length == LINK_ACK_SIZE) {
+    if (payload[1] != LINK_OK) {
+      linkHost.refused++;
+      linkHost.refusedStatus = payload[1];
+    } else {
+      linkHost.acked++;
+    }
+    if (payload[0] == LINK_CMD_STOP_STREAM) {
+      linkHost.stopDropped = payload[2] | (payload[3] << 8) |
+                             (payload[4] << 16) | ((uint32_t)payload[5] << 24);
+    }
+    return;
+  }
+  if (linkHost.reader.getType() != LINK_FRAME_READINGS)
+    return;
+
+  for (size_t i = 0; i + LINK_READING_SIZE <= length;
+       i += LINK_READING_SIZE) {
+    LinkReading r;
+    decodeLinkReading(payload + i, r);
+    if (linkHost.streamed + linkHost.triggered > 0) {
+      linkHost.gaps += (uint16_t)(r.sequence - linkHost.next);
+    }
+    linkHost.next = r.sequence + 1;
+    if (!(r.info & LINK_INFO_STREAMED)) {
+      linkHost.triggered++;
+      linkHost.triggeredInfo = r.info;
+      continue;
+    }
+    if (linkHost.streamed++ == 0) {
+      linkHost.firstMs = r.timestamp;
+    }
+    linkHost.lastMs = r.timestamp;
+    if ((r.info & LINK_INFO_AUTO_RANGE) ||
+        (r.info & LINK_INFO_SCALING_MASK) != linkScaling) {
+      linkHost.wrongInfo++;
+    }
+  }
+}
+
+// Serial output: link frames are decoded, everything else printed
+static void onSerial(void *context, const uint8_t *data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (linkHost.reader.isIdle() && data[i] != LINK_SYNC) {
+      fputc(data[i], stdout);
+    }
+    if (linkHost.reader.feed(data[i])) {
+      onLinkFrame();
+    }
+  }
+}
+
+// Typed into the firmware's serial port
+class SerialInputPrint : public Print {
+public:
+  using Print::write;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *data, size_t length) override {
+    SimHal::serialInput(data, length);
+    return length;
+  }
+};
+
+static void sendLinkCommand(uint8_t opcode, int arg = -1) {
+  uint8_t payload[2] = {opcode, (uint8_t)arg};
+  SerialInputPrint port;
+  writeLinkFrame(port, LINK_FRAME_COMMAND, payload, arg < 0 ? 1 : 2);
+}
+
+// Prints a frame only when the screen content changed
+static void onFrame(void *context, const char *frame) {
+  frameCount++;
+  if (lastFrame == frame)
+    return;
+  lastFrame = frame;
+
+  Serial.printf("[oled %lu ms]\n", millis());
+  const char *line = frame;
+  while (*line) {
+    const char *end = strchr(line, '\n');
+    size_t length = end ? (size_t)(end - line) : strlen(line);
+    Serial.printf("  | %.*s\n", (int)length, line);
+    line += length + (end ? 1 : 0);
+  }
+}
+
+// ============================================================================
+// Sync Client
+// ============================================================================
+
+// Phone side of journal_sync.h: checks the packet counter, NACKs a gap,
+// and ACKs every ackEvery packets and after END
+struct SyncClient {
+  uint32_t next;           // Next sequence wanted
+  uint8_t expectedPacket;
+  bool waitingResend;      // NACK sent, DATA ignored until packet 0
+  uint8_t ackEvery;
+  uint8_t sinceAck;
+  uint32_t dataPackets;    // Including the lost one
+  uint32_t losePacket;     // DATA notification to drop (1-based, 0 = none)
+  uint32_t received;       // Distinct records
+  uint32_t duplicates;
+  uint32_t gaps;           // Sequences skipped
+  uint32_t nacks;
+  bool done;
+  uint32_t infoOldest;
+  uint32_t infoLast;
+};
+
+static SyncClient syncClient = {};
+
+static void writeSync(uint8_t type, uint32_t value) {
+  uint8_t command[5] = {type, (uint8_t)value, (uint8_t)(value >> 8),
+                        (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+  SimHal::bleWrite(phone, SYNC_CHARACTERISTIC_UUID, command, sizeof(command));
+}
+
+static void startSync(uint32_t from, uint8_t window) {
+  uint8_t command[10] = {SYNC_CMD_START, (uint8_t)from, (uint8_t)(from >> 8),
+                         (uint8_t)(from >> 16), (uint8_t)(from >> 24),
+                         0, 0, 0, 0, window};
+  syncClient.waitingResend = false;
+  syncClient.sinceAck = 0;
+  syncClient.ackEvery = window / 2;
+  SimHal::bleWrite(phone, SYNC_CHARACTERISTIC_UUID, command, sizeof(command));
+}
+
+static uint32_t getLe32(const uint8_t *in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) |
+         ((uint32_t)in[3] << 24);
+}
+
+static void onSyncPacket(const uint8_t *data, size_t length) {
+  SyncClient &c = syncClient;
+  if (length >= 15 && data[0] == SYNC_INFO) {
+    c.infoOldest = getLe32(data + 1);
+    c.infoLast = getLe32(data + 5);
+    return;
+  }
+  if (length >= 5 && data[0] == SYNC_END) {
+    if (c.waitingResend)
+      return;
+    if (getLe32(data + 1) > c.next) {
+      writeSync(SYNC_CMD_NACK, c.next); // The last DATA went missing
+      c.nacks++;
+      c.waitingResend = true;
+      return;
+    }
+    writeSync(SYNC_CMD_ACK, c.next);
+    c.done = true;
+    return;
+  }
+  if (length < SYNC_DATA_HEADER_SIZE || data[0] != SYNC_DATA)
+    return;
+
+  if (++c.dataPackets == c.losePacket)
+    return;
+  uint8_t packet = data[1];
+  if (packet == 0) {
+    c.waitingResend = false;
+    c.expectedPacket = 0;
+  }
+  if (c.waitingResend)
+    return;
+  if (packet != c.expectedPacket) {
+    writeSync(SYNC_CMD_NACK, c.next);
+    c.nacks++;
+    c.waitingResend = true;
+    return;
+  }
+  c.expectedPacket++;
+
+  size_t count = data[2];
+  for (size_t i = 0; i < count; i++) {
+    MeasurementRecord r;
+    decodeMeasurement(data + SYNC_DATA_HEADER_SIZE +
+                          i * MEASUREMENT_RECORD_SIZE,
+                      r);
+    if (r.sequence < c.next) {
+      c.duplicates++;
+      continue;
+    }
+    c.gaps += r.sequence - c.next;
+    c.next = r.sequence + 1;
+    c.received++;
+  }
+  if (++c.sinceAck >= c.ackEvery) {
+    writeSync(SYNC_CMD_ACK, c.next);
+    c.sinceAck = 0;
+  }
+}
+
+// ============================================================================
+// Notification Sink
+// ============================================================================
+
+static void onNotification(void *context, uint16_t connId, const char *uuid,
+                           const uint8_t *data, size_t length) {
+  if (strcmp(uuid, SYNC_CHARACTERISTIC_UUID) == 0) {
+    onSyncPacket(data, length);
+    return;
+  }
+  if (strcmp(uuid, CONFIG_CHARACTERISTIC_UUID) == 0) {
+    if (length == CONFIG_SIZE && data[0] == CONFIG_VERSION) {
+      configStatus = data[1];
+      configField = data[2];
+      configLatencyUs = SimHal::nowMicros() - configWrittenUs;
+    }
+    return;
+  }
+  StatsSnapshot snapshot;
+  if (strcmp(uuid, STATS_CHARACTERISTIC_UUID) == 0) {
+    if (decodeStats(data, length, snapshot)) {
+      statsSnapshots[connId]++;
+      lastStats = snapshot;
+    }
+    return;
+  }
+
+  ColorRecord records[BLE_MAX_PACKET_SIZE / BLE_RECORD_SIZE];
+  size_t count = decodePacket(data, length, records,
+                              sizeof(records) / sizeof(records[0]));
+  notificationCount++;
+
+  for (size_t i = 0; i < count; i++) {
+    const ColorRecord &r = records[i];
+    if (r.flags & RECORD_FLAG_STREAM) {
+      streamRecords[connId]++;
+      continue; // Summarized at the end
+    }
+    if (r.sequence == PROBE_SEQUENCE) {
+      if (connId == phone)
+        probeLatencyUs = SimHal::nowMicros() - probeSentUs;
+      continue;
+    }
+    if (r.flags & RECORD_FLAG_FINAL)
+      finalRecords[connId]++;
+    Serial.printf("[ble %u] #%u t=%lu rgb=%u,%u,%u raw=%u,%u,%u %s\n",
+                  connId, r.sequence, (unsigned long)r.timestamp, r.red,
+                  r.green, r.blue, r.rawRed, r.rawGreen, r.rawBlue,
+                  ColorSensor::colorNameFor(r.nameId));
+  }
+}
+
+static void advanceCapture(void *context, uint32_t us) {
+  static_cast<SimFrequencyCapture *>(context)->advance(us);
+}
+
+// ============================================================================
+// Session Script
+// ============================================================================
+
+static unsigned long lastLoop = 0;
+
+// Mean of a few direct readings (the controller is idle in between)
+static RGBColor averageReading(int count) {
+  long sum[3] = {0, 0, 0};
+  for (int i = 0; i < count; i++) {
+    RGBColor c = sensor.readColor();
+    sum[0] += c.red;
+    sum[1] += c.green;
+    sum[2] += c.blue;
+  }
+  return {(int)(sum[0] / count), (int)(sum[1] / count),
+          (int)(sum[2] / count)};
+}
+
+static int colorError(const RGBColor &c, const uint8_t *expected) {
+  return abs(c.red - expected[0]) + abs(c.green - expected[1]) +
+         abs(c.blue - expected[2]);
+}
+
+// Acquisition is stepped every millisecond, the controller every loop period
+static void runFor(unsigned long ms) {
+  unsigned long end = millis() + ms;
+  while ((long)(millis() - end) < 0) {
+    if (millis() - lastLoop >= LOOP_PERIOD_MS) {
+      lastLoop = millis();
+      controller.update();
+    }
+    acquisition.poll();
+    display.poll();
+    journal.poll();
+    journalSync.poll();
+    SimHal::advanceMicros(1000);
+
+    if (traceFile) {
+      FilePrint out(traceFile);
+      recorder.flush(out);
+    }
+  }
+}
+
+// The contacts chatter for about a millisecond before settling
+static void bounceTo(uint8_t level) {
+  for (int i = 0; i < 3; i++) {
+    SimHal::setInput(PIN_BUTTON, level);
+    SimHal::advanceMicros(150);
+    SimHal::setInput(PIN_BUTTON, !level);
+    SimHal::advanceMicros(100);
+  }
+  SimHal::setInput(PIN_BUTTON, level);
+}
+
+static void press(unsigned long ms) {
+  bounceTo(LOW);
+  runFor(ms);
+  bounceTo(HIGH);
+}
+
+// Short press, then wait out the tap timeout so it counts alone
+static void singlePress() {
+  press(120);
+  runFor(Button::TAP_TIMEOUT + 200);
+}
+
+// Samples until the confidence check finalizes, or holds to finalize, with
+// whatever settings the device runs
+static void takeMeasurement() {
+  DeviceConfig config = controller.getConfig();
+  for (int i = 0; i < config.minSamples; i++) {
+    singlePress();
+  }
+  if (controller.getState() != STATE_RESULT) {
+    press(config.longPressMs + 200);
+  }
+  runFor(1000);
+}
+
+// Stored measurements from earlier sessions, written straight to the journal
+static void backfillJournal(uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    MeasurementRecord r = {};
+    r.timestamp = i * 1000;
+    r.red = i & 0xFF;
+    r.green = (i >> 8) & 0xFF;
+    r.blue = 128;
+    r.samples = 5;
+    r.ciTenths = JOURNAL_CI_UNKNOWN;
+    journal.append(r);
+    journal.poll();
+  }
+  runFor(MeasurementJournal::FLUSH_DELAY_MS);
+}
+
+static void runUntil(bool (*done)(), unsigned long timeoutMs) {
+  unsigned long start = millis();
+  while (!done() && millis() - start < timeoutMs) {
+    runFor(1);
+  }
+}
+
+static bool syncHalfway() { return syncClient.received >= SYNC_BACKLOG / 2; }
+
+static bool syncDone() { return syncClient.done; }
+
+static bool syncQuarter() { return syncClient.received >= SYNC_BACKLOG / 4; }
+
+// A small result while the sync keeps the phone's link busy
+static void publishProbe() {
+  ColorRecord probe = {};
+  probe.sequence = PROBE_SEQUENCE;
+  probe.flags = RECORD_FLAG_FINAL;
+  PacketEncoder packet;
+  packet.begin(ble.getMtu());
+  packet.add(probe);
+  probeSentUs = SimHal::nowMicros();
+  ble.publish(BLE_CHANNEL_RESULT, packet.data(), packet.size());
+}
+
+// Operator's phone: results, streaming and the journal sync
+static uint16_t connectPhone() {
+  uint16_t id = SimHal::bleConnect(BLE_PREFERRED_MTU);
+  SimHal::bleSubscribe(id, RESULT_CHARACTERISTIC_UUID, true);
+  SimHal::bleSubscribe(id, STREAM_CHARACTERISTIC_UUID, true);
+  SimHal::bleSubscribe(id, SYNC_CHARACTERISTIC_UUID, true);
+  return id;
+}
+
+static void writeConfig(const DeviceConfig &config) {
+  uint8_t value[CONFIG_SIZE];
+  encodeConfig(config, CONFIG_OK, 0, value);
+  configStatus = 0xFF;
+  configWrittenUs = SimHal::nowMicros();
+  SimHal::bleWrite(tablet, CONFIG_CHARACTERISTIC_UUID, value, sizeof(value));
+}
+
+static void doubleTap() {
+  press(100);
+  runFor(150);
+  press(100);
+  runFor(Button::TAP_TIMEOUT + 200);
+}
+
+// Boot as main.cpp does it, one phase after the other: BLE comes up inline
+// here, and the boot screens are not waited out
+static BootLog bootLog;
+static bool warmedUp = false;
+
+static void setup() {
+  SimHal::addTicker(advanceCapture, &capture);
+  capture.setFrequencySource(surfaceFrequency, nullptr);
+  SimHal::setDisplaySink(onFrame, nullptr);
+  SimHal::setBleSink(onNotification, nullptr);
+  SimHal::setSerialSink(onSerial, nullptr);
+
+  Serial.begin(LINK_BAUD_RATE);
+  Serial.println("Starting...");
+
+  if (!display.begin())
+    exit(1);
+
+  display.showSplash();
+  bootLog.mark("display");
+
+  calibration.begin();
+  settings.begin();
+  DeviceConfig stored;
+  if (settings.load(stored) && (stored.flags & CONFIG_FLAG_BOOT_SCREENS)) {
+    display.showWelcome();
+  }
+  bootLog.mark("storage");
+
+  ble.begin("Surface Color Detector");
+  bootLog.mark("ble");
+
+  sensor.setCalibration(calibration.getActive());
+  sensor.begin();
+  acquisition.begin();
+  acquisition.requestSample();
+  bootLog.mark("sensor");
+
+  SimHal::addFlashPartition("journal", MeasurementJournal::PARTITION_SUBTYPE,
+                            JOURNAL_PARTITION_SIZE);
+  journal.begin();
+  button.begin();
+  bootLog.mark("journal");
+
+  SampleRecord warmUp;
+  unsigned long warmUpStart = millis();
+  while (!(warmedUp = acquisition.pop(warmUp)) &&
+         millis() - warmUpStart < AcquisitionTask::READ_TIMEOUT_MS) {
+    acquisition.poll();
+    SimHal::advanceMicros(1000);
+  }
+  bootLog.mark("first reading");
+
+  journalSync.begin();
+  controller.begin();
+  bootLog.mark("ready");
+  bootLog.print(Serial);
+  metrics.set(GAUGE_BOOT_MS, bootLog.getLastMs());
+  Serial.println("Setup complete!");
+}
+
+int main(int argc, char **argv) {
+  const char *recordPath = nullptr;
+  const char *replayPath = nullptr;
+  unsigned long gapMs = REPLAY_DEFAULT_GAP_MS;
+  CaptureOptions link = {nullptr, "capture.csv", "", LINK_BAUD_RATE, 0, -1, 0};
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--record") == 0) {
+      recordPath = argv[i + 1];
+    } else if (strcmp(argv[i], "--replay") == 0) {
+      replayPath = argv[i + 1];
+    } else if (strcmp(argv[i], "--gap") == 0) {
+      gapMs = strtoul(argv[i + 1], nullptr, 10);
+    } else if (strcmp(argv[i], "--capture") == 0) {
+      link.port = argv[i + 1];
+    } else if (strcmp(argv[i], "--out") == 0) {
+      link.outPath = argv[i + 1];
+    } else if (strcmp(argv[i], "--label") == 0) {
+      link.label = argv[i + 1];
+    } else if (strcmp(argv[i], "--rate") == 0) {
+      link.rateHz = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "--scaling") == 0) {
+      link.scaling = strcmp(argv[i + 1], "auto") == 0 ? LINK_SCALING_AUTO
+                                                      : atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "--count") == 0) {
+      link.count = strtoul(argv[i + 1], nullptr, 10);
+    } else if (strcmp(argv[i], "--baud") == 0) {
+      link.baud = strtoul(argv[i + 1], nullptr, 10);
+    }
+  }
+
+  if (replayPath)
+    return replayTrace(replayPath, gapMs);
+  if (link.port)
+    return captureLink(link);
+
+  setup();
+
+  if (recordPath) {
+    traceFile = fopen(recordPath, "wb");
+    if (!traceFile) {
+      fprintf(stderr, "Cannot create trace %s\n", recordPath);
+      return 1;
+    }
+    FilePrint out(traceFile);
+    recorder.begin(out, calibration.getActive());
+  }
+
+  runFor(500);
+
+  phone = connectPhone();
+  runFor(200);
+
+  // Supervisor's tablet: results and stats only
+  tablet = SimHal::bleConnect(BLE_PREFERRED_MTU);
+  SimHal::bleSubscribe(tablet, RESULT_CHARACTERISTIC_UUID, true);
+  SimHal::bleSubscribe(tablet, STATS_CHARACTERISTIC_UUID, true);
+  runFor(200);
+
+  // Samples of a noisy orange surface
+  setSurface(230, 120, 40, 2);
+  takeMeasurement();
+
+  // Leave the result, then stream a blue surface for two seconds
+  singlePress();
+  setSurface(40, 90, 200, 1);
+  doubleTap();
+  runFor(2000);
+  StreamStats stream = controller.getStreamStats();
+  doubleTap();
+  runFor(1000);
+
+  // Hold to switch the LED off: idle with the central still connected,
+  // then wake with a press (the probe reading closes the latency)
+  press(SamplingController::LED_TOGGLE_DURATION + 200);
+  runFor(1000);
+  SimHal::BleConnParams idleParams = SimHal::bleConnParams(phone);
+  singlePress();
+  runFor(500);
+  SimHal::BleConnParams activeParams = SimHal::bleConnParams(phone);
+
+  // A warm desk lamp over the same surface: plain readings shift towards
+  // red, ambient mode subtracts it
+  setSurface(40, 90, 200, 0);
+  setAmbient(6000, 3000, 1500);
+  RGBColor plain = averageReading(4);
+  sensor.setAmbientMode(true);
+  RGBColor compensated = averageReading(4);
+  sensor.setAmbientMode(false);
+  setAmbient(0, 0, 0);
+  int plainError = colorError(plain, surface.rgb);
+  int compensatedError = colorError(compensated, surface.rgb);
+  Serial.printf("[sim] lamp: plain rgb=%d,%d,%d (error %d), compensated "
+                "rgb=%d,%d,%d (error %d)\n",
+                plain.red, plain.green, plain.blue, plainError,
+                compensated.red, compensated.green, compensated.blue,
+                compensatedError);
+
+  // A bench host collects over the binary link: a second of back to back
+  // readings at fixed 100% scaling, then one triggered reading back on
+  // auto-range, then an opcode the firmware does not know
+  int samplesBefore = sampler.getSampleCount();
+  linkScaling = SCALING_100;
+  sendLinkCommand(LINK_CMD_SET_SCALING, SCALING_100);
+  sendLinkCommand(LINK_CMD_START_STREAM, 0);
+  runFor(1000);
+  sendLinkCommand(LINK_CMD_STOP_STREAM);
+  runFor(LOOP_PERIOD_MS);
+  sendLinkCommand(LINK_CMD_SET_SCALING, LINK_SCALING_AUTO);
+  sendLinkCommand(LINK_CMD_TRIGGER_READ);
+  sendLinkCommand(0x7F);
+  runFor(200);
+  double benchRate =
+      linkHost.streamed > 1 && linkHost.lastMs > linkHost.firstMs
+          ? (linkHost.streamed - 1) * 1000.0 /
+                (linkHost.lastMs - linkHost.firstMs)
+          : 0;
+  double benchMaxRate =
+      1000000.0 / (3 * (SamplingController::STREAM_SETTLE_TIME_US +
+                        SamplingController::STREAM_GATE_TIME_US));
+  bool linkSamplesUntouched = sampler.getSampleCount() == samplesBefore;
+  Serial.printf("[sim] link: %u streamed at %.1f readings/s (capture limit "
+                "%.1f), %u triggered, %u gaps, %u wrong scaling, %u dropped; "
+                "%u acked, %u refused (status %u)\n",
+                linkHost.streamed, benchRate, benchMaxRate, linkHost.triggered,
+                linkHost.gaps, linkHost.wrongInfo, linkHost.stopDropped,
+                linkHost.acked, linkHost.refused, linkHost.refusedStatus);
+
+  // The phone pulls the whole journal: one DATA notification is lost on
+  // the way, a result is published a quarter in, and the phone's link
+  // drops halfway through (the tablet stays)
+  backfillJournal(SYNC_BACKLOG);
+  writeSync(SYNC_CMD_INFO, 0);
+  runFor(100);
+  syncClient.next = syncClient.infoOldest;
+  syncClient.losePacket = 40;
+  startSync(syncClient.infoOldest, SYNC_MAX_WINDOW);
+  runUntil(syncQuarter, 10000);
+  publishProbe();
+  runUntil(syncHalfway, 10000);
+  SimHal::BleConnParams syncParams = SimHal::bleConnParams(phone);
+  SimHal::bleDisconnect(phone);
+  runFor(500);
+  bool tabletStayed = SimHal::bleConnected(tablet);
+  phone = connectPhone();
+  runFor(200);
+  uint32_t resumedFrom = syncClient.received;
+  unsigned long resumeMs = millis();
+  startSync(0, SYNC_MAX_WINDOW); // From the resume point
+  runUntil(syncDone, 10000);
+  runFor(10); // The device takes the final ACK on its next pass
+  double resumeSec = (millis() - resumeMs) / 1000.0;
+  uint32_t syncExpected = syncClient.infoLast + 1 - syncClient.infoOldest;
+  SyncStats ss = journalSync.getStats();
+  size_t recordsPerPacket =
+      (BLE_PREFERRED_MTU - BLE_ATT_OVERHEAD - SYNC_DATA_HEADER_SIZE) /
+      MEASUREMENT_RECORD_SIZE;
+  double linkRate = SimHal::BLE_PACKETS_PER_EVENT * recordsPerPacket /
+                    (syncParams.minInterval * 1.25 / 1000.0);
+  double syncRate =
+      resumeSec > 0 ? (syncClient.received - resumedFrom) / resumeSec : 0;
+
+  // The supervisor retunes the station from the tablet. The first write
+  // has the LED toggle hold no longer than the finalize hold and is
+  // rejected as a whole; the second shortens the hold, needs five samples
+  // and leaves finalizing to the operator.
+  SimHal::bleSubscribe(tablet, CONFIG_CHARACTERISTIC_UUID, true);
+  DeviceConfig tuned = controller.getConfig();
+  tuned.minSamples = 5;
+  tuned.ledToggleMs = tuned.longPressMs;
+  writeConfig(tuned);
+  runFor(200);
+  uint8_t rejectedStatus = configStatus;
+  uint8_t rejectedField = configField;
+  bool untouched = controller.getConfig().minSamples ==
+                   SamplingController::MIN_SAMPLES_REQUIRED;
+  tuned = controller.getConfig();
+  tuned.minSamples = 5;
+  tuned.longPressMs = 1000;
+  tuned.flags &= ~CONFIG_FLAG_AUTO_FINALIZE;
+  writeConfig(tuned);
+  runFor(200);
+  DeviceConfig persisted = {};
+  bool saved = settings.load(persisted) && persisted.longPressMs == 1000 &&
+               persisted.minSamples == 5 &&
+               controller.getConfig().minSamples == 5;
+  uint32_t applyLatencyMax =
+      LOOP_PERIOD_MS * 1000 + SimHal::bleConnParams(tablet).maxInterval * 1250;
+
+  // Out of range: the measurement only goes to the journal. Then power
+  // fails while the next one is being programmed, and the device reboots.
+  SimHal::bleDisconnect(phone);
+  SimHal::bleDisconnect(tablet);
+  setSurface(60, 160, 70, 1);
+  takeMeasurement();
+  singlePress();
+  runFor(MeasurementJournal::FLUSH_DELAY_MS);
+  SimHal::cutFlashPowerAfter(20);
+  takeMeasurement();
+  runFor(MeasurementJournal::FLUSH_DELAY_MS);
+  SimHal::restoreFlashPower();
+  JournalStats js = journal.getStats();
+
+  MeasurementJournal rebooted;
+  rebooted.begin();
+  MeasurementRecord stored[4]; // The offline measurement, not the torn one
+  size_t storedCount = rebooted.read(syncClient.infoLast + 1, stored, 4);
+  JournalStats rebootedStats = rebooted.getStats();
+  Serial.printf("[sim] journal: %u appended, %u written in %u batches, %u "
+                "write errors, longest flush %.1f ms; after reboot %u "
+                "records, %u torn, boot #%u\n",
+                js.appended, js.written, js.batches, js.writeErrors,
+                js.maxBatchUs / 1000.0, (unsigned)storedCount,
+                rebootedStats.torn, rebooted.getBoot());
+  for (size_t i = 0; i < storedCount; i++) {
+    const MeasurementRecord &r = stored[i];
+    Serial.printf("[sim]   #%u boot %u at %u ms: rgb=%u,%u,%u %u samples "
+                  "%s\n",
+                  r.sequence, r.boot, r.timestamp, r.red, r.green, r.blue,
+                  r.samples, ColorSensor::colorNameFor(r.nameId));
+  }
+
+  if (traceFile) {
+    FilePrint out(traceFile);
+    recorder.flush(out, true);
+    fclose(traceFile);
+    Serial.printf("[sim] trace: %u records, %u dropped\n",
+                  (unsigned)recorder.getRecordCount(),
+                  (unsigned)recorder.getDroppedCount());
+  }
+
+  // The registry over the serial command, and as the tablet last saw it
+  SimHal::serialInput("metrics\n");
+  runFor(LOOP_PERIOD_MS);
+  uint32_t statsReads = 0;
+  uint32_t statsPeriods = 0;
+  uint32_t statsFlushes = 0;
+  for (uint8_t b = 0; b < METRICS_BUCKETS; b++) {
+    statsReads += lastStats.metrics.histograms[HISTOGRAM_READ_US].buckets[b];
+    statsPeriods +=
+        lastStats.metrics.histograms[HISTOGRAM_LOOP_PERIOD_US].buckets[b];
+    statsFlushes +=
+        lastStats.metrics.histograms[HISTOGRAM_DISPLAY_FLUSH_US].buckets[b];
+  }
+  Serial.printf("[sim] stats at %lu ms: %u readings (max %u us), %u loop "
+                "periods (max %u us), %u flushes (max %u us), %u "
+                "notified\n",
+                (unsigned long)lastStats.uptime, statsReads,
+                lastStats.metrics.histograms[HISTOGRAM_READ_US].max,
+                statsPeriods,
+                lastStats.metrics.histograms[HISTOGRAM_LOOP_PERIOD_US].max,
+                statsFlushes,
+                lastStats.metrics.histograms[HISTOGRAM_DISPLAY_FLUSH_US].max,
+                lastStats.metrics.counters[COUNTER_BLE_NOTIFIED]);
+
+  AcquisitionStats acq = acquisition.getStats();
+  Serial.printf("[sim] %.1f s simulated, %lu frames, %lu notifications\n",
+                millis() / 1000.0, frameCount, notificationCount);
+  Serial.printf("[sim] stream %.1f samples/s, %lu dropped, %lu records\n",
+                stream.samplesPerSec, stream.dropped, streamRecords[phone]);
+  Serial.printf("[sim] tablet: %lu final, %lu streamed records, %lu stats "
+                "snapshots; result %.1f ms behind a sync\n",
+                finalRecords[tablet], streamRecords[tablet],
+                statsSnapshots[tablet], probeLatencyUs / 1000.0);
+  Serial.printf("[sim] config: bad write status %u (field %u)%s, good write "
+                "status %u after %.1f ms, %s\n",
+                rejectedStatus, rejectedField,
+                untouched ? " and ignored" : " but APPLIED", configStatus,
+                configLatencyUs / 1000.0, saved ? "saved" : "NOT saved");
+  Serial.printf("[sim] acquisition %lu readings, %lu missed slots, %u "
+                "overflows\n",
+                acq.readings, acq.missedSlots, (unsigned)acq.overflows);
+  PowerStats ps = power.getStats();
+  Serial.printf("[sim] idle interval %.1f-%.1f ms (latency %u), active "
+                "%.1f-%.1f ms, wake to first sample %.1f ms\n",
+                idleParams.minInterval * 1.25, idleParams.maxInterval * 1.25,
+                idleParams.latency, activeParams.minInterval * 1.25,
+                activeParams.maxInterval * 1.25, ps.wakeLatencyUs / 1000.0);
+
+  Serial.printf("[sim] sync: %u of %u records, %u gaps, %u duplicates, "
+                "%u NACKs, %u rewinds; device %u records in %u ms\n",
+                syncClient.received, syncExpected, syncClient.gaps,
+                syncClient.duplicates, syncClient.nacks, ss.rewinds,
+                ss.lastRecords, ss.lastMs);
+  Serial.printf("[sim] sync after reconnect %.0f records/s at %.1f ms "
+                "interval (link %.0f records/s), %u notifications dropped\n",
+                syncRate, syncParams.minInterval * 1.25, linkRate,
+                SimHal::bleDroppedNotifications());
+
+  Serial.printf("[sim] boot: first reading %s, ready at %u ms (stats %u "
+                "ms)\n",
+                warmedUp ? "taken" : "TIMED OUT", bootLog.getLastMs(),
+                lastStats.metrics.gauges[GAUGE_BOOT_MS]);
+
+  // Non-zero exit if the session did not produce what it scripted
+  return finalRecords[phone] == 1 && streamRecords[phone] > 0 &&
+                 finalRecords[tablet] == 1 && streamRecords[tablet] == 0 &&
+                 statsSnapshots[tablet] > 0 && statsSnapshots[phone] == 0 &&
+                 statsReads > 0 && statsPeriods > 0 && statsFlushes > 0 &&
+                 tabletStayed && probeLatencyUs > 0 &&
+                 rejectedStatus == CONFIG_BAD_VALUE && rejectedField == 6 &&
+                 untouched && configStatus == CONFIG_OK && saved &&
+                 configLatencyUs <= applyLatencyMax &&
+                 probeLatencyUs <= 2 * syncParams.minInterval * 1250 &&
+                 ps.wakes == 1 && benchRate >= 0.9 * benchMaxRate &&
+                 linkHost.gaps == 0 && linkHost.wrongInfo == 0 &&
+                 linkHost.stopDropped == 0 && linkHost.triggered == 1 &&
+                 (linkHost.triggeredInfo & LINK_INFO_AUTO_RANGE) &&
+                 linkSamplesUntouched && linkHost.acked == 5 &&
+                 linkHost.refused == 1 &&
+                 linkHost.refusedStatus == LINK_BAD_COMMAND &&
+                 ps.overBudget == 0 && compensatedError < plainError &&
+                 syncClient.done && syncClient.received == syncExpected &&
+                 syncClient.gaps == 0 && syncClient.nacks > 0 &&
+                 ss.transfers == 1 && syncRate > linkRate / 2 &&
+                 storedCount == 1 && rebootedStats.torn == 1 && warmedUp &&
+                 bootLog.getLastMs() < BOOT_READY_MAX_MS &&
+                 lastStats.metrics.gauges[GAUGE_BOOT_MS] ==
+                     bootLog.getLastMs()
+             ? 0
+             : 1;
+}
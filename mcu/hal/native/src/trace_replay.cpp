@@ -0,0 +1,168 @@
+#include "trace_replay.h"
+#include "calibration_store.h"
+#include "color_sampler.h"
+#include "color_sensor.h"
+#include "replay_frequency_capture.h"
+#include "sensor_trace.h"
+#include "sim_hal.h"
+#include <chrono>
+#include <vector>
+
+namespace {
+
+struct ReplayStats {
+  uint32_t records;
+  uint32_t readings;
+  uint32_t misaligned; // Records not forming a complete reading
+  uint32_t rejected;
+  uint32_t measurements;
+  uint64_t traceUs;    // Trace time covered (sum of record deltas)
+};
+
+void discardSerial(void *context, const uint8_t *data, size_t length) {}
+
+void restoreSerial(void *context, const uint8_t *data, size_t length) {
+  fwrite(data, 1, length, stdout);
+}
+
+// Prints the finished measurement and starts the next one
+void finishMeasurement(ColorSensor &sensor, ColorSampler &sampler,
+                       ReplayStats &stats, uint32_t startUs) {
+  if (sampler.getSampleCount() == 0 && sampler.getRejectedCount() == 0)
+    return;
+
+  RGBColor avg = sampler.getAverage();
+  RawFrequencies raw = sampler.getAverageRaw();
+  printf("%u,%lu,%d,%d,%d,%d,%d,%lu,%lu,%lu,%.1f,%s\n", stats.measurements,
+         (unsigned long)(startUs / 1000), sampler.getSampleCount(),
+         sampler.getRejectedCount(), avg.red, avg.green, avg.blue, raw.red,
+         raw.green, raw.blue, sampler.getConfidenceHalfWidth(),
+         ColorSensor::colorNameFor(sensor.detectColorId(avg)));
+
+  stats.rejected += sampler.getRejectedCount();
+  stats.measurements++;
+  sampler.reset();
+}
+
+} // namespace
+
+int replayTrace(const char *path, unsigned long gapMs) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    fprintf(stderr, "Cannot open trace %s\n", path);
+    return 1;
+  }
+  std::vector<uint8_t> bytes;
+  uint8_t buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    bytes.insert(bytes.end(), buffer, buffer + n);
+  }
+  fclose(file);
+
+  // Same pipeline as the firmware, minus the acquisition task
+  ReplayFrequencyCapture capture;
+  ColorSensor sensor(27, 25, 32, 33, 35, 26, capture);
+  ColorSampler sampler;
+  sensor.begin();
+  sensor.setCalibration(CalibrationStore::defaultProfile(0));
+
+  TraceReader reader;
+  ReplayStats stats = {};
+  TraceRecord reading[ColorSensor::MAX_STEPS];
+  size_t readingSize = 0;
+  bool haveLast = false;
+  uint32_t lastUs = 0;
+  bool haveReading = false;
+  uint32_t lastReadingUs = 0; // End of the previous complete reading
+  uint32_t measurementStartUs = 0;
+  uint32_t gapUs = gapMs * 1000;
+
+  printf("measurement,start_ms,samples,rejected,red,green,blue,raw_red,"
+         "raw_green,raw_blue,ci,name\n");
+
+  // The firmware's own logging would dominate the run time
+  SimHal::setSerialSink(discardSerial, nullptr);
+  auto wallStart = std::chrono::steady_clock::now();
+
+  for (uint8_t byte : bytes) {
+    TraceReader::Event event = reader.feed(byte);
+
+    if (event == TraceReader::HEADER) {
+      const TraceHeader &header = reader.getHeader();
+      sensor.setCalibration(header.profile);
+      sensor.setCaptureTiming(header.settleUs, header.gateUs);
+      readingSize = 0;
+      continue;
+    }
+    if (event != TraceReader::SAMPLES)
+      continue;
+
+    for (size_t i = 0; i < reader.getRecordCount(); i++) {
+      const TraceRecord &record = reader.getRecord(i);
+      stats.records++;
+      if (haveLast)
+        stats.traceUs += (uint32_t)(record.timeUs - lastUs);
+      lastUs = record.timeUs;
+      haveLast = true;
+
+      // A reading is every capture up to the one flagged last
+      if (readingSize == ColorSensor::MAX_STEPS) {
+        stats.misaligned += readingSize;
+        readingSize = 0;
+      }
+      reading[readingSize++] = record;
+      if (!record.last())
+        continue;
+
+      // Read back with the plan the trace was recorded with
+      CaptureStep plan[ColorSensor::MAX_STEPS];
+      for (size_t s = 0; s < readingSize; s++) {
+        plan[s] = reading[s].step();
+      }
+      size_t size = readingSize;
+      readingSize = 0;
+      if (!sensor.setNextPlan(plan, size)) {
+        stats.misaligned += size;
+        continue;
+      }
+
+      if (haveReading &&
+          (uint32_t)(reading[0].timeUs - lastReadingUs) > gapUs) {
+        finishMeasurement(sensor, sampler, stats, measurementStartUs);
+      }
+      lastReadingUs = reading[size - 1].timeUs;
+      haveReading = true;
+      if (sampler.getSampleCount() == 0 && sampler.getRejectedCount() == 0)
+        measurementStartUs = reading[0].timeUs;
+
+      RGBColor color;
+      capture.load(reading, size);
+      sensor.startReading();
+      capture.drain();
+      if (sensor.takeReading(color)) {
+        sampler.addSample(color, sensor.getLastRaw());
+        stats.readings++;
+      }
+    }
+  }
+  finishMeasurement(sensor, sampler, stats, measurementStartUs);
+
+  auto wallEnd = std::chrono::steady_clock::now();
+  SimHal::setSerialSink(restoreSerial, nullptr);
+
+  double wallSec =
+      std::chrono::duration<double>(wallEnd - wallStart).count();
+  double traceSec = stats.traceUs / 1e6;
+  fprintf(stderr,
+          "[replay] %u records, %u readings, %u measurements, %u rejected, "
+          "%u misaligned, %u bytes skipped\n",
+          stats.records, stats.readings, stats.measurements, stats.rejected,
+          stats.misaligned, reader.getSkippedBytes());
+  fprintf(stderr,
+          "[replay] %.1f s of trace in %.3f s (%.0f readings/s, %.0fx)\n",
+          traceSec, wallSec, wallSec > 0 ? stats.readings / wallSec : 0.0,
+          wallSec > 0 ? traceSec / wallSec : 0.0);
+
+  return stats.readings > 0 ? 0 : 1;
+}
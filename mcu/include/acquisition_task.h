@@ -0,0 +1,90 @@
+#ifndef ACQUISITION_TASK_H
+#define ACQUISITION_TASK_H
+
+#include "color_sensor.h"
+#include "spsc_ring_buffer.h"
+#include <Arduino.h>
+
+// One completed reading as handed from the acquisition task to the loop
+struct SampleRecord {
+  unsigned long timestamp; // millis() when the reading started
+  RGBColor color;
+  RawFrequencies raw;
+  bool streamed; // Taken by the streaming schedule, not a single request
+};
+
+struct AcquisitionStats {
+  unsigned long readings;    // Readings pushed or attempted
+  unsigned long missedSlots; // Streaming slots that passed during a reading
+  uint32_t overflows;        // Readings lost because the ring was full
+  uint32_t highWaterMark;    // Most readings ever queued at once
+};
+
+// Runs sensor acquisition in its own FreeRTOS task, pinned to a core and at
+// a higher priority than loop(), so reading timing no longer depends on
+// OLED I2C transfers or BLE work in the loop. Readings reach the loop
+// through a lock-free SPSC ring buffer.
+//
+// Host-native builds have no FreeRTOS: the same schedule runs as a state
+// machine stepped by poll() from the simulation loop.
+class AcquisitionTask {
+public:
+  static constexpr size_t RING_CAPACITY = 32;
+#ifdef ESP_PLATFORM
+  static const uint32_t STACK_SIZE = 4096;
+  static const UBaseType_t PRIORITY = 5;
+  static const BaseType_t CORE = 1;
+#endif
+  static const unsigned long READ_TIMEOUT_MS = 500;
+
+  explicit AcquisitionTask(ColorSensor &sens);
+
+  bool begin();
+
+  // Called from the loop task
+  void requestSample();
+  // A period of 0 starts each reading as soon as the last one is queued
+  void startStreaming(unsigned long periodMs);
+  void stopStreaming();
+  bool pop(SampleRecord &record);
+  void clear();
+  AcquisitionStats getStats();
+
+#ifndef ESP_PLATFORM
+  // Runs whatever the task would do at the current (simulated) time
+  void poll();
+#endif
+
+private:
+  ColorSensor &sensor;
+#ifdef ESP_PLATFORM
+  TaskHandle_t task;
+#endif
+  SpscRingBuffer<SampleRecord, RING_CAPACITY> ring;
+
+  volatile bool requested;
+  volatile bool streaming;
+  volatile unsigned long streamPeriodMs;
+  volatile unsigned long readings;
+  volatile unsigned long missedSlots;
+
+#ifdef ESP_PLATFORM
+  void run();
+  bool acquire(bool streamed);
+  void waitForNextSlot(TickType_t &lastWake);
+
+  static void taskEntry(void *arg);
+#else
+  bool inFlight;
+  bool scheduled; // nextSlot is valid
+  unsigned long nextSlot;
+  SampleRecord pending;
+
+  void start(bool streamed);
+  void finish();
+#endif
+
+  static void onReadingReady(void *context);
+};
+
+#endif
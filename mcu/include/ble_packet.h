@@ -0,0 +1,122 @@
+#ifndef BLE_PACKET_H
+#define BLE_PACKET_H
+
+#include "metrics.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary notification format (little-endian):
+//
+//   [0]    version
+//   [1]    record count
+//   [2..]  count x 18-byte ColorRecord
+//
+// Record layout:
+//   0  u16 sequence     per characteristic, wraps; gaps mean lost records
+//   2  u32 timestamp    ms since boot
+//   6  u8  red, green, blue
+//   9  u8  flags        RECORD_FLAG_*
+//   10 u16 rawRed, rawGreen, rawBlue   half-period in us
+//   16 u16 nameId
+//
+// One record fits the default 23-byte MTU; larger MTUs batch more.
+
+static const uint8_t BLE_PACKET_VERSION = 1;
+static const size_t BLE_PACKET_HEADER_SIZE = 2;
+static const size_t BLE_RECORD_SIZE = 18;
+static const size_t BLE_ATT_OVERHEAD = 3;
+static const size_t BLE_MAX_PACKET_SIZE = 512; // ATT attribute value limit
+
+enum RecordFlags : uint8_t {
+  RECORD_FLAG_FINAL = 0x01,  // Finalized average
+  RECORD_FLAG_STREAM = 0x02, // Streaming reading
+  RECORD_FLAG_TIMEOUT = 0x04 // Sensor returned no edges
+};
+
+struct ColorRecord {
+  uint16_t sequence;
+  uint32_t timestamp;
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+  uint8_t flags;
+  uint16_t rawRed;
+  uint16_t rawGreen;
+  uint16_t rawBlue;
+  uint16_t nameId;
+};
+
+// Packs records into one notification sized for the negotiated MTU
+class PacketEncoder {
+public:
+  PacketEncoder();
+
+  // Starts an empty packet sized for the given ATT MTU
+  void begin(uint16_t mtu);
+  bool add(const ColorRecord &record);
+  void clear();
+
+  bool isEmpty() const { return recordCount == 0; }
+  bool isFull() const { return recordCount >= capacity; }
+  uint8_t getCount() const { return recordCount; }
+  uint8_t getCapacity() const { return capacity; }
+
+  const uint8_t *data() const { return buffer; }
+  size_t size() const {
+    return BLE_PACKET_HEADER_SIZE + recordCount * BLE_RECORD_SIZE;
+  }
+
+  static uint8_t capacityForMtu(uint16_t mtu);
+
+private:
+  uint8_t buffer[BLE_MAX_PACKET_SIZE];
+  uint8_t recordCount;
+  uint8_t capacity;
+};
+
+// Reference decoder. Returns the number of records written to out, or 0 if
+// the packet has an unknown version or an inconsistent length.
+size_t decodePacket(const uint8_t *data, size_t length, ColorRecord *out,
+                    size_t maxRecords);
+
+void encodeRecord(const ColorRecord &record, uint8_t *out);
+void decodeRecord(const uint8_t *in, ColorRecord &record);
+
+// Stats snapshot on the stats characteristic (little-endian), published
+// with every loop report:
+//
+//   0  u8  version
+//   1  u8  clients connected
+//   2  u32 uptime          ms
+//   6  u32 loopMaxUs       worst loop iteration in the report interval
+//   10 u32 loopOverruns    since boot
+//   14 u32 journalLast     last journaled sequence
+//   18 u8  counters, gauges, histograms, buckets per histogram
+//   22 counters x u32      in CounterId order
+//      gauges x u32        in GaugeId order
+//      histograms x (u32 max, buckets x u32)  in HistogramId order
+//
+// A reader goes by the counts: it skips metrics it does not know, reads
+// those the sender lacks as 0 and adds buckets past its last one to that
+// one. A change to anything before the metrics bumps the version.
+// Notifications need an MTU of at least 209; a READ works at any MTU.
+
+static const uint8_t BLE_STATS_VERSION = 2;
+static const size_t BLE_STATS_SIZE =
+    22 + 4 * (COUNTER_COUNT + GAUGE_COUNT) +
+    HISTOGRAM_COUNT * 4 * (1 + METRICS_BUCKETS);
+
+struct StatsSnapshot {
+  uint8_t clients;
+  uint32_t uptime;
+  uint32_t loopMaxUs;
+  uint32_t loopOverruns;
+  uint32_t journalLast;
+  MetricsSnapshot metrics;
+};
+
+void encodeStats(const StatsSnapshot &stats, uint8_t *out);
+// False on an unknown version or a packet shorter than its counts say
+bool decodeStats(const uint8_t *in, size_t length, StatsSnapshot &stats);
+
+#endif
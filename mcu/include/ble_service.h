@@ -7,20 +7,109 @@
 #include <BLEServer.h>
 #include <BLEUtils.h>
 #include <esp_bt.h>
+#include <esp_gap_ble_api.h>
+#include <esp_gatts_api.h>
 
 #define SERVICE_UUID "4fafc201-1fb5-459e-8fcc-c5c9c331914b"
-#define CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26a8"
 
+// One characteristic per kind of traffic. Results keep the original UUID.
+#define RESULT_CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26a8"
+#define SYNC_CHARACTERISTIC_UUID "beb5483f-36e1-4688-b7f5-ea07361b26a8"
+#define STREAM_CHARACTERISTIC_UUID "beb54840-36e1-4688-b7f5-ea07361b26a8"
+#define CONFIG_CHARACTERISTIC_UUID "beb54841-36e1-4688-b7f5-ea07361b26a8"
+#define STATS_CHARACTERISTIC_UUID "beb54842-36e1-4688-b7f5-ea07361b26a8"
+
+// Requested ATT MTU (clients may negotiate lower; default is 23)
+#define BLE_PREFERRED_MTU 247
+#define BLE_DEFAULT_MTU 23
+
+// Centrals served at once; advertising continues until this many connect
+#define BLE_MAX_CLIENTS 3
+
+// Controller buffers bulk data leaves free on a connection, so a result
+// notification never queues behind more than one connection event of it
+#define BLE_BULK_RESERVE 8
+
+// Connection parameters requested from the central, in BLE units (interval
+// 1.25 ms, supervision timeout 10 ms). Active matches the advertised
+// preference; low power lets the central skip up to 4 events in a row.
+#define BLE_ACTIVE_MIN_INTERVAL 0x06 // 7.5 ms
+#define BLE_ACTIVE_MAX_INTERVAL 0x12 // 22.5 ms
+#define BLE_ACTIVE_LATENCY 0
+#define BLE_ACTIVE_TIMEOUT 400       // 4 s
+#define BLE_IDLE_MIN_INTERVAL 320    // 400 ms
+#define BLE_IDLE_MAX_INTERVAL 400    // 500 ms
+#define BLE_IDLE_LATENCY 4
+#define BLE_IDLE_TIMEOUT 600         // 6 s, above (1 + latency) * interval
+
+enum BleChannel : uint8_t {
+  BLE_CHANNEL_RESULT, // Finalized records (ble_packet.h): READ, NOTIFY
+  BLE_CHANNEL_STREAM, // Streaming records (ble_packet.h): NOTIFY
+  BLE_CHANNEL_CONFIG, // Settings (device_config.h): READ, WRITE, NOTIFY
+  BLE_CHANNEL_STATS,  // Snapshot (ble_packet.h): READ, NOTIFY
+  BLE_CHANNEL_SYNC,   // Journal transfer (journal_sync.h): WRITE, NOTIFY
+  BLE_CHANNEL_COUNT
+};
+
+// Called on the BLE stack's task with the bytes a client wrote
+typedef void (*BleWriteHandler)(void *context, uint16_t connId,
+                                const uint8_t *data, size_t length);
+
+// Since begin()
+struct BleStats {
+  uint8_t clients;      // Connected now
+  uint32_t connections;
+  uint32_t notified;    // publish() notifications handed to the controller
+  uint32_t failed;      // publish() notifications the stack refused
+};
+
+// GATT server with several centrals at once (e.g. an operator's phone and
+// a supervisor's tablet). Each connection has its own MTU, connection
+// parameters and subscriptions: a notification goes only to the clients
+// whose CCCD enables it on that characteristic, and one client leaving
+// does not touch the others.
+//
+// Connection state is written on the BLE stack's task and read elsewhere;
+// every field is a single word.
 class Bluetooth {
 private:
   BLEServer *pServer;
-  BLECharacteristic *pCharacteristic;
+  BLECharacteristic *characteristics[BLE_CHANNEL_COUNT];
 
 public:
   Bluetooth();
   void begin(const char *deviceName);
-  void send(const String &data);
+
+  // Sets the characteristic value (what a READ returns) and notifies every
+  // subscribed client; returns how many were notified. Call from one task
+  // (the loop): the outcome is counted in metrics.
+  uint8_t publish(BleChannel channel, const uint8_t *data, size_t length);
+
+  // Bulk traffic to one client. canSendBulk() is false while the
+  // controller has fewer than BLE_BULK_RESERVE free buffers for it.
+  bool canSendBulk(uint16_t connId);
+  bool sendBulk(uint16_t connId, BleChannel channel, const uint8_t *data,
+                size_t length);
+
+  void onWrite(BleChannel channel, BleWriteHandler handler, void *context);
+
   bool isConnected();
+  bool isConnected(uint16_t connId);
+  bool isSubscribed(BleChannel channel); // By any client
+  bool isSubscribed(uint16_t connId, BleChannel channel);
+  // Smallest MTU of the connected clients (what a published packet fits)
+  uint16_t getMtu();
+  uint16_t getMtu(uint16_t connId);
+  BleStats getStats() const;
+
+  // Relaxed connection parameters while idle; also applied to a central
+  // that connects in the meantime
+  void setLowPower(bool enabled);
+  // Active connection parameters for a bulk transfer, even while idle; the
+  // next setLowPower() change applies its own
+  void requestFastConnection(uint16_t connId);
+  void pauseAdvertising();
+  void resumeAdvertising();
 };
 
 #endif
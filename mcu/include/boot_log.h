@@ -0,0 +1,38 @@
+#ifndef BOOT_LOG_H
+#define BOOT_LOG_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Boot phase timestamps: setup() marks the end of each phase with the time
+// since the app started (micros(); the ROM and second stage bootloader run
+// before that and are not counted). Phases that run on another task mark
+// their own end. Reported once, on the serial port, when setup() is done:
+//
+//   Boot: display 112 ms, storage 118 ms, ..., ready 640 ms
+class BootLog {
+public:
+  static const uint8_t MAX_PHASES = 10;
+
+  BootLog();
+
+  // Safe from any task until print(); marks beyond MAX_PHASES are dropped.
+  // The name is kept, not copied.
+  void mark(const char *phase);
+
+  // Time of the last phase marked so far
+  uint32_t getLastMs() const;
+
+  void print(Print &out) const;
+
+private:
+  struct Phase {
+    const char *name;
+    uint32_t us;
+  };
+
+  Phase phases[MAX_PHASES];
+  std::atomic<uint8_t> count;
+};
+
+#endif
@@ -1,45 +1,99 @@
 #ifndef BUTTON_H
 #define BUTTON_H
 
+#include "spsc_ring_buffer.h"
 #include <Arduino.h>
 
+enum ButtonEventType {
+  BUTTON_PRESS,   // Debounced press
+  BUTTON_RELEASE, // Debounced release; durationUs = how long it was held
+  BUTTON_HOLD,    // Still held at a hold threshold; durationUs = threshold
+  BUTTON_TAPS     // Tap sequence over (TAP_TIMEOUT passed); count = taps
+};
+
+struct ButtonEvent {
+  ButtonEventType type;
+  uint32_t timeUs;     // micros() when it happened, not when it was seen
+  uint32_t durationUs;
+  uint8_t count;       // BUTTON_TAPS
+  uint8_t threshold;   // BUTTON_HOLD: index into the hold thresholds
+};
+
+// Active-low push button on a GPIO edge interrupt.
+//
+// The ISR only timestamps edges into a lock-free queue. update(), called
+// from the loop, debounces them on those timestamps (a level counts once it
+// held for DEBOUNCE_US; the change is dated to the first edge of the
+// bounce) and runs the gesture recognizer, which queues ButtonEvents for
+// pollEvent(). Event times are accurate to the interrupt latency, however
+// long the loop takes between update() calls.
+//
+// All state is per instance, so several buttons can coexist.
 class Button {
 public:
   // Configuration constants
-  static const unsigned long DEBOUNCE_DELAY = 50;
-  static const unsigned long TAP_TIMEOUT = 400;
-  static const unsigned long SHORT_PRESS_MAX = 500;
+  static const uint32_t DEBOUNCE_US = 20000;
+  static const unsigned long TAP_TIMEOUT = 400;     // ms after the last tap
+  static const unsigned long SHORT_PRESS_MAX = 500; // ms; longer is no tap
+  static const uint8_t MAX_HOLD_THRESHOLDS = 4;
+  static const size_t EDGE_QUEUE_SIZE = 32;
+  static const size_t EVENT_QUEUE_SIZE = 16;
 
   Button(uint8_t buttonPin);
 
   void begin();
 
-  // Core state
-  void update();
-  bool isPressed();
-  bool isPressedFor(unsigned long durationMs);
-  unsigned long getPressedDuration();
+  // Hold times (ms, ascending) that raise BUTTON_HOLD during a press
+  void setHoldThresholds(const unsigned long *ms, uint8_t count);
 
-  // Edge detection
-  bool wasJustPressed();
-  bool wasJustReleased();
+  // Loop side
+  void update();
+  bool pollEvent(ButtonEvent &event);
 
-  // Multi-tap detection
-  void updateTapCount();
-  int getTapCount();
-  void resetTapCount();
+  // Debounced state as of the last update()
+  bool isPressed() const { return stablePressed; }
+  unsigned long getPressedDuration() const;
+  bool hasPendingTaps() const { return tapCount > 0; }
+  // Drops the taps counted so far (e.g. of a press that was consumed)
+  void cancelTaps() { tapCount = 0; }
 
-  unsigned long getLastPressDuration() { return lastPressDuration; }
+  uint32_t getDroppedEdges() const { return edges.overflowCount(); }
+  uint32_t getDroppedEvents() const { return events.overflowCount(); }
 
 private:
+  struct Edge {
+    uint32_t timeUs;
+    bool pressed;
+  };
+
   uint8_t pin;
-  unsigned long pressStartTime;
-  unsigned long lastPressDuration;
-  unsigned long lastDebounceTime;
-  unsigned long lastTapTime;
-  int tapCount;
-  bool wasPressedBefore;
-  bool lastStableState;
+  SpscRingBuffer<Edge, EDGE_QUEUE_SIZE> edges;
+  SpscRingBuffer<ButtonEvent, EVENT_QUEUE_SIZE> events;
+
+  // Debouncer
+  bool rawPressed;
+  uint32_t rawEdgeUs;     // Last raw edge
+  uint32_t bounceStartUs; // First raw edge since the stable level
+  bool stablePressed;
+
+  // Gesture recognizer
+  uint32_t pressStartUs;
+  uint32_t holdThresholdsUs[MAX_HOLD_THRESHOLDS];
+  uint8_t holdCount;
+  uint8_t nextHold;
+  uint8_t tapCount;
+  uint32_t lastTapUs;
+
+  void addEdge(uint32_t timeUs, bool pressed);
+  void settle(uint32_t nowUs);
+  void onPress(uint32_t timeUs);
+  void onRelease(uint32_t timeUs);
+  void emitHolds(uint32_t untilUs);
+  void checkTapTimeout(uint32_t nowUs);
+  void emit(ButtonEventType type, uint32_t timeUs, uint32_t durationUs = 0,
+            uint8_t count = 0, uint8_t threshold = 0);
+
+  static void onEdge(void *arg);
 };
 
 #endif
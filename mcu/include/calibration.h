@@ -0,0 +1,46 @@
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <Arduino.h>
+
+#define CALIBRATION_NAME_LEN 16
+
+// White/black reference per channel, as OUT half-period in microseconds
+// (the unit of RawFrequencies). Stored as a blob in NVS.
+struct CalibrationProfile {
+  char name[CALIBRATION_NAME_LEN];
+  uint16_t white[3]; // R, G, B
+  uint16_t black[3];
+};
+
+// Half-period -> 0..255 lookup for one channel, built once per profile so
+// the per-sample mapping is a compare and a table read. Entries hold the
+// exact map()/constrain() result of the old hard-coded conversion.
+class ChannelMap {
+public:
+  static const uint16_t TABLE_SIZE = 512; // Max black - white span (us)
+
+  ChannelMap();
+  bool build(uint16_t whitePeriod, uint16_t blackPeriod);
+
+  uint8_t apply(unsigned long period) const {
+    if (period <= white)
+      return 255;
+    unsigned long offset = period - white;
+    return offset >= span ? 0 : table[offset];
+  }
+
+private:
+  uint16_t white;
+  uint16_t span;
+  uint8_t table[TABLE_SIZE];
+};
+
+// Mapping tables for R, G, B (indexed like CalibrationProfile)
+struct CalibrationTable {
+  ChannelMap channels[3];
+
+  bool build(const CalibrationProfile &profile);
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef CALIBRATION_STORE_H
+#define CALIBRATION_STORE_H
+
+#include "calibration.h"
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Named calibration profiles persisted in NVS (Preferences). One profile is
+// active; its slot index is stored alongside so it is loaded at boot.
+class CalibrationStore {
+public:
+  static const uint8_t MAX_PROFILES = 4;
+  static const uint8_t PROFILE_VERSION = 1;
+
+  // Built-in profile used for empty slots (adjust based on your sensor)
+  static const uint16_t DEFAULT_WHITE_RED = 26;
+  static const uint16_t DEFAULT_WHITE_GREEN = 24;
+  static const uint16_t DEFAULT_WHITE_BLUE = 30;
+  static const uint16_t DEFAULT_BLACK_RED = 155;
+  static const uint16_t DEFAULT_BLACK_GREEN = 166;
+  static const uint16_t DEFAULT_BLACK_BLUE = 197;
+
+  CalibrationStore();
+
+  void begin();
+
+  uint8_t getActiveSlot() { return activeSlot; }
+  const CalibrationProfile &getActive() { return active; }
+  bool select(uint8_t slot);
+  bool saveActive(const CalibrationProfile &profile);
+
+  bool load(uint8_t slot, CalibrationProfile &profile);
+  bool save(uint8_t slot, const CalibrationProfile &profile);
+
+  static CalibrationProfile defaultProfile(uint8_t slot);
+  static bool isValid(const CalibrationProfile &profile);
+
+private:
+  Preferences prefs;
+  uint8_t activeSlot;
+  CalibrationProfile active;
+
+  static void slotKey(uint8_t slot, char *key);
+};
+
+#endif
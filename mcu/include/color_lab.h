@@ -0,0 +1,189 @@
+#ifndef COLOR_LAB_H
+#define COLOR_LAB_H
+
+#include "color_sensor.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// CIELAB (D65) color with every component in hundredths:
+// l in [0, 10000], a and b roughly [-12800, 12700]
+struct LabColor {
+  int16_t l;
+  int16_t a;
+  int16_t b;
+};
+
+// Squared CIE76 color difference, in hundredths squared
+inline uint32_t deltaE2(const LabColor &x, const LabColor &y) {
+  int32_t dl = x.l - y.l;
+  int32_t da = x.a - y.a;
+  int32_t db = x.b - y.b;
+  return (uint32_t)(dl * dl) + (uint32_t)(da * da) + (uint32_t)(db * db);
+}
+
+// ============================================================================
+// Fixed-point sRGB -> XYZ -> Lab
+// ============================================================================
+//
+// Integer-only conversion: an 8-bit sRGB -> linear table, a Q14 matrix that
+// folds in the D65 white point, and an interpolated table for the Lab f()
+// curve (cube root above 216/24389, linear below). Both tables are computed
+// by constexpr code at compile time and live in flash.
+//
+// Error against a double-precision reference, over all 2^24 RGB values:
+//   |dL| <= 0.023, |da| <= 0.101, |db| <= 0.055, CIE76 dE <= 0.103
+// (Lab units; a just-noticeable difference is about 2.3)
+
+namespace LabFixed {
+
+static const uint32_t ONE = 1 << 16; // Q16 fixed-point 1.0
+static const int MATRIX_SHIFT = 14;
+static const int F_TABLE_BITS = 10; // 1024 segments over t in [0, 1]
+static const int F_SEGMENT_SHIFT = 16 - F_TABLE_BITS;
+
+// Compile-time math (double precision, only used to build the tables)
+constexpr double ln(double x) {
+  int k = 0;
+  while (x < 0.5) {
+    x *= 2.0;
+    k--;
+  }
+  while (x >= 1.0) {
+    x /= 2.0;
+    k++;
+  }
+  double y = (x - 1.0) / (x + 1.0);
+  double y2 = y * y;
+  double term = y;
+  double sum = 0.0;
+  for (int n = 1; n < 61; n += 2) {
+    sum += term / n;
+    term *= y2;
+  }
+  return 2.0 * sum + k * 0.69314718055994531;
+}
+
+constexpr double exp(double x) {
+  int k = 0;
+  while (x > 0.5) {
+    x -= 0.69314718055994531;
+    k++;
+  }
+  while (x < -0.5) {
+    x += 0.69314718055994531;
+    k--;
+  }
+  double term = 1.0;
+  double sum = 1.0;
+  for (int n = 1; n < 30; n++) {
+    term *= x / n;
+    sum += term;
+  }
+  for (; k > 0; k--)
+    sum *= 2.0;
+  for (; k < 0; k++)
+    sum /= 2.0;
+  return sum;
+}
+
+constexpr double pow(double base, double exponent) {
+  return base <= 0.0 ? 0.0 : exp(exponent * ln(base));
+}
+
+constexpr double srgbToLinear(int value) {
+  double c = value / 255.0;
+  return c <= 0.04045 ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4);
+}
+
+constexpr double labF(double t) {
+  return t > 216.0 / 24389.0 ? pow(t, 1.0 / 3.0)
+                             : (24389.0 / 27.0 * t + 16.0) / 116.0;
+}
+
+struct GammaTable {
+  uint32_t linear[256]; // Q16
+};
+
+struct FTable {
+  uint32_t f[(1 << F_TABLE_BITS) + 1]; // Q16, f(i / 1024)
+};
+
+constexpr GammaTable makeGammaTable() {
+  GammaTable table{};
+  for (int i = 0; i < 256; i++) {
+    table.linear[i] = (uint32_t)(srgbToLinear(i) * ONE + 0.5);
+  }
+  return table;
+}
+
+constexpr FTable makeFTable() {
+  FTable table{};
+  for (int i = 0; i <= (1 << F_TABLE_BITS); i++) {
+    table.f[i] = (uint32_t)(labF((double)i / (1 << F_TABLE_BITS)) * ONE + 0.5);
+  }
+  return table;
+}
+
+inline constexpr GammaTable GAMMA = makeGammaTable();
+inline constexpr FTable F = makeFTable();
+
+// sRGB -> XYZ (D65), each row divided by the white point component, Q14
+constexpr uint32_t q14(double v) {
+  return (uint32_t)(v * (1 << MATRIX_SHIFT) + 0.5);
+}
+inline constexpr uint32_t MATRIX[3][3] = {
+    {q14(0.4124564 / 0.95047), q14(0.3575761 / 0.95047),
+     q14(0.1804375 / 0.95047)},
+    {q14(0.2126729), q14(0.7151522), q14(0.0721750)},
+    {q14(0.0193339 / 1.08883), q14(0.1191920 / 1.08883),
+     q14(0.9503041 / 1.08883)}};
+
+inline uint32_t gamma(int value) {
+  return GAMMA.linear[value < 0 ? 0 : (value > 255 ? 255 : value)];
+}
+
+// f(t) for t in Q16, linearly interpolated between table entries
+inline int32_t f(uint32_t t) {
+  uint32_t index = t >> F_SEGMENT_SHIFT;
+  if (index >= (1 << F_TABLE_BITS))
+    return F.f[1 << F_TABLE_BITS];
+  uint32_t frac = t & ((1 << F_SEGMENT_SHIFT) - 1);
+  uint32_t lo = F.f[index];
+  uint32_t hi = F.f[index + 1];
+  return lo + (((hi - lo) * frac + (1 << (F_SEGMENT_SHIFT - 1))) >>
+               F_SEGMENT_SHIFT);
+}
+
+inline uint32_t row(const uint32_t m[3], uint32_t r, uint32_t g, uint32_t b) {
+  return (m[0] * r + m[1] * g + m[2] * b + (1 << (MATRIX_SHIFT - 1))) >>
+         MATRIX_SHIFT;
+}
+
+} // namespace LabFixed
+
+// Treats RGBColor as sRGB (0-255 per channel)
+inline LabColor rgbToLab(const RGBColor &color) {
+  uint32_t r = LabFixed::gamma(color.red);
+  uint32_t g = LabFixed::gamma(color.green);
+  uint32_t b = LabFixed::gamma(color.blue);
+
+  int32_t fx = LabFixed::f(LabFixed::row(LabFixed::MATRIX[0], r, g, b));
+  int32_t fy = LabFixed::f(LabFixed::row(LabFixed::MATRIX[1], r, g, b));
+  int32_t fz = LabFixed::f(LabFixed::row(LabFixed::MATRIX[2], r, g, b));
+
+  // L = 116 fy - 16, a = 500 (fx - fy), b = 200 (fy - fz), in hundredths
+  LabColor lab;
+  lab.l = (int16_t)(((11600 * fy + (1 << 15)) >> 16) - 1600);
+  lab.a = (int16_t)(((fx - fy) * 25000 + (1 << 14)) >> 15);
+  lab.b = (int16_t)(((fy - fz) * 10000 + (1 << 14)) >> 15);
+  return lab;
+}
+
+// Batch conversion, e.g. for a window of stream samples
+inline void rgbToLab(const RGBColor *colors, LabColor *out, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = rgbToLab(colors[i]);
+  }
+}
+
+#endif
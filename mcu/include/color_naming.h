@@ -0,0 +1,26 @@
+#ifndef COLOR_NAMING_H
+#define COLOR_NAMING_H
+
+#include "color_lab.h"
+#include <stdint.h>
+
+// Nearest named color (CIE76) over the generated palette in
+// color_palette_data.h. Palette IDs are indices into that table and change
+// when it is regenerated.
+namespace ColorNaming {
+
+// Descends the palette k-d tree and scans one leaf (bounded by
+// paletteMaxCandidates() distance evaluations)
+uint16_t nearest(const LabColor &lab);
+
+// Reference linear scan over the whole palette
+uint16_t nearestExhaustive(const LabColor &lab);
+
+const char *nameFor(uint16_t id);
+LabColor labFor(uint16_t id);
+uint16_t paletteSize();
+uint16_t paletteMaxCandidates();
+
+} // namespace ColorNaming
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef COLOR_NAMING_REFERENCE_H
+#define COLOR_NAMING_REFERENCE_H
+
+#include "color_lab.h"
+#include "color_naming.h"
+#include <math.h>
+#include <stdlib.h>
+
+// Host-side references for the palette namer (bench and tests only, not
+// called by the firmware): the RGB threshold chain it replaced, and a
+// double-precision Lab -> sRGB inverse to classify palette entries with it.
+namespace ColorNamingReference {
+
+// The classes of the old chain
+enum ChainClass : uint8_t {
+  CHAIN_UNKNOWN,
+  CHAIN_BLACK,
+  CHAIN_DARK_GRAY,
+  CHAIN_GRAY,
+  CHAIN_LIGHT_GRAY,
+  CHAIN_WHITE,
+  CHAIN_YELLOW,
+  CHAIN_ORANGE,
+  CHAIN_DARK_RED,
+  CHAIN_RED,
+  CHAIN_DARK_GREEN,
+  CHAIN_GREEN,
+  CHAIN_DARK_BLUE,
+  CHAIN_BLUE,
+  CHAIN_BROWN,
+  CHAIN_CYAN,
+  CHAIN_MAGENTA,
+  CHAIN_PURPLE,
+  CHAIN_PINK
+};
+
+// ColorSensor::detectColorId() before the palette, unchanged
+inline ChainClass thresholdChain(const RGBColor &color) {
+  const int r = color.red;
+  const int g = color.green;
+  const int b = color.blue;
+  const int brightness = (r + g + b) / 3;
+
+  auto isGrayish = [&](int tolerance) {
+    return abs(r - g) < tolerance && abs(g - b) < tolerance &&
+           abs(r - b) < tolerance;
+  };
+
+  if (r < 30 && g < 30 && b < 30)
+    return CHAIN_BLACK;
+  if (brightness < 50 && isGrayish(20))
+    return CHAIN_DARK_GRAY;
+  if (brightness < 120 && isGrayish(25))
+    return CHAIN_GRAY;
+  if (brightness < 200 && isGrayish(30))
+    return CHAIN_LIGHT_GRAY;
+  if (r > 200 && g > 200 && b > 200)
+    return CHAIN_WHITE;
+
+  if (r > 120 && g > 120 && b < 80 && abs(r - g) < 50)
+    return CHAIN_YELLOW;
+  if (r > 150 && g > 60 && g < 140 && b < 70)
+    return CHAIN_ORANGE;
+
+  if (r > g + 25 && r > b + 25) {
+    return brightness < 80 ? CHAIN_DARK_RED : CHAIN_RED;
+  }
+  if (g > r + 40 && g > b + 40) {
+    return brightness < 80 ? CHAIN_DARK_GREEN : CHAIN_GREEN;
+  }
+  if (b > r + 40 && b > g + 40) {
+    return brightness < 80 ? CHAIN_DARK_BLUE : CHAIN_BLUE;
+  }
+
+  if (r > 80 && r < 180 && g > 40 && g < 120 && b < 80)
+    return CHAIN_BROWN;
+  if (g > 150 && b > 150 && r < 100)
+    return CHAIN_CYAN;
+
+  if (r > 120 && b > 120 && g < 100) {
+    return r > b + 30 ? CHAIN_MAGENTA : CHAIN_PURPLE;
+  }
+
+  if (r > 180 && g > 100 && g < 180 && b > 120 && b < 200)
+    return CHAIN_PINK;
+
+  return CHAIN_UNKNOWN;
+}
+
+// Lab (hundredths, D65) -> sRGB, rounded and clamped to 0-255
+inline RGBColor labToRgb(const LabColor &lab) {
+  double fy = (lab.l / 100.0 + 16.0) / 116.0;
+  double fx = fy + lab.a / 100.0 / 500.0;
+  double fz = fy - lab.b / 100.0 / 200.0;
+  auto finv = [](double f) {
+    return f > 6.0 / 29.0 ? f * f * f : (116.0 * f - 16.0) * 27.0 / 24389.0;
+  };
+  double x = finv(fx) * 0.95047;
+  double y = finv(fy);
+  double z = finv(fz) * 1.08883;
+
+  double linear[3] = {3.2404542 * x - 1.5371385 * y - 0.4985314 * z,
+                      -0.9692660 * x + 1.8760108 * y + 0.0415560 * z,
+                      0.0556434 * x - 0.2040259 * y + 1.0572252 * z};
+  int out[3];
+  for (int i = 0; i < 3; i++) {
+    double c = linear[i];
+    c = c <= 0.0031308 ? 12.92 * c : 1.055 * pow(c, 1.0 / 2.4) - 0.055;
+    long v = lround(c * 255.0);
+    out[i] = v < 0 ? 0 : (v > 255 ? 255 : (int)v);
+  }
+  return {out[0], out[1], out[2]};
+}
+
+// The palette entry's own color, as the chain would class it
+inline ChainClass paletteClass(uint16_t id) {
+  return thresholdChain(labToRgb(ColorNaming::labFor(id)));
+}
+
+} // namespace ColorNamingReference
+
+#endif
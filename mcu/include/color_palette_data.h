@@ -0,0 +1,8704 @@
+// Generated by scripts/gen_palette.py -- do not edit.
+#ifndef COLOR_PALETTE_DATA_H
+#define COLOR_PALETTE_DATA_H
+
+#include <stdint.h>
+
+namespace PaletteData {
+
+static constexpr uint16_t SIZE = 1228;
+static constexpr int16_t LAB_SCALE = 100;
+static constexpr uint16_t NODE_COUNT = 2485;
+static constexpr uint8_t LEAF = 3;
+static constexpr uint16_t MAX_CANDIDATES = 48;
+
+// L*, a*, b* in hundredths
+static constexpr int16_t LAB[SIZE][3] = {
+    {9718, -135, -426}, // AliceBlue
+    {9373, 184, 1153}, // AntiqueWhite
+    {9203, -4552, 972}, // Aquamarine
+    {9893, -488, -169}, // Azure
+    {9595, -419, 1205}, // Beige
+    {9201, 443, 1901}, // Bisque
+    {0, 0, 0}, // Black
+    {9392, 213, 1703}, // BlanchedAlmond
+    {3230, 7919, -10786}, // Blue
+    {4219, 6984, -7476}, // BlueViolet
+    {3753, 4969, 3054}, // Brown
+    {7702, 705, 3002}, // BurlyWood
+    {6115, -1968, -742}, // CadetBlue
+    {8987, -6807, 8578}, // Chartreuse
+    {5599, 3705, 5674}, // Chocolate
+    {6730, 4535, 4749}, // Coral
+    {6193, 933, -4930}, // CornflowerBlue
+    {9746, -222, 1429}, // Cornsilk
+    {4704, 7092, 3360}, // Crimson
+    {9111, -4809, -1413}, // Cyan
+    {1475, 5042, -6868}, // DarkBlue
+    {5221, -3062, -900}, // DarkCyan
+    {5922, 986, 6273}, // DarkGoldenRod
+    {6924, 0, 0}, // DarkGray
+    {3620, -4337, 4186}, // DarkGreen
+    {7338, -879, 3929}, // DarkKhaki
+    {3260, 6255, -3873}, // DarkMagenta
+    {4223, -1883, 3060}, // DarkOliveGreen
+    {6949, 3683, 7549}, // DarkOrange
+    {4338, 6515, -6010}, // DarkOrchid
+    {2809, 5100, 4129}, // DarkRed
+    {6986, 2817, 2771}, // DarkSalmon
+    {7209, -2382, 1804}, // DarkSeaGreen
+    {3083, 2605, -4208}, // DarkSlateBlue
+    {3126, -1172, -372}, // DarkSlateGray
+    {7529, -4004, -1351}, // DarkTurquoise
+    {3958, 7632, -7037}, // DarkViolet
+    {5596, 8454, -570}, // DeepPink
+    {7255, -1766, -4254}, // DeepSkyBlue
+    {4441, 0, 0}, // DimGray
+    {5938, 996, -6339}, // DodgerBlue
+    {3912, 5592, 3765}, // FireBrick
+    {9840, -4, 538}, // FloralWhite
+    {5059, -4959, 4502}, // ForestGreen
+    {8776, 0, 0}, // Gainsboro
+    {9776, 125, -335}, // GhostWhite
+    {8693, -192, 8713}, // Gold
+    {7082, 852, 6876}, // GoldenRod
+    {5359, 0, 0}, // Gray
+    {4623, -5170, 4990}, // Green
+    {9196, -5248, 8186}, // GreenYellow
+    {9857, -756, 548}, // HoneyDew
+    {6549, 6424, -1065}, // HotPink
+    {5340, 4483, 2212}, // IndianRed
+    {2047, 5169, -5331}, // Indigo
+    {9964, -255, 716}, // Ivory
+    {9033, -901, 4498}, // Khaki
+    {9183, 371, -966}, // Lavender
+    {9607, 589, -59}, // LavenderBlush
+    {8888, -6786, 8495}, // LawnGreen
+    {9765, -543, 2223}, // LemonChiffon
+    {8381, -1089, -1148}, // LightBlue
+    {6616, 4281, 1956}, // LightCoral
+    {9787, -994, -338}, // LightCyan
+    {9737, -648, 1924}, // LightGoldenRodYellow
+    {8456, 0, 0}, // LightGray
+    {8655, -4633, 3695}, // LightGreen
+    {8105, 2796, 504}, // LightPink
+    {7471, 3148, 3455}, // LightSalmon
+    {6579, -3751, -633}, // LightSeaGreen
+    {7972, -1083, -2850}, // LightSkyBlue
+    {5592, -225, -1111}, // LightSlateGray
+    {7845, -128, -1521}, // LightSteelBlue
+    {9929, -511, 1484}, // LightYellow
+    {8773, -8618, 8318}, // Lime
+    {7261, -6713, 6144}, // LimeGreen
+    {9531, 168, 602}, // Linen
+    {6032, 9823, -6082}, // Magenta
+    {2554, 4805, 3806}, // Maroon
+    {7569, -3834, 831}, // MediumAquaMarine
+    {2497, 6718, -9150}, // MediumBlue
+    {5364, 5906, -4740}, // MediumOrchid
+    {5497, 3680, -5009}, // MediumPurple
+    {6527, -4822, 2429}, // MediumSeaGreen
+    {5216, 4107, -6540}, // MediumSlateBlue
+    {8734, -7069, 3246}, // MediumSpringGreen
+    {7688, -3736, -835}, // MediumTurquoise
+    {4477, 7099, -1517}, // MediumVioletRed
+    {1586, 3171, -4957}, // MidnightBlue
+    {9916, -416, 125}, // MintCream
+    {9266, 875, 484}, // MistyRose
+    {9172, 244, 2636}, // Moccasin
+    {9010, 451, 2827}, // NavajoWhite
+    {1297, 4750, -6470}, // Navy
+    {9678, 17, 817}, // OldLace
+    {5187, -1293, 5667}, // Olive
+    {5465, -2822, 4969}, // OliveDrab
+    {7494, 2393, 7895}, // Orange
+    {5758, 6778, 6896}, // OrangeRed
+    {6280, 5528, -3440}, // Orchid
+    {9114, -735, 3097}, // PaleGoldenRod
+    {9075, -4830, 3853}, // PaleGreen
+    {9006, -1964, -640}, // PaleTurquoise
+    {6057, 4552, 40}, // PaleVioletRed
+    {9508, 127, 1453}, // PapayaWhip
+    {8935, 809, 2102}, // PeachPuff
+    {6175, 2140, 4792}, // Peru
+    {8359, 2414, 333}, // Pink
+    {7337, 3253, -2199}, // Plum
+    {8613, -1409, -801}, // PowderBlue
+    {2978, 5893, -3649}, // Purple
+    {3290, 4288, -4715}, // RebeccaPurple
+    {5324, 8009, 6720}, // Red
+    {6361, 1701, 661}, // RosyBrown
+    {4783, 2626, -6526}, // RoyalBlue
+    {3747, 2644, 4098}, // SaddleBrown
+    {6726, 4523, 2909}, // Salmon
+    {7395, 2303, 4679}, // SandyBrown
+    {5153, -3972, 2005}, // SeaGreen
+    {9712, 216, 455}, // SeaShell
+    {4380, 2932, 3564}, // Sienna
+    {7770, 0, 0}, // Silver
+    {7921, -1484, -2128}, // SkyBlue
+    {4534, 3604, -5777}, // SlateBlue
+    {5284, -214, -1057}, // SlateGray
+    {9864, 166, 59}, // Snow
+    {8847, -7690, 4703}, // SpringGreen
+    {5247, -408, -3219}, // SteelBlue
+    {7498, 502, 2443}, // Tan
+    {4825, -2885, -848}, // Teal
+    {8008, 1322, -923}, // Thistle
+    {6221, 5785, 4642}, // Tomato
+    {8126, -4408, -403}, // Turquoise
+    {6970, 5636, -3681}, // Violet
+    {8935, 151, 2401}, // Wheat
+    {10000, 0, 0}, // White
+    {9654, 0, 0}, // WhiteSmoke
+    {9714, -2155, 9448}, // Yellow
+    {7653, -3799, 6659}, // YellowGreen
+    {632, 0, 0}, // Jet
+    {1753, 0, 0}, // Charcoal
+    {2709, 0, 0}, // Graphite
+    {3572, 0, 0}, // Slate Gray
+    {4522, 0, 0}, // Iron Gray
+    {6132, 0, 0}, // Ash Gray
+    {6998, 0, 0}, // Pewter
+    {7734, 0, 0}, // Pale Gray
+    {8491, 0, 0}, // Platinum
+    {9305, 0, 0}, // Pearl
+    {1402, 528, 201}, // Deep Ashy Red
+    {1287, 1139, 485}, // Deep Dusty Red
+    {1210, 1839, 902}, // Deep Soft Red
+    {1178, 2416, 1278}, // Deep Red
+    {1241, 2895, 1646}, // Deep Rich Red
+    {1284, 3336, 2014}, // Deep Vivid Red
+    {2704, 881, 341}, // Dark Ashy Red
+    {2526, 1907, 842}, // Dark Dusty Red
+    {2437, 2972, 1560}, // Dark Soft Red
+    {2449, 3898, 2480}, // Dark Red
+    {2594, 4544, 3333}, // Dark Rich Red
+    {2786, 5073, 4100}, // Dark Vivid Red
+    {4006, 1239, 483}, // Ashy Red
+    {3775, 2635, 1183}, // Dusty Red
+    {3671, 4105, 2222}, // Soft Red
+    {3741, 5297, 3476}, // Mid Red
+    {3960, 6166, 4728}, // Rich Red
+    {4252, 6770, 5680}, // Vivid Red
+    {5483, 1318, 505}, // Light Ashy Red
+    {5236, 2756, 1179}, // Light Dusty Red
+    {5040, 4406, 2199}, // Light Soft Red
+    {5041, 5853, 3446}, // Light Red
+    {5154, 6958, 4774}, // Light Rich Red
+    {5411, 7803, 6022}, // Light Vivid Red
+    {7044, 835, 307}, // Pale Ashy Red
+    {6846, 1673, 645}, // Pale Dusty Red
+    {6633, 2773, 1145}, // Pale Soft Red
+    {6469, 3878, 1731}, // Pale Red
+    {6366, 4878, 2355}, // Pale Rich Red
+    {6312, 5823, 3056}, // Pale Vivid Red
+    {8442, 414, 149}, // Faint Ashy Red
+    {8327, 839, 307}, // Faint Dusty Red
+    {8209, 1383, 519}, // Faint Soft Red
+    {8065, 1941, 750}, // Faint Red
+    {7956, 2470, 981}, // Faint Rich Red
+    {7856, 3004, 1229}, // Faint Vivid Red
+    {1467, 386, 294}, // Deep Ashy Scarlet
+    {1404, 862, 648}, // Deep Dusty Scarlet
+    {1385, 1394, 1138}, // Deep Soft Scarlet
+    {1382, 1874, 1552}, // Deep Scarlet
+    {1431, 2374, 1898}, // Deep Rich Scarlet
+    {1484, 2772, 2277}, // Deep Vivid Scarlet
+    {2820, 622, 507}, // Dark Ashy Scarlet
+    {2734, 1407, 1127}, // Dark Dusty Scarlet
+    {2716, 2253, 1913}, // Dark Soft Scarlet
+    {2756, 3065, 2808}, // Dark Scarlet
+    {2855, 3814, 3560}, // Dark Rich Scarlet
+    {3000, 4463, 4271}, // Dark Vivid Scarlet
+    {4169, 877, 715}, // Ashy Scarlet
+    {4087, 1881, 1607}, // Dusty Scarlet
+    {4058, 3099, 2702}, // Soft Scarlet
+    {4122, 4254, 3867}, // Scarlet
+    {4273, 5284, 4949}, // Rich Scarlet
+    {4484, 6107, 5769}, // Vivid Scarlet
+    {5665, 918, 766}, // Light Ashy Scarlet
+    {5567, 1974, 1638}, // Light Dusty Scarlet
+    {5484, 3282, 2777}, // Light Soft Scarlet
+    {5525, 4563, 4008}, // Light Scarlet
+    {5613, 5689, 5213}, // Light Rich Scarlet
+    {5789, 6736, 6282}, // Light Vivid Scarlet
+    {7172, 562, 492}, // Pale Ashy Scarlet
+    {7068, 1181, 963}, // Pale Dusty Scarlet
+    {6960, 2016, 1604}, // Pale Soft Scarlet
+    {6904, 2828, 2325}, // Pale Scarlet
+    {6866, 3625, 3017}, // Pale Rich Scarlet
+    {6875, 4371, 3768}, // Pale Vivid Scarlet
+    {8518, 257, 258}, // Faint Ashy Scarlet
+    {8451, 576, 487}, // Faint Dusty Scarlet
+    {8380, 1014, 765}, // Faint Soft Scarlet
+    {8327, 1361, 1125}, // Faint Scarlet
+    {8283, 1732, 1445}, // Faint Rich Scarlet
+    {8244, 2113, 1773}, // Faint Vivid Scarlet
+    {1532, 245, 387}, // Deep Ashy Flame
+    {1559, 513, 859}, // Deep Dusty Flame
+    {1612, 855, 1428}, // Deep Soft Flame
+    {1637, 1239, 1879}, // Deep Flame
+    {1723, 1619, 2266}, // Deep Rich Flame
+    {1800, 1935, 2669}, // Deep Vivid Flame
+    {2939, 366, 676}, // Dark Ashy Flame
+    {2983, 838, 1461}, // Dark Dusty Flame
+    {3040, 1468, 2309}, // Dark Soft Flame
+    {3151, 2063, 3215}, // Dark Flame
+    {3268, 2728, 3893}, // Dark Rich Flame
+    {3427, 3311, 4554}, // Dark Vivid Flame
+    {4335, 517, 950}, // Ashy Flame
+    {4396, 1173, 2018}, // Dusty Flame
+    {4493, 2036, 3223}, // Soft Flame
+    {4658, 2882, 4398}, // Flame
+    {4839, 3780, 5361}, // Rich Flame
+    {5054, 4557, 6048}, // Vivid Flame
+    {5850, 522, 1028}, // Light Ashy Flame
+    {5891, 1243, 2079}, // Light Dusty Flame
+    {5985, 2087, 3409}, // Light Soft Flame
+    {6135, 3038, 4691}, // Light Flame
+    {6295, 3923, 5845}, // Light Rich Flame
+    {6501, 4840, 6789}, // Light Vivid Flame
+    {7275, 346, 641}, // Pale Ashy Flame
+    {7295, 693, 1284}, // Pale Dusty Flame
+    {7324, 1206, 2106}, // Pale Soft Flame
+    {7369, 1760, 2946}, // Pale Flame
+    {7444, 2263, 3759}, // Pale Rich Flame
+    {7509, 2838, 4543}, // Pale Vivid Flame
+    {8568, 153, 332}, // Faint Ashy Flame
+    {8577, 315, 667}, // Faint Dusty Flame
+    {8577, 595, 1047}, // Faint Soft Flame
+    {8595, 784, 1504}, // Faint Flame
+    {8595, 1052, 1882}, // Faint Rich Flame
+    {8622, 1277, 2297}, // Faint Vivid Flame
+    {1599, 106, 481}, // Deep Ashy Orange
+    {1719, 167, 1074}, // Deep Dusty Orange
+    {1826, 378, 1691}, // Deep Soft Orange
+    {1928, 570, 2228}, // Deep Orange
+    {2081, 774, 2682}, // Deep Rich Orange
+    {2191, 989, 3112}, // Deep Vivid Orange
+    {3060, 112, 845}, // Dark Ashy Orange
+    {3215, 335, 1766}, // Dark Dusty Orange
+    {3395, 665, 2729}, // Dark Soft Orange
+    {3615, 981, 3674}, // Dark Orange
+    {3820, 1397, 4337}, // Dark Rich Orange
+    {4056, 1757, 4933}, // Dark Vivid Orange
+    {4504, 161, 1186}, // Ashy Orange
+    {4719, 469, 2440}, // Dusty Orange
+    {5001, 886, 3807}, // Soft Orange
+    {5275, 1432, 4987}, // Mid Orange
+    {5589, 1960, 5921}, // Rich Orange
+    {5875, 2514, 6537}, // Vivid Orange
+    {6038, 130, 1292}, // Light Ashy Orange
+    {6253, 464, 2562}, // Light Dusty Orange
+    {6527, 879, 4070}, // Light Soft Orange
+    {6833, 1427, 5440}, // Light Orange
+    {7132, 1940, 6598}, // Light Rich Orange
+    {7453, 2524, 7491}, // Light Vivid Orange
+    {7405, 77, 827}, // Pale Ashy Orange
+    {7526, 211, 1607}, // Pale Dusty Orange
+    {7699, 405, 2616}, // Pale Soft Orange
+    {7882, 646, 3616}, // Pale Orange
+    {8039, 945, 4502}, // Pale Rich Orange
+    {8228, 1220, 5390}, // Pale Vivid Orange
+    {8619, 48, 405}, // Faint Ashy Orange
+    {8703, 55, 848}, // Faint Dusty Orange
+    {8776, 179, 1331}, // Faint Soft Orange
+    {8867, 215, 1886}, // Faint Orange
+    {8938, 328, 2357}, // Faint Rich Orange
+    {1699, -101, 622}, // Deep Ashy Amber
+    {1851, -104, 1248}, // Deep Dusty Amber
+    {2051, -90, 1958}, // Deep Soft Amber
+    {2242, -91, 2573}, // Deep Amber
+    {2446, -9, 3062}, // Deep Rich Amber
+    {2637, 22, 3552}, // Deep Vivid Amber
+    {3183, -138, 1016}, // Dark Ashy Amber
+    {3454, -158, 2073}, // Dark Dusty Amber
+    {3802, -185, 3190}, // Dark Soft Amber
+    {4123, -97, 4156}, // Dark Amber
+    {4447, 38, 4842}, // Dark Rich Amber
+    {4770, 186, 5414}, // Dark Vivid Amber
+    {4676, -189, 1424}, // Ashy Amber
+    {5054, -222, 2865}, // Dusty Amber
+    {5514, -190, 4376}, // Soft Amber
+    {5980, -75, 5637}, // Amber
+    {6448, 92, 6577}, // Rich Amber
+    {6878, 293, 7209}, // Vivid Amber
+    {6228, -257, 1557}, // Light Ashy Amber
+    {6625, -300, 3049}, // Light Dusty Amber
+    {7097, -305, 4742}, // Light Soft Amber
+    {7613, -219, 6242}, // Light Amber
+    {8062, -56, 7414}, // Light Rich Amber
+    {8547, 139, 8320}, // Light Vivid Amber
+    {7510, -136, 976}, // Pale Ashy Amber
+    {7759, -265, 1932}, // Pale Dusty Amber
+    {8084, -381, 3130}, // Pale Soft Amber
+    {8387, -393, 4259}, // Pale Amber
+    {8687, -396, 5284}, // Pale Rich Amber
+    {8964, -318, 6227}, // Pale Vivid Amber
+    {8695, -107, 516}, // Faint Ashy Amber
+    {8829, -203, 1029}, // Faint Dusty Amber
+    {8978, -232, 1615}, // Faint Soft Amber
+    {9118, -297, 2234}, // Faint Amber
+    {9287, -385, 2834}, // Faint Rich Amber
+    {9432, -411, 3394}, // Faint Vivid Amber
+    {1768, -236, 717}, // Deep Ashy Yellow
+    {2020, -434, 1464}, // Deep Dusty Yellow
+    {2316, -605, 2262}, // Deep Soft Yellow
+    {2569, -722, 2902}, // Deep Yellow
+    {2864, -817, 3439}, // Deep Rich Yellow
+    {3113, -898, 3935}, // Deep Vivid Yellow
+    {3307, -385, 1186}, // Dark Ashy Yellow
+    {3730, -696, 2418}, // Dark Dusty Yellow
+    {4193, -941, 3619}, // Dark Soft Yellow
+    {4654, -1123, 4647}, // Dark Yellow
+    {5113, -1254, 5377}, // Dark Rich Yellow
+    {5567, -1365, 5985}, // Dark Vivid Yellow
+    {4850, -534, 1661}, // Ashy Yellow
+    {5426, -946, 3325}, // Dusty Yellow
+    {6076, -1275, 4974}, // Soft Yellow
+    {6723, -1510, 6302}, // Mid Yellow
+    {7364, -1686, 7287}, // Rich Yellow
+    {7963, -1822, 7985}, // Vivid Yellow
+    {6393, -584, 1785}, // Light Ashy Yellow
+    {7005, -1043, 3536}, // Light Dusty Yellow
+    {7685, -1444, 5413}, // Light Soft Yellow
+    {8401, -1741, 7022}, // Light Yellow
+    {9045, -1956, 8258}, // Light Rich Yellow
+    {9717, -2131, 9221}, // Light Vivid Yellow
+    {7641, -401, 1163}, // Pale Ashy Yellow
+    {7995, -734, 2257}, // Pale Dusty Yellow
+    {8448, -1097, 3609}, // Pale Soft Yellow
+    {8904, -1400, 4902}, // Pale Yellow
+    {9329, -1639, 6035}, // Pale Rich Yellow
+    {9753, -1844, 7090}, // Pale Vivid Yellow
+    {8746, -210, 589}, // Faint Ashy Yellow
+    {8931, -408, 1175}, // Faint Dusty Yellow
+    {9181, -638, 1899}, // Faint Soft Yellow
+    {9397, -850, 2617}, // Faint Yellow
+    {9616, -1034, 3278}, // Faint Rich Yellow
+    {9835, -1204, 3928}, // Faint Vivid Yellow
+    {1748, -333, 686}, // Deep Ashy Lemon
+    {1971, -683, 1393}, // Deep Dusty Lemon
+    {2241, -1010, 2157}, // Deep Soft Lemon
+    {2477, -1231, 2780}, // Deep Lemon
+    {2748, -1472, 3293}, // Deep Rich Lemon
+    {2982, -1648, 3779}, // Deep Vivid Lemon
+    {3271, -562, 1131}, // Dark Ashy Lemon
+    {3651, -1108, 2303}, // Dark Dusty Lemon
+    {4082, -1544, 3466}, // Dark Soft Lemon
+    {4506, -1955, 4456}, // Dark Lemon
+    {4929, -2302, 5151}, // Dark Rich Lemon
+    {5348, -2622, 5725}, // Dark Vivid Lemon
+    {4799, -784, 1584}, // Ashy Lemon
+    {5319, -1504, 3171}, // Dusty Lemon
+    {5917, -2142, 4759}, // Soft Lemon
+    {6516, -2672, 6039}, // Lemon
+    {7111, -3128, 6980}, // Rich Lemon
+    {7666, -3532, 7633}, // Vivid Lemon
+    {6344, -819, 1711}, // Light Ashy Lemon
+    {6895, -1607, 3374}, // Light Dusty Lemon
+    {7518, -2344, 5179}, // Light Soft Lemon
+    {8180, -2968, 6730}, // Light Lemon
+    {8772, -3497, 7915}, // Light Rich Lemon
+    {9395, -3972, 8830}, // Light Vivid Lemon
+    {7603, -583, 1103}, // Pale Ashy Lemon
+    {7926, -1071, 2151}, // Pale Dusty Lemon
+    {8343, -1632, 3451}, // Pale Soft Lemon
+    {8756, -2177, 4686}, // Pale Lemon
+    {9146, -2616, 5776}, // Pale Rich Lemon
+    {9530, -3058, 6783}, // Pale Vivid Lemon
+    {8731, -280, 565}, // Faint Ashy Lemon
+    {8901, -549, 1128}, // Faint Dusty Lemon
+    {9121, -923, 1807}, // Faint Soft Lemon
+    {9316, -1248, 2493}, // Faint Lemon
+    {9520, -1509, 3132}, // Faint Rich Lemon
+    {9718, -1794, 3752}, // Faint Vivid Lemon
+    {1719, -475, 642}, // Deep Ashy Pear
+    {1936, -877, 1340}, // Deep Dusty Pear
+    {2183, -1350, 2075}, // Deep Soft Pear
+    {2399, -1711, 2677}, // Deep Pear
+    {2660, -2034, 3181}, // Deep Rich Pear
+    {2877, -2336, 3653}, // Deep Vivid Pear
+    {3236, -736, 1078}, // Dark Ashy Pear
+    {3587, -1463, 2209}, // Dark Dusty Pear
+    {3979, -2162, 3324}, // Dark Soft Pear
+    {4382, -2734, 4296}, // Dark Pear
+    {4782, -3265, 4969}, // Dark Rich Pear
+    {5185, -3716, 5529}, // Dark Vivid Pear
+    {4751, -1029, 1510}, // Ashy Pear
+    {5231, -2003, 3041}, // Dusty Pear
+    {5788, -2925, 4582}, // Soft Pear
+    {6346, -3756, 5821}, // Pear
+    {6911, -4448, 6735}, // Rich Pear
+    {7440, -5065, 7360}, // Vivid Pear
+    {6291, -1088, 1628}, // Light Ashy Pear
+    {6795, -2155, 3226}, // Light Dusty Pear
+    {7372, -3206, 4973}, // Light Soft Pear
+    {7988, -4162, 6474}, // Light Pear
+    {8549, -4927, 7634}, // Light Rich Pear
+    {9141, -5652, 8519}, // Light Vivid Pear
+    {7572, -728, 1056}, // Pale Ashy Pear
+    {7860, -1403, 2050}, // Pale Dusty Pear
+    {8237, -2194, 3293}, // Pale Soft Pear
+    {8621, -2929, 4489}, // Pale Pear
+    {8977, -3593, 5536}, // Pale Rich Pear
+    {9343, -4179, 6525}, // Pale Vivid Pear
+    {8709, -383, 530}, // Faint Ashy Pear
+    {8864, -723, 1070}, // Faint Dusty Pear
+    {9064, -1205, 1718}, // Faint Soft Pear
+    {9245, -1605, 2384}, // Faint Pear
+    {9423, -2012, 2985}, // Faint Rich Pear
+    {9602, -2408, 3578}, // Faint Vivid Pear
+    {1701, -569, 614}, // Deep Ashy Lime
+    {1895, -1111, 1279}, // Deep Dusty Lime
+    {2133, -1667, 2005}, // Deep Soft Lime
+    {2336, -2142, 2592}, // Deep Lime
+    {2587, -2561, 3087}, // Deep Rich Lime
+    {2801, -2909, 3559}, // Deep Vivid Lime
+    {3204, -908, 1027}, // Dark Ashy Lime
+    {3530, -1803, 2125}, // Dark Dusty Lime
+    {3899, -2689, 3212}, // Dark Soft Lime
+    {4285, -3421, 4169}, // Dark Lime
+    {4673, -4071, 4833}, // Dark Rich Lime
+    {5067, -4623, 5386}, // Dark Vivid Lime
+    {4706, -1269, 1440}, // Ashy Lime
+    {5151, -2478, 2925}, // Dusty Lime
+    {5675, -3679, 4426}, // Soft Lime
+    {6219, -4666, 5656}, // Mid Lime
+    {6766, -5539, 6555}, // Rich Lime
+    {7288, -6243, 7176}, // Vivid Lime
+    {6239, -1353, 1549}, // Light Ashy Lime
+    {6704, -2682, 3091}, // Light Dusty Lime
+    {7246, -4009, 4796}, // Light Soft Lime
+    {7838, -5197, 6273}, // Light Lime
+    {8379, -6159, 7417}, // Light Rich Lime
+    {8957, -7036, 8292}, // Light Vivid Lime
+    {7536, -907, 998}, // Pale Ashy Lime
+    {7798, -1728, 1954}, // Pale Dusty Lime
+    {8141, -2736, 3147}, // Pale Soft Lime
+    {8496, -3681, 4304}, // Pale Lime
+    {8837, -4473, 5336}, // Pale Rich Lime
+    {9180, -5245, 6299}, // Pale Vivid Lime
+    {8694, -452, 507}, // Faint Ashy Lime
+    {8828, -896, 1014}, // Faint Dusty Lime
+    {9008, -1484, 1632}, // Faint Soft Lime
+    {9171, -1990, 2271}, // Faint Lime
+    {9332, -2502, 2846}, // Faint Rich Lime
+    {9502, -2968, 3426}, // Faint Vivid Lime
+    {1684, -660, 588}, // Deep Ashy Leaf
+    {1859, -1332, 1225}, // Deep Dusty Leaf
+    {2086, -1992, 1938}, // Deep Soft Leaf
+    {2288, -2503, 2527}, // Deep Leaf
+    {2536, -2965, 3022}, // Deep Rich Leaf
+    {2749, -3338, 3494}, // Deep Vivid Leaf
+    {3173, -1075, 980}, // Dark Ashy Leaf
+    {3473, -2160, 2042}, // Dark Dusty Leaf
+    {3834, -3151, 3122}, // Dark Soft Leaf
+    {4214, -3975, 4075}, // Dark Leaf
+    {4605, -4634, 4747}, // Dark Rich Leaf
+    {5000, -5192, 5305}, // Dark Vivid Leaf
+    {4663, -1504, 1375}, // Ashy Leaf
+    {5082, -2922, 2823}, // Dusty Leaf
+    {5589, -4299, 4307}, // Soft Leaf
+    {6124, -5413, 5533}, // Leaf
+    {6674, -6306, 6440}, // Rich Leaf
+    {7200, -6997, 7069}, // Vivid Leaf
+    {6190, -1613, 1474}, // Light Ashy Leaf
+    {6628, -3145, 2978}, // Light Dusty Leaf
+    {7143, -4727, 4648}, // Light Soft Leaf
+    {7724, -6058, 6120}, // Light Leaf
+    {8262, -7101, 7266}, // Light Rich Leaf
+    {8841, -7997, 8149}, // Light Vivid Leaf
+    {7507, -1049, 954}, // Pale Ashy Leaf
+    {7738, -2046, 1863}, // Pale Dusty Leaf
+    {8053, -3255, 3015}, // Pale Soft Leaf
+    {8391, -4348, 4150}, // Pale Leaf
+    {8715, -5302, 5161}, // Pale Rich Leaf
+    {9053, -6150, 6121}, // Pale Vivid Leaf
+    {8679, -520, 484}, // Faint Ashy Leaf
+    {8793, -1068, 959}, // Faint Dusty Leaf
+    {8955, -1757, 1550}, // Faint Soft Leaf
+    {9101, -2366, 2163}, // Faint Leaf
+    {9253, -2944, 2726}, // Faint Rich Leaf
+    {9409, -3506, 3286}, // Faint Vivid Leaf
+    {1667, -750, 562}, // Deep Ashy Green
+    {1834, -1496, 1187}, // Deep Dusty Green
+    {2054, -2233, 1891}, // Deep Soft Green
+    {2255, -2774, 2482}, // Deep Green
+    {2508, -3210, 2985}, // Deep Rich Green
+    {2721, -3590, 3459}, // Deep Vivid Green
+    {3143, -1237, 935}, // Dark Ashy Green
+    {3430, -2450, 1977}, // Dark Dusty Green
+    {3785, -3530, 3053}, // Dark Soft Green
+    {4165, -4378, 4012}, // Dark Green
+    {4567, -4967, 4699}, // Dark Rich Green
+    {4971, -5459, 5269}, // Dark Vivid Green
+    {4623, -1730, 1313}, // Ashy Green
+    {5018, -3357, 2729}, // Dusty Green
+    {5522, -4822, 4214}, // Soft Green
+    {6065, -5910, 5456}, // Mid Green
+    {6629, -6702, 6385}, // Rich Green
+    {7168, -7284, 7031}, // Vivid Green
+    {6144, -1865, 1402}, // Light Ashy Green
+    {6556, -3609, 2870}, // Light Dusty Green
+    {7060, -5337, 4531}, // Light Soft Green
+    {7644, -6702, 6013}, // Light Green
+    {8193, -7695, 7177}, // Light Rich Green
+    {8788, -8475, 8082}, // Light Vivid Green
+    {7472, -1225, 899}, // Pale Ashy Green
+    {7682, -2356, 1777}, // Pale Dusty Green
+    {7979, -3713, 2903}, // Pale Soft Green
+    {8301, -4955, 4018}, // Pale Green
+    {8620, -5993, 5023}, // Pale Rich Green
+    {8953, -6917, 5981}, // Pale Vivid Green
+    {8658, -622, 450}, // Faint Ashy Green
+    {8759, -1238, 905}, // Faint Dusty Green
+    {8910, -1993, 1480}, // Faint Soft Green
+    {9035, -2731, 2061}, // Faint Green
+    {9174, -3401, 2606}, // Faint Rich Green
+    {9320, -4049, 3150}, // Faint Vivid Green
+    {1673, -703, 431}, // Deep Ashy Clover
+    {1842, -1412, 933}, // Deep Dusty Clover
+    {2065, -2111, 1479}, // Deep Soft Clover
+    {2266, -2639, 1964}, // Deep Clover
+    {2517, -3089, 2467}, // Deep Rich Clover
+    {2731, -3466, 2877}, // Deep Vivid Clover
+    {3153, -1153, 696}, // Dark Ashy Clover
+    {3445, -2302, 1520}, // Dark Dusty Clover
+    {3802, -3339, 2380}, // Dark Soft Clover
+    {4182, -4177, 3199}, // Dark Clover
+    {4580, -4803, 3956}, // Dark Rich Clover
+    {4981, -5328, 4625}, // Dark Vivid Clover
+    {4636, -1613, 979}, // Ashy Clover
+    {5040, -3135, 2037}, // Dusty Clover
+    {5545, -4559, 3269}, // Soft Clover
+    {6085, -5663, 4430}, // Clover
+    {6644, -6507, 5476}, // Rich Clover
+    {7179, -7144, 6326}, // Vivid Clover
+    {6160, -1734, 1033}, // Light Ashy Clover
+    {6581, -3372, 2153}, // Light Dusty Clover
+    {7089, -5029, 3489}, // Light Soft Clover
+    {7671, -6380, 4777}, // Light Clover
+    {8216, -7401, 5913}, // Light Rich Clover
+    {8806, -8240, 6980}, // Light Vivid Clover
+    {7484, -1133, 645}, // Pale Ashy Clover
+    {7701, -2195, 1323}, // Pale Dusty Clover
+    {8004, -3478, 2209}, // Pale Soft Clover
+    {8332, -4646, 3055}, // Pale Clover
+    {8652, -5643, 3868}, // Pale Rich Clover
+    {8988, -6531, 4624}, // Pale Vivid Clover
+    {8665, -568, 302}, // Faint Ashy Clover
+    {8770, -1148, 660}, // Faint Dusty Clover
+    {8926, -1870, 1138}, // Faint Soft Clover
+    {9057, -2542, 1525}, // Faint Clover
+    {9201, -3165, 1927}, // Faint Rich Clover
+    {9350, -3770, 2333}, // Faint Vivid Clover
+    {1679, -655, 300}, // Deep Ashy Emerald
+    {1855, -1295, 612}, // Deep Dusty Emerald
+    {2081, -1939, 985}, // Deep Soft Emerald
+    {2283, -2448, 1378}, // Deep Emerald
+    {2535, -2878, 1760}, // Deep Rich Emerald
+    {2748, -3243, 2080}, // Deep Vivid Emerald
+    {3164, -1064, 458}, // Dark Ashy Emerald
+    {3464, -2112, 997}, // Dark Dusty Emerald
+    {3824, -3095, 1660}, // Dark Soft Emerald
+    {4207, -3886, 2269}, // Dark Emerald
+    {4603, -4512, 2927}, // Dark Rich Emerald
+    {5004, -5038, 3506}, // Dark Vivid Emerald
+    {4651, -1488, 644}, // Ashy Emerald
+    {5064, -2898, 1387}, // Dusty Emerald
+    {5575, -4230, 2293}, // Soft Emerald
+    {6118, -5272, 3151}, // Emerald
+    {6676, -6112, 4040}, // Rich Emerald
+    {7209, -6760, 4809}, // Vivid Emerald
+    {6177, -1596, 663}, // Light Ashy Emerald
+    {6607, -3125, 1481}, // Light Dusty Emerald
+    {7124, -4647, 2394}, // Light Soft Emerald
+    {7711, -5926, 3369}, // Light Emerald
+    {8257, -6909, 4257}, // Light Rich Emerald
+    {8846, -7745, 5165}, // Light Vivid Emerald
+    {7494, -1057, 442}, // Pale Ashy Emerald
+    {7722, -2026, 869}, // Pale Dusty Emerald
+    {8034, -3202, 1461}, // Pale Soft Emerald
+    {8368, -4290, 2075}, // Pale Emerald
+    {8695, -5202, 2618}, // Pale Rich Emerald
+    {9031, -6050, 3217}, // Pale Vivid Emerald
+    {8670, -532, 204}, // Faint Ashy Emerald
+    {8782, -1057, 414}, // Faint Dusty Emerald
+    {8944, -1725, 746}, // Faint Soft Emerald
+    {9081, -2341, 989}, // Faint Emerald
+    {9228, -2929, 1297}, // Faint Rich Emerald
+    {9382, -3483, 1561}, // Faint Vivid Emerald
+    {1685, -604, 169}, // Deep Ashy Jade
+    {1869, -1165, 290}, // Deep Dusty Jade
+    {2099, -1760, 544}, // Deep Soft Jade
+    {2305, -2205, 763}, // Deep Jade
+    {2561, -2582, 984}, // Deep Rich Jade
+    {2775, -2923, 1210}, // Deep Vivid Jade
+    {3175, -970, 220}, // Dark Ashy Jade
+    {3485, -1922, 529}, // Dark Dusty Jade
+    {3852, -2798, 919}, // Dark Soft Jade
+    {4241, -3499, 1275}, // Dark Jade
+    {4642, -4064, 1703}, // Dark Rich Jade
+    {5045, -4539, 2073}, // Dark Vivid Jade
+    {4667, -1357, 311}, // Ashy Jade
+    {5092, -2633, 732}, // Dusty Jade
+    {5615, -3805, 1232}, // Soft Jade
+    {6163, -4761, 1819}, // Jade
+    {6727, -5508, 2366}, // Rich Jade
+    {7262, -6118, 2920}, // Vivid Jade
+    {6194, -1451, 295}, // Light Ashy Jade
+    {6639, -2833, 755}, // Light Dusty Jade
+    {7169, -4195, 1277}, // Light Soft Jade
+    {7764, -5344, 1888}, // Light Jade
+    {8316, -6220, 2435}, // Light Rich Jade
+    {8910, -6980, 3033}, // Light Vivid Jade
+    {7506, -960, 189}, // Pale Ashy Jade
+    {7744, -1848, 416}, // Pale Dusty Jade
+    {8068, -2901, 713}, // Pale Soft Jade
+    {8412, -3870, 1039}, // Pale Jade
+    {8744, -4708, 1399}, // Pale Rich Jade
+    {9089, -5449, 1724}, // Pale Vivid Jade
+    {8675, -495, 106}, // Faint Ashy Jade
+    {8795, -964, 170}, // Faint Dusty Jade
+    {8963, -1574, 356}, // Faint Soft Jade
+    {9107, -2131, 454}, // Faint Jade
+    {9260, -2660, 618}, // Faint Rich Jade
+    {9417, -3173, 789}, // Faint Vivid Jade
+    {1695, -525, -26}, // Deep Ashy Mint
+    {1882, -1052, 33}, // Deep Dusty Mint
+    {2119, -1558, 103}, // Deep Soft Mint
+    {2333, -1914, 141}, // Deep Mint
+    {2592, -2241, 251}, // Deep Rich Mint
+    {2813, -2504, 308}, // Deep Vivid Mint
+    {3187, -872, -18}, // Dark Ashy Mint
+    {3507, -1715, 63}, // Dark Dusty Mint
+    {3890, -2427, 119}, // Dark Soft Mint
+    {4285, -3025, 264}, // Dark Mint
+    {4695, -3481, 436}, // Dark Rich Mint
+    {5104, -3881, 613}, // Dark Vivid Mint
+    {4684, -1218, -21}, // Ashy Mint
+    {5123, -2340, 79}, // Dusty Mint
+    {5661, -3333, 219}, // Soft Mint
+    {6224, -4103, 408}, // Mint
+    {6799, -4710, 625}, // Rich Mint
+    {7343, -5200, 860}, // Vivid Mint
+    {6213, -1300, -72}, // Light Ashy Mint
+    {6675, -2514, 32}, // Light Dusty Mint
+    {7221, -3679, 159}, // Light Soft Mint
+    {7833, -4620, 341}, // Light Mint
+    {8397, -5352, 569}, // Light Rich Mint
+    {9002, -5965, 812}, // Light Vivid Mint
+    {7517, -881, -13}, // Pale Ashy Mint
+    {7767, -1662, -35}, // Pale Dusty Mint
+    {8105, -2578, -31}, // Pale Soft Mint
+    {8460, -3428, 55}, // Pale Mint
+    {8804, -4126, 131}, // Pale Rich Mint
+    {9156, -4775, 274}, // Pale Vivid Mint
+    {8683, -439, -41}, // Faint Ashy Mint
+    {8808, -868, -75}, // Faint Dusty Mint
+    {8983, -1418, -33}, // Faint Soft Mint
+    {9132, -1931, -30}, // Faint Mint
+    {9294, -2375, -57}, // Faint Rich Mint
+    {9458, -2821, -29}, // Faint Vivid Mint
+    {1702, -469, -156}, // Deep Ashy Aqua
+    {1899, -901, -285}, // Deep Dusty Aqua
+    {2147, -1301, -397}, // Deep Soft Aqua
+    {2367, -1583, -474}, // Deep Aqua
+    {2635, -1809, -536}, // Deep Rich Aqua
+    {2862, -2003, -589}, // Deep Vivid Aqua
+    {3200, -770, -254}, // Dark Ashy Aqua
+    {3536, -1462, -458}, // Dark Dusty Aqua
+    {3930, -2039, -618}, // Dark Soft Aqua
+    {4340, -2478, -737}, // Dark Aqua
+    {4763, -2785, -822}, // Dark Rich Aqua
+    {5185, -3046, -895}, // Dark Vivid Aqua
+    {4702, -1074, -352}, // Ashy Aqua
+    {5162, -1995, -622}, // Dusty Aqua
+    {5719, -2773, -837}, // Soft Aqua
+    {6301, -3337, -991}, // Aqua
+    {6893, -3752, -1106}, // Rich Aqua
+    {7453, -4064, -1194}, // Vivid Aqua
+    {6230, -1166, -386}, // Light Ashy Aqua
+    {6714, -2172, -686}, // Light Dusty Aqua
+    {7282, -3106, -948}, // Light Soft Aqua
+    {7915, -3819, -1143}, // Light Aqua
+    {8498, -4332, -1283}, // Light Rich Aqua
+    {9121, -4743, -1397}, // Light Vivid Aqua
+    {7530, -780, -265}, // Pale Ashy Aqua
+    {7791, -1469, -484}, // Pale Dusty Aqua
+    {8143, -2257, -722}, // Pale Soft Aqua
+    {8514, -2949, -921}, // Pale Aqua
+    {8871, -3508, -1077}, // Pale Rich Aqua
+    {9238, -3995, -1211}, // Pale Vivid Aqua
+    {8688, -402, -139}, // Faint Ashy Aqua
+    {8818, -791, -270}, // Faint Dusty Aqua
+    {9004, -1257, -421}, // Faint Soft Aqua
+    {9161, -1702, -561}, // Faint Aqua
+    {9328, -2096, -681}, // Faint Rich Aqua
+    {9500, -2470, -793}, // Faint Vivid Aqua
+    {1631, -334, -261}, // Deep Ashy Cerulean
+    {1718, -576, -556}, // Deep Dusty Cerulean
+    {1854, -803, -838}, // Deep Soft Cerulean
+    {2001, -983, -1028}, // Deep Cerulean
+    {2163, -1047, -1253}, // Deep Rich Cerulean
+    {2320, -1143, -1412}, // Deep Vivid Cerulean
+    {3070, -525, -446}, // Dark Ashy Cerulean
+    {3237, -934, -905}, // Dark Dusty Cerulean
+    {3496, -1314, -1272}, // Dark Soft Cerulean
+    {3741, -1508, -1645}, // Dark Cerulean
+    {4005, -1571, -1973}, // Dark Rich Cerulean
+    {4274, -1589, -2282}, // Dark Vivid Cerulean
+    {4519, -730, -623}, // Ashy Cerulean
+    {4758, -1287, -1228}, // Dusty Cerulean
+    {5095, -1735, -1780}, // Soft Cerulean
+    {5462, -1982, -2261}, // Cerulean
+    {5850, -2082, -2691}, // Rich Cerulean
+    {6213, -2076, -3084}, // Vivid Cerulean
+    {6058, -839, -640}, // Light Ashy Cerulean
+    {6305, -1440, -1297}, // Light Dusty Cerulean
+    {6633, -2008, -1925}, // Light Soft Cerulean
+    {7031, -2374, -2479}, // Light Cerulean
+    {7386, -2543, -2970}, // Light Rich Cerulean
+    {7790, -2611, -3422}, // Light Vivid Cerulean
+    {7395, -515, -464}, // Pale Ashy Cerulean
+    {7544, -1001, -850}, // Pale Dusty Cerulean
+    {7754, -1550, -1302}, // Pale Soft Cerulean
+    {7952, -1964, -1762}, // Pale Cerulean
+    {8166, -2305, -2136}, // Pale Rich Cerulean
+    {8363, -2532, -2530}, // Pale Vivid Cerulean
+    {8636, -298, -215}, // Faint Ashy Cerulean
+    {8714, -585, -423}, // Faint Dusty Cerulean
+    {8794, -851, -731}, // Faint Soft Cerulean
+    {8869, -1149, -993}, // Faint Cerulean
+    {8981, -1451, -1197}, // Faint Rich Cerulean
+    {9070, -1685, -1433}, // Faint Vivid Cerulean
+    {1526, -127, -418}, // Deep Ashy Sky
+    {1574, -304, -773}, // Deep Dusty Sky
+    {1600, -333, -1228}, // Deep Soft Sky
+    {1637, -317, -1591}, // Deep Sky
+    {1729, -251, -1928}, // Deep Rich Sky
+    {1781, -150, -2256}, // Deep Vivid Sky
+    {2941, -273, -638}, // Dark Ashy Sky
+    {2974, -440, -1305}, // Dark Dusty Sky
+    {3032, -461, -1987}, // Dark Soft Sky
+    {3145, -420, -2570}, // Dark Sky
+    {3253, -175, -3150}, // Dark Rich Sky
+    {3403, 52, -3652}, // Dark Vivid Sky
+    {4338, -378, -894}, // Ashy Sky
+    {4388, -594, -1790}, // Dusty Sky
+    {4505, -656, -2689}, // Soft Sky
+    {4629, -453, -3558}, // Sky
+    {4813, -154, -4314}, // Rich Sky
+    {4983, 261, -5020}, // Vivid Sky
+    {5859, -451, -936}, // Light Ashy Sky
+    {5900, -674, -1911}, // Light Dusty Sky
+    {5989, -822, -2913}, // Light Soft Sky
+    {6124, -715, -3884}, // Light Sky
+    {6280, -512, -4693}, // Light Rich Sky
+    {6467, -145, -5494}, // Light Vivid Sky
+    {7288, -301, -622}, // Pale Ashy Sky
+    {7299, -523, -1215}, // Pale Dusty Sky
+    {7340, -762, -1926}, // Pale Soft Sky
+    {7396, -923, -2608}, // Pale Sky
+    {7439, -962, -3249}, // Pale Rich Sky
+    {7522, -989, -3824}, // Pale Vivid Sky
+    {8559, -143, -328}, // Faint Ashy Sky
+    {8584, -327, -614}, // Faint Dusty Sky
+    {8585, -438, -1041}, // Faint Soft Sky
+    {8606, -636, -1386}, // Faint Sky
+    {8610, -736, -1753}, // Faint Rich Sky
+    {8618, -820, -2114}, // Faint Vivid Sky
+    {1456, 14, -522}, // Deep Ashy Cobalt
+    {1397, 49, -1044}, // Deep Dusty Cobalt
+    {1351, 169, -1617}, // Deep Soft Cobalt
+    {1281, 414, -2153}, // Deep Cobalt
+    {1274, 713, -2655}, // Deep Rich Cobalt
+    {1262, 977, -3090}, // Deep Vivid Cobalt
+    {2814, -17, -831}, // Dark Ashy Cobalt
+    {2715, 78, -1704}, // Dark Dusty Cobalt
+    {2610, 398, -2649}, // Dark Soft Cobalt
+    {2565, 790, -3492}, // Dark Cobalt
+    {2529, 1399, -4310}, // Dark Rich Cobalt
+    {2546, 1984, -5034}, // Dark Vivid Cobalt
+    {4159, -18, -1164}, // Ashy Cobalt
+    {4024, 134, -2351}, // Dusty Cobalt
+    {3898, 581, -3644}, // Soft Cobalt
+    {3849, 1188, -4800}, // Cobalt
+    {3820, 2027, -5910}, // Rich Cobalt
+    {3854, 2843, -6846}, // Vivid Cobalt
+    {5662, -55, -1232}, // Light Ashy Cobalt
+    {5500, 126, -2523}, // Light Dusty Cobalt
+    {5357, 452, -3900}, // Light Soft Cobalt
+    {5267, 1055, -5239}, // Light Cobalt
+    {5209, 1766, -6402}, // Light Rich Cobalt
+    {5202, 2646, -7529}, // Light Vivid Cobalt
+    {7154, -31, -820}, // Pale Ashy Cobalt
+    {7056, -35, -1580}, // Pale Dusty Cobalt
+    {6931, 55, -2548}, // Pale Soft Cobalt
+    {6820, 228, -3495}, // Pale Cobalt
+    {6752, 418, -4318}, // Pale Rich Cobalt
+    {6670, 736, -5160}, // Pale Vivid Cobalt
+    {8508, -38, -403}, // Faint Ashy Cobalt
+    {8455, -66, -805}, // Faint Dusty Cobalt
+    {8378, -20, -1351}, // Faint Soft Cobalt
+    {8319, -60, -1817}, // Faint Cobalt
+    {8243, -1, -2307}, // Faint Rich Cobalt
+    {8197, 22, -2754}, // Faint Vivid Cobalt
+    {1387, 157, -627}, // Deep Ashy Sapphire
+    {1224, 417, -1313}, // Deep Dusty Sapphire
+    {1076, 776, -2052}, // Deep Soft Sapphire
+    {946, 1193, -2692}, // Deep Sapphire
+    {859, 1730, -3329}, // Deep Rich Sapphire
+    {780, 2214, -3880}, // Deep Vivid Sapphire
+    {2687, 244, -1022}, // Dark Ashy Sapphire
+    {2430, 686, -2147}, // Dark Dusty Sapphire
+    {2205, 1307, -3294}, // Dark Soft Sapphire
+    {2025, 2075, -4365}, // Dark Sapphire
+    {1917, 2954, -5312}, // Dark Rich Sapphire
+    {1865, 3802, -6156}, // Dark Vivid Sapphire
+    {3981, 349, -1433}, // Ashy Sapphire
+    {3669, 893, -2906}, // Dusty Sapphire
+    {3347, 1828, -4524}, // Soft Sapphire
+    {3103, 2991, -6010}, // Sapphire
+    {2960, 4247, -7321}, // Rich Sapphire
+    {2927, 5351, -8374}, // Vivid Sapphire
+    {5467, 348, -1527}, // Light Ashy Sapphire
+    {5137, 895, -3087}, // Light Dusty Sapphire
+    {4748, 1798, -4866}, // Light Soft Sapphire
+    {4461, 2936, -6538}, // Light Sapphire
+    {4237, 4161, -7986}, // Light Rich Sapphire
+    {4113, 5470, -9315}, // Light Vivid Sapphire
+    {7048, 187, -979}, // Pale Ashy Sapphire
+    {6816, 461, -1943}, // Pale Dusty Sapphire
+    {6530, 897, -3166}, // Pale Soft Sapphire
+    {6286, 1371, -4329}, // Pale Sapphire
+    {6061, 1930, -5409}, // Pale Rich Sapphire
+    {5880, 2508, -6418}, // Pale Vivid Sapphire
+    {8457, 66, -479}, // Faint Ashy Sapphire
+    {8327, 197, -995}, // Faint Dusty Sapphire
+    {8172, 404, -1660}, // Faint Soft Sapphire
+    {8035, 526, -2246}, // Faint Sapphire
+    {7908, 697, -2820}, // Faint Rich Sapphire
+    {7783, 887, -3390}, // Faint Vivid Sapphire
+    {1319, 302, -730}, // Deep Ashy Marine
+    {1090, 718, -1523}, // Deep Dusty Marine
+    {852, 1318, -2413}, // Deep Soft Marine
+    {661, 1917, -3156}, // Deep Marine
+    {577, 2476, -3793}, // Deep Rich Marine
+    {471, 3042, -4390}, // Deep Vivid Marine
+    {2563, 510, -1212}, // Dark Ashy Marine
+    {2187, 1241, -2531}, // Dark Dusty Marine
+    {1835, 2226, -3894}, // Dark Soft Marine
+    {1554, 3346, -5141}, // Dark Marine
+    {1466, 4244, -6059}, // Dark Rich Marine
+    {1459, 5016, -6832}, // Dark Vivid Marine
+    {3807, 723, -1700}, // Ashy Marine
+    {3300, 1738, -3490}, // Dusty Marine
+    {2821, 3148, -5377}, // Soft Marine
+    {2502, 4636, -7000}, // Marine
+    {2402, 5870, -8247}, // Rich Marine
+    {2482, 6693, -9117}, // Vivid Marine
+    {5274, 757, -1820}, // Light Ashy Marine
+    {4758, 1744, -3681}, // Light Dusty Marine
+    {4179, 3173, -5780}, // Light Soft Marine
+    {3759, 4771, -7685}, // Light Marine
+    {3486, 6253, -9225}, // Light Rich Marine
+    {3435, 7452, -10442}, // Light Vivid Marine
+    {6916, 462, -1176}, // Pale Ashy Marine
+    {6580, 966, -2304}, // Pale Dusty Marine
+    {6166, 1702, -3734}, // Pale Soft Marine
+    {5774, 2546, -5140}, // Pale Marine
+    {5436, 3419, -6410}, // Pale Rich Marine
+    {5132, 4361, -7629}, // Pale Vivid Marine
+    {8380, 224, -592}, // Faint Ashy Marine
+    {8199, 462, -1186}, // Faint Dusty Marine
+    {7994, 780, -1928}, // Faint Soft Marine
+    {7755, 1122, -2673}, // Faint Marine
+    {7553, 1464, -3366}, // Faint Rich Marine
+    {7354, 1828, -4056}, // Faint Vivid Marine
+    {1339, 385, -697}, // Deep Ashy Indigo
+    {1131, 859, -1455}, // Deep Dusty Indigo
+    {923, 1499, -2295}, // Deep Soft Indigo
+    {749, 2116, -3010}, // Deep Indigo
+    {662, 2651, -3651}, // Deep Rich Indigo
+    {563, 3222, -4236}, // Deep Vivid Indigo
+    {2601, 659, -1151}, // Dark Ashy Indigo
+    {2263, 1482, -2407}, // Dark Dusty Indigo
+    {1953, 2494, -3696}, // Dark Soft Indigo
+    {1708, 3553, -4880}, // Dark Indigo
+    {1614, 4355, -5810}, // Dark Rich Indigo
+    {1591, 5062, -6609}, // Dark Vivid Indigo
+    {3860, 929, -1614}, // Ashy Indigo
+    {3416, 2095, -3300}, // Dusty Indigo
+    {2990, 3503, -5094}, // Soft Indigo
+    {2699, 4873, -6669}, // Mid Indigo
+    {2584, 5983, -7940}, // Rich Indigo
+    {2624, 6741, -8875}, // Vivid Indigo
+    {5333, 990, -1726}, // Light Ashy Indigo
+    {4876, 2140, -3488}, // Light Dusty Indigo
+    {4360, 3628, -5480}, // Light Soft Indigo
+    {3987, 5156, -7303}, // Light Indigo
+    {3732, 6504, -8811}, // Light Rich Indigo
+    {3655, 7583, -10069}, // Light Vivid Indigo
+    {6956, 629, -1112}, // Pale Ashy Indigo
+    {6651, 1250, -2188}, // Pale Dusty Indigo
+    {6278, 2102, -3550}, // Pale Soft Indigo
+    {5933, 3047, -4877}, // Pale Indigo
+    {5633, 3953, -6082}, // Pale Rich Indigo
+    {5372, 4903, -7229}, // Pale Vivid Indigo
+    {8403, 324, -555}, // Faint Ashy Indigo
+    {8238, 625, -1124}, // Faint Dusty Indigo
+    {8048, 1001, -1842}, // Faint Soft Indigo
+    {7840, 1458, -2536}, // Faint Indigo
+    {7661, 1875, -3189}, // Faint Rich Indigo
+    {7486, 2306, -3840}, // Faint Vivid Indigo
+    {1361, 469, -662}, // Deep Ashy Violet
+    {1189, 1044, -1361}, // Deep Dusty Violet
+    {1021, 1733, -2133}, // Deep Soft Violet
+    {874, 2330, -2800}, // Deep Violet
+    {814, 2865, -3395}, // Deep Rich Violet
+    {734, 3434, -3947}, // Deep Vivid Violet
+    {2641, 811, -1086}, // Dark Ashy Violet
+    {2359, 1771, -2248}, // Dark Dusty Violet
+    {2100, 2805, -3451}, // Dark Soft Violet
+    {1917, 3827, -4529}, // Dark Violet
+    {1854, 4551, -5405}, // Dark Rich Violet
+    {1857, 5185, -6159}, // Dark Vivid Violet
+    {3916, 1141, -1523}, // Ashy Violet
+    {3537, 2449, -3099}, // Dusty Violet
+    {3193, 3904, -4756}, // Soft Violet
+    {2989, 5221, -6182}, // Mid Violet
+    {2921, 6218, -7370}, // Rich Violet
+    {2979, 6901, -8275}, // Vivid Violet
+    {5394, 1228, -1627}, // Light Ashy Violet
+    {4997, 2526, -3290}, // Light Dusty Violet
+    {4578, 4141, -5118}, // Light Soft Violet
+    {4291, 5647, -6793}, // Light Violet
+    {4112, 6901, -8171}, // Light Rich Violet
+    {4080, 7871, -9351}, // Light Vivid Violet
+    {6988, 765, -1060}, // Pale Ashy Violet
+    {6727, 1540, -2066}, // Pale Dusty Violet
+    {6409, 2548, -3336}, // Pale Soft Violet
+    {6115, 3582, -4577}, // Pale Violet
+    {5877, 4567, -5679}, // Pale Rich Violet
+    {5659, 5512, -6749}, // Pale Vivid Violet
+    {8419, 391, -531}, // Faint Ashy Violet
+    {8277, 790, -1062}, // Faint Dusty Violet
+    {8111, 1257, -1740}, // Faint Soft Violet
+    {7930, 1801, -2391}, // Faint Violet
+    {7769, 2267, -3015}, // Faint Rich Violet
+    {7621, 2772, -3620}, // Faint Vivid Violet
+    {1383, 555, -626}, // Deep Ashy Purple
+    {1252, 1235, -1258}, // Deep Dusty Purple
+    {1119, 1952, -1969}, // Deep Soft Purple
+    {1026, 2569, -2546}, // Deep Purple
+    {1020, 3092, -3050}, // Deep Rich Purple
+    {982, 3603, -3530}, // Deep Vivid Purple
+    {2683, 966, -1018}, // Dark Ashy Purple
+    {2454, 2039, -2093}, // Dark Dusty Purple
+    {2271, 3145, -3167}, // Dark Soft Purple
+    {2175, 4158, -4097}, // Dark Purple
+    {2185, 4845, -4847}, // Dark Rich Purple
+    {2256, 5430, -5486}, // Dark Vivid Purple
+    {3976, 1357, -1427}, // Ashy Purple
+    {3672, 2817, -2878}, // Dusty Purple
+    {3445, 4368, -4337}, // Soft Purple
+    {3338, 5636, -5597}, // Mid Purple
+    {3380, 6583, -6599}, // Rich Purple
+    {3500, 7214, -7397}, // Vivid Purple
+    {5458, 1470, -1523}, // Light Ashy Purple
+    {5139, 2956, -3057}, // Light Dusty Purple
+    {4828, 4691, -4703}, // Light Soft Purple
+    {4659, 6212, -6179}, // Light Purple
+    {4597, 7418, -7358}, // Light Rich Purple
+    {4664, 8326, -8369}, // Light Vivid Purple
+    {7030, 936, -994}, // Pale Ashy Purple
+    {6807, 1836, -1938}, // Pale Dusty Purple
+    {6551, 3007, -3105}, // Pale Soft Purple
+    {6327, 4169, -4229}, // Pale Purple
+    {6144, 5195, -5238}, // Pale Rich Purple
+    {6006, 6197, -6173}, // Pale Vivid Purple
+    {8434, 458, -506}, // Faint Ashy Purple
+    {8317, 955, -998}, // Faint Dusty Purple
+    {8177, 1516, -1634}, // Faint Soft Purple
+    {8024, 2149, -2239}, // Faint Purple
+    {7892, 2699, -2815}, // Faint Rich Purple
+    {7766, 3251, -3384}, // Faint Vivid Purple
+    {1418, 685, -570}, // Deep Ashy Amethyst
+    {1306, 1392, -1170}, // Deep Dusty Amethyst
+    {1228, 2179, -1790}, // Deep Soft Amethyst
+    {1198, 2827, -2260}, // Deep Amethyst
+    {1238, 3335, -2686}, // Deep Rich Amethyst
+    {1270, 3824, -3048}, // Deep Vivid Amethyst
+    {2726, 1123, -948}, // Dark Ashy Amethyst
+    {2557, 2313, -1924}, // Dark Dusty Amethyst
+    {2478, 3527, -2825}, // Dark Soft Amethyst
+    {2469, 4527, -3609}, // Dark Amethyst
+    {2572, 5212, -4200}, // Dark Rich Amethyst
+    {2716, 5776, -4716}, // Dark Vivid Amethyst
+    {4038, 1575, -1327}, // Ashy Amethyst
+    {3819, 3194, -2638}, // Dusty Amethyst
+    {3713, 4833, -3894}, // Soft Amethyst
+    {3751, 6126, -4907}, // Amethyst
+    {3918, 7058, -5698}, // Rich Amethyst
+    {4145, 7696, -6316}, // Vivid Amethyst
+    {5526, 1714, -1415}, // Light Ashy Amethyst
+    {5293, 3395, -2806}, // Light Dusty Amethyst
+    {5106, 5262, -4244}, // Light Soft Amethyst
+    {5090, 6844, -5463}, // Light Amethyst
+    {5155, 8025, -6426}, // Light Rich Amethyst
+    {5351, 8925, -7219}, // Light Vivid Amethyst
+    {7064, 1073, -939}, // Pale Ashy Amethyst
+    {6890, 2135, -1804}, // Pale Dusty Amethyst
+    {6703, 3475, -2858}, // Pale Soft Amethyst
+    {6548, 4740, -3868}, // Pale Amethyst
+    {6450, 5869, -4733}, // Pale Rich Amethyst
+    {6381, 6891, -5553}, // Pale Vivid Amethyst
+    {8458, 559, -469}, // Faint Ashy Amethyst
+    {8358, 1122, -932}, // Faint Dusty Amethyst
+    {8245, 1778, -1524}, // Faint Soft Amethyst
+    {8114, 2470, -2095}, // Faint Amethyst
+    {8023, 3137, -2604}, // Faint Rich Amethyst
+    {7931, 3768, -3117}, // Faint Vivid Amethyst
+    {1443, 773, -530}, // Deep Ashy Mauve
+    {1378, 1589, -1052}, // Deep Dusty Mauve
+    {1363, 2441, -1569}, // Deep Soft Mauve
+    {1385, 3094, -1952}, // Deep Mauve
+    {1493, 3623, -2262}, // Deep Rich Mauve
+    {1579, 4092, -2534}, // Deep Vivid Mauve
+    {2772, 1281, -874}, // Dark Ashy Mauve
+    {2681, 2624, -1722}, // Dark Dusty Mauve
+    {2687, 3890, -2481}, // Dark Soft Mauve
+    {2786, 4919, -3083}, // Dark Mauve
+    {2993, 5632, -3502}, // Dark Rich Mauve
+    {3235, 6222, -3853}, // Dark Vivid Mauve
+    {4103, 1796, -1222}, // Ashy Mauve
+    {3989, 3607, -2359}, // Dusty Mauve
+    {4018, 5334, -3390}, // Soft Mauve
+    {4201, 6655, -4163}, // Mauve
+    {4502, 7614, -4727}, // Rich Mauve
+    {4851, 8303, -5141}, // Vivid Mauve
+    {5586, 1926, -1318}, // Light Ashy Mauve
+    {5457, 3838, -2538}, // Light Dusty Mauve
+    {5407, 5840, -3750}, // Light Soft Mauve
+    {5542, 7480, -4715}, // Light Mauve
+    {5760, 8691, -5423}, // Light Rich Mauve
+    {6098, 9630, -5978}, // Light Vivid Mauve
+    {7108, 1246, -869}, // Pale Ashy Mauve
+    {6976, 2436, -1664}, // Pale Dusty Mauve
+    {6853, 3915, -2613}, // Pale Soft Mauve
+    {6784, 5318, -3482}, // Pale Mauve
+    {6769, 6525, -4210}, // Pale Rich Mauve
+    {6801, 7622, -4861}, // Pale Vivid Mauve
+    {8474, 627, -443}, // Faint Ashy Mauve
+    {8391, 1257, -879}, // Faint Dusty Mauve
+    {8316, 2043, -1411}, // Faint Soft Mauve
+    {8216, 2826, -1930}, // Faint Mauve
+    {8150, 3548, -2398}, // Faint Rich Mauve
+    {8094, 4259, -2851}, // Faint Vivid Mauve
+    {1435, 724, -399}, // Deep Ashy Orchid
+    {1354, 1475, -729}, // Deep Dusty Orchid
+    {1318, 2275, -1063}, // Deep Soft Orchid
+    {1324, 2905, -1334}, // Deep Orchid
+    {1412, 3397, -1474}, // Deep Rich Orchid
+    {1481, 3851, -1640}, // Deep Vivid Orchid
+    {2757, 1193, -635}, // Dark Ashy Orchid
+    {2640, 2440, -1194}, // Dark Dusty Orchid
+    {2618, 3651, -1739}, // Dark Soft Orchid
+    {2684, 4624, -2080}, // Dark Orchid
+    {2859, 5283, -2245}, // Dark Rich Orchid
+    {3071, 5821, -2346}, // Dark Vivid Orchid
+    {4081, 1673, -886}, // Ashy Orchid
+    {3933, 3361, -1648}, // Dusty Orchid
+    {3918, 4998, -2326}, // Soft Orchid
+    {4056, 6248, -2762}, // Mid Orchid
+    {4316, 7139, -2999}, // Rich Orchid
+    {4629, 7757, -3086}, // Vivid Orchid
+    {5565, 1809, -1001}, // Light Ashy Orchid
+    {5402, 3581, -1810}, // Light Dusty Orchid
+    {5308, 5472, -2631}, // Light Soft Orchid
+    {5395, 7026, -3226}, // Light Orchid
+    {5566, 8162, -3571}, // Light Rich Orchid
+    {5861, 9026, -3771}, // Light Vivid Orchid
+    {7093, 1153, -615}, // Pale Ashy Orchid
+    {6947, 2270, -1210}, // Pale Dusty Orchid
+    {6803, 3664, -1913}, // Pale Soft Orchid
+    {6705, 4974, -2493}, // Pale Orchid
+    {6664, 6116, -2989}, // Pale Rich Orchid
+    {6663, 7141, -3365}, // Pale Vivid Orchid
+    {8468, 591, -345}, // Faint Ashy Orchid
+    {8380, 1184, -683}, // Faint Dusty Orchid
+    {8292, 1899, -1019}, // Faint Soft Orchid
+    {8181, 2629, -1392}, // Faint Orchid
+    {8107, 3318, -1766}, // Faint Rich Orchid
+    {8039, 3980, -2076}, // Faint Vivid Orchid
+    {1423, 655, -201}, // Deep Ashy Fuchsia
+    {1336, 1390, -465}, // Deep Dusty Fuchsia
+    {1284, 2144, -605}, // Deep Soft Fuchsia
+    {1273, 2739, -685}, // Deep Fuchsia
+    {1349, 3220, -701}, // Deep Rich Fuchsia
+    {1403, 3651, -681}, // Deep Vivid Fuchsia
+    {2742, 1109, -394}, // Dark Ashy Fuchsia
+    {2607, 2290, -714}, // Dark Dusty Fuchsia
+    {2555, 3422, -907}, // Dark Soft Fuchsia
+    {2598, 4369, -1020}, // Dark Fuchsia
+    {2752, 4992, -899}, // Dark Rich Fuchsia
+    {2949, 5507, -776}, // Dark Vivid Fuchsia
+    {4060, 1556, -548}, // Ashy Fuchsia
+    {3886, 3152, -974}, // Dusty Fuchsia
+    {3837, 4714, -1271}, // Soft Fuchsia
+    {3937, 5901, -1277}, // Fuchsia
+    {4169, 6748, -1142}, // Rich Fuchsia
+    {4458, 7320, -859}, // Vivid Fuchsia
+    {5543, 1678, -628}, // Light Ashy Fuchsia
+    {5353, 3341, -1067}, // Light Dusty Fuchsia
+    {5222, 5140, -1473}, // Light Soft Fuchsia
+    {5267, 6618, -1608}, // Light Fuchsia
+    {5408, 7714, -1601}, // Light Rich Fuchsia
+    {5673, 8529, -1399}, // Light Vivid Fuchsia
+    {7082, 1079, -411}, // Pale Ashy Fuchsia
+    {6919, 2110, -751}, // Pale Dusty Fuchsia
+    {6753, 3410, -1150}, // Pale Soft Fuchsia
+    {6635, 4657, -1480}, // Pale Fuchsia
+    {6567, 5730, -1678}, // Pale Rich Fuchsia
+    {6549, 6726, -1858}, // Pale Vivid Fuchsia
+    {8460, 537, -197}, // Faint Ashy Fuchsia
+    {8366, 1095, -436}, // Faint Dusty Fuchsia
+    {8269, 1759, -625}, // Faint Soft Fuchsia
+    {8152, 2458, -900}, // Faint Fuchsia
+    {8064, 3082, -1077}, // Faint Rich Fuchsia
+    {7985, 3700, -1240}, // Faint Vivid Fuchsia
+    {1416, 611, -67}, // Deep Ashy Rose
+    {1317, 1291, -130}, // Deep Dusty Rose
+    {1256, 2029, -133}, // Deep Soft Rose
+    {1232, 2601, -6}, // Deep Rose
+    {1298, 3067, 184}, // Deep Rich Rose
+    {1345, 3499, 345}, // Deep Vivid Rose
+    {2729, 1029, -150}, // Dark Ashy Rose
+    {2577, 2152, -224}, // Dark Dusty Rose
+    {2506, 3240, -104}, // Dark Soft Rose
+    {2531, 4161, 97}, // Dark Rose
+    {2672, 4769, 536}, // Dark Rich Rose
+    {2859, 5272, 973}, // Dark Vivid Rose
+    {4041, 1445, -207}, // Ashy Rose
+    {3844, 2963, -287}, // Dusty Rose
+    {3766, 4459, -117}, // Soft Rose
+    {3848, 5632, 233}, // Rose
+    {4061, 6452, 841}, // Rich Rose
+    {4343, 7016, 1476}, // Vivid Rose
+    {5522, 1552, -253}, // Light Ashy Rose
+    {5308, 3121, -310}, // Light Dusty Rose
+    {5148, 4849, -276}, // Light Soft Rose
+    {5168, 6289, 33}, // Light Rose
+    {5287, 7360, 488}, // Light Rich Rose
+    {5537, 8156, 1137}, // Light Vivid Rose
+    {7068, 990, -156}, // Pale Ashy Rose
+    {6893, 1957, -289}, // Pale Dusty Rose
+    {6708, 3174, -377}, // Pale Soft Rose
+    {6569, 4355, -393}, // Pale Rose
+    {6488, 5402, -379}, // Pale Rich Rose
+    {6449, 6356, -243}, // Pale Vivid Rose
+    {8455, 501, -99}, // Faint Ashy Rose
+    {8353, 1008, -189}, // Faint Dusty Rose
+    {8247, 1624, -229}, // Faint Soft Rose
+    {8121, 2277, -353}, // Faint Rose
+    {8024, 2860, -380}, // Faint Rich Rose
+    {7939, 3454, -443}, // Faint Vivid Rose
+    {1409, 568, 67}, // Deep Ashy Crimson
+    {1299, 1203, 210}, // Deep Dusty Crimson
+    {1228, 1918, 421}, // Deep Soft Crimson
+    {1200, 2493, 699}, // Deep Crimson
+    {1262, 2958, 1085}, // Deep Rich Crimson
+    {1306, 3394, 1402}, // Deep Vivid Crimson
+    {2716, 953, 94}, // Dark Ashy Crimson
+    {2548, 2014, 337}, // Dark Dusty Crimson
+    {2467, 3089, 722}, // Dark Soft Crimson
+    {2482, 4006, 1259}, // Dark Crimson
+    {2622, 4625, 1963}, // Dark Rich Crimson
+    {2808, 5135, 2707}, // Dark Vivid Crimson
+    {4023, 1339, 137}, // Ashy Crimson
+    {3808, 2794, 414}, // Dusty Crimson
+    {3713, 4262, 1015}, // Soft Crimson
+    {3782, 5427, 1866}, // Mid Crimson
+    {3993, 6260, 2900}, // Rich Crimson
+    {4277, 6836, 3912}, // Vivid Crimson
+    {5502, 1432, 125}, // Light Ashy Crimson
+    {5271, 2935, 403}, // Light Dusty Crimson
+    {5088, 4604, 953}, // Light Soft Crimson
+    {5093, 6034, 1734}, // Light Crimson
+    {5203, 7108, 2664}, // Light Rich Crimson
+    {5451, 7916, 3765}, // Light Vivid Crimson
+    {7057, 920, 50}, // Pale Ashy Crimson
+    {6869, 1811, 177}, // Pale Dusty Crimson
+    {6667, 2957, 407}, // Pale Soft Crimson
+    {6515, 4100, 663}, // Pale Crimson
+    {6419, 5109, 1005}, // Pale Rich Crimson
+    {6372, 6061, 1368}, // Pale Vivid Crimson
+    {8450, 466, 0}, // Faint Ashy Crimson
+    {8340, 922, 59}, // Faint Dusty Crimson
+    {8227, 1493, 169}, // Faint Soft Crimson
+    {8092, 2104, 196}, // Faint Crimson
+    {7990, 2665, 273}, // Faint Rich Crimson
+    {7897, 3226, 364}, // Faint Vivid Crimson
+};
+
+static constexpr uint16_t NAME_OFFSET[SIZE] = {
+    0, 10, 23, 34, 40, 46, 53, 59, 74, 79,
+    90, 96, 106, 116, 127, 137, 143, 158, 167, 175,
+    180, 189, 198, 212, 221, 231, 241, 253, 268, 279,
+    290, 298, 309, 322, 336, 350, 364, 375, 384, 396,
+    404, 415, 425, 437, 449, 459, 470, 475, 485, 490,
+    496, 508, 517, 525, 535, 542, 548, 554, 563, 577,
+    587, 600, 610, 621, 631, 652, 662, 673, 683, 695,
+    709, 722, 737, 752, 764, 769, 779, 785, 793, 800,
+    817, 828, 841, 854, 869, 885, 903, 919, 935, 948,
+    958, 968, 977, 989, 994, 1002, 1008, 1018, 1025, 1035,
+    1042, 1056, 1066, 1080, 1094, 1105, 1115, 1120, 1125, 1130,
+    1141, 1148, 1162, 1166, 1176, 1186, 1198, 1205, 1216, 1225,
+    1234, 1241, 1248, 1256, 1266, 1276, 1281, 1293, 1303, 1307,
+    1312, 1320, 1327, 1337, 1344, 1350, 1356, 1367, 1374, 1386,
+    1390, 1399, 1408, 1419, 1429, 1438, 1445, 1455, 1464, 1470,
+    1484, 1499, 1513, 1522, 1536, 1551, 1565, 1580, 1594, 1603,
+    1617, 1632, 1641, 1651, 1660, 1668, 1677, 1687, 1702, 1718,
+    1733, 1743, 1758, 1774, 1788, 1803, 1817, 1826, 1840, 1855,
+    1870, 1886, 1901, 1911, 1926, 1942, 1960, 1979, 1997, 2010,
+    2028, 2047, 2065, 2084, 2102, 2115, 2133, 2152, 2165, 2179,
+    2192, 2200, 2213, 2227, 2246, 2266, 2285, 2299, 2318, 2338,
+    2356, 2375, 2393, 2406, 2424, 2443, 2462, 2482, 2501, 2515,
+    2534, 2554, 2570, 2587, 2603, 2614, 2630, 2647, 2663, 2680,
+    2696, 2707, 2723, 2740, 2751, 2763, 2774, 2780, 2791, 2803,
+    2820, 2838, 2855, 2867, 2884, 2902, 2918, 2935, 2951, 2962,
+    2978, 2995, 3012, 3030, 3047, 3059, 3076, 3094, 3111, 3129,
+    3146, 3158, 3175, 3193, 3210, 3228, 3245, 3257, 3274, 3292,
+    3304, 3317, 3329, 3340, 3352, 3365, 3383, 3402, 3420, 3433,
+    3451, 3470, 3487, 3505, 3522, 3534, 3551, 3569, 3587, 3606,
+    3624, 3637, 3655, 3671, 3688, 3704, 3715, 3731, 3748, 3764,
+    3781, 3797, 3808, 3824, 3841, 3852, 3864, 3875, 3881, 3892,
+    3904, 3921, 3939, 3956, 3968, 3985, 4003, 4019, 4036, 4052,
+    4063, 4079, 4096, 4113, 4131, 4148, 4160, 4177, 4195, 4212,
+    4230, 4247, 4259, 4276, 4294, 4311, 4329, 4346, 4358, 4375,
+    4393, 4405, 4418, 4430, 4441, 4453, 4466, 4484, 4503, 4521,
+    4534, 4552, 4571, 4588, 4606, 4623, 4635, 4652, 4670, 4688,
+    4707, 4725, 4738, 4756, 4775, 4791, 4808, 4824, 4835, 4851,
+    4868, 4884, 4901, 4917, 4928, 4944, 4961, 4972, 4984, 4995,
+    5001, 5012, 5024, 5041, 5059, 5076, 5088, 5105, 5123, 5139,
+    5156, 5172, 5183, 5199, 5216, 5233, 5251, 5268, 5280, 5297,
+    5315, 5330, 5346, 5361, 5371, 5386, 5402, 5417, 5433, 5448,
+    5458, 5473, 5489, 5499, 5510, 5520, 5525, 5535, 5546, 5562,
+    5579, 5595, 5606, 5622, 5639, 5654, 5670, 5685, 5695, 5710,
+    5726, 5742, 5759, 5775, 5786, 5802, 5819, 5834, 5850, 5865,
+    5875, 5890, 5906, 5921, 5937, 5952, 5962, 5977, 5993, 6003,
+    6014, 6024, 6033, 6043, 6054, 6070, 6087, 6103, 6114, 6130,
+    6147, 6162, 6178, 6193, 6203, 6218, 6234, 6250, 6267, 6283,
+    6294, 6310, 6327, 6342, 6358, 6373, 6383, 6398, 6414, 6429,
+    6445, 6460, 6470, 6485, 6501, 6511, 6522, 6532, 6537, 6547,
+    6558, 6574, 6591, 6607, 6618, 6634, 6651, 6666, 6682, 6697,
+    6707, 6722, 6738, 6754, 6771, 6787, 6798, 6814, 6831, 6847,
+    6864, 6880, 6891, 6907, 6924, 6940, 6957, 6973, 6984, 7000,
+    7017, 7028, 7040, 7051, 7061, 7072, 7084, 7101, 7119, 7136,
+    7148, 7165, 7183, 7199, 7216, 7232, 7243, 7259, 7276, 7293,
+    7311, 7328, 7340, 7357, 7375, 7392, 7410, 7427, 7439, 7456,
+    7474, 7491, 7509, 7526, 7538, 7555, 7573, 7585, 7598, 7610,
+    7617, 7629, 7642, 7660, 7679, 7697, 7710, 7728, 7747, 7764,
+    7782, 7799, 7811, 7828, 7846, 7864, 7883, 7901, 7914, 7932,
+    7951, 7969, 7988, 8006, 8019, 8037, 8056, 8074, 8093, 8111,
+    8124, 8142, 8161, 8174, 8188, 8201, 8209, 8222, 8236, 8255,
+    8275, 8294, 8308, 8327, 8347, 8365, 8384, 8402, 8415, 8433,
+    8452, 8471, 8491, 8510, 8524, 8543, 8563, 8578, 8594, 8609,
+    8619, 8634, 8650, 8665, 8681, 8696, 8706, 8721, 8737, 8747,
+    8758, 8768, 8773, 8783, 8794, 8810, 8827, 8843, 8854, 8870,
+    8887, 8902, 8918, 8933, 8943, 8958, 8974, 8990, 9007, 9023,
+    9034, 9050, 9067, 9082, 9098, 9113, 9123, 9138, 9154, 9169,
+    9185, 9200, 9210, 9225, 9241, 9251, 9262, 9272, 9277, 9287,
+    9298, 9314, 9331, 9347, 9358, 9374, 9391, 9406, 9422, 9437,
+    9447, 9462, 9478, 9494, 9511, 9527, 9538, 9554, 9571, 9586,
+    9602, 9617, 9627, 9642, 9658, 9673, 9689, 9704, 9714, 9729,
+    9745, 9755, 9766, 9776, 9781, 9791, 9802, 9818, 9835, 9851,
+    9862, 9878, 9895, 9910, 9926, 9941, 9951, 9966, 9982, 9998,
+    10015, 10031, 10042, 10058, 10075, 10094, 10114, 10133, 10147, 10166,
+    10186, 10205, 10225, 10244, 10258, 10277, 10297, 10311, 10326, 10340,
+    10349, 10363, 10378, 10398, 10419, 10439, 10454, 10474, 10495, 10514,
+    10534, 10553, 10567, 10586, 10606, 10626, 10647, 10667, 10682, 10702,
+    10723, 10737, 10752, 10766, 10775, 10789, 10804, 10818, 10833, 10847,
+    10856, 10870, 10885, 10894, 10904, 10913, 10917, 10926, 10936, 10951,
+    10967, 10982, 10992, 11007, 11023, 11037, 11052, 11066, 11075, 11089,
+    11104, 11119, 11135, 11150, 11160, 11175, 11191, 11208, 11226, 11243,
+    11255, 11272, 11290, 11307, 11325, 11342, 11354, 11371, 11389, 11401,
+    11414, 11426, 11433, 11445, 11458, 11476, 11495, 11513, 11526, 11544,
+    11563, 11580, 11598, 11615, 11627, 11644, 11662, 11680, 11699, 11717,
+    11730, 11748, 11767, 11786, 11806, 11825, 11839, 11858, 11878, 11897,
+    11917, 11936, 11950, 11969, 11989, 12003, 12018, 12032, 12041, 12055,
+    12070, 12090, 12111, 12131, 12146, 12166, 12187, 12206, 12226, 12245,
+    12259, 12278, 12298, 12318, 12339, 12359, 12374, 12394, 12415, 12432,
+    12450, 12467, 12479, 12496, 12514, 12531, 12549, 12566, 12578, 12595,
+    12613, 12625, 12638, 12650, 12657, 12669, 12682, 12700, 12719, 12737,
+    12750, 12768, 12787, 12804, 12822, 12839, 12851, 12868, 12886, 12904,
+    12923, 12941, 12954, 12972, 12991, 13008, 13026, 13043, 13055, 13072,
+    13090, 13107, 13125, 13142, 13154, 13171, 13189, 13201, 13214, 13226,
+    13237, 13249, 13262, 13280, 13299, 13317, 13330, 13348, 13367, 13384,
+    13402, 13419, 13431, 13448, 13466, 13484, 13503, 13521, 13534, 13552,
+    13571, 13588, 13606, 13623, 13635, 13652, 13670, 13687, 13705, 13722,
+    13734, 13751, 13769, 13781, 13794, 13806, 13817, 13829, 13842, 13860,
+    13879, 13897, 13910, 13928, 13947, 13964, 13982, 13999, 14011, 14028,
+    14046, 14064, 14083, 14101, 14114, 14132, 14151, 14168, 14186, 14203,
+    14215, 14232, 14250, 14267, 14285, 14302, 14314, 14331, 14349, 14361,
+    14374, 14386, 14397, 14409, 14422, 14440, 14459, 14477, 14490, 14508,
+    14527, 14544, 14562, 14579, 14591, 14608, 14626, 14644, 14663, 14681,
+    14694, 14712, 14731, 14750, 14770, 14789, 14803, 14822, 14842, 14861,
+    14881, 14900, 14914, 14933, 14953, 14967, 14982, 14996, 15005, 15019,
+    15034, 15054, 15075, 15095, 15110, 15130, 15151, 15170, 15190, 15209,
+    15223, 15242, 15262, 15282, 15303, 15323, 15338, 15358, 15379, 15395,
+    15412, 15428, 15439, 15455, 15472, 15488, 15505, 15521, 15532, 15548,
+    15565, 15576, 15588, 15599, 15605, 15616, 15628, 15645, 15663, 15680,
+    15692, 15709, 15727, 15743, 15760, 15776, 15787, 15803, 15820, 15837,
+    15855, 15872, 15884, 15901, 15919, 15936, 15954, 15971, 15983, 16000,
+    16018, 16035, 16053, 16070, 16082, 16099, 16117, 16129, 16142, 16154,
+    16165, 16177, 16190, 16208, 16227, 16245, 16258, 16276, 16295, 16312,
+    16330, 16347, 16359, 16376, 16394, 16412, 16431, 16449, 16462, 16480,
+    16499, 16517, 16536, 16554, 16567, 16585, 16604, 16622, 16641, 16659,
+    16672, 16690, 16709, 16722, 16736, 16749, 16757, 16770, 16784, 16803,
+    16823, 16842, 16856, 16875, 16895, 16913, 16932, 16950, 16963, 16981,
+    17000, 17019, 17039, 17058, 17072, 17091, 17111, 17126, 17142, 17157,
+    17167, 17182, 17198, 17213, 17229, 17244, 17254, 17269, 17285, 17295,
+    17306, 17316, 17321, 17331, 17342, 17358, 17375, 17391, 17402, 17418,
+    17435, 17450, 17466, 17481, 17491, 17506, 17522, 17538, 17555, 17571,
+    17582, 17598, 17615, 17633, 17652, 17670, 17683, 17701, 17720, 17738,
+    17757, 17775, 17788, 17806, 17825, 17838, 17852, 17865, 17877, 17890,
+    17904, 17923, 17943, 17962, 17976, 17995, 18015, 18033, 18052, 18070,
+    18083, 18101, 18120, 18139, 18159, 18178, 18192, 18211,
+};
+
+// NUL-separated names, indexed through NAME_OFFSET
+static constexpr char NAMES[] =
+    "AliceBlue\0"
+    "AntiqueWhite\0"
+    "Aquamarine\0"
+    "Azure\0"
+    "Beige\0"
+    "Bisque\0"
+    "Black\0"
+    "BlanchedAlmond\0"
+    "Blue\0"
+    "BlueViolet\0"
+    "Brown\0"
+    "BurlyWood\0"
+    "CadetBlue\0"
+    "Chartreuse\0"
+    "Chocolate\0"
+    "Coral\0"
+    "CornflowerBlue\0"
+    "Cornsilk\0"
+    "Crimson\0"
+    "Cyan\0"
+    "DarkBlue\0"
+    "DarkCyan\0"
+    "DarkGoldenRod\0"
+    "DarkGray\0"
+    "DarkGreen\0"
+    "DarkKhaki\0"
+    "DarkMagenta\0"
+    "DarkOliveGreen\0"
+    "DarkOrange\0"
+    "DarkOrchid\0"
+    "DarkRed\0"
+    "DarkSalmon\0"
+    "DarkSeaGreen\0"
+    "DarkSlateBlue\0"
+    "DarkSlateGray\0"
+    "DarkTurquoise\0"
+    "DarkViolet\0"
+    "DeepPink\0"
+    "DeepSkyBlue\0"
+    "DimGray\0"
+    "DodgerBlue\0"
+    "FireBrick\0"
+    "FloralWhite\0"
+    "ForestGreen\0"
+    "Gainsboro\0"
+    "GhostWhite\0"
+    "Gold\0"
+    "GoldenRod\0"
+    "Gray\0"
+    "Green\0"
+    "GreenYellow\0"
+    "HoneyDew\0"
+    "HotPink\0"
+    "IndianRed\0"
+    "Indigo\0"
+    "Ivory\0"
+    "Khaki\0"
+    "Lavender\0"
+    "LavenderBlush\0"
+    "LawnGreen\0"
+    "LemonChiffon\0"
+    "LightBlue\0"
+    "LightCoral\0"
+    "LightCyan\0"
+    "LightGoldenRodYellow\0"
+    "LightGray\0"
+    "LightGreen\0"
+    "LightPink\0"
+    "LightSalmon\0"
+    "LightSeaGreen\0"
+    "LightSkyBlue\0"
+    "LightSlateGray\0"
+    "LightSteelBlue\0"
+    "LightYellow\0"
+    "Lime\0"
+    "LimeGreen\0"
+    "Linen\0"
+    "Magenta\0"
+    "Maroon\0"
+    "MediumAquaMarine\0"
+    "MediumBlue\0"
+    "MediumOrchid\0"
+    "MediumPurple\0"
+    "MediumSeaGreen\0"
+    "MediumSlateBlue\0"
+    "MediumSpringGreen\0"
+    "MediumTurquoise\0"
+    "MediumVioletRed\0"
+    "MidnightBlue\0"
+    "MintCream\0"
+    "MistyRose\0"
+    "Moccasin\0"
+    "NavajoWhite\0"
+    "Navy\0"
+    "OldLace\0"
+    "Olive\0"
+    "OliveDrab\0"
+    "Orange\0"
+    "OrangeRed\0"
+    "Orchid\0"
+    "PaleGoldenRod\0"
+    "PaleGreen\0"
+    "PaleTurquoise\0"
+    "PaleVioletRed\0"
+    "PapayaWhip\0"
+    "PeachPuff\0"
+    "Peru\0"
+    "Pink\0"
+    "Plum\0"
+    "PowderBlue\0"
+    "Purple\0"
+    "RebeccaPurple\0"
+    "Red\0"
+    "RosyBrown\0"
+    "RoyalBlue\0"
+    "SaddleBrown\0"
+    "Salmon\0"
+    "SandyBrown\0"
+    "SeaGreen\0"
+    "SeaShell\0"
+    "Sienna\0"
+    "Silver\0"
+    "SkyBlue\0"
+    "SlateBlue\0"
+    "SlateGray\0"
+    "Snow\0"
+    "SpringGreen\0"
+    "SteelBlue\0"
+    "Tan\0"
+    "Teal\0"
+    "Thistle\0"
+    "Tomato\0"
+    "Turquoise\0"
+    "Violet\0"
+    "Wheat\0"
+    "White\0"
+    "WhiteSmoke\0"
+    "Yellow\0"
+    "YellowGreen\0"
+    "Jet\0"
+    "Charcoal\0"
+    "Graphite\0"
+    "Slate Gray\0"
+    "Iron Gray\0"
+    "Ash Gray\0"
+    "Pewter\0"
+    "Pale Gray\0"
+    "Platinum\0"
+    "Pearl\0"
+    "Deep Ashy Red\0"
+    "Deep Dusty Red\0"
+    "Deep Soft Red\0"
+    "Deep Red\0"
+    "Deep Rich Red\0"
+    "Deep Vivid Red\0"
+    "Dark Ashy Red\0"
+    "Dark Dusty Red\0"
+    "Dark Soft Red\0"
+    "Dark Red\0"
+    "Dark Rich Red\0"
+    "Dark Vivid Red\0"
+    "Ashy Red\0"
+    "Dusty Red\0"
+    "Soft Red\0"
+    "Mid Red\0"
+    "Rich Red\0"
+    "Vivid Red\0"
+    "Light Ashy Red\0"
+    "Light Dusty Red\0"
+    "Light Soft Red\0"
+    "Light Red\0"
+    "Light Rich Red\0"
+    "Light Vivid Red\0"
+    "Pale Ashy Red\0"
+    "Pale Dusty Red\0"
+    "Pale Soft Red\0"
+    "Pale Red\0"
+    "Pale Rich Red\0"
+    "Pale Vivid Red\0"
+    "Faint Ashy Red\0"
+    "Faint Dusty Red\0"
+    "Faint Soft Red\0"
+    "Faint Red\0"
+    "Faint Rich Red\0"
+    "Faint Vivid Red\0"
+    "Deep Ashy Scarlet\0"
+    "Deep Dusty Scarlet\0"
+    "Deep Soft Scarlet\0"
+    "Deep Scarlet\0"
+    "Deep Rich Scarlet\0"
+    "Deep Vivid Scarlet\0"
+    "Dark Ashy Scarlet\0"
+    "Dark Dusty Scarlet\0"
+    "Dark Soft Scarlet\0"
+    "Dark Scarlet\0"
+    "Dark Rich Scarlet\0"
+    "Dark Vivid Scarlet\0"
+    "Ashy Scarlet\0"
+    "Dusty Scarlet\0"
+    "Soft Scarlet\0"
+    "Scarlet\0"
+    "Rich Scarlet\0"
+    "Vivid Scarlet\0"
+    "Light Ashy Scarlet\0"
+    "Light Dusty Scarlet\0"
+    "Light Soft Scarlet\0"
+    "Light Scarlet\0"
+    "Light Rich Scarlet\0"
+    "Light Vivid Scarlet\0"
+    "Pale Ashy Scarlet\0"
+    "Pale Dusty Scarlet\0"
+    "Pale Soft Scarlet\0"
+    "Pale Scarlet\0"
+    "Pale Rich Scarlet\0"
+    "Pale Vivid Scarlet\0"
+    "Faint Ashy Scarlet\0"
+    "Faint Dusty Scarlet\0"
+    "Faint Soft Scarlet\0"
+    "Faint Scarlet\0"
+    "Faint Rich Scarlet\0"
+    "Faint Vivid Scarlet\0"
+    "Deep Ashy Flame\0"
+    "Deep Dusty Flame\0"
+    "Deep Soft Flame\0"
+    "Deep Flame\0"
+    "Deep Rich Flame\0"
+    "Deep Vivid Flame\0"
+    "Dark Ashy Flame\0"
+    "Dark Dusty Flame\0"
+    "Dark Soft Flame\0"
+    "Dark Flame\0"
+    "Dark Rich Flame\0"
+    "Dark Vivid Flame\0"
+    "Ashy Flame\0"
+    "Dusty Flame\0"
+    "Soft Flame\0"
+    "Flame\0"
+    "Rich Flame\0"
+    "Vivid Flame\0"
+    "Light Ashy Flame\0"
+    "Light Dusty Flame\0"
+    "Light Soft Flame\0"
+    "Light Flame\0"
+    "Light Rich Flame\0"
+    "Light Vivid Flame\0"
+    "Pale Ashy Flame\0"
+    "Pale Dusty Flame\0"
+    "Pale Soft Flame\0"
+    "Pale Flame\0"
+    "Pale Rich Flame\0"
+    "Pale Vivid Flame\0"
+    "Faint Ashy Flame\0"
+    "Faint Dusty Flame\0"
+    "Faint Soft Flame\0"
+    "Faint Flame\0"
+    "Faint Rich Flame\0"
+    "Faint Vivid Flame\0"
+    "Deep Ashy Orange\0"
+    "Deep Dusty Orange\0"
+    "Deep Soft Orange\0"
+    "Deep Orange\0"
+    "Deep Rich Orange\0"
+    "Deep Vivid Orange\0"
+    "Dark Ashy Orange\0"
+    "Dark Dusty Orange\0"
+    "Dark Soft Orange\0"
+    "Dark Orange\0"
+    "Dark Rich Orange\0"
+    "Dark Vivid Orange\0"
+    "Ashy Orange\0"
+    "Dusty Orange\0"
+    "Soft Orange\0"
+    "Mid Orange\0"
+    "Rich Orange\0"
+    "Vivid Orange\0"
+    "Light Ashy Orange\0"
+    "Light Dusty Orange\0"
+    "Light Soft Orange\0"
+    "Light Orange\0"
+    "Light Rich Orange\0"
+    "Light Vivid Orange\0"
+    "Pale Ashy Orange\0"
+    "Pale Dusty Orange\0"
+    "Pale Soft Orange\0"
+    "Pale Orange\0"
+    "Pale Rich Orange\0"
+    "Pale Vivid Orange\0"
+    "Faint Ashy Orange\0"
+    "Faint Dusty Orange\0"
+    "Faint Soft Orange\0"
+    "Faint Orange\0"
+    "Faint Rich Orange\0"
+    "Deep Ashy Amber\0"
+    "Deep Dusty Amber\0"
+    "Deep Soft Amber\0"
+    "Deep Amber\0"
+    "Deep Rich Amber\0"
+    "Deep Vivid Amber\0"
+    "Dark Ashy Amber\0"
+    "Dark Dusty Amber\0"
+    "Dark Soft Amber\0"
+    "Dark Amber\0"
+    "Dark Rich Amber\0"
+    "Dark Vivid Amber\0"
+    "Ashy Amber\0"
+    "Dusty Amber\0"
+    "Soft Amber\0"
+    "Amber\0"
+    "Rich Amber\0"
+    "Vivid Amber\0"
+    "Light Ashy Amber\0"
+    "Light Dusty Amber\0"
+    "Light Soft Amber\0"
+    "Light Amber\0"
+    "Light Rich Amber\0"
+    "Light Vivid Amber\0"
+    "Pale Ashy Amber\0"
+    "Pale Dusty Amber\0"
+    "Pale Soft Amber\0"
+    "Pale Amber\0"
+    "Pale Rich Amber\0"
+    "Pale Vivid Amber\0"
+    "Faint Ashy Amber\0"
+    "Faint Dusty Amber\0"
+    "Faint Soft Amber\0"
+    "Faint Amber\0"
+    "Faint Rich Amber\0"
+    "Faint Vivid Amber\0"
+    "Deep Ashy Yellow\0"
+    "Deep Dusty Yellow\0"
+    "Deep Soft Yellow\0"
+    "Deep Yellow\0"
+    "Deep Rich Yellow\0"
+    "Deep Vivid Yellow\0"
+    "Dark Ashy Yellow\0"
+    "Dark Dusty Yellow\0"
+    "Dark Soft Yellow\0"
+    "Dark Yellow\0"
+    "Dark Rich Yellow\0"
+    "Dark Vivid Yellow\0"
+    "Ashy Yellow\0"
+    "Dusty Yellow\0"
+    "Soft Yellow\0"
+    "Mid Yellow\0"
+    "Rich Yellow\0"
+    "Vivid Yellow\0"
+    "Light Ashy Yellow\0"
+    "Light Dusty Yellow\0"
+    "Light Soft Yellow\0"
+    "Light Yellow\0"
+    "Light Rich Yellow\0"
+    "Light Vivid Yellow\0"
+    "Pale Ashy Yellow\0"
+    "Pale Dusty Yellow\0"
+    "Pale Soft Yellow\0"
+    "Pale Yellow\0"
+    "Pale Rich Yellow\0"
+    "Pale Vivid Yellow\0"
+    "Faint Ashy Yellow\0"
+    "Faint Dusty Yellow\0"
+    "Faint Soft Yellow\0"
+    "Faint Yellow\0"
+    "Faint Rich Yellow\0"
+    "Faint Vivid Yellow\0"
+    "Deep Ashy Lemon\0"
+    "Deep Dusty Lemon\0"
+    "Deep Soft Lemon\0"
+    "Deep Lemon\0"
+    "Deep Rich Lemon\0"
+    "Deep Vivid Lemon\0"
+    "Dark Ashy Lemon\0"
+    "Dark Dusty Lemon\0"
+    "Dark Soft Lemon\0"
+    "Dark Lemon\0"
+    "Dark Rich Lemon\0"
+    "Dark Vivid Lemon\0"
+    "Ashy Lemon\0"
+    "Dusty Lemon\0"
+    "Soft Lemon\0"
+    "Lemon\0"
+    "Rich Lemon\0"
+    "Vivid Lemon\0"
+    "Light Ashy Lemon\0"
+    "Light Dusty Lemon\0"
+    "Light Soft Lemon\0"
+    "Light Lemon\0"
+    "Light Rich Lemon\0"
+    "Light Vivid Lemon\0"
+    "Pale Ashy Lemon\0"
+    "Pale Dusty Lemon\0"
+    "Pale Soft Lemon\0"
+    "Pale Lemon\0"
+    "Pale Rich Lemon\0"
+    "Pale Vivid Lemon\0"
+    "Faint Ashy Lemon\0"
+    "Faint Dusty Lemon\0"
+    "Faint Soft Lemon\0"
+    "Faint Lemon\0"
+    "Faint Rich Lemon\0"
+    "Faint Vivid Lemon\0"
+    "Deep Ashy Pear\0"
+    "Deep Dusty Pear\0"
+    "Deep Soft Pear\0"
+    "Deep Pear\0"
+    "Deep Rich Pear\0"
+    "Deep Vivid Pear\0"
+    "Dark Ashy Pear\0"
+    "Dark Dusty Pear\0"
+    "Dark Soft Pear\0"
+    "Dark Pear\0"
+    "Dark Rich Pear\0"
+    "Dark Vivid Pear\0"
+    "Ashy Pear\0"
+    "Dusty Pear\0"
+    "Soft Pear\0"
+    "Pear\0"
+    "Rich Pear\0"
+    "Vivid Pear\0"
+    "Light Ashy Pear\0"
+    "Light Dusty Pear\0"
+    "Light Soft Pear\0"
+    "Light Pear\0"
+    "Light Rich Pear\0"
+    "Light Vivid Pear\0"
+    "Pale Ashy Pear\0"
+    "Pale Dusty Pear\0"
+    "Pale Soft Pear\0"
+    "Pale Pear\0"
+    "Pale Rich Pear\0"
+    "Pale Vivid Pear\0"
+    "Faint Ashy Pear\0"
+    "Faint Dusty Pear\0"
+    "Faint Soft Pear\0"
+    "Faint Pear\0"
+    "Faint Rich Pear\0"
+    "Faint Vivid Pear\0"
+    "Deep Ashy Lime\0"
+    "Deep Dusty Lime\0"
+    "Deep Soft Lime\0"
+    "Deep Lime\0"
+    "Deep Rich Lime\0"
+    "Deep Vivid Lime\0"
+    "Dark Ashy Lime\0"
+    "Dark Dusty Lime\0"
+    "Dark Soft Lime\0"
+    "Dark Lime\0"
+    "Dark Rich Lime\0"
+    "Dark Vivid Lime\0"
+    "Ashy Lime\0"
+    "Dusty Lime\0"
+    "Soft Lime\0"
+    "Mid Lime\0"
+    "Rich Lime\0"
+    "Vivid Lime\0"
+    "Light Ashy Lime\0"
+    "Light Dusty Lime\0"
+    "Light Soft Lime\0"
+    "Light Lime\0"
+    "Light Rich Lime\0"
+    "Light Vivid Lime\0"
+    "Pale Ashy Lime\0"
+    "Pale Dusty Lime\0"
+    "Pale Soft Lime\0"
+    "Pale Lime\0"
+    "Pale Rich Lime\0"
+    "Pale Vivid Lime\0"
+    "Faint Ashy Lime\0"
+    "Faint Dusty Lime\0"
+    "Faint Soft Lime\0"
+    "Faint Lime\0"
+    "Faint Rich Lime\0"
+    "Faint Vivid Lime\0"
+    "Deep Ashy Leaf\0"
+    "Deep Dusty Leaf\0"
+    "Deep Soft Leaf\0"
+    "Deep Leaf\0"
+    "Deep Rich Leaf\0"
+    "Deep Vivid Leaf\0"
+    "Dark Ashy Leaf\0"
+    "Dark Dusty Leaf\0"
+    "Dark Soft Leaf\0"
+    "Dark Leaf\0"
+    "Dark Rich Leaf\0"
+    "Dark Vivid Leaf\0"
+    "Ashy Leaf\0"
+    "Dusty Leaf\0"
+    "Soft Leaf\0"
+    "Leaf\0"
+    "Rich Leaf\0"
+    "Vivid Leaf\0"
+    "Light Ashy Leaf\0"
+    "Light Dusty Leaf\0"
+    "Light Soft Leaf\0"
+    "Light Leaf\0"
+    "Light Rich Leaf\0"
+    "Light Vivid Leaf\0"
+    "Pale Ashy Leaf\0"
+    "Pale Dusty Leaf\0"
+    "Pale Soft Leaf\0"
+    "Pale Leaf\0"
+    "Pale Rich Leaf\0"
+    "Pale Vivid Leaf\0"
+    "Faint Ashy Leaf\0"
+    "Faint Dusty Leaf\0"
+    "Faint Soft Leaf\0"
+    "Faint Leaf\0"
+    "Faint Rich Leaf\0"
+    "Faint Vivid Leaf\0"
+    "Deep Ashy Green\0"
+    "Deep Dusty Green\0"
+    "Deep Soft Green\0"
+    "Deep Green\0"
+    "Deep Rich Green\0"
+    "Deep Vivid Green\0"
+    "Dark Ashy Green\0"
+    "Dark Dusty Green\0"
+    "Dark Soft Green\0"
+    "Dark Green\0"
+    "Dark Rich Green\0"
+    "Dark Vivid Green\0"
+    "Ashy Green\0"
+    "Dusty Green\0"
+    "Soft Green\0"
+    "Mid Green\0"
+    "Rich Green\0"
+    "Vivid Green\0"
+    "Light Ashy Green\0"
+    "Light Dusty Green\0"
+    "Light Soft Green\0"
+    "Light Green\0"
+    "Light Rich Green\0"
+    "Light Vivid Green\0"
+    "Pale Ashy Green\0"
+    "Pale Dusty Green\0"
+    "Pale Soft Green\0"
+    "Pale Green\0"
+    "Pale Rich Green\0"
+    "Pale Vivid Green\0"
+    "Faint Ashy Green\0"
+    "Faint Dusty Green\0"
+    "Faint Soft Green\0"
+    "Faint Green\0"
+    "Faint Rich Green\0"
+    "Faint Vivid Green\0"
+    "Deep Ashy Clover\0"
+    "Deep Dusty Clover\0"
+    "Deep Soft Clover\0"
+    "Deep Clover\0"
+    "Deep Rich Clover\0"
+    "Deep Vivid Clover\0"
+    "Dark Ashy Clover\0"
+    "Dark Dusty Clover\0"
+    "Dark Soft Clover\0"
+    "Dark Clover\0"
+    "Dark Rich Clover\0"
+    "Dark Vivid Clover\0"
+    "Ashy Clover\0"
+    "Dusty Clover\0"
+    "Soft Clover\0"
+    "Clover\0"
+    "Rich Clover\0"
+    "Vivid Clover\0"
+    "Light Ashy Clover\0"
+    "Light Dusty Clover\0"
+    "Light Soft Clover\0"
+    "Light Clover\0"
+    "Light Rich Clover\0"
+    "Light Vivid Clover\0"
+    "Pale Ashy Clover\0"
+    "Pale Dusty Clover\0"
+    "Pale Soft Clover\0"
+    "Pale Clover\0"
+    "Pale Rich Clover\0"
+    "Pale Vivid Clover\0"
+    "Faint Ashy Clover\0"
+    "Faint Dusty Clover\0"
+    "Faint Soft Clover\0"
+    "Faint Clover\0"
+    "Faint Rich Clover\0"
+    "Faint Vivid Clover\0"
+    "Deep Ashy Emerald\0"
+    "Deep Dusty Emerald\0"
+    "Deep Soft Emerald\0"
+    "Deep Emerald\0"
+    "Deep Rich Emerald\0"
+    "Deep Vivid Emerald\0"
+    "Dark Ashy Emerald\0"
+    "Dark Dusty Emerald\0"
+    "Dark Soft Emerald\0"
+    "Dark Emerald\0"
+    "Dark Rich Emerald\0"
+    "Dark Vivid Emerald\0"
+    "Ashy Emerald\0"
+    "Dusty Emerald\0"
+    "Soft Emerald\0"
+    "Emerald\0"
+    "Rich Emerald\0"
+    "Vivid Emerald\0"
+    "Light Ashy Emerald\0"
+    "Light Dusty Emerald\0"
+    "Light Soft Emerald\0"
+    "Light Emerald\0"
+    "Light Rich Emerald\0"
+    "Light Vivid Emerald\0"
+    "Pale Ashy Emerald\0"
+    "Pale Dusty Emerald\0"
+    "Pale Soft Emerald\0"
+    "Pale Emerald\0"
+    "Pale Rich Emerald\0"
+    "Pale Vivid Emerald\0"
+    "Faint Ashy Emerald\0"
+    "Faint Dusty Emerald\0"
+    "Faint Soft Emerald\0"
+    "Faint Emerald\0"
+    "Faint Rich Emerald\0"
+    "Faint Vivid Emerald\0"
+    "Deep Ashy Jade\0"
+    "Deep Dusty Jade\0"
+    "Deep Soft Jade\0"
+    "Deep Jade\0"
+    "Deep Rich Jade\0"
+    "Deep Vivid Jade\0"
+    "Dark Ashy Jade\0"
+    "Dark Dusty Jade\0"
+    "Dark Soft Jade\0"
+    "Dark Jade\0"
+    "Dark Rich Jade\0"
+    "Dark Vivid Jade\0"
+    "Ashy Jade\0"
+    "Dusty Jade\0"
+    "Soft Jade\0"
+    "Jade\0"
+    "Rich Jade\0"
+    "Vivid Jade\0"
+    "Light Ashy Jade\0"
+    "Light Dusty Jade\0"
+    "Light Soft Jade\0"
+    "Light Jade\0"
+    "Light Rich Jade\0"
+    "Light Vivid Jade\0"
+    "Pale Ashy Jade\0"
+    "Pale Dusty Jade\0"
+    "Pale Soft Jade\0"
+    "Pale Jade\0"
+    "Pale Rich Jade\0"
+    "Pale Vivid Jade\0"
+    "Faint Ashy Jade\0"
+    "Faint Dusty Jade\0"
+    "Faint Soft Jade\0"
+    "Faint Jade\0"
+    "Faint Rich Jade\0"
+    "Faint Vivid Jade\0"
+    "Deep Ashy Mint\0"
+    "Deep Dusty Mint\0"
+    "Deep Soft Mint\0"
+    "Deep Mint\0"
+    "Deep Rich Mint\0"
+    "Deep Vivid Mint\0"
+    "Dark Ashy Mint\0"
+    "Dark Dusty Mint\0"
+    "Dark Soft Mint\0"
+    "Dark Mint\0"
+    "Dark Rich Mint\0"
+    "Dark Vivid Mint\0"
+    "Ashy Mint\0"
+    "Dusty Mint\0"
+    "Soft Mint\0"
+    "Mint\0"
+    "Rich Mint\0"
+    "Vivid Mint\0"
+    "Light Ashy Mint\0"
+    "Light Dusty Mint\0"
+    "Light Soft Mint\0"
+    "Light Mint\0"
+    "Light Rich Mint\0"
+    "Light Vivid Mint\0"
+    "Pale Ashy Mint\0"
+    "Pale Dusty Mint\0"
+    "Pale Soft Mint\0"
+    "Pale Mint\0"
+    "Pale Rich Mint\0"
+    "Pale Vivid Mint\0"
+    "Faint Ashy Mint\0"
+    "Faint Dusty Mint\0"
+    "Faint Soft Mint\0"
+    "Faint Mint\0"
+    "Faint Rich Mint\0"
+    "Faint Vivid Mint\0"
+    "Deep Ashy Aqua\0"
+    "Deep Dusty Aqua\0"
+    "Deep Soft Aqua\0"
+    "Deep Aqua\0"
+    "Deep Rich Aqua\0"
+    "Deep Vivid Aqua\0"
+    "Dark Ashy Aqua\0"
+    "Dark Dusty Aqua\0"
+    "Dark Soft Aqua\0"
+    "Dark Aqua\0"
+    "Dark Rich Aqua\0"
+    "Dark Vivid Aqua\0"
+    "Ashy Aqua\0"
+    "Dusty Aqua\0"
+    "Soft Aqua\0"
+    "Aqua\0"
+    "Rich Aqua\0"
+    "Vivid Aqua\0"
+    "Light Ashy Aqua\0"
+    "Light Dusty Aqua\0"
+    "Light Soft Aqua\0"
+    "Light Aqua\0"
+    "Light Rich Aqua\0"
+    "Light Vivid Aqua\0"
+    "Pale Ashy Aqua\0"
+    "Pale Dusty Aqua\0"
+    "Pale Soft Aqua\0"
+    "Pale Aqua\0"
+    "Pale Rich Aqua\0"
+    "Pale Vivid Aqua\0"
+    "Faint Ashy Aqua\0"
+    "Faint Dusty Aqua\0"
+    "Faint Soft Aqua\0"
+    "Faint Aqua\0"
+    "Faint Rich Aqua\0"
+    "Faint Vivid Aqua\0"
+    "Deep Ashy Cerulean\0"
+    "Deep Dusty Cerulean\0"
+    "Deep Soft Cerulean\0"
+    "Deep Cerulean\0"
+    "Deep Rich Cerulean\0"
+    "Deep Vivid Cerulean\0"
+    "Dark Ashy Cerulean\0"
+    "Dark Dusty Cerulean\0"
+    "Dark Soft Cerulean\0"
+    "Dark Cerulean\0"
+    "Dark Rich Cerulean\0"
+    "Dark Vivid Cerulean\0"
+    "Ashy Cerulean\0"
+    "Dusty Cerulean\0"
+    "Soft Cerulean\0"
+    "Cerulean\0"
+    "Rich Cerulean\0"
+    "Vivid Cerulean\0"
+    "Light Ashy Cerulean\0"
+    "Light Dusty Cerulean\0"
+    "Light Soft Cerulean\0"
+    "Light Cerulean\0"
+    "Light Rich Cerulean\0"
+    "Light Vivid Cerulean\0"
+    "Pale Ashy Cerulean\0"
+    "Pale Dusty Cerulean\0"
+    "Pale Soft Cerulean\0"
+    "Pale Cerulean\0"
+    "Pale Rich Cerulean\0"
+    "Pale Vivid Cerulean\0"
+    "Faint Ashy Cerulean\0"
+    "Faint Dusty Cerulean\0"
+    "Faint Soft Cerulean\0"
+    "Faint Cerulean\0"
+    "Faint Rich Cerulean\0"
+    "Faint Vivid Cerulean\0"
+    "Deep Ashy Sky\0"
+    "Deep Dusty Sky\0"
+    "Deep Soft Sky\0"
+    "Deep Sky\0"
+    "Deep Rich Sky\0"
+    "Deep Vivid Sky\0"
+    "Dark Ashy Sky\0"
+    "Dark Dusty Sky\0"
+    "Dark Soft Sky\0"
+    "Dark Sky\0"
+    "Dark Rich Sky\0"
+    "Dark Vivid Sky\0"
+    "Ashy Sky\0"
+    "Dusty Sky\0"
+    "Soft Sky\0"
+    "Sky\0"
+    "Rich Sky\0"
+    "Vivid Sky\0"
+    "Light Ashy Sky\0"
+    "Light Dusty Sky\0"
+    "Light Soft Sky\0"
+    "Light Sky\0"
+    "Light Rich Sky\0"
+    "Light Vivid Sky\0"
+    "Pale Ashy Sky\0"
+    "Pale Dusty Sky\0"
+    "Pale Soft Sky\0"
+    "Pale Sky\0"
+    "Pale Rich Sky\0"
+    "Pale Vivid Sky\0"
+    "Faint Ashy Sky\0"
+    "Faint Dusty Sky\0"
+    "Faint Soft Sky\0"
+    "Faint Sky\0"
+    "Faint Rich Sky\0"
+    "Faint Vivid Sky\0"
+    "Deep Ashy Cobalt\0"
+    "Deep Dusty Cobalt\0"
+    "Deep Soft Cobalt\0"
+    "Deep Cobalt\0"
+    "Deep Rich Cobalt\0"
+    "Deep Vivid Cobalt\0"
+    "Dark Ashy Cobalt\0"
+    "Dark Dusty Cobalt\0"
+    "Dark Soft Cobalt\0"
+    "Dark Cobalt\0"
+    "Dark Rich Cobalt\0"
+    "Dark Vivid Cobalt\0"
+    "Ashy Cobalt\0"
+    "Dusty Cobalt\0"
+    "Soft Cobalt\0"
+    "Cobalt\0"
+    "Rich Cobalt\0"
+    "Vivid Cobalt\0"
+    "Light Ashy Cobalt\0"
+    "Light Dusty Cobalt\0"
+    "Light Soft Cobalt\0"
+    "Light Cobalt\0"
+    "Light Rich Cobalt\0"
+    "Light Vivid Cobalt\0"
+    "Pale Ashy Cobalt\0"
+    "Pale Dusty Cobalt\0"
+    "Pale Soft Cobalt\0"
+    "Pale Cobalt\0"
+    "Pale Rich Cobalt\0"
+    "Pale Vivid Cobalt\0"
+    "Faint Ashy Cobalt\0"
+    "Faint Dusty Cobalt\0"
+    "Faint Soft Cobalt\0"
+    "Faint Cobalt\0"
+    "Faint Rich Cobalt\0"
+    "Faint Vivid Cobalt\0"
+    "Deep Ashy Sapphire\0"
+    "Deep Dusty Sapphire\0"
+    "Deep Soft Sapphire\0"
+    "Deep Sapphire\0"
+    "Deep Rich Sapphire\0"
+    "Deep Vivid Sapphire\0"
+    "Dark Ashy Sapphire\0"
+    "Dark Dusty Sapphire\0"
+    "Dark Soft Sapphire\0"
+    "Dark Sapphire\0"
+    "Dark Rich Sapphire\0"
+    "Dark Vivid Sapphire\0"
+    "Ashy Sapphire\0"
+    "Dusty Sapphire\0"
+    "Soft Sapphire\0"
+    "Sapphire\0"
+    "Rich Sapphire\0"
+    "Vivid Sapphire\0"
+    "Light Ashy Sapphire\0"
+    "Light Dusty Sapphire\0"
+    "Light Soft Sapphire\0"
+    "Light Sapphire\0"
+    "Light Rich Sapphire\0"
+    "Light Vivid Sapphire\0"
+    "Pale Ashy Sapphire\0"
+    "Pale Dusty Sapphire\0"
+    "Pale Soft Sapphire\0"
+    "Pale Sapphire\0"
+    "Pale Rich Sapphire\0"
+    "Pale Vivid Sapphire\0"
+    "Faint Ashy Sapphire\0"
+    "Faint Dusty Sapphire\0"
+    "Faint Soft Sapphire\0"
+    "Faint Sapphire\0"
+    "Faint Rich Sapphire\0"
+    "Faint Vivid Sapphire\0"
+    "Deep Ashy Marine\0"
+    "Deep Dusty Marine\0"
+    "Deep Soft Marine\0"
+    "Deep Marine\0"
+    "Deep Rich Marine\0"
+    "Deep Vivid Marine\0"
+    "Dark Ashy Marine\0"
+    "Dark Dusty Marine\0"
+    "Dark Soft Marine\0"
+    "Dark Marine\0"
+    "Dark Rich Marine\0"
+    "Dark Vivid Marine\0"
+    "Ashy Marine\0"
+    "Dusty Marine\0"
+    "Soft Marine\0"
+    "Marine\0"
+    "Rich Marine\0"
+    "Vivid Marine\0"
+    "Light Ashy Marine\0"
+    "Light Dusty Marine\0"
+    "Light Soft Marine\0"
+    "Light Marine\0"
+    "Light Rich Marine\0"
+    "Light Vivid Marine\0"
+    "Pale Ashy Marine\0"
+    "Pale Dusty Marine\0"
+    "Pale Soft Marine\0"
+    "Pale Marine\0"
+    "Pale Rich Marine\0"
+    "Pale Vivid Marine\0"
+    "Faint Ashy Marine\0"
+    "Faint Dusty Marine\0"
+    "Faint Soft Marine\0"
+    "Faint Marine\0"
+    "Faint Rich Marine\0"
+    "Faint Vivid Marine\0"
+    "Deep Ashy Indigo\0"
+    "Deep Dusty Indigo\0"
+    "Deep Soft Indigo\0"
+    "Deep Indigo\0"
+    "Deep Rich Indigo\0"
+    "Deep Vivid Indigo\0"
+    "Dark Ashy Indigo\0"
+    "Dark Dusty Indigo\0"
+    "Dark Soft Indigo\0"
+    "Dark Indigo\0"
+    "Dark Rich Indigo\0"
+    "Dark Vivid Indigo\0"
+    "Ashy Indigo\0"
+    "Dusty Indigo\0"
+    "Soft Indigo\0"
+    "Mid Indigo\0"
+    "Rich Indigo\0"
+    "Vivid Indigo\0"
+    "Light Ashy Indigo\0"
+    "Light Dusty Indigo\0"
+    "Light Soft Indigo\0"
+    "Light Indigo\0"
+    "Light Rich Indigo\0"
+    "Light Vivid Indigo\0"
+    "Pale Ashy Indigo\0"
+    "Pale Dusty Indigo\0"
+    "Pale Soft Indigo\0"
+    "Pale Indigo\0"
+    "Pale Rich Indigo\0"
+    "Pale Vivid Indigo\0"
+    "Faint Ashy Indigo\0"
+    "Faint Dusty Indigo\0"
+    "Faint Soft Indigo\0"
+    "Faint Indigo\0"
+    "Faint Rich Indigo\0"
+    "Faint Vivid Indigo\0"
+    "Deep Ashy Violet\0"
+    "Deep Dusty Violet\0"
+    "Deep Soft Violet\0"
+    "Deep Violet\0"
+    "Deep Rich Violet\0"
+    "Deep Vivid Violet\0"
+    "Dark Ashy Violet\0"
+    "Dark Dusty Violet\0"
+    "Dark Soft Violet\0"
+    "Dark Violet\0"
+    "Dark Rich Violet\0"
+    "Dark Vivid Violet\0"
+    "Ashy Violet\0"
+    "Dusty Violet\0"
+    "Soft Violet\0"
+    "Mid Violet\0"
+    "Rich Violet\0"
+    "Vivid Violet\0"
+    "Light Ashy Violet\0"
+    "Light Dusty Violet\0"
+    "Light Soft Violet\0"
+    "Light Violet\0"
+    "Light Rich Violet\0"
+    "Light Vivid Violet\0"
+    "Pale Ashy Violet\0"
+    "Pale Dusty Violet\0"
+    "Pale Soft Violet\0"
+    "Pale Violet\0"
+    "Pale Rich Violet\0"
+    "Pale Vivid Violet\0"
+    "Faint Ashy Violet\0"
+    "Faint Dusty Violet\0"
+    "Faint Soft Violet\0"
+    "Faint Violet\0"
+    "Faint Rich Violet\0"
+    "Faint Vivid Violet\0"
+    "Deep Ashy Purple\0"
+    "Deep Dusty Purple\0"
+    "Deep Soft Purple\0"
+    "Deep Purple\0"
+    "Deep Rich Purple\0"
+    "Deep Vivid Purple\0"
+    "Dark Ashy Purple\0"
+    "Dark Dusty Purple\0"
+    "Dark Soft Purple\0"
+    "Dark Purple\0"
+    "Dark Rich Purple\0"
+    "Dark Vivid Purple\0"
+    "Ashy Purple\0"
+    "Dusty Purple\0"
+    "Soft Purple\0"
+    "Mid Purple\0"
+    "Rich Purple\0"
+    "Vivid Purple\0"
+    "Light Ashy Purple\0"
+    "Light Dusty Purple\0"
+    "Light Soft Purple\0"
+    "Light Purple\0"
+    "Light Rich Purple\0"
+    "Light Vivid Purple\0"
+    "Pale Ashy Purple\0"
+    "Pale Dusty Purple\0"
+    "Pale Soft Purple\0"
+    "Pale Purple\0"
+    "Pale Rich Purple\0"
+    "Pale Vivid Purple\0"
+    "Faint Ashy Purple\0"
+    "Faint Dusty Purple\0"
+    "Faint Soft Purple\0"
+    "Faint Purple\0"
+    "Faint Rich Purple\0"
+    "Faint Vivid Purple\0"
+    "Deep Ashy Amethyst\0"
+    "Deep Dusty Amethyst\0"
+    "Deep Soft Amethyst\0"
+    "Deep Amethyst\0"
+    "Deep Rich Amethyst\0"
+    "Deep Vivid Amethyst\0"
+    "Dark Ashy Amethyst\0"
+    "Dark Dusty Amethyst\0"
+    "Dark Soft Amethyst\0"
+    "Dark Amethyst\0"
+    "Dark Rich Amethyst\0"
+    "Dark Vivid Amethyst\0"
+    "Ashy Amethyst\0"
+    "Dusty Amethyst\0"
+    "Soft Amethyst\0"
+    "Amethyst\0"
+    "Rich Amethyst\0"
+    "Vivid Amethyst\0"
+    "Light Ashy Amethyst\0"
+    "Light Dusty Amethyst\0"
+    "Light Soft Amethyst\0"
+    "Light Amethyst\0"
+    "Light Rich Amethyst\0"
+    "Light Vivid Amethyst\0"
+    "Pale Ashy Amethyst\0"
+    "Pale Dusty Amethyst\0"
+    "Pale Soft Amethyst\0"
+    "Pale Amethyst\0"
+    "Pale Rich Amethyst\0"
+    "Pale Vivid Amethyst\0"
+    "Faint Ashy Amethyst\0"
+    "Faint Dusty Amethyst\0"
+    "Faint Soft Amethyst\0"
+    "Faint Amethyst\0"
+    "Faint Rich Amethyst\0"
+    "Faint Vivid Amethyst\0"
+    "Deep Ashy Mauve\0"
+    "Deep Dusty Mauve\0"
+    "Deep Soft Mauve\0"
+    "Deep Mauve\0"
+    "Deep Rich Mauve\0"
+    "Deep Vivid Mauve\0"
+    "Dark Ashy Mauve\0"
+    "Dark Dusty Mauve\0"
+    "Dark Soft Mauve\0"
+    "Dark Mauve\0"
+    "Dark Rich Mauve\0"
+    "Dark Vivid Mauve\0"
+    "Ashy Mauve\0"
+    "Dusty Mauve\0"
+    "Soft Mauve\0"
+    "Mauve\0"
+    "Rich Mauve\0"
+    "Vivid Mauve\0"
+    "Light Ashy Mauve\0"
+    "Light Dusty Mauve\0"
+    "Light Soft Mauve\0"
+    "Light Mauve\0"
+    "Light Rich Mauve\0"
+    "Light Vivid Mauve\0"
+    "Pale Ashy Mauve\0"
+    "Pale Dusty Mauve\0"
+    "Pale Soft Mauve\0"
+    "Pale Mauve\0"
+    "Pale Rich Mauve\0"
+    "Pale Vivid Mauve\0"
+    "Faint Ashy Mauve\0"
+    "Faint Dusty Mauve\0"
+    "Faint Soft Mauve\0"
+    "Faint Mauve\0"
+    "Faint Rich Mauve\0"
+    "Faint Vivid Mauve\0"
+    "Deep Ashy Orchid\0"
+    "Deep Dusty Orchid\0"
+    "Deep Soft Orchid\0"
+    "Deep Orchid\0"
+    "Deep Rich Orchid\0"
+    "Deep Vivid Orchid\0"
+    "Dark Ashy Orchid\0"
+    "Dark Dusty Orchid\0"
+    "Dark Soft Orchid\0"
+    "Dark Orchid\0"
+    "Dark Rich Orchid\0"
+    "Dark Vivid Orchid\0"
+    "Ashy Orchid\0"
+    "Dusty Orchid\0"
+    "Soft Orchid\0"
+    "Mid Orchid\0"
+    "Rich Orchid\0"
+    "Vivid Orchid\0"
+    "Light Ashy Orchid\0"
+    "Light Dusty Orchid\0"
+    "Light Soft Orchid\0"
+    "Light Orchid\0"
+    "Light Rich Orchid\0"
+    "Light Vivid Orchid\0"
+    "Pale Ashy Orchid\0"
+    "Pale Dusty Orchid\0"
+    "Pale Soft Orchid\0"
+    "Pale Orchid\0"
+    "Pale Rich Orchid\0"
+    "Pale Vivid Orchid\0"
+    "Faint Ashy Orchid\0"
+    "Faint Dusty Orchid\0"
+    "Faint Soft Orchid\0"
+    "Faint Orchid\0"
+    "Faint Rich Orchid\0"
+    "Faint Vivid Orchid\0"
+    "Deep Ashy Fuchsia\0"
+    "Deep Dusty Fuchsia\0"
+    "Deep Soft Fuchsia\0"
+    "Deep Fuchsia\0"
+    "Deep Rich Fuchsia\0"
+    "Deep Vivid Fuchsia\0"
+    "Dark Ashy Fuchsia\0"
+    "Dark Dusty Fuchsia\0"
+    "Dark Soft Fuchsia\0"
+    "Dark Fuchsia\0"
+    "Dark Rich Fuchsia\0"
+    "Dark Vivid Fuchsia\0"
+    "Ashy Fuchsia\0"
+    "Dusty Fuchsia\0"
+    "Soft Fuchsia\0"
+    "Fuchsia\0"
+    "Rich Fuchsia\0"
+    "Vivid Fuchsia\0"
+    "Light Ashy Fuchsia\0"
+    "Light Dusty Fuchsia\0"
+    "Light Soft Fuchsia\0"
+    "Light Fuchsia\0"
+    "Light Rich Fuchsia\0"
+    "Light Vivid Fuchsia\0"
+    "Pale Ashy Fuchsia\0"
+    "Pale Dusty Fuchsia\0"
+    "Pale Soft Fuchsia\0"
+    "Pale Fuchsia\0"
+    "Pale Rich Fuchsia\0"
+    "Pale Vivid Fuchsia\0"
+    "Faint Ashy Fuchsia\0"
+    "Faint Dusty Fuchsia\0"
+    "Faint Soft Fuchsia\0"
+    "Faint Fuchsia\0"
+    "Faint Rich Fuchsia\0"
+    "Faint Vivid Fuchsia\0"
+    "Deep Ashy Rose\0"
+    "Deep Dusty Rose\0"
+    "Deep Soft Rose\0"
+    "Deep Rose\0"
+    "Deep Rich Rose\0"
+    "Deep Vivid Rose\0"
+    "Dark Ashy Rose\0"
+    "Dark Dusty Rose\0"
+    "Dark Soft Rose\0"
+    "Dark Rose\0"
+    "Dark Rich Rose\0"
+    "Dark Vivid Rose\0"
+    "Ashy Rose\0"
+    "Dusty Rose\0"
+    "Soft Rose\0"
+    "Rose\0"
+    "Rich Rose\0"
+    "Vivid Rose\0"
+    "Light Ashy Rose\0"
+    "Light Dusty Rose\0"
+    "Light Soft Rose\0"
+    "Light Rose\0"
+    "Light Rich Rose\0"
+    "Light Vivid Rose\0"
+    "Pale Ashy Rose\0"
+    "Pale Dusty Rose\0"
+    "Pale Soft Rose\0"
+    "Pale Rose\0"
+    "Pale Rich Rose\0"
+    "Pale Vivid Rose\0"
+    "Faint Ashy Rose\0"
+    "Faint Dusty Rose\0"
+    "Faint Soft Rose\0"
+    "Faint Rose\0"
+    "Faint Rich Rose\0"
+    "Faint Vivid Rose\0"
+    "Deep Ashy Crimson\0"
+    "Deep Dusty Crimson\0"
+    "Deep Soft Crimson\0"
+    "Deep Crimson\0"
+    "Deep Rich Crimson\0"
+    "Deep Vivid Crimson\0"
+    "Dark Ashy Crimson\0"
+    "Dark Dusty Crimson\0"
+    "Dark Soft Crimson\0"
+    "Dark Crimson\0"
+    "Dark Rich Crimson\0"
+    "Dark Vivid Crimson\0"
+    "Ashy Crimson\0"
+    "Dusty Crimson\0"
+    "Soft Crimson\0"
+    "Mid Crimson\0"
+    "Rich Crimson\0"
+    "Vivid Crimson\0"
+    "Light Ashy Crimson\0"
+    "Light Dusty Crimson\0"
+    "Light Soft Crimson\0"
+    "Light Crimson\0"
+    "Light Rich Crimson\0"
+    "Light Vivid Crimson\0"
+    "Pale Ashy Crimson\0"
+    "Pale Dusty Crimson\0"
+    "Pale Soft Crimson\0"
+    "Pale Crimson\0"
+    "Pale Rich Crimson\0"
+    "Pale Vivid Crimson\0"
+    "Faint Ashy Crimson\0"
+    "Faint Dusty Crimson\0"
+    "Faint Soft Crimson\0"
+    "Faint Crimson\0"
+    "Faint Rich Crimson\0"
+    "Faint Vivid Crimson\0"
+    ;
+
+// Inner node: axis (0 = L*, 1 = a*, 2 = b*), split value, left
+// child (right child = left + 1). Leaf: LEAF, first item, count.
+struct Node {
+  uint8_t axis;
+  int16_t value;
+  uint16_t index;
+};
+
+static constexpr Node NODES[NODE_COUNT] = {
+    {2, -669, 1},
+    {1, 2297, 3},
+    {1, -17, 5},
+    {0, 4803, 7},
+    {2, -5828, 9},
+    {2, 4489, 11},
+    {0, 5000, 13},
+    {2, -3820, 15},
+    {1, -1567, 17},
+    {1, 6160, 19},
+    {0, 4632, 21},
+    {0, 5043, 23},
+    {1, -4418, 25},
+    {1, 4040, 27},
+    {2, 4078, 29},
+    {0, 2685, 31},
+    {1, -369, 33},
+    {0, 7282, 35},
+    {2, -4046, 37},
+    {0, 3655, 39},
+    {2, -8407, 41},
+    {1, 5298, 43},
+    {1, 6097, 45},
+    {1, -2719, 47},
+    {1, -3891, 49},
+    {0, 6656, 51},
+    {0, 6802, 53},
+    {2, 2710, 55},
+    {2, 2939, 57},
+    {1, 4384, 59},
+    {1, 4144, 61},
+    {0, 1626, 63},
+    {2, -5396, 65},
+    {0, 2670, 67},
+    {0, 2324, 69},
+    {2, -2584, 71},
+    {1, -3499, 73},
+    {1, 365, 75},
+    {0, 7271, 77},
+    {1, 4228, 79},
+    {2, -7879, 81},
+    {LEAF, 45, 0},
+    {0, 4220, 83},
+    {2, -3248, 85},
+    {2, -3248, 87},
+    {2, -3248, 89},
+    {2, -3248, 91},
+    {2, 1910, 93},
+    {2, 1910, 95},
+    {2, 1910, 97},
+    {2, 1910, 99},
+    {0, 5225, 101},
+    {2, 6826, 103},
+    {1, -2218, 105},
+    {2, 7068, 107},
+    {0, 2400, 109},
+    {1, 2012, 111},
+    {1, 6069, 113},
+    {1, 5958, 115},
+    {0, 7600, 117},
+    {2, 1704, 119},
+    {2, 6452, 121},
+    {1, 6225, 123},
+    {LEAF, 30, 45},
+    {2, -4692, 125},
+    {LEAF, 44, 75},
+    {1, 770, 127},
+    {0, 1604, 129},
+    {2, -2244, 131},
+    {2, -2244, 133},
+    {2, -2244, 135},
+    {0, 6042, 137},
+    {1, -2923, 139},
+    {0, 8404, 141},
+    {2, -2471, 143},
+    {0, 6188, 145},
+    {2, -5735, 147},
+    {1, 365, 149},
+    {1, 365, 151},
+    {0, 2307, 153},
+    {2, -7747, 155},
+    {1, 4645, 157},
+    {1, 4228, 159},
+    {2, -7118, 161},
+    {1, 8092, 163},
+    {0, 2388, 165},
+    {0, 2408, 167},
+    {1, 6799, 169},
+    {1, 6590, 171},
+    {1, 4197, 173},
+    {0, 6876, 175},
+    {1, 7997, 177},
+    {1, 7684, 179},
+    {0, 3482, 181},
+    {0, 3266, 183},
+    {0, 2471, 185},
+    {0, 3089, 187},
+    {0, 7276, 189},
+    {0, 7298, 191},
+    {0, 7615, 193},
+    {0, 7576, 195},
+    {LEAF, 27, 119},
+    {1, -5695, 197},
+    {1, -6438, 199},
+    {1, -6618, 201},
+    {0, 5247, 203},
+    {0, 5195, 205},
+    {1, -2218, 207},
+    {1, -2218, 209},
+    {1, 2012, 211},
+    {1, 2012, 213},
+    {0, 3340, 215},
+    {0, 3281, 217},
+    {2, 1135, 219},
+    {2, 1135, 221},
+    {2, 4626, 223},
+    {2, 4743, 225},
+    {2, 1704, 227},
+    {2, 1704, 229},
+    {1, 6584, 231},
+    {1, 6444, 233},
+    {0, 7120, 235},
+    {1, 2064, 237},
+    {2, 5852, 239},
+    {LEAF, 37, 146},
+    {LEAF, 10, 183},
+    {LEAF, 39, 193},
+    {0, 3744, 241},
+    {0, 3744, 243},
+    {2, -1262, 245},
+    {2, -1717, 247},
+    {0, 3736, 249},
+    {1, -1702, 251},
+    {1, 964, 253},
+    {1, 964, 255},
+    {1, 964, 257},
+    {1, 964, 259},
+    {LEAF, 24, 232},
+    {2, -3542, 261},
+    {0, 6080, 263},
+    {0, 6042, 265},
+    {2, -1688, 267},
+    {LEAF, 45, 256},
+    {LEAF, 39, 301},
+    {0, 8521, 269},
+    {2, -5064, 271},
+    {2, -5066, 273},
+    {LEAF, 37, 340},
+    {0, 6175, 275},
+    {2, -2358, 277},
+    {2, -2358, 279},
+    {2, -2358, 281},
+    {2, -2358, 283},
+    {LEAF, 26, 377},
+    {2, -6919, 285},
+    {LEAF, 44, 403},
+    {0, 2269, 287},
+    {LEAF, 22, 447},
+    {LEAF, 36, 469},
+    {0, 5041, 289},
+    {0, 5029, 291},
+    {1, 7259, 293},
+    {1, 7105, 295},
+    {2, -7118, 297},
+    {LEAF, 28, 505},
+    {1, 3798, 299},
+    {1, 3798, 301},
+    {1, 3798, 303},
+    {1, 3798, 305},
+    {0, 3293, 307},
+    {2, -4538, 309},
+    {2, -1958, 311},
+    {2, -1958, 313},
+    {0, 6336, 315},
+    {0, 6328, 317},
+    {1, 4197, 319},
+    {1, 4197, 321},
+    {0, 6087, 323},
+    {2, -4538, 325},
+    {0, 5947, 327},
+    {LEAF, 38, 533},
+    {2, 960, 329},
+    {2, 620, 331},
+    {2, 3008, 333},
+    {1, -4070, 335},
+    {1, -1368, 337},
+    {1, -1368, 339},
+    {1, -1368, 341},
+    {1, -1368, 343},
+    {2, 620, 345},
+    {1, -5291, 347},
+    {1, -5352, 349},
+    {1, -5828, 351},
+    {1, -1954, 353},
+    {1, -1954, 355},
+    {1, -1954, 357},
+    {1, -1954, 359},
+    {2, 5674, 361},
+    {2, 5705, 363},
+    {0, 7935, 365},
+    {0, 8078, 367},
+    {LEAF, 42, 571},
+    {0, 8087, 369},
+    {1, -3318, 371},
+    {2, 5814, 373},
+    {1, -1118, 375},
+    {2, 5887, 377},
+    {0, 8341, 379},
+    {0, 8409, 381},
+    {0, 8347, 383},
+    {0, 8377, 385},
+    {2, 1020, 387},
+    {2, 1020, 389},
+    {2, 1020, 391},
+    {2, 1020, 393},
+    {1, 998, 395},
+    {2, 4304, 397},
+    {1, 3026, 399},
+    {2, 4399, 401},
+    {0, 3274, 403},
+    {0, 3345, 405},
+    {1, 7083, 407},
+    {LEAF, 40, 613},
+    {0, 3403, 409},
+    {LEAF, 47, 653},
+    {LEAF, 30, 700},
+    {LEAF, 20, 730},
+    {1, 2184, 411},
+    {1, 2184, 413},
+    {1, 2112, 415},
+    {1, 1696, 417},
+    {0, 6310, 419},
+    {LEAF, 39, 750},
+    {2, 2891, 421},
+    {LEAF, 40, 789},
+    {1, 2064, 423},
+    {1, 1840, 425},
+    {0, 7309, 427},
+    {LEAF, 35, 829},
+    {0, 6053, 429},
+    {LEAF, 32, 864},
+    {LEAF, 16, 896},
+    {LEAF, 39, 912},
+    {LEAF, 39, 951},
+    {2, -4608, 431},
+    {LEAF, 22, 990},
+    {0, 1071, 433},
+    {LEAF, 40, 1012},
+    {1, -1140, 435},
+    {LEAF, 31, 1052},
+    {2, -3032, 437},
+    {0, 3736, 439},
+    {0, 3736, 441},
+    {0, 1246, 443},
+    {0, 1131, 445},
+    {0, 1085, 447},
+    {0, 1146, 449},
+    {0, 3564, 451},
+    {0, 3564, 453},
+    {0, 3564, 455},
+    {0, 3564, 457},
+    {LEAF, 14, 1083},
+    {LEAF, 29, 1097},
+    {LEAF, 27, 1126},
+    {2, -1626, 459},
+    {2, -1626, 461},
+    {2, -1626, 463},
+    {LEAF, 23, 1153},
+    {LEAF, 27, 1176},
+    {1, -2533, 465},
+    {1, -2533, 467},
+    {LEAF, 18, 1203},
+    {LEAF, 37, 1221},
+    {LEAF, 6, 1258},
+    {LEAF, 39, 1264},
+    {1, 1331, 469},
+    {1, 1331, 471},
+    {0, 6037, 473},
+    {0, 6037, 475},
+    {0, 6037, 477},
+    {0, 6037, 479},
+    {1, -601, 481},
+    {0, 8505, 483},
+    {1, 1331, 485},
+    {0, 8491, 487},
+    {LEAF, 29, 1303},
+    {1, 3262, 489},
+    {LEAF, 40, 1332},
+    {1, 5194, 491},
+    {2, -6854, 493},
+    {LEAF, 47, 1372},
+    {2, -6854, 495},
+    {2, -6854, 497},
+    {LEAF, 40, 1419},
+    {LEAF, 25, 1459},
+    {LEAF, 26, 1484},
+    {LEAF, 16, 1510},
+    {LEAF, 38, 1526},
+    {0, 5306, 499},
+    {2, -4538, 501},
+    {2, -4538, 503},
+    {2, -4538, 505},
+    {2, -4538, 507},
+    {2, -1958, 509},
+    {2, -1958, 511},
+    {2, -1958, 513},
+    {2, -1958, 515},
+    {2, -4538, 517},
+    {2, -4538, 519},
+    {LEAF, 39, 1564},
+    {LEAF, 33, 1603},
+    {0, 3504, 521},
+    {LEAF, 36, 1636},
+    {LEAF, 23, 1672},
+    {LEAF, 16, 1695},
+    {2, -4538, 523},
+    {2, -4538, 525},
+    {2, -4538, 527},
+    {2, -4538, 529},
+    {2, -1958, 531},
+    {2, -1958, 533},
+    {2, -1958, 535},
+    {2, -1958, 537},
+    {2, -4538, 539},
+    {2, -4538, 541},
+    {LEAF, 26, 1711},
+    {LEAF, 19, 1737},
+    {2, -1958, 543},
+    {LEAF, 39, 1756},
+    {LEAF, 28, 1795},
+    {LEAF, 43, 1823},
+    {0, 4262, 545},
+    {1, -3650, 547},
+    {LEAF, 47, 1866},
+    {LEAF, 34, 1913},
+    {2, 3200, 549},
+    {2, 3200, 551},
+    {2, 620, 553},
+    {2, 620, 555},
+    {2, 620, 557},
+    {2, 620, 559},
+    {2, 2971, 561},
+    {2, 3010, 563},
+    {2, 3200, 565},
+    {2, 3200, 567},
+    {0, 6218, 569},
+    {0, 6160, 571},
+    {2, 626, 573},
+    {2, 620, 575},
+    {2, 3200, 577},
+    {2, 3200, 579},
+    {2, 3200, 581},
+    {2, 3200, 583},
+    {2, 620, 585},
+    {2, 620, 587},
+    {2, 620, 589},
+    {2, 620, 591},
+    {2, 3200, 593},
+    {2, 3200, 595},
+    {2, 3200, 597},
+    {2, 3200, 599},
+    {LEAF, 35, 1947},
+    {LEAF, 33, 1982},
+    {0, 5940, 601},
+    {0, 5970, 603},
+    {2, 5658, 605},
+    {2, 5658, 607},
+    {2, 5658, 609},
+    {2, 5658, 611},
+    {LEAF, 45, 2015},
+    {2, 7995, 613},
+    {LEAF, 38, 2060},
+    {0, 4469, 615},
+    {1, -3318, 617},
+    {1, -3318, 619},
+    {LEAF, 46, 2098},
+    {LEAF, 40, 2144},
+    {1, -1118, 621},
+    {1, -1118, 623},
+    {2, 5778, 625},
+    {2, 5778, 627},
+    {2, 5778, 629},
+    {2, 5778, 631},
+    {LEAF, 32, 2184},
+    {LEAF, 48, 2216},
+    {LEAF, 46, 2264},
+    {LEAF, 37, 2310},
+    {0, 1100, 633},
+    {1, 998, 635},
+    {0, 1319, 637},
+    {1, 3026, 639},
+    {0, 3700, 641},
+    {0, 3700, 643},
+    {0, 3700, 645},
+    {0, 3700, 647},
+    {LEAF, 45, 2347},
+    {2, 3593, 649},
+    {1, 998, 651},
+    {1, 998, 653},
+    {2, 3606, 655},
+    {LEAF, 45, 2392},
+    {1, 3026, 657},
+    {1, 3026, 659},
+    {1, 5019, 661},
+    {1, 5054, 663},
+    {1, 5014, 665},
+    {1, 5054, 667},
+    {LEAF, 39, 2437},
+    {LEAF, 19, 2476},
+    {LEAF, 31, 2495},
+    {1, 4999, 669},
+    {0, 6300, 671},
+    {0, 6300, 673},
+    {0, 6300, 675},
+    {0, 6300, 677},
+    {0, 8900, 679},
+    {2, 518, 681},
+    {2, 2891, 683},
+    {2, 2891, 685},
+    {2, 518, 687},
+    {2, 518, 689},
+    {0, 6091, 691},
+    {1, 5414, 693},
+    {2, 5265, 695},
+    {2, 5265, 697},
+    {2, 5265, 699},
+    {LEAF, 48, 2526},
+    {LEAF, 38, 2574},
+    {LEAF, 47, 2612},
+    {LEAF, 48, 2659},
+    {LEAF, 42, 2707},
+    {LEAF, 35, 2749},
+    {LEAF, 45, 2784},
+    {LEAF, 48, 2829},
+    {LEAF, 34, 2877},
+    {LEAF, 42, 2911},
+    {0, 2137, 701},
+    {LEAF, 22, 2953},
+    {LEAF, 40, 2975},
+    {0, 3203, 703},
+    {2, -1456, 705},
+    {2, -1456, 707},
+    {2, -1456, 709},
+    {LEAF, 27, 3015},
+    {2, -3032, 711},
+    {2, -3032, 713},
+    {2, -3032, 715},
+    {2, -1456, 717},
+    {2, -1456, 719},
+    {2, -1456, 721},
+    {2, -1456, 723},
+    {2, -3032, 725},
+    {2, -3032, 727},
+    {2, -3032, 729},
+    {2, -3032, 731},
+    {2, -1456, 733},
+    {2, -1456, 735},
+    {2, -1456, 737},
+    {2, -1456, 739},
+    {LEAF, 38, 3042},
+    {LEAF, 28, 3080},
+    {LEAF, 28, 3108},
+    {1, -2245, 741},
+    {LEAF, 39, 3136},
+    {1, -2245, 743},
+    {2, -1570, 745},
+    {2, -1570, 747},
+    {2, -1570, 749},
+    {2, -1564, 751},
+    {LEAF, 40, 3175},
+    {2, -4890, 753},
+    {LEAF, 37, 3215},
+    {2, -4890, 755},
+    {1, -601, 757},
+    {1, -601, 759},
+    {1, -601, 761},
+    {1, -601, 763},
+    {1, 1331, 765},
+    {1, 1331, 767},
+    {1, 1331, 769},
+    {1, 1331, 771},
+    {LEAF, 44, 3252},
+    {2, -3202, 773},
+    {1, -601, 775},
+    {1, -601, 777},
+    {2, -3202, 779},
+    {2, -3202, 781},
+    {1, 1331, 783},
+    {1, 1331, 785},
+    {LEAF, 22, 3296},
+    {LEAF, 44, 3318},
+    {2, -6788, 787},
+    {2, -6788, 789},
+    {LEAF, 37, 3362},
+    {LEAF, 46, 3399},
+    {LEAF, 41, 3445},
+    {1, 5194, 791},
+    {LEAF, 19, 3486},
+    {LEAF, 41, 3505},
+    {LEAF, 47, 3546},
+    {LEAF, 42, 3593},
+    {0, 1355, 793},
+    {0, 1266, 795},
+    {0, 1467, 797},
+    {0, 1582, 799},
+    {0, 3510, 801},
+    {0, 3510, 803},
+    {0, 3510, 805},
+    {0, 3510, 807},
+    {0, 1296, 809},
+    {0, 1335, 811},
+    {1, 4548, 813},
+    {1, 4457, 815},
+    {0, 3520, 817},
+    {0, 3520, 819},
+    {0, 3520, 821},
+    {0, 3520, 823},
+    {LEAF, 45, 3635},
+    {LEAF, 26, 3680},
+    {LEAF, 44, 3706},
+    {LEAF, 48, 3750},
+    {LEAF, 23, 3798},
+    {LEAF, 30, 3821},
+    {1, 3247, 825},
+    {1, 3247, 827},
+    {1, 3247, 829},
+    {1, 3247, 831},
+    {1, 5147, 833},
+    {1, 5147, 835},
+    {LEAF, 28, 3851},
+    {1, 5147, 837},
+    {0, 5754, 839},
+    {0, 5754, 841},
+    {0, 5754, 843},
+    {0, 5754, 845},
+    {0, 7860, 847},
+    {0, 7998, 849},
+    {1, 5147, 851},
+    {1, 5124, 853},
+    {LEAF, 47, 3879},
+    {LEAF, 47, 3926},
+    {LEAF, 28, 3973},
+    {LEAF, 30, 4001},
+    {LEAF, 44, 4031},
+    {LEAF, 26, 4075},
+    {LEAF, 31, 4101},
+    {LEAF, 33, 4132},
+    {LEAF, 38, 4165},
+    {LEAF, 48, 4203},
+    {0, 4241, 855},
+    {0, 4154, 857},
+    {0, 4154, 859},
+    {0, 4154, 861},
+    {0, 1576, 863},
+    {0, 1555, 865},
+    {0, 1185, 867},
+    {0, 1357, 869},
+    {0, 3757, 871},
+    {0, 3757, 873},
+    {0, 3757, 875},
+    {0, 3757, 877},
+    {0, 2112, 879},
+    {LEAF, 43, 4251},
+    {0, 2122, 881},
+    {LEAF, 39, 4294},
+    {0, 4066, 883},
+    {0, 4066, 885},
+    {0, 4066, 887},
+    {0, 4066, 889},
+    {LEAF, 28, 4333},
+    {LEAF, 38, 4361},
+    {LEAF, 42, 4399},
+    {1, -4844, 891},
+    {LEAF, 23, 4441},
+    {0, 8287, 893},
+    {0, 8378, 895},
+    {0, 8392, 897},
+    {LEAF, 40, 4464},
+    {0, 6170, 899},
+    {0, 6170, 901},
+    {0, 6170, 903},
+    {LEAF, 33, 4504},
+    {LEAF, 43, 4537},
+    {0, 8416, 905},
+    {0, 8426, 907},
+    {0, 6329, 909},
+    {0, 6329, 911},
+    {0, 6329, 913},
+    {0, 6329, 915},
+    {0, 8718, 917},
+    {0, 8725, 919},
+    {0, 8901, 921},
+    {0, 8889, 923},
+    {0, 6310, 925},
+    {0, 6310, 927},
+    {0, 6310, 929},
+    {0, 6310, 931},
+    {0, 8726, 933},
+    {0, 8731, 935},
+    {0, 8843, 937},
+    {0, 8815, 939},
+    {LEAF, 35, 4580},
+    {LEAF, 41, 4615},
+    {LEAF, 24, 4656},
+    {LEAF, 39, 4680},
+    {LEAF, 28, 4719},
+    {LEAF, 24, 4747},
+    {LEAF, 36, 4771},
+    {LEAF, 35, 4807},
+    {1, -5428, 941},
+    {1, -5428, 943},
+    {LEAF, 42, 4842},
+    {1, -5428, 945},
+    {LEAF, 47, 4884},
+    {LEAF, 23, 4931},
+    {LEAF, 18, 4954},
+    {LEAF, 24, 4972},
+    {0, 6024, 947},
+    {0, 6024, 949},
+    {LEAF, 39, 4996},
+    {LEAF, 34, 5035},
+    {LEAF, 42, 5069},
+    {LEAF, 44, 5111},
+    {LEAF, 35, 5155},
+    {LEAF, 29, 5190},
+    {1, -3318, 951},
+    {1, -3318, 953},
+    {1, -3318, 955},
+    {1, -3318, 957},
+    {1, -1118, 959},
+    {1, -1118, 961},
+    {1, -1118, 963},
+    {LEAF, 41, 5219},
+    {1, 998, 965},
+    {1, 998, 967},
+    {0, 1451, 969},
+    {0, 1450, 971},
+    {2, 176, 973},
+    {1, 3026, 975},
+    {LEAF, 45, 5260},
+    {LEAF, 42, 5305},
+    {1, 998, 977},
+    {1, 998, 979},
+    {1, 998, 981},
+    {1, 998, 983},
+    {1, 3026, 985},
+    {1, 3026, 987},
+    {1, 3026, 989},
+    {1, 3026, 991},
+    {LEAF, 42, 5347},
+    {LEAF, 27, 5389},
+    {0, 4170, 993},
+    {0, 4170, 995},
+    {LEAF, 37, 5416},
+    {LEAF, 24, 5453},
+    {LEAF, 42, 5477},
+    {LEAF, 14, 5519},
+    {LEAF, 44, 5533},
+    {0, 4140, 997},
+    {LEAF, 30, 5577},
+    {LEAF, 37, 5607},
+    {LEAF, 46, 5644},
+    {LEAF, 30, 5690},
+    {2, 233, 999},
+    {LEAF, 34, 5720},
+    {LEAF, 35, 5754},
+    {LEAF, 26, 5789},
+    {2, 2037, 1001},
+    {LEAF, 42, 5815},
+    {LEAF, 35, 5857},
+    {LEAF, 34, 5892},
+    {2, 518, 1003},
+    {2, 518, 1005},
+    {2, 518, 1007},
+    {2, 518, 1009},
+    {2, 2891, 1011},
+    {2, 2891, 1013},
+    {2, 2891, 1015},
+    {2, 2891, 1017},
+    {2, 518, 1019},
+    {2, 518, 1021},
+    {1, 3177, 1023},
+    {LEAF, 41, 5926},
+    {0, 8591, 1025},
+    {0, 8505, 1027},
+    {1, 2553, 1029},
+    {LEAF, 29, 5967},
+    {1, 5484, 1031},
+    {1, 5484, 1033},
+    {LEAF, 43, 5996},
+    {LEAF, 34, 6039},
+    {1, 5414, 1035},
+    {LEAF, 30, 6073},
+    {LEAF, 47, 6103},
+    {LEAF, 29, 6150},
+    {0, 6060, 1037},
+    {0, 6060, 1039},
+    {LEAF, 43, 6179},
+    {0, 6060, 1041},
+    {LEAF, 47, 6222},
+    {LEAF, 40, 6269},
+    {LEAF, 43, 6309},
+    {LEAF, 46, 6352},
+    {LEAF, 14, 6398},
+    {LEAF, 38, 6412},
+    {LEAF, 23, 6450},
+    {LEAF, 32, 6473},
+    {1, -1036, 1043},
+    {1, -1036, 1045},
+    {LEAF, 48, 6505},
+    {1, -1036, 1047},
+    {LEAF, 39, 6553},
+    {1, 298, 1049},
+    {LEAF, 30, 6592},
+    {1, 1630, 1051},
+    {1, 1630, 1053},
+    {1, 1630, 1055},
+    {1, 298, 1057},
+    {1, 298, 1059},
+    {1, 298, 1061},
+    {1, 298, 1063},
+    {1, 1630, 1065},
+    {1, 1630, 1067},
+    {1, 1630, 1069},
+    {1, 1630, 1071},
+    {LEAF, 37, 6622},
+    {LEAF, 45, 6659},
+    {LEAF, 35, 6704},
+    {LEAF, 43, 6739},
+    {LEAF, 34, 6782},
+    {1, 1630, 1073},
+    {1, 1630, 1075},
+    {1, 1630, 1077},
+    {1, 298, 1079},
+    {1, 298, 1081},
+    {1, 298, 1083},
+    {1, 298, 1085},
+    {1, 1630, 1087},
+    {1, 1630, 1089},
+    {1, 1630, 1091},
+    {LEAF, 44, 6816},
+    {LEAF, 35, 6860},
+    {LEAF, 43, 6895},
+    {LEAF, 41, 6938},
+    {LEAF, 42, 6979},
+    {LEAF, 42, 7021},
+    {0, 7902, 1093},
+    {LEAF, 30, 7063},
+    {0, 7902, 1095},
+    {LEAF, 33, 7093},
+    {LEAF, 37, 7126},
+    {LEAF, 29, 7163},
+    {LEAF, 45, 7192},
+    {LEAF, 29, 7237},
+    {LEAF, 48, 7266},
+    {LEAF, 14, 7314},
+    {LEAF, 33, 7328},
+    {2, -3202, 1097},
+    {2, -3202, 1099},
+    {2, -3202, 1101},
+    {2, -3202, 1103},
+    {2, -1514, 1105},
+    {2, -1514, 1107},
+    {2, -1514, 1109},
+    {2, -1514, 1111},
+    {2, -3202, 1113},
+    {2, -3202, 1115},
+    {2, -3202, 1117},
+    {2, -3202, 1119},
+    {2, -1514, 1121},
+    {2, -1514, 1123},
+    {2, -1514, 1125},
+    {2, -1514, 1127},
+    {LEAF, 36, 7361},
+    {LEAF, 33, 7397},
+    {2, -1514, 1129},
+    {2, -1514, 1131},
+    {2, -1514, 1133},
+    {2, -1514, 1135},
+    {LEAF, 17, 7430},
+    {LEAF, 31, 7447},
+    {LEAF, 21, 7478},
+    {LEAF, 38, 7499},
+    {2, -1514, 1137},
+    {2, -1514, 1139},
+    {2, -1514, 1141},
+    {2, -1514, 1143},
+    {LEAF, 21, 7537},
+    {LEAF, 35, 7558},
+    {LEAF, 28, 7593},
+    {LEAF, 29, 7621},
+    {0, 4342, 1145},
+    {LEAF, 27, 7650},
+    {LEAF, 41, 7677},
+    {LEAF, 35, 7718},
+    {LEAF, 44, 7753},
+    {1, 3048, 1147},
+    {LEAF, 41, 7797},
+    {LEAF, 37, 7838},
+    {LEAF, 35, 7875},
+    {LEAF, 48, 7910},
+    {LEAF, 40, 7958},
+    {1, 3048, 1149},
+    {1, 3048, 1151},
+    {1, 3048, 1153},
+    {1, 4548, 1155},
+    {1, 4548, 1157},
+    {1, 4548, 1159},
+    {LEAF, 48, 7998},
+    {1, 3048, 1161},
+    {1, 3048, 1163},
+    {1, 3048, 1165},
+    {1, 3048, 1167},
+    {LEAF, 26, 8046},
+    {LEAF, 31, 8072},
+    {LEAF, 36, 8103},
+    {LEAF, 24, 8139},
+    {1, 3048, 1169},
+    {LEAF, 43, 8163},
+    {1, 3048, 1171},
+    {1, 3048, 1173},
+    {1, 4548, 1175},
+    {1, 4548, 1177},
+    {1, 4548, 1179},
+    {LEAF, 34, 8206},
+    {LEAF, 38, 8240},
+    {LEAF, 22, 8278},
+    {0, 5484, 1181},
+    {0, 5484, 1183},
+    {LEAF, 33, 8300},
+    {LEAF, 28, 8333},
+    {0, 7188, 1185},
+    {0, 7180, 1187},
+    {LEAF, 45, 8361},
+    {LEAF, 46, 8406},
+    {0, 5480, 1189},
+    {LEAF, 30, 8452},
+    {LEAF, 36, 8482},
+    {LEAF, 19, 8518},
+    {1, 3247, 1191},
+    {1, 3247, 1193},
+    {1, 3247, 1195},
+    {1, 3247, 1197},
+    {LEAF, 48, 8537},
+    {LEAF, 45, 8585},
+    {LEAF, 35, 8630},
+    {1, 5147, 1199},
+    {1, 3247, 1201},
+    {LEAF, 47, 8665},
+    {1, 3247, 1203},
+    {1, 3153, 1205},
+    {LEAF, 43, 8712},
+    {LEAF, 27, 8755},
+    {LEAF, 37, 8782},
+    {LEAF, 14, 8819},
+    {LEAF, 29, 8833},
+    {LEAF, 27, 8862},
+    {LEAF, 25, 8889},
+    {LEAF, 31, 8914},
+    {1, -3394, 1207},
+    {LEAF, 47, 8945},
+    {1, -3394, 1209},
+    {1, -3394, 1211},
+    {2, 162, 1213},
+    {2, -24, 1215},
+    {2, 1265, 1217},
+    {1, -2044, 1219},
+    {1, -692, 1221},
+    {1, -692, 1223},
+    {1, -692, 1225},
+    {1, -692, 1227},
+    {1, -2044, 1229},
+    {1, -2044, 1231},
+    {1, -2044, 1233},
+    {1, -2044, 1235},
+    {1, -692, 1237},
+    {1, -692, 1239},
+    {1, -692, 1241},
+    {1, -692, 1243},
+    {1, -2044, 1245},
+    {1, -2044, 1247},
+    {1, -692, 1249},
+    {1, -692, 1251},
+    {1, -2044, 1253},
+    {1, -2044, 1255},
+    {1, -2044, 1257},
+    {1, -2044, 1259},
+    {1, -692, 1261},
+    {1, -692, 1263},
+    {1, -692, 1265},
+    {LEAF, 42, 8992},
+    {LEAF, 36, 9034},
+    {LEAF, 34, 9070},
+    {LEAF, 31, 9104},
+    {LEAF, 21, 9135},
+    {LEAF, 38, 9156},
+    {LEAF, 38, 9194},
+    {1, -4591, 1267},
+    {LEAF, 38, 9232},
+    {LEAF, 39, 9270},
+    {LEAF, 26, 9309},
+    {LEAF, 47, 9335},
+    {LEAF, 43, 9382},
+    {1, -4622, 1269},
+    {1, -4622, 1271},
+    {1, -4860, 1273},
+    {1, -4860, 1275},
+    {1, -4860, 1277},
+    {LEAF, 37, 9425},
+    {1, -2922, 1279},
+    {1, -2922, 1281},
+    {1, -2922, 1283},
+    {1, -2922, 1285},
+    {1, -986, 1287},
+    {1, -986, 1289},
+    {1, -986, 1291},
+    {1, -986, 1293},
+    {1, -2922, 1295},
+    {1, -2922, 1297},
+    {1, -2922, 1299},
+    {1, -2922, 1301},
+    {1, -986, 1303},
+    {1, -986, 1305},
+    {1, -986, 1307},
+    {1, -986, 1309},
+    {1, -2922, 1311},
+    {1, -2922, 1313},
+    {1, -2922, 1315},
+    {1, -2922, 1317},
+    {1, -986, 1319},
+    {1, -986, 1321},
+    {1, -986, 1323},
+    {1, -986, 1325},
+    {1, -2922, 1327},
+    {1, -2922, 1329},
+    {1, -2922, 1331},
+    {1, -2922, 1333},
+    {1, -986, 1335},
+    {1, -986, 1337},
+    {1, -986, 1339},
+    {1, -986, 1341},
+    {LEAF, 48, 9462},
+    {LEAF, 44, 9510},
+    {LEAF, 35, 9554},
+    {LEAF, 36, 9589},
+    {LEAF, 28, 9625},
+    {LEAF, 30, 9653},
+    {LEAF, 37, 9683},
+    {LEAF, 39, 9720},
+    {LEAF, 20, 9759},
+    {LEAF, 42, 9779},
+    {0, 7572, 1343},
+    {LEAF, 34, 9821},
+    {LEAF, 26, 9855},
+    {LEAF, 41, 9881},
+    {LEAF, 29, 9922},
+    {LEAF, 37, 9951},
+    {LEAF, 24, 9988},
+    {LEAF, 25, 10012},
+    {LEAF, 36, 10037},
+    {0, 7606, 1345},
+    {LEAF, 44, 10073},
+    {LEAF, 23, 10117},
+    {LEAF, 35, 10140},
+    {LEAF, 26, 10175},
+    {2, 176, 1347},
+    {2, 176, 1349},
+    {2, 176, 1351},
+    {2, 176, 1353},
+    {2, 1659, 1355},
+    {2, 1865, 1357},
+    {LEAF, 47, 10201},
+    {2, 1865, 1359},
+    {1, 2822, 1361},
+    {1, 2838, 1363},
+    {2, 176, 1365},
+    {2, 176, 1367},
+    {2, 176, 1369},
+    {2, 176, 1371},
+    {2, 176, 1373},
+    {2, 176, 1375},
+    {2, 1865, 1377},
+    {2, 1865, 1379},
+    {2, 1865, 1381},
+    {2, 1865, 1383},
+    {2, 176, 1385},
+    {2, 176, 1387},
+    {2, 176, 1389},
+    {2, 176, 1391},
+    {2, 1865, 1393},
+    {2, 1865, 1395},
+    {2, 1865, 1397},
+    {2, 1865, 1399},
+    {LEAF, 39, 10248},
+    {LEAF, 42, 10287},
+    {LEAF, 32, 10329},
+    {LEAF, 34, 10361},
+    {LEAF, 39, 10395},
+    {LEAF, 26, 10434},
+    {LEAF, 29, 10460},
+    {LEAF, 41, 10489},
+    {LEAF, 45, 10530},
+    {LEAF, 41, 10575},
+    {1, 1084, 1401},
+    {1, 1084, 1403},
+    {1, 1084, 1405},
+    {1, 1084, 1407},
+    {1, 3284, 1409},
+    {1, 3284, 1411},
+    {1, 3284, 1413},
+    {1, 3284, 1415},
+    {1, 1084, 1417},
+    {1, 1084, 1419},
+    {1, 1084, 1421},
+    {1, 1084, 1423},
+    {1, 3284, 1425},
+    {1, 3284, 1427},
+    {1, 3284, 1429},
+    {LEAF, 45, 10616},
+    {1, 1048, 1431},
+    {1, 1048, 1433},
+    {1, 948, 1435},
+    {1, 787, 1437},
+    {0, 8265, 1439},
+    {LEAF, 24, 10661},
+    {1, 840, 1441},
+    {1, 800, 1443},
+    {LEAF, 45, 10685},
+    {1, 679, 1445},
+    {LEAF, 31, 10730},
+    {LEAF, 23, 10761},
+    {LEAF, 32, 10784},
+    {LEAF, 27, 10816},
+    {LEAF, 33, 10843},
+    {LEAF, 28, 10876},
+    {LEAF, 22, 10904},
+    {LEAF, 25, 10926},
+    {1, 1024, 1447},
+    {1, 1024, 1449},
+    {LEAF, 32, 10951},
+    {LEAF, 44, 10983},
+    {LEAF, 35, 11027},
+    {LEAF, 34, 11062},
+    {LEAF, 37, 11096},
+    {LEAF, 29, 11133},
+    {LEAF, 38, 11162},
+    {LEAF, 34, 11200},
+    {LEAF, 39, 11234},
+    {LEAF, 37, 11273},
+    {LEAF, 22, 11310},
+    {LEAF, 37, 11332},
+    {LEAF, 28, 11369},
+    {LEAF, 31, 11397},
+    {LEAF, 32, 11428},
+    {LEAF, 43, 11460},
+    {LEAF, 45, 11503},
+    {0, 1728, 1451},
+    {LEAF, 36, 11548},
+    {LEAF, 46, 11584},
+    {0, 514, 1453},
+    {0, 465, 1455},
+    {LEAF, 39, 11630},
+    {0, 1704, 1457},
+    {0, 1704, 1459},
+    {0, 1704, 1461},
+    {LEAF, 47, 11669},
+    {LEAF, 34, 11716},
+    {0, 561, 1463},
+    {LEAF, 46, 11750},
+    {0, 1735, 1465},
+    {0, 1735, 1467},
+    {0, 1735, 1469},
+    {0, 1735, 1471},
+    {0, 2944, 1473},
+    {0, 2944, 1475},
+    {LEAF, 40, 11796},
+    {LEAF, 25, 11836},
+    {LEAF, 48, 11861},
+    {0, 4184, 1477},
+    {LEAF, 41, 11909},
+    {0, 2944, 1479},
+    {0, 2944, 1481},
+    {0, 2944, 1483},
+    {LEAF, 47, 11950},
+    {LEAF, 43, 11997},
+    {LEAF, 27, 12040},
+    {0, 4184, 1485},
+    {0, 2944, 1487},
+    {0, 2944, 1489},
+    {LEAF, 42, 12067},
+    {0, 2944, 1491},
+    {LEAF, 39, 12109},
+    {LEAF, 45, 12148},
+    {LEAF, 23, 12193},
+    {LEAF, 23, 12216},
+    {LEAF, 41, 12239},
+    {LEAF, 42, 12280},
+    {LEAF, 34, 12322},
+    {LEAF, 37, 12356},
+    {LEAF, 26, 12393},
+    {LEAF, 25, 12419},
+    {LEAF, 33, 12444},
+    {0, 6654, 1493},
+    {LEAF, 28, 12477},
+    {LEAF, 42, 12505},
+    {0, 5420, 1495},
+    {0, 5420, 1497},
+    {0, 5420, 1499},
+    {LEAF, 32, 12547},
+    {0, 6654, 1501},
+    {0, 6654, 1503},
+    {0, 6654, 1505},
+    {0, 6654, 1507},
+    {LEAF, 32, 12579},
+    {LEAF, 40, 12611},
+    {LEAF, 38, 12651},
+    {0, 5420, 1509},
+    {LEAF, 33, 12689},
+    {LEAF, 48, 12722},
+    {LEAF, 38, 12770},
+    {0, 6654, 1511},
+    {LEAF, 39, 12808},
+    {0, 5420, 1513},
+    {LEAF, 46, 12847},
+    {LEAF, 29, 12893},
+    {0, 6654, 1515},
+    {0, 6654, 1517},
+    {LEAF, 42, 12922},
+    {0, 6654, 1519},
+    {0, 7888, 1521},
+    {0, 7888, 1523},
+    {0, 7888, 1525},
+    {0, 7888, 1527},
+    {LEAF, 32, 12964},
+    {0, 9122, 1529},
+    {LEAF, 43, 12996},
+    {0, 9122, 1531},
+    {0, 7881, 1533},
+    {0, 7881, 1535},
+    {0, 7881, 1537},
+    {0, 7881, 1539},
+    {1, 848, 1541},
+    {0, 9101, 1543},
+    {LEAF, 43, 13039},
+    {0, 8982, 1545},
+    {LEAF, 44, 13082},
+    {LEAF, 29, 13126},
+    {LEAF, 44, 13155},
+    {2, -3893, 1547},
+    {LEAF, 42, 13199},
+    {LEAF, 25, 13241},
+    {LEAF, 32, 13266},
+    {2, -3893, 1549},
+    {2, -3893, 1551},
+    {2, -3893, 1553},
+    {LEAF, 36, 13298},
+    {2, -5183, 1555},
+    {LEAF, 24, 13334},
+    {2, -5183, 1557},
+    {2, -3893, 1559},
+    {LEAF, 36, 13358},
+    {LEAF, 38, 13394},
+    {LEAF, 27, 13432},
+    {2, -2603, 1561},
+    {2, -2603, 1563},
+    {2, -1314, 1565},
+    {LEAF, 24, 13459},
+    {2, -1314, 1567},
+    {LEAF, 41, 13483},
+    {2, -2603, 1569},
+    {LEAF, 43, 13524},
+    {2, -1314, 1571},
+    {2, -1314, 1573},
+    {2, -1314, 1575},
+    {LEAF, 29, 13567},
+    {LEAF, 34, 13596},
+    {LEAF, 31, 13630},
+    {LEAF, 32, 13661},
+    {LEAF, 25, 13693},
+    {LEAF, 35, 13718},
+    {LEAF, 25, 13753},
+    {LEAF, 35, 13778},
+    {LEAF, 45, 13813},
+    {2, -3893, 1577},
+    {LEAF, 37, 13858},
+    {LEAF, 46, 13895},
+    {LEAF, 19, 13941},
+    {LEAF, 36, 13960},
+    {LEAF, 30, 13996},
+    {LEAF, 33, 14026},
+    {LEAF, 25, 14059},
+    {LEAF, 41, 14084},
+    {LEAF, 24, 14125},
+    {2, -2603, 1579},
+    {LEAF, 41, 14149},
+    {2, -1314, 1581},
+    {LEAF, 29, 14190},
+    {2, -1314, 1583},
+    {LEAF, 45, 14219},
+    {LEAF, 24, 14264},
+    {LEAF, 16, 14288},
+    {2, -2603, 1585},
+    {LEAF, 35, 14304},
+    {2, -1314, 1587},
+    {LEAF, 42, 14339},
+    {LEAF, 44, 14381},
+    {LEAF, 20, 14425},
+    {LEAF, 37, 14445},
+    {LEAF, 44, 14482},
+    {LEAF, 36, 14526},
+    {2, 3844, 1589},
+    {LEAF, 38, 14562},
+    {LEAF, 40, 14600},
+    {LEAF, 34, 14640},
+    {0, 1129, 1591},
+    {LEAF, 42, 14674},
+    {1, -1941, 1593},
+    {1, -1893, 1595},
+    {1, -1988, 1597},
+    {LEAF, 38, 14716},
+    {2, 1265, 1599},
+    {2, -24, 1601},
+    {2, -24, 1603},
+    {2, -24, 1605},
+    {2, -24, 1607},
+    {2, 1265, 1609},
+    {2, 1265, 1611},
+    {2, 1265, 1613},
+    {2, 1265, 1615},
+    {2, -24, 1617},
+    {2, -24, 1619},
+    {2, -24, 1621},
+    {2, -24, 1623},
+    {2, 1265, 1625},
+    {2, 1265, 1627},
+    {2, 1265, 1629},
+    {LEAF, 48, 14754},
+    {2, -24, 1631},
+    {2, -24, 1633},
+    {2, -24, 1635},
+    {2, -24, 1637},
+    {2, 1265, 1639},
+    {2, 1265, 1641},
+    {2, 1265, 1643},
+    {2, 1265, 1645},
+    {LEAF, 34, 14802},
+    {2, 2440, 1647},
+    {LEAF, 45, 14836},
+    {2, 2440, 1649},
+    {LEAF, 43, 14881},
+    {LEAF, 45, 14924},
+    {2, 2460, 1651},
+    {LEAF, 44, 14969},
+    {2, 2555, 1653},
+    {2, 2555, 1655},
+    {2, 2555, 1657},
+    {2, 2555, 1659},
+    {2, 3844, 1661},
+    {LEAF, 38, 15013},
+    {LEAF, 42, 15051},
+    {LEAF, 42, 15093},
+    {LEAF, 48, 15135},
+    {LEAF, 46, 15183},
+    {2, 2555, 1663},
+    {2, 2555, 1665},
+    {LEAF, 30, 15229},
+    {LEAF, 39, 15259},
+    {LEAF, 37, 15298},
+    {LEAF, 41, 15335},
+    {LEAF, 35, 15376},
+    {LEAF, 43, 15411},
+    {LEAF, 33, 15454},
+    {2, 3844, 1667},
+    {LEAF, 40, 15487},
+    {2, 2555, 1669},
+    {LEAF, 19, 15527},
+    {LEAF, 48, 15546},
+    {LEAF, 37, 15594},
+    {LEAF, 43, 15631},
+    {LEAF, 31, 15674},
+    {2, -24, 1671},
+    {LEAF, 48, 15705},
+    {2, -24, 1673},
+    {LEAF, 42, 15753},
+    {2, 1265, 1675},
+    {2, 1265, 1677},
+    {2, 1265, 1679},
+    {2, -24, 1681},
+    {2, -24, 1683},
+    {2, -24, 1685},
+    {2, -24, 1687},
+    {2, 1265, 1689},
+    {2, 1265, 1691},
+    {2, 1265, 1693},
+    {2, 1265, 1695},
+    {LEAF, 48, 15795},
+    {2, -24, 1697},
+    {LEAF, 46, 15843},
+    {LEAF, 39, 15889},
+    {2, 1265, 1699},
+    {2, 1265, 1701},
+    {LEAF, 39, 15928},
+    {2, 1265, 1703},
+    {2, -24, 1705},
+    {2, -24, 1707},
+    {2, -24, 1709},
+    {2, -24, 1711},
+    {2, 1265, 1713},
+    {2, 1265, 1715},
+    {2, 1265, 1717},
+    {2, 1265, 1719},
+    {2, 2555, 1721},
+    {2, 2555, 1723},
+    {2, 2555, 1725},
+    {2, 2555, 1727},
+    {2, 3844, 1729},
+    {2, 3844, 1731},
+    {2, 3844, 1733},
+    {2, 3844, 1735},
+    {2, 2555, 1737},
+    {2, 2555, 1739},
+    {2, 2555, 1741},
+    {2, 2555, 1743},
+    {2, 3844, 1745},
+    {LEAF, 42, 15967},
+    {LEAF, 35, 16009},
+    {LEAF, 39, 16044},
+    {2, 2555, 1747},
+    {2, 2555, 1749},
+    {LEAF, 27, 16083},
+    {LEAF, 48, 16110},
+    {2, 3844, 1751},
+    {2, 3844, 1753},
+    {LEAF, 35, 16158},
+    {LEAF, 35, 16193},
+    {2, 2555, 1755},
+    {2, 2555, 1757},
+    {2, 2555, 1759},
+    {2, 2555, 1761},
+    {2, 3844, 1763},
+    {2, 3844, 1765},
+    {LEAF, 38, 16228},
+    {LEAF, 38, 16266},
+    {LEAF, 24, 16304},
+    {LEAF, 38, 16328},
+    {LEAF, 24, 16366},
+    {LEAF, 26, 16390},
+    {0, 450, 1767},
+    {0, 517, 1769},
+    {0, 559, 1771},
+    {0, 575, 1773},
+    {0, 1750, 1775},
+    {0, 1750, 1777},
+    {0, 1750, 1779},
+    {0, 1750, 1781},
+    {1, 490, 1783},
+    {LEAF, 28, 16416},
+    {1, 490, 1785},
+    {LEAF, 21, 16444},
+    {1, 1505, 1787},
+    {LEAF, 21, 16465},
+    {LEAF, 39, 16486},
+    {LEAF, 20, 16525},
+    {LEAF, 23, 16545},
+    {LEAF, 19, 16568},
+    {0, 1860, 1789},
+    {0, 1860, 1791},
+    {LEAF, 41, 16587},
+    {LEAF, 35, 16628},
+    {0, 3050, 1793},
+    {0, 3050, 1795},
+    {0, 3050, 1797},
+    {0, 3050, 1799},
+    {0, 4350, 1801},
+    {LEAF, 48, 16663},
+    {0, 4350, 1803},
+    {LEAF, 46, 16711},
+    {0, 3050, 1805},
+    {0, 3050, 1807},
+    {0, 3050, 1809},
+    {LEAF, 19, 16757},
+    {LEAF, 42, 16776},
+    {LEAF, 34, 16818},
+    {LEAF, 39, 16852},
+    {LEAF, 29, 16891},
+    {0, 3050, 1811},
+    {0, 3050, 1813},
+    {LEAF, 46, 16920},
+    {0, 3050, 1815},
+    {0, 4350, 1817},
+    {LEAF, 44, 16966},
+    {LEAF, 44, 17010},
+    {0, 4350, 1819},
+    {0, 3050, 1821},
+    {LEAF, 39, 17054},
+    {LEAF, 46, 17093},
+    {LEAF, 42, 17139},
+    {LEAF, 36, 17181},
+    {LEAF, 36, 17217},
+    {0, 4350, 1823},
+    {LEAF, 34, 17253},
+    {0, 5650, 1825},
+    {0, 5650, 1827},
+    {LEAF, 47, 17287},
+    {0, 5650, 1829},
+    {0, 6950, 1831},
+    {0, 6950, 1833},
+    {0, 6950, 1835},
+    {0, 6950, 1837},
+    {0, 5650, 1839},
+    {0, 5650, 1841},
+    {LEAF, 36, 17334},
+    {0, 5650, 1843},
+    {0, 6950, 1845},
+    {0, 6950, 1847},
+    {LEAF, 41, 17370},
+    {LEAF, 45, 17411},
+    {0, 5650, 1849},
+    {LEAF, 41, 17456},
+    {0, 5650, 1851},
+    {LEAF, 38, 17497},
+    {0, 6950, 1853},
+    {0, 6950, 1855},
+    {0, 6950, 1857},
+    {LEAF, 42, 17535},
+    {LEAF, 45, 17577},
+    {LEAF, 40, 17622},
+    {LEAF, 42, 17662},
+    {LEAF, 44, 17704},
+    {LEAF, 20, 17748},
+    {LEAF, 31, 17768},
+    {0, 8250, 1859},
+    {0, 8250, 1861},
+    {0, 8250, 1863},
+    {0, 8250, 1865},
+    {0, 9550, 1867},
+    {2, -76, 1869},
+    {2, 1111, 1871},
+    {2, 1111, 1873},
+    {LEAF, 45, 17799},
+    {LEAF, 39, 17844},
+    {2, 2298, 1875},
+    {LEAF, 43, 17883},
+    {LEAF, 43, 17926},
+    {LEAF, 18, 17969},
+    {LEAF, 37, 17987},
+    {LEAF, 28, 18024},
+    {LEAF, 32, 18052},
+    {LEAF, 20, 18084},
+    {LEAF, 35, 18104},
+    {LEAF, 29, 18139},
+    {LEAF, 44, 18168},
+    {LEAF, 34, 18212},
+    {2, -1062, 1877},
+    {LEAF, 38, 18246},
+    {2, -1062, 1879},
+    {LEAF, 44, 18284},
+    {LEAF, 36, 18328},
+    {LEAF, 48, 18364},
+    {LEAF, 25, 18412},
+    {2, -1062, 1881},
+    {LEAF, 43, 18437},
+    {2, -1062, 1883},
+    {LEAF, 46, 18480},
+    {LEAF, 35, 18526},
+    {2, -1850, 1885},
+    {2, -1850, 1887},
+    {LEAF, 27, 18561},
+    {LEAF, 35, 18588},
+    {LEAF, 26, 18623},
+    {2, -1062, 1889},
+    {LEAF, 18, 18649},
+    {2, -1062, 1891},
+    {LEAF, 12, 18667},
+    {LEAF, 30, 18679},
+    {LEAF, 19, 18709},
+    {LEAF, 26, 18728},
+    {LEAF, 26, 18754},
+    {LEAF, 31, 18780},
+    {LEAF, 23, 18811},
+    {LEAF, 32, 18834},
+    {LEAF, 28, 18866},
+    {LEAF, 36, 18894},
+    {LEAF, 14, 18930},
+    {LEAF, 35, 18944},
+    {LEAF, 33, 18979},
+    {LEAF, 35, 19012},
+    {2, -1850, 1893},
+    {LEAF, 37, 19047},
+    {LEAF, 12, 19084},
+    {LEAF, 34, 19096},
+    {LEAF, 21, 19130},
+    {LEAF, 38, 19151},
+    {LEAF, 19, 19189},
+    {LEAF, 25, 19208},
+    {LEAF, 32, 19233},
+    {LEAF, 21, 19265},
+    {LEAF, 31, 19286},
+    {LEAF, 37, 19317},
+    {LEAF, 39, 19354},
+    {LEAF, 30, 19393},
+    {LEAF, 33, 19423},
+    {LEAF, 30, 19456},
+    {LEAF, 31, 19486},
+    {LEAF, 45, 19517},
+    {LEAF, 42, 19562},
+    {LEAF, 35, 19604},
+    {LEAF, 46, 19639},
+    {LEAF, 40, 19685},
+    {LEAF, 40, 19725},
+    {LEAF, 42, 19765},
+    {1, 1814, 1895},
+    {LEAF, 43, 19807},
+    {LEAF, 38, 19850},
+    {1, 848, 1897},
+    {LEAF, 35, 19888},
+    {LEAF, 38, 19923},
+    {1, 848, 1899},
+    {LEAF, 25, 19961},
+    {LEAF, 40, 19986},
+    {1, 1814, 1901},
+    {LEAF, 34, 20026},
+    {LEAF, 44, 20060},
+    {LEAF, 38, 20104},
+    {LEAF, 44, 20142},
+    {1, -118, 1903},
+    {LEAF, 31, 20186},
+    {1, -118, 1905},
+    {1, -118, 1907},
+    {LEAF, 40, 20217},
+    {1, -1084, 1909},
+    {1, -118, 1911},
+    {1, -118, 1913},
+    {LEAF, 47, 20257},
+    {LEAF, 29, 20304},
+    {1, 848, 1915},
+    {1, 848, 1917},
+    {1, 1814, 1919},
+    {LEAF, 38, 20333},
+    {1, 1814, 1921},
+    {LEAF, 34, 20371},
+    {LEAF, 44, 20405},
+    {LEAF, 41, 20449},
+    {1, 848, 1923},
+    {1, 848, 1925},
+    {LEAF, 41, 20490},
+    {1, 1795, 1927},
+    {LEAF, 31, 20531},
+    {LEAF, 40, 20562},
+    {LEAF, 36, 20602},
+    {LEAF, 42, 20638},
+    {LEAF, 38, 20680},
+    {LEAF, 25, 20718},
+    {0, 4071, 1929},
+    {LEAF, 35, 20743},
+    {LEAF, 28, 20778},
+    {LEAF, 31, 20806},
+    {LEAF, 46, 20837},
+    {LEAF, 35, 20883},
+    {LEAF, 27, 20918},
+    {LEAF, 27, 20945},
+    {0, 1852, 1931},
+    {0, 1852, 1933},
+    {LEAF, 42, 20972},
+    {LEAF, 29, 21014},
+    {LEAF, 37, 21043},
+    {LEAF, 27, 21080},
+    {LEAF, 46, 21107},
+    {LEAF, 48, 21153},
+    {LEAF, 29, 21201},
+    {LEAF, 36, 21230},
+    {LEAF, 20, 21266},
+    {LEAF, 32, 21286},
+    {LEAF, 24, 21318},
+    {LEAF, 20, 21342},
+    {LEAF, 34, 21362},
+    {LEAF, 26, 21396},
+    {LEAF, 30, 21422},
+    {LEAF, 29, 21452},
+    {LEAF, 29, 21481},
+    {0, 6315, 1935},
+    {LEAF, 44, 21510},
+    {LEAF, 31, 21554},
+    {0, 6315, 1937},
+    {0, 6315, 1939},
+    {LEAF, 33, 21585},
+    {LEAF, 40, 21618},
+    {0, 7437, 1941},
+    {0, 7437, 1943},
+    {LEAF, 23, 21658},
+    {LEAF, 26, 21681},
+    {LEAF, 28, 21707},
+    {LEAF, 31, 21735},
+    {LEAF, 29, 21766},
+    {LEAF, 32, 21795},
+    {LEAF, 30, 21827},
+    {LEAF, 40, 21857},
+    {LEAF, 30, 21897},
+    {LEAF, 43, 21927},
+    {LEAF, 32, 21970},
+    {LEAF, 35, 22002},
+    {0, 838, 1945},
+    {0, 723, 1947},
+    {0, 546, 1949},
+    {0, 542, 1951},
+    {0, 1828, 1953},
+    {0, 1828, 1955},
+    {0, 1828, 1957},
+    {0, 1828, 1959},
+    {0, 804, 1961},
+    {LEAF, 40, 22037},
+    {0, 800, 1963},
+    {LEAF, 48, 22077},
+    {0, 1914, 1965},
+    {LEAF, 39, 22125},
+    {0, 1914, 1967},
+    {LEAF, 37, 22164},
+    {LEAF, 43, 22201},
+    {LEAF, 37, 22244},
+    {0, 3114, 1969},
+    {0, 3114, 1971},
+    {LEAF, 29, 22281},
+    {LEAF, 46, 22310},
+    {0, 4400, 1973},
+    {LEAF, 46, 22356},
+    {0, 3114, 1975},
+    {LEAF, 44, 22402},
+    {0, 3114, 1977},
+    {0, 3114, 1979},
+    {0, 4400, 1981},
+    {0, 4400, 1983},
+    {LEAF, 39, 22446},
+    {0, 3114, 1985},
+    {LEAF, 48, 22485},
+    {0, 3114, 1987},
+    {LEAF, 37, 22533},
+    {LEAF, 48, 22570},
+    {LEAF, 41, 22618},
+    {LEAF, 47, 22659},
+    {LEAF, 43, 22706},
+    {0, 3114, 1989},
+    {0, 3114, 1991},
+    {0, 3114, 1993},
+    {0, 4400, 1995},
+    {LEAF, 30, 22749},
+    {0, 4400, 1997},
+    {LEAF, 35, 22779},
+    {LEAF, 28, 22814},
+    {LEAF, 16, 22842},
+    {LEAF, 41, 22858},
+    {LEAF, 24, 22899},
+    {LEAF, 33, 22923},
+    {LEAF, 21, 22956},
+    {LEAF, 28, 22977},
+    {LEAF, 45, 23005},
+    {LEAF, 16, 23050},
+    {LEAF, 39, 23066},
+    {0, 4554, 1999},
+    {LEAF, 26, 23105},
+    {LEAF, 47, 23131},
+    {LEAF, 16, 23178},
+    {LEAF, 34, 23194},
+    {LEAF, 34, 23228},
+    {LEAF, 37, 23262},
+    {LEAF, 33, 23299},
+    {LEAF, 32, 23332},
+    {LEAF, 18, 23364},
+    {LEAF, 36, 23382},
+    {LEAF, 35, 23418},
+    {LEAF, 33, 23453},
+    {LEAF, 38, 23486},
+    {LEAF, 41, 23524},
+    {0, 5686, 2001},
+    {0, 6972, 2003},
+    {LEAF, 44, 23565},
+    {0, 5686, 2005},
+    {0, 5686, 2007},
+    {0, 6972, 2009},
+    {LEAF, 38, 23609},
+    {0, 6972, 2011},
+    {LEAF, 30, 23647},
+    {0, 5686, 2013},
+    {0, 5686, 2015},
+    {0, 5686, 2017},
+    {0, 5686, 2019},
+    {0, 6972, 2021},
+    {0, 6972, 2023},
+    {0, 6972, 2025},
+    {0, 6972, 2027},
+    {0, 5686, 2029},
+    {LEAF, 43, 23677},
+    {0, 5686, 2031},
+    {0, 5686, 2033},
+    {0, 6972, 2035},
+    {0, 6972, 2037},
+    {0, 6972, 2039},
+    {0, 6972, 2041},
+    {LEAF, 44, 23720},
+    {LEAF, 48, 23764},
+    {LEAF, 44, 23812},
+    {LEAF, 31, 23856},
+    {0, 8170, 2043},
+    {0, 8170, 2045},
+    {LEAF, 33, 23887},
+    {LEAF, 37, 23920},
+    {0, 8258, 2047},
+    {0, 8258, 2049},
+    {0, 8258, 2051},
+    {0, 8258, 2053},
+    {0, 9441, 2055},
+    {0, 9451, 2057},
+    {0, 9532, 2059},
+    {0, 9544, 2061},
+    {0, 8252, 2063},
+    {0, 8252, 2065},
+    {0, 8252, 2067},
+    {0, 8252, 2069},
+    {0, 9450, 2071},
+    {0, 9463, 2073},
+    {0, 9526, 2075},
+    {0, 9510, 2077},
+    {LEAF, 47, 23957},
+    {LEAF, 45, 24004},
+    {0, 5676, 2079},
+    {LEAF, 31, 24049},
+    {LEAF, 27, 24080},
+    {LEAF, 25, 24107},
+    {LEAF, 35, 24132},
+    {LEAF, 29, 24167},
+    {0, 5676, 2081},
+    {LEAF, 28, 24196},
+    {LEAF, 38, 24224},
+    {LEAF, 38, 24262},
+    {LEAF, 38, 24300},
+    {LEAF, 48, 24338},
+    {LEAF, 23, 24386},
+    {LEAF, 40, 24409},
+    {0, 5676, 2083},
+    {LEAF, 30, 24449},
+    {0, 5676, 2085},
+    {LEAF, 41, 24479},
+    {0, 6943, 2087},
+    {LEAF, 29, 24520},
+    {0, 6943, 2089},
+    {LEAF, 29, 24549},
+    {LEAF, 24, 24578},
+    {LEAF, 41, 24602},
+    {LEAF, 26, 24643},
+    {LEAF, 24, 24669},
+    {0, 8151, 2091},
+    {LEAF, 38, 24693},
+    {LEAF, 34, 24731},
+    {LEAF, 26, 24765},
+    {LEAF, 27, 24791},
+    {LEAF, 37, 24818},
+    {0, 8210, 2093},
+    {0, 8210, 2095},
+    {0, 8210, 2097},
+    {LEAF, 43, 24855},
+    {LEAF, 42, 24898},
+    {LEAF, 31, 24940},
+    {0, 9476, 2099},
+    {LEAF, 33, 24971},
+    {LEAF, 29, 25004},
+    {LEAF, 34, 25033},
+    {LEAF, 32, 25067},
+    {LEAF, 18, 25099},
+    {LEAF, 36, 25117},
+    {1, 490, 2101},
+    {1, 490, 2103},
+    {1, 490, 2105},
+    {1, 1505, 2107},
+    {LEAF, 47, 25153},
+    {1, 1505, 2109},
+    {LEAF, 43, 25200},
+    {1, 490, 2111},
+    {1, 490, 2113},
+    {1, 490, 2115},
+    {1, 490, 2117},
+    {LEAF, 45, 25243},
+    {1, 1505, 2119},
+    {LEAF, 47, 25288},
+    {1, 1505, 2121},
+    {LEAF, 47, 25335},
+    {LEAF, 30, 25382},
+    {LEAF, 38, 25412},
+    {LEAF, 35, 25450},
+    {LEAF, 37, 25485},
+    {LEAF, 35, 25522},
+    {LEAF, 32, 25557},
+    {LEAF, 43, 25589},
+    {LEAF, 27, 25632},
+    {LEAF, 47, 25659},
+    {1, 490, 2123},
+    {1, 490, 2125},
+    {LEAF, 40, 25706},
+    {LEAF, 38, 25746},
+    {LEAF, 43, 25784},
+    {LEAF, 43, 25827},
+    {LEAF, 48, 25870},
+    {LEAF, 41, 25918},
+    {1, 490, 2127},
+    {LEAF, 45, 25959},
+    {LEAF, 9, 26004},
+    {LEAF, 34, 26013},
+    {LEAF, 47, 26047},
+    {LEAF, 32, 26094},
+    {LEAF, 46, 26126},
+    {LEAF, 31, 26172},
+    {LEAF, 23, 26203},
+    {LEAF, 33, 26226},
+    {LEAF, 19, 26259},
+    {LEAF, 34, 26278},
+    {LEAF, 40, 26312},
+    {LEAF, 27, 26352},
+    {LEAF, 24, 26379},
+    {LEAF, 29, 26403},
+    {LEAF, 19, 26432},
+    {LEAF, 34, 26451},
+    {LEAF, 21, 26485},
+    {LEAF, 19, 26506},
+    {LEAF, 28, 26525},
+    {LEAF, 17, 26553},
+    {LEAF, 27, 26570},
+    {LEAF, 27, 26597},
+    {LEAF, 47, 26624},
+    {2, -76, 2129},
+    {LEAF, 26, 26671},
+    {LEAF, 48, 26697},
+    {LEAF, 43, 26745},
+    {LEAF, 39, 26788},
+    {2, -76, 2131},
+    {2, -76, 2133},
+    {2, -76, 2135},
+    {2, -76, 2137},
+    {2, 1111, 2139},
+    {2, 1111, 2141},
+    {LEAF, 47, 26827},
+    {2, 1111, 2143},
+    {LEAF, 32, 26874},
+    {LEAF, 45, 26906},
+    {LEAF, 29, 26951},
+    {LEAF, 26, 26980},
+    {LEAF, 30, 27006},
+    {LEAF, 25, 27036},
+    {2, -76, 2145},
+    {2, -76, 2147},
+    {LEAF, 33, 27061},
+    {LEAF, 43, 27094},
+    {LEAF, 29, 27137},
+    {LEAF, 26, 27166},
+    {LEAF, 24, 27192},
+    {LEAF, 41, 27216},
+    {LEAF, 37, 27257},
+    {LEAF, 31, 27294},
+    {LEAF, 46, 27325},
+    {LEAF, 33, 27371},
+    {LEAF, 32, 27404},
+    {LEAF, 22, 27436},
+    {2, -76, 2149},
+    {2, -76, 2151},
+    {2, -76, 2153},
+    {2, -76, 2155},
+    {2, 1111, 2157},
+    {2, 1111, 2159},
+    {2, 1111, 2161},
+    {2, 1111, 2163},
+    {2, -76, 2165},
+    {LEAF, 47, 27458},
+    {1, 1430, 2167},
+    {1, 1348, 2169},
+    {0, 9470, 2171},
+    {0, 9324, 2173},
+    {LEAF, 46, 27505},
+    {LEAF, 24, 27551},
+    {0, 8096, 2175},
+    {LEAF, 28, 27575},
+    {LEAF, 31, 27603},
+    {LEAF, 27, 27634},
+    {LEAF, 35, 27661},
+    {LEAF, 45, 27696},
+    {LEAF, 44, 27741},
+    {1, -36, 2177},
+    {LEAF, 44, 27785},
+    {1, 631, 2179},
+    {LEAF, 29, 27829},
+    {LEAF, 23, 27858},
+    {LEAF, 24, 27881},
+    {1, 1297, 2181},
+    {1, 1297, 2183},
+    {LEAF, 48, 27905},
+    {1, 1964, 2185},
+    {LEAF, 41, 27953},
+    {LEAF, 18, 27994},
+    {LEAF, 28, 28012},
+    {LEAF, 35, 28040},
+    {LEAF, 31, 28075},
+    {LEAF, 32, 28106},
+    {LEAF, 33, 28138},
+    {LEAF, 35, 28171},
+    {LEAF, 41, 28206},
+    {LEAF, 25, 28247},
+    {LEAF, 10, 28272},
+    {LEAF, 32, 28282},
+    {LEAF, 47, 28314},
+    {LEAF, 42, 28361},
+    {2, -1092, 2187},
+    {2, -1092, 2189},
+    {LEAF, 43, 28403},
+    {LEAF, 26, 28446},
+    {LEAF, 41, 28472},
+    {LEAF, 40, 28513},
+    {2, -1092, 2191},
+    {2, -1081, 2193},
+    {LEAF, 37, 28553},
+    {2, -1092, 2195},
+    {2, -1092, 2197},
+    {LEAF, 31, 28590},
+    {LEAF, 33, 28621},
+    {2, -1936, 2199},
+    {LEAF, 39, 28654},
+    {2, -1092, 2201},
+    {2, -1092, 2203},
+    {2, -1092, 2205},
+    {LEAF, 42, 28693},
+    {LEAF, 17, 28735},
+    {2, -1092, 2207},
+    {LEAF, 47, 28752},
+    {LEAF, 23, 28799},
+    {LEAF, 28, 28822},
+    {LEAF, 32, 28850},
+    {LEAF, 38, 28882},
+    {LEAF, 23, 28920},
+    {LEAF, 25, 28943},
+    {LEAF, 33, 28968},
+    {LEAF, 35, 29001},
+    {LEAF, 43, 29036},
+    {LEAF, 35, 29079},
+    {LEAF, 19, 29114},
+    {LEAF, 35, 29133},
+    {LEAF, 32, 29168},
+    {LEAF, 28, 29200},
+    {LEAF, 35, 29228},
+    {LEAF, 38, 29263},
+    {LEAF, 33, 29301},
+    {LEAF, 25, 29334},
+    {LEAF, 42, 29359},
+    {LEAF, 48, 29401},
+    {LEAF, 43, 29449},
+    {LEAF, 19, 29492},
+    {LEAF, 47, 29511},
+    {LEAF, 10, 29558},
+    {LEAF, 48, 29568},
+    {LEAF, 36, 29616},
+    {LEAF, 38, 29652},
+    {LEAF, 38, 29690},
+    {LEAF, 45, 29728},
+    {LEAF, 38, 29773},
+    {1, -354, 2209},
+    {LEAF, 46, 29811},
+    {1, -354, 2211},
+    {1, -1030, 2213},
+    {LEAF, 47, 29857},
+    {1, -354, 2215},
+    {LEAF, 44, 29904},
+    {LEAF, 36, 29948},
+    {1, -1030, 2217},
+    {LEAF, 31, 29984},
+    {1, -354, 2219},
+    {LEAF, 28, 30015},
+    {LEAF, 20, 30043},
+    {LEAF, 48, 30063},
+    {LEAF, 19, 30111},
+    {LEAF, 26, 30130},
+    {LEAF, 24, 30156},
+    {LEAF, 23, 30180},
+    {LEAF, 15, 30203},
+    {1, -1706, 2221},
+    {LEAF, 25, 30218},
+    {1, -1706, 2223},
+    {LEAF, 34, 30243},
+    {LEAF, 23, 30277},
+    {LEAF, 22, 30300},
+    {LEAF, 24, 30322},
+    {LEAF, 31, 30346},
+    {1, -1030, 2225},
+    {LEAF, 20, 30377},
+    {1, -354, 2227},
+    {LEAF, 31, 30397},
+    {1, -1030, 2229},
+    {LEAF, 40, 30428},
+    {LEAF, 47, 30468},
+    {LEAF, 20, 30515},
+    {1, -354, 2231},
+    {LEAF, 21, 30535},
+    {LEAF, 46, 30556},
+    {LEAF, 16, 30602},
+    {LEAF, 45, 30618},
+    {LEAF, 18, 30663},
+    {LEAF, 31, 30681},
+    {LEAF, 30, 30712},
+    {LEAF, 26, 30742},
+    {LEAF, 35, 30768},
+    {LEAF, 19, 30803},
+    {LEAF, 40, 30822},
+    {LEAF, 26, 30862},
+    {LEAF, 32, 30888},
+    {LEAF, 35, 30920},
+    {LEAF, 29, 30955},
+    {LEAF, 21, 30984},
+    {LEAF, 22, 31005},
+    {LEAF, 24, 31027},
+    {LEAF, 36, 31051},
+    {LEAF, 38, 31087},
+    {LEAF, 18, 31125},
+    {LEAF, 37, 31143},
+    {LEAF, 10, 31180},
+    {LEAF, 27, 31190},
+    {LEAF, 24, 31217},
+    {LEAF, 38, 31241},
+    {LEAF, 48, 31279},
+    {LEAF, 31, 31327},
+    {LEAF, 35, 31358},
+    {LEAF, 29, 31393},
+    {LEAF, 40, 31422},
+    {1, -502, 2233},
+    {LEAF, 22, 31462},
+    {1, -502, 2235},
+    {1, -502, 2237},
+    {LEAF, 32, 31484},
+    {LEAF, 17, 31516},
+    {LEAF, 39, 31533},
+    {LEAF, 47, 31572},
+    {LEAF, 25, 31619},
+    {LEAF, 15, 31644},
+    {LEAF, 38, 31659},
+    {LEAF, 33, 31697},
+    {LEAF, 26, 31730},
+    {LEAF, 43, 31756},
+    {1, -502, 2239},
+    {LEAF, 34, 31799},
+    {LEAF, 26, 31833},
+    {LEAF, 34, 31859},
+    {LEAF, 35, 31893},
+    {LEAF, 48, 31928},
+    {LEAF, 17, 31976},
+    {LEAF, 42, 31993},
+    {LEAF, 38, 32035},
+    {1, -1470, 2241},
+    {1, -1470, 2243},
+    {1, -1470, 2245},
+    {1, -502, 2247},
+    {1, -502, 2249},
+    {1, -502, 2251},
+    {1, -502, 2253},
+    {LEAF, 44, 32073},
+    {LEAF, 42, 32117},
+    {LEAF, 44, 32159},
+    {1, -1470, 2255},
+    {1, -502, 2257},
+    {LEAF, 24, 32203},
+    {1, -502, 2259},
+    {LEAF, 37, 32227},
+    {1, -1470, 2261},
+    {1, -1470, 2263},
+    {LEAF, 44, 32264},
+    {1, -1470, 2265},
+    {1, -502, 2267},
+    {1, -502, 2269},
+    {1, -502, 2271},
+    {1, -502, 2273},
+    {1, -1470, 2275},
+    {1, -1470, 2277},
+    {LEAF, 28, 32308},
+    {LEAF, 44, 32336},
+    {1, -502, 2279},
+    {1, -502, 2281},
+    {1, -502, 2283},
+    {LEAF, 30, 32380},
+    {LEAF, 30, 32410},
+    {LEAF, 42, 32440},
+    {LEAF, 39, 32482},
+    {LEAF, 36, 32521},
+    {LEAF, 37, 32557},
+    {LEAF, 30, 32594},
+    {LEAF, 30, 32624},
+    {LEAF, 22, 32654},
+    {LEAF, 38, 32676},
+    {LEAF, 33, 32714},
+    {LEAF, 25, 32747},
+    {LEAF, 32, 32772},
+    {LEAF, 25, 32804},
+    {LEAF, 39, 32829},
+    {LEAF, 11, 32868},
+    {1, -1470, 2285},
+    {LEAF, 40, 32879},
+    {LEAF, 40, 32919},
+    {LEAF, 18, 32959},
+    {1, -502, 2287},
+    {LEAF, 33, 32977},
+    {LEAF, 22, 33010},
+    {LEAF, 45, 33032},
+    {LEAF, 46, 33077},
+    {LEAF, 19, 33123},
+    {LEAF, 35, 33142},
+    {LEAF, 48, 33177},
+    {LEAF, 39, 33225},
+    {LEAF, 42, 33264},
+    {LEAF, 34, 33306},
+    {LEAF, 34, 33340},
+    {LEAF, 23, 33374},
+    {LEAF, 44, 33397},
+    {LEAF, 28, 33441},
+    {2, -246, 2289},
+    {2, -246, 2291},
+    {LEAF, 39, 33469},
+    {LEAF, 20, 33508},
+    {2, 605, 2293},
+    {2, 598, 2295},
+    {2, -246, 2297},
+    {LEAF, 46, 33528},
+    {2, 598, 2299},
+    {LEAF, 40, 33574},
+    {LEAF, 36, 33614},
+    {LEAF, 20, 33650},
+    {LEAF, 34, 33670},
+    {LEAF, 43, 33704},
+    {LEAF, 36, 33747},
+    {LEAF, 35, 33783},
+    {1, 534, 2301},
+    {LEAF, 46, 33818},
+    {1, 534, 2303},
+    {1, 534, 2305},
+    {1, 534, 2307},
+    {LEAF, 47, 33864},
+    {LEAF, 36, 33911},
+    {LEAF, 25, 33947},
+    {1, 1634, 2309},
+    {1, 1634, 2311},
+    {LEAF, 45, 33972},
+    {LEAF, 37, 34017},
+    {LEAF, 33, 34054},
+    {LEAF, 19, 34087},
+    {LEAF, 37, 34106},
+    {LEAF, 39, 34143},
+    {LEAF, 24, 34182},
+    {LEAF, 10, 34206},
+    {LEAF, 46, 34216},
+    {LEAF, 38, 34262},
+    {1, 516, 2313},
+    {1, 516, 2315},
+    {1, 516, 2317},
+    {1, 516, 2319},
+    {1, 1580, 2321},
+    {1, 1580, 2323},
+    {LEAF, 47, 34300},
+    {LEAF, 44, 34347},
+    {1, 516, 2325},
+    {1, 516, 2327},
+    {1, 516, 2329},
+    {1, 516, 2331},
+    {LEAF, 47, 34391},
+    {LEAF, 32, 34438},
+    {LEAF, 43, 34470},
+    {LEAF, 26, 34513},
+    {1, 466, 2333},
+    {1, 466, 2335},
+    {0, 9239, 2337},
+    {LEAF, 37, 34539},
+    {LEAF, 25, 34576},
+    {LEAF, 30, 34601},
+    {1, 385, 2339},
+    {LEAF, 20, 34631},
+    {LEAF, 45, 34651},
+    {LEAF, 16, 34696},
+    {LEAF, 34, 34712},
+    {LEAF, 42, 34746},
+    {LEAF, 32, 34788},
+    {LEAF, 48, 34820},
+    {0, 2014, 2341},
+    {LEAF, 44, 34868},
+    {LEAF, 43, 34912},
+    {LEAF, 36, 34955},
+    {LEAF, 44, 34991},
+    {LEAF, 38, 35035},
+    {LEAF, 33, 35073},
+    {LEAF, 25, 35106},
+    {LEAF, 34, 35131},
+    {LEAF, 43, 35165},
+    {LEAF, 30, 35208},
+    {LEAF, 46, 35238},
+    {LEAF, 31, 35284},
+    {LEAF, 45, 35315},
+    {LEAF, 27, 35360},
+    {LEAF, 44, 35387},
+    {0, 7576, 2343},
+    {0, 7576, 2345},
+    {0, 7576, 2347},
+    {LEAF, 45, 35431},
+    {LEAF, 21, 35476},
+    {LEAF, 41, 35497},
+    {LEAF, 43, 35538},
+    {LEAF, 35, 35581},
+    {LEAF, 37, 35616},
+    {LEAF, 37, 35653},
+    {LEAF, 37, 35690},
+    {LEAF, 43, 35727},
+    {LEAF, 28, 35770},
+    {LEAF, 40, 35798},
+    {LEAF, 45, 35838},
+    {0, 2150, 2349},
+    {2, 298, 2351},
+    {LEAF, 48, 35883},
+    {LEAF, 33, 35931},
+    {LEAF, 44, 35964},
+    {LEAF, 44, 36008},
+    {LEAF, 34, 36052},
+    {LEAF, 29, 36086},
+    {LEAF, 41, 36115},
+    {LEAF, 44, 36156},
+    {LEAF, 35, 36200},
+    {LEAF, 42, 36235},
+    {LEAF, 34, 36277},
+    {LEAF, 47, 36311},
+    {2, 1588, 2353},
+    {LEAF, 40, 36358},
+    {LEAF, 40, 36398},
+    {2, 298, 2355},
+    {LEAF, 26, 36438},
+    {2, 1588, 2357},
+    {2, 1588, 2359},
+    {LEAF, 44, 36464},
+    {LEAF, 39, 36508},
+    {LEAF, 29, 36547},
+    {LEAF, 34, 36576},
+    {LEAF, 47, 36610},
+    {LEAF, 34, 36657},
+    {LEAF, 22, 36691},
+    {LEAF, 40, 36713},
+    {LEAF, 45, 36753},
+    {LEAF, 41, 36798},
+    {LEAF, 40, 36839},
+    {LEAF, 45, 36879},
+    {LEAF, 23, 36924},
+    {2, 298, 2361},
+    {LEAF, 34, 36947},
+    {LEAF, 42, 36981},
+    {2, -346, 2363},
+    {2, -346, 2365},
+    {LEAF, 43, 37023},
+    {LEAF, 43, 37066},
+    {2, 298, 2367},
+    {2, 298, 2369},
+    {LEAF, 39, 37109},
+    {2, 298, 2371},
+    {LEAF, 30, 37148},
+    {LEAF, 45, 37178},
+    {2, -346, 2373},
+    {2, -346, 2375},
+    {2, 298, 2377},
+    {2, 298, 2379},
+    {LEAF, 27, 37223},
+    {LEAF, 42, 37250},
+    {LEAF, 35, 37292},
+    {LEAF, 25, 37327},
+    {LEAF, 26, 37352},
+    {LEAF, 46, 37378},
+    {LEAF, 42, 37424},
+    {2, 942, 2381},
+    {LEAF, 46, 37466},
+    {LEAF, 48, 37512},
+    {LEAF, 48, 37560},
+    {LEAF, 32, 37608},
+    {2, 1588, 2383},
+    {LEAF, 42, 37640},
+    {LEAF, 20, 37682},
+    {LEAF, 36, 37702},
+    {LEAF, 34, 37738},
+    {LEAF, 46, 37772},
+    {2, 942, 2385},
+    {2, 942, 2387},
+    {LEAF, 32, 37818},
+    {LEAF, 24, 37850},
+    {LEAF, 35, 37874},
+    {LEAF, 27, 37909},
+    {LEAF, 37, 37936},
+    {LEAF, 39, 37973},
+    {LEAF, 32, 38012},
+    {LEAF, 38, 38044},
+    {0, 2075, 2389},
+    {LEAF, 46, 38082},
+    {0, 2075, 2391},
+    {0, 2075, 2393},
+    {LEAF, 44, 38128},
+    {LEAF, 35, 38172},
+    {0, 2075, 2395},
+    {LEAF, 35, 38207},
+    {0, 2075, 2397},
+    {0, 2075, 2399},
+    {LEAF, 46, 38242},
+    {LEAF, 40, 38288},
+    {LEAF, 23, 38328},
+    {LEAF, 47, 38351},
+    {LEAF, 32, 38398},
+    {LEAF, 28, 38430},
+    {LEAF, 24, 38458},
+    {LEAF, 22, 38482},
+    {0, 7275, 2401},
+    {LEAF, 32, 38504},
+    {LEAF, 30, 38536},
+    {LEAF, 22, 38566},
+    {LEAF, 33, 38588},
+    {LEAF, 25, 38621},
+    {0, 7925, 2403},
+    {0, 7925, 2405},
+    {0, 7925, 2407},
+    {0, 7925, 2409},
+    {0, 8575, 2411},
+    {LEAF, 41, 38646},
+    {LEAF, 45, 38687},
+    {LEAF, 42, 38732},
+    {0, 7925, 2413},
+    {LEAF, 37, 38774},
+    {LEAF, 40, 38811},
+    {LEAF, 21, 38851},
+    {0, 7925, 2415},
+    {0, 7925, 2417},
+    {LEAF, 41, 38872},
+    {LEAF, 46, 38913},
+    {LEAF, 35, 38959},
+    {LEAF, 30, 38994},
+    {LEAF, 31, 39024},
+    {LEAF, 13, 39055},
+    {0, 9225, 2419},
+    {0, 9225, 2421},
+    {0, 9225, 2423},
+    {LEAF, 45, 39068},
+    {LEAF, 40, 39113},
+    {LEAF, 36, 39153},
+    {2, 814, 2425},
+    {LEAF, 47, 39189},
+    {LEAF, 28, 39236},
+    {LEAF, 27, 39264},
+    {LEAF, 23, 39291},
+    {LEAF, 32, 39314},
+    {LEAF, 23, 39346},
+    {LEAF, 44, 39369},
+    {LEAF, 24, 39413},
+    {LEAF, 29, 39437},
+    {LEAF, 34, 39466},
+    {LEAF, 45, 39500},
+    {LEAF, 34, 39545},
+    {LEAF, 36, 39579},
+    {LEAF, 37, 39615},
+    {LEAF, 36, 39652},
+    {LEAF, 34, 39688},
+    {LEAF, 45, 39722},
+    {LEAF, 27, 39767},
+    {LEAF, 36, 39794},
+    {LEAF, 27, 39830},
+    {LEAF, 32, 39857},
+    {LEAF, 40, 39889},
+    {LEAF, 37, 39929},
+    {LEAF, 44, 39966},
+    {LEAF, 46, 40010},
+    {0, 7936, 2427},
+    {0, 7936, 2429},
+    {0, 7936, 2431},
+    {0, 7936, 2433},
+    {0, 7936, 2435},
+    {0, 7936, 2437},
+    {LEAF, 41, 40056},
+    {LEAF, 35, 40097},
+    {LEAF, 40, 40132},
+    {LEAF, 46, 40172},
+    {0, 9216, 2439},
+    {0, 9216, 2441},
+    {0, 9222, 2443},
+    {0, 9222, 2445},
+    {0, 9222, 2447},
+    {0, 9222, 2449},
+    {0, 7934, 2451},
+    {LEAF, 30, 40218},
+    {LEAF, 34, 40248},
+    {LEAF, 40, 40282},
+    {LEAF, 47, 40322},
+    {LEAF, 34, 40369},
+    {0, 9208, 2453},
+    {LEAF, 39, 40403},
+    {LEAF, 33, 40442},
+    {LEAF, 48, 40475},
+    {LEAF, 31, 40523},
+    {LEAF, 40, 40554},
+    {LEAF, 30, 40594},
+    {LEAF, 33, 40624},
+    {LEAF, 34, 40657},
+    {LEAF, 20, 40691},
+    {LEAF, 31, 40711},
+    {LEAF, 24, 40742},
+    {LEAF, 28, 40766},
+    {LEAF, 26, 40794},
+    {LEAF, 25, 40820},
+    {2, -372, 2455},
+    {2, -372, 2457},
+    {LEAF, 47, 40845},
+    {2, -372, 2459},
+    {LEAF, 41, 40892},
+    {LEAF, 38, 40933},
+    {LEAF, 48, 40971},
+    {LEAF, 46, 41019},
+    {LEAF, 31, 41065},
+    {LEAF, 42, 41096},
+    {2, -372, 2461},
+    {2, -372, 2463},
+    {LEAF, 28, 41138},
+    {LEAF, 24, 41166},
+    {LEAF, 45, 41190},
+    {LEAF, 39, 41235},
+    {LEAF, 27, 41274},
+    {2, -372, 2465},
+    {LEAF, 21, 41301},
+    {2, -372, 2467},
+    {LEAF, 19, 41322},
+    {2, 221, 2469},
+    {LEAF, 34, 41341},
+    {LEAF, 39, 41375},
+    {LEAF, 27, 41414},
+    {LEAF, 27, 41441},
+    {LEAF, 41, 41468},
+    {LEAF, 15, 41509},
+    {LEAF, 48, 41524},
+    {LEAF, 8, 41572},
+    {1, -744, 2471},
+    {LEAF, 17, 41580},
+    {LEAF, 48, 41597},
+    {LEAF, 11, 41645},
+    {LEAF, 48, 41656},
+    {LEAF, 40, 41704},
+    {1, -260, 2473},
+    {LEAF, 37, 41744},
+    {LEAF, 20, 41781},
+    {LEAF, 38, 41801},
+    {LEAF, 22, 41839},
+    {LEAF, 28, 41861},
+    {1, -744, 2475},
+    {LEAF, 32, 41889},
+    {LEAF, 37, 41921},
+    {LEAF, 44, 41958},
+    {LEAF, 33, 42002},
+    {LEAF, 35, 42035},
+    {LEAF, 48, 42070},
+    {LEAF, 13, 42118},
+    {1, -260, 2477},
+    {LEAF, 31, 42131},
+    {LEAF, 36, 42162},
+    {LEAF, 29, 42198},
+    {LEAF, 18, 42227},
+    {1, 250, 2479},
+    {LEAF, 25, 42245},
+    {1, 782, 2481},
+    {1, 782, 2483},
+    {LEAF, 32, 42270},
+    {LEAF, 36, 42302},
+    {LEAF, 25, 42338},
+    {LEAF, 37, 42363},
+    {LEAF, 33, 42400},
+    {LEAF, 41, 42433},
+    {LEAF, 38, 42474},
+    {LEAF, 42, 42512},
+    {LEAF, 40, 42554},
+    {LEAF, 43, 42594},
+    {LEAF, 36, 42637},
+    {LEAF, 36, 42673},
+    {LEAF, 45, 42709},
+    {LEAF, 37, 42754},
+    {LEAF, 31, 42791},
+    {LEAF, 37, 42822},
+    {LEAF, 39, 42859},
+    {LEAF, 38, 42898},
+    {LEAF, 27, 42936},
+    {LEAF, 43, 42963},
+    {LEAF, 47, 43006},
+    {LEAF, 36, 43053},
+    {LEAF, 47, 43089},
+    {LEAF, 35, 43136},
+};
+
+static constexpr uint16_t ITEMS[43171] = {
+    8, 9, 20, 29, 36, 80, 93, 848, 849, 854, 855, 879,
+    883, 884, 885, 889, 890, 891, 897, 915, 919, 920, 921, 925,
+    926, 927, 933, 951, 955, 956, 957, 961, 962, 963, 969, 992,
+    993, 997, 998, 999, 1005, 1028, 1029, 1034, 1035, 88, 800, 801,
+    805, 806, 807, 835, 836, 837, 840, 841, 842, 871, 872, 873,
+    876, 877, 907, 908, 909, 912, 913, 943, 944, 945, 948, 979,
+    980, 981, 984, 16, 33, 40, 82, 84, 88, 114, 123, 776,
+    777, 806, 807, 810, 811, 812, 813, 816, 817, 818, 819, 841,
+    842, 843, 846, 847, 852, 853, 859, 860, 861, 876, 877, 882,
+    887, 888, 895, 896, 913, 918, 924, 931, 932, 954, 960, 24,
+    43, 49, 410, 411, 415, 445, 446, 447, 450, 451, 481, 482,
+    483, 486, 487, 517, 518, 519, 522, 523, 553, 554, 555, 558,
+    559, 591, 10, 14, 15, 18, 30, 41, 53, 98, 112, 116,
+    131, 160, 164, 165, 166, 169, 170, 171, 172, 177, 178, 200,
+    201, 202, 206, 207, 208, 214, 237, 238, 243, 244, 1208, 1209,
+    1213, 1214, 1215, 33, 88, 806, 807, 841, 842, 846, 847, 876,
+    882, 33, 88, 770, 771, 800, 801, 804, 805, 806, 807, 810,
+    811, 835, 836, 837, 840, 841, 842, 845, 846, 871, 872, 875,
+    876, 877, 881, 882, 907, 908, 912, 913, 917, 918, 943, 944,
+    948, 953, 980, 984, 38, 127, 733, 734, 735, 737, 738, 739,
+    740, 741, 743, 744, 745, 746, 773, 774, 775, 776, 779, 780,
+    781, 782, 787, 788, 2, 19, 35, 69, 79, 86, 102, 132,
+    642, 643, 649, 650, 651, 669, 672, 673, 674, 675, 678, 679,
+    680, 681, 685, 686, 687, 704, 705, 708, 709, 710, 711, 714,
+    715, 716, 717, 721, 722, 723, 745, 746, 747, 751, 752, 753,
+    759, 35, 38, 61, 70, 122, 704, 705, 708, 709, 710, 715,
+    716, 717, 740, 741, 743, 744, 745, 746, 747, 750, 751, 752,
+    753, 757, 758, 759, 780, 781, 782, 786, 787, 788, 789, 793,
+    794, 795, 830, 831, 16, 40, 82, 84, 114, 123, 776, 777,
+    782, 783, 811, 812, 813, 816, 817, 818, 819, 824, 825, 846,
+    847, 852, 853, 854, 859, 860, 861, 888, 894, 895, 896, 903,
+    924, 931, 932, 960, 967, 20, 54, 88, 93, 807, 842, 843,
+    847, 848, 877, 878, 879, 882, 883, 913, 914, 915, 918, 919,
+    949, 950, 951, 954, 955, 986, 987, 8, 9, 20, 29, 36,
+    80, 84, 93, 813, 843, 848, 849, 853, 854, 855, 878, 879,
+    883, 884, 885, 889, 890, 891, 897, 914, 915, 919, 920, 921,
+    925, 926, 927, 933, 951, 955, 956, 957, 961, 962, 963, 992,
+    993, 997, 998, 84, 114, 813, 819, 848, 849, 853, 854, 855,
+    861, 883, 884, 889, 890, 896, 897, 919, 920, 925, 933, 961,
+    969, 9, 29, 36, 80, 84, 848, 849, 854, 855, 883, 884,
+    885, 889, 890, 891, 896, 897, 919, 920, 921, 925, 926, 927,
+    933, 955, 956, 957, 961, 962, 963, 969, 992, 993, 997, 998,
+    1005, 9, 29, 36, 77, 926, 927, 957, 962, 963, 992, 993,
+    997, 998, 999, 1005, 1028, 1029, 1033, 1034, 1035, 1041, 1064, 1065,
+    1069, 1070, 1071, 1077, 1107, 26, 37, 52, 87, 99, 133, 1059,
+    1063, 1064, 1065, 1068, 1069, 1070, 1076, 1077, 1099, 1100, 1101, 1104,
+    1105, 1106, 1107, 1112, 1113, 1135, 1136, 1137, 1141, 1142, 1143, 1148,
+    1149, 1172, 1173, 1177, 1178, 1179, 1185, 13, 50, 59, 74, 75,
+    126, 416, 417, 422, 423, 429, 451, 452, 453, 457, 458, 459,
+    465, 487, 488, 489, 493, 494, 495, 500, 501, 523, 524, 525,
+    529, 530, 531, 536, 537, 560, 561, 565, 566, 567, 573, 597,
+    603, 10, 18, 30, 37, 41, 53, 78, 159, 160, 163, 164,
+    165, 169, 170, 171, 177, 178, 206, 1137, 1166, 1167, 1171, 1172,
+    1173, 1176, 1177, 1178, 1179, 1202, 1203, 1206, 1207, 1208, 1209, 1212,
+    1213, 1214, 1215, 1220, 1221, 10, 14, 15, 18, 30, 41, 78,
+    98, 112, 115, 120, 131, 159, 160, 164, 165, 166, 170, 171,
+    172, 178, 194, 195, 196, 199, 200, 201, 202, 205, 206, 207,
+    208, 214, 231, 232, 236, 237, 238, 242, 243, 244, 273, 274,
+    1203, 1208, 1209, 1215, 10, 18, 30, 41, 53, 78, 131, 159,
+    160, 164, 165, 166, 170, 171, 172, 178, 196, 200, 201, 202,
+    206, 207, 1173, 1203, 1207, 1208, 1209, 1213, 1214, 1215, 18, 30,
+    41, 98, 112, 131, 160, 164, 165, 166, 170, 171, 172, 201,
+    202, 207, 208, 238, 1209, 1215, 18, 37, 52, 53, 87, 103,
+    169, 170, 177, 178, 1104, 1135, 1136, 1137, 1140, 1141, 1142, 1143,
+    1147, 1148, 1149, 1171, 1172, 1173, 1176, 1177, 1178, 1179, 1183, 1184,
+    1185, 1207, 1208, 1212, 1213, 1214, 1215, 1220, 1221, 10, 15, 18,
+    37, 41, 53, 62, 116, 131, 164, 165, 166, 169, 170, 171,
+    172, 177, 178, 201, 202, 206, 207, 208, 214, 1171, 1172, 1173,
+    1177, 1178, 1179, 1185, 1207, 1208, 1209, 1212, 1213, 1214, 1215, 1220,
+    1221, 14, 15, 22, 28, 47, 97, 106, 117, 131, 201, 202,
+    207, 236, 237, 238, 242, 243, 244, 250, 268, 272, 273, 274,
+    278, 279, 280, 285, 286, 303, 307, 308, 309, 313, 314, 315,
+    14, 15, 28, 97, 98, 112, 117, 131, 165, 166, 171, 172,
+    200, 201, 202, 206, 207, 208, 214, 232, 236, 237, 238, 242,
+    243, 244, 250, 273, 274, 279, 280, 1209, 769, 770, 771, 775,
+    776, 777, 804, 805, 806, 807, 810, 811, 840, 845, 846, 881,
+    16, 40, 127, 735, 769, 770, 771, 774, 775, 776, 777, 780,
+    781, 782, 783, 804, 805, 806, 807, 809, 810, 811, 812, 815,
+    816, 817, 818, 840, 845, 846, 851, 852, 859, 860, 881, 887,
+    894, 917, 923, 33, 88, 770, 771, 776, 777, 804, 805, 806,
+    807, 810, 811, 812, 840, 841, 842, 845, 846, 847, 852, 853,
+    875, 876, 881, 882, 887, 888, 911, 912, 917, 918, 923, 924,
+    948, 953, 959, 984, 989, 1025, 689, 724, 725, 726, 727, 728,
+    729, 760, 761, 762, 763, 764, 765, 796, 797, 798, 799, 832,
+    833, 868, 904, 940, 725, 726, 727, 728, 729, 730, 731, 732,
+    733, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770,
+    771, 796, 797, 798, 799, 800, 802, 803, 804, 832, 833, 834,
+    838, 839, 868, 869, 874, 904, 910, 946, 727, 728, 729, 731,
+    732, 733, 734, 735, 763, 764, 765, 767, 768, 769, 770, 771,
+    773, 774, 775, 803, 804, 805, 808, 809, 810, 838, 839, 844,
+    845, 874, 880, 38, 70, 739, 740, 741, 745, 746, 747, 780,
+    781, 782, 787, 788, 789, 35, 38, 70, 122, 127, 703, 704,
+    738, 739, 740, 741, 743, 744, 745, 746, 747, 750, 751, 752,
+    753, 779, 780, 781, 782, 786, 787, 788, 789, 795, 12, 21,
+    69, 129, 660, 661, 662, 663, 665, 666, 667, 671, 696, 697,
+    698, 699, 701, 702, 703, 704, 707, 708, 738, 739, 740, 744,
+    745, 19, 35, 69, 86, 132, 703, 704, 705, 708, 709, 710,
+    711, 714, 715, 716, 717, 744, 745, 746, 747, 751, 752, 753,
+    19, 35, 69, 86, 132, 668, 671, 672, 673, 674, 678, 679,
+    680, 681, 703, 704, 705, 708, 709, 710, 711, 714, 715, 716,
+    717, 752, 753, 16, 40, 775, 776, 777, 781, 782, 783, 811,
+    816, 817, 818, 823, 824, 825, 852, 859, 860, 16, 38, 40,
+    127, 740, 741, 770, 771, 774, 775, 776, 777, 780, 781, 782,
+    783, 788, 789, 810, 811, 815, 816, 817, 822, 823, 824, 825,
+    845, 851, 852, 858, 859, 860, 867, 887, 894, 930, 16, 40,
+    782, 783, 824, 825, 16, 38, 40, 70, 127, 740, 741, 745,
+    746, 747, 775, 776, 777, 780, 781, 782, 783, 787, 788, 789,
+    815, 816, 817, 822, 823, 824, 825, 831, 851, 858, 859, 860,
+    866, 867, 894, 901, 902, 903, 938, 20, 84, 93, 114, 123,
+    812, 813, 819, 843, 847, 848, 849, 853, 854, 878, 879, 882,
+    883, 888, 889, 897, 914, 915, 919, 924, 925, 951, 955, 961,
+    20, 54, 80, 88, 93, 111, 842, 843, 847, 848, 849, 877,
+    878, 879, 882, 883, 884, 885, 889, 913, 914, 915, 918, 919,
+    920, 921, 949, 950, 951, 954, 955, 956, 957, 986, 987, 991,
+    992, 993, 1022, 1023, 16, 40, 81, 82, 84, 111, 114, 123,
+    811, 812, 813, 817, 818, 819, 825, 847, 848, 852, 853, 854,
+    859, 860, 861, 888, 889, 895, 896, 897, 903, 924, 925, 931,
+    932, 933, 960, 961, 967, 968, 969, 996, 997, 1003, 1004, 1005,
+    1032, 1039, 1040, 9, 20, 29, 36, 80, 93, 849, 855, 879,
+    883, 884, 885, 889, 890, 915, 919, 920, 921, 925, 926, 927,
+    933, 951, 955, 956, 957, 961, 962, 963, 969, 987, 991, 992,
+    993, 997, 998, 999, 1028, 1029, 1034, 9, 29, 36, 80, 884,
+    885, 890, 920, 921, 926, 927, 956, 957, 961, 962, 963, 992,
+    993, 997, 998, 999, 1028, 1029, 1034, 1035, 9, 29, 36, 54,
+    884, 919, 920, 925, 951, 955, 956, 957, 961, 962, 987, 991,
+    992, 993, 997, 998, 1023, 1027, 1028, 1029, 1033, 1064, 9, 29,
+    36, 956, 957, 962, 992, 993, 997, 998, 1028, 1029, 1033, 1034,
+    1064, 1065, 9, 29, 36, 80, 849, 855, 884, 885, 889, 890,
+    897, 920, 921, 925, 926, 927, 933, 955, 956, 957, 961, 962,
+    963, 969, 991, 992, 993, 997, 998, 999, 1005, 1028, 1029, 1033,
+    1034, 1035, 1041, 1070, 9, 26, 29, 36, 81, 110, 955, 956,
+    961, 987, 991, 992, 993, 997, 998, 1005, 1022, 1023, 1027, 1028,
+    1029, 1032, 1033, 1034, 1035, 1041, 1058, 1059, 1063, 1064, 1065, 1068,
+    1069, 1070, 1100, 1101, 1105, 1106, 1107, 26, 29, 81, 87, 110,
+    991, 997, 1022, 1023, 1027, 1028, 1029, 1032, 1033, 1058, 1059, 1062,
+    1063, 1064, 1065, 1068, 1069, 1070, 1095, 1099, 1100, 1101, 1104, 1105,
+    1106, 1107, 1141, 1142, 87, 110, 1053, 1056, 1057, 1058, 1062, 1092,
+    1093, 1094, 1095, 1098, 1099, 1100, 1101, 1104, 1105, 1129, 1130, 1131,
+    1134, 1135, 1136, 1137, 1140, 1141, 1142, 1165, 1166, 1167, 1170, 1171,
+    1172, 1176, 1177, 1178, 26, 87, 110, 1058, 1059, 1062, 1063, 1064,
+    1068, 1094, 1095, 1099, 1100, 1101, 1104, 1105, 1106, 1135, 1136, 1137,
+    1141, 1142, 1143, 37, 87, 1095, 1099, 1100, 1101, 1131, 1135, 1136,
+    1137, 1141, 1142, 1143, 1171, 1177, 1178, 29, 36, 77, 997, 998,
+    1005, 1028, 1029, 1033, 1034, 1035, 1041, 1063, 1064, 1065, 1069, 1070,
+    1071, 1076, 1077, 1100, 1101, 1105, 1106, 1107, 1113, 77, 1028, 1033,
+    1041, 1063, 1064, 1065, 1069, 1070, 1071, 1076, 1077, 1100, 1101, 1105,
+    1106, 1107, 1113, 1142, 37, 52, 81, 87, 99, 103, 133, 1032,
+    1039, 1040, 1068, 1069, 1075, 1076, 1077, 1100, 1101, 1104, 1105, 1106,
+    1107, 1111, 1112, 1113, 1136, 1137, 1140, 1141, 1142, 1143, 1147, 1148,
+    1149, 1176, 1177, 1178, 1183, 1184, 1185, 510, 515, 546, 547, 551,
+    582, 583, 584, 585, 587, 588, 618, 619, 620, 621, 623, 624,
+    625, 655, 656, 657, 659, 660, 661, 692, 693, 696, 697, 403,
+    407, 438, 439, 440, 443, 474, 475, 476, 479, 480, 509, 510,
+    511, 512, 515, 516, 546, 547, 548, 549, 551, 552, 582, 583,
+    584, 585, 587, 588, 589, 618, 619, 620, 621, 623, 624, 625,
+    626, 655, 656, 657, 660, 661, 24, 27, 368, 369, 402, 403,
+    404, 405, 407, 408, 438, 439, 440, 441, 443, 444, 474, 475,
+    476, 477, 479, 480, 510, 511, 512, 513, 515, 516, 546, 547,
+    548, 549, 551, 552, 553, 582, 583, 584, 585, 587, 588, 589,
+    619, 620, 621, 624, 625, 24, 368, 369, 403, 404, 405, 408,
+    409, 439, 440, 441, 444, 445, 475, 476, 477, 479, 480, 481,
+    510, 511, 512, 513, 515, 516, 517, 547, 548, 549, 552, 553,
+    584, 585, 589, 43, 49, 75, 447, 451, 452, 457, 482, 483,
+    486, 487, 488, 489, 492, 493, 518, 519, 522, 523, 524, 525,
+    528, 529, 554, 555, 559, 560, 561, 564, 565, 591, 595, 596,
+    597, 601, 43, 49, 75, 416, 417, 447, 451, 452, 453, 457,
+    482, 483, 487, 488, 489, 492, 493, 494, 518, 519, 523, 524,
+    525, 528, 529, 555, 559, 560, 561, 565, 566, 596, 597, 13,
+    50, 59, 75, 138, 380, 381, 385, 386, 387, 415, 416, 417,
+    421, 422, 423, 428, 429, 451, 452, 453, 457, 458, 459, 464,
+    465, 487, 488, 489, 493, 494, 495, 500, 501, 523, 524, 525,
+    529, 530, 536, 537, 560, 561, 566, 567, 24, 43, 49, 96,
+    373, 374, 375, 378, 379, 409, 410, 411, 414, 415, 441, 444,
+    445, 446, 447, 450, 451, 477, 480, 481, 482, 483, 486, 487,
+    516, 517, 518, 519, 522, 553, 554, 555, 558, 591, 27, 95,
+    96, 297, 300, 301, 302, 303, 306, 307, 332, 333, 336, 337,
+    338, 339, 341, 342, 343, 368, 369, 372, 373, 374, 375, 377,
+    378, 379, 404, 405, 408, 409, 410, 411, 413, 414, 440, 441,
+    444, 445, 449, 450, 477, 480, 481, 485, 22, 27, 95, 96,
+    266, 267, 268, 271, 272, 277, 297, 300, 301, 302, 303, 305,
+    306, 307, 308, 332, 333, 336, 337, 338, 339, 341, 342, 343,
+    368, 369, 372, 373, 374, 375, 377, 378, 405, 408, 409, 413,
+    50, 137, 138, 343, 344, 345, 349, 350, 351, 356, 357, 379,
+    380, 381, 385, 386, 387, 392, 393, 415, 416, 417, 421, 422,
+    423, 428, 429, 451, 452, 457, 458, 465, 13, 46, 50, 59,
+    137, 138, 313, 314, 315, 321, 343, 344, 345, 348, 349, 350,
+    351, 355, 356, 357, 379, 380, 381, 384, 385, 386, 387, 391,
+    392, 393, 415, 416, 417, 420, 421, 422, 423, 428, 429, 452,
+    453, 457, 458, 464, 465, 493, 500, 501, 22, 46, 47, 95,
+    137, 138, 278, 279, 286, 307, 308, 309, 312, 313, 314, 315,
+    320, 321, 339, 342, 343, 344, 345, 348, 349, 350, 351, 355,
+    356, 357, 375, 379, 380, 381, 384, 385, 386, 387, 392, 393,
+    415, 416, 420, 421, 428, 429, 46, 47, 137, 138, 279, 286,
+    308, 309, 313, 314, 315, 320, 321, 343, 344, 345, 348, 349,
+    350, 351, 355, 356, 357, 379, 380, 381, 384, 385, 386, 387,
+    391, 392, 393, 420, 421, 428, 429, 188, 193, 223, 224, 225,
+    226, 228, 229, 230, 234, 235, 259, 260, 261, 262, 264, 265,
+    266, 267, 268, 270, 293, 294, 295, 296, 297, 299, 300, 301,
+    302, 329, 330, 331, 332, 333, 334, 335, 336, 365, 366, 367,
+    368, 371, 402, 407, 10, 30, 41, 78, 115, 120, 152, 153,
+    154, 157, 158, 159, 160, 162, 163, 164, 188, 189, 190, 193,
+    194, 195, 196, 198, 199, 200, 201, 225, 226, 229, 230, 231,
+    232, 235, 236, 237, 267, 268, 1196, 1197, 1201, 1202, 1203, 1206,
+    1207, 37, 52, 87, 103, 1094, 1095, 1129, 1130, 1131, 1134, 1135,
+    1136, 1137, 1140, 1141, 1142, 1143, 1166, 1167, 1170, 1171, 1172, 1173,
+    1176, 1177, 1178, 1179, 1184, 1185, 1202, 1203, 1206, 1207, 1208, 1212,
+    1213, 1214, 1220, 1221, 37, 52, 87, 1135, 1136, 1137, 1141, 1142,
+    1143, 1171, 1172, 1173, 1177, 1178, 1179, 1185, 1213, 1214, 1221, 10,
+    30, 41, 78, 115, 120, 154, 158, 159, 160, 163, 164, 165,
+    166, 170, 190, 194, 195, 196, 199, 200, 201, 202, 231, 232,
+    237, 1202, 1203, 1207, 1208, 1209, 11, 14, 15, 22, 28, 31,
+    47, 68, 92, 97, 106, 116, 117, 128, 177, 205, 206, 212,
+    213, 214, 238, 241, 242, 243, 244, 247, 248, 249, 250, 256,
+    272, 273, 274, 276, 277, 278, 279, 280, 283, 284, 285, 286,
+    307, 308, 309, 312, 313, 314, 14, 22, 28, 46, 47, 95,
+    97, 106, 117, 242, 243, 250, 272, 273, 274, 278, 279, 280,
+    286, 302, 303, 307, 308, 309, 312, 313, 314, 315, 320, 321,
+    338, 339, 342, 343, 344, 345, 348, 349, 14, 22, 25, 28,
+    46, 47, 56, 95, 97, 106, 117, 137, 242, 243, 250, 272,
+    273, 274, 277, 278, 279, 280, 285, 286, 307, 308, 309, 312,
+    313, 314, 315, 319, 320, 321, 339, 342, 343, 344, 345, 348,
+    349, 350, 351, 355, 356, 357, 384, 10, 14, 15, 18, 28,
+    41, 53, 68, 98, 106, 112, 115, 116, 120, 131, 164, 165,
+    166, 169, 170, 171, 172, 177, 178, 196, 199, 200, 201, 202,
+    205, 206, 207, 208, 213, 214, 232, 236, 237, 238, 242, 243,
+    244, 250, 274, 1208, 1209, 1214, 1215, 14, 15, 18, 28, 31,
+    53, 62, 68, 98, 106, 112, 116, 117, 131, 165, 166, 170,
+    171, 172, 177, 178, 200, 201, 202, 205, 206, 207, 208, 213,
+    214, 236, 237, 238, 242, 243, 244, 249, 250, 274, 1209, 1214,
+    1215, 16, 33, 40, 114, 123, 771, 776, 777, 806, 807, 810,
+    811, 812, 816, 817, 818, 846, 847, 852, 853, 859, 860, 861,
+    881, 882, 887, 888, 895, 917, 918, 923, 924, 931, 953, 959,
+    16, 33, 82, 127, 770, 771, 775, 776, 777, 804, 805, 806,
+    807, 809, 810, 811, 812, 815, 816, 817, 840, 845, 846, 851,
+    852, 859, 860, 881, 882, 887, 888, 894, 895, 917, 918, 923,
+    924, 930, 931, 953, 959, 989, 995, 1025, 1031, 6, 139, 140,
+    149, 185, 221, 257, 508, 544, 580, 616, 617, 652, 653, 654,
+    688, 689, 690, 724, 725, 726, 727, 728, 729, 760, 761, 762,
+    763, 764, 765, 796, 797, 798, 799, 832, 833, 868, 869, 904,
+    905, 940, 976, 1012, 1048, 1084, 1120, 1156, 1192, 139, 140, 580,
+    616, 617, 652, 653, 654, 688, 689, 690, 691, 724, 725, 726,
+    727, 728, 729, 760, 761, 762, 763, 764, 765, 796, 797, 798,
+    832, 833, 868, 904, 940, 976, 1012, 34, 580, 616, 617, 622,
+    652, 653, 654, 655, 656, 657, 658, 659, 688, 689, 690, 691,
+    692, 693, 694, 695, 724, 725, 726, 727, 728, 729, 730, 731,
+    732, 733, 760, 761, 762, 763, 764, 765, 766, 767, 768, 796,
+    802, 127, 734, 735, 738, 739, 740, 768, 769, 770, 771, 773,
+    774, 775, 776, 780, 781, 809, 810, 815, 816, 845, 851, 71,
+    124, 127, 731, 732, 733, 734, 735, 737, 738, 739, 740, 741,
+    767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 779, 780,
+    803, 804, 808, 809, 810, 814, 815, 816, 844, 845, 850, 851,
+    880, 886, 916, 763, 764, 765, 797, 798, 799, 800, 801, 833,
+    834, 835, 836, 839, 840, 869, 870, 871, 875, 905, 906, 907,
+    911, 941, 942, 977, 978, 1013, 12, 21, 35, 69, 86, 122,
+    129, 132, 671, 672, 678, 698, 699, 701, 702, 703, 704, 705,
+    707, 708, 709, 710, 714, 715, 716, 738, 739, 740, 741, 743,
+    744, 745, 746, 747, 750, 751, 752, 753, 12, 21, 35, 69,
+    86, 129, 132, 666, 667, 671, 672, 673, 678, 699, 702, 703,
+    704, 705, 707, 708, 709, 710, 714, 715, 744, 745, 751, 752,
+    12, 21, 129, 697, 698, 699, 701, 702, 703, 704, 707, 733,
+    734, 735, 737, 738, 739, 740, 741, 742, 743, 744, 745, 773,
+    774, 778, 779, 780, 12, 21, 35, 61, 69, 70, 86, 122,
+    699, 702, 703, 704, 705, 707, 708, 709, 713, 714, 738, 739,
+    740, 741, 742, 743, 744, 745, 746, 747, 749, 750, 751, 752,
+    753, 779, 780, 785, 786, 787, 788, 16, 40, 114, 127, 771,
+    775, 776, 777, 780, 781, 782, 783, 810, 811, 812, 815, 816,
+    817, 818, 823, 824, 825, 845, 846, 851, 852, 858, 859, 860,
+    861, 887, 894, 895, 902, 903, 923, 930, 939, 959, 966, 16,
+    40, 127, 776, 777, 781, 782, 783, 789, 816, 817, 818, 822,
+    823, 824, 825, 831, 851, 852, 858, 859, 860, 861, 866, 867,
+    887, 894, 895, 901, 902, 903, 930, 938, 939, 966, 974, 975,
+    38, 61, 70, 72, 122, 741, 743, 744, 745, 746, 747, 750,
+    751, 752, 753, 757, 758, 759, 779, 780, 781, 782, 785, 786,
+    787, 788, 789, 792, 793, 794, 795, 821, 822, 823, 824, 828,
+    829, 830, 831, 857, 864, 865, 866, 900, 88, 114, 123, 807,
+    812, 813, 842, 843, 846, 847, 848, 853, 877, 878, 882, 883,
+    888, 913, 914, 918, 924, 954, 20, 54, 84, 88, 93, 111,
+    114, 123, 807, 812, 813, 842, 843, 847, 848, 853, 854, 877,
+    878, 879, 882, 883, 888, 889, 897, 913, 914, 915, 918, 919,
+    924, 925, 949, 950, 951, 954, 955, 960, 961, 986, 987, 990,
+    991, 996, 40, 82, 84, 114, 123, 812, 813, 818, 819, 843,
+    847, 848, 849, 853, 854, 855, 860, 861, 882, 883, 888, 889,
+    895, 896, 897, 918, 919, 924, 925, 932, 933, 955, 960, 961,
+    968, 969, 991, 40, 82, 84, 111, 114, 123, 807, 811, 812,
+    813, 817, 818, 819, 846, 847, 848, 852, 853, 854, 860, 861,
+    882, 883, 888, 889, 895, 896, 897, 918, 919, 924, 925, 931,
+    932, 933, 954, 955, 960, 961, 967, 968, 969, 990, 991, 996,
+    1004, 9, 29, 36, 84, 123, 813, 848, 849, 853, 854, 855,
+    883, 884, 888, 889, 890, 896, 897, 919, 920, 921, 924, 925,
+    926, 932, 933, 955, 956, 957, 961, 962, 968, 969, 991, 992,
+    993, 997, 998, 1005, 1028, 1033, 9, 29, 84, 123, 853, 854,
+    889, 896, 897, 925, 932, 933, 961, 962, 968, 969, 997, 998,
+    1005, 9, 29, 81, 82, 84, 114, 123, 819, 853, 854, 861,
+    888, 889, 896, 897, 924, 925, 931, 932, 933, 960, 961, 967,
+    968, 969, 991, 992, 996, 997, 998, 1003, 1004, 1005, 1027, 1028,
+    1032, 1033, 1040, 1041, 1069, 1076, 9, 29, 36, 77, 81, 84,
+    849, 889, 897, 919, 920, 925, 926, 933, 955, 956, 957, 961,
+    962, 968, 969, 991, 992, 993, 996, 997, 998, 999, 1004, 1005,
+    1023, 1027, 1028, 1029, 1032, 1033, 1034, 1035, 1040, 1041, 1063, 1064,
+    1065, 1069, 1070, 1071, 1077, 9, 29, 36, 77, 81, 84, 889,
+    897, 925, 932, 933, 961, 962, 968, 969, 991, 992, 993, 996,
+    997, 998, 999, 1004, 1005, 1027, 1028, 1029, 1032, 1033, 1034, 1035,
+    1040, 1041, 1063, 1064, 1065, 1068, 1069, 1070, 1071, 1076, 1077, 20,
+    26, 29, 36, 54, 93, 110, 111, 843, 878, 879, 883, 914,
+    915, 919, 925, 949, 950, 951, 954, 955, 956, 961, 985, 986,
+    987, 990, 991, 992, 993, 996, 997, 1021, 1022, 1023, 1026, 1027,
+    1028, 1029, 1057, 1058, 1059, 1062, 1063, 1064, 26, 54, 110, 111,
+    950, 985, 986, 987, 990, 991, 1021, 1022, 1023, 1026, 1027, 1057,
+    1058, 1059, 1062, 1063, 1093, 1094, 1095, 1098, 1099, 1100, 26, 29,
+    36, 54, 81, 84, 110, 111, 919, 925, 951, 954, 955, 960,
+    961, 968, 969, 986, 987, 990, 991, 992, 996, 997, 1004, 1005,
+    1021, 1022, 1023, 1026, 1027, 1028, 1029, 1032, 1033, 1034, 1058, 1059,
+    1062, 1063, 1064, 1065, 1068, 1069, 26, 29, 54, 81, 87, 99,
+    110, 111, 954, 955, 960, 985, 986, 987, 990, 991, 996, 997,
+    1004, 1021, 1022, 1023, 1026, 1027, 1028, 1032, 1033, 1056, 1057, 1058,
+    1059, 1062, 1063, 1064, 1065, 1068, 1069, 1093, 1094, 1095, 1098, 1099,
+    1100, 1101, 1104, 1105, 1106, 1141, 26, 87, 110, 1021, 1022, 1026,
+    1057, 1058, 1059, 1062, 1063, 1093, 1094, 1095, 1098, 1099, 1100, 1129,
+    1130, 1131, 1134, 1135, 1136, 26, 87, 110, 1021, 1022, 1026, 1032,
+    1057, 1058, 1059, 1062, 1063, 1068, 1093, 1094, 1095, 1098, 1099, 1100,
+    1101, 1104, 1105, 1130, 1131, 1134, 1135, 1136, 1137, 1140, 1141, 81,
+    82, 84, 99, 133, 896, 931, 932, 967, 968, 969, 996, 1003,
+    1004, 1005, 1011, 1032, 1033, 1039, 1040, 1041, 1068, 1069, 1075, 1076,
+    1077, 1112, 1113, 9, 26, 29, 36, 81, 99, 133, 961, 968,
+    969, 991, 992, 996, 997, 998, 1004, 1005, 1026, 1027, 1028, 1029,
+    1032, 1033, 1034, 1035, 1039, 1040, 1041, 1059, 1062, 1063, 1064, 1065,
+    1068, 1069, 1070, 1071, 1075, 1076, 1077, 1100, 1101, 1105, 1106, 1107,
+    1112, 1113, 26, 29, 81, 87, 99, 110, 133, 991, 996, 997,
+    1004, 1005, 1026, 1027, 1028, 1032, 1033, 1039, 1040, 1041, 1058, 1059,
+    1062, 1063, 1064, 1065, 1068, 1069, 1070, 1075, 1076, 1077, 1098, 1099,
+    1100, 1101, 1104, 1105, 1106, 1107, 1111, 1112, 1113, 1141, 1142, 1148,
+    1149, 81, 99, 133, 968, 969, 997, 1004, 1005, 1032, 1033, 1034,
+    1039, 1040, 1041, 1064, 1065, 1068, 1069, 1070, 1071, 1075, 1076, 1077,
+    1105, 1106, 1107, 1112, 1113, 81, 99, 133, 1004, 1005, 1032, 1033,
+    1039, 1040, 1041, 1064, 1065, 1068, 1069, 1070, 1075, 1076, 1077, 1100,
+    1101, 1104, 1105, 1106, 1107, 1111, 1112, 1113, 1142, 1148, 1149, 26,
+    37, 52, 81, 87, 99, 110, 133, 1026, 1032, 1039, 1040, 1058,
+    1059, 1062, 1063, 1064, 1068, 1069, 1075, 1076, 1095, 1098, 1099, 1100,
+    1101, 1104, 1105, 1106, 1107, 1111, 1112, 1113, 1134, 1135, 1136, 1137,
+    1140, 1141, 1142, 1143, 1147, 1148, 1149, 37, 52, 87, 1098, 1099,
+    1100, 1101, 1104, 1105, 1111, 1112, 1135, 1136, 1137, 1140, 1141, 1142,
+    1143, 1148, 1149, 1171, 1176, 1177, 1178, 1184, 1185, 21, 129, 520,
+    551, 556, 587, 588, 592, 593, 620, 621, 623, 624, 625, 629,
+    656, 657, 659, 660, 661, 662, 663, 665, 692, 693, 695, 696,
+    697, 698, 699, 701, 12, 21, 118, 129, 520, 551, 556, 587,
+    588, 592, 593, 623, 624, 625, 626, 628, 629, 630, 659, 660,
+    661, 662, 663, 665, 666, 667, 696, 697, 698, 699, 701, 702,
+    703, 118, 479, 480, 485, 515, 516, 521, 548, 549, 551, 552,
+    553, 557, 558, 584, 585, 588, 589, 590, 593, 594, 620, 621,
+    624, 625, 626, 627, 629, 630, 631, 657, 660, 661, 662, 663,
+    665, 666, 667, 118, 407, 443, 449, 479, 480, 484, 485, 515,
+    516, 520, 521, 547, 548, 549, 551, 552, 556, 557, 583, 584,
+    585, 587, 588, 589, 592, 593, 594, 619, 620, 621, 623, 624,
+    625, 626, 627, 629, 630, 656, 657, 659, 660, 661, 662, 663,
+    665, 666, 667, 27, 330, 331, 332, 333, 335, 336, 366, 367,
+    368, 369, 371, 372, 402, 403, 404, 405, 407, 408, 438, 439,
+    440, 441, 443, 444, 474, 475, 476, 477, 479, 480, 510, 511,
+    512, 513, 515, 516, 547, 548, 549, 552, 584, 585, 27, 260,
+    261, 262, 264, 265, 266, 294, 295, 296, 297, 299, 300, 301,
+    330, 331, 332, 333, 335, 336, 366, 367, 368, 369, 371, 372,
+    402, 403, 404, 405, 407, 408, 438, 439, 440, 443, 474, 475,
+    479, 21, 69, 79, 118, 129, 593, 599, 625, 626, 629, 630,
+    631, 635, 636, 661, 662, 663, 666, 667, 668, 669, 672, 698,
+    699, 702, 703, 704, 708, 21, 35, 69, 79, 86, 132, 563,
+    599, 606, 630, 631, 635, 636, 637, 642, 643, 662, 663, 666,
+    667, 668, 669, 671, 672, 673, 674, 678, 679, 680, 699, 702,
+    703, 704, 705, 708, 709, 710, 715, 69, 79, 83, 118, 485,
+    491, 521, 527, 552, 553, 557, 558, 563, 588, 589, 590, 591,
+    593, 594, 595, 599, 600, 624, 625, 626, 627, 629, 630, 631,
+    632, 635, 636, 637, 661, 662, 663, 666, 667, 668, 669, 671,
+    672, 2, 19, 35, 79, 86, 132, 636, 637, 643, 644, 645,
+    668, 669, 673, 674, 675, 680, 681, 705, 709, 710, 711, 717,
+    43, 66, 83, 85, 118, 486, 492, 522, 528, 535, 554, 555,
+    558, 559, 564, 565, 571, 572, 590, 591, 594, 595, 596, 597,
+    600, 601, 602, 607, 608, 626, 627, 631, 632, 633, 636, 637,
+    638, 644, 668, 669, 2, 66, 83, 85, 101, 126, 528, 535,
+    564, 565, 571, 572, 573, 595, 596, 597, 600, 601, 602, 607,
+    608, 609, 631, 632, 633, 637, 638, 639, 644, 645, 669, 674,
+    675, 66, 75, 83, 85, 101, 126, 464, 487, 492, 493, 499,
+    500, 501, 523, 528, 529, 535, 536, 537, 543, 559, 560, 564,
+    565, 566, 571, 572, 573, 595, 596, 597, 600, 601, 602, 603,
+    608, 609, 632, 633, 637, 638, 639, 645, 43, 49, 410, 411,
+    415, 416, 445, 446, 447, 450, 451, 452, 456, 481, 482, 483,
+    486, 487, 488, 492, 517, 518, 519, 522, 523, 524, 528, 554,
+    555, 558, 559, 560, 591, 595, 596, 43, 49, 75, 138, 411,
+    414, 415, 416, 420, 446, 447, 450, 451, 452, 456, 457, 482,
+    483, 486, 487, 488, 492, 493, 518, 519, 522, 523, 524, 528,
+    529, 554, 555, 558, 559, 560, 564, 565, 591, 595, 596, 597,
+    43, 49, 410, 411, 415, 416, 446, 447, 450, 451, 452, 482,
+    483, 486, 487, 488, 518, 519, 522, 523, 524, 555, 559, 560,
+    43, 49, 75, 138, 380, 381, 411, 415, 416, 417, 420, 421,
+    446, 447, 450, 451, 452, 453, 456, 457, 483, 486, 487, 488,
+    489, 492, 493, 519, 522, 523, 524, 528, 529, 555, 559, 560,
+    561, 565, 597, 75, 126, 452, 457, 487, 488, 493, 500, 501,
+    523, 524, 525, 528, 529, 536, 537, 559, 560, 561, 565, 566,
+    572, 573, 596, 597, 601, 602, 603, 75, 452, 453, 458, 487,
+    488, 489, 493, 494, 501, 523, 524, 525, 529, 530, 536, 537,
+    560, 561, 565, 566, 567, 597, 603, 75, 85, 101, 126, 452,
+    453, 457, 465, 488, 489, 493, 494, 500, 501, 524, 525, 528,
+    529, 530, 535, 536, 537, 560, 561, 565, 566, 567, 572, 573,
+    596, 597, 601, 602, 603, 609, 639, 59, 74, 75, 126, 417,
+    422, 452, 453, 457, 458, 459, 465, 488, 489, 493, 494, 495,
+    500, 501, 524, 525, 529, 530, 531, 536, 537, 560, 561, 565,
+    566, 567, 573, 597, 602, 603, 66, 75, 85, 101, 126, 138,
+    420, 421, 427, 428, 429, 456, 457, 463, 464, 465, 492, 493,
+    499, 500, 501, 507, 528, 529, 535, 536, 537, 543, 560, 561,
+    564, 565, 566, 571, 572, 573, 596, 597, 601, 602, 603, 609,
+    13, 50, 59, 74, 75, 138, 380, 381, 385, 386, 387, 392,
+    393, 416, 417, 421, 422, 423, 428, 429, 452, 453, 457, 458,
+    459, 464, 465, 488, 489, 493, 494, 495, 500, 501, 524, 525,
+    529, 530, 531, 536, 537, 560, 561, 565, 566, 567, 603, 13,
+    50, 59, 138, 381, 386, 387, 416, 417, 421, 422, 423, 429,
+    453, 457, 458, 459, 465, 489, 494, 495, 525, 530, 24, 96,
+    337, 338, 369, 372, 373, 374, 375, 405, 408, 409, 410, 411,
+    445, 446, 481, 517, 95, 96, 337, 338, 339, 342, 372, 373,
+    374, 375, 378, 379, 408, 409, 410, 411, 414, 415, 445, 446,
+    450, 481, 486, 517, 43, 49, 96, 138, 344, 374, 375, 378,
+    379, 380, 381, 384, 385, 410, 411, 414, 415, 416, 417, 420,
+    421, 446, 447, 450, 451, 452, 456, 457, 482, 483, 486, 487,
+    492, 518, 519, 522, 523, 528, 555, 95, 96, 138, 337, 338,
+    339, 342, 343, 344, 345, 348, 349, 373, 374, 375, 378, 379,
+    380, 381, 384, 385, 409, 410, 411, 414, 415, 416, 420, 421,
+    446, 447, 450, 451, 456, 25, 95, 96, 301, 302, 303, 306,
+    307, 308, 312, 313, 336, 337, 338, 339, 341, 342, 343, 344,
+    347, 348, 372, 373, 374, 375, 377, 378, 379, 380, 383, 384,
+    409, 410, 411, 413, 414, 415, 419, 420, 445, 450, 455, 22,
+    25, 47, 95, 96, 271, 272, 277, 278, 284, 285, 301, 302,
+    303, 305, 306, 307, 308, 309, 311, 312, 313, 319, 336, 337,
+    338, 339, 341, 342, 343, 344, 347, 348, 372, 373, 374, 375,
+    377, 378, 379, 383, 384, 413, 419, 95, 96, 138, 302, 303,
+    306, 307, 308, 309, 312, 313, 314, 337, 338, 339, 342, 343,
+    344, 345, 348, 349, 373, 374, 375, 378, 379, 380, 381, 384,
+    385, 410, 411, 414, 415, 420, 22, 47, 95, 272, 278, 302,
+    303, 306, 307, 308, 309, 312, 313, 314, 337, 338, 339, 342,
+    343, 344, 345, 348, 349, 373, 374, 375, 378, 379, 384, 46,
+    47, 56, 138, 285, 286, 308, 309, 312, 313, 314, 315, 319,
+    320, 321, 343, 344, 345, 348, 349, 350, 355, 356, 357, 363,
+    379, 380, 381, 384, 385, 386, 391, 392, 393, 399, 420, 421,
+    427, 428, 429, 463, 150, 151, 152, 153, 154, 155, 156, 157,
+    158, 162, 186, 187, 188, 189, 190, 192, 193, 194, 195, 223,
+    224, 225, 226, 228, 229, 230, 260, 261, 262, 1157, 1158, 1159,
+    1160, 1161, 1163, 1164, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200,
+    1201, 78, 151, 152, 153, 154, 156, 157, 158, 159, 162, 163,
+    187, 188, 189, 190, 193, 194, 195, 225, 226, 230, 231, 1158,
+    1159, 1160, 1161, 1163, 1164, 1165, 1166, 1167, 1194, 1195, 1196, 1197,
+    1199, 1200, 1201, 1202, 1203, 1205, 1206, 115, 120, 152, 153, 154,
+    157, 187, 188, 189, 190, 192, 193, 194, 198, 199, 223, 224,
+    225, 226, 228, 229, 230, 231, 234, 235, 259, 260, 261, 262,
+    264, 265, 266, 267, 268, 270, 294, 295, 296, 297, 299, 300,
+    301, 115, 120, 193, 194, 199, 225, 226, 229, 230, 231, 232,
+    235, 236, 260, 261, 262, 265, 266, 267, 268, 271, 295, 296,
+    297, 300, 301, 302, 22, 95, 106, 115, 230, 235, 241, 262,
+    265, 266, 267, 268, 271, 272, 273, 277, 296, 297, 300, 301,
+    302, 303, 305, 306, 307, 308, 331, 332, 333, 336, 337, 338,
+    339, 341, 342, 369, 372, 22, 106, 115, 120, 230, 231, 232,
+    235, 236, 241, 242, 266, 267, 268, 271, 272, 273, 274, 297,
+    301, 302, 303, 306, 307, 115, 120, 152, 153, 154, 157, 158,
+    159, 162, 163, 187, 188, 189, 190, 192, 193, 194, 195, 196,
+    198, 199, 200, 224, 225, 226, 228, 229, 230, 231, 232, 234,
+    235, 236, 260, 261, 262, 265, 266, 267, 268, 1196, 1197, 115,
+    120, 194, 195, 199, 226, 230, 231, 232, 235, 262, 266, 267,
+    268, 14, 53, 106, 115, 120, 157, 158, 159, 162, 163, 168,
+    169, 193, 194, 195, 196, 198, 199, 200, 204, 205, 206, 225,
+    226, 229, 230, 231, 232, 234, 235, 236, 237, 240, 241, 242,
+    262, 265, 266, 267, 268, 270, 271, 272, 273, 14, 22, 106,
+    115, 120, 194, 195, 196, 199, 200, 205, 206, 230, 231, 232,
+    235, 236, 237, 238, 241, 242, 243, 266, 267, 268, 271, 272,
+    273, 274, 303, 10, 14, 15, 30, 41, 78, 106, 115, 120,
+    159, 160, 164, 194, 195, 196, 199, 200, 201, 205, 206, 207,
+    230, 231, 232, 235, 236, 237, 238, 241, 242, 243, 244, 267,
+    268, 272, 273, 274, 153, 154, 157, 158, 162, 163, 1051, 1052,
+    1087, 1088, 1089, 1092, 1093, 1094, 1097, 1123, 1124, 1125, 1128, 1129,
+    1130, 1131, 1133, 1134, 1135, 1159, 1160, 1161, 1164, 1165, 1166, 1167,
+    1169, 1170, 1171, 1172, 1195, 1196, 1197, 1200, 1201, 1202, 1203, 1205,
+    1206, 1207, 158, 163, 1089, 1092, 1093, 1094, 1095, 1098, 1125, 1128,
+    1129, 1130, 1131, 1134, 1135, 1136, 1137, 1164, 1165, 1166, 1167, 1170,
+    1171, 1172, 1173, 1201, 1202, 1203, 1206, 1207, 53, 87, 103, 163,
+    169, 1129, 1130, 1131, 1134, 1135, 1136, 1137, 1140, 1141, 1165, 1166,
+    1167, 1170, 1171, 1172, 1173, 1176, 1177, 1178, 1184, 1185, 1201, 1202,
+    1206, 1207, 1212, 1213, 1220, 1221, 10, 30, 41, 78, 153, 154,
+    157, 158, 159, 160, 162, 163, 164, 190, 194, 195, 196, 199,
+    200, 1160, 1161, 1165, 1166, 1167, 1170, 1171, 1196, 1197, 1200, 1201,
+    1202, 1203, 1206, 1207, 1208, 10, 30, 41, 78, 158, 159, 160,
+    163, 164, 195, 196, 200, 1165, 1166, 1167, 1170, 1171, 1172, 1173,
+    1201, 1202, 1203, 1206, 1207, 1208, 1209, 10, 18, 30, 41, 53,
+    78, 103, 158, 159, 160, 163, 164, 169, 170, 177, 178, 195,
+    196, 200, 206, 1165, 1166, 1167, 1170, 1171, 1172, 1173, 1176, 1177,
+    1178, 1201, 1202, 1203, 1206, 1207, 1208, 1209, 1212, 1213, 1214, 1220,
+    1221, 10, 14, 30, 41, 53, 78, 115, 120, 131, 158, 159,
+    160, 163, 164, 165, 169, 170, 194, 195, 196, 199, 200, 201,
+    205, 206, 207, 231, 232, 236, 237, 238, 1202, 1203, 1207, 1208,
+    10, 18, 30, 41, 53, 78, 131, 159, 160, 163, 164, 165,
+    166, 169, 170, 171, 177, 178, 195, 196, 200, 201, 202, 206,
+    207, 237, 238, 1202, 1203, 1207, 1208, 1209, 1213, 1214, 31, 62,
+    67, 107, 113, 174, 175, 176, 180, 181, 182, 183, 184, 210,
+    211, 212, 217, 218, 219, 220, 247, 248, 254, 255, 256, 1152,
+    1181, 1182, 1187, 1188, 1189, 1190, 1191, 1217, 1218, 1219, 1223, 1224,
+    1225, 1226, 1227, 11, 31, 68, 92, 105, 106, 116, 117, 128,
+    211, 212, 213, 214, 219, 220, 242, 247, 248, 249, 250, 255,
+    256, 277, 278, 283, 284, 285, 286, 291, 52, 62, 67, 103,
+    175, 176, 177, 184, 1103, 1110, 1111, 1118, 1119, 1139, 1140, 1141,
+    1142, 1146, 1147, 1148, 1149, 1154, 1155, 1175, 1176, 1177, 1178, 1179,
+    1182, 1183, 1184, 1185, 1190, 1191, 1211, 1212, 1213, 1218, 1219, 1220,
+    1221, 1226, 1227, 52, 53, 62, 67, 103, 116, 169, 175, 176,
+    177, 178, 184, 205, 212, 213, 1175, 1176, 1177, 1178, 1182, 1183,
+    1184, 1185, 1191, 1211, 1212, 1213, 1214, 1218, 1219, 1220, 1221, 1226,
+    1227, 15, 18, 31, 53, 62, 68, 103, 116, 131, 169, 170,
+    175, 176, 177, 178, 184, 205, 206, 212, 213, 214, 1173, 1178,
+    1212, 1213, 1214, 1215, 1219, 1220, 1221, 10, 14, 15, 18, 31,
+    41, 53, 62, 68, 116, 120, 131, 163, 164, 165, 169, 170,
+    171, 176, 177, 178, 196, 199, 200, 201, 202, 205, 206, 207,
+    212, 213, 214, 232, 236, 237, 238, 242, 243, 250, 1207, 1208,
+    1209, 1212, 1213, 1214, 1220, 1221, 10, 15, 18, 41, 53, 62,
+    116, 131, 164, 165, 169, 170, 171, 177, 178, 200, 201, 202,
+    206, 207, 214, 1173, 1207, 1208, 1209, 1213, 1214, 1215, 1221, 14,
+    15, 22, 31, 68, 106, 115, 116, 117, 120, 131, 199, 200,
+    201, 205, 206, 207, 213, 214, 232, 235, 236, 237, 238, 241,
+    242, 243, 244, 248, 249, 250, 267, 268, 271, 272, 273, 274,
+    277, 278, 279, 284, 285, 286, 11, 22, 25, 31, 47, 56,
+    68, 91, 92, 100, 106, 117, 128, 134, 241, 242, 248, 249,
+    250, 273, 277, 278, 279, 283, 284, 285, 286, 306, 307, 308,
+    311, 312, 313, 318, 319, 320, 321, 326, 327, 342, 347, 348,
+    354, 355, 361, 362, 363, 22, 25, 47, 56, 97, 106, 117,
+    242, 249, 250, 272, 273, 274, 277, 278, 279, 280, 284, 285,
+    286, 306, 307, 308, 309, 312, 313, 314, 315, 319, 320, 321,
+    327, 342, 343, 344, 348, 349, 355, 356, 363, 140, 141, 580,
+    616, 617, 652, 653, 654, 688, 689, 690, 691, 692, 724, 725,
+    726, 727, 728, 729, 730, 760, 761, 762, 763, 764, 765, 766,
+    767, 768, 796, 797, 798, 799, 802, 803, 832, 833, 838, 868,
+    874, 904, 940, 976, 34, 140, 141, 616, 617, 622, 652, 653,
+    654, 658, 688, 689, 690, 691, 692, 693, 694, 695, 724, 725,
+    726, 727, 728, 729, 730, 731, 732, 760, 761, 762, 763, 764,
+    765, 766, 767, 768, 769, 796, 797, 798, 802, 803, 832, 838,
+    874, 910, 34, 655, 659, 690, 691, 692, 693, 695, 696, 728,
+    729, 731, 732, 733, 34, 129, 586, 622, 623, 654, 655, 656,
+    657, 658, 659, 660, 661, 664, 690, 691, 692, 693, 694, 695,
+    696, 697, 698, 700, 728, 729, 730, 731, 732, 733, 734, 735,
+    736, 737, 738, 767, 768, 773, 21, 129, 693, 695, 696, 697,
+    698, 699, 700, 701, 702, 731, 732, 733, 734, 735, 736, 737,
+    738, 739, 740, 773, 774, 21, 34, 129, 628, 658, 659, 660,
+    661, 662, 664, 665, 692, 693, 694, 695, 696, 697, 698, 699,
+    700, 701, 702, 731, 732, 733, 734, 735, 736, 737, 738, 739,
+    773, 34, 71, 124, 127, 129, 693, 694, 695, 696, 697, 698,
+    700, 701, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739,
+    740, 766, 767, 768, 769, 770, 772, 773, 774, 775, 778, 779,
+    780, 802, 803, 808, 809, 814, 815, 838, 844, 850, 880, 886,
+    916, 763, 764, 765, 768, 769, 770, 771, 798, 799, 800, 801,
+    803, 804, 805, 806, 834, 835, 836, 837, 839, 840, 841, 845,
+    846, 869, 870, 871, 875, 876, 881, 906, 907, 911, 912, 942,
+    943, 947, 978, 983, 799, 800, 801, 834, 835, 836, 837, 840,
+    841, 870, 871, 872, 873, 875, 876, 906, 907, 908, 909, 912,
+    942, 943, 944, 945, 948, 978, 979, 980, 1015, 1016, 764, 765,
+    768, 769, 770, 771, 773, 774, 775, 776, 799, 800, 801, 803,
+    804, 805, 806, 809, 810, 811, 835, 839, 840, 841, 845, 846,
+    875, 876, 880, 881, 887, 911, 916, 917, 947, 953, 983, 728,
+    729, 762, 763, 764, 765, 767, 768, 769, 770, 771, 773, 774,
+    775, 798, 799, 800, 801, 803, 804, 805, 808, 809, 810, 834,
+    838, 839, 840, 844, 845, 874, 875, 880, 881, 910, 911, 916,
+    917, 946, 947, 952, 982, 983, 988, 1024, 127, 735, 768, 769,
+    770, 771, 773, 774, 775, 776, 777, 780, 781, 804, 805, 806,
+    809, 810, 811, 815, 816, 839, 840, 845, 846, 851, 852, 880,
+    881, 886, 887, 916, 917, 922, 923, 124, 127, 733, 734, 735,
+    767, 768, 769, 770, 771, 773, 774, 775, 776, 779, 780, 803,
+    804, 805, 808, 809, 810, 815, 816, 839, 844, 845, 850, 851,
+    880, 881, 886, 887, 916, 917, 922, 923, 952, 958, 988, 994,
+    1024, 1060, 33, 770, 771, 800, 801, 804, 805, 806, 807, 809,
+    810, 811, 839, 840, 841, 845, 846, 875, 876, 881, 887, 911,
+    912, 917, 923, 947, 948, 953, 983, 984, 989, 1019, 1020, 1025,
+    161, 808, 838, 844, 850, 874, 880, 886, 910, 916, 922, 946,
+    952, 958, 982, 988, 994, 1018, 1019, 1024, 1030, 1054, 1055, 1060,
+    1066, 1090, 1091, 1096, 1097, 1102, 1126, 1127, 1132, 1133, 1138, 1162,
+    1163, 1168, 1169, 1174, 1175, 1198, 1204, 1210, 12, 21, 69, 129,
+    634, 660, 661, 662, 664, 665, 666, 670, 671, 696, 697, 698,
+    699, 700, 701, 702, 703, 704, 706, 707, 708, 733, 734, 735,
+    737, 738, 739, 740, 743, 744, 745, 12, 21, 71, 124, 129,
+    592, 598, 628, 634, 660, 661, 664, 665, 670, 671, 695, 696,
+    697, 698, 699, 700, 701, 702, 703, 706, 707, 732, 733, 734,
+    735, 736, 737, 738, 739, 740, 742, 743, 744, 745, 772, 773,
+    778, 779, 12, 21, 35, 69, 86, 122, 129, 634, 641, 665,
+    666, 670, 671, 672, 677, 678, 698, 699, 701, 702, 703, 704,
+    705, 706, 707, 708, 709, 713, 714, 715, 738, 739, 740, 743,
+    744, 745, 746, 749, 750, 751, 752, 12, 21, 61, 122, 604,
+    634, 640, 641, 665, 670, 671, 676, 677, 678, 699, 701, 702,
+    703, 706, 707, 708, 712, 713, 714, 738, 739, 740, 742, 743,
+    744, 745, 748, 749, 750, 751, 752, 778, 779, 784, 785, 786,
+    787, 12, 19, 35, 61, 69, 70, 86, 102, 109, 122, 132,
+    678, 703, 704, 705, 707, 708, 709, 710, 711, 713, 714, 715,
+    716, 717, 721, 722, 723, 740, 741, 743, 744, 745, 746, 747,
+    750, 751, 752, 753, 757, 758, 759, 61, 70, 102, 109, 122,
+    707, 708, 713, 714, 715, 743, 744, 745, 746, 747, 749, 750,
+    751, 752, 753, 757, 758, 759, 785, 786, 787, 788, 793, 794,
+    795, 19, 35, 61, 86, 102, 109, 122, 132, 678, 686, 687,
+    705, 708, 709, 710, 711, 714, 715, 716, 717, 721, 722, 723,
+    745, 746, 747, 750, 751, 752, 753, 757, 758, 759, 19, 35,
+    86, 102, 109, 122, 132, 649, 650, 677, 678, 679, 680, 684,
+    685, 686, 687, 705, 708, 709, 710, 711, 713, 714, 715, 716,
+    717, 720, 721, 722, 723, 750, 751, 752, 753, 758, 759, 61,
+    70, 102, 109, 122, 713, 714, 715, 716, 720, 721, 722, 723,
+    746, 747, 749, 750, 751, 752, 753, 756, 757, 758, 759, 787,
+    792, 793, 794, 795, 3, 61, 63, 102, 109, 122, 611, 647,
+    648, 649, 650, 677, 678, 679, 682, 683, 684, 685, 686, 687,
+    713, 714, 715, 716, 718, 719, 720, 721, 722, 723, 749, 750,
+    751, 752, 753, 755, 756, 757, 758, 759, 791, 792, 793, 794,
+    795, 16, 40, 82, 114, 123, 777, 811, 812, 816, 817, 818,
+    824, 825, 852, 853, 859, 860, 861, 887, 888, 894, 895, 896,
+    903, 923, 924, 930, 931, 967, 16, 40, 82, 114, 123, 776,
+    777, 783, 810, 811, 812, 816, 817, 818, 823, 824, 825, 845,
+    846, 851, 852, 858, 859, 860, 861, 881, 887, 888, 894, 895,
+    902, 903, 917, 923, 924, 930, 931, 938, 939, 953, 959, 966,
+    967, 975, 989, 995, 1002, 1031, 16, 40, 817, 818, 824, 825,
+    859, 860, 861, 894, 895, 903, 931, 939, 16, 40, 816, 817,
+    823, 824, 825, 851, 852, 858, 859, 860, 866, 867, 887, 894,
+    895, 901, 902, 903, 923, 930, 931, 938, 939, 959, 966, 967,
+    974, 975, 1002, 1010, 1011, 16, 38, 70, 122, 780, 781, 782,
+    786, 787, 788, 789, 794, 795, 822, 823, 824, 825, 829, 830,
+    831, 857, 858, 859, 864, 865, 866, 867, 893, 900, 901, 902,
+    903, 929, 936, 937, 938, 70, 72, 122, 785, 786, 787, 788,
+    789, 793, 794, 795, 821, 822, 823, 828, 829, 830, 831, 857,
+    858, 864, 865, 866, 867, 893, 899, 900, 901, 902, 929, 936,
+    937, 972, 822, 823, 824, 830, 831, 858, 865, 866, 867, 901,
+    902, 903, 937, 938, 939, 973, 974, 72, 821, 822, 823, 829,
+    830, 831, 857, 858, 864, 865, 866, 867, 893, 900, 901, 902,
+    903, 929, 936, 937, 938, 965, 972, 973, 974, 1001, 1008, 1009,
+    1037, 1044, 824, 858, 859, 866, 867, 901, 902, 903, 930, 937,
+    938, 939, 966, 973, 974, 975, 1002, 1009, 1010, 1011, 1046, 108,
+    857, 858, 864, 865, 866, 867, 893, 900, 901, 902, 903, 929,
+    930, 936, 937, 938, 939, 965, 966, 972, 973, 974, 975, 1001,
+    1002, 1008, 1009, 1010, 1011, 1037, 1044, 1045, 1046, 1073, 1080, 1081,
+    1117, 20, 93, 843, 848, 849, 854, 878, 879, 883, 884, 889,
+    914, 915, 919, 920, 925, 951, 955, 956, 961, 991, 20, 54,
+    93, 111, 123, 843, 847, 848, 854, 877, 878, 879, 882, 883,
+    888, 889, 913, 914, 915, 918, 919, 924, 925, 950, 951, 954,
+    955, 956, 960, 961, 986, 987, 991, 1023, 1027, 9, 20, 29,
+    93, 848, 849, 854, 879, 883, 884, 889, 915, 919, 920, 921,
+    925, 926, 951, 955, 956, 957, 961, 962, 987, 991, 992, 993,
+    997, 9, 20, 29, 54, 93, 848, 878, 879, 883, 889, 914,
+    915, 919, 920, 925, 950, 951, 955, 956, 961, 986, 987, 991,
+    992, 993, 997, 1023, 1027, 1028, 9, 29, 81, 84, 848, 883,
+    889, 897, 919, 925, 933, 955, 956, 960, 961, 968, 969, 991,
+    992, 993, 996, 997, 1004, 1005, 1027, 1028, 1033, 20, 54, 88,
+    93, 806, 807, 836, 837, 841, 842, 843, 871, 872, 873, 876,
+    877, 878, 879, 882, 907, 908, 909, 912, 913, 914, 915, 918,
+    943, 944, 945, 948, 949, 950, 951, 980, 981, 984, 985, 986,
+    1017, 1021, 33, 88, 93, 111, 806, 807, 837, 841, 842, 843,
+    846, 847, 872, 873, 876, 877, 878, 882, 908, 909, 912, 913,
+    914, 918, 944, 945, 948, 949, 950, 954, 981, 985, 986, 990,
+    1021, 88, 801, 807, 835, 836, 837, 840, 841, 842, 870, 871,
+    872, 873, 876, 877, 906, 907, 908, 909, 912, 913, 914, 942,
+    943, 944, 945, 948, 949, 950, 978, 979, 980, 981, 984, 985,
+    986, 1015, 1016, 1017, 1020, 1021, 1051, 1052, 1053, 20, 54, 88,
+    93, 837, 842, 843, 872, 873, 876, 877, 878, 879, 882, 883,
+    908, 909, 912, 913, 914, 915, 918, 919, 944, 945, 948, 949,
+    950, 951, 954, 955, 980, 981, 984, 985, 986, 987, 1017, 1021,
+    1022, 1023, 20, 54, 88, 93, 110, 111, 842, 843, 847, 873,
+    877, 878, 879, 882, 883, 909, 913, 914, 915, 918, 919, 945,
+    949, 950, 951, 954, 955, 981, 985, 986, 987, 990, 991, 1021,
+    1022, 1023, 1058, 54, 88, 842, 872, 873, 877, 878, 908, 909,
+    912, 913, 914, 944, 945, 948, 949, 950, 979, 980, 981, 984,
+    985, 986, 987, 1015, 1016, 1017, 1020, 1021, 1022, 1051, 1052, 1053,
+    1056, 1057, 26, 33, 54, 88, 110, 111, 842, 873, 877, 882,
+    908, 909, 912, 913, 914, 918, 944, 945, 948, 949, 950, 954,
+    980, 981, 984, 985, 986, 987, 990, 991, 1015, 1016, 1017, 1020,
+    1021, 1022, 1023, 1026, 1051, 1052, 1053, 1056, 1057, 1058, 1059, 1093,
+    1094, 1095, 33, 88, 111, 123, 806, 807, 811, 812, 813, 841,
+    842, 843, 846, 847, 852, 853, 876, 877, 878, 881, 882, 888,
+    912, 913, 914, 917, 918, 919, 924, 948, 949, 950, 954, 960,
+    984, 985, 986, 990, 1021, 1026, 26, 33, 81, 82, 110, 111,
+    123, 882, 888, 918, 924, 953, 954, 959, 960, 967, 984, 985,
+    986, 989, 990, 991, 995, 996, 1020, 1021, 1022, 1023, 1025, 1026,
+    1027, 1031, 1032, 1056, 1057, 1058, 1059, 1061, 1062, 1063, 1067, 1068,
+    1093, 1094, 1095, 1098, 1099, 1104, 944, 945, 948, 980, 981, 984,
+    985, 1015, 1016, 1017, 1020, 1021, 1022, 1051, 1052, 1053, 1056, 1057,
+    1087, 1088, 1089, 1092, 1093, 1094, 1128, 1129, 26, 110, 949, 981,
+    984, 985, 990, 1016, 1017, 1020, 1021, 1022, 1026, 1051, 1052, 1053,
+    1056, 1057, 1058, 1059, 1088, 1089, 1092, 1093, 1094, 1095, 1098, 1128,
+    1129, 1130, 1131, 979, 980, 984, 1015, 1016, 1017, 1020, 1050, 1051,
+    1052, 1053, 1055, 1056, 1057, 1087, 1088, 1089, 1091, 1092, 1093, 1094,
+    1123, 1124, 1125, 1128, 1129, 1130, 1131, 1134, 1159, 1160, 1161, 1164,
+    1165, 1166, 1170, 1016, 1017, 1020, 1051, 1052, 1053, 1056, 1057, 1088,
+    1089, 1092, 1093, 1094, 1095, 1124, 1125, 1128, 1129, 1130, 1131, 1134,
+    1164, 1165, 1166, 33, 846, 881, 887, 917, 923, 947, 952, 953,
+    958, 959, 983, 984, 988, 989, 990, 994, 995, 1019, 1020, 1021,
+    1024, 1025, 1026, 1030, 1031, 1055, 1056, 1057, 1060, 1061, 1066, 1067,
+    1091, 1092, 1093, 1096, 1097, 1098, 1103, 1133, 1134, 1139, 989, 1020,
+    1025, 1031, 1056, 1057, 1061, 1067, 1092, 1093, 1094, 1095, 1097, 1098,
+    1099, 1103, 1104, 1128, 1129, 1130, 1131, 1133, 1134, 1135, 1139, 1140,
+    1164, 1165, 1169, 1170, 1171, 1175, 1176, 1177, 16, 40, 82, 84,
+    114, 123, 811, 812, 813, 817, 818, 846, 852, 853, 859, 860,
+    861, 887, 888, 894, 895, 896, 903, 923, 924, 930, 931, 932,
+    939, 959, 960, 966, 967, 968, 995, 996, 1002, 1003, 82, 84,
+    114, 123, 853, 861, 888, 895, 896, 924, 931, 932, 960, 967,
+    968, 990, 996, 1003, 1004, 1026, 1032, 1039, 16, 40, 82, 84,
+    114, 817, 818, 825, 852, 859, 860, 861, 894, 895, 896, 902,
+    903, 930, 931, 932, 938, 939, 966, 967, 968, 974, 975, 1002,
+    1003, 1011, 1038, 1039, 1047, 82, 84, 99, 133, 860, 861, 895,
+    896, 903, 930, 931, 932, 939, 966, 967, 968, 975, 996, 1002,
+    1003, 1004, 1011, 1032, 1038, 1039, 1040, 1047, 1075, 29, 81, 82,
+    84, 99, 111, 114, 123, 133, 853, 888, 895, 896, 918, 924,
+    925, 931, 932, 933, 954, 955, 960, 961, 967, 968, 969, 990,
+    991, 996, 997, 1003, 1004, 1005, 1026, 1027, 1032, 1033, 1039, 1040,
+    1041, 1062, 1063, 1068, 1075, 1076, 26, 29, 81, 82, 84, 99,
+    111, 123, 133, 924, 925, 932, 933, 960, 961, 967, 968, 969,
+    990, 991, 992, 996, 997, 1003, 1004, 1005, 1026, 1027, 1028, 1032,
+    1033, 1039, 1040, 1041, 1059, 1062, 1063, 1064, 1068, 1069, 1075, 1076,
+    1077, 1105, 1112, 1113, 26, 81, 99, 133, 960, 968, 996, 1003,
+    1004, 1026, 1027, 1032, 1033, 1039, 1040, 1041, 1062, 1063, 1068, 1069,
+    1075, 1076, 1098, 1099, 1100, 1104, 1105, 1111, 1112, 1113, 81, 82,
+    99, 108, 133, 931, 966, 967, 968, 975, 996, 1002, 1003, 1004,
+    1010, 1011, 1031, 1032, 1038, 1039, 1040, 1046, 1047, 1067, 1068, 1074,
+    1075, 1076, 1082, 1083, 1104, 1110, 1111, 1112, 1119, 1148, 81, 99,
+    133, 968, 1003, 1004, 1032, 1039, 1040, 1041, 1068, 1075, 1076, 1083,
+    1104, 1105, 1111, 1112, 1113, 26, 52, 81, 87, 99, 133, 967,
+    995, 996, 1002, 1003, 1025, 1026, 1031, 1032, 1038, 1039, 1059, 1061,
+    1062, 1063, 1067, 1068, 1074, 1075, 1076, 1095, 1097, 1098, 1099, 1100,
+    1103, 1104, 1105, 1110, 1111, 1112, 1113, 1134, 1135, 1136, 1139, 1140,
+    1141, 1146, 1147, 1148, 1149, 52, 81, 99, 108, 133, 966, 967,
+    975, 995, 1002, 1003, 1011, 1031, 1032, 1038, 1039, 1040, 1046, 1047,
+    1067, 1068, 1074, 1075, 1076, 1082, 1083, 1103, 1104, 1105, 1110, 1111,
+    1112, 1113, 1118, 1119, 1139, 1140, 1141, 1146, 1147, 1148, 1149, 1155,
+    1183, 1184, 52, 87, 103, 1031, 1061, 1067, 1074, 1097, 1098, 1099,
+    1103, 1104, 1110, 1111, 1112, 1133, 1134, 1135, 1136, 1137, 1139, 1140,
+    1141, 1146, 1147, 1148, 1149, 1170, 1171, 1175, 1176, 1177, 1183, 1184,
+    1185, 108, 130, 867, 901, 902, 903, 936, 937, 938, 939, 965,
+    966, 972, 973, 974, 975, 1001, 1002, 1008, 1009, 1010, 1011, 1037,
+    1038, 1044, 1045, 1046, 1047, 1073, 1074, 1080, 1081, 1082, 1083, 1109,
+    1110, 1111, 1116, 1117, 1118, 1119, 1146, 1147, 1152, 1153, 1154, 1155,
+    52, 99, 108, 133, 966, 967, 975, 1002, 1003, 1010, 1011, 1038,
+    1039, 1040, 1045, 1046, 1047, 1067, 1068, 1074, 1075, 1076, 1081, 1082,
+    1083, 1103, 1104, 1110, 1111, 1112, 1117, 1118, 1119, 1140, 1146, 1147,
+    1148, 1149, 1154, 1155, 1183, 1184, 1191, 52, 99, 133, 1003, 1038,
+    1039, 1040, 1047, 1068, 1074, 1075, 1076, 1082, 1083, 1104, 1110, 1111,
+    1112, 1113, 1119, 1140, 1141, 1147, 1148, 1149, 1155, 1184, 52, 99,
+    103, 108, 1002, 1038, 1046, 1047, 1067, 1074, 1075, 1081, 1082, 1083,
+    1103, 1110, 1111, 1112, 1117, 1118, 1119, 1140, 1146, 1147, 1148, 1149,
+    1154, 1155, 1182, 1183, 1184, 1185, 1190, 1191, 1218, 1219, 1227, 52,
+    103, 1074, 1083, 1110, 1111, 1112, 1119, 1147, 1148, 1149, 1183, 1184,
+    1185, 24, 118, 441, 444, 445, 477, 480, 481, 512, 513, 516,
+    517, 521, 548, 549, 552, 553, 554, 557, 558, 585, 588, 589,
+    590, 591, 594, 625, 626, 627, 24, 118, 445, 480, 481, 485,
+    486, 516, 517, 521, 522, 552, 553, 554, 557, 558, 588, 589,
+    590, 591, 594, 595, 625, 626, 627, 630, 631, 24, 43, 49,
+    410, 445, 446, 477, 480, 481, 482, 483, 512, 513, 516, 517,
+    518, 521, 549, 552, 553, 554, 555, 589, 590, 591, 24, 43,
+    49, 410, 411, 445, 446, 447, 450, 480, 481, 482, 483, 486,
+    516, 517, 518, 519, 521, 522, 553, 554, 555, 558, 559, 589,
+    590, 591, 594, 595, 627, 24, 27, 118, 372, 377, 407, 408,
+    409, 413, 443, 444, 445, 449, 450, 479, 480, 481, 484, 485,
+    486, 515, 516, 517, 520, 521, 522, 551, 552, 553, 554, 557,
+    558, 587, 588, 589, 590, 591, 593, 594, 624, 625, 626, 627,
+    629, 630, 631, 663, 27, 95, 265, 266, 267, 270, 271, 276,
+    297, 299, 300, 301, 302, 303, 305, 306, 307, 331, 332, 333,
+    335, 336, 337, 338, 341, 342, 368, 369, 371, 372, 373, 374,
+    377, 378, 407, 408, 409, 413, 443, 444, 449, 479, 69, 79,
+    83, 118, 132, 527, 534, 558, 563, 564, 570, 571, 594, 595,
+    600, 601, 607, 608, 627, 630, 631, 632, 633, 636, 637, 638,
+    643, 644, 663, 666, 667, 668, 669, 672, 673, 674, 69, 79,
+    83, 118, 132, 491, 527, 534, 557, 563, 570, 594, 595, 599,
+    600, 606, 607, 627, 630, 631, 632, 635, 636, 637, 642, 643,
+    663, 666, 667, 668, 669, 672, 673, 674, 2, 79, 83, 85,
+    132, 564, 571, 600, 601, 607, 608, 609, 631, 632, 633, 636,
+    637, 638, 639, 643, 644, 645, 667, 668, 669, 672, 673, 674,
+    675, 680, 681, 2, 85, 132, 571, 600, 607, 608, 609, 633,
+    637, 638, 639, 643, 644, 645, 669, 673, 674, 675, 680, 681,
+    2, 19, 35, 69, 79, 86, 132, 599, 606, 635, 636, 637,
+    642, 643, 644, 645, 651, 667, 668, 669, 672, 673, 674, 675,
+    678, 679, 680, 681, 703, 704, 705, 708, 709, 710, 711, 715,
+    716, 717, 2, 19, 35, 79, 86, 132, 578, 606, 607, 614,
+    615, 636, 637, 642, 643, 644, 645, 650, 651, 669, 672, 673,
+    674, 675, 678, 679, 680, 681, 687, 705, 708, 709, 710, 711,
+    715, 716, 717, 723, 2, 79, 132, 498, 506, 534, 541, 542,
+    543, 570, 571, 577, 578, 579, 600, 606, 607, 608, 614, 615,
+    636, 637, 638, 642, 643, 644, 645, 650, 651, 669, 672, 673,
+    674, 675, 679, 680, 681, 687, 43, 49, 83, 446, 447, 450,
+    451, 481, 482, 483, 486, 487, 492, 517, 518, 519, 522, 523,
+    528, 553, 554, 555, 558, 559, 560, 564, 565, 590, 591, 594,
+    595, 596, 597, 600, 601, 627, 631, 632, 633, 43, 83, 486,
+    487, 492, 522, 523, 528, 535, 555, 558, 559, 560, 564, 565,
+    571, 591, 595, 596, 597, 600, 601, 602, 632, 633, 638, 43,
+    83, 118, 445, 449, 450, 455, 480, 481, 485, 486, 491, 516,
+    517, 521, 522, 527, 552, 553, 554, 555, 557, 558, 559, 563,
+    564, 588, 589, 590, 591, 593, 594, 595, 596, 599, 600, 625,
+    626, 627, 630, 631, 632, 633, 636, 663, 667, 668, 79, 83,
+    118, 450, 455, 462, 486, 491, 498, 521, 522, 527, 528, 534,
+    535, 557, 558, 559, 563, 564, 570, 571, 591, 594, 595, 596,
+    599, 600, 601, 606, 607, 608, 627, 630, 631, 632, 633, 636,
+    637, 638, 643, 668, 669, 66, 85, 101, 420, 427, 428, 456,
+    462, 463, 464, 471, 492, 498, 499, 500, 506, 507, 534, 535,
+    536, 542, 543, 564, 565, 570, 571, 572, 573, 579, 601, 602,
+    607, 608, 609, 633, 638, 639, 66, 75, 85, 101, 126, 416,
+    421, 451, 452, 453, 456, 457, 464, 465, 486, 487, 488, 489,
+    492, 493, 499, 500, 501, 522, 523, 524, 525, 528, 529, 535,
+    536, 537, 559, 560, 561, 564, 565, 566, 572, 573, 595, 596,
+    597, 601, 602, 603, 609, 633, 66, 75, 101, 138, 415, 416,
+    420, 421, 428, 450, 451, 452, 456, 457, 463, 464, 465, 486,
+    487, 488, 492, 493, 499, 500, 501, 522, 523, 524, 528, 529,
+    535, 536, 559, 560, 564, 565, 571, 572, 573, 595, 596, 597,
+    601, 602, 75, 416, 417, 421, 422, 451, 452, 453, 457, 458,
+    464, 465, 487, 488, 489, 492, 493, 494, 500, 501, 523, 524,
+    525, 528, 529, 530, 536, 537, 559, 560, 561, 565, 566, 573,
+    597, 75, 138, 380, 381, 385, 415, 416, 417, 420, 421, 422,
+    428, 429, 451, 452, 453, 456, 457, 458, 464, 465, 487, 488,
+    492, 493, 499, 500, 501, 523, 524, 528, 529, 536, 559, 560,
+    565, 50, 75, 417, 421, 422, 429, 452, 453, 457, 458, 464,
+    465, 489, 493, 494, 500, 501, 525, 529, 530, 536, 537, 561,
+    565, 566, 573, 597, 603, 50, 138, 381, 385, 386, 393, 416,
+    417, 421, 422, 428, 429, 452, 453, 456, 457, 458, 464, 465,
+    492, 493, 499, 500, 501, 528, 529, 536, 537, 565, 573, 43,
+    49, 96, 374, 375, 378, 379, 409, 410, 411, 414, 415, 416,
+    420, 445, 446, 447, 450, 451, 456, 481, 482, 483, 486, 487,
+    492, 517, 518, 519, 522, 523, 528, 554, 555, 558, 559, 591,
+    43, 96, 138, 374, 375, 378, 379, 380, 384, 410, 411, 414,
+    415, 416, 420, 421, 446, 447, 450, 451, 452, 455, 456, 457,
+    482, 483, 486, 487, 491, 492, 519, 522, 523, 528, 555, 558,
+    559, 564, 591, 95, 96, 338, 339, 342, 343, 373, 374, 375,
+    378, 379, 409, 410, 411, 414, 415, 445, 446, 450, 486, 25,
+    95, 96, 138, 338, 339, 342, 343, 344, 347, 348, 373, 374,
+    375, 377, 378, 379, 380, 383, 384, 385, 409, 410, 411, 413,
+    414, 415, 416, 419, 420, 421, 446, 447, 450, 451, 455, 456,
+    486, 491, 492, 522, 527, 96, 138, 342, 343, 348, 349, 354,
+    355, 356, 378, 379, 380, 383, 384, 385, 390, 391, 392, 414,
+    415, 419, 420, 421, 426, 427, 428, 450, 455, 456, 462, 463,
+    464, 492, 499, 138, 379, 380, 381, 384, 385, 386, 392, 393,
+    415, 416, 417, 420, 421, 422, 428, 429, 451, 452, 456, 457,
+    464, 465, 487, 492, 500, 96, 138, 339, 342, 343, 344, 345,
+    348, 349, 350, 355, 356, 357, 375, 378, 379, 380, 381, 384,
+    385, 386, 391, 392, 393, 411, 414, 415, 416, 417, 420, 421,
+    422, 427, 428, 429, 450, 451, 456, 463, 464, 492, 66, 101,
+    138, 384, 385, 391, 392, 393, 420, 421, 427, 428, 429, 435,
+    456, 457, 462, 463, 464, 465, 471, 492, 499, 500, 507, 535,
+    543, 571, 572, 56, 66, 101, 138, 348, 349, 354, 355, 356,
+    357, 363, 384, 385, 390, 391, 392, 393, 398, 399, 420, 421,
+    426, 427, 428, 429, 434, 435, 456, 462, 463, 464, 470, 471,
+    498, 499, 507, 543, 50, 138, 357, 380, 381, 384, 385, 386,
+    392, 393, 416, 417, 420, 421, 422, 427, 428, 429, 456, 457,
+    463, 464, 465, 500, 138, 344, 345, 348, 349, 350, 355, 356,
+    357, 380, 381, 384, 385, 386, 391, 392, 393, 420, 421, 427,
+    428, 429, 456, 463, 464, 25, 56, 96, 307, 308, 312, 313,
+    319, 320, 321, 339, 342, 343, 347, 348, 349, 354, 355, 356,
+    378, 379, 383, 384, 385, 390, 391, 392, 414, 419, 420, 426,
+    427, 428, 455, 462, 463, 25, 46, 56, 95, 96, 138, 307,
+    308, 309, 312, 313, 314, 315, 319, 320, 321, 338, 339, 342,
+    343, 344, 345, 348, 349, 350, 355, 356, 357, 375, 378, 379,
+    380, 381, 384, 385, 386, 391, 392, 393, 414, 415, 420, 427,
+    428, 22, 47, 56, 286, 307, 308, 309, 312, 313, 314, 315,
+    320, 321, 339, 342, 343, 344, 345, 348, 349, 355, 356, 384,
+    25, 56, 100, 312, 313, 318, 319, 320, 321, 327, 348, 349,
+    354, 355, 356, 357, 362, 363, 384, 385, 390, 391, 392, 393,
+    398, 399, 420, 426, 427, 428, 434, 435, 462, 463, 471, 25,
+    56, 100, 284, 285, 286, 312, 313, 318, 319, 320, 321, 327,
+    348, 349, 354, 355, 356, 357, 362, 363, 390, 391, 392, 398,
+    399, 149, 150, 151, 152, 153, 154, 156, 157, 185, 186, 187,
+    188, 189, 190, 192, 193, 221, 222, 223, 224, 225, 226, 257,
+    258, 259, 260, 261, 262, 292, 293, 294, 295, 328, 364, 1120,
+    1156, 1157, 1158, 1159, 1160, 1192, 1193, 1194, 1195, 1196, 1197, 1199,
+    198, 228, 229, 230, 234, 235, 260, 261, 262, 264, 265, 266,
+    267, 268, 270, 271, 272, 294, 295, 296, 297, 299, 300, 301,
+    302, 303, 304, 305, 306, 330, 331, 332, 333, 335, 336, 337,
+    340, 367, 371, 198, 204, 229, 230, 234, 235, 240, 241, 264,
+    265, 266, 267, 268, 269, 270, 271, 272, 276, 277, 297, 299,
+    300, 301, 302, 303, 304, 305, 306, 332, 333, 335, 336, 337,
+    338, 340, 341, 371, 372, 376, 377, 407, 412, 115, 120, 193,
+    194, 198, 199, 228, 229, 230, 231, 232, 234, 235, 236, 261,
+    262, 264, 265, 266, 267, 268, 270, 271, 272, 296, 297, 299,
+    300, 301, 302, 303, 305, 106, 115, 120, 198, 199, 204, 205,
+    229, 230, 231, 232, 234, 235, 236, 240, 241, 242, 264, 265,
+    266, 267, 268, 270, 271, 272, 276, 277, 299, 300, 301, 302,
+    303, 305, 306, 10, 30, 41, 53, 78, 115, 120, 157, 158,
+    159, 160, 162, 163, 164, 169, 193, 194, 195, 196, 198, 199,
+    200, 201, 205, 206, 229, 230, 231, 232, 235, 236, 237, 267,
+    268, 1201, 1202, 1203, 1206, 1207, 10, 14, 53, 106, 115, 120,
+    163, 164, 169, 194, 195, 196, 199, 200, 201, 205, 206, 230,
+    231, 232, 235, 236, 237, 241, 242, 268, 103, 1092, 1097, 1103,
+    1128, 1129, 1130, 1131, 1133, 1134, 1135, 1139, 1140, 1164, 1165, 1166,
+    1167, 1169, 1170, 1171, 1175, 1176, 1177, 1200, 1201, 1205, 1206, 1211,
+    1212, 53, 103, 157, 158, 162, 163, 168, 169, 176, 1128, 1129,
+    1130, 1131, 1133, 1134, 1139, 1164, 1165, 1166, 1167, 1169, 1170, 1171,
+    1172, 1175, 1176, 1177, 1183, 1184, 1200, 1201, 1202, 1203, 1205, 1206,
+    1207, 1211, 1212, 1213, 1219, 1220, 10, 41, 53, 62, 103, 157,
+    158, 159, 162, 163, 164, 168, 169, 170, 176, 177, 194, 195,
+    199, 205, 1164, 1165, 1166, 1167, 1169, 1170, 1171, 1172, 1175, 1176,
+    1177, 1200, 1201, 1202, 1203, 1205, 1206, 1207, 1208, 1211, 1212, 1213,
+    1219, 1220, 1221, 10, 30, 41, 53, 62, 78, 116, 120, 157,
+    158, 159, 160, 162, 163, 164, 168, 169, 170, 176, 177, 178,
+    194, 195, 196, 199, 200, 205, 206, 231, 232, 1166, 1167, 1201,
+    1202, 1203, 1206, 1207, 1208, 1212, 1213, 1220, 11, 14, 15, 31,
+    53, 62, 68, 106, 116, 117, 128, 131, 169, 175, 176, 177,
+    178, 184, 204, 205, 206, 211, 212, 213, 214, 219, 220, 236,
+    240, 241, 242, 243, 247, 248, 249, 250, 256, 272, 276, 277,
+    278, 283, 284, 285, 286, 67, 107, 175, 182, 183, 184, 1109,
+    1117, 1118, 1145, 1146, 1153, 1154, 1155, 1182, 1183, 1189, 1190, 1191,
+    1218, 1219, 1225, 1226, 1227, 5, 11, 25, 31, 56, 91, 92,
+    100, 105, 117, 128, 134, 220, 247, 248, 249, 250, 254, 255,
+    256, 276, 277, 282, 283, 284, 285, 286, 290, 291, 311, 312,
+    317, 318, 319, 320, 324, 325, 326, 327, 347, 353, 354, 360,
+    361, 389, 11, 31, 67, 68, 92, 105, 128, 174, 175, 181,
+    182, 183, 184, 210, 211, 212, 213, 217, 218, 219, 220, 246,
+    247, 248, 249, 253, 254, 255, 256, 283, 284, 31, 62, 67,
+    68, 107, 116, 175, 176, 182, 183, 184, 211, 212, 213, 218,
+    219, 220, 247, 248, 249, 256, 1226, 1227, 52, 62, 103, 176,
+    1103, 1110, 1134, 1135, 1139, 1140, 1141, 1146, 1147, 1148, 1170, 1171,
+    1172, 1175, 1176, 1177, 1182, 1183, 1184, 1185, 1206, 1211, 1212, 1213,
+    1218, 1219, 1220, 1221, 52, 87, 103, 1134, 1135, 1136, 1137, 1140,
+    1141, 1142, 1147, 1148, 1149, 1171, 1172, 1173, 1176, 1177, 1178, 1183,
+    1184, 1185, 1212, 1213, 1219, 1220, 1221, 53, 62, 103, 116, 163,
+    168, 169, 175, 176, 177, 178, 205, 213, 1170, 1171, 1172, 1173,
+    1175, 1176, 1177, 1182, 1183, 1184, 1185, 1206, 1207, 1211, 1212, 1213,
+    1218, 1219, 1220, 1221, 52, 53, 62, 103, 116, 169, 176, 177,
+    178, 1137, 1171, 1172, 1173, 1176, 1177, 1178, 1179, 1183, 1184, 1185,
+    1207, 1208, 1212, 1213, 1214, 1219, 1220, 1221, 10, 53, 62, 116,
+    163, 169, 170, 176, 177, 178, 200, 205, 206, 213, 214, 1207,
+    1208, 1212, 1213, 1219, 1220, 1221, 10, 18, 41, 53, 62, 116,
+    164, 169, 170, 176, 177, 178, 206, 214, 1172, 1173, 1178, 1207,
+    1208, 1209, 1212, 1213, 1214, 1220, 1221, 14, 22, 47, 95, 106,
+    117, 236, 237, 242, 267, 268, 271, 272, 273, 274, 277, 278,
+    279, 301, 302, 303, 306, 307, 308, 309, 312, 313, 337, 338,
+    339, 342, 343, 14, 22, 25, 47, 95, 97, 106, 117, 236,
+    241, 242, 243, 249, 250, 271, 272, 273, 274, 277, 278, 279,
+    280, 284, 285, 286, 302, 303, 306, 307, 308, 309, 312, 313,
+    314, 319, 320, 321, 337, 338, 339, 342, 343, 344, 348, 14,
+    15, 22, 28, 47, 106, 115, 117, 120, 131, 200, 201, 206,
+    207, 214, 232, 236, 237, 238, 241, 242, 243, 244, 250, 267,
+    268, 271, 272, 273, 274, 277, 278, 279, 280, 303, 14, 15,
+    22, 28, 47, 68, 97, 106, 117, 131, 206, 207, 214, 236,
+    237, 238, 241, 242, 243, 244, 249, 250, 268, 272, 273, 274,
+    277, 278, 279, 280, 285, 286, 308, 309, 34, 690, 691, 692,
+    693, 694, 695, 696, 697, 726, 727, 728, 729, 730, 731, 732,
+    733, 734, 735, 736, 737, 762, 763, 764, 765, 766, 767, 768,
+    769, 770, 772, 773, 774, 802, 803, 808, 809, 726, 727, 728,
+    729, 730, 731, 732, 733, 734, 735, 763, 764, 765, 766, 767,
+    768, 769, 770, 772, 773, 774, 802, 803, 804, 808, 809, 838,
+    844, 874, 34, 622, 653, 654, 655, 656, 658, 659, 660, 689,
+    690, 691, 692, 693, 694, 695, 696, 697, 700, 725, 726, 727,
+    728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 766, 767,
+    768, 772, 773, 802, 34, 141, 142, 622, 658, 689, 690, 691,
+    692, 693, 694, 695, 725, 726, 727, 728, 729, 730, 731, 732,
+    733, 734, 736, 766, 767, 768, 772, 773, 802, 803, 808, 838,
+    844, 874, 34, 39, 71, 124, 129, 143, 622, 628, 658, 659,
+    660, 664, 665, 692, 693, 694, 695, 696, 697, 698, 700, 701,
+    730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 766, 767,
+    768, 772, 773, 778, 808, 34, 39, 48, 71, 124, 142, 143,
+    622, 628, 658, 659, 664, 694, 695, 696, 700, 701, 730, 731,
+    732, 733, 734, 735, 736, 737, 738, 766, 767, 768, 772, 773,
+    802, 808, 809, 814, 844, 850, 762, 763, 764, 765, 768, 769,
+    770, 798, 799, 800, 801, 803, 804, 805, 833, 834, 835, 839,
+    840, 869, 875, 905, 762, 763, 764, 765, 768, 769, 770, 798,
+    799, 800, 801, 803, 804, 805, 833, 834, 835, 836, 839, 840,
+    869, 870, 871, 874, 875, 905, 906, 910, 911, 941, 942, 946,
+    947, 977, 978, 983, 1013, 798, 799, 800, 801, 833, 834, 835,
+    836, 837, 840, 869, 870, 871, 872, 875, 905, 906, 907, 911,
+    941, 942, 943, 977, 978, 979, 1013, 1014, 1050, 800, 801, 834,
+    835, 836, 837, 870, 871, 872, 875, 876, 905, 906, 907, 908,
+    912, 941, 942, 943, 944, 977, 978, 979, 980, 1013, 1014, 1015,
+    1016, 1050, 1051, 1087, 799, 800, 801, 804, 805, 806, 834, 835,
+    836, 837, 839, 840, 841, 870, 871, 872, 875, 876, 881, 906,
+    907, 908, 911, 912, 917, 942, 943, 947, 948, 978, 979, 983,
+    33, 800, 801, 805, 806, 807, 835, 836, 837, 840, 841, 846,
+    870, 871, 872, 873, 875, 876, 881, 906, 907, 908, 909, 911,
+    912, 917, 942, 943, 944, 945, 947, 948, 953, 978, 979, 980,
+    983, 984, 1014, 1015, 1016, 1019, 1020, 765, 798, 799, 800, 801,
+    803, 804, 805, 833, 834, 835, 836, 837, 839, 840, 869, 870,
+    871, 874, 875, 876, 881, 905, 906, 907, 910, 911, 912, 917,
+    941, 942, 943, 946, 947, 977, 978, 979, 983, 1013, 1014, 1015,
+    1019, 1049, 1050, 1055, 724, 725, 726, 727, 728, 760, 761, 762,
+    763, 764, 765, 796, 797, 798, 799, 800, 801, 832, 833, 834,
+    835, 868, 869, 870, 904, 905, 906, 940, 941, 976, 977, 1012,
+    1013, 1048, 1084, 1120, 725, 760, 761, 762, 763, 764, 765, 796,
+    797, 798, 799, 800, 801, 832, 833, 834, 835, 836, 839, 868,
+    869, 870, 871, 875, 904, 905, 906, 907, 911, 940, 941, 942,
+    976, 977, 978, 1012, 1013, 1014, 1048, 1049, 1084, 1085, 1086, 1120,
+    1121, 1157, 725, 726, 727, 728, 729, 761, 762, 763, 764, 765,
+    767, 768, 769, 796, 797, 798, 799, 800, 802, 803, 804, 832,
+    833, 834, 838, 839, 868, 869, 874, 904, 905, 910, 940, 941,
+    946, 976, 977, 982, 1012, 764, 765, 797, 798, 799, 800, 801,
+    832, 833, 834, 835, 836, 839, 868, 869, 870, 871, 875, 904,
+    905, 906, 907, 911, 940, 941, 942, 943, 947, 976, 977, 978,
+    979, 1012, 1013, 1014, 1015, 1048, 1049, 1050, 1084, 1085, 1086, 1087,
+    1120, 1121, 1122, 1157, 800, 801, 834, 835, 836, 869, 870, 871,
+    875, 905, 906, 907, 911, 941, 942, 943, 977, 978, 979, 980,
+    1013, 1014, 1015, 1016, 1049, 1050, 1051, 1085, 1086, 1087, 1088, 1121,
+    1122, 1123, 150, 833, 834, 835, 868, 869, 870, 904, 905, 906,
+    940, 941, 942, 943, 976, 977, 978, 979, 1012, 1013, 1014, 1015,
+    1048, 1049, 1050, 1051, 1084, 1085, 1086, 1087, 1088, 1120, 1121, 1122,
+    1123, 1124, 1125, 1156, 1157, 1158, 1159, 1160, 1192, 1193, 1194, 1195,
+    33, 127, 770, 771, 775, 776, 777, 804, 805, 806, 809, 810,
+    811, 815, 816, 817, 839, 840, 845, 846, 851, 852, 875, 880,
+    881, 886, 887, 894, 911, 916, 917, 922, 923, 947, 952, 953,
+    959, 983, 989, 995, 33, 805, 806, 810, 811, 816, 840, 845,
+    846, 851, 852, 881, 887, 894, 911, 917, 923, 947, 953, 959,
+    983, 989, 995, 1025, 1031, 127, 769, 770, 771, 803, 804, 805,
+    808, 809, 810, 815, 816, 839, 840, 844, 845, 850, 851, 875,
+    880, 881, 886, 887, 910, 911, 916, 917, 922, 923, 946, 947,
+    952, 953, 958, 959, 983, 988, 989, 994, 995, 1019, 1024, 1030,
+    1055, 1060, 1066, 1096, 1102, 726, 727, 728, 729, 730, 731, 732,
+    761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 772, 773,
+    774, 797, 798, 799, 802, 803, 804, 808, 809, 838, 839, 844,
+    845, 874, 875, 880, 910, 916, 946, 952, 982, 1018, 71, 124,
+    127, 730, 731, 732, 733, 734, 735, 736, 737, 766, 767, 768,
+    769, 770, 772, 773, 774, 778, 779, 802, 803, 804, 808, 809,
+    814, 815, 838, 839, 844, 845, 850, 851, 874, 880, 886, 910,
+    916, 922, 946, 952, 958, 982, 988, 1018, 1024, 71, 124, 766,
+    767, 768, 769, 770, 772, 773, 774, 802, 803, 804, 808, 809,
+    814, 815, 838, 839, 844, 845, 850, 851, 874, 880, 886, 910,
+    916, 922, 946, 952, 958, 982, 988, 994, 1018, 1024, 1030, 1054,
+    1060, 1090, 1096, 1132, 39, 48, 71, 124, 142, 143, 694, 700,
+    730, 731, 736, 766, 767, 768, 772, 773, 802, 803, 808, 814,
+    838, 844, 850, 880, 886, 916, 952, 155, 802, 803, 838, 839,
+    844, 874, 880, 910, 911, 916, 946, 947, 952, 976, 982, 983,
+    988, 1012, 1013, 1018, 1019, 1024, 1048, 1049, 1054, 1055, 1060, 1084,
+    1085, 1090, 1091, 1096, 1121, 1126, 1127, 1132, 1162, 1163, 1168, 1198,
+    1204, 803, 804, 808, 809, 815, 838, 839, 844, 845, 850, 851,
+    874, 880, 886, 910, 916, 917, 922, 946, 947, 952, 953, 958,
+    982, 983, 988, 994, 1018, 1019, 1024, 1030, 1054, 1060, 1066, 1090,
+    1096, 1102, 1132, 1138, 844, 845, 851, 880, 881, 886, 911, 916,
+    917, 922, 923, 946, 947, 952, 953, 958, 959, 982, 983, 988,
+    989, 994, 995, 1018, 1019, 1024, 1025, 1030, 1031, 1054, 1055, 1060,
+    1061, 1066, 1090, 1091, 1096, 1097, 1102, 1127, 1132, 1133, 1138, 1139,
+    1168, 35, 69, 86, 132, 671, 672, 678, 679, 703, 704, 705,
+    707, 708, 709, 710, 714, 715, 716, 744, 745, 750, 751, 752,
+    35, 86, 102, 132, 678, 679, 686, 704, 705, 708, 709, 710,
+    714, 715, 716, 717, 722, 723, 750, 751, 752, 753, 759, 12,
+    61, 86, 102, 109, 122, 604, 640, 641, 670, 671, 676, 677,
+    678, 706, 707, 708, 712, 713, 714, 715, 720, 743, 744, 745,
+    748, 749, 750, 751, 752, 753, 756, 757, 758, 759, 785, 786,
+    787, 793, 794, 795, 61, 102, 109, 122, 640, 641, 647, 648,
+    676, 677, 678, 679, 683, 684, 685, 686, 708, 712, 713, 714,
+    715, 716, 719, 720, 721, 722, 723, 749, 750, 751, 752, 753,
+    755, 756, 757, 758, 759, 786, 792, 793, 794, 795, 38, 127,
+    734, 735, 738, 739, 740, 741, 744, 745, 770, 771, 773, 774,
+    775, 776, 777, 779, 780, 781, 782, 783, 787, 788, 789, 809,
+    810, 815, 816, 822, 823, 824, 851, 858, 71, 124, 127, 733,
+    734, 735, 737, 738, 739, 740, 741, 743, 744, 745, 773, 774,
+    775, 776, 778, 779, 780, 781, 786, 787, 788, 808, 809, 814,
+    815, 816, 821, 822, 823, 850, 851, 857, 886, 16, 127, 774,
+    775, 776, 777, 779, 780, 781, 782, 809, 810, 815, 816, 817,
+    822, 823, 824, 825, 845, 851, 858, 859, 887, 893, 894, 127,
+    735, 773, 774, 775, 776, 779, 780, 781, 809, 810, 814, 815,
+    816, 822, 823, 850, 851, 857, 858, 886, 893, 922, 929, 958,
+    38, 70, 122, 127, 739, 740, 741, 744, 745, 746, 747, 752,
+    775, 776, 779, 780, 781, 782, 783, 786, 787, 788, 789, 815,
+    816, 822, 823, 824, 830, 831, 858, 866, 867, 16, 38, 70,
+    127, 776, 780, 781, 782, 787, 788, 789, 815, 816, 822, 823,
+    824, 825, 831, 851, 857, 858, 859, 865, 866, 867, 893, 901,
+    902, 70, 72, 122, 127, 779, 780, 781, 785, 786, 787, 788,
+    789, 814, 815, 816, 821, 822, 823, 824, 829, 830, 831, 850,
+    851, 857, 858, 864, 865, 866, 867, 886, 892, 893, 900, 901,
+    902, 922, 928, 929, 936, 937, 965, 39, 48, 71, 124, 143,
+    144, 664, 670, 700, 706, 736, 737, 742, 743, 772, 773, 778,
+    779, 808, 814, 815, 821, 844, 850, 856, 857, 886, 892, 922,
+    928, 958, 964, 16, 127, 774, 775, 776, 777, 780, 781, 782,
+    809, 810, 811, 815, 816, 817, 822, 823, 824, 825, 845, 851,
+    852, 858, 859, 887, 893, 894, 923, 929, 930, 959, 966, 127,
+    773, 774, 775, 776, 779, 780, 809, 810, 814, 815, 816, 822,
+    823, 844, 845, 850, 851, 857, 858, 859, 880, 886, 887, 893,
+    894, 916, 922, 923, 929, 930, 952, 958, 959, 965, 988, 994,
+    1001, 1030, 1066, 16, 777, 810, 811, 815, 816, 817, 823, 824,
+    825, 845, 851, 852, 858, 859, 860, 887, 893, 894, 895, 903,
+    917, 923, 929, 930, 931, 939, 953, 959, 965, 966, 967, 989,
+    995, 1002, 1025, 1031, 1038, 16, 127, 780, 781, 782, 815, 816,
+    822, 823, 824, 825, 831, 851, 857, 858, 859, 865, 866, 867,
+    893, 894, 901, 902, 903, 929, 930, 937, 938, 939, 965, 966,
+    973, 974, 72, 127, 779, 780, 786, 815, 816, 821, 822, 823,
+    824, 830, 831, 850, 851, 857, 858, 859, 864, 865, 866, 867,
+    886, 892, 893, 894, 900, 901, 902, 903, 922, 929, 930, 936,
+    937, 938, 939, 958, 965, 972, 973, 974, 994, 1001, 1008, 1009,
+    1030, 1037, 16, 816, 823, 824, 825, 851, 858, 859, 866, 867,
+    887, 893, 894, 895, 901, 902, 903, 923, 929, 930, 931, 937,
+    938, 939, 959, 965, 966, 973, 974, 975, 995, 1001, 1002, 1009,
+    1010, 1011, 1038, 1046, 71, 124, 772, 773, 778, 779, 808, 809,
+    814, 815, 821, 822, 844, 850, 851, 857, 858, 880, 886, 892,
+    893, 916, 922, 928, 929, 952, 958, 964, 965, 988, 994, 1001,
+    1024, 1030, 1060, 1066, 1096, 1102, 1138, 815, 844, 850, 851, 857,
+    858, 880, 886, 892, 893, 916, 922, 923, 928, 929, 930, 952,
+    958, 959, 964, 965, 966, 988, 994, 995, 1000, 1001, 1002, 1024,
+    1030, 1031, 1036, 1037, 1060, 1066, 1072, 1073, 1096, 1102, 1103, 1109,
+    1132, 1138, 1139, 1145, 1174, 850, 886, 893, 916, 922, 929, 952,
+    958, 965, 988, 994, 1001, 1024, 1030, 1037, 1060, 1066, 1073, 1096,
+    1102, 1109, 1132, 1138, 1145, 1168, 1174, 1175, 1181, 1210, 108, 130,
+    857, 858, 866, 886, 892, 893, 900, 901, 922, 928, 929, 936,
+    937, 938, 958, 964, 965, 966, 972, 973, 974, 994, 1000, 1001,
+    1008, 1009, 1010, 1030, 1036, 1037, 1044, 1045, 1066, 1072, 1073, 1102,
+    1108, 1109, 1117, 1145, 57, 61, 70, 72, 102, 109, 122, 714,
+    720, 721, 722, 750, 751, 752, 753, 755, 756, 757, 758, 759,
+    791, 792, 793, 794, 795, 827, 828, 829, 830, 831, 863, 864,
+    57, 61, 70, 72, 109, 122, 755, 756, 757, 758, 759, 791,
+    792, 793, 794, 795, 826, 827, 828, 829, 830, 831, 862, 863,
+    864, 865, 866, 898, 899, 900, 901, 934, 935, 936, 970, 971,
+    972, 1006, 1007, 1042, 1043, 1078, 1079, 57, 130, 863, 864, 865,
+    866, 867, 899, 900, 901, 935, 936, 937, 938, 971, 972, 973,
+    974, 1006, 1007, 1008, 1009, 1010, 1042, 1043, 1044, 1045, 1046, 1078,
+    1079, 1080, 1081, 1082, 1115, 1116, 1117, 1118, 1151, 1152, 1153, 1154,
+    1188, 1189, 29, 54, 81, 82, 84, 111, 114, 123, 813, 847,
+    848, 849, 853, 854, 882, 883, 888, 889, 896, 897, 918, 919,
+    920, 924, 925, 932, 933, 954, 955, 956, 960, 961, 968, 969,
+    986, 987, 990, 991, 992, 996, 997, 1023, 1027, 1032, 29, 81,
+    82, 84, 111, 123, 813, 848, 853, 854, 888, 889, 896, 897,
+    924, 925, 932, 933, 955, 960, 961, 968, 969, 991, 996, 997,
+    1004, 1005, 1027, 33, 88, 806, 807, 836, 837, 840, 841, 842,
+    846, 871, 872, 873, 876, 877, 881, 882, 907, 908, 909, 911,
+    912, 913, 917, 918, 943, 944, 945, 947, 948, 949, 953, 979,
+    980, 981, 983, 984, 985, 1015, 1016, 1017, 1020, 1052, 1056, 33,
+    82, 84, 111, 114, 123, 806, 807, 811, 812, 813, 817, 818,
+    841, 842, 846, 847, 852, 853, 860, 861, 881, 882, 887, 888,
+    895, 896, 917, 918, 923, 924, 931, 932, 953, 954, 959, 960,
+    967, 989, 990, 995, 996, 33, 82, 84, 111, 114, 123, 812,
+    813, 846, 847, 852, 853, 882, 888, 895, 896, 918, 924, 931,
+    932, 954, 960, 990, 996, 1026, 33, 88, 111, 806, 807, 811,
+    840, 841, 842, 846, 876, 877, 881, 882, 911, 912, 913, 917,
+    918, 947, 948, 949, 953, 954, 983, 984, 985, 989, 1020, 1025,
+    1056, 1061, 33, 54, 88, 93, 111, 123, 842, 843, 847, 877,
+    878, 882, 883, 888, 913, 914, 915, 918, 919, 924, 949, 950,
+    951, 954, 955, 960, 985, 986, 987, 990, 991, 996, 1021, 1022,
+    1023, 1026, 33, 82, 84, 111, 123, 847, 853, 882, 888, 896,
+    918, 919, 924, 932, 954, 955, 960, 968, 990, 991, 996, 1022,
+    1026, 1032, 26, 54, 110, 111, 913, 918, 949, 950, 954, 960,
+    984, 985, 986, 987, 990, 991, 996, 1017, 1020, 1021, 1022, 1023,
+    1026, 1027, 1053, 1056, 1057, 1058, 1059, 1061, 1062, 1093, 1094, 1095,
+    1098, 1099, 835, 836, 837, 870, 871, 872, 873, 876, 906, 907,
+    908, 909, 912, 942, 943, 944, 945, 947, 948, 978, 979, 980,
+    981, 983, 984, 1014, 1015, 1016, 1017, 1049, 1050, 1051, 1052, 1053,
+    1086, 1087, 1088, 1089, 837, 871, 872, 907, 908, 909, 912, 943,
+    944, 945, 948, 978, 979, 980, 981, 984, 1014, 1015, 1016, 1017,
+    1050, 1051, 1052, 1053, 1087, 1088, 1089, 943, 978, 979, 980, 1014,
+    1015, 1016, 1017, 1050, 1051, 1052, 1053, 1086, 1087, 1088, 1089, 1122,
+    1123, 1124, 1125, 1158, 1159, 1160, 1161, 943, 947, 978, 979, 980,
+    983, 984, 1014, 1015, 1016, 1017, 1019, 1020, 1050, 1051, 1052, 1053,
+    1055, 1056, 1086, 1087, 1088, 1089, 1091, 1092, 1093, 1122, 1123, 1124,
+    1125, 1127, 1128, 1129, 1130, 1158, 1159, 1160, 1161, 1163, 1164, 1165,
+    33, 876, 881, 912, 917, 947, 948, 949, 953, 980, 983, 984,
+    985, 989, 990, 1015, 1016, 1017, 1019, 1020, 1021, 1025, 1026, 1050,
+    1051, 1052, 1053, 1055, 1056, 1057, 1061, 1087, 1088, 1089, 1091, 1092,
+    1093, 1097, 1098, 1128, 1129, 1133, 1134, 989, 995, 1019, 1025, 1031,
+    1055, 1056, 1060, 1061, 1067, 1091, 1092, 1093, 1097, 1098, 1103, 1127,
+    1128, 1129, 1133, 1134, 1139, 1164, 1169, 1170, 1175, 1176, 1205, 1211,
+    948, 984, 985, 989, 990, 1016, 1017, 1020, 1021, 1022, 1025, 1026,
+    1051, 1052, 1053, 1055, 1056, 1057, 1058, 1061, 1062, 1088, 1089, 1092,
+    1093, 1094, 1095, 1097, 1098, 1128, 1129, 1130, 1133, 1134, 26, 110,
+    985, 990, 1017, 1020, 1021, 1022, 1025, 1026, 1052, 1053, 1056, 1057,
+    1058, 1059, 1061, 1062, 1089, 1092, 1093, 1094, 1095, 1097, 1098, 1099,
+    1129, 1130, 1131, 1134, 1135, 953, 959, 984, 989, 990, 995, 1020,
+    1021, 1025, 1026, 1031, 1032, 1056, 1057, 1058, 1061, 1062, 1067, 1092,
+    1093, 1094, 1095, 1097, 1098, 1103, 1104, 1129, 1130, 1133, 1134, 1139,
+    1140, 26, 110, 990, 1021, 1026, 1032, 1056, 1057, 1058, 1059, 1061,
+    1062, 1067, 1068, 1093, 1094, 1095, 1097, 1098, 1099, 1103, 1104, 1134,
+    1135, 1140, 984, 989, 1020, 1025, 1051, 1052, 1053, 1055, 1056, 1057,
+    1061, 1087, 1088, 1089, 1091, 1092, 1093, 1094, 1095, 1097, 1098, 1124,
+    1125, 1128, 1129, 1130, 1131, 1133, 1134, 1135, 1164, 1165, 1166, 1169,
+    1170, 1020, 1052, 1053, 1056, 1057, 1061, 1089, 1092, 1093, 1094, 1095,
+    1097, 1098, 1099, 1125, 1128, 1129, 1130, 1131, 1134, 1135, 1165, 1166,
+    1170, 1171, 82, 123, 811, 817, 846, 851, 852, 859, 860, 881,
+    887, 888, 894, 895, 917, 923, 924, 930, 931, 953, 959, 960,
+    966, 967, 989, 995, 996, 1002, 1003, 1025, 1031, 1038, 1061, 1067,
+    1103, 16, 82, 108, 123, 817, 851, 852, 858, 859, 860, 887,
+    893, 894, 895, 902, 903, 923, 924, 929, 930, 931, 938, 939,
+    959, 960, 965, 966, 967, 974, 975, 995, 996, 1001, 1002, 1003,
+    1010, 1011, 1031, 1037, 1038, 1039, 1067, 1074, 1103, 1110, 82, 99,
+    108, 123, 133, 860, 894, 895, 923, 924, 930, 931, 932, 939,
+    959, 960, 966, 967, 968, 975, 995, 996, 1002, 1003, 1004, 1011,
+    1031, 1032, 1038, 1039, 1067, 1074, 1075, 1103, 1104, 1110, 1111, 16,
+    82, 108, 858, 859, 860, 867, 894, 895, 901, 902, 903, 923,
+    929, 930, 931, 937, 938, 939, 959, 965, 966, 967, 973, 974,
+    975, 995, 1001, 1002, 1003, 1009, 1010, 1011, 1031, 1037, 1038, 1039,
+    1045, 1046, 1047, 1067, 1073, 1074, 1082, 1083, 1110, 108, 902, 903,
+    930, 938, 939, 966, 973, 974, 975, 1002, 1009, 1010, 1011, 1038,
+    1046, 1047, 1074, 1082, 82, 99, 108, 133, 894, 895, 903, 930,
+    931, 938, 939, 959, 966, 967, 968, 974, 975, 995, 1002, 1003,
+    1004, 1010, 1011, 1031, 1038, 1039, 1046, 1047, 1067, 1074, 1075, 1082,
+    1083, 1110, 1111, 1119, 108, 133, 903, 930, 931, 938, 939, 966,
+    967, 974, 975, 1002, 1003, 1009, 1010, 1011, 1038, 1039, 1045, 1046,
+    1047, 1074, 1075, 1081, 1082, 1083, 1110, 1111, 1118, 1119, 81, 82,
+    99, 111, 123, 924, 931, 954, 960, 967, 968, 990, 995, 996,
+    1003, 1004, 1025, 1026, 1027, 1031, 1032, 1038, 1039, 1040, 1061, 1062,
+    1067, 1068, 1075, 1098, 1099, 1104, 1111, 81, 82, 99, 133, 931,
+    960, 967, 968, 995, 996, 1002, 1003, 1004, 1031, 1032, 1038, 1039,
+    1040, 1067, 1068, 1074, 1075, 1104, 1111, 1112, 851, 887, 894, 917,
+    922, 923, 929, 930, 953, 958, 959, 965, 966, 967, 988, 989,
+    994, 995, 1001, 1002, 1024, 1025, 1030, 1031, 1037, 1038, 1060, 1061,
+    1066, 1067, 1073, 1074, 1096, 1097, 1102, 1103, 1109, 1110, 1133, 1139,
+    1146, 923, 959, 966, 989, 995, 1002, 1003, 1025, 1031, 1038, 1039,
+    1061, 1067, 1074, 1097, 1098, 1103, 1110, 1111, 1133, 1134, 1139, 1140,
+    1147, 99, 108, 923, 930, 939, 959, 966, 967, 974, 975, 995,
+    1001, 1002, 1003, 1010, 1011, 1031, 1037, 1038, 1039, 1046, 1047, 1067,
+    1073, 1074, 1075, 1081, 1082, 1083, 1103, 1104, 1109, 1110, 1111, 1118,
+    1119, 1139, 1140, 1146, 1147, 1155, 103, 989, 995, 1002, 1025, 1031,
+    1038, 1061, 1066, 1067, 1074, 1097, 1098, 1103, 1110, 1111, 1133, 1134,
+    1139, 1140, 1146, 1147, 1169, 1170, 1175, 1176, 1182, 1183, 1211, 103,
+    108, 995, 1001, 1002, 1010, 1031, 1037, 1038, 1045, 1046, 1066, 1067,
+    1073, 1074, 1081, 1082, 1102, 1103, 1109, 1110, 1111, 1117, 1118, 1119,
+    1139, 1140, 1145, 1146, 1147, 1153, 1154, 1155, 1175, 1176, 1181, 1182,
+    1183, 1184, 1190, 1191, 1211, 1218, 1219, 1227, 52, 103, 108, 1031,
+    1038, 1067, 1074, 1103, 1104, 1110, 1111, 1119, 1139, 1140, 1146, 1147,
+    1148, 1155, 1175, 1176, 1182, 1183, 1184, 1185, 52, 103, 1074, 1104,
+    1111, 1112, 1140, 1141, 1147, 1148, 1149, 1176, 1177, 1183, 1184, 1185,
+    108, 930, 938, 939, 966, 974, 975, 1002, 1003, 1009, 1010, 1011,
+    1037, 1038, 1039, 1045, 1046, 1047, 1073, 1074, 1075, 1081, 1082, 1083,
+    1109, 1110, 1111, 1117, 1118, 1119, 1146, 1147, 1153, 1154, 1155, 67,
+    103, 107, 108, 1002, 1009, 1010, 1037, 1038, 1045, 1046, 1047, 1073,
+    1074, 1080, 1081, 1082, 1083, 1109, 1110, 1111, 1116, 1117, 1118, 1119,
+    1145, 1146, 1147, 1153, 1154, 1155, 1181, 1182, 1183, 1184, 1189, 1190,
+    1191, 1218, 1219, 1226, 1227, 67, 107, 108, 130, 937, 972, 973,
+    974, 1001, 1008, 1009, 1010, 1037, 1043, 1044, 1045, 1046, 1073, 1079,
+    1080, 1081, 1082, 1109, 1115, 1116, 1117, 1118, 1119, 1145, 1146, 1151,
+    1152, 1153, 1154, 1155, 1181, 1188, 1189, 1190, 1191, 1224, 1225, 1226,
+    1227, 108, 1009, 1010, 1045, 1046, 1080, 1081, 1082, 1083, 1117, 1118,
+    1119, 1153, 1154, 1155, 1189, 1190, 1191, 1226, 1227, 24, 118, 405,
+    440, 441, 444, 445, 476, 477, 480, 481, 485, 511, 512, 513,
+    515, 516, 517, 521, 548, 549, 551, 552, 553, 554, 557, 584,
+    585, 588, 589, 590, 593, 621, 624, 625, 626, 627, 27, 118,
+    404, 405, 408, 409, 439, 440, 441, 443, 444, 445, 449, 475,
+    476, 477, 479, 480, 481, 485, 511, 512, 513, 515, 516, 521,
+    547, 548, 549, 551, 552, 553, 557, 583, 584, 585, 587, 588,
+    589, 593, 621, 624, 625, 626, 24, 43, 49, 405, 408, 409,
+    410, 440, 441, 444, 445, 446, 447, 449, 476, 477, 480, 481,
+    482, 485, 511, 512, 513, 516, 517, 518, 521, 548, 549, 552,
+    553, 554, 585, 589, 590, 591, 24, 43, 49, 96, 118, 374,
+    408, 409, 410, 411, 414, 444, 445, 446, 447, 449, 450, 480,
+    481, 482, 485, 486, 516, 517, 518, 521, 522, 552, 553, 554,
+    555, 557, 558, 589, 590, 591, 594, 627, 24, 27, 96, 118,
+    372, 373, 374, 375, 377, 378, 405, 408, 409, 410, 411, 413,
+    414, 441, 444, 445, 446, 449, 450, 477, 480, 481, 482, 485,
+    486, 516, 517, 521, 552, 553, 554, 557, 558, 589, 590, 594,
+    364, 400, 436, 437, 472, 473, 508, 509, 544, 545, 580, 581,
+    582, 616, 617, 618, 619, 652, 653, 654, 655, 656, 688, 689,
+    690, 691, 692, 724, 725, 726, 727, 728, 760, 761, 34, 436,
+    472, 508, 544, 545, 550, 580, 581, 582, 586, 616, 617, 618,
+    619, 620, 622, 652, 653, 654, 655, 656, 657, 658, 659, 688,
+    689, 690, 691, 692, 693, 694, 695, 724, 725, 726, 727, 728,
+    729, 730, 731, 761, 366, 402, 403, 437, 438, 439, 443, 473,
+    474, 475, 479, 509, 510, 511, 514, 515, 545, 546, 547, 548,
+    550, 551, 581, 582, 583, 584, 585, 587, 617, 618, 619, 620,
+    621, 623, 654, 655, 656, 657, 27, 334, 335, 340, 370, 371,
+    376, 406, 407, 412, 413, 442, 443, 448, 449, 478, 479, 484,
+    490, 514, 515, 520, 526, 550, 551, 556, 557, 562, 586, 587,
+    588, 592, 593, 598, 622, 623, 624, 628, 629, 657, 658, 659,
+    660, 661, 664, 665, 695, 700, 366, 367, 368, 402, 403, 404,
+    405, 437, 438, 439, 440, 441, 473, 474, 475, 476, 477, 509,
+    510, 511, 512, 513, 545, 546, 547, 548, 549, 582, 583, 584,
+    585, 619, 620, 621, 366, 367, 368, 369, 371, 402, 403, 404,
+    405, 407, 408, 438, 439, 440, 441, 443, 444, 473, 474, 475,
+    476, 477, 479, 480, 509, 510, 511, 512, 513, 515, 516, 546,
+    547, 548, 549, 551, 552, 582, 583, 584, 585, 587, 588, 620,
+    621, 258, 259, 260, 293, 294, 295, 296, 297, 328, 329, 330,
+    331, 332, 333, 364, 365, 366, 367, 368, 369, 400, 401, 402,
+    403, 404, 436, 437, 438, 439, 440, 472, 473, 474, 475, 508,
+    509, 510, 545, 546, 547, 581, 582, 583, 222, 223, 224, 228,
+    258, 259, 260, 261, 262, 264, 292, 293, 294, 295, 296, 297,
+    298, 299, 328, 329, 330, 331, 332, 333, 334, 364, 365, 366,
+    367, 368, 370, 400, 401, 402, 403, 406, 436, 437, 438, 472,
+    473, 474, 508, 509, 545, 223, 228, 258, 259, 260, 261, 262,
+    263, 264, 265, 293, 294, 295, 296, 297, 298, 299, 300, 329,
+    330, 331, 332, 333, 334, 335, 365, 366, 367, 368, 370, 371,
+    401, 402, 403, 406, 407, 437, 438, 442, 443, 473, 478, 509,
+    514, 27, 300, 301, 331, 332, 333, 335, 336, 337, 367, 368,
+    369, 371, 372, 373, 374, 377, 403, 404, 405, 407, 408, 409,
+    413, 439, 440, 441, 443, 444, 449, 475, 476, 477, 479, 480,
+    511, 512, 515, 27, 95, 96, 336, 337, 338, 341, 342, 368,
+    369, 371, 372, 373, 374, 375, 377, 378, 404, 405, 407, 408,
+    409, 410, 411, 413, 414, 441, 443, 444, 445, 446, 449, 450,
+    479, 480, 481, 485, 515, 516, 521, 552, 557, 27, 95, 96,
+    300, 301, 302, 305, 306, 332, 333, 335, 336, 337, 338, 341,
+    342, 368, 369, 371, 372, 373, 374, 375, 377, 378, 404, 405,
+    407, 408, 409, 410, 413, 414, 443, 444, 445, 449, 479, 480,
+    485, 515, 521, 27, 264, 295, 296, 297, 298, 299, 300, 301,
+    304, 305, 330, 331, 332, 333, 334, 335, 336, 340, 366, 367,
+    368, 369, 370, 371, 372, 376, 402, 403, 404, 405, 406, 407,
+    408, 412, 438, 439, 442, 443, 448, 478, 479, 484, 514, 515,
+    520, 551, 556, 27, 228, 233, 263, 264, 265, 266, 269, 270,
+    294, 295, 296, 297, 298, 299, 300, 301, 304, 305, 329, 330,
+    331, 332, 333, 334, 335, 336, 340, 366, 367, 368, 369, 370,
+    371, 372, 376, 402, 406, 407, 412, 442, 443, 448, 478, 484,
+    514, 27, 295, 296, 297, 299, 300, 301, 302, 305, 330, 331,
+    332, 333, 335, 336, 337, 367, 368, 369, 371, 372, 373, 377,
+    403, 404, 405, 407, 408, 439, 443, 27, 261, 262, 264, 265,
+    266, 267, 270, 271, 295, 296, 297, 299, 300, 301, 302, 303,
+    305, 306, 330, 331, 332, 333, 335, 336, 337, 338, 341, 366,
+    367, 368, 369, 371, 372, 373, 403, 404, 407, 408, 2, 79,
+    83, 132, 527, 534, 542, 563, 564, 570, 571, 579, 600, 601,
+    606, 607, 608, 615, 631, 632, 633, 636, 637, 638, 643, 644,
+    645, 667, 668, 669, 672, 673, 674, 675, 679, 680, 681, 2,
+    69, 79, 83, 132, 498, 527, 534, 541, 542, 563, 570, 571,
+    578, 579, 599, 600, 606, 607, 608, 614, 615, 631, 632, 635,
+    636, 637, 642, 643, 644, 645, 651, 667, 668, 669, 672, 673,
+    674, 679, 680, 681, 43, 49, 83, 446, 447, 450, 451, 456,
+    481, 482, 483, 486, 487, 492, 517, 518, 519, 522, 523, 527,
+    528, 553, 554, 555, 558, 559, 564, 590, 591, 594, 595, 596,
+    600, 627, 632, 43, 49, 83, 96, 118, 410, 411, 414, 445,
+    446, 447, 450, 451, 456, 481, 482, 483, 485, 486, 487, 491,
+    492, 517, 518, 519, 521, 522, 527, 528, 553, 554, 555, 558,
+    559, 563, 564, 589, 590, 591, 594, 595, 600, 627, 43, 66,
+    83, 450, 451, 456, 486, 487, 492, 499, 522, 523, 527, 528,
+    534, 535, 555, 558, 559, 564, 565, 571, 572, 591, 594, 595,
+    596, 600, 601, 631, 632, 633, 637, 2, 66, 79, 83, 85,
+    101, 492, 499, 527, 528, 534, 535, 543, 564, 570, 571, 572,
+    579, 595, 596, 600, 601, 602, 607, 608, 609, 631, 632, 633,
+    636, 637, 638, 639, 643, 644, 645, 668, 669, 674, 675, 2,
+    66, 101, 499, 535, 543, 571, 572, 579, 601, 607, 608, 609,
+    637, 638, 639, 644, 645, 675, 2, 66, 79, 101, 427, 435,
+    462, 463, 470, 471, 498, 499, 505, 506, 507, 534, 535, 541,
+    542, 543, 564, 570, 571, 572, 577, 578, 579, 600, 601, 606,
+    607, 608, 609, 614, 615, 636, 637, 638, 642, 643, 644, 645,
+    651, 669, 673, 674, 675, 681, 66, 83, 85, 101, 456, 463,
+    464, 492, 499, 500, 527, 528, 534, 535, 536, 543, 559, 560,
+    564, 565, 571, 572, 573, 595, 596, 597, 600, 601, 602, 607,
+    608, 609, 632, 633, 637, 638, 639, 66, 83, 101, 420, 427,
+    428, 455, 456, 462, 463, 464, 471, 491, 492, 498, 499, 500,
+    506, 507, 527, 528, 534, 535, 536, 542, 543, 559, 563, 564,
+    570, 571, 572, 579, 595, 596, 600, 601, 607, 608, 609, 632,
+    633, 637, 12, 21, 69, 129, 593, 599, 624, 625, 626, 629,
+    630, 635, 636, 661, 662, 663, 665, 666, 667, 668, 671, 672,
+    697, 698, 699, 701, 702, 703, 704, 707, 708, 12, 21, 32,
+    35, 69, 79, 86, 132, 526, 533, 562, 569, 598, 599, 605,
+    606, 629, 630, 635, 636, 641, 642, 643, 663, 665, 666, 667,
+    668, 669, 671, 672, 673, 677, 678, 679, 680, 699, 702, 703,
+    704, 705, 707, 708, 709, 710, 714, 715, 716, 32, 69, 79,
+    83, 118, 449, 455, 485, 490, 491, 520, 521, 526, 527, 557,
+    562, 563, 588, 589, 590, 593, 594, 599, 600, 624, 625, 626,
+    627, 629, 630, 631, 635, 636, 661, 662, 663, 665, 666, 667,
+    668, 671, 672, 2, 35, 69, 79, 86, 102, 132, 569, 576,
+    577, 605, 606, 613, 614, 615, 635, 636, 641, 642, 643, 644,
+    649, 650, 651, 668, 671, 672, 673, 678, 679, 680, 681, 685,
+    686, 687, 704, 705, 707, 708, 709, 710, 711, 714, 715, 716,
+    717, 722, 723, 2, 19, 35, 79, 86, 102, 132, 540, 541,
+    569, 576, 577, 578, 605, 606, 612, 613, 614, 615, 641, 642,
+    643, 644, 648, 649, 650, 651, 673, 678, 679, 680, 681, 685,
+    686, 687, 705, 709, 710, 711, 714, 715, 716, 717, 721, 722,
+    723, 63, 102, 109, 503, 504, 539, 540, 575, 576, 577, 605,
+    611, 612, 613, 614, 641, 642, 647, 648, 649, 650, 651, 677,
+    678, 679, 684, 685, 686, 687, 714, 715, 716, 720, 721, 722,
+    723, 757, 758, 759, 2, 79, 469, 470, 504, 505, 506, 533,
+    534, 540, 541, 542, 543, 569, 570, 576, 577, 578, 579, 606,
+    607, 612, 613, 614, 615, 642, 643, 644, 649, 650, 651, 673,
+    678, 679, 680, 681, 685, 686, 687, 11, 25, 27, 95, 128,
+    270, 271, 272, 276, 277, 283, 300, 301, 302, 303, 305, 306,
+    307, 311, 312, 335, 336, 337, 338, 339, 340, 341, 342, 346,
+    347, 372, 373, 374, 377, 378, 382, 383, 408, 413, 418, 419,
+    449, 25, 96, 306, 311, 312, 318, 319, 341, 342, 347, 348,
+    353, 354, 355, 377, 378, 383, 384, 389, 390, 391, 413, 414,
+    419, 420, 425, 426, 427, 449, 455, 461, 462, 491, 497, 498,
+    11, 25, 56, 128, 276, 277, 283, 284, 285, 305, 306, 307,
+    311, 312, 317, 318, 319, 320, 338, 341, 342, 346, 347, 348,
+    353, 354, 355, 377, 378, 382, 383, 384, 389, 390, 413, 419,
+    425, 426, 461, 66, 426, 434, 435, 462, 469, 470, 471, 498,
+    505, 506, 507, 534, 541, 542, 543, 570, 571, 577, 578, 579,
+    606, 607, 614, 615, 643, 644, 100, 354, 361, 362, 363, 389,
+    390, 396, 397, 398, 399, 425, 426, 432, 433, 434, 435, 461,
+    462, 468, 469, 470, 471, 497, 498, 504, 505, 506, 507, 533,
+    534, 539, 540, 541, 542, 543, 569, 570, 576, 577, 578, 579,
+    606, 612, 613, 614, 615, 651, 66, 101, 390, 391, 392, 398,
+    399, 420, 426, 427, 428, 434, 435, 462, 463, 464, 469, 470,
+    471, 498, 499, 505, 506, 507, 534, 535, 541, 542, 543, 570,
+    571, 578, 579, 607, 608, 56, 100, 354, 355, 361, 362, 363,
+    390, 391, 392, 397, 398, 399, 426, 427, 428, 433, 434, 435,
+    462, 463, 469, 470, 471, 498, 505, 506, 507, 534, 541, 542,
+    543, 570, 578, 579, 56, 60, 64, 91, 100, 134, 318, 319,
+    320, 325, 326, 327, 353, 354, 355, 360, 361, 362, 363, 389,
+    390, 391, 396, 397, 398, 399, 426, 427, 433, 434, 435, 462,
+    469, 470, 471, 505, 506, 541, 5, 11, 56, 60, 64, 91,
+    92, 100, 105, 134, 283, 284, 285, 290, 291, 318, 319, 320,
+    325, 326, 327, 353, 354, 355, 360, 361, 362, 363, 389, 390,
+    391, 397, 398, 399, 426, 433, 434, 469, 138, 379, 380, 384,
+    385, 414, 415, 416, 420, 421, 427, 450, 451, 456, 457, 463,
+    464, 486, 487, 492, 499, 528, 535, 564, 66, 101, 138, 379,
+    380, 384, 385, 391, 392, 393, 415, 416, 420, 421, 427, 428,
+    429, 451, 452, 456, 457, 462, 463, 464, 465, 471, 492, 498,
+    499, 500, 507, 528, 534, 535, 536, 564, 571, 572, 25, 47,
+    277, 284, 285, 286, 306, 307, 308, 312, 313, 319, 320, 339,
+    342, 343, 347, 348, 354, 355, 378, 383, 384, 390, 25, 47,
+    56, 277, 284, 285, 286, 308, 312, 313, 318, 319, 320, 321,
+    327, 343, 347, 348, 349, 354, 355, 356, 383, 384, 390, 391,
+    150, 151, 186, 187, 188, 222, 223, 224, 225, 226, 257, 258,
+    259, 260, 261, 262, 292, 293, 294, 295, 328, 329, 330, 364,
+    365, 400, 401, 436, 187, 223, 224, 225, 228, 229, 258, 259,
+    260, 261, 262, 264, 293, 294, 295, 296, 297, 329, 330, 331,
+    365, 151, 152, 153, 157, 187, 188, 189, 190, 192, 193, 223,
+    224, 225, 226, 228, 229, 230, 259, 260, 261, 262, 150, 151,
+    152, 186, 187, 941, 977, 978, 1012, 1013, 1014, 1048, 1049, 1050,
+    1051, 1084, 1085, 1086, 1087, 1088, 1121, 1122, 1123, 1124, 1125, 1127,
+    1157, 1158, 1159, 1160, 1161, 1163, 1164, 1193, 1194, 1195, 1196, 1199,
+    1200, 151, 152, 1050, 1086, 1087, 1088, 1089, 1122, 1123, 1124, 1125,
+    1158, 1159, 1160, 1161, 1164, 1194, 1195, 1196, 1197, 150, 151, 152,
+    153, 154, 187, 188, 189, 1085, 1121, 1122, 1123, 1124, 1157, 1158,
+    1159, 1160, 1161, 1193, 1194, 1195, 1196, 1197, 151, 152, 153, 154,
+    188, 189, 1122, 1123, 1124, 1125, 1158, 1159, 1160, 1161, 1194, 1195,
+    1196, 1197, 1200, 151, 152, 156, 157, 1014, 1019, 1050, 1051, 1055,
+    1086, 1087, 1088, 1089, 1091, 1092, 1122, 1123, 1124, 1125, 1127, 1128,
+    1129, 1130, 1158, 1159, 1160, 1161, 1163, 1164, 1165, 1166, 1169, 1170,
+    1194, 1195, 1196, 1197, 1199, 1200, 1201, 1205, 151, 152, 153, 154,
+    156, 157, 188, 189, 190, 193, 1122, 1123, 1124, 1125, 1127, 1128,
+    1129, 1158, 1159, 1160, 1161, 1163, 1164, 1165, 1166, 1167, 1194, 1195,
+    1196, 1197, 1199, 1200, 1201, 1202, 1206, 39, 48, 141, 142, 143,
+    144, 155, 161, 167, 191, 192, 197, 198, 203, 227, 228, 233,
+    234, 239, 263, 264, 269, 275, 298, 299, 304, 334, 340, 370,
+    376, 406, 412, 442, 622, 658, 694, 730, 736, 766, 772, 1126,
+    1132, 1162, 1168, 1174, 1198, 1204, 1210, 39, 48, 113, 142, 143,
+    155, 156, 161, 162, 167, 168, 191, 192, 193, 197, 198, 203,
+    204, 227, 228, 233, 234, 239, 263, 264, 269, 298, 304, 1090,
+    1096, 1102, 1126, 1132, 1138, 1162, 1163, 1168, 1169, 1174, 1175, 1198,
+    1199, 1204, 1205, 1210, 1211, 162, 192, 193, 198, 223, 224, 225,
+    226, 228, 229, 230, 234, 235, 259, 260, 261, 262, 264, 265,
+    39, 48, 142, 143, 155, 161, 167, 191, 192, 197, 198, 203,
+    204, 227, 228, 229, 233, 234, 239, 240, 263, 264, 265, 269,
+    270, 275, 298, 299, 304, 305, 334, 335, 340, 370, 371, 376,
+    406, 412, 442, 478, 1204, 1210, 192, 197, 198, 204, 228, 229,
+    233, 234, 235, 239, 240, 263, 264, 265, 266, 269, 270, 271,
+    275, 276, 298, 299, 300, 304, 305, 334, 335, 340, 341, 370,
+    371, 376, 406, 412, 155, 156, 161, 162, 167, 168, 191, 192,
+    193, 197, 198, 199, 203, 204, 227, 228, 229, 233, 234, 235,
+    239, 240, 263, 264, 265, 269, 270, 275, 298, 299, 304, 1168,
+    1174, 1198, 1199, 1204, 1205, 1210, 1211, 120, 162, 168, 192, 193,
+    197, 198, 199, 203, 204, 228, 229, 230, 233, 234, 235, 239,
+    240, 241, 264, 265, 266, 269, 270, 271, 299, 300, 304, 305,
+    156, 157, 162, 1019, 1050, 1055, 1060, 1086, 1087, 1088, 1089, 1091,
+    1092, 1093, 1096, 1097, 1122, 1123, 1124, 1125, 1127, 1128, 1129, 1130,
+    1131, 1132, 1133, 1134, 1158, 1159, 1160, 1161, 1163, 1164, 1165, 1166,
+    1167, 1169, 1170, 1195, 1196, 1199, 1200, 1201, 1205, 1206, 113, 155,
+    156, 157, 161, 162, 167, 168, 192, 193, 197, 198, 203, 204,
+    228, 229, 233, 234, 1060, 1090, 1096, 1102, 1126, 1127, 1132, 1133,
+    1138, 1139, 1162, 1163, 1164, 1168, 1169, 1170, 1174, 1175, 1198, 1199,
+    1200, 1204, 1205, 1206, 1210, 1211, 103, 162, 168, 1024, 1030, 1055,
+    1060, 1066, 1091, 1092, 1096, 1097, 1102, 1103, 1127, 1128, 1129, 1130,
+    1132, 1133, 1134, 1138, 1139, 1140, 1163, 1164, 1165, 1166, 1168, 1169,
+    1170, 1171, 1174, 1175, 1176, 1183, 1199, 1200, 1201, 1205, 1206, 1211,
+    1212, 1219, 115, 120, 152, 153, 154, 156, 157, 158, 162, 163,
+    187, 188, 189, 190, 192, 193, 194, 195, 198, 199, 223, 224,
+    225, 226, 228, 229, 230, 231, 234, 235, 261, 262, 265, 266,
+    1196, 1197, 1200, 1201, 1205, 10, 152, 153, 154, 156, 157, 158,
+    159, 162, 163, 168, 169, 188, 189, 190, 192, 193, 194, 198,
+    199, 225, 226, 229, 230, 1159, 1160, 1161, 1163, 1164, 1165, 1166,
+    1167, 1169, 1170, 1195, 1196, 1197, 1199, 1200, 1201, 1202, 1203, 1205,
+    1206, 1207, 1212, 10, 78, 115, 120, 152, 153, 154, 156, 157,
+    158, 159, 162, 163, 164, 169, 188, 189, 190, 193, 194, 195,
+    196, 198, 199, 200, 225, 226, 229, 230, 231, 235, 1166, 1167,
+    1196, 1197, 1200, 1201, 1202, 1203, 1205, 1206, 1207, 113, 156, 157,
+    161, 162, 163, 167, 168, 169, 192, 193, 194, 197, 198, 199,
+    203, 204, 205, 228, 229, 230, 233, 234, 235, 240, 1168, 1169,
+    1174, 1175, 1199, 1200, 1204, 1205, 1206, 1210, 1211, 53, 115, 120,
+    156, 157, 158, 161, 162, 163, 167, 168, 169, 192, 193, 194,
+    195, 197, 198, 199, 204, 205, 228, 229, 230, 231, 234, 235,
+    240, 241, 265, 266, 270, 271, 1205, 1206, 1211, 10, 53, 115,
+    120, 157, 158, 159, 162, 163, 164, 168, 169, 176, 193, 194,
+    195, 198, 199, 200, 204, 205, 206, 230, 231, 235, 241, 1201,
+    1202, 1203, 1205, 1206, 1207, 1211, 1212, 23, 39, 48, 113, 143,
+    144, 145, 161, 167, 173, 174, 197, 198, 203, 204, 209, 210,
+    211, 233, 234, 239, 240, 245, 246, 247, 269, 270, 275, 276,
+    281, 304, 305, 310, 316, 340, 346, 376, 382, 412, 418, 1144,
+    1174, 1180, 1204, 1210, 1216, 1217, 31, 53, 62, 103, 113, 161,
+    162, 167, 168, 169, 174, 175, 176, 198, 199, 203, 204, 205,
+    210, 211, 212, 234, 240, 1138, 1174, 1175, 1181, 1182, 1204, 1205,
+    1210, 1211, 1212, 1217, 1218, 1219, 31, 62, 67, 107, 113, 167,
+    168, 174, 175, 176, 181, 182, 183, 184, 204, 210, 211, 212,
+    218, 219, 220, 240, 247, 1145, 1174, 1175, 1181, 1182, 1188, 1189,
+    1190, 1191, 1210, 1211, 1217, 1218, 1219, 1224, 1225, 1226, 1227, 31,
+    53, 62, 67, 103, 107, 113, 116, 168, 169, 174, 175, 176,
+    177, 182, 183, 184, 204, 205, 211, 212, 213, 219, 220, 1146,
+    1154, 1175, 1176, 1181, 1182, 1183, 1184, 1189, 1190, 1191, 1211, 1212,
+    1217, 1218, 1219, 1220, 1221, 1225, 1226, 1227, 11, 31, 113, 120,
+    128, 162, 167, 168, 174, 175, 197, 198, 199, 203, 204, 205,
+    210, 211, 212, 233, 234, 235, 239, 240, 241, 246, 247, 248,
+    249, 269, 270, 271, 275, 276, 277, 282, 304, 305, 310, 311,
+    1211, 11, 31, 68, 106, 115, 117, 120, 128, 199, 204, 205,
+    211, 212, 213, 234, 235, 236, 240, 241, 242, 247, 248, 249,
+    250, 266, 267, 268, 270, 271, 272, 276, 277, 278, 301, 302,
+    305, 306, 311, 11, 31, 68, 92, 105, 106, 117, 128, 204,
+    205, 211, 212, 213, 219, 220, 240, 241, 242, 246, 247, 248,
+    249, 250, 255, 256, 271, 272, 276, 277, 278, 282, 283, 284,
+    285, 286, 291, 306, 311, 312, 317, 318, 319, 31, 53, 62,
+    68, 113, 116, 120, 162, 163, 167, 168, 169, 174, 175, 176,
+    177, 184, 198, 199, 200, 203, 204, 205, 206, 210, 211, 212,
+    213, 214, 234, 235, 236, 240, 241, 247, 248, 249, 270, 271,
+    276, 1211, 1212, 1217, 1218, 1219, 10, 31, 53, 62, 68, 103,
+    116, 120, 162, 163, 164, 168, 169, 170, 175, 176, 177, 178,
+    184, 198, 199, 200, 204, 205, 206, 211, 212, 213, 214, 235,
+    236, 241, 1206, 1207, 1211, 1212, 1213, 1218, 1219, 1220, 14, 15,
+    31, 53, 62, 68, 106, 115, 116, 117, 120, 169, 176, 177,
+    198, 199, 200, 204, 205, 206, 211, 212, 213, 214, 232, 234,
+    235, 236, 237, 240, 241, 242, 247, 248, 249, 250, 267, 268,
+    271, 272, 277, 278, 10, 14, 15, 31, 41, 53, 62, 68,
+    106, 115, 116, 117, 120, 131, 163, 164, 168, 169, 170, 175,
+    176, 177, 178, 199, 200, 201, 204, 205, 206, 207, 212, 213,
+    214, 231, 232, 235, 236, 237, 241, 242, 243, 248, 249, 250,
+    31, 62, 68, 175, 176, 182, 183, 184, 204, 205, 211, 212,
+    213, 219, 220, 240, 241, 247, 248, 249, 31, 53, 62, 67,
+    68, 116, 168, 169, 175, 176, 177, 178, 183, 184, 204, 205,
+    206, 211, 212, 213, 214, 220, 241, 248, 249, 1212, 1218, 1219,
+    1220, 1226, 1227, 67, 107, 130, 174, 175, 181, 182, 183, 184,
+    217, 218, 219, 1008, 1043, 1044, 1072, 1079, 1080, 1108, 1109, 1115,
+    1116, 1117, 1118, 1144, 1145, 1146, 1151, 1152, 1153, 1154, 1155, 1181,
+    1182, 1187, 1188, 1189, 1190, 1191, 1217, 1218, 1224, 1225, 1226, 1227,
+    67, 90, 107, 130, 180, 181, 182, 183, 184, 217, 218, 219,
+    220, 1007, 1008, 1043, 1044, 1079, 1080, 1081, 1115, 1116, 1117, 1118,
+    1151, 1152, 1153, 1154, 1155, 1187, 1188, 1189, 1190, 1191, 1223, 1224,
+    1225, 1226, 1227, 1, 5, 7, 11, 91, 92, 104, 105, 128,
+    134, 181, 182, 183, 210, 211, 216, 217, 218, 219, 220, 245,
+    246, 247, 248, 249, 252, 253, 254, 255, 256, 281, 282, 283,
+    284, 288, 289, 290, 291, 316, 317, 318, 324, 325, 1, 4,
+    5, 7, 11, 17, 60, 64, 73, 91, 92, 94, 100, 104,
+    105, 134, 217, 218, 219, 253, 254, 255, 256, 283, 284, 288,
+    289, 290, 291, 317, 318, 323, 324, 325, 326, 327, 353, 359,
+    360, 361, 395, 396, 431, 1, 5, 7, 91, 92, 104, 105,
+    134, 218, 219, 220, 253, 254, 255, 256, 289, 290, 291, 5,
+    7, 11, 56, 60, 64, 91, 92, 100, 105, 128, 134, 254,
+    255, 256, 283, 284, 285, 290, 291, 317, 318, 319, 320, 324,
+    325, 326, 327, 353, 354, 360, 361, 362, 363, 389, 396, 397,
+    5, 7, 11, 91, 92, 100, 105, 128, 134, 219, 220, 247,
+    248, 249, 254, 255, 256, 283, 284, 285, 286, 290, 291, 318,
+    319, 325, 326, 327, 22, 25, 95, 106, 235, 241, 266, 267,
+    268, 271, 272, 273, 276, 277, 278, 300, 301, 302, 303, 305,
+    306, 307, 308, 311, 312, 336, 337, 338, 339, 341, 342, 347,
+    22, 106, 117, 120, 235, 236, 241, 242, 267, 268, 271, 272,
+    273, 274, 277, 278, 302, 303, 306, 307, 11, 22, 25, 95,
+    106, 117, 241, 248, 249, 271, 272, 273, 276, 277, 278, 283,
+    284, 285, 286, 303, 305, 306, 307, 308, 311, 312, 313, 318,
+    319, 338, 339, 341, 342, 347, 348, 11, 22, 31, 47, 68,
+    106, 117, 236, 241, 242, 248, 249, 250, 271, 272, 273, 274,
+    276, 277, 278, 279, 284, 285, 286, 303, 306, 307, 308, 312,
+    799, 800, 801, 834, 835, 836, 837, 839, 840, 869, 870, 871,
+    872, 875, 876, 905, 906, 907, 908, 911, 912, 941, 942, 943,
+    944, 947, 948, 977, 978, 979, 980, 983, 984, 1013, 1014, 1015,
+    1016, 1019, 1049, 1050, 1051, 1055, 1086, 1087, 800, 801, 805, 834,
+    835, 836, 839, 840, 870, 871, 875, 876, 881, 906, 907, 911,
+    912, 917, 942, 943, 947, 948, 978, 979, 980, 983, 984, 1014,
+    1015, 1019, 1050, 1051, 1055, 1091, 6, 139, 140, 149, 185, 616,
+    652, 688, 689, 724, 725, 726, 760, 761, 762, 763, 764, 796,
+    797, 798, 799, 832, 833, 834, 868, 869, 904, 905, 940, 941,
+    976, 977, 1012, 1048, 1084, 1120, 1156, 1192, 6, 139, 140, 149,
+    185, 688, 724, 725, 760, 761, 762, 763, 764, 796, 797, 798,
+    799, 832, 833, 834, 868, 869, 870, 904, 905, 906, 940, 941,
+    942, 976, 977, 978, 1012, 1013, 1048, 1049, 1084, 1085, 1120, 1121,
+    1156, 1157, 1192, 1193, 761, 762, 763, 764, 765, 796, 797, 798,
+    799, 800, 801, 832, 833, 834, 835, 839, 868, 869, 870, 874,
+    875, 904, 905, 906, 910, 911, 940, 941, 942, 976, 977, 1012,
+    1013, 1048, 1049, 1085, 761, 762, 763, 764, 765, 767, 768, 796,
+    797, 798, 799, 800, 801, 802, 803, 804, 832, 833, 834, 835,
+    838, 839, 868, 869, 870, 874, 875, 904, 905, 906, 910, 911,
+    940, 941, 942, 946, 947, 976, 977, 982, 1012, 1013, 1018, 1048,
+    1049, 1054, 1085, 1090, 652, 688, 724, 725, 726, 760, 761, 762,
+    763, 764, 796, 797, 798, 832, 833, 868, 869, 904, 905, 940,
+    976, 1012, 1048, 1084, 1120, 139, 140, 149, 185, 688, 724, 725,
+    760, 761, 762, 763, 764, 765, 796, 797, 798, 799, 832, 833,
+    834, 868, 869, 874, 904, 905, 910, 940, 941, 946, 976, 977,
+    1012, 1013, 1048, 1049, 1084, 1085, 1120, 1121, 1156, 1157, 1192, 1193,
+    6, 139, 149, 150, 185, 796, 797, 798, 799, 800, 832, 833,
+    834, 835, 868, 869, 870, 904, 905, 906, 940, 941, 942, 976,
+    977, 978, 1012, 1013, 1014, 1048, 1049, 1050, 1084, 1085, 1086, 1120,
+    1121, 1122, 1123, 1156, 1157, 1158, 1159, 1192, 1193, 1194, 797, 798,
+    799, 832, 833, 834, 868, 869, 870, 904, 905, 906, 940, 941,
+    942, 976, 977, 978, 1012, 1013, 1014, 1048, 1049, 1050, 1084, 1085,
+    1086, 1120, 1121, 1122, 1156, 1157, 1158, 1192, 1193, 834, 835, 870,
+    875, 905, 906, 907, 911, 941, 942, 943, 947, 977, 978, 979,
+    983, 1013, 1014, 1015, 1019, 1049, 1050, 1051, 1085, 1086, 1087, 1122,
+    835, 839, 870, 875, 905, 906, 911, 941, 942, 943, 946, 947,
+    977, 978, 979, 982, 983, 1013, 1014, 1015, 1018, 1019, 1049, 1050,
+    1051, 1054, 1055, 1085, 1086, 1087, 1090, 1091, 1122, 1123, 1127, 833,
+    834, 868, 869, 904, 905, 940, 941, 942, 976, 977, 978, 1012,
+    1013, 1014, 1048, 1049, 1084, 1085, 1086, 1120, 1121, 1122, 1156, 1157,
+    1158, 905, 941, 942, 977, 978, 1013, 1014, 1049, 1050, 1085, 1086,
+    1087, 1121, 1122, 1123, 1157, 1158, 1159, 804, 805, 839, 840, 845,
+    875, 881, 911, 917, 947, 983, 1019, 770, 771, 803, 804, 805,
+    809, 810, 839, 840, 844, 845, 874, 875, 880, 881, 910, 911,
+    916, 917, 946, 947, 952, 953, 983, 988, 989, 1019, 1024, 1055,
+    1060, 805, 839, 840, 845, 875, 876, 881, 911, 912, 917, 947,
+    948, 953, 983, 984, 989, 1019, 1055, 1091, 33, 805, 839, 840,
+    845, 875, 880, 881, 911, 912, 916, 917, 947, 948, 952, 953,
+    983, 984, 988, 989, 1019, 1024, 1025, 1055, 1060, 1091, 33, 810,
+    845, 851, 880, 881, 887, 911, 916, 917, 923, 947, 952, 953,
+    959, 983, 988, 989, 995, 1019, 1024, 1025, 1055, 1060, 1061, 1097,
+    809, 810, 845, 851, 880, 881, 886, 887, 916, 917, 922, 923,
+    952, 953, 958, 959, 988, 989, 994, 995, 1024, 1025, 1030, 1031,
+    1060, 1061, 1066, 1096, 1097, 1102, 1103, 763, 764, 765, 767, 768,
+    769, 802, 803, 804, 838, 839, 874, 875, 880, 910, 911, 916,
+    946, 947, 982, 1018, 1054, 1090, 766, 767, 768, 769, 770, 802,
+    803, 804, 808, 809, 838, 839, 844, 845, 874, 875, 880, 910,
+    911, 916, 946, 947, 952, 982, 988, 1018, 1024, 1054, 1060, 1090,
+    1096, 1126, 141, 688, 689, 694, 724, 725, 726, 727, 728, 729,
+    730, 731, 761, 762, 763, 764, 766, 767, 768, 802, 803, 838,
+    839, 874, 910, 946, 982, 1018, 34, 141, 142, 658, 694, 728,
+    729, 730, 731, 732, 736, 766, 767, 768, 772, 773, 802, 803,
+    808, 809, 838, 839, 844, 874, 880, 910, 916, 946, 952, 982,
+    1018, 1054, 1090, 1126, 1162, 1198, 766, 802, 803, 838, 839, 874,
+    910, 946, 982, 1018, 1054, 1090, 1126, 1162, 141, 142, 155, 730,
+    766, 767, 768, 772, 802, 803, 808, 809, 838, 839, 844, 874,
+    880, 910, 916, 946, 952, 982, 988, 1018, 1024, 1054, 1060, 1090,
+    1096, 1126, 1132, 1162, 1168, 1198, 1204, 39, 142, 143, 730, 766,
+    767, 772, 773, 802, 803, 808, 809, 838, 844, 874, 880, 910,
+    916, 946, 952, 982, 988, 1018, 1024, 1054, 1060, 1090, 1096, 1126,
+    1132, 1162, 1168, 1204, 39, 48, 71, 124, 142, 143, 161, 736,
+    772, 773, 808, 809, 814, 844, 850, 880, 886, 916, 922, 952,
+    958, 988, 994, 1024, 1030, 1060, 1066, 1096, 1102, 1132, 1138, 1168,
+    1174, 1204, 1210, 802, 803, 804, 808, 809, 838, 839, 840, 844,
+    845, 874, 875, 880, 881, 910, 911, 916, 917, 946, 947, 952,
+    953, 982, 983, 988, 1018, 1019, 1024, 1054, 1055, 1060, 1090, 1091,
+    1096, 1126, 1127, 1132, 875, 911, 946, 947, 982, 983, 1018, 1019,
+    1054, 1055, 1091, 1127, 839, 845, 874, 875, 880, 881, 910, 911,
+    916, 917, 946, 947, 952, 953, 982, 983, 988, 989, 1018, 1019,
+    1024, 1025, 1054, 1055, 1060, 1090, 1091, 1096, 1097, 1126, 1127, 1132,
+    1133, 1163, 910, 911, 946, 947, 982, 983, 1018, 1019, 1049, 1050,
+    1054, 1055, 1085, 1086, 1090, 1091, 1126, 1127, 1162, 1163, 1199, 155,
+    161, 839, 874, 880, 910, 911, 916, 946, 947, 952, 982, 983,
+    988, 1018, 1019, 1024, 1054, 1055, 1060, 1090, 1091, 1096, 1097, 1126,
+    1127, 1128, 1132, 1133, 1162, 1163, 1164, 1168, 1169, 1198, 1199, 1204,
+    1205, 127, 738, 739, 740, 741, 743, 744, 745, 779, 780, 781,
+    786, 787, 788, 789, 815, 821, 822, 823, 38, 70, 72, 122,
+    740, 741, 743, 744, 745, 746, 751, 779, 780, 781, 785, 786,
+    787, 788, 789, 821, 822, 823, 830, 831, 857, 12, 71, 124,
+    127, 697, 700, 701, 733, 734, 735, 736, 737, 738, 739, 740,
+    741, 742, 743, 744, 772, 773, 774, 775, 778, 779, 780, 808,
+    809, 814, 815, 844, 850, 12, 71, 124, 127, 701, 737, 738,
+    739, 740, 741, 742, 743, 744, 773, 774, 778, 779, 780, 814,
+    815, 850, 12, 39, 48, 71, 124, 143, 628, 664, 665, 670,
+    696, 697, 700, 701, 706, 733, 734, 735, 736, 737, 738, 739,
+    742, 743, 772, 773, 778, 779, 808, 814, 850, 12, 23, 48,
+    71, 124, 143, 144, 628, 634, 664, 665, 670, 700, 701, 702,
+    706, 707, 736, 737, 738, 739, 740, 742, 743, 744, 772, 773,
+    778, 779, 784, 785, 814, 815, 820, 821, 850, 856, 71, 124,
+    127, 700, 733, 734, 735, 736, 737, 738, 739, 742, 743, 772,
+    773, 774, 775, 778, 779, 780, 808, 809, 814, 815, 844, 845,
+    850, 851, 857, 880, 886, 893, 916, 922, 952, 958, 988, 994,
+    1030, 71, 124, 127, 737, 738, 742, 743, 773, 774, 778, 779,
+    780, 814, 815, 821, 822, 850, 851, 856, 857, 858, 886, 892,
+    893, 922, 928, 929, 958, 964, 994, 12, 71, 124, 127, 706,
+    707, 738, 739, 740, 741, 742, 743, 744, 745, 749, 750, 778,
+    779, 780, 784, 785, 786, 787, 788, 814, 815, 820, 821, 822,
+    850, 856, 857, 892, 12, 70, 72, 122, 707, 740, 741, 742,
+    743, 744, 745, 748, 749, 750, 751, 778, 779, 780, 784, 785,
+    786, 787, 788, 820, 821, 822, 830, 856, 857, 892, 12, 23,
+    71, 124, 144, 145, 634, 670, 676, 701, 706, 707, 712, 738,
+    739, 742, 743, 744, 748, 749, 750, 778, 779, 784, 785, 786,
+    814, 820, 821, 856, 892, 12, 23, 61, 71, 72, 121, 122,
+    144, 145, 146, 604, 634, 640, 641, 670, 671, 676, 677, 706,
+    707, 712, 713, 714, 742, 743, 744, 748, 749, 750, 751, 778,
+    779, 784, 785, 786, 787, 814, 820, 821, 822, 829, 856, 857,
+    892, 928, 71, 72, 124, 127, 706, 742, 743, 748, 749, 778,
+    779, 780, 784, 785, 786, 787, 788, 814, 815, 820, 821, 822,
+    823, 850, 851, 856, 857, 858, 886, 892, 893, 922, 928, 929,
+    958, 964, 965, 994, 1000, 1036, 1072, 1108, 70, 72, 743, 749,
+    778, 779, 780, 784, 785, 786, 787, 788, 814, 820, 821, 822,
+    830, 831, 856, 857, 858, 864, 865, 866, 892, 893, 899, 900,
+    901, 928, 929, 936, 964, 1000, 1036, 23, 48, 71, 72, 124,
+    144, 145, 173, 640, 670, 676, 706, 712, 742, 743, 748, 749,
+    778, 779, 784, 785, 786, 814, 815, 820, 821, 822, 850, 856,
+    857, 886, 892, 893, 922, 928, 929, 958, 964, 994, 1000, 1036,
+    1072, 1108, 1144, 1180, 1216, 23, 72, 121, 144, 145, 146, 640,
+    670, 676, 706, 712, 742, 743, 748, 749, 778, 779, 784, 785,
+    786, 814, 820, 821, 856, 857, 864, 892, 893, 899, 900, 928,
+    935, 964, 1000, 1036, 1072, 1108, 1144, 1180, 1216, 809, 810, 815,
+    816, 845, 850, 851, 858, 859, 880, 886, 887, 893, 894, 916,
+    917, 922, 923, 929, 930, 952, 953, 958, 959, 965, 966, 988,
+    989, 994, 995, 1001, 1002, 1024, 1025, 1030, 1031, 1060, 1066, 1102,
+    1103, 108, 815, 816, 822, 823, 824, 850, 851, 857, 858, 859,
+    886, 887, 893, 894, 902, 903, 922, 923, 929, 930, 938, 939,
+    958, 959, 965, 966, 994, 995, 1001, 1002, 1030, 1031, 1037, 1038,
+    1066, 1067, 1073, 1102, 1103, 1109, 1110, 108, 822, 823, 857, 858,
+    859, 865, 866, 867, 893, 894, 900, 901, 902, 903, 929, 930,
+    936, 937, 938, 939, 965, 966, 972, 973, 974, 975, 1001, 1002,
+    1008, 1009, 1010, 1011, 1037, 1038, 1044, 1045, 1046, 1073, 1080, 1081,
+    1109, 1117, 39, 48, 71, 124, 143, 144, 167, 736, 772, 773,
+    778, 779, 808, 809, 814, 815, 844, 850, 880, 886, 916, 922,
+    952, 958, 988, 994, 1024, 1030, 1060, 1066, 1096, 1102, 1132, 1138,
+    1168, 1174, 1204, 1210, 71, 124, 778, 779, 814, 815, 820, 821,
+    822, 850, 856, 857, 858, 886, 892, 893, 922, 928, 929, 958,
+    964, 965, 994, 1000, 1001, 1030, 1036, 1037, 1066, 1072, 1102, 1108,
+    1109, 1138, 1145, 72, 130, 785, 820, 821, 822, 830, 831, 856,
+    857, 858, 864, 865, 866, 892, 893, 899, 900, 901, 902, 928,
+    929, 935, 936, 937, 938, 964, 965, 972, 973, 1000, 1001, 1008,
+    1036, 1037, 1072, 1108, 1109, 23, 72, 130, 145, 784, 820, 821,
+    856, 857, 892, 893, 928, 929, 964, 965, 1000, 1001, 1036, 1072,
+    1108, 1144, 1145, 1180, 1181, 1216, 167, 173, 850, 856, 857, 886,
+    892, 893, 922, 928, 929, 958, 964, 965, 994, 1000, 1001, 1030,
+    1036, 1037, 1066, 1072, 1073, 1102, 1108, 1109, 1138, 1139, 1144, 1145,
+    1146, 1174, 1175, 1180, 1181, 1182, 1210, 1216, 1217, 1218, 61, 70,
+    72, 109, 122, 713, 743, 744, 745, 748, 749, 750, 751, 752,
+    784, 785, 786, 787, 788, 792, 793, 794, 795, 820, 821, 822,
+    827, 828, 829, 830, 831, 856, 863, 864, 61, 70, 72, 102,
+    109, 122, 713, 714, 720, 721, 745, 748, 749, 750, 751, 752,
+    753, 755, 756, 757, 758, 759, 784, 785, 786, 787, 788, 791,
+    792, 793, 794, 795, 820, 821, 822, 827, 828, 829, 830, 831,
+    863, 864, 865, 899, 61, 72, 109, 121, 122, 146, 640, 676,
+    677, 707, 712, 713, 714, 744, 748, 749, 750, 751, 754, 755,
+    756, 784, 785, 786, 790, 791, 792, 793, 794, 820, 821, 826,
+    827, 828, 829, 856, 862, 863, 61, 72, 102, 109, 122, 646,
+    676, 677, 682, 683, 684, 712, 713, 714, 718, 719, 720, 721,
+    748, 749, 750, 751, 754, 755, 756, 757, 758, 759, 784, 785,
+    786, 790, 791, 792, 793, 794, 795, 826, 827, 828, 829, 862,
+    863, 898, 57, 61, 70, 72, 749, 756, 757, 785, 786, 787,
+    792, 793, 794, 795, 821, 827, 828, 829, 830, 831, 863, 864,
+    865, 866, 899, 900, 901, 935, 936, 971, 1007, 0, 61, 63,
+    72, 102, 109, 646, 647, 682, 683, 684, 685, 713, 714, 718,
+    719, 720, 721, 722, 750, 751, 754, 755, 756, 757, 758, 759,
+    790, 791, 792, 793, 794, 795, 826, 827, 828, 829, 862, 863,
+    898, 72, 130, 785, 820, 821, 822, 828, 829, 830, 831, 856,
+    857, 863, 864, 865, 866, 892, 893, 899, 900, 901, 928, 929,
+    935, 936, 937, 938, 964, 965, 971, 972, 973, 1000, 1001, 1007,
+    1008, 1009, 1036, 1037, 1043, 1044, 1072, 1079, 1080, 1108, 1115, 1116,
+    72, 130, 827, 828, 829, 830, 831, 863, 864, 865, 866, 899,
+    900, 901, 935, 936, 937, 971, 972, 973, 1007, 1008, 1009, 1043,
+    1044, 1079, 1080, 1115, 1116, 130, 864, 865, 866, 899, 900, 901,
+    935, 936, 937, 938, 971, 972, 973, 974, 1007, 1008, 1009, 1010,
+    1036, 1037, 1043, 1044, 1045, 1046, 1072, 1073, 1079, 1080, 1081, 1109,
+    1115, 1116, 1117, 1118, 1152, 1153, 1154, 130, 900, 935, 936, 971,
+    972, 1007, 1008, 1009, 1036, 1042, 1043, 1044, 1045, 1072, 1078, 1079,
+    1080, 1081, 1108, 1114, 1115, 1116, 1117, 1151, 1152, 1153, 1154, 1187,
+    1188, 1189, 1190, 1223, 1224, 57, 72, 130, 791, 792, 793, 794,
+    795, 826, 827, 828, 829, 830, 831, 862, 863, 864, 865, 866,
+    898, 899, 900, 901, 934, 935, 936, 937, 970, 971, 972, 973,
+    1006, 1007, 1008, 1042, 1043, 1044, 1078, 1079, 1080, 1114, 1115, 1116,
+    1151, 57, 72, 130, 827, 828, 829, 830, 831, 863, 864, 865,
+    866, 867, 898, 899, 900, 901, 934, 935, 936, 937, 970, 971,
+    972, 973, 1006, 1007, 1008, 1009, 1042, 1043, 1044, 1045, 1078, 1079,
+    1080, 1114, 1115, 1116, 1151, 1152, 57, 107, 130, 864, 899, 900,
+    934, 935, 936, 970, 971, 972, 1006, 1007, 1008, 1009, 1042, 1043,
+    1044, 1045, 1078, 1079, 1080, 1081, 1114, 1115, 1116, 1117, 1150, 1151,
+    1152, 1153, 1154, 1186, 1187, 1188, 1189, 1190, 1223, 1224, 1225, 33,
+    88, 111, 807, 837, 841, 842, 872, 873, 876, 877, 882, 908,
+    909, 912, 913, 918, 944, 945, 948, 949, 950, 954, 980, 981,
+    984, 985, 986, 1017, 1020, 1021, 33, 88, 111, 837, 841, 871,
+    872, 873, 876, 877, 907, 908, 909, 912, 913, 918, 943, 944,
+    945, 948, 949, 953, 954, 979, 980, 981, 984, 985, 989, 990,
+    1015, 1016, 1017, 1020, 1021, 1051, 1052, 1053, 1056, 1057, 33, 88,
+    111, 807, 841, 842, 846, 876, 877, 881, 882, 888, 912, 913,
+    917, 918, 924, 948, 949, 950, 953, 954, 960, 984, 985, 986,
+    989, 990, 1017, 1020, 1021, 1022, 1025, 1026, 1056, 1057, 33, 88,
+    111, 807, 841, 842, 846, 876, 877, 881, 882, 912, 913, 917,
+    918, 948, 949, 953, 954, 980, 981, 983, 984, 985, 986, 989,
+    990, 1016, 1017, 1019, 1020, 1021, 1022, 1025, 1026, 1052, 1053, 1056,
+    1057, 1061, 1092, 1093, 33, 82, 111, 123, 806, 807, 811, 812,
+    817, 841, 846, 847, 852, 881, 882, 887, 888, 895, 912, 917,
+    918, 923, 924, 931, 948, 953, 954, 959, 960, 967, 984, 989,
+    990, 995, 1020, 1025, 1031, 1061, 33, 806, 811, 845, 846, 852,
+    881, 887, 917, 918, 923, 948, 953, 954, 959, 984, 989, 990,
+    995, 1020, 1025, 1031, 1056, 1061, 1067, 33, 82, 111, 846, 852,
+    881, 887, 917, 918, 923, 924, 948, 953, 954, 959, 960, 984,
+    985, 989, 990, 995, 996, 1020, 1021, 1025, 1026, 1031, 1032, 1056,
+    1057, 1061, 1062, 1067, 1097, 1098, 54, 93, 111, 843, 878, 883,
+    913, 914, 915, 918, 919, 924, 949, 950, 951, 954, 955, 960,
+    961, 985, 986, 987, 990, 991, 1022, 1023, 1026, 1027, 26, 54,
+    110, 111, 843, 878, 882, 913, 914, 918, 924, 949, 950, 951,
+    954, 955, 960, 985, 986, 987, 990, 991, 996, 1021, 1022, 1023,
+    1026, 1027, 1058, 1059, 1062, 26, 29, 54, 81, 82, 84, 111,
+    123, 847, 848, 882, 883, 888, 896, 918, 919, 924, 925, 932,
+    933, 950, 951, 954, 955, 960, 961, 968, 969, 986, 987, 990,
+    991, 992, 996, 997, 1004, 1005, 1022, 1023, 1026, 1027, 1032, 1033,
+    1059, 1063, 1068, 26, 29, 54, 81, 82, 110, 111, 123, 888,
+    918, 924, 932, 954, 955, 960, 968, 985, 986, 987, 990, 991,
+    996, 997, 1004, 1021, 1022, 1023, 1026, 1027, 1032, 1058, 1059, 1062,
+    1063, 1068, 33, 54, 88, 111, 842, 877, 882, 913, 918, 924,
+    948, 949, 950, 954, 960, 984, 985, 986, 990, 1020, 1021, 1022,
+    1023, 1026, 1057, 1058, 1062, 33, 111, 913, 918, 948, 949, 954,
+    984, 985, 986, 989, 990, 1017, 1020, 1021, 1022, 1025, 1026, 1053,
+    1056, 1057, 1058, 1061, 1062, 1093, 1094, 1098, 33, 837, 871, 872,
+    876, 907, 908, 909, 912, 943, 944, 945, 948, 949, 953, 978,
+    979, 980, 981, 983, 984, 985, 989, 1014, 1015, 1016, 1017, 1019,
+    1020, 1021, 1050, 1051, 1052, 1053, 1055, 1056, 1057, 1087, 1088, 1089,
+    1092, 1093, 943, 944, 948, 978, 979, 980, 981, 983, 984, 1014,
+    1015, 1016, 1017, 1019, 1020, 1050, 1051, 1052, 1053, 1055, 1056, 1087,
+    1088, 1089, 1091, 1092, 1093, 1128, 1129, 870, 871, 906, 907, 911,
+    941, 942, 943, 947, 977, 978, 979, 980, 983, 1013, 1014, 1015,
+    1016, 1019, 1049, 1050, 1051, 1052, 1053, 1085, 1086, 1087, 1088, 1089,
+    1091, 1121, 1122, 1123, 1124, 1125, 1158, 1159, 942, 977, 978, 979,
+    1013, 1014, 1015, 1049, 1050, 1051, 1052, 1085, 1086, 1087, 1088, 1089,
+    1121, 1122, 1123, 1124, 1125, 1157, 1158, 1159, 1160, 1161, 1194, 870,
+    875, 906, 907, 911, 941, 942, 943, 947, 977, 978, 979, 980,
+    983, 984, 1013, 1014, 1015, 1016, 1019, 1020, 1049, 1050, 1051, 1052,
+    1053, 1054, 1055, 1056, 1085, 1086, 1087, 1088, 1089, 1091, 1092, 1121,
+    1122, 1123, 1124, 1125, 1127, 1128, 1158, 1163, 1164, 906, 911, 941,
+    942, 947, 977, 978, 979, 982, 983, 1013, 1014, 1015, 1018, 1019,
+    1049, 1050, 1051, 1052, 1054, 1055, 1085, 1086, 1087, 1088, 1089, 1090,
+    1091, 1092, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1157,
+    1158, 1159, 1160, 1161, 1163, 1164, 1165, 1194, 1199, 33, 840, 841,
+    846, 875, 876, 881, 911, 912, 917, 947, 948, 953, 983, 984,
+    989, 1015, 1016, 1019, 1020, 1025, 1051, 1052, 1053, 1055, 1056, 1061,
+    1092, 1097, 840, 875, 881, 911, 912, 917, 947, 948, 953, 983,
+    984, 988, 989, 1014, 1015, 1016, 1019, 1020, 1024, 1025, 1050, 1051,
+    1052, 1055, 1056, 1060, 1061, 1087, 1088, 1089, 1091, 1092, 1097, 1127,
+    1128, 1133, 911, 947, 983, 989, 1019, 1020, 1024, 1025, 1051, 1055,
+    1056, 1060, 1061, 1091, 1092, 1096, 1097, 1127, 1128, 1133, 947, 983,
+    988, 1018, 1019, 1024, 1050, 1054, 1055, 1060, 1086, 1087, 1088, 1090,
+    1091, 1092, 1096, 1097, 1122, 1123, 1124, 1125, 1127, 1128, 1132, 1133,
+    1163, 1164, 1168, 1169, 1199, 1205, 983, 989, 1019, 1020, 1025, 1051,
+    1052, 1053, 1055, 1056, 1061, 1087, 1088, 1089, 1091, 1092, 1093, 1097,
+    1127, 1128, 1129, 1133, 1134, 1169, 1019, 1055, 1087, 1088, 1089, 1091,
+    1092, 1097, 1124, 1125, 1127, 1128, 1129, 1133, 1134, 1163, 1164, 1165,
+    1169, 1170, 947, 952, 953, 958, 983, 988, 989, 994, 995, 1019,
+    1024, 1025, 1030, 1031, 1055, 1056, 1060, 1061, 1066, 1067, 1091, 1092,
+    1096, 1097, 1102, 1103, 1127, 1128, 1132, 1133, 1138, 1139, 1169, 1175,
+    952, 988, 1019, 1024, 1030, 1055, 1060, 1066, 1091, 1092, 1096, 1097,
+    1102, 1103, 1127, 1128, 1132, 1133, 1138, 1139, 1163, 1164, 1168, 1169,
+    1175, 1205, 82, 111, 123, 852, 888, 895, 923, 924, 930, 931,
+    954, 959, 960, 966, 967, 968, 989, 990, 995, 996, 1002, 1003,
+    1004, 1025, 1026, 1031, 1032, 1039, 1062, 1067, 82, 887, 895, 923,
+    930, 931, 953, 959, 960, 966, 967, 989, 990, 995, 996, 1002,
+    1003, 1025, 1026, 1031, 1032, 1038, 1039, 1061, 1062, 1067, 1098, 1103,
+    1104, 108, 894, 902, 903, 923, 929, 930, 938, 939, 959, 965,
+    966, 974, 975, 995, 1001, 1002, 1010, 1011, 1031, 1037, 1038, 1046,
+    1047, 1067, 1073, 1074, 1103, 1110, 886, 922, 923, 929, 952, 958,
+    959, 965, 966, 988, 989, 994, 995, 1001, 1002, 1024, 1025, 1030,
+    1031, 1037, 1038, 1060, 1061, 1066, 1067, 1073, 1074, 1096, 1097, 1102,
+    1103, 1109, 1110, 1132, 1133, 1138, 1139, 1145, 1146, 1168, 1169, 1174,
+    1175, 1182, 958, 988, 994, 1001, 1024, 1030, 1037, 1060, 1061, 1066,
+    1073, 1096, 1097, 1102, 1103, 1109, 1110, 1132, 1133, 1138, 1139, 1145,
+    1146, 1168, 1169, 1174, 1175, 1181, 1182, 1210, 1211, 108, 894, 901,
+    902, 903, 929, 930, 937, 938, 939, 965, 966, 973, 974, 975,
+    1001, 1002, 1009, 1010, 1011, 1037, 1038, 1045, 1046, 1047, 1073, 1074,
+    1081, 1082, 1083, 1110, 1118, 1119, 108, 902, 929, 930, 937, 938,
+    965, 966, 972, 973, 974, 975, 1001, 1002, 1008, 1009, 1010, 1011,
+    1037, 1038, 1044, 1045, 1046, 1047, 1073, 1074, 1080, 1081, 1082, 1083,
+    1109, 1110, 1116, 1117, 1118, 1119, 1146, 1153, 1154, 1155, 24, 27,
+    404, 405, 408, 409, 440, 441, 444, 445, 476, 477, 480, 481,
+    485, 512, 513, 516, 517, 521, 549, 552, 553, 24, 27, 369,
+    372, 373, 374, 404, 405, 408, 409, 410, 440, 441, 444, 445,
+    446, 476, 477, 480, 481, 512, 513, 516, 517, 549, 553, 328,
+    364, 400, 401, 436, 437, 472, 473, 508, 509, 544, 545, 580,
+    581, 582, 616, 617, 618, 619, 652, 653, 654, 655, 688, 689,
+    690, 724, 725, 364, 365, 400, 401, 436, 437, 472, 473, 508,
+    509, 544, 545, 546, 580, 581, 582, 583, 616, 617, 618, 619,
+    652, 653, 654, 655, 656, 688, 689, 690, 691, 725, 34, 437,
+    473, 509, 514, 545, 546, 550, 581, 582, 583, 587, 617, 618,
+    619, 620, 621, 623, 653, 654, 655, 656, 657, 659, 689, 690,
+    691, 692, 693, 34, 436, 437, 472, 473, 478, 508, 509, 514,
+    544, 545, 550, 580, 581, 582, 586, 616, 617, 618, 619, 620,
+    622, 653, 654, 655, 656, 657, 689, 690, 691, 692, 693, 365,
+    401, 402, 437, 438, 472, 473, 474, 508, 509, 510, 544, 545,
+    546, 547, 580, 581, 582, 583, 584, 617, 618, 619, 620, 621,
+    653, 654, 655, 656, 657, 292, 293, 328, 329, 364, 365, 366,
+    400, 401, 402, 436, 437, 438, 472, 473, 474, 508, 509, 510,
+    544, 545, 546, 547, 580, 581, 582, 583, 616, 617, 618, 619,
+    620, 652, 653, 654, 655, 656, 688, 689, 690, 365, 366, 401,
+    402, 403, 437, 438, 439, 473, 474, 475, 509, 510, 511, 545,
+    546, 547, 548, 581, 582, 583, 584, 585, 617, 618, 619, 620,
+    621, 654, 655, 292, 293, 294, 328, 329, 330, 364, 365, 366,
+    367, 400, 401, 402, 403, 436, 437, 438, 439, 472, 473, 474,
+    475, 508, 509, 510, 511, 544, 545, 546, 547, 580, 581, 582,
+    583, 584, 616, 617, 618, 619, 620, 653, 654, 655, 365, 401,
+    402, 436, 437, 438, 472, 473, 474, 478, 508, 509, 510, 514,
+    544, 545, 546, 550, 580, 581, 582, 583, 586, 617, 618, 619,
+    620, 653, 654, 655, 656, 657, 329, 330, 365, 366, 367, 401,
+    402, 403, 437, 438, 439, 442, 472, 473, 474, 475, 478, 508,
+    509, 510, 511, 514, 545, 546, 547, 550, 581, 582, 583, 584,
+    617, 618, 619, 620, 621, 221, 222, 257, 258, 259, 292, 293,
+    294, 295, 328, 329, 330, 364, 365, 366, 400, 401, 402, 403,
+    436, 437, 438, 472, 473, 474, 508, 509, 510, 544, 545, 546,
+    580, 581, 582, 616, 617, 618, 619, 652, 653, 6, 139, 140,
+    149, 150, 185, 186, 187, 221, 222, 223, 224, 257, 258, 259,
+    260, 261, 292, 293, 294, 295, 328, 329, 330, 364, 365, 366,
+    400, 401, 402, 436, 437, 438, 472, 473, 508, 509, 544, 545,
+    580, 581, 582, 616, 617, 652, 653, 688, 1192, 258, 292, 293,
+    294, 295, 298, 328, 329, 330, 334, 364, 365, 366, 367, 370,
+    400, 401, 402, 403, 406, 436, 437, 438, 442, 472, 473, 474,
+    478, 508, 509, 510, 514, 544, 545, 546, 550, 581, 582, 618,
+    222, 223, 227, 257, 258, 259, 260, 263, 264, 292, 293, 294,
+    295, 298, 328, 329, 330, 334, 364, 365, 366, 370, 400, 401,
+    402, 406, 436, 437, 442, 472, 473, 478, 508, 509, 544, 545,
+    581, 34, 129, 514, 550, 581, 582, 586, 587, 592, 617, 618,
+    619, 620, 621, 622, 623, 624, 628, 653, 654, 655, 656, 657,
+    658, 659, 660, 661, 664, 690, 691, 692, 693, 694, 695, 696,
+    697, 698, 727, 728, 729, 731, 732, 733, 34, 478, 509, 514,
+    545, 546, 550, 551, 556, 581, 582, 583, 586, 587, 592, 617,
+    618, 619, 620, 621, 622, 623, 624, 654, 655, 656, 657, 659,
+    660, 661, 690, 691, 692, 693, 695, 696, 697, 12, 21, 34,
+    129, 587, 592, 623, 624, 628, 629, 657, 659, 660, 661, 662,
+    664, 665, 666, 693, 695, 696, 697, 698, 699, 700, 701, 702,
+    732, 737, 21, 34, 129, 448, 478, 484, 514, 520, 550, 551,
+    556, 562, 586, 587, 588, 592, 593, 598, 620, 621, 622, 623,
+    624, 625, 628, 629, 656, 657, 659, 660, 661, 662, 663, 664,
+    665, 666, 692, 693, 695, 696, 697, 698, 699, 700, 701, 702,
+    34, 129, 370, 376, 406, 412, 442, 448, 478, 484, 514, 520,
+    550, 551, 556, 586, 587, 592, 593, 598, 622, 623, 624, 628,
+    629, 634, 656, 657, 658, 659, 660, 661, 664, 665, 670, 693,
+    694, 695, 696, 697, 698, 700, 701, 730, 731, 736, 366, 371,
+    402, 403, 407, 437, 438, 439, 443, 473, 474, 475, 478, 479,
+    484, 509, 510, 511, 514, 515, 520, 545, 546, 547, 548, 550,
+    551, 552, 556, 582, 583, 584, 585, 587, 588, 618, 619, 620,
+    621, 623, 624, 625, 656, 657, 34, 141, 142, 550, 580, 586,
+    616, 617, 618, 622, 623, 652, 653, 654, 655, 658, 659, 688,
+    689, 690, 691, 692, 693, 694, 695, 696, 725, 726, 727, 728,
+    729, 730, 731, 732, 736, 766, 767, 772, 802, 34, 39, 140,
+    141, 142, 143, 191, 227, 263, 544, 550, 580, 586, 616, 617,
+    622, 652, 653, 654, 658, 688, 689, 690, 691, 694, 695, 724,
+    725, 726, 727, 728, 729, 730, 731, 732, 736, 760, 761, 766,
+    767, 772, 802, 808, 838, 844, 874, 910, 946, 34, 39, 48,
+    71, 124, 142, 143, 550, 556, 586, 592, 622, 623, 628, 658,
+    659, 660, 664, 665, 694, 695, 696, 700, 701, 730, 731, 732,
+    733, 736, 737, 742, 766, 767, 772, 778, 808, 814, 34, 39,
+    48, 124, 142, 143, 263, 269, 298, 304, 334, 340, 370, 376,
+    406, 412, 442, 448, 478, 484, 514, 520, 550, 556, 586, 587,
+    592, 598, 622, 623, 628, 634, 658, 659, 660, 664, 665, 670,
+    694, 695, 696, 700, 701, 730, 731, 736, 766, 772, 34, 39,
+    48, 71, 124, 141, 142, 143, 144, 197, 227, 233, 263, 550,
+    586, 592, 622, 628, 658, 659, 664, 694, 695, 700, 730, 731,
+    732, 736, 737, 742, 766, 767, 772, 773, 778, 802, 808, 814,
+    838, 844, 850, 34, 39, 48, 124, 141, 142, 143, 144, 191,
+    197, 203, 227, 233, 239, 263, 269, 298, 304, 334, 340, 370,
+    376, 406, 412, 442, 448, 478, 484, 514, 550, 556, 586, 592,
+    622, 628, 658, 659, 664, 694, 695, 700, 730, 731, 736, 766,
+    772, 808, 263, 293, 298, 328, 329, 334, 364, 365, 370, 400,
+    401, 402, 406, 436, 437, 438, 442, 472, 473, 478, 508, 509,
+    514, 544, 545, 546, 550, 580, 581, 582, 586, 587, 617, 618,
+    619, 622, 623, 653, 654, 655, 658, 659, 694, 269, 298, 299,
+    304, 305, 334, 335, 340, 370, 371, 376, 406, 407, 412, 442,
+    443, 448, 478, 479, 484, 514, 520, 550, 551, 556, 586, 587,
+    592, 623, 628, 197, 227, 228, 233, 239, 263, 264, 265, 269,
+    270, 275, 298, 299, 304, 305, 334, 335, 340, 370, 371, 376,
+    406, 407, 412, 442, 443, 448, 478, 484, 514, 520, 550, 556,
+    586, 592, 329, 330, 331, 365, 366, 367, 368, 401, 402, 403,
+    404, 437, 438, 439, 440, 473, 474, 475, 509, 510, 511, 545,
+    546, 547, 548, 582, 583, 584, 330, 331, 366, 367, 368, 402,
+    403, 404, 438, 439, 440, 474, 475, 510, 511, 547, 329, 330,
+    331, 335, 365, 366, 367, 368, 371, 401, 402, 403, 404, 406,
+    407, 437, 438, 439, 440, 442, 443, 473, 474, 475, 478, 479,
+    509, 510, 511, 514, 515, 545, 546, 547, 548, 551, 582, 583,
+    584, 587, 620, 330, 331, 332, 366, 367, 368, 369, 371, 402,
+    403, 404, 405, 407, 438, 439, 440, 443, 474, 475, 479, 510,
+    511, 515, 547, 293, 294, 295, 296, 299, 329, 330, 331, 334,
+    335, 365, 366, 367, 368, 370, 371, 401, 402, 403, 406, 407,
+    437, 438, 439, 442, 443, 473, 474, 478, 479, 509, 510, 546,
+    294, 295, 296, 299, 330, 331, 332, 335, 366, 367, 368, 369,
+    371, 402, 403, 404, 407, 438, 439, 443, 474, 27, 371, 403,
+    404, 407, 408, 439, 440, 443, 444, 475, 476, 479, 480, 511,
+    512, 515, 520, 547, 548, 549, 551, 552, 584, 585, 587, 588,
+    621, 27, 336, 367, 368, 369, 371, 372, 403, 404, 405, 407,
+    408, 409, 413, 438, 439, 440, 441, 443, 444, 445, 449, 474,
+    475, 476, 477, 479, 480, 485, 511, 512, 513, 515, 516, 521,
+    547, 548, 549, 551, 552, 557, 584, 585, 588, 589, 27, 335,
+    367, 368, 371, 403, 404, 407, 408, 439, 443, 448, 479, 484,
+    515, 551, 27, 300, 330, 331, 332, 333, 335, 336, 366, 367,
+    368, 369, 371, 372, 402, 403, 404, 405, 407, 408, 413, 438,
+    439, 440, 441, 443, 444, 449, 474, 475, 476, 479, 480, 510,
+    511, 515, 547, 548, 551, 27, 336, 341, 371, 372, 377, 407,
+    408, 409, 413, 443, 444, 445, 449, 479, 480, 485, 515, 516,
+    521, 551, 552, 557, 588, 589, 593, 27, 299, 300, 304, 305,
+    335, 336, 340, 341, 370, 371, 372, 376, 377, 406, 407, 408,
+    412, 413, 418, 442, 443, 444, 448, 449, 454, 478, 479, 480,
+    484, 485, 490, 514, 515, 520, 521, 526, 551, 552, 556, 557,
+    587, 588, 592, 593, 624, 629, 27, 335, 336, 341, 371, 372,
+    377, 407, 408, 413, 443, 444, 449, 479, 485, 515, 27, 333,
+    336, 367, 368, 369, 372, 373, 403, 404, 405, 407, 408, 409,
+    439, 440, 441, 443, 444, 445, 449, 475, 476, 477, 479, 480,
+    485, 511, 512, 513, 516, 548, 549, 552, 27, 96, 332, 333,
+    336, 337, 367, 368, 369, 372, 373, 374, 403, 404, 405, 408,
+    409, 410, 413, 439, 440, 441, 444, 445, 449, 476, 477, 480,
+    481, 485, 512, 513, 516, 549, 27, 269, 270, 299, 300, 304,
+    305, 334, 335, 336, 340, 341, 370, 371, 372, 376, 377, 406,
+    407, 408, 412, 413, 418, 442, 443, 448, 449, 454, 478, 479,
+    484, 490, 515, 520, 551, 556, 592, 27, 270, 299, 300, 301,
+    304, 305, 306, 332, 333, 335, 336, 340, 341, 368, 369, 371,
+    372, 373, 376, 377, 407, 408, 412, 413, 443, 444, 448, 449,
+    479, 484, 515, 520, 27, 233, 234, 264, 265, 269, 270, 275,
+    298, 299, 300, 304, 305, 310, 334, 335, 336, 340, 341, 370,
+    371, 372, 376, 377, 406, 407, 412, 442, 443, 448, 484, 520,
+    265, 270, 271, 299, 300, 301, 304, 305, 335, 336, 340, 341,
+    371, 372, 376, 377, 407, 412, 43, 66, 83, 414, 420, 450,
+    455, 456, 462, 463, 485, 486, 491, 492, 498, 499, 521, 522,
+    527, 528, 534, 535, 558, 559, 563, 564, 570, 571, 591, 594,
+    595, 596, 600, 601, 631, 632, 43, 66, 83, 96, 411, 414,
+    415, 420, 447, 450, 451, 455, 456, 463, 486, 487, 491, 492,
+    498, 499, 522, 527, 528, 534, 535, 555, 558, 559, 564, 571,
+    591, 595, 596, 600, 601, 2, 66, 79, 83, 462, 491, 498,
+    506, 507, 527, 534, 542, 543, 563, 564, 570, 571, 578, 579,
+    599, 600, 606, 607, 608, 615, 631, 632, 636, 637, 643, 644,
+    645, 669, 66, 83, 101, 455, 462, 463, 491, 498, 499, 506,
+    507, 527, 534, 535, 542, 543, 563, 564, 570, 571, 572, 578,
+    579, 595, 600, 601, 606, 607, 608, 609, 631, 632, 633, 636,
+    637, 638, 644, 645, 12, 21, 69, 129, 556, 562, 592, 598,
+    628, 629, 634, 635, 660, 661, 662, 663, 664, 665, 666, 667,
+    670, 671, 672, 696, 697, 698, 699, 700, 701, 702, 703, 704,
+    706, 707, 708, 736, 737, 738, 742, 743, 744, 12, 32, 69,
+    79, 86, 454, 460, 490, 496, 526, 532, 533, 562, 568, 569,
+    598, 599, 604, 605, 606, 629, 634, 635, 640, 641, 642, 665,
+    666, 667, 670, 671, 672, 676, 677, 678, 679, 702, 703, 706,
+    707, 708, 712, 713, 714, 32, 79, 83, 118, 455, 461, 490,
+    491, 497, 498, 526, 527, 533, 534, 557, 562, 563, 569, 570,
+    593, 594, 599, 600, 605, 606, 607, 630, 631, 635, 636, 642,
+    643, 666, 667, 668, 671, 672, 673, 32, 79, 382, 389, 418,
+    425, 454, 460, 461, 490, 491, 496, 497, 526, 532, 533, 562,
+    563, 568, 569, 570, 598, 599, 605, 606, 630, 634, 635, 641,
+    642, 32, 269, 275, 304, 305, 310, 311, 340, 346, 376, 377,
+    382, 388, 412, 413, 418, 424, 448, 449, 454, 460, 484, 485,
+    490, 496, 520, 526, 532, 556, 557, 562, 568, 592, 593, 598,
+    599, 628, 629, 634, 635, 664, 665, 670, 61, 86, 102, 109,
+    568, 575, 604, 605, 611, 612, 613, 640, 641, 642, 647, 648,
+    649, 650, 671, 672, 676, 677, 678, 679, 684, 685, 686, 687,
+    707, 708, 709, 713, 714, 715, 716, 720, 721, 722, 723, 749,
+    750, 757, 758, 759, 79, 102, 109, 496, 503, 504, 532, 539,
+    540, 568, 569, 575, 576, 577, 604, 605, 606, 611, 612, 613,
+    614, 635, 640, 641, 642, 643, 647, 648, 649, 650, 651, 671,
+    672, 676, 677, 678, 679, 684, 685, 686, 687, 708, 713, 714,
+    715, 720, 721, 722, 2, 32, 79, 132, 497, 504, 505, 533,
+    540, 541, 569, 570, 576, 577, 578, 579, 599, 605, 606, 607,
+    612, 613, 614, 615, 635, 636, 641, 642, 643, 644, 649, 650,
+    651, 668, 671, 672, 673, 678, 679, 680, 681, 685, 686, 687,
+    2, 32, 79, 497, 505, 506, 533, 534, 540, 541, 542, 563,
+    569, 570, 577, 578, 579, 599, 600, 605, 606, 607, 613, 614,
+    615, 636, 642, 643, 644, 650, 651, 432, 468, 469, 503, 504,
+    505, 539, 540, 541, 575, 576, 577, 578, 605, 606, 611, 612,
+    613, 614, 615, 641, 642, 643, 648, 649, 650, 651, 678, 679,
+    684, 685, 686, 687, 396, 397, 425, 432, 433, 461, 468, 469,
+    470, 497, 503, 504, 505, 506, 533, 539, 540, 541, 542, 569,
+    570, 575, 576, 577, 578, 579, 606, 612, 613, 614, 615, 642,
+    643, 648, 649, 650, 651, 27, 32, 83, 118, 377, 408, 413,
+    419, 444, 449, 455, 480, 485, 490, 491, 516, 520, 521, 526,
+    527, 533, 552, 553, 557, 558, 562, 563, 588, 589, 590, 591,
+    593, 594, 595, 599, 600, 625, 626, 627, 629, 630, 631, 635,
+    636, 662, 663, 667, 27, 32, 83, 118, 377, 383, 408, 409,
+    413, 414, 419, 444, 445, 449, 450, 455, 480, 481, 485, 486,
+    491, 516, 517, 521, 522, 527, 552, 553, 554, 557, 558, 563,
+    564, 589, 590, 591, 593, 594, 595, 599, 600, 626, 627, 630,
+    631, 27, 32, 118, 341, 347, 372, 377, 383, 408, 409, 413,
+    418, 419, 444, 449, 454, 455, 480, 484, 485, 490, 491, 521,
+    526, 527, 552, 557, 563, 589, 593, 599, 32, 79, 83, 118,
+    419, 455, 462, 491, 497, 498, 526, 527, 533, 534, 563, 569,
+    570, 571, 594, 599, 600, 606, 607, 630, 631, 635, 636, 32,
+    83, 419, 426, 449, 455, 462, 485, 491, 497, 498, 527, 533,
+    534, 558, 563, 564, 570, 571, 594, 599, 600, 606, 607, 631,
+    32, 377, 382, 383, 389, 390, 413, 418, 419, 425, 426, 449,
+    454, 455, 461, 462, 485, 490, 491, 497, 498, 526, 527, 532,
+    533, 534, 557, 562, 563, 569, 570, 599, 605, 606, 635, 32,
+    347, 377, 383, 389, 390, 413, 419, 425, 426, 449, 454, 455,
+    461, 462, 485, 490, 491, 497, 498, 526, 527, 533, 534, 563,
+    569, 570, 599, 606, 43, 96, 373, 374, 378, 409, 410, 411,
+    414, 419, 445, 446, 449, 450, 455, 456, 481, 482, 485, 486,
+    491, 517, 521, 522, 527, 553, 554, 558, 25, 27, 96, 336,
+    337, 341, 342, 347, 372, 373, 374, 377, 378, 383, 408, 409,
+    410, 413, 414, 419, 444, 445, 446, 449, 450, 455, 480, 481,
+    485, 486, 491, 516, 521, 527, 552, 553, 557, 563, 27, 95,
+    96, 336, 337, 338, 341, 342, 347, 372, 373, 374, 375, 377,
+    378, 383, 384, 408, 409, 410, 411, 413, 414, 419, 420, 444,
+    445, 446, 449, 450, 455, 480, 481, 485, 486, 491, 521, 527,
+    66, 83, 96, 378, 383, 384, 413, 414, 419, 420, 426, 427,
+    449, 450, 455, 456, 462, 463, 485, 486, 491, 492, 498, 499,
+    521, 522, 527, 534, 535, 558, 563, 564, 570, 571, 594, 595,
+    600, 607, 43, 66, 83, 96, 374, 375, 378, 379, 383, 384,
+    390, 391, 410, 411, 413, 414, 415, 419, 420, 426, 427, 446,
+    449, 450, 451, 455, 456, 462, 463, 464, 485, 486, 491, 492,
+    498, 499, 522, 527, 528, 534, 535, 558, 563, 564, 570, 571,
+    595, 600, 25, 347, 354, 377, 378, 383, 390, 413, 414, 419,
+    420, 426, 427, 449, 450, 455, 462, 491, 498, 527, 534, 563,
+    570, 25, 96, 312, 338, 341, 342, 347, 348, 354, 355, 374,
+    375, 377, 378, 379, 383, 384, 390, 391, 410, 413, 414, 415,
+    419, 420, 426, 427, 449, 450, 455, 456, 462, 463, 485, 486,
+    491, 498, 499, 527, 534, 25, 27, 32, 305, 310, 311, 336,
+    340, 341, 346, 347, 372, 376, 377, 382, 383, 408, 412, 413,
+    418, 419, 448, 449, 454, 455, 484, 485, 490, 491, 526, 25,
+    27, 128, 234, 240, 269, 270, 271, 275, 276, 277, 283, 300,
+    301, 304, 305, 306, 310, 311, 335, 336, 340, 341, 346, 347,
+    371, 372, 376, 377, 382, 383, 412, 413, 418, 419, 448, 449,
+    454, 484, 490, 526, 25, 32, 311, 317, 318, 341, 346, 347,
+    353, 354, 377, 382, 383, 389, 390, 413, 418, 419, 425, 426,
+    454, 455, 461, 462, 490, 491, 497, 526, 533, 11, 25, 128,
+    276, 277, 282, 283, 284, 305, 310, 311, 317, 318, 341, 346,
+    347, 353, 354, 377, 382, 383, 389, 390, 418, 419, 425, 454,
+    461, 490, 25, 27, 305, 306, 311, 336, 337, 341, 342, 347,
+    372, 373, 377, 378, 383, 408, 409, 413, 414, 419, 449, 455,
+    485, 491, 25, 27, 95, 96, 300, 301, 302, 303, 305, 306,
+    307, 311, 312, 336, 337, 338, 339, 341, 342, 347, 348, 372,
+    373, 374, 375, 377, 378, 383, 384, 408, 409, 410, 413, 414,
+    419, 444, 445, 449, 455, 485, 491, 32, 462, 470, 497, 498,
+    505, 506, 533, 534, 541, 542, 543, 569, 570, 571, 577, 578,
+    579, 600, 606, 607, 614, 615, 636, 643, 644, 32, 66, 426,
+    455, 462, 470, 471, 491, 498, 505, 506, 507, 527, 533, 534,
+    541, 542, 543, 570, 571, 578, 579, 600, 607, 32, 347, 354,
+    383, 389, 390, 397, 398, 419, 425, 426, 433, 434, 435, 455,
+    461, 462, 468, 469, 470, 471, 491, 497, 498, 504, 505, 506,
+    507, 533, 534, 540, 541, 542, 570, 577, 578, 579, 606, 66,
+    101, 391, 419, 420, 426, 427, 434, 435, 455, 456, 462, 463,
+    470, 471, 491, 492, 498, 499, 505, 506, 507, 527, 534, 535,
+    541, 542, 543, 564, 570, 571, 579, 600, 607, 66, 101, 384,
+    391, 419, 420, 426, 427, 428, 435, 455, 456, 462, 463, 464,
+    470, 471, 492, 498, 499, 506, 507, 534, 535, 543, 571, 25,
+    347, 354, 383, 390, 391, 398, 399, 419, 426, 427, 433, 434,
+    435, 455, 462, 463, 469, 470, 471, 491, 498, 505, 506, 507,
+    534, 542, 25, 56, 100, 347, 348, 354, 355, 362, 363, 383,
+    384, 390, 391, 392, 398, 399, 419, 420, 426, 427, 428, 434,
+    435, 455, 456, 462, 463, 470, 471, 491, 498, 499, 506, 507,
+    534, 542, 543, 5, 7, 11, 25, 60, 64, 91, 92, 100,
+    105, 128, 134, 282, 283, 284, 290, 291, 311, 317, 318, 319,
+    324, 325, 326, 327, 347, 353, 354, 360, 361, 362, 383, 389,
+    390, 396, 397, 398, 425, 432, 433, 461, 468, 469, 4, 17,
+    60, 64, 73, 100, 324, 325, 326, 327, 353, 359, 360, 361,
+    362, 389, 390, 395, 396, 397, 398, 425, 426, 431, 432, 433,
+    434, 461, 467, 468, 469, 470, 503, 504, 505, 506, 539, 540,
+    541, 576, 577, 613, 60, 64, 100, 318, 325, 326, 327, 353,
+    354, 360, 361, 362, 363, 389, 390, 396, 397, 398, 399, 426,
+    432, 433, 434, 435, 468, 469, 470, 504, 505, 506, 541, 5,
+    7, 60, 64, 91, 92, 100, 105, 134, 290, 291, 318, 324,
+    325, 326, 327, 353, 354, 360, 361, 362, 363, 389, 390, 396,
+    397, 398, 399, 432, 433, 434, 468, 469, 25, 56, 100, 318,
+    319, 326, 327, 347, 353, 354, 355, 361, 362, 363, 383, 389,
+    390, 391, 397, 398, 399, 419, 426, 433, 434, 435, 462, 469,
+    470, 25, 56, 100, 311, 312, 318, 319, 320, 326, 327, 347,
+    348, 354, 355, 361, 362, 363, 383, 384, 390, 391, 397, 398,
+    399, 419, 420, 426, 427, 434, 435, 455, 462, 470, 471, 11,
+    25, 56, 91, 92, 100, 128, 134, 283, 284, 285, 291, 311,
+    312, 318, 319, 325, 326, 327, 347, 353, 354, 355, 361, 362,
+    363, 383, 389, 390, 397, 398, 433, 25, 56, 100, 284, 285,
+    312, 318, 319, 320, 327, 347, 348, 354, 355, 362, 363, 383,
+    390, 6, 139, 149, 150, 185, 186, 221, 257, 724, 760, 761,
+    796, 797, 832, 833, 868, 869, 904, 905, 940, 941, 976, 977,
+    1012, 1013, 1048, 1049, 1084, 1085, 1120, 1121, 1156, 1157, 1192, 1193,
+    1194, 6, 139, 149, 150, 151, 152, 185, 186, 187, 221, 222,
+    257, 796, 797, 832, 833, 868, 869, 904, 905, 940, 941, 976,
+    977, 1012, 1013, 1014, 1048, 1049, 1050, 1084, 1085, 1086, 1087, 1120,
+    1121, 1122, 1123, 1156, 1157, 1158, 1159, 1160, 1192, 1193, 1194, 1195,
+    6, 139, 140, 149, 150, 151, 152, 153, 185, 186, 187, 188,
+    189, 221, 222, 223, 224, 257, 258, 259, 832, 868, 904, 940,
+    976, 1012, 1048, 1084, 1085, 1120, 1121, 1122, 1123, 1156, 1157, 1158,
+    1159, 1160, 1192, 1193, 1194, 1195, 1196, 149, 150, 151, 155, 185,
+    186, 187, 221, 222, 257, 796, 832, 833, 868, 869, 904, 905,
+    940, 941, 976, 977, 1012, 1013, 1048, 1049, 1084, 1085, 1086, 1120,
+    1121, 1122, 1123, 1127, 1156, 1157, 1158, 1159, 1162, 1163, 1192, 1193,
+    1194, 1195, 1198, 1199, 139, 140, 149, 150, 151, 152, 153, 155,
+    156, 185, 186, 187, 188, 189, 192, 221, 222, 223, 224, 257,
+    258, 259, 292, 904, 940, 976, 1012, 1048, 1084, 1085, 1120, 1121,
+    1122, 1156, 1157, 1158, 1159, 1160, 1162, 1163, 1192, 1193, 1194, 1195,
+    1196, 1198, 1199, 6, 139, 140, 149, 150, 151, 185, 186, 187,
+    188, 221, 222, 223, 224, 225, 257, 258, 259, 260, 261, 292,
+    293, 294, 295, 328, 329, 330, 364, 365, 366, 400, 401, 436,
+    437, 472, 473, 508, 544, 580, 616, 652, 688, 724, 1120, 1156,
+    1192, 1193, 139, 140, 149, 150, 151, 185, 186, 187, 188, 221,
+    222, 223, 224, 225, 257, 258, 259, 260, 292, 293, 294, 328,
+    329, 364, 400, 436, 1156, 1192, 1193, 1194, 149, 150, 155, 185,
+    186, 187, 191, 221, 222, 223, 224, 227, 228, 257, 258, 259,
+    260, 261, 263, 264, 292, 293, 294, 295, 298, 328, 329, 330,
+    364, 365, 400, 401, 436, 472, 508, 544, 580, 1192, 149, 150,
+    151, 155, 156, 185, 186, 187, 188, 191, 192, 221, 222, 223,
+    224, 225, 227, 228, 229, 257, 258, 259, 260, 261, 263, 264,
+    292, 293, 294, 295, 328, 329, 364, 1192, 1193, 149, 150, 151,
+    152, 155, 156, 185, 186, 187, 188, 189, 191, 192, 193, 221,
+    222, 223, 224, 225, 226, 227, 228, 229, 257, 258, 259, 260,
+    261, 264, 293, 294, 1192, 1193, 1194, 1195, 1198, 1199, 150, 151,
+    152, 153, 155, 156, 157, 186, 187, 188, 189, 190, 191, 192,
+    193, 222, 223, 224, 225, 226, 228, 229, 259, 260, 261, 1157,
+    1158, 1159, 1193, 1194, 1195, 1196, 1198, 1199, 1200, 150, 151, 156,
+    977, 1013, 1049, 1050, 1085, 1086, 1087, 1088, 1091, 1121, 1122, 1123,
+    1124, 1125, 1127, 1128, 1157, 1158, 1159, 1160, 1161, 1163, 1164, 1193,
+    1194, 1195, 1196, 1199, 1200, 150, 151, 155, 156, 192, 977, 982,
+    1013, 1018, 1049, 1050, 1054, 1055, 1085, 1086, 1087, 1088, 1090, 1091,
+    1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1157, 1158, 1159, 1160,
+    1161, 1162, 1163, 1164, 1165, 1193, 1194, 1195, 1196, 1198, 1199, 1200,
+    150, 151, 152, 153, 156, 157, 187, 188, 189, 1121, 1122, 1123,
+    1124, 1157, 1158, 1159, 1160, 1161, 1163, 1164, 1193, 1194, 1195, 1196,
+    1197, 1199, 1200, 150, 151, 152, 153, 154, 155, 156, 157, 186,
+    187, 188, 189, 190, 192, 193, 223, 224, 225, 1054, 1085, 1090,
+    1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1157, 1158, 1159, 1160,
+    1161, 1162, 1163, 1164, 1165, 1193, 1194, 1195, 1196, 1197, 1198, 1199,
+    1200, 1201, 140, 141, 142, 155, 156, 191, 192, 221, 222, 223,
+    227, 228, 257, 258, 259, 263, 264, 292, 293, 298, 328, 329,
+    334, 364, 365, 370, 400, 406, 436, 442, 652, 658, 688, 694,
+    730, 766, 1090, 1126, 1162, 1198, 39, 141, 142, 143, 155, 156,
+    161, 191, 192, 197, 227, 228, 233, 263, 264, 269, 298, 299,
+    304, 334, 370, 406, 442, 478, 586, 622, 658, 694, 730, 766,
+    802, 1090, 1126, 1132, 1162, 1168, 1198, 1204, 141, 149, 155, 156,
+    161, 186, 191, 192, 227, 263, 802, 838, 874, 910, 946, 976,
+    982, 1012, 1018, 1048, 1049, 1054, 1084, 1085, 1090, 1091, 1096, 1120,
+    1121, 1126, 1127, 1132, 1156, 1157, 1162, 1163, 1168, 1192, 1193, 1198,
+    1199, 1204, 1205, 141, 142, 155, 156, 161, 162, 191, 192, 197,
+    227, 233, 263, 802, 808, 838, 844, 874, 880, 910, 916, 946,
+    952, 982, 988, 1018, 1024, 1054, 1060, 1090, 1091, 1096, 1126, 1127,
+    1132, 1133, 1162, 1163, 1168, 1169, 1198, 1199, 1204, 1205, 141, 142,
+    149, 150, 155, 156, 157, 161, 162, 185, 186, 187, 188, 191,
+    192, 193, 197, 221, 222, 223, 224, 227, 228, 258, 259, 263,
+    264, 298, 1018, 1054, 1084, 1090, 1120, 1126, 1127, 1156, 1157, 1162,
+    1163, 1168, 1192, 1193, 1194, 1198, 1199, 1200, 1204, 1205, 39, 141,
+    142, 143, 155, 156, 157, 161, 162, 191, 192, 193, 197, 198,
+    227, 228, 229, 233, 234, 263, 264, 269, 298, 946, 982, 1018,
+    1054, 1090, 1096, 1126, 1127, 1132, 1162, 1163, 1168, 1169, 1198, 1199,
+    1200, 1204, 1205, 39, 48, 71, 124, 142, 143, 144, 161, 167,
+    197, 203, 233, 239, 269, 304, 664, 700, 736, 772, 773, 778,
+    808, 814, 844, 850, 880, 886, 916, 922, 952, 958, 988, 994,
+    1024, 1030, 1060, 1066, 1096, 1102, 1132, 1138, 1168, 1174, 1204, 1210,
+    161, 197, 988, 1024, 1060, 1096, 1132, 1168, 1204, 39, 48, 143,
+    161, 167, 197, 203, 233, 808, 844, 850, 880, 916, 922, 952,
+    958, 988, 994, 1024, 1030, 1060, 1066, 1096, 1102, 1132, 1138, 1168,
+    1169, 1174, 1175, 1204, 1205, 1210, 1211, 141, 155, 156, 161, 186,
+    187, 191, 192, 221, 222, 223, 224, 225, 227, 228, 229, 257,
+    258, 259, 260, 261, 263, 264, 265, 292, 293, 294, 295, 298,
+    299, 328, 329, 330, 334, 335, 364, 365, 366, 370, 400, 401,
+    406, 436, 442, 472, 478, 1198, 141, 142, 155, 156, 161, 191,
+    192, 197, 198, 227, 228, 229, 233, 234, 263, 264, 265, 269,
+    294, 295, 298, 299, 304, 330, 334, 335, 370, 406, 442, 478,
+    1198, 1204, 187, 192, 193, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 258, 259, 260, 261, 262, 263, 264, 265, 266, 293,
+    294, 295, 296, 297, 298, 299, 300, 328, 329, 330, 331, 332,
+    334, 335, 365, 366, 367, 370, 371, 401, 402, 406, 437, 442,
+    192, 198, 228, 229, 233, 234, 260, 261, 262, 263, 264, 265,
+    266, 269, 270, 294, 295, 296, 297, 298, 299, 300, 304, 330,
+    331, 332, 334, 335, 370, 371, 406, 155, 156, 157, 162, 191,
+    192, 193, 222, 223, 224, 225, 226, 227, 228, 229, 259, 260,
+    261, 263, 264, 265, 1198, 1199, 155, 156, 157, 161, 162, 191,
+    192, 193, 197, 198, 227, 228, 229, 230, 233, 234, 260, 261,
+    263, 264, 265, 269, 270, 298, 299, 1162, 1163, 1168, 1198, 1199,
+    1200, 1204, 1205, 156, 1018, 1054, 1055, 1090, 1091, 1124, 1126, 1127,
+    1128, 1133, 1162, 1163, 1164, 1169, 1198, 1199, 1200, 1205, 155, 156,
+    161, 162, 192, 952, 982, 988, 1018, 1024, 1054, 1055, 1060, 1090,
+    1091, 1092, 1096, 1097, 1126, 1127, 1128, 1132, 1133, 1162, 1163, 1164,
+    1165, 1168, 1169, 1198, 1199, 1200, 1204, 1205, 151, 152, 153, 155,
+    156, 157, 161, 162, 187, 188, 189, 192, 193, 198, 228, 1054,
+    1090, 1126, 1127, 1128, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
+    1168, 1169, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1204, 1205,
+    155, 156, 157, 161, 162, 192, 193, 197, 198, 1090, 1096, 1126,
+    1127, 1132, 1133, 1162, 1163, 1164, 1168, 1169, 1198, 1199, 1200, 1201,
+    1204, 1205, 1206, 156, 157, 162, 193, 1127, 1128, 1129, 1160, 1161,
+    1163, 1164, 1165, 1166, 1167, 1169, 1170, 1196, 1197, 1199, 1200, 1201,
+    1202, 1205, 1206, 156, 157, 158, 162, 163, 168, 193, 198, 1091,
+    1127, 1128, 1129, 1130, 1133, 1163, 1164, 1165, 1166, 1167, 1169, 1170,
+    1199, 1200, 1201, 1202, 1205, 1206, 1211, 1212, 161, 162, 988, 1024,
+    1060, 1096, 1097, 1127, 1132, 1133, 1139, 1163, 1168, 1169, 1175, 1199,
+    1204, 1205, 1211, 113, 161, 162, 167, 168, 197, 198, 203, 916,
+    922, 952, 958, 988, 994, 1024, 1030, 1060, 1066, 1096, 1097, 1102,
+    1103, 1132, 1133, 1138, 1139, 1168, 1169, 1174, 1175, 1204, 1205, 1210,
+    1211, 157, 162, 163, 168, 169, 198, 1133, 1163, 1164, 1165, 1166,
+    1169, 1170, 1175, 1176, 1200, 1201, 1205, 1206, 1211, 1212, 53, 103,
+    162, 163, 168, 169, 198, 204, 1133, 1139, 1169, 1170, 1175, 1176,
+    1205, 1206, 1211, 1212, 1219, 151, 152, 153, 154, 156, 157, 158,
+    162, 187, 188, 189, 190, 192, 193, 194, 198, 224, 225, 226,
+    228, 229, 1164, 1196, 1197, 1199, 1200, 1201, 1205, 156, 157, 161,
+    162, 163, 192, 193, 194, 198, 199, 229, 234, 1199, 1200, 1201,
+    1204, 1205, 10, 53, 157, 158, 162, 163, 168, 169, 193, 194,
+    198, 199, 204, 205, 1165, 1166, 1167, 1169, 1170, 1200, 1201, 1202,
+    1205, 1206, 1207, 1211, 1212, 10, 53, 62, 103, 120, 162, 163,
+    168, 169, 175, 176, 177, 198, 199, 204, 205, 235, 1169, 1170,
+    1175, 1176, 1205, 1206, 1207, 1211, 1212, 1219, 23, 39, 48, 71,
+    113, 124, 143, 144, 161, 167, 197, 203, 233, 239, 269, 275,
+    304, 310, 340, 664, 700, 706, 736, 742, 772, 778, 808, 814,
+    844, 850, 886, 922, 958, 988, 994, 1024, 1030, 1060, 1066, 1096,
+    1102, 1132, 1138, 1168, 1174, 1204, 1210, 48, 113, 161, 167, 168,
+    197, 203, 204, 233, 239, 922, 958, 994, 1030, 1060, 1066, 1096,
+    1102, 1132, 1138, 1168, 1174, 1175, 1204, 1210, 1211, 23, 48, 113,
+    144, 167, 168, 173, 174, 175, 203, 204, 209, 210, 239, 245,
+    275, 850, 856, 886, 892, 922, 928, 958, 964, 994, 1000, 1030,
+    1036, 1066, 1072, 1073, 1102, 1108, 1109, 1138, 1139, 1144, 1145, 1174,
+    1175, 1180, 1181, 1182, 1210, 1211, 1216, 1217, 1218, 39, 48, 113,
+    143, 144, 161, 162, 167, 168, 173, 174, 175, 197, 198, 203,
+    204, 205, 210, 211, 233, 234, 239, 240, 269, 270, 275, 276,
+    304, 310, 1102, 1132, 1138, 1168, 1174, 1175, 1181, 1204, 1205, 1210,
+    1211, 1216, 1217, 1218, 23, 48, 113, 144, 145, 167, 168, 173,
+    174, 175, 203, 204, 209, 210, 211, 212, 234, 239, 240, 245,
+    246, 247, 270, 275, 276, 310, 1108, 1138, 1144, 1174, 1175, 1180,
+    1181, 1182, 1210, 1211, 1216, 1217, 1218, 23, 31, 67, 113, 128,
+    144, 145, 167, 168, 173, 174, 175, 181, 182, 183, 184, 203,
+    204, 209, 210, 211, 212, 220, 239, 240, 245, 246, 247, 248,
+    275, 276, 281, 282, 1108, 1144, 1145, 1174, 1180, 1181, 1210, 1211,
+    1216, 1217, 1218, 1224, 1225, 1226, 113, 167, 168, 175, 203, 204,
+    994, 1030, 1060, 1066, 1096, 1102, 1103, 1132, 1133, 1138, 1139, 1145,
+    1146, 1168, 1169, 1174, 1175, 1181, 1182, 1204, 1205, 1210, 1211, 1217,
+    1218, 1219, 103, 113, 167, 168, 173, 174, 175, 176, 203, 204,
+    210, 211, 958, 994, 1000, 1001, 1030, 1036, 1037, 1066, 1072, 1073,
+    1102, 1103, 1108, 1109, 1110, 1138, 1139, 1144, 1145, 1146, 1174, 1175,
+    1180, 1181, 1182, 1183, 1210, 1211, 1212, 1216, 1217, 1218, 1219, 103,
+    162, 168, 175, 176, 1066, 1097, 1102, 1103, 1133, 1134, 1139, 1140,
+    1146, 1147, 1169, 1170, 1175, 1176, 1182, 1183, 1184, 1205, 1206, 1211,
+    1212, 1218, 1219, 1220, 62, 103, 168, 175, 176, 1066, 1073, 1103,
+    1109, 1110, 1139, 1140, 1145, 1146, 1147, 1175, 1176, 1181, 1182, 1183,
+    1184, 1211, 1212, 1218, 1219, 1220, 53, 62, 103, 162, 163, 168,
+    169, 175, 176, 177, 199, 204, 205, 212, 1139, 1169, 1170, 1175,
+    1176, 1182, 1183, 1184, 1205, 1206, 1207, 1211, 1212, 1218, 1219, 1220,
+    31, 53, 62, 103, 116, 168, 169, 175, 176, 177, 204, 205,
+    211, 212, 213, 1175, 1176, 1182, 1183, 1184, 1211, 1212, 1218, 1219,
+    1220, 62, 67, 103, 168, 175, 176, 183, 184, 1073, 1103, 1109,
+    1110, 1139, 1145, 1146, 1147, 1154, 1155, 1175, 1176, 1181, 1182, 1183,
+    1184, 1190, 1191, 1211, 1212, 1218, 1219, 1220, 1226, 1227, 62, 67,
+    103, 107, 108, 174, 175, 176, 182, 183, 184, 1037, 1073, 1080,
+    1081, 1109, 1110, 1116, 1117, 1118, 1119, 1139, 1145, 1146, 1147, 1153,
+    1154, 1155, 1175, 1181, 1182, 1183, 1184, 1189, 1190, 1191, 1217, 1218,
+    1219, 1220, 1225, 1226, 1227, 167, 197, 198, 203, 204, 233, 234,
+    235, 239, 240, 241, 269, 270, 271, 275, 276, 300, 304, 305,
+    310, 311, 340, 341, 346, 376, 382, 412, 418, 448, 113, 128,
+    203, 204, 210, 211, 239, 240, 241, 246, 247, 270, 271, 275,
+    276, 277, 304, 305, 310, 311, 340, 341, 346, 376, 382, 418,
+    106, 234, 235, 240, 241, 266, 267, 268, 270, 271, 272, 276,
+    277, 300, 301, 302, 303, 305, 306, 311, 336, 337, 340, 341,
+    11, 25, 106, 128, 204, 211, 234, 235, 240, 241, 247, 248,
+    249, 270, 271, 272, 275, 276, 277, 278, 283, 284, 301, 302,
+    303, 305, 306, 307, 310, 311, 312, 337, 340, 341, 342, 346,
+    347, 377, 382, 383, 418, 11, 113, 128, 174, 203, 204, 209,
+    210, 211, 239, 240, 241, 245, 246, 247, 248, 275, 276, 277,
+    281, 282, 283, 284, 305, 310, 311, 316, 317, 318, 346, 347,
+    352, 353, 382, 388, 418, 424, 11, 128, 210, 211, 218, 219,
+    240, 245, 246, 247, 248, 254, 255, 256, 275, 276, 281, 282,
+    283, 284, 310, 311, 316, 317, 318, 346, 352, 353, 382, 388,
+    424, 11, 31, 68, 113, 128, 167, 168, 173, 174, 175, 182,
+    183, 184, 203, 204, 205, 209, 210, 211, 212, 213, 218, 219,
+    220, 239, 240, 241, 245, 246, 247, 248, 249, 271, 275, 276,
+    277, 281, 282, 283, 284, 310, 311, 316, 317, 1217, 1218, 11,
+    31, 68, 113, 128, 174, 175, 182, 183, 184, 210, 211, 212,
+    217, 218, 219, 220, 240, 241, 245, 246, 247, 248, 249, 253,
+    254, 255, 256, 276, 277, 282, 283, 284, 11, 25, 106, 117,
+    128, 240, 241, 247, 248, 249, 271, 272, 276, 277, 278, 282,
+    283, 284, 285, 305, 306, 310, 311, 312, 317, 318, 319, 341,
+    346, 347, 353, 382, 11, 25, 128, 240, 247, 248, 249, 256,
+    276, 277, 282, 283, 284, 285, 311, 312, 317, 318, 319, 347,
+    353, 389, 0, 1, 3, 4, 17, 42, 44, 45, 51, 55,
+    57, 58, 63, 76, 89, 90, 94, 104, 119, 125, 135, 136,
+    148, 215, 251, 252, 287, 288, 322, 323, 358, 359, 394, 395,
+    430, 466, 502, 574, 610, 646, 682, 718, 754, 755, 790, 791,
+    826, 1, 5, 7, 42, 44, 58, 76, 90, 94, 104, 105,
+    107, 119, 125, 136, 148, 179, 180, 181, 182, 215, 216, 217,
+    218, 219, 251, 252, 253, 254, 255, 287, 288, 289, 290, 322,
+    323, 358, 1114, 1150, 1186, 1187, 1188, 1222, 1223, 1224, 1225, 1,
+    5, 7, 76, 90, 94, 104, 105, 119, 134, 181, 216, 217,
+    218, 219, 252, 253, 254, 255, 256, 288, 289, 290, 291, 5,
+    7, 11, 91, 92, 100, 105, 128, 134, 247, 248, 254, 255,
+    256, 282, 283, 284, 289, 290, 291, 311, 317, 318, 324, 325,
+    326, 353, 360, 6, 139, 724, 725, 760, 761, 762, 763, 764,
+    796, 797, 798, 799, 832, 833, 834, 868, 869, 870, 904, 905,
+    940, 941, 976, 977, 1012, 1013, 1048, 1084, 1120, 1156, 6, 139,
+    724, 725, 760, 761, 762, 796, 797, 798, 832, 833, 834, 868,
+    869, 904, 905, 940, 941, 976, 977, 1012, 1048, 1084, 1120, 1156,
+    1192, 6, 139, 760, 761, 762, 763, 796, 797, 798, 799, 832,
+    833, 834, 835, 868, 869, 870, 904, 905, 906, 940, 941, 942,
+    976, 977, 978, 1012, 1013, 1048, 1049, 1084, 1085, 1120, 1121, 1157,
+    6, 139, 140, 149, 150, 185, 221, 724, 760, 761, 762, 763,
+    796, 797, 798, 799, 832, 833, 834, 868, 869, 870, 904, 905,
+    906, 940, 941, 942, 976, 977, 978, 1012, 1013, 1048, 1049, 1084,
+    1085, 1120, 1121, 1122, 1156, 1157, 1158, 1192, 1193, 688, 689, 724,
+    725, 726, 727, 728, 729, 730, 760, 761, 762, 763, 764, 765,
+    766, 767, 768, 796, 797, 798, 799, 802, 803, 832, 833, 838,
+    839, 868, 869, 874, 904, 905, 910, 940, 941, 946, 976, 982,
+    1012, 1018, 1048, 1084, 1120, 760, 761, 762, 763, 764, 765, 766,
+    767, 796, 797, 798, 799, 802, 803, 832, 833, 834, 838, 839,
+    868, 869, 874, 904, 905, 910, 940, 941, 946, 976, 977, 982,
+    1012, 1013, 1018, 1048, 1049, 1054, 1084, 1085, 1090, 1120, 1121, 1126,
+    1162, 798, 799, 800, 801, 833, 834, 835, 839, 869, 870, 875,
+    905, 906, 907, 911, 941, 942, 943, 947, 977, 978, 979, 983,
+    1013, 1014, 1019, 1049, 1050, 1086, 798, 799, 800, 833, 834, 839,
+    869, 870, 875, 905, 906, 911, 941, 942, 947, 977, 978, 1013,
+    1014, 1049, 1050, 1085, 1086, 799, 800, 804, 834, 839, 869, 870,
+    874, 875, 905, 906, 910, 911, 941, 942, 946, 947, 977, 978,
+    983, 1013, 1014, 1019, 1049, 149, 155, 796, 797, 798, 802, 832,
+    833, 838, 868, 869, 874, 904, 905, 910, 940, 941, 946, 976,
+    977, 982, 1012, 1013, 1014, 1018, 1048, 1049, 1050, 1054, 1084, 1085,
+    1086, 1090, 1091, 1120, 1121, 1122, 1126, 1127, 1156, 1157, 1158, 1162,
+    1163, 1192, 1193, 1198, 1199, 905, 910, 941, 946, 976, 977, 978,
+    982, 983, 1012, 1013, 1014, 1018, 1019, 1048, 1049, 1050, 1054, 1055,
+    1084, 1085, 1086, 1087, 1090, 1091, 1120, 1121, 1122, 1123, 1124, 1126,
+    1127, 1157, 1158, 1159, 1162, 1163, 1164, 1193, 1198, 1199, 803, 804,
+    839, 845, 874, 875, 880, 910, 911, 916, 946, 947, 982, 983,
+    1018, 1019, 1054, 1055, 803, 804, 838, 839, 874, 875, 880, 910,
+    911, 916, 946, 947, 952, 977, 982, 983, 988, 1013, 1018, 1019,
+    1024, 1049, 1054, 1055, 1090, 1091, 1126, 1127, 816, 822, 823, 851,
+    857, 858, 859, 867, 886, 893, 894, 901, 902, 903, 922, 923,
+    929, 930, 937, 938, 939, 958, 959, 965, 966, 973, 974, 994,
+    1001, 1002, 1030, 1037, 1066, 1073, 1109, 108, 858, 859, 893, 894,
+    902, 903, 922, 923, 929, 930, 937, 938, 939, 958, 959, 965,
+    966, 973, 974, 975, 994, 995, 1001, 1002, 1030, 1037, 1038, 1066,
+    1073, 1109, 48, 71, 124, 144, 778, 779, 814, 815, 821, 850,
+    856, 857, 886, 892, 893, 922, 928, 929, 958, 964, 965, 994,
+    1000, 1030, 1036, 1066, 1102, 1108, 1138, 1144, 1174, 1210, 48, 71,
+    124, 144, 167, 814, 850, 857, 886, 892, 893, 922, 928, 929,
+    958, 964, 965, 994, 1000, 1001, 1030, 1036, 1066, 1072, 1102, 1108,
+    1138, 1144, 1145, 1174, 1180, 1181, 1210, 23, 48, 71, 124, 144,
+    145, 173, 778, 784, 814, 820, 821, 850, 856, 857, 886, 892,
+    893, 922, 928, 929, 958, 964, 965, 994, 1000, 1030, 1036, 1072,
+    1108, 1138, 1144, 1174, 1180, 1216, 23, 71, 144, 145, 173, 814,
+    820, 821, 850, 856, 857, 886, 892, 893, 922, 928, 929, 958,
+    964, 965, 994, 1000, 1001, 1030, 1036, 1037, 1066, 1072, 1073, 1102,
+    1108, 1109, 1138, 1144, 1145, 1174, 1180, 1181, 1210, 1216, 1217, 130,
+    857, 892, 893, 928, 929, 936, 964, 965, 972, 1000, 1001, 1008,
+    1036, 1037, 1072, 1073, 1108, 1109, 1144, 1145, 1180, 1181, 1216, 1217,
+    965, 1001, 1036, 1037, 1072, 1073, 1108, 1109, 1145, 1181, 61, 70,
+    72, 122, 749, 784, 785, 786, 787, 792, 793, 794, 795, 820,
+    821, 822, 827, 828, 829, 830, 831, 856, 857, 863, 864, 865,
+    866, 892, 899, 900, 928, 935, 70, 72, 748, 749, 784, 785,
+    786, 787, 792, 793, 794, 795, 820, 821, 822, 827, 828, 829,
+    830, 831, 856, 857, 863, 864, 865, 866, 892, 893, 898, 899,
+    900, 901, 928, 929, 934, 935, 936, 937, 964, 970, 971, 972,
+    1000, 1007, 1036, 1043, 1072, 23, 61, 65, 72, 121, 145, 146,
+    676, 712, 713, 748, 749, 754, 755, 784, 785, 786, 790, 791,
+    792, 793, 794, 820, 821, 826, 827, 828, 829, 830, 856, 857,
+    862, 863, 864, 892, 898, 899, 928, 934, 935, 970, 1006, 44,
+    57, 65, 72, 121, 146, 147, 682, 718, 748, 754, 755, 784,
+    785, 790, 791, 792, 793, 794, 820, 826, 827, 828, 829, 862,
+    863, 864, 898, 899, 900, 934, 935, 936, 970, 971, 1006, 1007,
+    1042, 1078, 1114, 1150, 1186, 1222, 0, 3, 61, 63, 102, 109,
+    647, 683, 684, 685, 718, 719, 720, 721, 722, 723, 755, 756,
+    757, 758, 759, 791, 792, 793, 794, 795, 0, 3, 44, 45,
+    57, 61, 63, 89, 102, 109, 135, 136, 148, 610, 646, 647,
+    682, 683, 684, 685, 718, 719, 720, 721, 722, 754, 755, 756,
+    757, 758, 759, 790, 791, 792, 793, 794, 795, 826, 827, 828,
+    862, 0, 44, 45, 57, 61, 65, 72, 147, 148, 646, 682,
+    683, 718, 719, 720, 754, 755, 756, 757, 790, 791, 792, 793,
+    794, 795, 826, 827, 828, 829, 862, 863, 864, 898, 899, 934,
+    970, 1006, 1042, 1078, 1114, 0, 3, 44, 45, 57, 58, 89,
+    125, 135, 136, 148, 682, 718, 719, 754, 755, 756, 790, 791,
+    792, 793, 794, 826, 827, 828, 829, 862, 863, 898, 934, 970,
+    1006, 1042, 1078, 1114, 1150, 1186, 72, 130, 790, 826, 827, 828,
+    829, 862, 863, 864, 898, 899, 900, 934, 935, 936, 970, 971,
+    972, 1006, 1007, 1042, 1043, 1078, 1079, 1114, 1115, 1150, 1151, 1186,
+    1187, 130, 863, 864, 898, 899, 900, 934, 935, 936, 970, 971,
+    972, 1006, 1007, 1008, 1042, 1043, 1044, 1072, 1078, 1079, 1080, 1114,
+    1115, 1116, 1150, 1151, 1152, 1186, 1187, 1188, 1222, 1223, 108, 130,
+    893, 900, 901, 902, 929, 936, 937, 938, 965, 972, 973, 974,
+    1000, 1001, 1007, 1008, 1009, 1010, 1036, 1037, 1043, 1044, 1045, 1046,
+    1072, 1073, 1079, 1080, 1081, 1109, 1116, 1117, 1118, 1145, 1152, 1153,
+    1154, 57, 58, 130, 179, 826, 827, 828, 829, 862, 863, 864,
+    865, 898, 899, 900, 934, 935, 936, 970, 971, 972, 1006, 1007,
+    1008, 1042, 1043, 1044, 1078, 1079, 1080, 1114, 1115, 1116, 1150, 1151,
+    1152, 1186, 1187, 1188, 1222, 1223, 1224, 0, 45, 57, 58, 125,
+    136, 148, 826, 827, 862, 898, 934, 970, 1006, 1042, 1078, 1114,
+    45, 57, 58, 90, 107, 130, 179, 180, 863, 864, 898, 899,
+    900, 934, 935, 936, 970, 971, 972, 1006, 1007, 1008, 1009, 1042,
+    1043, 1044, 1045, 1078, 1079, 1080, 1081, 1114, 1115, 1116, 1117, 1150,
+    1151, 1152, 1153, 1186, 1187, 1188, 1189, 1222, 1223, 1224, 1225, 107,
+    130, 972, 1007, 1008, 1009, 1043, 1044, 1045, 1079, 1080, 1081, 1115,
+    1116, 1117, 1151, 1152, 1153, 1187, 1188, 1189, 1190, 1224, 33, 111,
+    123, 846, 852, 881, 882, 887, 888, 917, 918, 923, 924, 948,
+    953, 954, 959, 960, 984, 985, 989, 990, 995, 996, 1020, 1021,
+    1025, 1026, 33, 82, 111, 123, 846, 852, 881, 882, 887, 888,
+    895, 917, 918, 923, 924, 931, 953, 954, 959, 960, 967, 989,
+    990, 995, 996, 1025, 1026, 1031, 1032, 1061, 1062, 1067, 835, 836,
+    837, 840, 841, 870, 871, 872, 875, 876, 906, 907, 908, 911,
+    912, 942, 943, 944, 945, 947, 948, 978, 979, 980, 981, 983,
+    984, 1014, 1015, 1016, 1017, 1019, 1020, 1050, 1051, 1052, 1053, 1088,
+    840, 876, 911, 912, 917, 943, 947, 948, 978, 979, 980, 983,
+    984, 1014, 1015, 1016, 1017, 1019, 1020, 1051, 1052, 1055, 1056, 906,
+    907, 942, 943, 947, 948, 978, 979, 980, 983, 984, 1014, 1015,
+    1016, 1017, 1019, 1020, 1050, 1051, 1052, 1055, 1086, 1087, 1088, 1089,
+    840, 875, 907, 911, 912, 942, 943, 947, 948, 978, 979, 980,
+    983, 984, 1014, 1015, 1016, 1017, 1019, 1020, 1050, 1051, 1052, 1053,
+    1055, 1056, 1086, 1087, 1088, 1089, 1091, 1092, 1128, 108, 858, 893,
+    894, 922, 923, 929, 930, 938, 958, 959, 965, 966, 974, 994,
+    995, 1001, 1002, 1030, 1031, 1037, 1038, 1066, 1067, 1073, 1074, 1102,
+    1103, 1109, 1110, 1138, 1139, 1145, 1146, 1147, 108, 893, 894, 902,
+    929, 930, 937, 938, 939, 965, 966, 973, 974, 975, 994, 995,
+    1001, 1002, 1009, 1010, 1011, 1030, 1031, 1037, 1038, 1045, 1046, 1047,
+    1066, 1067, 1073, 1074, 1081, 1082, 1102, 1103, 1109, 1110, 1118, 1119,
+    1139, 1145, 1146, 108, 893, 922, 929, 958, 965, 966, 994, 995,
+    1001, 1002, 1030, 1031, 1036, 1037, 1038, 1066, 1067, 1072, 1073, 1074,
+    1102, 1103, 1109, 1110, 1138, 1139, 1145, 1146, 1147, 1174, 1175, 1181,
+    1182, 1183, 108, 929, 965, 1001, 1030, 1037, 1038, 1066, 1073, 1074,
+    1102, 1103, 1109, 1110, 1139, 1145, 1146, 1181, 1182, 108, 113, 922,
+    929, 958, 965, 994, 1001, 1030, 1036, 1037, 1066, 1067, 1072, 1073,
+    1102, 1103, 1108, 1109, 1110, 1138, 1139, 1144, 1145, 1146, 1147, 1174,
+    1175, 1181, 1182, 1183, 1210, 1211, 1217, 1218, 108, 965, 994, 1001,
+    1030, 1036, 1037, 1066, 1072, 1073, 1102, 1103, 1108, 1109, 1110, 1138,
+    1139, 1144, 1145, 1146, 1153, 1154, 1155, 1174, 1175, 1181, 1182, 1183,
+    1190, 1191, 1217, 1218, 108, 965, 973, 1001, 1009, 1010, 1037, 1038,
+    1044, 1045, 1046, 1073, 1074, 1080, 1081, 1082, 1109, 1110, 1116, 1117,
+    1118, 1119, 1145, 1146, 1153, 1154, 1155, 1182, 108, 130, 937, 965,
+    972, 973, 974, 1001, 1008, 1009, 1010, 1037, 1044, 1045, 1046, 1073,
+    1074, 1080, 1081, 1082, 1109, 1110, 1116, 1117, 1118, 1119, 1145, 1146,
+    1152, 1153, 1154, 1155, 1189, 1190, 1191, 108, 130, 965, 1001, 1008,
+    1009, 1037, 1044, 1045, 1072, 1073, 1080, 1081, 1108, 1109, 1110, 1116,
+    1117, 1118, 1119, 1145, 1146, 1152, 1153, 1154, 1155, 1181, 1182, 1183,
+    1188, 1189, 1190, 1191, 1217, 1218, 1225, 1226, 1227, 107, 108, 130,
+    1001, 1008, 1009, 1037, 1044, 1045, 1073, 1080, 1081, 1109, 1110, 1116,
+    1117, 1118, 1119, 1145, 1146, 1152, 1153, 1154, 1155, 1181, 1182, 1188,
+    1189, 1190, 1191, 1225, 1226, 1227, 6, 139, 140, 400, 436, 472,
+    508, 544, 580, 616, 617, 652, 653, 688, 689, 724, 725, 726,
+    760, 761, 762, 796, 797, 832, 868, 6, 139, 140, 185, 221,
+    257, 292, 328, 364, 400, 436, 472, 508, 544, 545, 580, 581,
+    616, 617, 618, 652, 653, 654, 688, 689, 690, 691, 724, 725,
+    726, 727, 728, 760, 761, 762, 763, 796, 797, 832, 868, 904,
+    940, 6, 139, 140, 149, 185, 221, 222, 257, 258, 292, 293,
+    328, 364, 365, 400, 401, 436, 437, 472, 473, 508, 509, 544,
+    545, 580, 581, 616, 617, 618, 652, 653, 654, 688, 689, 690,
+    724, 725, 726, 760, 761, 796, 797, 832, 868, 904, 940, 1156,
+    1192, 6, 139, 140, 185, 221, 257, 258, 292, 293, 328, 329,
+    364, 365, 400, 401, 436, 437, 472, 473, 508, 509, 544, 545,
+    580, 581, 582, 616, 617, 618, 652, 653, 654, 688, 689, 690,
+    724, 725, 726, 760, 761, 796, 832, 868, 6, 139, 149, 185,
+    221, 724, 760, 761, 796, 797, 832, 833, 868, 904, 940, 976,
+    1120, 1156, 1192, 6, 139, 140, 149, 185, 221, 222, 257, 292,
+    328, 364, 400, 436, 472, 508, 544, 580, 581, 616, 617, 652,
+    653, 688, 689, 724, 725, 726, 727, 760, 761, 762, 763, 796,
+    797, 798, 832, 833, 868, 904, 940, 976, 1012, 1048, 1084, 1120,
+    1156, 1192, 6, 139, 149, 185, 221, 257, 760, 796, 832, 1192,
+    6, 139, 140, 149, 185, 186, 221, 222, 257, 258, 292, 293,
+    328, 364, 400, 401, 436, 437, 472, 508, 544, 545, 580, 581,
+    616, 617, 652, 653, 688, 689, 724, 725, 726, 760, 761, 796,
+    797, 832, 868, 904, 940, 976, 1012, 1048, 1084, 1120, 1156, 1192,
+    139, 140, 292, 328, 364, 400, 436, 472, 508, 544, 580, 581,
+    616, 617, 618, 652, 653, 654, 655, 688, 689, 690, 691, 692,
+    724, 725, 726, 727, 728, 729, 760, 761, 762, 796, 797, 832,
+    34, 140, 141, 400, 436, 472, 508, 544, 580, 581, 616, 617,
+    618, 622, 652, 653, 654, 655, 658, 688, 689, 690, 691, 692,
+    693, 694, 724, 725, 726, 727, 728, 729, 730, 760, 761, 762,
+    766, 802, 139, 140, 257, 292, 293, 328, 364, 365, 400, 401,
+    436, 437, 472, 473, 508, 509, 544, 545, 580, 581, 582, 616,
+    617, 618, 652, 653, 654, 655, 688, 689, 690, 691, 724, 725,
+    726, 760, 761, 796, 34, 140, 141, 257, 292, 328, 364, 365,
+    400, 401, 436, 437, 472, 473, 478, 508, 509, 514, 544, 545,
+    550, 580, 581, 582, 586, 616, 617, 618, 622, 652, 653, 654,
+    655, 658, 688, 689, 690, 691, 692, 694, 724, 725, 726, 730,
+    760, 139, 140, 149, 185, 221, 257, 292, 400, 436, 472, 508,
+    544, 580, 616, 617, 652, 653, 688, 689, 690, 724, 725, 726,
+    727, 760, 761, 762, 796, 797, 832, 868, 904, 940, 976, 1012,
+    1120, 1156, 1192, 139, 140, 149, 185, 221, 222, 257, 258, 292,
+    293, 328, 329, 364, 365, 400, 401, 436, 437, 472, 508, 544,
+    545, 580, 581, 616, 617, 652, 653, 688, 689, 690, 724, 725,
+    726, 760, 761, 796, 832, 868, 904, 940, 976, 1084, 1120, 1156,
+    1192, 6, 139, 140, 185, 221, 222, 257, 258, 259, 292, 293,
+    294, 328, 329, 364, 365, 366, 400, 401, 402, 436, 437, 438,
+    472, 473, 474, 508, 509, 544, 545, 546, 580, 581, 582, 616,
+    617, 618, 619, 652, 653, 654, 655, 688, 689, 724, 725, 760,
+    6, 139, 140, 149, 150, 185, 186, 221, 222, 223, 257, 258,
+    259, 292, 293, 294, 328, 329, 364, 365, 400, 401, 436, 437,
+    472, 473, 508, 509, 544, 545, 580, 581, 616, 617, 652, 653,
+    688, 689, 724, 760, 796, 1120, 1156, 1192, 140, 257, 258, 292,
+    293, 294, 328, 329, 364, 365, 400, 401, 402, 436, 437, 438,
+    472, 473, 508, 509, 544, 545, 546, 580, 581, 582, 616, 617,
+    618, 619, 652, 653, 654, 655, 688, 689, 140, 149, 185, 221,
+    222, 257, 258, 259, 292, 293, 294, 328, 329, 364, 365, 400,
+    401, 436, 437, 472, 473, 508, 544, 545, 580, 581, 616, 617,
+    652, 653, 688, 34, 550, 586, 617, 618, 619, 622, 623, 653,
+    654, 655, 656, 657, 658, 659, 689, 690, 691, 692, 693, 694,
+    695, 696, 727, 728, 729, 731, 732, 34, 550, 586, 622, 623,
+    655, 656, 657, 658, 659, 660, 691, 692, 693, 694, 695, 696,
+    697, 731, 732, 34, 370, 401, 406, 437, 442, 472, 473, 478,
+    508, 509, 514, 544, 545, 546, 550, 551, 580, 581, 582, 583,
+    586, 587, 617, 618, 619, 620, 621, 622, 623, 653, 654, 655,
+    656, 657, 658, 659, 660, 689, 690, 691, 692, 693, 694, 695,
+    696, 730, 731, 34, 442, 478, 514, 550, 586, 587, 622, 623,
+    656, 657, 658, 659, 660, 692, 693, 694, 695, 696, 34, 129,
+    550, 586, 592, 622, 623, 628, 658, 659, 660, 664, 665, 693,
+    694, 695, 696, 697, 698, 700, 701, 731, 732, 733, 736, 737,
+    12, 21, 129, 556, 592, 623, 628, 629, 659, 660, 661, 664,
+    665, 695, 696, 697, 698, 699, 700, 701, 702, 736, 737, 772,
+    474, 509, 510, 514, 515, 546, 547, 551, 582, 583, 584, 587,
+    618, 619, 620, 621, 623, 624, 654, 655, 656, 657, 659, 479,
+    515, 551, 584, 587, 588, 620, 621, 623, 624, 656, 657, 659,
+    660, 661, 370, 406, 442, 443, 478, 479, 514, 515, 520, 550,
+    551, 556, 586, 587, 592, 619, 620, 622, 623, 624, 656, 657,
+    658, 659, 660, 334, 335, 366, 370, 371, 402, 403, 406, 407,
+    438, 439, 442, 443, 448, 474, 478, 479, 484, 514, 515, 520,
+    547, 550, 551, 556, 583, 584, 586, 587, 619, 620, 621, 623,
+    624, 443, 448, 479, 484, 515, 520, 551, 556, 587, 588, 592,
+    593, 623, 624, 625, 628, 629, 657, 659, 660, 661, 662, 665,
+    412, 448, 484, 520, 551, 556, 557, 587, 588, 592, 593, 623,
+    624, 625, 628, 629, 660, 661, 662, 664, 665, 666, 371, 407,
+    412, 443, 448, 479, 484, 514, 515, 520, 551, 552, 556, 557,
+    587, 588, 592, 593, 621, 623, 624, 625, 629, 661, 27, 407,
+    412, 413, 443, 448, 449, 479, 484, 485, 515, 520, 521, 526,
+    551, 552, 556, 557, 562, 587, 588, 592, 593, 623, 624, 625,
+    628, 629, 661, 662, 665, 34, 141, 142, 298, 334, 370, 406,
+    442, 478, 514, 550, 586, 622, 623, 658, 659, 694, 695, 730,
+    766, 34, 39, 141, 142, 143, 155, 191, 197, 227, 233, 263,
+    269, 298, 334, 370, 406, 442, 478, 514, 550, 586, 622, 658,
+    659, 694, 695, 730, 731, 736, 766, 802, 263, 264, 269, 298,
+    299, 304, 329, 330, 331, 334, 335, 340, 366, 367, 370, 371,
+    376, 402, 403, 406, 407, 412, 438, 442, 443, 448, 478, 479,
+    484, 514, 515, 520, 550, 551, 556, 586, 587, 592, 622, 623,
+    140, 141, 142, 155, 191, 227, 228, 257, 258, 259, 263, 264,
+    292, 293, 294, 298, 299, 328, 329, 334, 364, 365, 366, 370,
+    400, 401, 406, 436, 437, 442, 472, 473, 478, 508, 514, 544,
+    545, 550, 580, 581, 586, 616, 617, 622, 653, 658, 694, 141,
+    142, 191, 227, 233, 263, 264, 269, 298, 299, 334, 370, 406,
+    442, 478, 514, 550, 586, 622, 658, 227, 228, 233, 263, 264,
+    269, 298, 299, 304, 330, 334, 335, 370, 371, 406, 407, 442,
+    478, 514, 550, 586, 34, 39, 142, 143, 233, 263, 264, 269,
+    298, 299, 304, 334, 335, 340, 370, 371, 376, 406, 407, 412,
+    442, 443, 448, 478, 479, 484, 514, 520, 550, 551, 556, 586,
+    587, 592, 622, 623, 628, 658, 659, 660, 664, 694, 695, 700,
+    730, 736, 39, 48, 143, 269, 304, 340, 376, 412, 448, 484,
+    520, 556, 592, 628, 664, 700, 39, 48, 141, 142, 143, 161,
+    191, 197, 227, 228, 233, 263, 264, 269, 298, 299, 304, 334,
+    335, 340, 370, 371, 376, 406, 407, 412, 442, 448, 478, 484,
+    514, 520, 550, 556, 586, 592, 622, 623, 628, 658, 659, 664,
+    694, 700, 736, 39, 48, 143, 197, 233, 239, 269, 275, 304,
+    340, 376, 412, 448, 484, 556, 592, 628, 664, 27, 371, 372,
+    377, 407, 408, 412, 413, 443, 444, 448, 449, 479, 480, 484,
+    485, 515, 516, 520, 521, 551, 552, 556, 557, 587, 588, 589,
+    593, 624, 625, 629, 27, 372, 377, 407, 408, 412, 413, 443,
+    444, 448, 449, 479, 480, 484, 485, 515, 516, 520, 521, 526,
+    551, 552, 556, 557, 588, 589, 593, 624, 625, 629, 12, 21,
+    129, 484, 520, 526, 556, 562, 592, 593, 598, 628, 629, 634,
+    635, 661, 662, 663, 664, 665, 666, 670, 698, 699, 701, 702,
+    12, 21, 69, 129, 454, 490, 526, 556, 562, 592, 593, 598,
+    599, 628, 629, 630, 634, 635, 662, 663, 664, 665, 666, 667,
+    670, 671, 672, 698, 699, 701, 702, 703, 706, 707, 742, 12,
+    69, 598, 634, 635, 641, 666, 670, 671, 672, 677, 702, 703,
+    704, 706, 707, 708, 713, 743, 12, 35, 61, 69, 79, 86,
+    109, 532, 568, 598, 604, 605, 634, 635, 640, 641, 642, 670,
+    671, 672, 676, 677, 678, 679, 702, 703, 704, 705, 706, 707,
+    708, 709, 712, 713, 714, 715, 743, 749, 750, 751, 412, 448,
+    454, 484, 490, 520, 526, 556, 557, 562, 592, 593, 598, 599,
+    625, 628, 629, 630, 634, 635, 661, 662, 663, 664, 665, 666,
+    32, 382, 412, 418, 448, 454, 484, 490, 520, 526, 556, 557,
+    562, 563, 592, 593, 598, 599, 628, 629, 630, 634, 635, 662,
+    663, 665, 666, 667, 670, 671, 672, 706, 118, 376, 412, 413,
+    418, 448, 449, 454, 484, 485, 490, 520, 521, 526, 556, 557,
+    562, 563, 588, 592, 593, 598, 599, 624, 625, 626, 628, 629,
+    630, 634, 635, 662, 663, 665, 666, 32, 118, 382, 413, 418,
+    448, 449, 454, 455, 484, 485, 490, 491, 520, 521, 526, 527,
+    556, 557, 562, 563, 593, 598, 599, 629, 630, 634, 635, 666,
+    32, 79, 526, 533, 562, 563, 569, 599, 605, 606, 630, 631,
+    635, 636, 642, 666, 667, 668, 671, 672, 673, 32, 79, 497,
+    533, 563, 569, 570, 599, 605, 606, 635, 636, 641, 642, 643,
+    667, 668, 671, 672, 673, 678, 679, 32, 418, 454, 490, 496,
+    497, 526, 532, 533, 562, 563, 568, 569, 598, 599, 604, 605,
+    634, 635, 641, 666, 670, 671, 672, 32, 79, 418, 424, 425,
+    454, 460, 461, 490, 496, 497, 526, 532, 533, 562, 563, 568,
+    569, 570, 598, 599, 604, 605, 606, 634, 635, 640, 641, 642,
+    670, 671, 672, 677, 678, 679, 713, 12, 21, 39, 48, 71,
+    124, 129, 143, 144, 556, 562, 592, 598, 628, 629, 634, 660,
+    664, 665, 670, 671, 696, 697, 698, 699, 700, 701, 702, 706,
+    707, 736, 737, 738, 742, 743, 772, 778, 814, 12, 71, 124,
+    144, 598, 634, 664, 665, 670, 671, 700, 701, 702, 706, 707,
+    742, 743, 778, 12, 39, 48, 143, 144, 304, 340, 376, 412,
+    418, 448, 454, 484, 490, 520, 526, 556, 562, 592, 593, 598,
+    628, 629, 634, 664, 665, 670, 671, 697, 698, 700, 701, 702,
+    706, 736, 742, 778, 12, 526, 562, 598, 634, 665, 670, 671,
+    706, 742, 12, 39, 48, 71, 124, 143, 144, 203, 239, 592,
+    598, 628, 634, 664, 670, 700, 701, 706, 736, 737, 742, 743,
+    772, 778, 808, 814, 850, 12, 23, 48, 71, 124, 144, 145,
+    598, 634, 664, 670, 700, 706, 742, 743, 748, 778, 784, 814,
+    820, 850, 856, 892, 928, 39, 48, 71, 124, 143, 144, 203,
+    233, 239, 269, 275, 304, 310, 340, 376, 412, 418, 448, 454,
+    484, 490, 520, 556, 562, 592, 598, 628, 634, 664, 670, 700,
+    701, 706, 736, 742, 772, 778, 814, 12, 23, 39, 48, 71,
+    124, 143, 144, 145, 173, 203, 209, 239, 245, 275, 281, 310,
+    316, 346, 382, 418, 454, 490, 496, 526, 532, 562, 568, 592,
+    598, 604, 628, 634, 640, 664, 670, 676, 700, 706, 712, 742,
+    748, 778, 784, 814, 820, 856, 1216, 12, 23, 144, 145, 496,
+    532, 562, 568, 598, 604, 634, 640, 641, 670, 671, 676, 677,
+    702, 706, 707, 712, 713, 742, 743, 748, 749, 750, 778, 784,
+    785, 820, 12, 23, 61, 109, 121, 145, 146, 460, 496, 532,
+    568, 598, 604, 605, 634, 640, 641, 670, 671, 676, 677, 678,
+    706, 707, 712, 713, 714, 742, 743, 748, 749, 750, 784, 785,
+    820, 12, 388, 424, 454, 460, 490, 496, 526, 532, 562, 568,
+    598, 604, 605, 634, 635, 640, 641, 670, 671, 676, 677, 706,
+    707, 712, 713, 742, 748, 784, 12, 23, 121, 145, 146, 281,
+    316, 352, 388, 424, 460, 496, 532, 538, 562, 568, 569, 574,
+    598, 604, 605, 634, 635, 640, 641, 642, 670, 671, 676, 677,
+    678, 706, 707, 712, 713, 714, 742, 748, 749, 784, 23, 121,
+    145, 146, 209, 245, 568, 604, 640, 676, 677, 706, 712, 713,
+    748, 749, 784, 785, 820, 856, 892, 928, 48, 144, 269, 275,
+    304, 310, 340, 346, 376, 382, 412, 418, 448, 454, 484, 490,
+    520, 526, 556, 562, 592, 593, 598, 628, 629, 634, 664, 665,
+    670, 700, 701, 706, 310, 346, 376, 382, 412, 418, 454, 490,
+    526, 562, 598, 629, 634, 635, 665, 670, 671, 23, 39, 48,
+    143, 144, 167, 197, 203, 233, 239, 269, 270, 275, 304, 310,
+    340, 346, 376, 382, 412, 418, 448, 454, 484, 490, 520, 526,
+    556, 562, 592, 598, 628, 634, 664, 670, 700, 706, 736, 742,
+    23, 48, 144, 145, 173, 203, 209, 239, 245, 246, 269, 275,
+    281, 282, 304, 310, 316, 340, 346, 376, 382, 388, 412, 418,
+    424, 448, 454, 460, 484, 490, 496, 520, 526, 532, 556, 562,
+    568, 592, 598, 604, 628, 634, 640, 664, 670, 706, 742, 233,
+    239, 269, 270, 275, 276, 304, 305, 310, 340, 346, 376, 382,
+    412, 418, 448, 454, 484, 490, 520, 526, 556, 562, 592, 598,
+    239, 275, 276, 310, 340, 346, 376, 382, 412, 418, 454, 490,
+    526, 562, 598, 23, 32, 145, 275, 281, 310, 316, 346, 352,
+    382, 388, 418, 424, 454, 460, 461, 490, 496, 497, 526, 532,
+    533, 562, 568, 569, 598, 604, 605, 634, 635, 640, 641, 670,
+    671, 676, 677, 706, 712, 32, 316, 346, 352, 382, 388, 389,
+    418, 424, 425, 454, 460, 461, 490, 496, 497, 526, 532, 533,
+    562, 568, 569, 598, 604, 605, 634, 635, 640, 641, 671, 676,
+    677, 712, 32, 310, 346, 352, 382, 388, 389, 418, 424, 425,
+    454, 460, 461, 490, 496, 497, 526, 532, 533, 562, 568, 569,
+    598, 604, 605, 634, 32, 281, 282, 310, 316, 317, 346, 352,
+    353, 382, 388, 389, 418, 424, 425, 431, 454, 460, 461, 467,
+    490, 496, 497, 503, 526, 532, 533, 539, 540, 562, 568, 569,
+    575, 598, 599, 604, 605, 634, 635, 640, 641, 642, 676, 23,
+    121, 145, 146, 173, 209, 245, 246, 275, 281, 282, 310, 316,
+    317, 346, 352, 382, 388, 389, 418, 424, 425, 454, 460, 496,
+    532, 568, 604, 634, 640, 641, 676, 677, 712, 128, 239, 245,
+    246, 275, 276, 281, 282, 310, 316, 317, 346, 352, 382, 388,
+    418, 424, 454, 460, 490, 496, 526, 532, 562, 568, 598, 128,
+    209, 245, 246, 253, 275, 276, 281, 282, 283, 310, 316, 317,
+    346, 352, 353, 382, 388, 389, 418, 424, 425, 454, 460, 461,
+    490, 496, 497, 532, 562, 568, 604, 605, 640, 32, 79, 425,
+    460, 461, 468, 496, 497, 504, 532, 533, 539, 540, 568, 569,
+    575, 576, 577, 599, 604, 605, 606, 612, 613, 614, 635, 641,
+    642, 643, 648, 649, 672, 677, 678, 679, 32, 79, 425, 432,
+    461, 467, 468, 469, 496, 497, 503, 504, 505, 532, 533, 539,
+    540, 541, 568, 569, 570, 575, 576, 577, 578, 604, 605, 606,
+    611, 612, 613, 614, 615, 641, 642, 643, 647, 648, 649, 650,
+    651, 677, 678, 679, 684, 685, 686, 687, 32, 425, 461, 497,
+    504, 532, 533, 540, 541, 569, 570, 576, 577, 605, 606, 641,
+    642, 32, 389, 396, 397, 425, 432, 433, 461, 467, 468, 469,
+    470, 497, 503, 504, 505, 506, 532, 533, 539, 540, 541, 542,
+    569, 570, 575, 576, 577, 578, 605, 606, 612, 613, 614, 615,
+    641, 642, 643, 648, 649, 650, 651, 61, 102, 109, 502, 538,
+    568, 574, 604, 610, 611, 640, 641, 646, 647, 648, 676, 677,
+    678, 682, 683, 684, 712, 713, 714, 718, 719, 720, 748, 749,
+    750, 754, 755, 756, 757, 784, 785, 791, 792, 0, 3, 51,
+    61, 63, 89, 102, 109, 430, 466, 502, 538, 574, 575, 610,
+    611, 612, 646, 647, 648, 649, 682, 683, 684, 685, 686, 687,
+    714, 718, 719, 720, 721, 722, 723, 754, 755, 756, 757, 758,
+    759, 790, 791, 792, 793, 0, 3, 51, 55, 63, 89, 102,
+    109, 135, 136, 148, 466, 502, 538, 574, 575, 610, 611, 612,
+    646, 647, 648, 649, 650, 682, 683, 684, 685, 686, 687, 718,
+    719, 720, 721, 722, 723, 754, 755, 756, 757, 758, 759, 3,
+    4, 51, 63, 89, 102, 109, 358, 359, 394, 395, 430, 431,
+    466, 467, 502, 503, 538, 539, 574, 575, 576, 610, 611, 612,
+    613, 646, 647, 648, 649, 650, 682, 683, 684, 685, 686, 718,
+    719, 720, 721, 722, 754, 755, 756, 0, 3, 42, 44, 45,
+    51, 55, 57, 58, 63, 76, 89, 119, 125, 135, 136, 148,
+    647, 683, 684, 719, 720, 756, 757, 0, 1, 3, 4, 17,
+    42, 44, 45, 51, 55, 58, 63, 76, 89, 94, 119, 125,
+    135, 136, 148, 323, 358, 359, 394, 395, 430, 431, 467, 503,
+    575, 611, 647, 648, 683, 684, 719, 720, 32, 316, 317, 323,
+    352, 353, 359, 360, 388, 389, 395, 396, 424, 425, 431, 432,
+    460, 461, 466, 467, 468, 469, 496, 497, 502, 503, 504, 505,
+    532, 533, 538, 539, 540, 568, 569, 575, 576, 577, 604, 605,
+    611, 612, 613, 641, 4, 60, 64, 73, 324, 325, 359, 360,
+    361, 395, 396, 397, 431, 432, 433, 467, 468, 469, 503, 504,
+    505, 539, 540, 575, 576, 577, 612, 613, 1, 4, 17, 51,
+    55, 60, 64, 73, 94, 104, 323, 324, 325, 326, 359, 360,
+    361, 395, 396, 397, 431, 432, 433, 434, 467, 468, 469, 470,
+    503, 504, 505, 539, 540, 541, 575, 576, 577, 611, 612, 613,
+    614, 648, 649, 650, 1, 4, 5, 7, 17, 42, 51, 55,
+    60, 64, 73, 76, 94, 104, 134, 289, 290, 323, 324, 325,
+    359, 360, 361, 395, 396, 397, 431, 432, 467, 468, 27, 118,
+    376, 377, 412, 413, 418, 448, 449, 454, 455, 484, 485, 490,
+    491, 520, 521, 526, 527, 556, 557, 562, 563, 588, 593, 599,
+    625, 626, 629, 630, 27, 32, 118, 341, 346, 347, 376, 377,
+    382, 383, 412, 413, 418, 419, 448, 449, 454, 455, 461, 484,
+    485, 490, 491, 497, 520, 521, 526, 527, 533, 556, 557, 562,
+    563, 569, 593, 594, 598, 599, 626, 629, 630, 635, 27, 43,
+    96, 118, 373, 378, 408, 409, 410, 413, 414, 419, 444, 445,
+    446, 449, 450, 455, 480, 481, 482, 485, 486, 491, 516, 517,
+    521, 522, 527, 553, 554, 557, 558, 563, 589, 590, 591, 594,
+    627, 43, 83, 96, 118, 377, 378, 383, 409, 410, 413, 414,
+    419, 445, 446, 449, 450, 455, 456, 485, 486, 491, 492, 521,
+    522, 527, 554, 557, 558, 563, 564, 590, 591, 594, 595, 600,
+    627, 27, 275, 304, 305, 310, 311, 335, 336, 340, 341, 346,
+    371, 372, 376, 377, 382, 408, 412, 413, 418, 419, 448, 449,
+    454, 455, 484, 485, 490, 520, 526, 556, 557, 562, 592, 593,
+    598, 629, 32, 275, 305, 310, 311, 340, 341, 346, 347, 376,
+    377, 382, 383, 412, 413, 418, 419, 448, 449, 454, 455, 484,
+    485, 490, 520, 526, 562, 593, 598, 599, 27, 233, 239, 240,
+    269, 270, 275, 276, 304, 305, 310, 311, 335, 340, 341, 346,
+    376, 377, 382, 412, 413, 418, 448, 454, 484, 490, 520, 526,
+    556, 562, 239, 270, 275, 276, 304, 305, 310, 311, 340, 341,
+    346, 376, 377, 382, 383, 412, 418, 448, 454, 490, 526, 562,
+    32, 275, 282, 310, 311, 317, 341, 346, 347, 352, 353, 377,
+    382, 383, 388, 389, 413, 418, 419, 424, 425, 449, 454, 455,
+    460, 461, 490, 491, 496, 497, 526, 532, 533, 562, 569, 598,
+    599, 605, 32, 310, 311, 317, 318, 346, 347, 352, 353, 382,
+    383, 388, 389, 390, 418, 419, 424, 425, 426, 454, 455, 460,
+    461, 462, 490, 496, 497, 526, 532, 533, 562, 569, 605, 128,
+    246, 275, 276, 282, 283, 310, 311, 316, 317, 346, 347, 352,
+    353, 382, 383, 388, 389, 418, 424, 425, 454, 460, 490, 526,
+    11, 128, 246, 247, 275, 276, 281, 282, 283, 310, 311, 316,
+    317, 318, 346, 347, 352, 353, 382, 383, 388, 389, 418, 424,
+    425, 454, 460, 461, 490, 496, 497, 532, 32, 389, 390, 419,
+    425, 426, 455, 461, 462, 468, 469, 491, 497, 498, 504, 505,
+    533, 534, 540, 541, 569, 570, 577, 605, 606, 32, 389, 390,
+    396, 397, 398, 425, 426, 432, 433, 434, 461, 462, 468, 469,
+    470, 471, 497, 498, 504, 505, 506, 507, 533, 534, 540, 541,
+    542, 569, 570, 576, 577, 578, 579, 605, 606, 613, 614, 615,
+    32, 317, 353, 389, 425, 426, 461, 497, 533, 540, 569, 25,
+    32, 100, 311, 317, 318, 319, 325, 326, 347, 353, 354, 360,
+    361, 383, 389, 390, 396, 397, 398, 419, 425, 426, 432, 433,
+    434, 455, 461, 462, 468, 469, 470, 497, 498, 504, 505, 533,
+    540, 541, 569, 25, 60, 64, 100, 134, 317, 318, 325, 326,
+    327, 353, 354, 360, 361, 362, 389, 390, 396, 397, 398, 399,
+    425, 426, 432, 433, 434, 435, 461, 462, 468, 469, 470, 497,
+    504, 505, 506, 533, 540, 541, 577, 11, 128, 134, 282, 283,
+    289, 290, 291, 317, 318, 324, 352, 353, 388, 389, 424, 425,
+    461, 1, 4, 5, 7, 17, 60, 64, 73, 91, 92, 100,
+    104, 105, 134, 289, 290, 291, 324, 325, 326, 327, 359, 360,
+    361, 362, 395, 396, 397, 398, 431, 432, 433, 468, 4, 5,
+    7, 17, 60, 64, 73, 91, 100, 104, 134, 290, 291, 324,
+    325, 326, 360, 361, 396, 397, 432, 433, 6, 139, 140, 149,
+    150, 185, 186, 221, 222, 257, 292, 328, 364, 400, 436, 544,
+    580, 616, 652, 688, 724, 725, 760, 761, 762, 796, 797, 832,
+    833, 868, 869, 904, 905, 940, 941, 976, 1012, 1048, 1084, 1120,
+    1121, 1156, 1157, 1192, 1193, 6, 139, 140, 149, 150, 151, 185,
+    186, 187, 221, 222, 257, 292, 328, 688, 724, 760, 761, 762,
+    796, 797, 798, 832, 833, 868, 869, 904, 905, 940, 941, 976,
+    977, 1012, 1013, 1048, 1049, 1084, 1085, 1120, 1121, 1156, 1157, 1158,
+    1192, 1193, 1194, 6, 139, 149, 150, 185, 186, 221, 222, 257,
+    760, 796, 832, 976, 1084, 1120, 1156, 1157, 1192, 1193, 6, 139,
+    140, 149, 150, 151, 185, 186, 187, 188, 221, 222, 223, 257,
+    258, 292, 760, 796, 832, 868, 904, 940, 976, 1012, 1048, 1084,
+    1085, 1120, 1121, 1156, 1157, 1158, 1192, 1193, 1194, 6, 139, 140,
+    149, 150, 185, 186, 187, 221, 222, 223, 257, 258, 259, 292,
+    293, 328, 329, 364, 365, 400, 436, 472, 508, 544, 580, 616,
+    652, 688, 724, 725, 760, 761, 796, 832, 868, 904, 940, 976,
+    1012, 1048, 1084, 1120, 1121, 1156, 1157, 1192, 1193, 6, 139, 140,
+    149, 150, 151, 185, 186, 187, 188, 221, 222, 223, 224, 257,
+    258, 259, 292, 293, 328, 364, 760, 796, 832, 868, 904, 940,
+    976, 1012, 1048, 1084, 1085, 1120, 1121, 1156, 1157, 1192, 1193, 1194,
+    6, 139, 149, 150, 151, 185, 186, 187, 221, 222, 257, 796,
+    797, 832, 833, 868, 869, 904, 905, 940, 941, 976, 977, 1012,
+    1013, 1048, 1049, 1084, 1085, 1086, 1120, 1121, 1122, 1123, 1156, 1157,
+    1158, 1159, 1192, 1193, 1194, 1195, 149, 150, 151, 152, 186, 187,
+    869, 905, 940, 941, 976, 977, 1012, 1013, 1014, 1048, 1049, 1050,
+    1084, 1085, 1086, 1120, 1121, 1122, 1123, 1156, 1157, 1158, 1159, 1160,
+    1192, 1193, 1194, 1195, 6, 139, 149, 150, 151, 152, 185, 186,
+    187, 188, 221, 222, 223, 224, 257, 868, 904, 940, 976, 1012,
+    1048, 1084, 1085, 1120, 1121, 1122, 1156, 1157, 1158, 1159, 1192, 1193,
+    1194, 1195, 149, 150, 151, 152, 153, 186, 187, 188, 1084, 1085,
+    1120, 1121, 1122, 1156, 1157, 1158, 1159, 1160, 1192, 1193, 1194, 1195,
+    1196, 139, 140, 149, 150, 185, 186, 221, 222, 257, 292, 328,
+    364, 400, 436, 472, 508, 544, 580, 616, 652, 688, 724, 725,
+    726, 760, 761, 762, 796, 797, 832, 833, 868, 904, 905, 940,
+    976, 1012, 1048, 1084, 1120, 1156, 1157, 1192, 1193, 140, 149, 150,
+    185, 186, 221, 257, 760, 796, 797, 832, 833, 868, 904, 940,
+    976, 977, 1012, 1013, 1048, 1084, 1085, 1120, 1121, 1156, 1157, 1192,
+    1193, 139, 140, 149, 150, 185, 186, 221, 222, 223, 257, 258,
+    259, 292, 293, 328, 329, 364, 365, 400, 436, 472, 508, 544,
+    580, 616, 652, 688, 724, 760, 796, 832, 976, 1012, 1048, 1084,
+    1120, 1156, 1192, 1193, 140, 149, 150, 185, 186, 187, 221, 222,
+    223, 257, 258, 259, 292, 293, 1084, 1120, 1156, 1157, 1192, 1193,
+    149, 150, 151, 155, 156, 186, 187, 191, 192, 910, 940, 941,
+    946, 976, 977, 982, 1012, 1013, 1018, 1048, 1049, 1050, 1054, 1084,
+    1085, 1086, 1090, 1091, 1120, 1121, 1122, 1123, 1126, 1127, 1156, 1157,
+    1158, 1159, 1162, 1163, 1192, 1193, 1194, 1195, 1198, 1199, 149, 150,
+    151, 152, 155, 156, 186, 187, 188, 189, 191, 192, 193, 222,
+    223, 224, 228, 1048, 1084, 1085, 1090, 1120, 1121, 1122, 1126, 1127,
+    1156, 1157, 1158, 1159, 1162, 1163, 1192, 1193, 1194, 1195, 1196, 1198,
+    1199, 1200, 140, 141, 142, 155, 191, 221, 227, 257, 263, 292,
+    298, 328, 364, 652, 658, 688, 694, 724, 725, 730, 760, 761,
+    766, 767, 802, 838, 874, 910, 946, 982, 1018, 1054, 1090, 1126,
+    1162, 1198, 140, 141, 142, 155, 191, 227, 263, 766, 802, 838,
+    874, 910, 946, 982, 1018, 1054, 1090, 1126, 1162, 1198, 39, 141,
+    142, 143, 155, 161, 191, 197, 227, 263, 298, 622, 658, 694,
+    730, 731, 766, 767, 772, 802, 808, 838, 844, 874, 910, 946,
+    982, 1018, 1054, 1090, 1126, 1162, 1198, 1204, 39, 141, 142, 143,
+    155, 161, 191, 192, 197, 227, 233, 263, 298, 730, 766, 767,
+    772, 802, 803, 808, 838, 844, 874, 880, 910, 916, 946, 952,
+    982, 988, 1018, 1024, 1054, 1060, 1090, 1096, 1126, 1132, 1162, 1168,
+    1198, 1199, 1204, 39, 48, 124, 141, 142, 143, 155, 161, 191,
+    197, 227, 233, 263, 269, 298, 622, 658, 694, 730, 731, 736,
+    766, 767, 772, 802, 808, 838, 844, 880, 916, 952, 1132, 1162,
+    1168, 1198, 1204, 39, 141, 142, 143, 155, 161, 191, 197, 227,
+    233, 263, 269, 766, 772, 802, 808, 838, 844, 880, 916, 952,
+    982, 988, 1018, 1024, 1054, 1060, 1090, 1096, 1126, 1132, 1162, 1168,
+    1198, 1204, 23, 39, 48, 71, 113, 124, 143, 144, 145, 167,
+    173, 174, 203, 209, 210, 239, 245, 246, 275, 281, 310, 670,
+    706, 742, 748, 778, 784, 814, 820, 856, 892, 928, 964, 1000,
+    1036, 1072, 1102, 1108, 1138, 1144, 1174, 1180, 1181, 1210, 1216, 1217,
+    23, 65, 113, 121, 144, 145, 146, 147, 173, 174, 179, 180,
+    181, 209, 210, 216, 217, 245, 246, 281, 316, 352, 388, 424,
+    676, 712, 748, 784, 820, 856, 1036, 1072, 1108, 1114, 1144, 1150,
+    1151, 1180, 1181, 1186, 1187, 1188, 1216, 1217, 1222, 1223, 1224, 23,
+    113, 130, 144, 145, 167, 173, 174, 203, 209, 210, 245, 856,
+    892, 928, 964, 1000, 1030, 1036, 1066, 1072, 1073, 1102, 1108, 1109,
+    1138, 1144, 1145, 1174, 1180, 1181, 1182, 1210, 1216, 1217, 1218, 113,
+    167, 173, 174, 175, 203, 209, 210, 239, 245, 246, 1000, 1036,
+    1072, 1108, 1138, 1144, 1145, 1174, 1180, 1181, 1210, 1216, 1217, 1218,
+    23, 48, 113, 121, 144, 145, 146, 167, 173, 174, 203, 209,
+    210, 211, 239, 240, 245, 246, 247, 275, 281, 282, 310, 316,
+    317, 346, 352, 382, 388, 418, 424, 460, 496, 604, 640, 676,
+    748, 1108, 1144, 1174, 1180, 1181, 1210, 1216, 1217, 23, 113, 128,
+    144, 145, 167, 173, 174, 203, 204, 209, 210, 211, 239, 240,
+    245, 246, 247, 275, 276, 281, 282, 283, 310, 316, 317, 346,
+    352, 382, 388, 418, 424, 460, 496, 1180, 1216, 1217, 23, 113,
+    121, 145, 146, 173, 174, 179, 180, 181, 209, 210, 216, 217,
+    218, 245, 246, 275, 281, 282, 310, 316, 317, 352, 388, 424,
+    460, 1144, 1180, 1216, 1217, 1223, 1224, 128, 173, 174, 209, 210,
+    217, 218, 245, 246, 247, 281, 282, 310, 316, 317, 346, 352,
+    388, 424, 67, 107, 113, 173, 174, 175, 180, 181, 182, 183,
+    184, 209, 210, 211, 216, 217, 218, 219, 220, 245, 246, 247,
+    281, 282, 1144, 1180, 1181, 1187, 1188, 1189, 1216, 1217, 1218, 1223,
+    1224, 1225, 1226, 67, 107, 113, 128, 173, 174, 175, 180, 181,
+    182, 183, 184, 209, 210, 211, 212, 216, 217, 218, 219, 220,
+    240, 245, 246, 247, 253, 254, 255, 256, 281, 282, 283, 316,
+    1216, 1217, 1218, 1224, 1225, 1226, 113, 174, 1066, 1072, 1073, 1102,
+    1108, 1109, 1138, 1139, 1145, 1146, 1174, 1175, 1181, 1182, 1183, 1190,
+    1191, 1217, 1218, 1219, 1226, 1227, 113, 174, 175, 1145, 1181, 1182,
+    1217, 1218, 1219, 1227, 67, 107, 113, 130, 174, 175, 181, 182,
+    183, 1000, 1036, 1037, 1044, 1072, 1073, 1079, 1080, 1108, 1109, 1115,
+    1116, 1117, 1118, 1144, 1145, 1146, 1152, 1153, 1154, 1155, 1180, 1181,
+    1182, 1183, 1188, 1189, 1190, 1191, 1216, 1217, 1218, 1219, 1224, 1225,
+    1226, 1227, 67, 107, 113, 174, 175, 181, 182, 183, 184, 210,
+    211, 218, 219, 1072, 1108, 1109, 1116, 1144, 1145, 1146, 1152, 1153,
+    1154, 1180, 1181, 1182, 1183, 1188, 1189, 1190, 1191, 1217, 1218, 1219,
+    1224, 1225, 1226, 1227, 57, 58, 67, 90, 107, 130, 179, 180,
+    181, 182, 215, 216, 217, 863, 898, 899, 934, 935, 970, 971,
+    1006, 1007, 1008, 1042, 1043, 1044, 1078, 1079, 1080, 1114, 1115, 1116,
+    1117, 1150, 1151, 1152, 1153, 1186, 1187, 1188, 1189, 1190, 1222, 1223,
+    1224, 1225, 1226, 58, 67, 90, 107, 130, 179, 180, 181, 182,
+    183, 215, 216, 217, 218, 219, 251, 252, 253, 898, 934, 970,
+    1006, 1007, 1042, 1043, 1078, 1079, 1114, 1115, 1116, 1150, 1151, 1152,
+    1153, 1186, 1187, 1188, 1189, 1190, 1222, 1223, 1224, 1225, 1226, 67,
+    90, 107, 173, 174, 179, 180, 181, 182, 183, 184, 209, 210,
+    211, 215, 216, 217, 218, 219, 220, 245, 246, 247, 251, 252,
+    253, 254, 255, 281, 282, 289, 1114, 1144, 1150, 1151, 1180, 1186,
+    1187, 1188, 1189, 1216, 1217, 1222, 1223, 1224, 1225, 1226, 67, 105,
+    107, 128, 173, 174, 180, 181, 182, 183, 184, 209, 210, 211,
+    216, 217, 218, 219, 220, 245, 246, 247, 252, 253, 254, 255,
+    256, 282, 289, 1224, 1225, 1226, 1, 5, 58, 67, 76, 90,
+    105, 107, 179, 180, 181, 182, 183, 184, 215, 216, 217, 218,
+    219, 220, 246, 251, 252, 253, 254, 255, 287, 288, 289, 1042,
+    1078, 1114, 1150, 1151, 1186, 1187, 1188, 1189, 1222, 1223, 1224, 1225,
+    1226, 5, 7, 67, 90, 105, 107, 180, 181, 182, 183, 184,
+    216, 217, 218, 219, 220, 252, 253, 254, 255, 256, 289, 290,
+    291, 1224, 1225, 57, 58, 90, 107, 130, 179, 180, 181, 182,
+    216, 217, 935, 970, 971, 1006, 1007, 1042, 1043, 1044, 1078, 1079,
+    1080, 1114, 1115, 1116, 1150, 1151, 1152, 1153, 1186, 1187, 1188, 1189,
+    1222, 1223, 1224, 1225, 58, 76, 90, 119, 179, 180, 181, 215,
+    216, 217, 252, 253, 1006, 1042, 1078, 1114, 1115, 1150, 1151, 1186,
+    1187, 1188, 1222, 1223, 1224, 58, 90, 107, 179, 180, 181, 182,
+    216, 217, 218, 252, 253, 1006, 1042, 1043, 1078, 1079, 1114, 1115,
+    1150, 1151, 1152, 1186, 1187, 1188, 1189, 1222, 1223, 1224, 1225, 1,
+    4, 7, 17, 42, 55, 58, 73, 76, 89, 90, 94, 104,
+    119, 125, 135, 136, 148, 323, 359, 1, 4, 5, 7, 17,
+    42, 55, 60, 64, 73, 76, 90, 94, 104, 105, 119, 134,
+    216, 217, 218, 251, 252, 253, 254, 255, 256, 287, 288, 289,
+    290, 291, 322, 323, 324, 325, 358, 359, 360, 394, 395, 430,
+    431, 466, 467, 502, 1, 4, 5, 7, 17, 42, 55, 73,
+    76, 94, 104, 289, 290, 323, 324, 359, 11, 92, 105, 128,
+    134, 210, 217, 218, 219, 246, 247, 253, 254, 255, 256, 281,
+    282, 283, 288, 289, 290, 291, 316, 317, 318, 323, 324, 325,
+    352, 353, 359, 388, 389, 424, 1, 5, 7, 11, 91, 92,
+    104, 105, 128, 134, 217, 218, 219, 246, 247, 252, 253, 254,
+    255, 256, 282, 283, 288, 289, 290, 291, 316, 317, 318, 323,
+    324, 325, 326, 352, 353, 359, 360, 388, 389, 395, 396, 431,
+    140, 141, 652, 688, 689, 724, 725, 726, 727, 728, 730, 760,
+    761, 762, 763, 766, 767, 796, 797, 798, 802, 803, 832, 833,
+    838, 868, 874, 904, 910, 940, 976, 1012, 140, 141, 149, 185,
+    652, 688, 689, 724, 725, 726, 727, 730, 760, 761, 762, 763,
+    764, 766, 767, 796, 797, 798, 802, 803, 832, 833, 838, 868,
+    869, 874, 904, 905, 910, 940, 941, 946, 976, 982, 1012, 1018,
+    1048, 1084, 1090, 1120, 1126, 1156, 1162, 1192, 140, 141, 149, 760,
+    761, 762, 796, 797, 798, 802, 803, 832, 833, 838, 868, 869,
+    874, 904, 905, 910, 940, 941, 946, 976, 977, 982, 1012, 1013,
+    1018, 1048, 1049, 1054, 1084, 1085, 1090, 1120, 1121, 1126, 1156, 1157,
+    1162, 1192, 1193, 1198, 797, 798, 799, 800, 803, 804, 833, 834,
+    838, 839, 868, 869, 870, 874, 875, 904, 905, 906, 910, 911,
+    940, 941, 942, 946, 947, 976, 977, 978, 982, 983, 1012, 1013,
+    1014, 1018, 1019, 1048, 1049, 1054, 1084, 1085, 1086, 1090, 1121, 799,
+    833, 834, 839, 869, 870, 874, 875, 905, 906, 910, 911, 941,
+    942, 946, 947, 977, 978, 982, 983, 1013, 1014, 1018, 1019, 1048,
+    1049, 1050, 1054, 1055, 1085, 1086, 1090, 1091, 1121, 1122, 1127, 797,
+    798, 799, 803, 832, 833, 834, 838, 839, 868, 869, 874, 875,
+    904, 905, 910, 911, 940, 941, 942, 946, 947, 976, 977, 978,
+    982, 983, 1012, 1013, 1014, 1018, 1048, 1049, 1054, 1084, 1085, 1086,
+    1090, 1120, 1121, 1122, 1126, 1157, 1162, 833, 839, 869, 874, 905,
+    910, 911, 940, 941, 942, 946, 947, 976, 977, 978, 982, 983,
+    1012, 1013, 1014, 1018, 1019, 1048, 1049, 1050, 1054, 1084, 1085, 1086,
+    1090, 1091, 1121, 1122, 1126, 1127, 1157, 1162, 1163, 905, 910, 911,
+    941, 942, 946, 947, 977, 978, 982, 983, 1013, 1014, 1018, 1019,
+    1048, 1049, 1050, 1054, 1055, 1085, 1086, 1087, 1090, 1091, 1121, 1122,
+    1123, 1126, 1127, 1157, 1158, 1163, 942, 947, 977, 978, 983, 1013,
+    1014, 1018, 1019, 1049, 1050, 1051, 1054, 1055, 1085, 1086, 1087, 1090,
+    1091, 1121, 1122, 1123, 1127, 1158, 1163, 72, 748, 784, 785, 786,
+    792, 820, 821, 827, 828, 829, 830, 856, 857, 862, 863, 864,
+    865, 892, 898, 899, 900, 928, 934, 935, 936, 964, 970, 971,
+    1000, 1006, 1007, 1036, 1042, 23, 72, 121, 145, 146, 712, 748,
+    784, 785, 790, 791, 792, 820, 821, 826, 827, 828, 829, 856,
+    862, 863, 864, 892, 898, 899, 928, 934, 935, 964, 970, 971,
+    1000, 1006, 1007, 1036, 1042, 1078, 1108, 1114, 1144, 1150, 1180, 1186,
+    61, 72, 748, 749, 755, 756, 757, 784, 785, 786, 790, 791,
+    792, 793, 794, 795, 820, 826, 827, 828, 829, 830, 862, 863,
+    864, 898, 899, 934, 935, 970, 44, 61, 65, 72, 109, 121,
+    146, 147, 646, 676, 682, 683, 712, 718, 719, 748, 749, 754,
+    755, 756, 757, 784, 785, 790, 791, 792, 793, 794, 820, 826,
+    827, 828, 829, 862, 863, 864, 898, 899, 934, 935, 970, 1006,
+    1042, 1078, 1114, 1150, 57, 72, 755, 756, 790, 791, 792, 793,
+    794, 826, 827, 828, 829, 830, 862, 863, 864, 898, 899, 900,
+    934, 935, 936, 970, 971, 1006, 1007, 1042, 1043, 1078, 1114, 0,
+    44, 45, 57, 58, 65, 72, 147, 148, 179, 682, 718, 719,
+    754, 755, 756, 790, 791, 792, 793, 826, 827, 828, 829, 862,
+    863, 864, 898, 899, 934, 935, 970, 971, 1006, 1007, 1042, 1043,
+    1078, 1114, 1115, 1150, 1151, 1186, 1187, 1222, 0, 45, 57, 61,
+    63, 109, 719, 720, 754, 755, 756, 757, 758, 790, 791, 792,
+    793, 794, 795, 826, 827, 828, 829, 862, 863, 898, 934, 0,
+    3, 44, 45, 57, 58, 61, 63, 65, 89, 109, 125, 135,
+    136, 147, 148, 610, 646, 647, 682, 683, 718, 719, 720, 754,
+    755, 756, 757, 758, 790, 791, 792, 793, 794, 826, 827, 828,
+    862, 863, 898, 934, 970, 1006, 1042, 130, 820, 856, 863, 864,
+    892, 898, 899, 900, 928, 934, 935, 936, 964, 970, 971, 972,
+    1000, 1006, 1007, 1008, 1036, 1042, 1043, 1044, 1072, 1078, 1079, 1080,
+    1108, 1114, 1115, 1116, 1144, 1145, 1150, 1151, 1152, 1180, 1181, 1186,
+    1187, 1188, 1216, 1223, 865, 866, 893, 900, 901, 929, 936, 937,
+    938, 965, 972, 973, 974, 1001, 1008, 1009, 1037, 1044, 1045, 1073,
+    1080, 130, 857, 864, 865, 892, 893, 899, 900, 901, 928, 929,
+    935, 936, 937, 964, 965, 971, 972, 973, 1000, 1001, 1007, 1008,
+    1009, 1036, 1037, 1043, 1044, 1045, 1072, 1073, 1079, 1080, 1108, 1109,
+    1115, 1116, 1117, 1145, 1152, 1153, 130, 864, 892, 899, 900, 928,
+    929, 935, 936, 937, 964, 965, 971, 972, 973, 1000, 1001, 1007,
+    1008, 1009, 1036, 1037, 1043, 1044, 1045, 1072, 1073, 1079, 1080, 1108,
+    1109, 1115, 1116, 1117, 1144, 1145, 1151, 1152, 1153, 1180, 1181, 1188,
+    1189, 130, 928, 935, 936, 964, 971, 972, 1000, 1007, 1008, 1036,
+    1037, 1043, 1044, 1072, 1073, 1079, 1080, 1108, 1109, 1115, 1116, 1117,
+    1144, 1145, 1151, 1152, 1153, 1180, 1181, 1187, 1188, 1189, 1216, 1224,
+    130, 929, 936, 937, 965, 972, 973, 1000, 1001, 1007, 1008, 1009,
+    1036, 1037, 1043, 1044, 1045, 1072, 1073, 1079, 1080, 1081, 1108, 1109,
+    1115, 1116, 1117, 1118, 1144, 1145, 1152, 1153, 1154, 1181, 1188, 1189,
+    1190, 130, 972, 1000, 1001, 1007, 1008, 1036, 1037, 1043, 1044, 1045,
+    1072, 1073, 1079, 1080, 1081, 1108, 1109, 1115, 1116, 1117, 1144, 1145,
+    1151, 1152, 1153, 1154, 1180, 1181, 1187, 1188, 1189, 1190, 1217, 1224,
+    1225, 1226, 57, 72, 130, 790, 791, 792, 826, 827, 828, 829,
+    830, 862, 863, 864, 865, 898, 899, 900, 934, 935, 936, 970,
+    971, 972, 1006, 1007, 1008, 1042, 1043, 1044, 1078, 1079, 1114, 1115,
+    1150, 1151, 1187, 0, 44, 45, 57, 58, 65, 130, 147, 148,
+    179, 754, 790, 791, 792, 826, 827, 828, 829, 862, 863, 864,
+    898, 899, 934, 935, 936, 970, 971, 972, 1006, 1007, 1042, 1043,
+    1078, 1079, 1114, 1115, 1150, 1151, 1186, 1187, 1222, 1223, 45, 57,
+    58, 130, 863, 864, 898, 899, 934, 935, 936, 970, 971, 972,
+    1006, 1007, 1008, 1042, 1043, 1044, 1078, 1079, 1080, 1114, 1115, 1116,
+    1151, 1152, 0, 44, 45, 57, 58, 125, 130, 135, 136, 148,
+    826, 827, 862, 863, 898, 899, 934, 935, 970, 971, 1006, 1007,
+    1008, 1042, 1043, 1044, 1078, 1079, 1080, 1114, 1115, 1116, 1150, 1151,
+    1152, 1186, 1187, 1188, 1222, 1223, 34, 140, 141, 221, 257, 292,
+    328, 364, 400, 436, 472, 508, 544, 580, 581, 616, 617, 622,
+    652, 653, 654, 658, 688, 689, 690, 694, 724, 725, 726, 727,
+    728, 729, 730, 731, 760, 761, 762, 766, 767, 796, 797, 802,
+    832, 838, 868, 140, 141, 149, 155, 185, 191, 221, 222, 227,
+    257, 258, 263, 292, 293, 298, 328, 329, 364, 365, 400, 436,
+    472, 508, 544, 580, 581, 616, 617, 622, 652, 653, 658, 688,
+    689, 694, 724, 725, 730, 760, 761, 766, 796, 802, 832, 1084,
+    1120, 1156, 1192, 6, 139, 221, 257, 292, 293, 328, 329, 364,
+    365, 400, 401, 436, 437, 472, 473, 508, 509, 544, 545, 546,
+    580, 581, 582, 616, 617, 618, 652, 653, 654, 688, 689, 724,
+    6, 139, 140, 149, 185, 221, 222, 257, 258, 259, 292, 293,
+    294, 328, 329, 364, 365, 400, 401, 436, 437, 472, 473, 508,
+    509, 544, 545, 580, 581, 582, 616, 617, 618, 652, 653, 654,
+    688, 689, 724, 725, 760, 796, 1156, 1192, 6, 139, 140, 149,
+    185, 186, 221, 222, 223, 257, 258, 259, 292, 293, 294, 328,
+    329, 364, 365, 400, 401, 436, 437, 472, 473, 508, 509, 544,
+    545, 580, 581, 616, 617, 652, 653, 688, 689, 724, 760, 796,
+    832, 1120, 1156, 1192, 6, 139, 140, 149, 150, 185, 186, 221,
+    222, 223, 257, 258, 259, 292, 293, 328, 329, 364, 365, 400,
+    401, 436, 472, 508, 544, 580, 616, 652, 688, 724, 760, 1120,
+    1156, 1192, 329, 364, 365, 400, 401, 436, 437, 438, 442, 472,
+    473, 478, 508, 509, 514, 544, 545, 546, 550, 580, 581, 582,
+    586, 616, 617, 618, 653, 654, 655, 257, 258, 292, 293, 298,
+    328, 329, 334, 364, 365, 366, 370, 400, 401, 402, 406, 436,
+    437, 442, 472, 473, 478, 508, 509, 514, 544, 545, 550, 580,
+    581, 582, 586, 616, 617, 618, 622, 652, 653, 654, 688, 689,
+    140, 141, 185, 221, 222, 227, 257, 258, 259, 263, 292, 293,
+    294, 298, 328, 329, 334, 364, 365, 370, 400, 401, 406, 436,
+    437, 442, 472, 473, 478, 508, 509, 514, 544, 545, 550, 580,
+    581, 586, 616, 617, 622, 652, 653, 688, 140, 141, 149, 185,
+    191, 221, 222, 227, 257, 258, 259, 263, 292, 293, 294, 298,
+    328, 329, 334, 364, 365, 370, 400, 401, 406, 436, 437, 472,
+    508, 544, 580, 616, 617, 652, 688, 401, 402, 406, 437, 438,
+    442, 443, 473, 474, 478, 479, 509, 510, 514, 515, 545, 546,
+    547, 550, 551, 581, 582, 583, 584, 586, 587, 617, 618, 619,
+    620, 621, 622, 623, 624, 653, 654, 655, 656, 657, 658, 659,
+    660, 365, 370, 401, 402, 406, 437, 438, 442, 473, 474, 478,
+    509, 514, 545, 546, 550, 551, 581, 582, 583, 586, 587, 617,
+    618, 619, 620, 622, 623, 654, 655, 656, 657, 658, 659, 330,
+    365, 366, 367, 370, 371, 401, 402, 403, 406, 407, 437, 438,
+    439, 442, 443, 473, 474, 475, 478, 479, 509, 510, 511, 514,
+    515, 545, 546, 547, 548, 550, 551, 581, 582, 583, 584, 586,
+    587, 618, 619, 620, 621, 623, 624, 655, 656, 657, 34, 334,
+    370, 406, 437, 442, 472, 473, 478, 508, 509, 514, 544, 545,
+    550, 580, 581, 582, 586, 616, 617, 618, 619, 622, 623, 653,
+    654, 655, 656, 658, 659, 689, 690, 691, 692, 693, 694, 695,
+    730, 731, 34, 141, 142, 263, 298, 328, 334, 364, 370, 400,
+    406, 436, 442, 472, 478, 508, 514, 544, 545, 550, 580, 581,
+    586, 616, 617, 618, 622, 652, 653, 654, 658, 659, 688, 689,
+    690, 691, 694, 695, 730, 766, 140, 141, 142, 191, 227, 263,
+    292, 298, 328, 334, 364, 370, 400, 406, 436, 442, 478, 550,
+    586, 622, 652, 658, 688, 694, 730, 766, 227, 258, 259, 260,
+    263, 264, 292, 293, 294, 295, 298, 299, 328, 329, 330, 331,
+    334, 335, 364, 365, 366, 367, 370, 371, 400, 401, 402, 406,
+    407, 436, 437, 438, 442, 472, 473, 478, 508, 509, 514, 545,
+    550, 581, 586, 622, 191, 222, 227, 228, 258, 259, 260, 263,
+    264, 265, 292, 293, 294, 295, 298, 299, 328, 329, 330, 331,
+    334, 335, 364, 365, 366, 370, 371, 400, 401, 402, 406, 436,
+    437, 442, 472, 478, 514, 550, 586, 12, 23, 71, 121, 144,
+    145, 146, 568, 598, 604, 634, 640, 670, 676, 677, 706, 712,
+    713, 742, 743, 748, 749, 778, 784, 785, 814, 820, 821, 856,
+    23, 48, 71, 121, 144, 145, 146, 173, 209, 245, 281, 604,
+    634, 640, 670, 676, 706, 712, 742, 748, 749, 778, 784, 785,
+    814, 820, 821, 856, 892, 928, 964, 1000, 1180, 1216, 12, 23,
+    48, 121, 144, 145, 146, 209, 239, 245, 275, 281, 310, 316,
+    346, 352, 382, 388, 418, 424, 454, 460, 490, 496, 526, 532,
+    562, 568, 598, 604, 634, 640, 641, 670, 676, 677, 706, 712,
+    713, 742, 748, 749, 778, 784, 785, 820, 856, 23, 48, 121,
+    144, 145, 146, 173, 209, 239, 245, 275, 281, 310, 316, 352,
+    388, 424, 460, 496, 532, 568, 604, 634, 640, 670, 676, 706,
+    712, 742, 748, 784, 820, 856, 1216, 23, 121, 145, 146, 281,
+    316, 352, 388, 424, 460, 496, 532, 568, 604, 640, 670, 676,
+    677, 712, 713, 748, 784, 23, 65, 121, 144, 145, 146, 147,
+    173, 179, 209, 215, 245, 246, 251, 281, 287, 316, 352, 388,
+    424, 460, 496, 532, 568, 604, 640, 676, 712, 748, 749, 784,
+    790, 820, 826, 856, 862, 898, 1186, 1216, 1222, 23, 48, 121,
+    144, 145, 146, 209, 239, 245, 246, 275, 281, 282, 310, 316,
+    317, 346, 352, 382, 388, 418, 424, 425, 454, 460, 490, 496,
+    526, 532, 562, 568, 598, 604, 605, 634, 640, 641, 670, 676,
+    677, 706, 712, 742, 748, 784, 23, 48, 121, 144, 145, 146,
+    173, 203, 209, 210, 239, 245, 246, 275, 281, 282, 310, 316,
+    317, 346, 352, 382, 388, 418, 424, 454, 460, 490, 496, 532,
+    568, 598, 604, 634, 640, 670, 676, 706, 712, 748, 1216, 61,
+    63, 102, 109, 538, 539, 574, 575, 604, 610, 611, 612, 640,
+    641, 646, 647, 648, 649, 676, 677, 678, 683, 684, 685, 686,
+    712, 713, 714, 719, 720, 721, 722, 723, 749, 750, 755, 756,
+    757, 758, 759, 61, 63, 102, 109, 430, 466, 502, 538, 574,
+    575, 610, 611, 612, 640, 641, 646, 647, 648, 649, 676, 677,
+    682, 683, 684, 685, 712, 713, 714, 718, 719, 720, 721, 722,
+    749, 750, 754, 755, 756, 757, 758, 759, 790, 791, 792, 793,
+    460, 496, 503, 532, 539, 568, 569, 575, 604, 605, 611, 612,
+    640, 641, 647, 648, 676, 677, 678, 684, 712, 713, 714, 102,
+    109, 431, 467, 503, 532, 538, 539, 540, 568, 575, 576, 604,
+    605, 611, 612, 613, 641, 647, 648, 649, 650, 677, 678, 683,
+    684, 685, 686, 713, 714, 719, 720, 721, 722, 102, 109, 358,
+    394, 395, 430, 431, 466, 467, 502, 503, 538, 539, 568, 574,
+    575, 576, 604, 610, 611, 612, 640, 641, 646, 647, 648, 649,
+    676, 677, 682, 683, 684, 685, 712, 713, 718, 719, 720, 721,
+    754, 755, 756, 44, 61, 65, 109, 121, 146, 147, 148, 287,
+    322, 358, 394, 430, 466, 502, 538, 574, 575, 610, 611, 646,
+    647, 648, 682, 683, 684, 713, 718, 719, 720, 754, 755, 756,
+    757, 758, 790, 791, 792, 793, 826, 827, 862, 898, 44, 57,
+    65, 121, 146, 147, 148, 179, 215, 251, 287, 322, 394, 430,
+    466, 502, 538, 574, 610, 646, 647, 682, 683, 718, 719, 754,
+    755, 756, 790, 791, 792, 826, 827, 862, 863, 898, 934, 970,
+    1006, 1042, 1150, 1186, 1222, 44, 65, 147, 148, 251, 287, 288,
+    322, 323, 358, 359, 394, 395, 430, 431, 466, 467, 502, 503,
+    538, 539, 574, 575, 610, 611, 646, 647, 648, 682, 683, 684,
+    718, 719, 720, 754, 755, 790, 791, 826, 3, 51, 63, 89,
+    102, 431, 467, 503, 504, 539, 540, 575, 576, 611, 612, 613,
+    647, 648, 649, 650, 683, 684, 685, 686, 687, 719, 720, 721,
+    722, 723, 0, 3, 4, 42, 51, 55, 63, 73, 89, 102,
+    135, 136, 148, 359, 395, 430, 431, 466, 467, 502, 503, 538,
+    539, 574, 575, 576, 610, 611, 612, 646, 647, 648, 649, 682,
+    683, 684, 685, 686, 718, 719, 720, 721, 722, 755, 756, 32,
+    424, 425, 460, 461, 467, 468, 496, 497, 503, 504, 532, 533,
+    539, 540, 568, 569, 575, 576, 604, 605, 611, 612, 640, 641,
+    648, 677, 316, 352, 359, 388, 389, 394, 395, 424, 425, 430,
+    431, 460, 461, 466, 467, 468, 496, 497, 502, 503, 504, 532,
+    538, 539, 540, 568, 569, 574, 575, 576, 604, 605, 610, 611,
+    612, 640, 641, 646, 647, 648, 676, 677, 396, 425, 431, 432,
+    461, 467, 468, 496, 497, 503, 504, 532, 533, 538, 539, 540,
+    568, 569, 575, 576, 577, 604, 605, 611, 612, 613, 641, 647,
+    648, 649, 650, 677, 684, 685, 686, 359, 395, 396, 430, 431,
+    432, 466, 467, 468, 502, 503, 504, 538, 539, 540, 574, 575,
+    576, 610, 611, 612, 641, 647, 648, 684, 389, 396, 397, 425,
+    431, 432, 433, 461, 467, 468, 469, 497, 503, 504, 505, 533,
+    539, 540, 541, 569, 575, 576, 577, 605, 612, 613, 4, 64,
+    317, 323, 324, 325, 352, 353, 359, 360, 361, 388, 389, 395,
+    396, 397, 424, 425, 430, 431, 432, 433, 460, 461, 466, 467,
+    468, 469, 496, 497, 502, 503, 504, 505, 532, 538, 539, 540,
+    569, 575, 576, 605, 611, 612, 613, 648, 65, 121, 146, 147,
+    251, 281, 282, 287, 288, 316, 317, 322, 323, 352, 358, 359,
+    388, 394, 395, 424, 430, 431, 460, 466, 467, 496, 502, 503,
+    532, 538, 539, 568, 574, 575, 604, 610, 611, 640, 646, 647,
+    676, 682, 4, 44, 65, 147, 251, 287, 288, 289, 322, 323,
+    324, 352, 358, 359, 360, 388, 394, 395, 396, 424, 430, 431,
+    432, 460, 466, 467, 468, 496, 502, 503, 538, 539, 568, 574,
+    575, 604, 610, 611, 612, 646, 647, 648, 682, 683, 684, 718,
+    1, 4, 7, 44, 65, 76, 104, 147, 148, 179, 215, 216,
+    251, 252, 253, 287, 288, 289, 290, 316, 322, 323, 324, 352,
+    358, 359, 360, 388, 394, 395, 396, 424, 430, 431, 466, 467,
+    502, 503, 538, 539, 574, 575, 610, 611, 646, 647, 682, 718,
+    134, 252, 281, 282, 287, 288, 289, 290, 316, 317, 322, 323,
+    324, 325, 352, 353, 358, 359, 360, 388, 389, 394, 395, 396,
+    424, 425, 430, 431, 432, 460, 461, 466, 467, 468, 496, 497,
+    502, 503, 504, 532, 538, 539, 568, 574, 575, 604, 611, 640,
+    128, 134, 245, 246, 252, 253, 281, 282, 283, 288, 289, 290,
+    316, 317, 323, 324, 352, 353, 358, 359, 388, 389, 394, 395,
+    424, 430, 431, 460, 467, 496, 503, 532, 1, 4, 5, 7,
+    91, 104, 105, 134, 252, 253, 254, 282, 288, 289, 290, 291,
+    316, 317, 322, 323, 324, 325, 352, 353, 358, 359, 360, 388,
+    389, 394, 395, 396, 424, 430, 431, 432, 466, 467, 502, 503,
+    538, 539, 431, 432, 467, 468, 503, 504, 539, 540, 575, 576,
+    577, 611, 612, 613, 647, 648, 649, 650, 684, 685, 4, 51,
+    64, 73, 323, 358, 359, 360, 394, 395, 396, 430, 431, 432,
+    466, 467, 468, 502, 503, 504, 538, 539, 540, 574, 575, 576,
+    610, 611, 612, 646, 647, 648, 649, 683, 684, 685, 4, 51,
+    63, 64, 73, 360, 395, 396, 431, 432, 467, 468, 469, 503,
+    504, 505, 539, 540, 575, 576, 577, 611, 612, 613, 614, 647,
+    648, 649, 650, 683, 684, 685, 686, 687, 3, 4, 17, 42,
+    51, 55, 60, 63, 64, 73, 89, 94, 323, 324, 358, 359,
+    360, 394, 395, 396, 430, 431, 432, 466, 467, 468, 502, 503,
+    504, 538, 539, 540, 574, 575, 576, 610, 611, 612, 613, 646,
+    647, 648, 649, 683, 684, 685, 1, 3, 4, 17, 42, 51,
+    55, 64, 73, 76, 89, 94, 104, 119, 135, 136, 148, 323,
+    324, 359, 360, 394, 395, 396, 431, 432, 467, 468, 503, 539,
+    575, 611, 1, 4, 7, 17, 42, 51, 55, 64, 73, 76,
+    89, 94, 104, 119, 125, 135, 136, 148, 323, 324, 359, 360,
+    395, 431, 1, 4, 7, 17, 55, 60, 64, 73, 94, 104,
+    288, 289, 290, 323, 324, 325, 358, 359, 360, 361, 394, 395,
+    396, 397, 430, 431, 432, 433, 466, 467, 468, 503, 504, 539,
+    575, 1, 4, 5, 7, 17, 60, 64, 73, 76, 94, 104,
+    134, 288, 289, 290, 291, 323, 324, 325, 358, 359, 360, 395,
+    396, 431, 467, 503, 32, 100, 353, 354, 360, 361, 362, 389,
+    390, 396, 397, 398, 425, 426, 431, 432, 433, 434, 461, 462,
+    467, 468, 469, 470, 497, 503, 504, 505, 506, 533, 539, 540,
+    541, 569, 576, 577, 613, 60, 64, 100, 317, 318, 324, 325,
+    326, 353, 354, 359, 360, 361, 362, 389, 390, 395, 396, 397,
+    398, 425, 426, 431, 432, 433, 434, 461, 467, 468, 469, 497,
+    503, 504, 505, 533, 539, 540, 569, 576, 7, 60, 64, 91,
+    100, 134, 289, 290, 291, 317, 318, 323, 324, 325, 326, 352,
+    353, 359, 360, 361, 389, 395, 396, 397, 425, 431, 432, 433,
+    461, 467, 468, 504, 1, 5, 7, 11, 60, 64, 91, 92,
+    100, 104, 105, 128, 134, 254, 282, 283, 289, 290, 291, 317,
+    318, 323, 324, 325, 326, 352, 353, 359, 360, 361, 389, 395,
+    396, 397, 425, 431, 432, 467, 140, 141, 149, 155, 185, 186,
+    191, 221, 222, 227, 257, 292, 328, 364, 400, 436, 472, 508,
+    544, 580, 616, 652, 688, 724, 725, 760, 761, 766, 796, 802,
+    832, 838, 868, 904, 940, 976, 1012, 1048, 1084, 1120, 1126, 1156,
+    1162, 1192, 1193, 1198, 140, 141, 149, 150, 155, 185, 186, 191,
+    221, 222, 223, 227, 257, 258, 263, 292, 293, 298, 328, 364,
+    400, 436, 472, 508, 544, 580, 616, 652, 688, 724, 760, 796,
+    832, 976, 1012, 1048, 1084, 1120, 1126, 1156, 1162, 1192, 1193, 1198,
+    140, 141, 149, 150, 155, 185, 186, 191, 221, 222, 223, 227,
+    228, 257, 258, 259, 263, 292, 293, 298, 328, 329, 364, 365,
+    400, 436, 472, 508, 544, 580, 616, 652, 1156, 1192, 1198, 140,
+    141, 149, 150, 151, 155, 156, 185, 186, 187, 191, 192, 221,
+    222, 223, 224, 227, 228, 257, 258, 259, 263, 292, 293, 298,
+    328, 364, 400, 1120, 1156, 1157, 1162, 1192, 1193, 1198, 140, 141,
+    149, 150, 151, 155, 156, 185, 186, 187, 188, 191, 192, 221,
+    222, 223, 227, 228, 257, 258, 263, 292, 904, 940, 976, 1012,
+    1048, 1054, 1084, 1085, 1090, 1120, 1121, 1122, 1126, 1156, 1157, 1158,
+    1162, 1163, 1192, 1193, 1194, 1195, 1198, 1199, 140, 149, 150, 151,
+    152, 155, 156, 185, 186, 187, 188, 191, 192, 221, 222, 223,
+    224, 227, 228, 257, 258, 259, 263, 292, 293, 1084, 1120, 1121,
+    1126, 1156, 1157, 1158, 1162, 1163, 1192, 1193, 1194, 1195, 1198, 1199,
+    23, 48, 71, 124, 144, 145, 173, 203, 742, 778, 814, 820,
+    850, 856, 892, 928, 964, 1000, 1036, 1144, 1180, 1210, 1216, 23,
+    39, 48, 71, 113, 124, 143, 144, 145, 167, 173, 174, 203,
+    209, 210, 239, 245, 778, 784, 814, 820, 821, 850, 856, 886,
+    892, 922, 928, 958, 964, 994, 1000, 1030, 1036, 1066, 1072, 1102,
+    1108, 1138, 1144, 1145, 1174, 1180, 1181, 1210, 1216, 1217, 23, 48,
+    71, 121, 144, 145, 146, 173, 209, 245, 281, 676, 712, 742,
+    748, 778, 784, 785, 814, 820, 821, 856, 892, 928, 964, 1000,
+    1036, 1072, 1108, 1144, 1180, 1216, 23, 113, 121, 144, 145, 146,
+    173, 174, 209, 245, 784, 820, 856, 892, 928, 964, 1000, 1036,
+    1072, 1108, 1138, 1144, 1174, 1180, 1181, 1210, 1216, 1217, 23, 48,
+    121, 144, 145, 146, 173, 203, 209, 210, 239, 245, 246, 275,
+    281, 316, 748, 784, 820, 856, 1108, 1144, 1180, 1216, 23, 113,
+    144, 145, 167, 173, 174, 203, 209, 210, 239, 245, 246, 281,
+    1036, 1072, 1108, 1144, 1180, 1210, 1216, 1217, 23, 121, 130, 145,
+    146, 173, 180, 209, 245, 820, 856, 892, 899, 928, 935, 964,
+    971, 1000, 1007, 1036, 1043, 1072, 1108, 1115, 1144, 1151, 1180, 1187,
+    1216, 1217, 1223, 1224, 130, 173, 174, 209, 892, 928, 964, 1000,
+    1007, 1036, 1043, 1072, 1079, 1108, 1115, 1116, 1144, 1145, 1151, 1152,
+    1180, 1181, 1187, 1188, 1189, 1216, 1217, 1223, 1224, 1225, 130, 174,
+    1000, 1036, 1072, 1108, 1109, 1116, 1144, 1145, 1152, 1153, 1180, 1181,
+    1188, 1189, 1190, 1216, 1217, 1224, 1225, 1226, 113, 130, 173, 174,
+    180, 181, 182, 209, 210, 216, 217, 218, 245, 246, 1000, 1036,
+    1072, 1108, 1115, 1144, 1145, 1151, 1152, 1180, 1181, 1187, 1188, 1189,
+    1216, 1217, 1223, 1224, 1225, 67, 107, 113, 173, 174, 181, 182,
+    183, 210, 1072, 1108, 1144, 1145, 1152, 1180, 1181, 1188, 1189, 1190,
+    1216, 1217, 1218, 1224, 1225, 1226, 44, 57, 65, 90, 130, 147,
+    148, 179, 180, 181, 215, 216, 251, 287, 790, 826, 827, 862,
+    863, 898, 899, 934, 935, 970, 971, 1006, 1007, 1042, 1043, 1078,
+    1079, 1114, 1115, 1150, 1151, 1186, 1187, 1188, 1222, 1223, 1224, 44,
+    65, 90, 121, 146, 147, 148, 179, 180, 215, 216, 217, 251,
+    252, 253, 287, 288, 322, 323, 358, 394, 430, 466, 502, 574,
+    610, 646, 682, 718, 754, 790, 826, 862, 898, 934, 970, 1006,
+    1042, 1078, 1114, 1150, 1186, 1187, 1222, 1223, 44, 58, 65, 76,
+    90, 121, 146, 147, 148, 179, 180, 181, 215, 216, 217, 218,
+    251, 252, 253, 287, 288, 322, 358, 790, 826, 862, 898, 934,
+    970, 1006, 1042, 1078, 1114, 1115, 1150, 1151, 1186, 1187, 1188, 1222,
+    1223, 1224, 67, 107, 130, 180, 181, 182, 971, 1000, 1007, 1036,
+    1043, 1044, 1072, 1079, 1080, 1108, 1109, 1115, 1116, 1117, 1144, 1145,
+    1151, 1152, 1153, 1180, 1181, 1187, 1188, 1189, 1190, 1216, 1217, 1223,
+    1224, 1225, 1226, 107, 173, 174, 179, 180, 181, 182, 209, 210,
+    215, 216, 217, 218, 245, 252, 253, 970, 1006, 1042, 1078, 1079,
+    1108, 1114, 1115, 1144, 1150, 1151, 1152, 1180, 1181, 1186, 1187, 1188,
+    1189, 1216, 1217, 1222, 1223, 1224, 1225, 67, 107, 174, 180, 181,
+    182, 183, 217, 218, 1115, 1151, 1152, 1181, 1187, 1188, 1189, 1217,
+    1223, 1224, 1225, 1226, 105, 128, 180, 209, 210, 215, 216, 217,
+    218, 245, 246, 247, 251, 252, 253, 254, 255, 281, 282, 283,
+    287, 288, 289, 290, 316, 317, 322, 323, 324, 352, 353, 358,
+    359, 388, 394, 395, 424, 430, 460, 466, 502, 5, 105, 128,
+    134, 173, 174, 179, 180, 181, 182, 209, 210, 215, 216, 217,
+    218, 219, 220, 245, 246, 247, 251, 252, 253, 254, 255, 256,
+    281, 282, 283, 287, 288, 289, 290, 291, 316, 317, 322, 323,
+    324, 352, 358, 388, 394, 1223, 1224, 1, 44, 65, 76, 90,
+    147, 179, 180, 215, 216, 217, 251, 252, 253, 254, 287, 288,
+    289, 322, 323, 324, 358, 359, 394, 395, 430, 466, 502, 538,
+    574, 610, 646, 1186, 1222, 1223, 1, 44, 65, 76, 90, 147,
+    179, 180, 181, 215, 216, 217, 218, 219, 251, 252, 253, 254,
+    287, 288, 289, 322, 323, 358, 1150, 1186, 1187, 1222, 1223, 1224,
+    1, 5, 7, 104, 105, 134, 216, 217, 252, 253, 254, 255,
+    282, 287, 288, 289, 290, 291, 317, 322, 323, 324, 325, 352,
+    358, 359, 360, 394, 395, 430, 431, 1, 5, 7, 105, 217,
+    218, 252, 253, 254, 255, 288, 289, 290, 0, 1, 42, 44,
+    45, 58, 65, 76, 90, 94, 119, 125, 135, 136, 147, 148,
+    179, 180, 215, 216, 217, 251, 252, 253, 287, 288, 322, 358,
+    394, 790, 826, 862, 898, 934, 970, 1006, 1042, 1078, 1114, 1150,
+    1151, 1186, 1187, 1222, 1223, 44, 45, 57, 58, 90, 130, 148,
+    179, 180, 181, 215, 216, 217, 251, 862, 863, 898, 899, 934,
+    935, 970, 971, 1006, 1007, 1042, 1043, 1078, 1079, 1114, 1115, 1116,
+    1150, 1151, 1152, 1186, 1187, 1188, 1222, 1223, 1224, 0, 44, 45,
+    57, 58, 76, 90, 119, 125, 135, 136, 148, 179, 180, 215,
+    216, 934, 970, 971, 1006, 1007, 1042, 1043, 1078, 1079, 1114, 1115,
+    1150, 1151, 1152, 1186, 1187, 1188, 1222, 1223, 1224, 1, 4, 5,
+    7, 17, 42, 44, 55, 58, 65, 76, 90, 94, 104, 119,
+    125, 135, 136, 147, 148, 179, 180, 215, 216, 217, 218, 251,
+    252, 253, 254, 255, 287, 288, 289, 290, 322, 323, 324, 358,
+    359, 394, 430, 466, 1150, 1186, 1222, 1223, 140, 724, 760, 761,
+    762, 796, 797, 798, 832, 833, 838, 868, 869, 874, 904, 905,
+    910, 940, 941, 946, 976, 977, 982, 1012, 1048, 1084, 1120, 1156,
+    140, 760, 761, 762, 796, 797, 802, 803, 832, 838, 868, 874,
+    904, 910, 940, 946, 976, 982, 1012, 1018, 1048, 1054, 1084, 1090,
+    1120, 1126, 1162, 72, 130, 820, 821, 856, 857, 863, 864, 892,
+    899, 900, 928, 935, 936, 964, 971, 972, 1000, 1007, 1036, 1072,
+    1108, 1144, 72, 130, 820, 821, 827, 828, 829, 856, 863, 864,
+    865, 892, 898, 899, 900, 928, 934, 935, 936, 964, 970, 971,
+    972, 1000, 1007, 1008, 1036, 1043, 1072, 1079, 1108, 1115, 72, 121,
+    130, 146, 784, 820, 821, 856, 863, 892, 899, 928, 935, 964,
+    971, 1000, 1007, 1036, 1072, 1108, 1144, 1180, 1216, 72, 121, 130,
+    146, 784, 820, 821, 826, 827, 828, 856, 862, 863, 864, 892,
+    898, 899, 900, 928, 934, 935, 936, 964, 970, 971, 972, 1000,
+    1006, 1007, 1036, 1042, 1043, 1072, 1078, 1079, 1108, 1114, 1115, 1144,
+    1150, 1151, 1180, 1186, 1187, 130, 856, 857, 864, 892, 899, 900,
+    928, 935, 936, 964, 965, 971, 972, 1000, 1001, 1007, 1008, 1036,
+    1043, 1044, 1072, 1108, 1144, 130, 856, 863, 864, 865, 892, 899,
+    900, 928, 935, 936, 964, 971, 972, 1000, 1007, 1008, 1036, 1043,
+    1044, 1072, 1079, 1080, 1108, 1115, 1116, 1144, 1151, 1152, 140, 141,
+    185, 221, 257, 292, 364, 400, 436, 472, 508, 544, 580, 616,
+    652, 653, 688, 689, 724, 725, 726, 760, 761, 762, 796, 797,
+    802, 832, 838, 868, 904, 940, 976, 1192, 140, 141, 185, 191,
+    221, 227, 257, 292, 328, 364, 400, 436, 472, 508, 544, 580,
+    616, 617, 652, 653, 658, 688, 689, 694, 724, 725, 726, 727,
+    728, 730, 760, 761, 762, 766, 767, 796, 797, 802, 832, 838,
+    868, 874, 904, 910, 940, 140, 141, 185, 221, 257, 292, 328,
+    364, 400, 436, 472, 508, 544, 580, 581, 586, 616, 617, 622,
+    652, 653, 658, 688, 689, 690, 694, 724, 725, 726, 730, 760,
+    761, 766, 796, 140, 141, 185, 221, 257, 258, 263, 292, 293,
+    298, 328, 329, 364, 365, 400, 401, 436, 437, 472, 508, 544,
+    545, 550, 580, 581, 586, 616, 617, 622, 652, 653, 658, 688,
+    689, 724, 760, 329, 330, 334, 365, 366, 370, 371, 401, 402,
+    406, 407, 437, 438, 442, 443, 473, 474, 478, 479, 509, 510,
+    514, 515, 545, 546, 547, 550, 551, 581, 582, 583, 586, 587,
+    618, 619, 620, 623, 329, 330, 335, 365, 366, 367, 370, 371,
+    401, 402, 403, 406, 407, 437, 438, 439, 442, 443, 473, 474,
+    475, 478, 479, 509, 510, 514, 515, 545, 546, 547, 550, 551,
+    582, 583, 587, 619, 34, 140, 141, 142, 227, 263, 298, 328,
+    364, 370, 400, 406, 436, 442, 472, 478, 508, 514, 544, 550,
+    580, 586, 616, 617, 622, 652, 653, 658, 688, 689, 690, 694,
+    730, 766, 34, 140, 141, 142, 191, 227, 257, 263, 292, 293,
+    298, 328, 329, 334, 364, 365, 370, 400, 401, 406, 436, 437,
+    442, 472, 478, 508, 514, 544, 550, 580, 581, 586, 616, 617,
+    622, 652, 653, 654, 658, 688, 689, 690, 694, 730, 766, 329,
+    330, 334, 365, 366, 370, 401, 402, 406, 407, 437, 438, 442,
+    443, 473, 474, 478, 509, 514, 545, 546, 550, 581, 582, 586,
+    587, 618, 294, 298, 299, 329, 330, 331, 334, 335, 365, 366,
+    367, 370, 371, 401, 402, 403, 406, 407, 437, 438, 439, 442,
+    443, 473, 474, 478, 479, 509, 510, 514, 545, 546, 550, 551,
+    582, 587, 263, 293, 294, 298, 299, 329, 330, 334, 365, 366,
+    370, 371, 401, 402, 406, 407, 437, 438, 442, 473, 478, 509,
+    514, 545, 550, 581, 586, 264, 293, 294, 295, 298, 299, 329,
+    330, 331, 334, 335, 365, 366, 367, 370, 371, 401, 402, 403,
+    406, 407, 437, 438, 442, 443, 473, 474, 478, 509, 514, 545,
+    550, 109, 394, 424, 430, 460, 466, 496, 502, 503, 532, 538,
+    539, 568, 574, 575, 604, 605, 610, 611, 612, 640, 641, 646,
+    647, 648, 676, 677, 682, 683, 684, 712, 713, 718, 719, 720,
+    748, 749, 754, 755, 756, 352, 388, 394, 424, 430, 431, 460,
+    466, 467, 496, 502, 503, 532, 538, 539, 568, 574, 575, 604,
+    605, 610, 611, 612, 640, 641, 646, 647, 648, 676, 677, 682,
+    683, 684, 712, 713, 718, 719, 44, 61, 65, 109, 121, 145,
+    146, 147, 574, 604, 610, 640, 646, 647, 676, 677, 682, 683,
+    712, 713, 718, 719, 720, 748, 749, 750, 754, 755, 756, 757,
+    784, 785, 790, 791, 792, 793, 820, 826, 827, 828, 862, 863,
+    898, 934, 44, 65, 109, 121, 145, 146, 147, 251, 287, 322,
+    394, 430, 466, 502, 538, 568, 574, 604, 610, 611, 640, 646,
+    647, 676, 677, 682, 683, 712, 713, 718, 719, 720, 748, 749,
+    754, 755, 756, 784, 790, 791, 792, 820, 826, 827, 862, 898,
+    44, 65, 121, 146, 147, 148, 179, 215, 216, 251, 252, 287,
+    288, 322, 358, 394, 430, 466, 502, 538, 574, 610, 611, 646,
+    647, 682, 683, 718, 719, 754, 755, 790, 791, 826, 862, 898,
+    934, 970, 1150, 1186, 1222, 44, 65, 121, 146, 147, 148, 179,
+    215, 216, 251, 252, 287, 288, 322, 323, 358, 359, 394, 395,
+    430, 431, 466, 467, 502, 538, 574, 610, 611, 646, 647, 682,
+    683, 718, 754, 1222, 0, 3, 44, 45, 61, 63, 65, 89,
+    109, 125, 135, 136, 147, 148, 502, 538, 574, 610, 611, 646,
+    647, 682, 683, 684, 718, 719, 720, 721, 754, 755, 756, 757,
+    758, 790, 791, 792, 793, 826, 827, 862, 0, 3, 44, 45,
+    51, 63, 65, 89, 109, 125, 135, 136, 147, 148, 287, 322,
+    358, 394, 430, 466, 502, 538, 574, 575, 610, 611, 646, 647,
+    648, 682, 683, 684, 718, 719, 720, 721, 754, 755, 756, 757,
+    790, 791, 792, 826, 827, 862, 245, 251, 252, 253, 281, 282,
+    287, 288, 289, 316, 317, 322, 323, 352, 358, 359, 388, 394,
+    395, 424, 430, 431, 460, 466, 467, 496, 502, 532, 538, 568,
+    4, 288, 289, 290, 317, 323, 324, 325, 352, 353, 358, 359,
+    360, 388, 389, 394, 395, 396, 424, 425, 430, 431, 432, 460,
+    466, 467, 468, 496, 502, 503, 504, 538, 539, 575, 1, 4,
+    7, 17, 60, 64, 104, 134, 288, 289, 290, 291, 317, 323,
+    324, 325, 352, 353, 359, 360, 361, 388, 389, 395, 396, 397,
+    424, 425, 431, 432, 433, 460, 461, 467, 468, 496, 503, 504,
+    539, 575, 1, 4, 17, 42, 44, 51, 55, 73, 76, 89,
+    94, 104, 119, 136, 148, 251, 287, 288, 289, 322, 323, 324,
+    358, 359, 394, 395, 430, 431, 432, 466, 467, 502, 503, 538,
+    539, 574, 575, 610, 611, 612, 646, 647, 648, 682, 683, 684,
+    718, 1, 4, 17, 42, 51, 55, 64, 73, 94, 104, 288,
+    289, 322, 323, 324, 358, 359, 360, 394, 395, 396, 430, 431,
+    432, 466, 467, 468, 502, 503, 538, 539, 574, 575, 611, 1,
+    4, 7, 17, 42, 51, 55, 64, 73, 76, 94, 104, 119,
+    251, 252, 253, 287, 288, 289, 290, 322, 323, 324, 358, 359,
+    360, 394, 395, 396, 430, 431, 466, 467, 502, 503, 538, 539,
+    574, 575, 140, 141, 149, 185, 221, 257, 616, 652, 688, 724,
+    725, 726, 760, 761, 762, 796, 797, 802, 832, 838, 868, 874,
+    904, 910, 940, 946, 976, 1012, 1048, 1084, 1120, 1156, 1192, 140,
+    141, 149, 155, 185, 191, 221, 257, 292, 580, 616, 652, 688,
+    689, 724, 725, 726, 730, 760, 761, 762, 766, 767, 796, 797,
+    802, 832, 838, 868, 874, 904, 910, 940, 946, 976, 982, 1012,
+    1018, 1048, 1054, 1084, 1090, 1120, 1126, 1156, 1162, 1192, 1198, 140,
+    149, 185, 221, 760, 796, 797, 832, 868, 874, 904, 910, 940,
+    946, 976, 982, 1012, 1018, 1048, 1084, 1085, 1090, 1120, 1121, 1126,
+    1156, 1157, 1162, 1192, 1193, 1198, 140, 141, 149, 155, 185, 191,
+    221, 724, 760, 761, 766, 796, 797, 802, 832, 838, 868, 874,
+    904, 910, 940, 946, 976, 982, 1012, 1018, 1048, 1054, 1084, 1085,
+    1090, 1120, 1121, 1126, 1156, 1157, 1162, 1192, 1193, 1198, 140, 149,
+    150, 155, 185, 186, 221, 222, 257, 292, 760, 796, 832, 868,
+    904, 940, 976, 1012, 1048, 1084, 1085, 1120, 1121, 1126, 1156, 1157,
+    1162, 1192, 1193, 1198, 140, 141, 149, 150, 155, 185, 186, 191,
+    221, 222, 227, 257, 292, 760, 796, 832, 940, 976, 982, 1012,
+    1018, 1048, 1054, 1084, 1090, 1120, 1126, 1156, 1157, 1162, 1192, 1193,
+    1198, 140, 141, 149, 150, 155, 185, 186, 187, 191, 221, 222,
+    223, 227, 257, 258, 292, 293, 328, 364, 760, 796, 976, 1012,
+    1048, 1084, 1120, 1121, 1126, 1156, 1157, 1162, 1192, 1193, 1198, 140,
+    141, 149, 155, 185, 186, 191, 192, 221, 222, 227, 257, 258,
+    292, 1120, 1126, 1156, 1162, 1192, 1198, 149, 185, 868, 904, 910,
+    940, 946, 976, 977, 982, 1012, 1013, 1018, 1048, 1049, 1054, 1084,
+    1085, 1090, 1120, 1121, 1122, 1126, 1156, 1157, 1158, 1162, 1163, 1192,
+    1193, 1198, 155, 874, 910, 946, 976, 982, 1012, 1018, 1048, 1049,
+    1054, 1084, 1085, 1090, 1120, 1121, 1126, 1127, 1156, 1157, 1162, 1163,
+    1198, 1199, 149, 150, 155, 185, 186, 221, 222, 904, 940, 976,
+    1012, 1048, 1084, 1085, 1090, 1120, 1121, 1126, 1156, 1157, 1158, 1162,
+    1163, 1192, 1193, 1194, 1198, 1199, 149, 150, 155, 156, 185, 186,
+    191, 982, 1012, 1018, 1048, 1054, 1084, 1085, 1090, 1120, 1121, 1126,
+    1156, 1157, 1162, 1163, 1192, 1193, 1198, 1199, 23, 121, 144, 145,
+    146, 173, 209, 245, 676, 712, 748, 784, 785, 820, 856, 892,
+    928, 964, 1000, 1036, 1072, 1108, 1144, 1180, 1216, 44, 65, 121,
+    146, 147, 179, 180, 215, 216, 251, 287, 322, 610, 646, 682,
+    718, 748, 754, 755, 784, 790, 791, 792, 826, 827, 828, 862,
+    863, 898, 899, 934, 935, 970, 971, 1006, 1007, 1042, 1043, 1078,
+    1114, 1115, 1150, 1151, 1186, 1187, 1222, 1223, 44, 65, 121, 130,
+    146, 147, 179, 180, 181, 215, 216, 251, 287, 790, 826, 827,
+    862, 863, 898, 899, 934, 935, 970, 971, 1006, 1007, 1042, 1043,
+    1078, 1079, 1114, 1115, 1150, 1151, 1152, 1186, 1187, 1188, 1222, 1223,
+    1224, 23, 65, 121, 145, 146, 147, 173, 179, 180, 209, 215,
+    216, 217, 245, 251, 252, 281, 287, 316, 748, 784, 790, 826,
+    862, 898, 934, 970, 1006, 1042, 1078, 1114, 1150, 1180, 1186, 1187,
+    1216, 1222, 1223, 44, 65, 121, 146, 147, 179, 180, 215, 216,
+    217, 245, 251, 252, 253, 281, 287, 288, 316, 322, 358, 394,
+    430, 466, 502, 538, 574, 610, 646, 682, 718, 754, 790, 791,
+    826, 862, 898, 934, 970, 1006, 1042, 1078, 1114, 1150, 1151, 1186,
+    1187, 1222, 1223, 23, 65, 121, 145, 146, 147, 173, 179, 180,
+    181, 209, 210, 215, 216, 217, 218, 245, 246, 251, 252, 253,
+    281, 287, 316, 826, 862, 898, 934, 970, 1006, 1042, 1078, 1108,
+    1114, 1115, 1144, 1150, 1151, 1180, 1186, 1187, 1188, 1216, 1222, 1223,
+    1224, 65, 121, 146, 147, 179, 180, 181, 215, 216, 217, 251,
+    252, 253, 287, 862, 898, 934, 970, 1006, 1042, 1078, 1114, 1115,
+    1150, 1151, 1186, 1187, 1188, 1222, 1223, 1224, 44, 65, 121, 146,
+    147, 179, 180, 215, 216, 251, 287, 322, 610, 646, 682, 718,
+    754, 755, 790, 791, 792, 826, 827, 862, 863, 898, 899, 934,
+    935, 970, 971, 1006, 1007, 1042, 1078, 1114, 1150, 1151, 1186, 1187,
+    1222, 1223, 130, 179, 180, 181, 934, 935, 970, 971, 1006, 1007,
+    1042, 1043, 1078, 1079, 1114, 1115, 1116, 1150, 1151, 1152, 1186, 1187,
+    1188, 1189, 1222, 1223, 1224, 1225, 65, 121, 146, 173, 179, 180,
+    209, 215, 216, 217, 245, 246, 251, 252, 253, 281, 282, 287,
+    316, 352, 388, 424, 1222, 1223, 44, 65, 121, 146, 147, 179,
+    180, 209, 215, 216, 217, 218, 245, 246, 251, 252, 253, 254,
+    281, 282, 287, 288, 289, 316, 322, 323, 352, 358, 359, 388,
+    394, 395, 424, 430, 466, 502, 538, 574, 610, 646, 682, 1150,
+    1186, 1222, 1223, 65, 121, 145, 146, 147, 173, 174, 179, 180,
+    181, 182, 209, 210, 215, 216, 217, 218, 219, 245, 246, 251,
+    252, 253, 254, 281, 282, 287, 288, 289, 316, 352, 1150, 1180,
+    1186, 1187, 1216, 1222, 1223, 1224, 121, 146, 179, 180, 181, 209,
+    215, 216, 217, 218, 245, 246, 251, 252, 253, 254, 281, 282,
+    287, 288, 289, 1150, 1186, 1187, 1222, 1223, 1224, 0, 3, 42,
+    44, 45, 57, 58, 76, 89, 90, 119, 125, 135, 136, 148,
+    682, 718, 754, 790, 791, 826, 0, 44, 45, 57, 58, 76,
+    90, 119, 125, 135, 136, 148, 1006, 1042, 1078, 1114, 1150, 1186,
+    1222, 0, 1, 3, 42, 44, 45, 55, 58, 76, 89, 90,
+    94, 119, 125, 135, 136, 147, 148, 215, 251, 252, 287, 288,
+    322, 323, 358, 394, 430, 466, 646, 682, 718, 754, 790, 1,
+    4, 42, 44, 55, 58, 65, 76, 90, 94, 104, 119, 125,
+    136, 147, 148, 179, 215, 216, 251, 252, 253, 287, 288, 289,
+    322, 323, 358, 359, 394, 395, 430, 466, 502, 538, 574, 610,
+    646, 1222, 1, 4, 7, 17, 42, 55, 76, 90, 94, 104,
+    119, 216, 251, 252, 253, 287, 288, 289, 322, 323, 324, 358,
+    359, 394, 395, 430, 466, 65, 121, 145, 146, 147, 640, 676,
+    712, 748, 749, 754, 784, 785, 790, 791, 792, 820, 826, 827,
+    856, 862, 863, 898, 899, 934, 970, 1006, 44, 65, 121, 146,
+    147, 179, 215, 251, 610, 646, 676, 682, 683, 712, 718, 719,
+    748, 749, 754, 755, 756, 784, 790, 791, 792, 826, 827, 828,
+    862, 863, 898, 899, 934, 970, 1006, 1042, 1078, 1114, 1150, 1186,
+    1222, 65, 121, 145, 146, 147, 640, 676, 712, 748, 784, 790,
+    826, 862, 898, 934, 44, 65, 121, 146, 147, 179, 215, 251,
+    287, 322, 394, 430, 466, 502, 538, 574, 610, 640, 646, 647,
+    676, 682, 683, 712, 718, 719, 748, 754, 755, 756, 784, 790,
+    791, 792, 826, 827, 862, 863, 898, 934, 970, 1006, 1042, 1078,
+    1114, 1150, 1186, 1222, 121, 146, 568, 604, 640, 676, 712, 748,
+    121, 146, 281, 316, 352, 388, 424, 460, 496, 532, 538, 568,
+    574, 604, 640, 676, 712, 44, 65, 121, 146, 147, 215, 251,
+    281, 287, 288, 316, 322, 323, 352, 358, 388, 394, 395, 424,
+    430, 431, 460, 466, 467, 496, 502, 503, 532, 538, 539, 568,
+    574, 575, 604, 610, 611, 640, 646, 647, 676, 677, 682, 683,
+    712, 718, 719, 754, 790, 65, 121, 146, 147, 245, 281, 604,
+    640, 676, 712, 748, 44, 65, 121, 146, 147, 179, 215, 216,
+    251, 252, 281, 287, 288, 322, 358, 394, 430, 466, 502, 538,
+    574, 604, 610, 640, 646, 647, 676, 682, 683, 712, 718, 719,
+    748, 754, 755, 790, 791, 826, 862, 898, 934, 970, 1006, 1042,
+    1114, 1150, 1186, 1222, 23, 65, 121, 145, 146, 147, 179, 209,
+    215, 216, 245, 251, 252, 281, 287, 288, 316, 322, 352, 358,
+    388, 394, 424, 430, 460, 466, 496, 502, 532, 538, 568, 574,
+    604, 610, 640, 646, 676, 712, 748, 1222, 0, 3, 44, 45,
+    57, 65, 136, 147, 148, 574, 610, 646, 647, 682, 683, 718,
+    719, 754, 755, 756, 757, 790, 791, 792, 826, 827, 862, 863,
+    898, 934, 970, 1006, 1042, 1114, 1150, 1186, 1222, 0, 3, 44,
+    45, 57, 63, 89, 125, 135, 136, 148, 682, 683, 718, 719,
+    754, 755, 756, 790, 791, 0, 44, 45, 65, 136, 147, 148,
+    179, 215, 251, 287, 322, 358, 394, 430, 466, 502, 538, 574,
+    610, 646, 647, 682, 683, 718, 719, 754, 755, 756, 790, 791,
+    826, 827, 862, 898, 934, 970, 1222, 0, 3, 42, 44, 45,
+    58, 63, 89, 119, 125, 135, 136, 148, 574, 610, 646, 682,
+    683, 718, 719, 754, 755, 44, 63, 147, 148, 287, 322, 358,
+    394, 430, 466, 502, 538, 574, 575, 610, 611, 646, 647, 648,
+    682, 683, 684, 718, 719, 720, 754, 755, 790, 44, 51, 148,
+    287, 288, 322, 323, 358, 359, 394, 395, 430, 431, 466, 467,
+    502, 503, 538, 539, 574, 575, 610, 611, 646, 647, 648, 682,
+    683, 684, 718, 719, 754, 3, 4, 42, 51, 55, 63, 76,
+    89, 94, 136, 148, 322, 323, 358, 359, 394, 395, 430, 431,
+    466, 467, 502, 503, 538, 539, 574, 575, 610, 611, 646, 647,
+    648, 682, 683, 684, 718, 719, 0, 3, 42, 44, 45, 65,
+    76, 89, 94, 119, 125, 136, 147, 148, 179, 215, 251, 252,
+    287, 288, 322, 358, 394, 430, 466, 502, 538, 574, 610, 611,
+    646, 647, 682, 683, 718, 719, 754, 755, 790, 791, 826, 862,
+    1186, 1222, 0, 3, 42, 44, 45, 51, 55, 58, 76, 89,
+    94, 119, 125, 135, 136, 148, 287, 322, 358, 394, 430, 466,
+    502, 538, 574, 610, 646, 647, 682, 683, 718, 719, 754, 1,
+    44, 65, 76, 94, 119, 136, 147, 148, 215, 251, 252, 287,
+    288, 322, 323, 358, 359, 394, 395, 430, 431, 466, 467, 502,
+    538, 574, 610, 611, 646, 647, 682, 683, 718, 754, 0, 1,
+    3, 4, 42, 44, 45, 51, 55, 58, 76, 89, 94, 119,
+    125, 135, 136, 147, 148, 215, 251, 252, 287, 288, 322, 323,
+    358, 359, 394, 395, 430, 431, 466, 467, 502, 503, 538, 574,
+    575, 610, 611, 646, 647, 682, 683, 718, 719, 754, 121, 146,
+    245, 281, 316, 352, 388, 424, 460, 496, 568, 604, 640, 1,
+    4, 44, 76, 94, 104, 119, 148, 215, 251, 252, 287, 288,
+    289, 322, 323, 358, 359, 394, 395, 430, 431, 466, 467, 502,
+    503, 538, 574, 610, 611, 646, 1, 4, 17, 42, 51, 55,
+    73, 76, 89, 94, 104, 119, 125, 136, 148, 251, 252, 287,
+    288, 289, 322, 323, 324, 358, 359, 394, 395, 430, 431, 466,
+    467, 502, 503, 538, 574, 610, 23, 121, 145, 146, 173, 712,
+    748, 784, 785, 820, 856, 863, 892, 898, 899, 928, 934, 935,
+    964, 970, 971, 1000, 1006, 1036, 1072, 1108, 1144, 1180, 1216, 23,
+    121, 145, 146, 173, 209, 245, 712, 748, 784, 820, 856, 964,
+    1000, 1108, 1144, 1180, 1216, 65, 121, 145, 146, 147, 179, 180,
+    748, 784, 790, 820, 826, 862, 898, 934, 970, 1006, 1042, 1078,
+    1114, 1150, 1186, 1187, 1222, 1223, 44, 57, 65, 147, 148, 179,
+    682, 718, 754, 755, 790, 791, 792, 826, 827, 862, 863, 898,
+    934, 935, 970, 971, 1006, 1007, 1042, 1078, 1114, 1150, 1151, 1186,
+    1187, 1222, 44, 57, 65, 147, 148, 179, 180, 215, 216, 251,
+    287, 322, 610, 646, 682, 718, 754, 755, 790, 791, 826, 827,
+    862, 898, 934, 970, 1006, 1042, 1078, 1114, 1150, 1151, 1186, 1187,
+    1222, 1223, 130, 935, 971, 1000, 1007, 1036, 1042, 1043, 1072, 1078,
+    1079, 1108, 1114, 1115, 1116, 1144, 1151, 1152, 1180, 1187, 1188, 1189,
+    1216, 1223, 1224, 130, 173, 179, 180, 181, 209, 970, 971, 1000,
+    1006, 1007, 1036, 1042, 1043, 1072, 1078, 1079, 1108, 1114, 1115, 1116,
+    1144, 1150, 1151, 1152, 1180, 1181, 1186, 1187, 1188, 1189, 1216, 1217,
+    1222, 1223, 1224, 1225, 0, 44, 45, 57, 58, 65, 136, 147,
+    148, 179, 215, 646, 682, 718, 754, 755, 790, 791, 792, 826,
+    827, 862, 863, 898, 934, 970, 1006, 1042, 1078, 1114, 1150, 1186,
+    1222, 0, 44, 45, 57, 58, 65, 90, 119, 125, 136, 147,
+    148, 179, 215, 251, 287, 322, 358, 394, 574, 610, 646, 682,
+    718, 754, 755, 790, 791, 826, 827, 862, 898, 934, 970, 1006,
+    1042, 1078, 1114, 1150, 1186, 1222, 0, 44, 45, 57, 58, 65,
+    125, 136, 147, 148, 179, 215, 251, 754, 790, 826, 827, 862,
+    863, 898, 934, 935, 970, 971, 1006, 1007, 1042, 1043, 1078, 1079,
+    1114, 1115, 1150, 1151, 1186, 1187, 1222, 1223, 0, 44, 45, 57,
+    58, 65, 76, 90, 119, 125, 136, 147, 148, 179, 180, 215,
+    216, 251, 252, 287, 322, 754, 790, 826, 827, 862, 898, 934,
+    970, 1006, 1042, 1043, 1078, 1079, 1114, 1115, 1150, 1151, 1186, 1187,
+    1222, 1223, 0, 44, 45, 58, 65, 76, 90, 119, 125, 136,
+    147, 148, 179, 215, 216, 251, 252, 287, 322, 358, 394, 430,
+    466, 502, 574, 610, 646, 682, 718, 754, 790, 826, 862, 1006,
+    1042, 1078, 1114, 1150, 1186, 1222, 1, 42, 44, 58, 65, 76,
+    90, 94, 119, 125, 136, 147, 148, 179, 180, 215, 216, 251,
+    252, 253, 287, 288, 322, 323, 358, 394, 430, 466, 502, 538,
+    574, 610, 646, 682, 718, 754, 790, 826, 1114, 1150, 1186, 1222,
+    1223, 65, 121, 146, 147, 322, 358, 394, 430, 460, 466, 496,
+    502, 532, 538, 568, 574, 575, 604, 610, 611, 640, 646, 647,
+    676, 677, 682, 683, 712, 713, 718, 719, 748, 754, 755, 790,
+    791, 44, 65, 121, 146, 147, 251, 287, 322, 358, 394, 430,
+    466, 502, 538, 568, 574, 575, 604, 610, 611, 640, 646, 647,
+    676, 682, 683, 712, 718, 719, 748, 754, 755, 790, 791, 826,
+    862, 44, 65, 121, 146, 147, 179, 215, 251, 252, 281, 287,
+    288, 316, 322, 323, 352, 358, 388, 394, 424, 430, 431, 460,
+    466, 467, 496, 502, 538, 568, 574, 604, 610, 611, 640, 646,
+    647, 676, 682, 683, 712, 718, 754, 790, 826, 1222, 44, 65,
+    121, 146, 147, 179, 215, 216, 245, 251, 252, 281, 287, 288,
+    316, 322, 323, 352, 358, 388, 394, 424, 430, 466, 502, 538,
+    574, 610, 646, 682, 718, 754, 790, 826, 1150, 1186, 1222, 0,
+    3, 51, 55, 63, 89, 136, 148, 358, 394, 430, 466, 502,
+    503, 538, 539, 574, 575, 610, 611, 646, 647, 648, 682, 683,
+    684, 718, 719, 720, 754, 755, 0, 3, 42, 44, 45, 51,
+    55, 63, 76, 89, 94, 119, 125, 135, 136, 148, 322, 358,
+    394, 430, 466, 502, 538, 574, 575, 610, 611, 646, 647, 682,
+    683, 684, 718, 719, 720, 754, 755, 65, 121, 146, 147, 215,
+    251, 252, 281, 287, 288, 289, 316, 322, 323, 352, 358, 359,
+    388, 394, 395, 424, 430, 431, 460, 466, 467, 496, 502, 503,
+    538, 568, 574, 575, 604, 610, 611, 640, 646, 682, 44, 65,
+    121, 146, 147, 179, 215, 216, 245, 251, 252, 253, 281, 282,
+    287, 288, 289, 316, 322, 323, 352, 358, 359, 388, 394, 395,
+    424, 430, 431, 460, 466, 502, 538, 574, 610, 646, 682, 1222,
+    65, 121, 145, 146, 147, 748, 784, 790, 791, 820, 826, 827,
+    856, 862, 863, 898, 899, 934, 935, 970, 1006, 1042, 1078, 1114,
+    1150, 1186, 1222, 23, 65, 121, 145, 146, 147, 179, 748, 784,
+    790, 820, 826, 827, 856, 862, 863, 898, 899, 928, 934, 935,
+    964, 970, 971, 1000, 1006, 1007, 1036, 1042, 1043, 1078, 1108, 1114,
+    1115, 1144, 1150, 1151, 1180, 1186, 1187, 1216, 1222, 1223, 65, 121,
+    130, 145, 146, 147, 173, 179, 180, 215, 784, 820, 826, 827,
+    856, 862, 863, 892, 898, 899, 928, 934, 935, 964, 970, 971,
+    1000, 1006, 1007, 1036, 1042, 1043, 1072, 1078, 1079, 1108, 1114, 1115,
+    1144, 1150, 1151, 1180, 1186, 1187, 1216, 1222, 1223, 130, 179, 180,
+    863, 898, 899, 928, 934, 935, 964, 970, 971, 1000, 1006, 1007,
+    1036, 1042, 1043, 1072, 1078, 1079, 1108, 1114, 1115, 1144, 1150, 1151,
+    1152, 1180, 1186, 1187, 1188, 1216, 1222, 1223, 1224, 23, 65, 121,
+    130, 145, 146, 147, 173, 179, 180, 209, 215, 216, 245, 251,
+    820, 826, 862, 863, 898, 899, 934, 935, 970, 971, 1000, 1006,
+    1007, 1036, 1042, 1043, 1072, 1078, 1079, 1108, 1114, 1115, 1144, 1150,
+    1151, 1180, 1186, 1187, 1216, 1222, 1223, 1224, 121, 130, 146, 173,
+    179, 180, 181, 209, 216, 898, 934, 970, 971, 1006, 1007, 1036,
+    1042, 1043, 1072, 1078, 1079, 1108, 1114, 1115, 1144, 1150, 1151, 1180,
+    1186, 1187, 1188, 1216, 1222, 1223, 1224,
+};
+
+} // namespace PaletteData
+
+#endif
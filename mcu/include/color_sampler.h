@@ -4,24 +4,90 @@
 #include <Arduino.h>
 #include "color_sensor.h"
 
-class ColorSampler
+struct SamplerStats
 {
-private:
-  long totalRed;
-  long totalGreen;
-  long totalBlue;
-  int sampleCount;
-  bool sampling;
+  int accepted;
+  int rejected;       // Outliers and sensor timeouts
+  float stdDev[3];    // Standard deviation per RGB channel (window)
+  float ciHalfWidth;  // Widest 95% confidence half-width (RGB counts)
+};
 
+// Accumulates single samples into a robust average. Accepted samples go
+// into a bounded window; the average is its trimmed mean and the
+// confidence interval is that of the trimmed mean (Yuen), so both describe
+// the same samples. Once the window holds a few samples, readings far from
+// its median (in MADs) are rejected.
+class ColorSampler
+{
 public:
+  static const int WINDOW_SIZE = 16;
+  static const int MIN_SAMPLES_FOR_REJECTION = 5;
+  static const int TRIM_DIVISOR = 4;              // Trim 1/4 from each end
+  static constexpr float OUTLIER_MADS = 3.5f;     // Rejection threshold
+  static constexpr float MIN_MAD = 2.0f;          // Floor for flat windows
+  static constexpr float CONFIDENCE_TARGET = 3.0f; // CI half-width (counts)
+  // A t-interval from fewer samples is too easily fooled by a few equal
+  // readings; this also keeps one trimmed from each end
+  static const int MIN_CONFIDENT_SAMPLES = 5;
+
   ColorSampler();
-  void addSample(const RGBColor &color);
+
+  // Returns false when the sample was rejected
+  bool addSample(const RGBColor &color, const RawFrequencies &raw);
   RGBColor getAverage();
+  RawFrequencies getAverageRaw();
   int getSampleCount();
+  int getRejectedCount();
+  SamplerStats getStats();
+  float getConfidenceHalfWidth();
+  bool isConfident();
+  void setConfidenceTarget(float halfWidth);
+  float getConfidenceTarget();
   bool isSampling();
   void reset();
   void printSample(const RGBColor &color);
   void printAverage(const RGBColor &avgColor, const String &colorName);
+
+private:
+  struct Entry
+  {
+    RGBColor color;
+    RawFrequencies raw;
+  };
+
+  Entry window[WINDOW_SIZE];
+  int windowHead;
+  int windowCount;
+  int sampleCount;
+  int rejectedCount;
+  float confidenceTarget;
+  bool sampling;
+
+  bool isOutlier(const RGBColor &color);
+  int collect(int channel, float *values); // Channels 0-2 RGB, 3-5 raw
+  float trimmedMean(int channel);
+  float variance(int channel, bool winsorized);
+};
+
+// Fixed-window moving average used while streaming
+class RollingAverage
+{
+public:
+  static const int WINDOW_SIZE = 16;
+
+  RollingAverage();
+  void add(const RGBColor &color);
+  RGBColor getAverage();
+  int getCount();
+  void reset();
+
+private:
+  RGBColor window[WINDOW_SIZE];
+  long totalRed;
+  long totalGreen;
+  long totalBlue;
+  int head;
+  int count;
 };
 
 #endif
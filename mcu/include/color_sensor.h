@@ -1,7 +1,11 @@
 #ifndef COLOR_SENSOR_H
 #define COLOR_SENSOR_H
 
+#include "calibration.h"
+#include "frequency_capture.h"
+#include "latest_mailbox.h"
 #include <Arduino.h>
+#include <atomic>
 
 struct RGBColor {
   int red;
@@ -9,30 +13,145 @@ struct RGBColor {
   int blue;
 };
 
+// Raw per-channel readings: average OUT half-period in microseconds, at
+// 20% output scaling whatever range the channel was read in
+struct RawFrequencies {
+  unsigned long red;
+  unsigned long green;
+  unsigned long blue;
+};
+
+// TCS3200 output frequency scaling (S0/S1)
+enum OutputScaling : uint8_t {
+  SCALING_2,  // S0 L, S1 H
+  SCALING_20, // S0 H, S1 L; calibration profiles are in this range
+  SCALING_100 // S0 H, S1 H
+};
+
+// Photodiode group selected for a capture (S2/S3)
+enum SensorFilter : uint8_t {
+  FILTER_RED,
+  FILTER_GREEN,
+  FILTER_BLUE,
+  FILTER_CLEAR // No filter; tracks ambient light
+};
+
+// One gated capture of a reading
+struct CaptureStep {
+  SensorFilter filter;
+  OutputScaling scaling;
+  bool ambient; // LED switched off: ambient light only
+  uint32_t gateUs;
+};
+
+// Capture settings of a reading. The setters below may run on another task
+// than the readings, so a reading uses the settings published before it
+// started and keeps them to its end.
+struct SensorSettings {
+  uint32_t settleUs;
+  uint32_t gateUs;
+  bool autoRange;
+  OutputScaling scaling;
+  bool ambientMode;
+  uint8_t ambientResets; // Bumped by setAmbientMode; forces a refresh
+};
+
+// Called (outside the loop task) with every gate result of a reading; last
+// is set on the reading's final capture
+typedef void (*CaptureObserver)(void *context, const CaptureStep &step,
+                                const CaptureResult &result, bool last);
+
 class ColorSensor {
 public:
-  // Calibration values (adjust based on your sensor)
-  static const int WHITE_RED_FREQ = 26;
-  static const int WHITE_GREEN_FREQ = 24;
-  static const int WHITE_BLUE_FREQ = 30;
-  static const int BLACK_RED_FREQ = 155;
-  static const int BLACK_GREEN_FREQ = 166;
-  static const int BLACK_BLUE_FREQ = 197;
+  // Capture timing per channel (microseconds)
+  static const uint32_t SETTLE_TIME_US = 2000;
+  static const uint32_t GATE_TIME_US = 10000;
+
+  // Auto-ranging limits: shortest gate a channel is given, and the fastest
+  // edge rate the capture counts reliably (8x the PCNT glitch filter)
+  static const uint32_t MIN_GATE_TIME_US = 1000;
+  static const uint32_t MAX_EDGE_RATE = 1000000;
+
+  // Ambient mode: the clear channel is read with the LED off every reading;
+  // all channels every AMBIENT_REFRESH_READINGS or when the clear reading
+  // moves by more than 1/AMBIENT_CHANGE_DIVISOR. Each ambient capture gets
+  // 1/AMBIENT_GATE_DIVISOR of the gate budget.
+  static const uint8_t MAX_STEPS = 7;
+  static const uint8_t AMBIENT_REFRESH_READINGS = 16;
+  static const uint8_t AMBIENT_CHANGE_DIVISOR = 4;
+  static const uint8_t AMBIENT_GATE_DIVISOR = 8;
 
   ColorSensor(uint8_t s0, uint8_t s1, uint8_t s2, uint8_t s3, uint8_t out,
-              uint8_t led);
+              uint8_t led, FrequencyCapture &capture);
 
   void begin();
 
+  // Calibration (rebuilds the mapping tables; safe while readings run)
+  bool setCalibration(const CalibrationProfile &profile);
+
   // LED Control
   void ensureLedOn();
   void toggleLed();
   void setLed(bool on);
   bool isLedOn();
 
-  // Color Reading
+  // Color Reading (non-blocking)
+  bool startReading();
+  bool isReading();
+  bool takeReading(RGBColor &color);
+  // Gives up on the reading in flight (its capture never completed, or a
+  // step could not start): stops the capture, puts the LED back and lets
+  // the next startReading() through
+  void abortReading();
+  RawFrequencies getLastRaw() { return lastRaw; }
+
+  // Settings apply from the next startReading(); the getters return the
+  // latest ones set
+  void setCaptureTiming(uint32_t settleUs, uint32_t gateUs);
+  uint32_t getSettleTimeUs() { return requested.settleUs; }
+  uint32_t getGateTimeUs() { return requested.gateUs; }
+
+  // Auto-ranging (on by default) plans each reading from the previous one:
+  // every channel gets the highest scaling it can be counted at, and the
+  // reading's gate budget (3 x the gate time) is split in proportion to
+  // the expected half-periods, so dark and bright channels count about as
+  // many edges. Off, all channels use the fixed scaling and gate time.
+  void setAutoRange(bool enabled);
+  bool isAutoRange() { return requested.autoRange; }
+  void setScaling(OutputScaling scaling);
+  OutputScaling getScaling() { return requested.scaling; }
+
+  // Ambient-compensated readings (off by default): LED-off captures run
+  // before the LED-on R/G/B ones and their light is subtracted per channel
+  // (as frequency, where light adds up). Between full refreshes the
+  // per-channel ambient is scaled by the LED-off clear reading. Calibrate
+  // in the mode you measure in.
+  void setAmbientMode(bool enabled);
+  bool isAmbientMode() { return requested.ambientMode; }
+
+  // Longest a reading can spend settling and gating with this timing: all
+  // LED-off steps of an ambient refresh, and auto-range gates after the
+  // MIN_GATE_TIME_US clamp
+  static uint32_t maxReadingUs(uint32_t settleUs, uint32_t gateUs,
+                               bool autoRange, bool ambient);
+
+  // Replaces the plan of the next reading (trace replay). Needs one non
+  // ambient capture per color filter.
+  bool setNextPlan(const CaptureStep *steps, uint8_t count);
+
+  // Called (outside the loop task) when a started reading completes
+  void onReadingReady(void (*callback)(void *), void *context);
+
+  // Raw capture tap (trace recording); one observer at a time
+  void onCapture(CaptureObserver observer, void *context);
+
+  // Color Reading (blocking, waits for a full R/G/B capture)
   RGBColor readColor();
+
+  // Color naming (nearest palette color in CIELAB, see color_naming.h)
+  uint16_t detectColorId(const RGBColor &color);
   String detectColorName(const RGBColor &color);
+  static const char *colorNameFor(uint16_t id);
   void printColorData(const RGBColor &color, const String &colorName);
 
 private:
@@ -40,9 +159,65 @@ private:
   uint8_t outPin;
   uint8_t ledPin;
 
-  int redFreq, greenFreq, blueFreq;
+  FrequencyCapture &capture;
+
+  // Settings as set (caller side) and handed to the next reading
+  SensorSettings requested;
+  LatestMailbox<SensorSettings> pendingSettings;
+
+  // Settings and plan of the reading in progress (taken by startReading())
+  uint32_t settleTimeUs;
+  uint32_t gateTimeUs;
+  bool autoRange;
+  OutputScaling fixedScaling;
+  uint8_t ambientResets;
+  CaptureStep plan[MAX_STEPS];
+  uint8_t planSize;
+  bool nextPlanSet;
+  CaptureStep nextPlan[MAX_STEPS];
+  uint8_t nextPlanSize;
+
+  // LED state as set by the caller; ambient captures switch the pin off
+  volatile bool ledOn;
+  volatile bool ambientCapture;
+
+  // Ambient light per filter (R, G, B, clear) in mHz at 20% scaling, from
+  // the last full refresh, and the latest clear reading
+  bool ambientMode;
+  bool ambientValid;
+  uint8_t readingsSinceRefresh;
+  uint32_t ambientMhz[4];
+  uint32_t ambientClearMhz;
+
+  // Capture sequence state (advanced from the capture callback)
+  volatile uint8_t stepIndex;
+  unsigned long readingStartUs;
+  CaptureResult results[MAX_STEPS];
+  unsigned long periods[3];
+  std::atomic<bool> reading;
+  std::atomic<bool> readingReady;
+  RawFrequencies lastRaw;
+  void (*readyCallback)(void *);
+  void *readyContext;
+  CaptureObserver captureObserver;
+  void *captureContext;
+
+  // Double-buffered so a profile switch never tears a reading in progress
+  CalibrationTable tables[2];
+  std::atomic<uint8_t> activeTable;
+
+  void publishSettings();
+  void applySettings();
+  void planReading();
+  void planGates(uint32_t onBudget);
+  bool needsAmbientRefresh();
+  void setScalingPins(OutputScaling scaling);
+  void selectStep(const CaptureStep &step);
+  bool startStep(uint8_t index);
+  void finishReading();
+  RGBColor toRGB(const RawFrequencies &raw);
 
-  unsigned long readFrequency(bool s2State, bool s3State);
+  static void onCaptureComplete(void *context, const CaptureResult &result);
 };
 
 #endif
@@ -0,0 +1,50 @@
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include "ble_service.h"
+#include "device_config.h"
+#include "spsc_ring_buffer.h"
+#include <Arduino.h>
+#include <Preferences.h>
+
+// A config write, decoded and validated on the BLE stack's task
+struct ConfigUpdate {
+  uint16_t connId; // Client that wrote it
+  uint8_t status;  // ConfigStatus
+  uint8_t field;
+  DeviceConfig config;
+};
+
+// Device settings persisted in NVS (Preferences) and exposed on the config
+// characteristic. Client writes are queued to the loop, which applies them
+// between two iterations (takeUpdate()), saves them and publishes the
+// result; nothing restarts.
+class ConfigStore {
+public:
+  static const size_t QUEUE_SIZE = 4;
+
+  explicit ConfigStore(Bluetooth &bluetooth);
+
+  // Opens the namespace and accepts writes from then on
+  void begin();
+
+  // Stored settings; false (config untouched) if none or unusable
+  bool load(DeviceConfig &config);
+  bool save(const DeviceConfig &config);
+
+  // Loop side
+  bool takeUpdate(ConfigUpdate &update);
+  // Sets what a READ returns and notifies subscribed clients
+  void publish(const DeviceConfig &config, uint8_t status, uint8_t field);
+
+private:
+  Bluetooth &ble;
+  Preferences prefs;
+  bool ready;
+  SpscRingBuffer<ConfigUpdate, QUEUE_SIZE> updates;
+
+  static void onWrite(void *context, uint16_t connId, const uint8_t *data,
+                      size_t length);
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef DEVICE_CONFIG_H
+#define DEVICE_CONFIG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tunable settings, written by a client on the config characteristic and
+// kept in NVS (little-endian):
+//
+//   0  u8  version
+//   1  u8  status          result of the last write (CONFIG_*), 0 on writes
+//   2  u8  field           offset of the rejected field, 0 if none
+//   3  u8  flags           CONFIG_FLAG_*
+//   4  u16 longPressMs     hold to finalize
+//   6  u16 ledToggleMs     hold to toggle the LED, above longPressMs
+//   8  u32 autoOffMs       idle time before the LED goes off, 0 = never
+//   12 u8  minSamples      samples before a manual finalize; a value
+//                          above ColorSampler::MIN_CONFIDENT_SAMPLES is
+//                          waived once the confidence target is met
+//   13 u8  streamRateHz
+//   14 u16 settleUs        capture timing of tap readings
+//   16 u16 gateUs
+//   18 u16 streamSettleUs  capture timing while streaming
+//   20 u16 streamGateUs
+//   22 u8  scaling         OutputScaling used when auto-range is off
+//   23 u16 ciTargetTenths  95% CI half-width (counts x 10) for confidence
+//
+// A client reads the characteristic, changes fields and writes all of it
+// back. The write is decoded and checked as a whole; a rejected one changes
+// nothing. Reading and writing need an MTU of at least 28.
+
+static const uint8_t CONFIG_VERSION = 1;
+static const size_t CONFIG_SIZE = 25;
+
+enum ConfigFlags : uint8_t {
+  CONFIG_FLAG_AUTO_FINALIZE = 0x01, // Finalize once the CI is tight
+  CONFIG_FLAG_AUTO_RANGE = 0x02,    // ColorSensor::setAutoRange
+  CONFIG_FLAG_AMBIENT = 0x04,       // ColorSensor::setAmbientMode
+  CONFIG_FLAG_BOOT_SCREENS = 0x08   // Full splash + welcome at boot
+};
+
+enum ConfigStatus : uint8_t {
+  CONFIG_OK,
+  CONFIG_BAD_VERSION,
+  CONFIG_BAD_LENGTH,
+  CONFIG_BAD_VALUE,  // field holds the offset of the first bad one
+  CONFIG_NOT_SAVED   // Applied, but the NVS write failed
+};
+
+struct DeviceConfig {
+  uint8_t flags;
+  uint16_t longPressMs;
+  uint16_t ledToggleMs;
+  uint32_t autoOffMs;
+  uint8_t minSamples;
+  uint8_t streamRateHz;
+  uint16_t settleUs;
+  uint16_t gateUs;
+  uint16_t streamSettleUs;
+  uint16_t streamGateUs;
+  uint8_t scaling;
+  uint16_t ciTargetTenths;
+};
+
+void encodeConfig(const DeviceConfig &config, uint8_t status, uint8_t field,
+                  uint8_t *out);
+
+// Decodes and validates a written config. On CONFIG_BAD_VALUE, field is the
+// offset of the first field out of range (or inconsistent with another).
+ConfigStatus decodeConfig(const uint8_t *in, size_t length,
+                          DeviceConfig &config, uint8_t &field);
+
+// 0 if every field is usable, otherwise the offset of the first bad one
+uint8_t validateConfig(const DeviceConfig &config);
+
+#endif
@@ -1,32 +1,119 @@
 #ifndef DISPLAY_H
 #define DISPLAY_H
 
+#include "latest_mailbox.h"
 #include <Adafruit_SSD1306.h>
 #include <Arduino.h>
 
-class Display {
-private:
-  Adafruit_SSD1306 oled;
-  uint8_t sdaPin;
-  uint8_t sclPin;
-  uint8_t screenWidth;
-  uint8_t screenHeight;
-  int8_t resetPin;
-  uint8_t i2cAddress;
-
-  void prepareDisplay();
+// Panel traffic since begin()
+struct DisplayStats {
+  uint32_t submitted;  // Frames handed to the flush task
+  uint32_t unchanged;  // Frames identical to the previous one (not handed)
+  uint32_t superseded; // Frames replaced by a newer one before being sent
+  uint32_t flushes;    // Frames sent to the panel
+  uint32_t pagesSent;
+  uint32_t bytesSent;  // On the bus, address and control bytes included
+  uint32_t i2cUs;      // Time spent in transfers
+  uint32_t maxFlushUs;
+  uint32_t latencyUs;  // present() to the end of the transfer, last frame
+  uint32_t maxLatencyUs;
+};
 
+// Screens are composed in the driver's buffer; present() copies the frame
+// into a LatestMailbox and wakes a flush task, so the loop never waits on
+// I2C. The policy is latest frame wins: a frame not yet taken when a newer
+// one is presented is dropped (counted as superseded), never queued.
+//
+// The flush task sends at most one frame per MIN_FRAME_INTERVAL_MS. Of each
+// frame it only writes the column range that changed in each 8-row page,
+// diffed against a shadow of the panel content.
+//
+// Host-native builds have no FreeRTOS: poll() does the task's work at the
+// current (simulated) time.
+class Display {
 public:
+  static const size_t MAX_FRAME_SIZE = 128 * 64 / 8;
+  static const uint32_t I2C_CLOCK_HZ = 400000; // Fast mode
+  static const unsigned long MIN_FRAME_INTERVAL_MS = 50;
+  static const size_t I2C_CHUNK_SIZE = 128; // ESP32 Wire buffer
+  // Boot screens shown in full (CONFIG_FLAG_BOOT_SCREENS); otherwise the
+  // splash stays only while setup() runs and the welcome is skipped
+  static const unsigned long SPLASH_DURATION_MS = 2500;
+  static const unsigned long WELCOME_DURATION_MS = 1500;
+#ifdef ESP_PLATFORM
+  static const uint32_t STACK_SIZE = 3072;
+  static const UBaseType_t PRIORITY = 1;
+  static const BaseType_t CORE = 0; // Away from loop() and acquisition
+#endif
+
   Display(uint8_t width, uint8_t height, uint8_t sda, uint8_t scl,
           uint8_t address = 0x3C, int8_t reset = -1);
   bool begin();
+  DisplayStats getStats() const;
+
+#ifndef ESP_PLATFORM
+  void poll();
+#endif
+
   void showSplash();
   void showWelcome();
   void showColorData(int red, int green, int blue, const String &colorName);
   void showSamplingMode(int sampleCount, int red, int green, int blue,
                         const String &colorName);
+  void showStreaming(int samplesPerSec, unsigned long dropped, int red,
+                     int green, int blue, const String &colorName);
   void showProgress(int percentage);
   void showMessage(const String &line1, const String &line2 = "");
+
+private:
+  struct Frame {
+    uint8_t pixels[MAX_FRAME_SIZE];
+    uint32_t presentedUs;
+  };
+
+  Adafruit_SSD1306 oled;
+  uint8_t sdaPin;
+  uint8_t sclPin;
+  uint8_t screenWidth;
+  uint8_t screenHeight;
+  int8_t resetPin;
+  uint8_t i2cAddress;
+  size_t frameSize;
+
+  // Loop side: the last frame handed over
+  uint8_t presented[MAX_FRAME_SIZE];
+  bool presentedValid;
+  LatestMailbox<Frame> mailbox;
+
+  // Flush side: what the panel shows, page-ordered like the driver's buffer
+  uint8_t shadow[MAX_FRAME_SIZE];
+  bool shadowValid;
+  unsigned long lastFlushMs;
+
+  // Each counter has a single writer (loop or flush side)
+  volatile uint32_t submitted;
+  volatile uint32_t unchanged;
+  volatile uint32_t superseded;
+  volatile uint32_t flushes;
+  volatile uint32_t pagesSent;
+  volatile uint32_t bytesSent;
+  volatile uint32_t i2cUs;
+  volatile uint32_t maxFlushUs;
+  volatile uint32_t latencyUs;
+  volatile uint32_t maxLatencyUs;
+
+#ifdef ESP_PLATFORM
+  TaskHandle_t task;
+
+  void run();
+  static void taskEntry(void *arg);
+#endif
+
+  void prepareDisplay();
+  void present();
+  void flush(const Frame &frame);
+  bool sendPage(uint8_t page, uint8_t first, uint8_t last,
+                const uint8_t *data);
 };
 
 #endif
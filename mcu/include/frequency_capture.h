@@ -0,0 +1,123 @@
+#ifndef FREQUENCY_CAPTURE_H
+#define FREQUENCY_CAPTURE_H
+
+#include <atomic>
+#include <stdint.h>
+
+// Result of one gated edge count on the TCS3200 OUT pin.
+// Both rising and falling edges are counted, so one edge = one half-period.
+struct CaptureResult {
+  uint32_t edges;  // Edges counted while the gate was open
+  uint32_t gateUs; // Measured gate length (microseconds)
+};
+
+typedef void (*CaptureCallback)(void *context, const CaptureResult &result);
+
+// Asynchronous edge counter. A capture waits settleUs (filter switching),
+// counts edges for gateUs and then completes without blocking the caller.
+// Completion is reported through the callback (which may run outside the
+// loop task) and can also be polled.
+class FrequencyCapture {
+public:
+  FrequencyCapture()
+      : callback(nullptr), callbackContext(nullptr), busy(false),
+        ready(false), lastResult({0, 0}) {}
+  virtual ~FrequencyCapture() {}
+
+  virtual bool begin(uint8_t pin) = 0;
+
+  // Returns false if a capture is already in flight
+  virtual bool start(uint32_t settleUs, uint32_t gateUs) = 0;
+
+  // Stops the capture in flight, if any, without completing it: the
+  // callback does not run for it and the next start() is accepted
+  virtual void abort() = 0;
+
+  bool isBusy() const { return busy.load(std::memory_order_acquire); }
+
+  // Returns true once per completed capture
+  bool poll(CaptureResult &result) {
+    if (!ready.exchange(false, std::memory_order_acquire))
+      return false;
+    result = lastResult;
+    return true;
+  }
+
+  void onComplete(CaptureCallback cb, void *context) {
+    callback = cb;
+    callbackContext = context;
+  }
+
+protected:
+  // Called by backends when the gate closes
+  void complete(const CaptureResult &result) {
+    lastResult = result;
+    ready.store(true, std::memory_order_release);
+    busy.store(false, std::memory_order_release);
+    if (callback) {
+      callback(callbackContext, result);
+    }
+  }
+
+  // Called by backends from abort() once the gate is stopped
+  void cancel() {
+    ready.store(false, std::memory_order_release);
+    busy.store(false, std::memory_order_release);
+  }
+
+  CaptureCallback callback;
+  void *callbackContext;
+  std::atomic<bool> busy;
+
+private:
+  std::atomic<bool> ready;
+  CaptureResult lastResult;
+};
+
+// ============================================================================
+// Gate / Count Math
+// ============================================================================
+
+namespace CaptureMath {
+
+// Results that do not fit in 32 bits (gates of over an hour, scalings far
+// above 1) are clamped rather than wrapped
+inline uint32_t saturate(uint64_t value) {
+  return value > UINT32_MAX ? UINT32_MAX : (uint32_t)value;
+}
+
+// Average half-period in microseconds, i.e. the value pulseIn() used to
+// return. 0 means no edges were seen (sensor timeout).
+inline uint32_t halfPeriodUs(const CaptureResult &result) {
+  if (result.edges == 0)
+    return 0;
+  return (uint32_t)(((uint64_t)result.gateUs + result.edges / 2) /
+                    result.edges);
+}
+
+// Half-period rescaled by num / den (rounded), e.g. to another output
+// frequency scaling. 0 means no edges were seen.
+inline uint32_t scaledHalfPeriodUs(const CaptureResult &result, uint32_t num,
+                                   uint32_t den) {
+  if (result.edges == 0)
+    return 0;
+  uint64_t divisor = (uint64_t)result.edges * den;
+  return saturate(((uint64_t)result.gateUs * num + divisor / 2) / divisor);
+}
+
+// Output frequency of the sensor in Hz
+inline uint32_t frequencyHz(const CaptureResult &result) {
+  if (result.gateUs == 0)
+    return 0;
+  return saturate(((uint64_t)result.edges * 500000ULL + result.gateUs / 2) /
+                  result.gateUs);
+}
+
+// Shortest gate that still sees minEdges at the given half-period
+inline uint32_t gateForEdges(uint32_t halfPeriodUs, uint32_t minEdges) {
+  return saturate((uint64_t)halfPeriodUs * minEdges);
+}
+
+} // namespace CaptureMath
+
+#endif
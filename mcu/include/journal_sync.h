@@ -0,0 +1,180 @@
+#ifndef JOURNAL_SYNC_H
+#define JOURNAL_SYNC_H
+
+#include "ble_packet.h"
+#include "ble_service.h"
+#include "measurement_journal.h"
+#include "spsc_ring_buffer.h"
+#include <Arduino.h>
+
+// Bulk transfer of journaled measurements on SYNC_CHARACTERISTIC_UUID
+// (little-endian). The client writes requests, the device notifies.
+//
+// Client -> device:
+//   01 START  u32 from (0 = resume point), u32 to (0 = newest),
+//             u8 window (packets in flight, 0 = SYNC_DEFAULT_WINDOW)
+//   02 ACK    u32 next    every record before next has arrived
+//   03 NACK   u32 next    as ACK, and resend from next (a packet is missing)
+//   04 STOP
+//   05 INFO
+//
+// Device -> client:
+//   81 DATA   u8 packet (0 after START and every go-back, then counts
+//             up), u8 count, count x MEASUREMENT_RECORD_SIZE records
+//             (encodeMeasurement)
+//   82 END    u32 next    no records in range from next on
+//   83 INFO   u32 oldest, u32 last, u32 resume point, u16 boot
+//   84 REJECT u8 status   START not served (SYNC_STATUS_*)
+//
+// Records come in sequence order; sequences missing in between were lost
+// on the device (ring wrapped, torn slot). A gap in the packet counter
+// means a lost notification: the client answers with NACK and ignores
+// DATA until a packet 0 (the resend) arrives. The device
+// keeps at most `window` DATA packets unacknowledged and goes back to the
+// last ACK when none arrives within SYNC_ACK_TIMEOUT_MS. The client ACKs
+// every few packets (half the window keeps the pipe full) and after END.
+//
+// DATA carries as many records as the MTU allows (8 at 247). Below
+// SYNC_MIN_MTU not one fits: START is answered with REJECT
+// (SYNC_STATUS_MTU), and the client negotiates a larger MTU and starts
+// again.
+//
+// Notifications need the client's CCCD enabled on this characteristic: a
+// START without it is ignored, and disabling it pauses the transfer. A DATA
+// or END the stack refuses is not counted as sent; it is tried again every
+// SYNC_LINK_POLL_MS, and refusals lasting SYNC_ACK_TIMEOUT_MS pause the
+// transfer. A paused transfer keeps its resume point.
+//
+// The resume point is the last ACK, kept across disconnects until reboot:
+// START with from = 0 continues an interrupted transfer.
+//
+// One client is served at a time; a START from another client while a
+// transfer runs is ignored. DATA only goes out while the controller keeps
+// BLE_BULK_RESERVE buffers free for result notifications.
+static const uint8_t SYNC_CMD_START = 0x01;
+static const uint8_t SYNC_CMD_ACK = 0x02;
+static const uint8_t SYNC_CMD_NACK = 0x03;
+static const uint8_t SYNC_CMD_STOP = 0x04;
+static const uint8_t SYNC_CMD_INFO = 0x05;
+static const uint8_t SYNC_DATA = 0x81;
+static const uint8_t SYNC_END = 0x82;
+static const uint8_t SYNC_INFO = 0x83;
+static const uint8_t SYNC_REJECT = 0x84;
+
+// REJECT status
+static const uint8_t SYNC_STATUS_MTU = 0x01; // Negotiate SYNC_MIN_MTU
+
+static const size_t SYNC_DATA_HEADER_SIZE = 3;
+static const size_t SYNC_MAX_PACKET_RECORDS =
+    (BLE_MAX_PACKET_SIZE - SYNC_DATA_HEADER_SIZE) / MEASUREMENT_RECORD_SIZE;
+static const uint16_t SYNC_MIN_MTU =
+    BLE_ATT_OVERHEAD + SYNC_DATA_HEADER_SIZE + MEASUREMENT_RECORD_SIZE;
+static const uint8_t SYNC_DEFAULT_WINDOW = 8;
+static const uint8_t SYNC_MAX_WINDOW = 16;
+static const unsigned long SYNC_ACK_TIMEOUT_MS = 500;
+static const unsigned long SYNC_LINK_POLL_MS = 2; // Controller buffers full
+
+// Since begin()
+struct SyncStats {
+  uint32_t transfers;   // Completed (END acknowledged)
+  uint32_t records;     // Records sent, resends included
+  uint32_t packets;     // DATA notifications
+  uint32_t rewinds;     // Go-backs on NACK or ACK timeout
+  uint32_t refused;     // DATA and END notifications the stack refused
+  uint32_t rejected;    // STARTs answered with REJECT
+  uint32_t lastRecords; // Distinct records in the last completed transfer
+  uint32_t lastMs;      // Its duration, first START to final ACK
+};
+
+// Serves the sync protocol from its own task, so a transfer runs at link
+// speed rather than at the loop period. Client writes arrive on the BLE
+// stack's task and are queued to it.
+//
+// Host-native builds have no FreeRTOS: poll() does the task's work at the
+// current (simulated) time.
+class JournalSync {
+public:
+#ifdef ESP_PLATFORM
+  static const uint32_t STACK_SIZE = 4096;
+  static const UBaseType_t PRIORITY = 2;
+  static const BaseType_t CORE = 0;
+#endif
+
+  JournalSync(MeasurementJournal &jrnl, Bluetooth &bluetooth);
+
+  bool begin();
+  bool isActive() const { return active; }
+  SyncStats getStats() const;
+
+#ifndef ESP_PLATFORM
+  void poll();
+#endif
+
+private:
+  enum SendResult { SENT, NOTHING_TO_SEND, REFUSED };
+
+  struct Command {
+    uint8_t type;
+    uint16_t connId;
+    uint32_t from;
+    uint32_t to;
+    uint8_t window;
+  };
+
+  MeasurementJournal &journal;
+  Bluetooth &ble;
+  SpscRingBuffer<Command, 8> commands;
+
+  // Task side
+  volatile bool active;
+  uint16_t client;        // Connection being served
+  uint32_t rangeEnd;      // Last sequence requested
+  uint32_t nextToSend;
+  uint32_t acked;         // Every record before this has arrived
+  uint32_t resumePoint;
+  uint8_t window;
+  uint8_t perPacket;      // Records per DATA at the client's MTU
+  uint8_t packetCounter;
+  uint32_t packetEnd[SYNC_MAX_WINDOW]; // Next sequence after each packet
+  uint8_t inFlight;
+  bool endSent;
+  bool refusing;          // The last notification was refused
+  unsigned long refusedSinceMs;
+  uint32_t freshFrom; // Records from here on have not been sent before
+  unsigned long lastProgressMs;
+  unsigned long startMs;
+  uint32_t transferRecords;
+  MeasurementRecord batch[SYNC_MAX_PACKET_RECORDS];
+  uint8_t packet[BLE_MAX_PACKET_SIZE];
+
+  volatile uint32_t transfers;
+  volatile uint32_t records;
+  volatile uint32_t packets;
+  volatile uint32_t rewinds;
+  volatile uint32_t refused;
+  volatile uint32_t rejected;
+  volatile uint32_t lastRecords;
+  volatile uint32_t lastMs;
+
+#ifdef ESP_PLATFORM
+  TaskHandle_t task;
+
+  void run();
+  static void taskEntry(void *arg);
+#endif
+
+  static void onWrite(void *context, uint16_t connId, const uint8_t *data,
+                      size_t length);
+  void handle(const Command &command);
+  void acknowledge(uint32_t next);
+  void rewind();
+  void pause();
+  unsigned long backOff();
+  unsigned long step();
+  SendResult sendData();
+  SendResult sendEnd();
+  void sendInfo(uint16_t connId);
+  void sendReject(uint16_t connId, uint8_t status);
+};
+
+#endif
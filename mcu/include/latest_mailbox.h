@@ -0,0 +1,52 @@
+#ifndef LATEST_MAILBOX_H
+#define LATEST_MAILBOX_H
+
+#include <atomic>
+#include <stdint.h>
+
+// Lock-free single-producer / single-consumer mailbox that only keeps the
+// latest value (a triple buffer). The producer fills back() and publishes
+// it; the consumer takes the most recent published value. A value published
+// before the consumer took the previous one replaces it, so the consumer
+// never works through a backlog. Neither side ever waits for the other, and
+// a taken value stays valid until the consumer's next take().
+template <typename T> class LatestMailbox {
+public:
+  LatestMailbox() : backIndex(0), middle(1), frontIndex(2) {}
+
+  // Producer side
+  T &back() { return slots[backIndex]; }
+
+  // Hands back() to the consumer; true if that replaced an untaken value
+  bool publish() {
+    uint8_t previous =
+        middle.exchange(backIndex | FRESH, std::memory_order_acq_rel);
+    backIndex = previous & INDEX_MASK;
+    return previous & FRESH;
+  }
+
+  // Consumer side
+  bool hasNew() const {
+    return middle.load(std::memory_order_acquire) & FRESH;
+  }
+
+  // Latest published value, or nullptr if nothing new since the last take()
+  T *take() {
+    if (!hasNew())
+      return nullptr;
+    frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) &
+                 INDEX_MASK;
+    return &slots[frontIndex];
+  }
+
+private:
+  static const uint8_t INDEX_MASK = 0x03;
+  static const uint8_t FRESH = 0x04; // Middle slot not taken yet
+
+  T slots[3];
+  uint8_t backIndex;          // Producer only
+  std::atomic<uint8_t> middle; // Index of the shared slot | FRESH
+  uint8_t frontIndex;         // Consumer only
+};
+
+#endif
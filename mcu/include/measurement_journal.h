@@ -0,0 +1,172 @@
+#ifndef MEASUREMENT_JOURNAL_H
+#define MEASUREMENT_JOURNAL_H
+
+#include "spsc_ring_buffer.h"
+#include <Arduino.h>
+#include <atomic>
+#include <esp_partition.h>
+
+// One finalized measurement
+struct MeasurementRecord {
+  uint32_t sequence;  // Assigned by append(); increases across reboots
+  uint32_t timestamp; // ms since boot
+  uint16_t boot;      // Boot session the timestamp belongs to
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+  uint8_t samples;
+  uint8_t rejected;
+  uint8_t profile;    // Calibration slot
+  uint16_t rawRed;    // Average half-period in us (saturates)
+  uint16_t rawGreen;
+  uint16_t rawBlue;
+  uint16_t nameId;
+  uint16_t ciTenths;  // 95% CI half-width x 10, JOURNAL_CI_UNKNOWN if n/a
+};
+
+static const uint16_t JOURNAL_CI_UNKNOWN = 0xFFFF;
+
+// 28-byte little-endian form, used by journal slots and sync packets:
+//   0  u32 sequence
+//   4  u32 timestamp
+//   8  u16 boot
+//   10 u8  red, green, blue, samples, rejected, profile
+//   16 u16 rawRed, rawGreen, rawBlue, nameId, ciTenths
+//   26 u16 reserved (0xFFFF)
+static const size_t MEASUREMENT_RECORD_SIZE = 28;
+void encodeMeasurement(const MeasurementRecord &record, uint8_t *out);
+void decodeMeasurement(const uint8_t *in, MeasurementRecord &record);
+
+// Journal state since begin()
+struct JournalStats {
+  uint32_t capacity;      // Records the partition holds (one sector less)
+  uint32_t appended;      // append() calls accepted
+  uint32_t dropped;       // append() calls rejected, queue full
+  uint32_t written;       // Records programmed
+  uint32_t batches;       // Flash writes (one or more records each)
+  uint32_t erases;        // Sectors erased
+  uint32_t writeErrors;
+  uint32_t torn;          // Invalid records found by the mount scan
+  uint32_t maxEraseCount; // Most erases of any sector, over its lifetime
+  uint32_t maxBatchUs;    // Longest flush, erase included (cache off)
+};
+
+// Append-only log of finalized measurements in a raw flash partition
+// (label "journal" in partitions.csv), kept whether or not a phone is
+// connected.
+//
+// The partition is a ring of 4 KB sectors, filled in order, so every
+// sector is erased equally often. Each sector starts with a header slot
+// (generation, first sequence, erase count) followed by 32-byte record
+// slots; headers and records carry a CRC32. Flash bits are only ever
+// cleared between erases, so a power cut can at worst leave one torn slot,
+// which the mount scan skips. When the ring is full the oldest sector is
+// erased and its records are lost.
+//
+// append() only queues the record; a writer task programs queued records
+// in batches of up to BATCH_RECORDS, at most FLUSH_DELAY_MS after the
+// first one was queued, so the loop does not wait for a batch to finish.
+// It still stalls while one is programmed: esp_partition_write() and
+// esp_partition_erase_range() turn the flash cache off on both cores, and
+// code outside IRAM (the loop included) waits for them. With typical SPI
+// NOR timings a batch takes at most 1.4 ms (two pages), and the sector
+// erase every 127 records adds about 45 ms. maxBatchUs in getStats() holds
+// the longest flush; its effect on the loop shows in the loop period
+// histogram (metrics.h). Records still in the queue at a power cut are
+// lost.
+//
+// Host-native builds have no FreeRTOS: poll() does the task's work at the
+// current (simulated) time, on the partition hal/native provides.
+class MeasurementJournal {
+public:
+  static const uint8_t PARTITION_SUBTYPE = 0x40; // First custom data subtype
+  static const size_t SECTOR_SIZE = 4096;
+  static const size_t SLOT_SIZE = 32;
+  static const size_t SLOTS_PER_SECTOR = SECTOR_SIZE / SLOT_SIZE; // Header 1
+  static const size_t MAX_SECTORS = 256; // 1 MB
+  static const size_t QUEUE_SIZE = 32;
+  static const size_t BATCH_RECORDS = 8;
+  static const unsigned long FLUSH_DELAY_MS = 1000;
+#ifdef ESP_PLATFORM
+  static const uint32_t STACK_SIZE = 3072;
+  static const UBaseType_t PRIORITY = 1;
+  static const BaseType_t CORE = 0;
+#endif
+
+  explicit MeasurementJournal(const char *label = "journal");
+
+  // Mounts the partition (formatting it if it holds no journal) and starts
+  // the writer
+  bool begin();
+  bool isReady() const { return partition != nullptr; }
+
+  // Loop side: queues the record and returns its sequence, or 0 if the
+  // queue is full or the journal did not mount
+  uint32_t append(MeasurementRecord record);
+
+  // Reads up to max records with sequence >= fromSequence, oldest first.
+  // Only programmed records are seen; one in a sector being erased reads
+  // as gone.
+  size_t read(uint32_t fromSequence, MeasurementRecord *out, size_t max);
+
+  uint32_t getOldestSequence() const { return oldestSequence.load(); }
+  uint32_t getLastSequence() const { return committedSequence.load(); }
+  uint16_t getBoot() const { return boot; }
+  JournalStats getStats() const;
+
+#ifndef ESP_PLATFORM
+  void poll();
+#endif
+
+private:
+  const char *partitionLabel;
+  const esp_partition_t *partition;
+  size_t sectorCount;
+  uint16_t boot;
+
+  // Loop side
+  uint32_t nextSequence;
+  SpscRingBuffer<MeasurementRecord, QUEUE_SIZE> queue;
+  volatile uint32_t appended;
+
+  // Writer side
+  size_t writeSector;
+  size_t writeSlot; // Next free slot in writeSector
+  uint32_t generation;
+  uint32_t eraseCount; // Of writeSector
+  bool waiting;        // Records queued, FLUSH_DELAY_MS running
+  unsigned long waitStartMs;
+  uint8_t batch[BATCH_RECORDS * SLOT_SIZE];
+
+  // First sequence of each sector (0 = no header); read by the loop side
+  std::atomic<uint32_t> sectorFirst[MAX_SECTORS];
+  std::atomic<uint32_t> oldestSequence;
+  std::atomic<uint32_t> committedSequence;
+
+  // Each counter has a single writer (loop or writer side)
+  volatile uint32_t written;
+  volatile uint32_t batches;
+  volatile uint32_t erases;
+  volatile uint32_t writeErrors;
+  volatile uint32_t torn;
+  volatile uint32_t maxEraseCount;
+  volatile uint32_t maxBatchUs;
+
+#ifdef ESP_PLATFORM
+  TaskHandle_t task;
+
+  void run();
+  static void taskEntry(void *arg);
+#endif
+
+  bool mount();
+  size_t scanSector(size_t sector, uint32_t &lastSequence, uint16_t &lastBoot);
+  bool openSector(size_t sector, uint32_t firstSequence);
+  void updateOldest();
+  bool flushDue();
+  void flush();
+
+  bool readSlot(size_t sector, size_t slot, uint8_t *data);
+};
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+class Print;
+
+// Event counts since boot
+enum CounterId : uint8_t {
+  COUNTER_BLE_NOTIFIED,      // publish() notifications handed to the stack
+  COUNTER_BLE_NOTIFY_FAILED, // publish() notifications the stack refused
+  COUNTER_SENSOR_TIMEOUTS,   // Readings with a channel that saw no edges
+  COUNTER_READ_STALLS,       // Readings that never completed
+  COUNTER_COUNT
+};
+
+// Last sampled value
+enum GaugeId : uint8_t {
+  GAUGE_HEAP_FREE, // Bytes
+  GAUGE_HEAP_MIN,  // Lowest free heap since boot
+  GAUGE_BOOT_MS,   // App start to the end of setup() (boot_log.h)
+  GAUGE_COUNT
+};
+
+// Durations in microseconds
+enum HistogramId : uint8_t {
+  HISTOGRAM_READ_US,          // startReading() to the last capture
+  HISTOGRAM_LOOP_PERIOD_US,   // update() start to the next one
+  HISTOGRAM_DISPLAY_FLUSH_US, // One frame over I2C
+  HISTOGRAM_COUNT
+};
+
+// Log2 buckets: 0 is below 64 us, bucket i in [2^(i+5), 2^(i+6)) us, the
+// last one everything from 2^16 us (65 ms) on
+static const uint8_t METRICS_BUCKETS = 12;
+static const uint8_t METRICS_FIRST_BUCKET_LOG2 = 6;
+
+struct HistogramSnapshot {
+  uint32_t buckets[METRICS_BUCKETS];
+  uint32_t max;
+};
+
+struct MetricsSnapshot {
+  uint32_t counters[COUNTER_COUNT];
+  uint32_t gauges[GAUGE_COUNT];
+  HistogramSnapshot histograms[HISTOGRAM_COUNT];
+};
+
+// Fixed set of counters, gauges and latency histograms, cheap enough to
+// update on every event: no lock, no allocation, a load and a store per
+// word. Each metric has a single writer (the task whose events it counts);
+// readers on any task or core see every word whole but may catch a
+// histogram between its bucket and its max.
+class Metrics {
+public:
+  Metrics();
+
+  void count(CounterId id) {
+    counters[id].store(counters[id].load(std::memory_order_relaxed) + 1,
+                       std::memory_order_relaxed);
+  }
+
+  void set(GaugeId id, uint32_t value) {
+    gauges[id].store(value, std::memory_order_relaxed);
+  }
+
+  void record(HistogramId id, uint32_t us) {
+    Histogram &h = histograms[id];
+    uint8_t bucket = bucketFor(us);
+    h.buckets[bucket].store(
+        h.buckets[bucket].load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+    if (us > h.max.load(std::memory_order_relaxed))
+      h.max.store(us, std::memory_order_relaxed);
+  }
+
+  uint32_t get(CounterId id) const {
+    return counters[id].load(std::memory_order_relaxed);
+  }
+
+  void snapshot(MetricsSnapshot &out) const;
+
+  static uint8_t bucketFor(uint32_t us) {
+    if (us < (1UL << METRICS_FIRST_BUCKET_LOG2))
+      return 0;
+    uint8_t log2 = 31 - __builtin_clz(us);
+    uint8_t bucket = log2 - METRICS_FIRST_BUCKET_LOG2 + 1;
+    return bucket < METRICS_BUCKETS ? bucket : METRICS_BUCKETS - 1;
+  }
+
+  // Exclusive upper bound of a bucket in us, 0 for the open last one
+  static uint32_t bucketLimit(uint8_t bucket);
+
+  static const char *counterName(CounterId id);
+  static const char *gaugeName(GaugeId id);
+  static const char *histogramName(HistogramId id);
+
+private:
+  struct Histogram {
+    std::atomic<uint32_t> buckets[METRICS_BUCKETS];
+    std::atomic<uint32_t> max;
+  };
+
+  std::atomic<uint32_t> counters[COUNTER_COUNT];
+  std::atomic<uint32_t> gauges[GAUGE_COUNT];
+  Histogram histograms[HISTOGRAM_COUNT];
+};
+
+// One text line per metric; histograms as count, percentiles and max
+void printMetrics(Print &out, const MetricsSnapshot &snapshot);
+
+// The registry every module records into
+extern Metrics metrics;
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef PCNT_FREQUENCY_CAPTURE_H
+#define PCNT_FREQUENCY_CAPTURE_H
+
+#include "frequency_capture.h"
+#include <driver/pcnt.h>
+#include <esp_timer.h>
+
+// ESP32 backend: the PCNT peripheral counts OUT edges while an esp_timer
+// one-shot opens and closes the gate. Completion runs in the esp_timer task.
+class PcntFrequencyCapture : public FrequencyCapture {
+public:
+  explicit PcntFrequencyCapture(pcnt_unit_t unit = PCNT_UNIT_0);
+
+  bool begin(uint8_t pin) override;
+  bool start(uint32_t settleUs, uint32_t gateUs) override;
+  void abort() override;
+
+private:
+  enum Phase { PHASE_IDLE, PHASE_SETTLING, PHASE_GATING };
+
+  pcnt_unit_t unit;
+  esp_timer_handle_t timer;
+  volatile Phase phase;
+  volatile uint32_t overflows;
+  uint32_t gateUs;
+  int64_t gateStart;
+
+  void openGate();
+  void closeGate();
+
+  static void onTimer(void *arg);
+  static void onOverflow(void *arg);
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include "ble_service.h"
+#include <Arduino.h>
+
+// Idle power since begin()
+struct PowerStats {
+  uint32_t idlePeriods;       // enterIdle() calls
+  uint32_t sleeps;            // Light sleep slices entered
+  uint32_t sleepRejected;     // esp_light_sleep_start() refused, polled
+  uint32_t sleepMs;           // Time spent in light sleep
+  uint32_t wakes;             // exitIdle() calls
+  uint32_t wakeLatencyUs;     // Wake to first sample, last wake
+  uint32_t maxWakeLatencyUs;
+  uint32_t overBudget;        // Wakes slower than WAKE_LATENCY_BUDGET_US
+};
+
+// Idle policy for STATE_SLEEP (LED off, waiting for a press).
+//
+// Disconnected, the loop calls idle() instead of delay() and the chip
+// spends most of the time in light sleep: advertising is paused, the
+// button pin (low level) and a timer are armed as wake sources, and every
+// IDLE_WAKE_INTERVAL_MS the device wakes to advertise for
+// ADVERTISE_WINDOW_MS so a phone can still connect.
+//
+// Connected, light sleep would drop the link (no 32 kHz crystal for the BT
+// controller), so the CPU runs at IDLE_CPU_MHZ and the central is asked
+// for a long connection interval with slave latency instead.
+//
+// exitIdle() restores the CPU clock, connection parameters and
+// advertising; the caller then requests a probe reading and reports it
+// with recordWakeSample(), which closes the wake latency measurement.
+//
+// Host-native builds have no sleep or clock scaling; the BLE side is the
+// same.
+class PowerManager {
+public:
+  static const uint32_t ACTIVE_CPU_MHZ = 240;
+  static const uint32_t IDLE_CPU_MHZ = 80; // Lowest with the radio on
+  static const unsigned long IDLE_SETTLE_MS = 250;   // Last frame flushed
+  static const unsigned long IDLE_WAKE_INTERVAL_MS = 2000;
+  static const unsigned long ADVERTISE_WINDOW_MS = 200;
+  static const unsigned long IDLE_POLL_MS = 100;     // When not sleeping
+  static const unsigned long WAKE_POLL_MS = 10;      // Press being debounced
+  static const unsigned long WAKE_GRACE_MS = 500;    // Glitch, back to sleep
+  static const uint32_t WAKE_LATENCY_BUDGET_US = 150000;
+
+  PowerManager(uint8_t wakePin, Bluetooth &bluetooth);
+
+  // Called by the controller on entering and leaving STATE_SLEEP. pressUs
+  // is the micros() of the press that ends the idle period.
+  void enterIdle();
+  void exitIdle(uint32_t pressUs);
+  bool isIdle() const { return idling; }
+  bool isWakePending() const { return wakePending; }
+
+  // First reading after exitIdle() has been taken
+  void recordWakeSample();
+
+  // Takes the place of the loop delay while idle
+  void idle();
+
+  PowerStats getStats() const { return stats; }
+
+private:
+  uint8_t pin;
+  Bluetooth &ble;
+
+  bool idling;
+  unsigned long advertiseUntil;
+  bool buttonWake;         // Woken by the pin, press not handled yet
+  unsigned long buttonWakeMs;
+  uint32_t buttonWakeUs;
+  bool wakePending;        // exitIdle() done, first sample outstanding
+  uint32_t wakeStartUs;
+  PowerStats stats;
+
+  void setCpuMhz(uint32_t mhz);
+#ifdef ESP_PLATFORM
+  void lightSleep(unsigned long ms);
+#endif
+};
+
+#endif
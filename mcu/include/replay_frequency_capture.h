@@ -0,0 +1,70 @@
+#ifndef REPLAY_FREQUENCY_CAPTURE_H
+#define REPLAY_FREQUENCY_CAPTURE_H
+
+#include "frequency_capture.h"
+#include "sensor_trace.h"
+
+// FrequencyCapture backend that answers each start() with the next recorded
+// gate result from a trace (sensor_trace.h) instead of counting edges.
+// Nothing waits on a clock: step() completes the armed capture at once, so
+// ColorSensor runs through a trace as fast as the host can decode it.
+//
+// Records are fed by the caller; keep at most one complete reading queued,
+// with the sensor set to the same plan (ColorSensor::setNextPlan), so
+// readings stay aligned with the sensor's capture sequence.
+class ReplayFrequencyCapture : public FrequencyCapture {
+public:
+  static const size_t QUEUE_SIZE = ColorSensor::MAX_STEPS;
+
+  ReplayFrequencyCapture() : count(0), next(0), armed(false) {}
+
+  bool begin(uint8_t pin) override { return true; }
+
+  bool start(uint32_t settleUs, uint32_t gateUs) override {
+    bool expected = false;
+    if (!busy.compare_exchange_strong(expected, true))
+      return false;
+    armed = true;
+    return true;
+  }
+
+  void abort() override {
+    armed = false;
+    cancel();
+  }
+
+  // Queues one reading's worth of records
+  bool load(const TraceRecord *records, size_t n) {
+    if (n > QUEUE_SIZE)
+      return false;
+    for (size_t i = 0; i < n; i++) {
+      queue[i] = records[i];
+    }
+    count = n;
+    next = 0;
+    return true;
+  }
+
+  // Completes the armed capture with the next queued record
+  bool step() {
+    if (!armed || next >= count)
+      return false;
+    armed = false;
+    complete(queue[next++].result());
+    return true;
+  }
+
+  // Runs captures until the queue is used up or nothing is armed
+  void drain() {
+    while (step()) {
+    }
+  }
+
+private:
+  TraceRecord queue[QUEUE_SIZE];
+  size_t count;
+  size_t next;
+  bool armed;
+};
+
+#endif
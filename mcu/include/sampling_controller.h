@@ -1,13 +1,54 @@
 #ifndef SAMPLING_CONTROLLER_H
 #define SAMPLING_CONTROLLER_H
 
+#include "acquisition_task.h"
+#include "ble_packet.h"
 #include "ble_service.h"
 #include "button.h"
+#include "calibration_store.h"
 #include "color_sampler.h"
 #include "color_sensor.h"
+#include "config_store.h"
 #include "display.h"
+#include "measurement_journal.h"
+#include "power_manager.h"
+#include "serial_link.h"
 #include <Arduino.h>
 
+// Controller states. Every transition happens inside update(); timed
+// messages leave their state through a scheduled transition, never delay().
+enum ControllerState {
+  STATE_READY,     // Waiting for input (samples may be accumulated)
+  STATE_HOLDING,   // Button held, finalize / LED progress on screen
+  STATE_MESSAGE,   // Timed message, scheduled transition pending
+  STATE_RESULT,    // Final result on screen until the next press
+  STATE_STREAMING, // Continuous acquisition
+  STATE_CALIBRATE, // Guided white/black reference capture
+  STATE_SLEEP      // LED off, idle power (PowerManager) until a press
+};
+
+// Guided calibration steps
+enum CalibrationStep {
+  CAL_WHITE, // Waiting for / capturing the white reference
+  CAL_BLACK  // Waiting for / capturing the black reference
+};
+
+// Streaming throughput, refreshed once per STREAM_STATS_INTERVAL
+struct StreamStats {
+  unsigned long samples;  // Readings delivered since streaming started
+  unsigned long dropped;  // Missed schedule slots + ring buffer overflows
+  float samplesPerSec;    // Achieved rate over the last interval
+};
+
+// update() execution time in microseconds
+struct LoopStats {
+  unsigned long lastUs;
+  unsigned long maxUs;       // Worst case since boot
+  unsigned long windowMaxUs; // Worst case in the current report interval
+  unsigned long overruns;    // Iterations over LOOP_BUDGET_US
+  unsigned long iterations;
+};
+
 class SamplingController {
 public:
   // Timing configuration (ms)
@@ -16,8 +57,32 @@ public:
   static const unsigned long AUTO_LED_OFF_TIMEOUT = 120000; // 2 minutes
   static const int MIN_SAMPLES_REQUIRED = 3;
 
-  SamplingController(Display &disp, ColorSensor &sens, ColorSampler &samp,
-                     Button &btn, Bluetooth &bluetooth);
+  // Message durations (ms)
+  static const unsigned long ERROR_MESSAGE_DURATION = 2000;
+  static const unsigned long RESET_MESSAGE_DURATION = 1500;
+  static const unsigned long LED_MESSAGE_DURATION = 1000;
+  static const unsigned long WAKE_MESSAGE_DURATION = 500;
+  static const unsigned long CALIBRATION_MESSAGE_DURATION = 1500;
+
+  // Loop latency budget for update() and its report interval
+  static const unsigned long LOOP_BUDGET_US = 20000;
+  static const unsigned long LOOP_REPORT_INTERVAL = 10000;
+
+  // Streaming configuration
+  static const int STREAM_RATE_HZ = 50;
+  static const unsigned long STREAM_DISPLAY_INTERVAL = 200;
+  static const unsigned long STREAM_STATS_INTERVAL = 1000;
+  static const unsigned long STREAM_FLUSH_INTERVAL = 100;
+  static const uint32_t STREAM_SETTLE_TIME_US = 500;
+  static const uint32_t STREAM_GATE_TIME_US = 5000;
+
+  // Readings averaged per calibration reference
+  static const int CALIBRATION_SAMPLES = 8;
+
+  SamplingController(Display &disp, ColorSensor &sens, AcquisitionTask &acq,
+                     CalibrationStore &cal, ColorSampler &samp, Button &btn,
+                     Bluetooth &bluetooth, PowerManager &pwr,
+                     MeasurementJournal &jrnl, ConfigStore &cfg);
 
   void begin();
   void update();
@@ -25,43 +90,158 @@ public:
   // Configuration setters
   void setLongPressDuration(unsigned long ms);
   void setMinSamplesRequired(int count);
+  void setStreamRate(int hz);
+  void setAutoFinalize(bool enabled);
+
+  // All tunable settings at once (device_config.h); the caller validates
+  DeviceConfig getConfig();
+  void applyConfig(const DeviceConfig &config);
+
+  // Streaming mode
+  void startStreaming();
+  void stopStreaming();
+  bool isStreaming() { return state == STATE_STREAMING; }
+  StreamStats getStreamStats() { return streamStats; }
+
+  // Calibration
+  void startCalibration();
+  bool selectProfile(uint8_t slot);
+
+  ControllerState getState() { return state; }
+  LoopStats getLoopStats() { return loopStats; }
 
 private:
   // Dependencies
   Display &display;
   ColorSensor &sensor;
+  AcquisitionTask &acquisition;
+  CalibrationStore &calibration;
   ColorSampler &sampler;
   Button &button;
   Bluetooth &ble;
+  PowerManager &power;
+  MeasurementJournal &journal;
+  ConfigStore &settings;
 
   // Configuration
   unsigned long longPressDuration;
   unsigned long ledToggleDuration;
   unsigned long autoLedOffTimeout;
   int minSamplesRequired;
+  bool autoFinalize;
+  bool bootScreens; // Only kept here; setup() reads it from the store
+  int streamRate; // Hz
+  unsigned long streamPeriod;
+  uint32_t settleTimeUs; // Capture timing of tap readings
+  uint32_t gateTimeUs;
+  uint32_t streamSettleTimeUs;
+  uint32_t streamGateTimeUs;
+
+  // State machine
+  ControllerState state;
+  ControllerState pendingState;
+  bool transitionPending;
+  unsigned long transitionAt;
+  bool pressConsumed;
 
   // State
-  bool lastButtonState;
   bool longPressHandled;
   bool ledToggleHandled;
   unsigned long lastActivityTime;
   RGBColor lastAvgColor;
   String lastColorName;
 
+  // Streaming state
+  uint32_t streamOverflowBase;
+  unsigned long lastStreamDisplay;
+  unsigned long statsWindowStart;
+  unsigned long statsWindowSamples;
+  unsigned long streamPacketStart;
+  RollingAverage streamAverage;
+  PacketEncoder streamPacket;
+  StreamStats streamStats;
+
+  // Calibration state
+  CalibrationStep calStep;
+  CalibrationProfile calProfile;
+  bool calCapturing;
+  unsigned long calCaptureStart;
+  unsigned long calTotals[3];
+  int calCount;
+
+  // BLE record sequences, one per characteristic so a client that only
+  // listens to results sees no gaps
+  uint16_t streamSequence;
+  uint16_t resultSequence;
+
+  // Loop timing
+  LoopStats loopStats;
+  unsigned long lastLoopReport;
+  unsigned long lastUpdateUs;
+
+  // Serial command being received
+  char commandLine[16];
+  uint8_t commandLength;
+
+  // Binary bench link on the same port (serial_link.h)
+  SerialLink link;
+  bool linkStreaming;       // Streamed readings go out on the link
+  uint8_t linkReadsPending; // TRIGGER_READ readings still to come
+
+  // State machine
+  void enterState(ControllerState next);
+  void showMessageFor(const String &line1, const String &line2,
+                      unsigned long durationMs, ControllerState next);
+  void runScheduledTransition();
+  void cancelTransition();
+
+  // Button events
+  void applyHoldThresholds();
+  void handleButtonEvent(const ButtonEvent &event);
+  void onSamplingButton(const ButtonEvent &event);
+  void onCalibrationButton(const ButtonEvent &event);
+  void handleTaps(int tapCount);
+  void handleRelease(unsigned long duration);
+
+  // Per-state updates
+  void updateSampling();
+  void updateStreaming();
+  void showHoldProgress();
+
   // Event handlers
-  void onSampleTaken(const RGBColor &color);
+  void onSampleTaken(const SampleRecord &sample);
+  void onStreamSample(const SampleRecord &sample);
+  void onCalibrationSample(const SampleRecord &sample);
+  void onDoubleTap();
   void onLongPress();
+  void finalizeResult();
   void onLedToggle();
   void onTripleTap();
+  void onNextProfile();
 
   // Helper methods
   bool canFinalize();
-  void checkAutoLedOff();
-  void handleWakeUp();
+  bool checkAutoLedOff();
+  void collectReadings();
+  void serviceStream();
+  void updateStreamStats();
+  void flushStreamPacket();
+  void showCalibrationStep();
+  void finishCalibration();
+  ColorRecord makeRecord(uint16_t sequence, const RGBColor &color,
+                         const RawFrequencies &raw, unsigned long timestamp,
+                         uint16_t nameId, uint8_t flags);
+  MeasurementRecord makeJournalRecord(const RGBColor &color,
+                                      uint16_t nameId);
   void showCurrentState();
-  void waitForButtonRelease();
-  void waitForButtonPress();
   void updateActivity();
+  void serviceConfig();
+  void serviceSerial();
+  void handleLinkCommand(const LinkCommand &command);
+  uint8_t linkInfo();
+  void beginStreaming(unsigned long periodMs);
+  void sampleHeap();
+  void recordLoopTime(unsigned long elapsedUs);
 };
 
 #endif
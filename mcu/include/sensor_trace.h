@@ -0,0 +1,168 @@
+#ifndef SENSOR_TRACE_H
+#define SENSOR_TRACE_H
+
+#include "calibration.h"
+#include "color_sensor.h"
+#include "spsc_ring_buffer.h"
+#include <Arduino.h>
+
+// Raw capture trace: every per-channel gate result the sensor produced, so
+// a session can be replayed through ColorSensor -> ColorSampler -> naming
+// on the host (hal/native, --replay).
+//
+// A trace is a sequence of chunks (little-endian):
+//
+//   [0]  TRACE_SYNC (0xA5)
+//   [1]  chunk type  TRACE_CHUNK_*
+//   [2]  payload length (bytes)
+//   [3.] payload
+//   [n]  checksum    8-bit sum of type, length and payload
+//
+// The sync byte never occurs in ASCII, so chunks can share a serial port
+// with text logs and the reader resynchronizes on the checksum.
+//
+// Header payload (written when recording starts):
+//   0  u8  version
+//   1  u32 settleUs, 5 u32 gateUs
+//   9  u16 white[3], 15 u16 black[3]   calibration in use
+//   21 char name[16]
+//
+// Samples payload: up to TRACE_RECORDS_PER_CHUNK x 9-byte records
+//   0  u32 timeUs     capture end, us since recording started (wraps)
+//   4  u16 edges      edges counted (one edge = one half-period)
+//   6  u16 gateUs     measured gate length (saturates at 65535)
+//   8  u8  info       bits 0-1 filter (0 R, 1 G, 2 B, 3 clear), bits 2-3
+//                     output scaling (OutputScaling), bit 4 ambient (LED
+//                     switched off), bit 5 last capture of a reading,
+//                     bit 7 LED on
+//
+// Older traces are read as what they recorded: version 1 always at 20%,
+// versions 1 and 2 with readings of exactly R, G, B.
+
+static const uint8_t TRACE_SYNC = 0xA5;
+static const uint8_t TRACE_VERSION = 3;
+static const uint8_t TRACE_CHUNK_HEADER = 0x01;
+static const uint8_t TRACE_CHUNK_SAMPLES = 0x02;
+
+static const size_t TRACE_CHUNK_OVERHEAD = 4;
+static const size_t TRACE_HEADER_SIZE = 37;
+static const size_t TRACE_RECORD_SIZE = 9;
+static const size_t TRACE_RECORDS_PER_CHUNK = 28; // 252-byte payload
+static const size_t TRACE_MAX_PAYLOAD = 255;
+
+static const uint8_t TRACE_INFO_CHANNEL_MASK = 0x03;
+static const uint8_t TRACE_INFO_SCALING_MASK = 0x0C;
+static const uint8_t TRACE_INFO_SCALING_SHIFT = 2;
+static const uint8_t TRACE_INFO_AMBIENT = 0x10;
+static const uint8_t TRACE_INFO_LAST = 0x20;
+static const uint8_t TRACE_INFO_LED = 0x80;
+
+struct TraceRecord {
+  uint32_t timeUs;
+  uint16_t edges;
+  uint16_t gateUs;
+  uint8_t info;
+
+  uint8_t channel() const { return info & TRACE_INFO_CHANNEL_MASK; }
+  OutputScaling scaling() const {
+    return (OutputScaling)((info & TRACE_INFO_SCALING_MASK) >>
+                           TRACE_INFO_SCALING_SHIFT);
+  }
+  bool ambient() const { return info & TRACE_INFO_AMBIENT; }
+  bool last() const { return info & TRACE_INFO_LAST; }
+  CaptureStep step() const {
+    return {(SensorFilter)channel(), scaling(), ambient(), gateUs};
+  }
+  bool ledOn() const { return info & TRACE_INFO_LED; }
+  CaptureResult result() const { return {edges, gateUs}; }
+};
+
+struct TraceHeader {
+  uint8_t version;
+  uint32_t settleUs;
+  uint32_t gateUs;
+  CalibrationProfile profile;
+};
+
+void encodeTraceRecord(const TraceRecord &record, uint8_t *out);
+void decodeTraceRecord(const uint8_t *in, TraceRecord &record);
+
+// ============================================================================
+// Recorder
+// ============================================================================
+
+// Taps the sensor's capture observer. Records are queued from the capture
+// callback (outside the loop task) and written by flush() from the loop, to
+// Serial or to a flash file; anything that is a Print works.
+class TraceRecorder {
+public:
+  static const size_t QUEUE_CAPACITY = 128;
+
+  explicit TraceRecorder(ColorSensor &sens);
+
+  // Writes the header and starts queueing captures
+  void begin(Print &out, const CalibrationProfile &profile);
+  void stop();
+  bool isRecording() const { return recording; }
+
+  // Called from the loop; writes full chunks (all queued ones if force)
+  size_t flush(Print &out, bool force = false);
+
+  uint32_t getRecordCount() const { return recorded; }
+  uint32_t getDroppedCount() const { return queue.overflowCount(); }
+
+private:
+  ColorSensor &sensor;
+  SpscRingBuffer<TraceRecord, QUEUE_CAPACITY> queue;
+  volatile bool recording;
+  uint32_t startUs;
+  uint32_t recorded;
+
+  static void onCapture(void *context, const CaptureStep &step,
+                        const CaptureResult &result, bool last);
+};
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+// Incremental chunk parser. Bytes that are not part of a valid chunk (text
+// logs, a torn chunk at the end of a file) are skipped.
+class TraceReader {
+public:
+  enum Event { NONE, HEADER, SAMPLES };
+
+  TraceReader();
+
+  // Feeds one byte; returns the chunk type completed by it, if any
+  Event feed(uint8_t byte);
+
+  const TraceHeader &getHeader() const { return header; }
+  bool hasHeader() const { return headerSeen; }
+
+  // Records of the last SAMPLES chunk
+  size_t getRecordCount() const { return recordCount; }
+  const TraceRecord &getRecord(size_t index) const { return records[index]; }
+
+  uint32_t getSkippedBytes() const { return skipped; }
+
+private:
+  enum ParseState { SYNC, TYPE, LENGTH, PAYLOAD, CHECKSUM };
+
+  ParseState state;
+  uint8_t type;
+  uint8_t length;
+  uint8_t received;
+  uint8_t sum;
+  uint8_t payload[TRACE_MAX_PAYLOAD];
+
+  TraceHeader header;
+  bool headerSeen;
+  TraceRecord records[TRACE_MAX_PAYLOAD / TRACE_RECORD_SIZE];
+  size_t recordCount;
+  uint32_t skipped;
+
+  Event finishChunk();
+};
+
+#endif
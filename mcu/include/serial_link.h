@@ -0,0 +1,162 @@
+#ifndef SERIAL_LINK_H
+#define SERIAL_LINK_H
+
+#include "acquisition_task.h"
+#include <Arduino.h>
+
+// Binary protocol on the serial port for bench data collection: readings
+// go out as they are taken, commands come in. Frames use the sensor trace
+// chunk layout (sensor_trace.h) with types of their own, so they share the
+// port with text logs and each reader skips what is not its own:
+//
+//   [0]  LINK_SYNC (0xA5)
+//   [1]  frame type  LINK_FRAME_*
+//   [2]  payload length (bytes)
+//   [3.] payload
+//   [n]  checksum    8-bit sum of type, length and payload
+//
+// Host -> device, COMMAND:
+//   0  u8  opcode        LINK_CMD_*
+//   1. arguments
+//        START_STREAM   u8 rate (Hz), 0 = back to back
+//        STOP_STREAM
+//        SET_SCALING    u8 OutputScaling, or LINK_SCALING_AUTO
+//        TRIGGER_READ   one reading, not added to the samples
+//
+// Device -> host, ACK (one per command, after the readings it ended):
+//   0  u8  opcode
+//   1  u8  status        LinkStatus
+//   2  u32 value         STOP_STREAM: readings the device dropped
+//
+// Device -> host, READINGS: up to LINK_READINGS_PER_FRAME x 22-byte readings
+//   0  u16 sequence      per reading sent; a gap is a frame lost on the wire
+//   2  u32 timestamp     ms, start of the reading
+//   6  u8  red, green, blue
+//   9  u8  info          bits 0-1 fixed scaling (OutputScaling), bit 2
+//                        auto-range, bit 3 ambient compensated, bit 4
+//                        streamed, bit 7 LED on
+//   10 u32 raw red, green, blue   us half-periods (RawFrequencies)
+
+static const uint32_t LINK_BAUD_RATE = 921600;
+
+static const uint8_t LINK_SYNC = 0xA5;
+static const uint8_t LINK_FRAME_COMMAND = 0x10;
+static const uint8_t LINK_FRAME_ACK = 0x11;
+static const uint8_t LINK_FRAME_READINGS = 0x12;
+
+static const uint8_t LINK_CMD_START_STREAM = 0x01;
+static const uint8_t LINK_CMD_STOP_STREAM = 0x02;
+static const uint8_t LINK_CMD_SET_SCALING = 0x03;
+static const uint8_t LINK_CMD_TRIGGER_READ = 0x04;
+
+static const uint8_t LINK_SCALING_AUTO = 0xFF;
+
+static const size_t LINK_FRAME_OVERHEAD = 4;
+static const size_t LINK_MAX_PAYLOAD = 255;
+static const size_t LINK_MAX_COMMAND_ARGS = 4;
+static const size_t LINK_ACK_SIZE = 6;
+static const size_t LINK_READING_SIZE = 22;
+static const size_t LINK_READINGS_PER_FRAME = 11; // 242-byte payload
+
+static const uint8_t LINK_INFO_SCALING_MASK = 0x03;
+static const uint8_t LINK_INFO_AUTO_RANGE = 0x04;
+static const uint8_t LINK_INFO_AMBIENT = 0x08;
+static const uint8_t LINK_INFO_STREAMED = 0x10;
+static const uint8_t LINK_INFO_LED = 0x80;
+
+enum LinkStatus : uint8_t {
+  LINK_OK,
+  LINK_BAD_COMMAND, // Unknown opcode
+  LINK_BAD_LENGTH,  // Wrong argument count
+  LINK_BAD_VALUE,
+  LINK_BUSY // Not in this state (calibrating, asleep, button held, ...)
+};
+
+struct LinkCommand {
+  uint8_t opcode;
+  uint8_t length; // Argument bytes
+  uint8_t args[LINK_MAX_COMMAND_ARGS];
+};
+
+struct LinkReading {
+  uint16_t sequence;
+  uint32_t timestamp;
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+  uint8_t info;
+  uint32_t raw[3];
+};
+
+size_t writeLinkFrame(Print &out, uint8_t type, const uint8_t *payload,
+                      uint8_t length);
+void encodeLinkReading(const LinkReading &reading, uint8_t *out);
+void decodeLinkReading(const uint8_t *in, LinkReading &reading);
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+// Incremental frame parser for either end. Bytes that are not part of a
+// valid link frame (text logs, trace chunks, a torn frame) are skipped.
+class LinkReader {
+public:
+  LinkReader();
+
+  // Feeds one byte; true when it completes a frame
+  bool feed(uint8_t byte);
+
+  // Between frames: the next byte starts one only if it is LINK_SYNC
+  bool isIdle() const { return state == SYNC; }
+
+  // The last completed frame
+  uint8_t getType() const { return type; }
+  uint8_t getLength() const { return length; }
+  const uint8_t *getPayload() const { return payload; }
+
+  uint32_t getSkippedBytes() const { return skipped; }
+
+private:
+  enum ParseState { SYNC, TYPE, LENGTH, PAYLOAD, CHECKSUM };
+
+  ParseState state;
+  uint8_t type;
+  uint8_t length;
+  uint8_t received;
+  uint8_t sum;
+  uint8_t payload[LINK_MAX_PAYLOAD];
+  uint32_t skipped;
+};
+
+// ============================================================================
+// Device End
+// ============================================================================
+
+// Parses commands from bytes the loop reads off the port and batches
+// readings into frames. Loop task only.
+class SerialLink {
+public:
+  explicit SerialLink(Print &port);
+
+  // True (and the command) when the byte completes a command frame
+  bool feed(uint8_t byte, LinkCommand &command);
+  bool isIdle() const { return reader.isIdle(); }
+
+  void sendAck(uint8_t opcode, uint8_t status, uint32_t value = 0);
+
+  // Queued until the frame is full or flush()
+  void addReading(const SampleRecord &sample, uint8_t info);
+  void flush();
+
+  uint32_t getSentCount() const { return sent; }
+
+private:
+  Print &out;
+  LinkReader reader;
+  uint8_t frame[LINK_READINGS_PER_FRAME * LINK_READING_SIZE];
+  uint8_t frameCount;
+  uint16_t sequence;
+  uint32_t sent;
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef SIM_FREQUENCY_CAPTURE_H
+#define SIM_FREQUENCY_CAPTURE_H
+
+#include "frequency_capture.h"
+
+// Host stub for FrequencyCapture. Time only moves when advance() is called,
+// so gate/count behaviour is deterministic. The OUT frequency comes from
+// setFrequency() or, if set, from a source callback sampled when the gate
+// opens (lets a simulated sensor answer per selected filter).
+class SimFrequencyCapture : public FrequencyCapture {
+public:
+  typedef uint32_t (*FrequencySource)(void *context);
+
+  SimFrequencyCapture()
+      : frequency(0), source(nullptr), sourceContext(nullptr), settleLeft(0),
+        gateLeft(0), gateUs(0), edgePhase(0), edges(0) {}
+
+  bool begin(uint8_t pin) override { return true; }
+
+  bool start(uint32_t settleUs, uint32_t gate) override {
+    bool expected = false;
+    if (!busy.compare_exchange_strong(expected, true))
+      return false;
+
+    settleLeft = settleUs;
+    gateLeft = gate;
+    gateUs = gate;
+    edges = 0;
+    return true;
+  }
+
+  void abort() override {
+    settleLeft = 0;
+    gateLeft = 0;
+    cancel();
+  }
+
+  void setFrequency(uint32_t hz) { frequency = hz; }
+
+  void setFrequencySource(FrequencySource fn, void *context) {
+    source = fn;
+    sourceContext = context;
+  }
+
+  // Moves simulated time forward, completing the capture if the gate closes
+  void advance(uint32_t us) {
+    while (us > 0 && isBusy()) {
+      if (settleLeft > 0) {
+        uint32_t step = us < settleLeft ? us : settleLeft;
+        settleLeft -= step;
+        us -= step;
+        continue;
+      }
+
+      uint32_t hz = source ? source(sourceContext) : frequency;
+      uint32_t step = us < gateLeft ? us : gateLeft;
+      countEdges(hz, step);
+      gateLeft -= step;
+      us -= step;
+
+      if (gateLeft == 0) {
+        CaptureResult result = {edges, gateUs};
+        complete(result);
+      }
+    }
+  }
+
+  // Time until the in-flight capture completes
+  uint32_t remainingUs() const {
+    return isBusy() ? settleLeft + gateLeft : 0;
+  }
+
+private:
+  uint32_t frequency;
+  FrequencySource source;
+  void *sourceContext;
+  uint32_t settleLeft;
+  uint32_t gateLeft;
+  uint32_t gateUs;
+  uint64_t edgePhase; // Carries fractional edges between steps (edges * 1e6)
+  uint32_t edges;
+
+  void countEdges(uint32_t hz, uint32_t us) {
+    // Two edges per period
+    edgePhase += (uint64_t)hz * 2 * us;
+    edges += (uint32_t)(edgePhase / 1000000ULL);
+    edgePhase %= 1000000ULL;
+  }
+};
+
+#endif
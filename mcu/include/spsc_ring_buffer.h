@@ -0,0 +1,85 @@
+#ifndef SPSC_RING_BUFFER_H
+#define SPSC_RING_BUFFER_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Lock-free single-producer / single-consumer ring buffer.
+// push() must only be called from one task and pop() from one other task.
+// Head and tail are free-running counters; Capacity must be a power of two
+// so the index wraps with a mask. A full buffer rejects new items (the
+// consumer keeps the oldest data) and counts the overflow.
+template <typename T, size_t Capacity> class SpscRingBuffer {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+
+public:
+  SpscRingBuffer() : head(0), tail(0), overflows(0), highWater(0) {}
+
+  // Producer side
+  bool push(const T &item) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+
+    if (h - t >= Capacity) {
+      overflows.store(overflows.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+      return false;
+    }
+
+    items[h & MASK] = item;
+    head.store(h + 1, std::memory_order_release);
+
+    uint32_t used = h + 1 - t;
+    if (used > highWater.load(std::memory_order_relaxed)) {
+      highWater.store(used, std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  // Consumer side
+  bool pop(T &item) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+
+    if (t == h)
+      return false;
+
+    item = items[t & MASK];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side: drops everything currently queued
+  void clear() {
+    tail.store(head.load(std::memory_order_acquire),
+               std::memory_order_release);
+  }
+
+  size_t size() const {
+    return head.load(std::memory_order_acquire) -
+           tail.load(std::memory_order_acquire);
+  }
+  bool isEmpty() const { return size() == 0; }
+  static size_t capacity() { return Capacity; }
+
+  // Statistics (written by the producer only)
+  uint32_t overflowCount() const {
+    return overflows.load(std::memory_order_relaxed);
+  }
+  uint32_t highWaterMark() const {
+    return highWater.load(std::memory_order_relaxed);
+  }
+
+private:
+  static const uint32_t MASK = Capacity - 1;
+
+  T items[Capacity];
+  std::atomic<uint32_t> head; // Next slot to write (producer)
+  std::atomic<uint32_t> tail; // Next slot to read (consumer)
+  std::atomic<uint32_t> overflows;
+  std::atomic<uint32_t> highWater;
+};
+
+#endif
@@ -0,0 +1,349 @@
+#!/usr/bin/env python3
+"""Generate include/color_palette_data.h for the CIELAB color namer.
+
+The palette is the CSS named colors plus a systematic hue / lightness /
+saturation grid and a gray ramp. Every entry is converted to CIELAB (D65)
+and a k-d tree is built over the part of L*a*b* that sRGB can reach. Each
+leaf lists every palette entry that can be the nearest neighbour (ΔE76) of
+some color inside the leaf, so a lookup is one descent plus at most
+MAX_CANDIDATES distance evaluations.
+
+Usage (from mcu/):  python3 scripts/gen_palette.py
+"""
+
+import colorsys
+import os
+
+OUTPUT = os.path.join(os.path.dirname(__file__), "..", "include",
+                      "color_palette_data.h")
+
+# Names are shown on the 21-column bottom line of the OLED
+MAX_NAME_LEN = 21
+
+# Lab values are stored as int16 hundredths
+LAB_SCALE = 100
+
+# Leaves are split until they hold at most LEAF_CAP candidates (or become
+# smaller than MIN_SPLIT in every axis)
+LEAF_CAP = 48
+MIN_SPLIT = 0.25
+
+# The sRGB gamut is sampled every GAMUT_STEP levels per channel; node boxes
+# shrink to the samples they hold plus GAMUT_MARGIN (Lab units)
+GAMUT_STEP = 5
+GAMUT_MARGIN = 2.0
+
+LEAF_AXIS = 3
+
+CSS_COLORS = [
+    ("AliceBlue", 0xF0F8FF), ("AntiqueWhite", 0xFAEBD7),
+    ("Aquamarine", 0x7FFFD4), ("Azure", 0xF0FFFF), ("Beige", 0xF5F5DC),
+    ("Bisque", 0xFFE4C4), ("Black", 0x000000),
+    ("BlanchedAlmond", 0xFFEBCD), ("Blue", 0x0000FF),
+    ("BlueViolet", 0x8A2BE2), ("Brown", 0xA52A2A),
+    ("BurlyWood", 0xDEB887), ("CadetBlue", 0x5F9EA0),
+    ("Chartreuse", 0x7FFF00), ("Chocolate", 0xD2691E),
+    ("Coral", 0xFF7F50), ("CornflowerBlue", 0x6495ED),
+    ("Cornsilk", 0xFFF8DC), ("Crimson", 0xDC143C), ("Cyan", 0x00FFFF),
+    ("DarkBlue", 0x00008B), ("DarkCyan", 0x008B8B),
+    ("DarkGoldenRod", 0xB8860B), ("DarkGray", 0xA9A9A9),
+    ("DarkGreen", 0x006400), ("DarkKhaki", 0xBDB76B),
+    ("DarkMagenta", 0x8B008B), ("DarkOliveGreen", 0x556B2F),
+    ("DarkOrange", 0xFF8C00), ("DarkOrchid", 0x9932CC),
+    ("DarkRed", 0x8B0000), ("DarkSalmon", 0xE9967A),
+    ("DarkSeaGreen", 0x8FBC8F), ("DarkSlateBlue", 0x483D8B),
+    ("DarkSlateGray", 0x2F4F4F), ("DarkTurquoise", 0x00CED1),
+    ("DarkViolet", 0x9400D3), ("DeepPink", 0xFF1493),
+    ("DeepSkyBlue", 0x00BFFF), ("DimGray", 0x696969),
+    ("DodgerBlue", 0x1E90FF), ("FireBrick", 0xB22222),
+    ("FloralWhite", 0xFFFAF0), ("ForestGreen", 0x228B22),
+    ("Gainsboro", 0xDCDCDC), ("GhostWhite", 0xF8F8FF),
+    ("Gold", 0xFFD700), ("GoldenRod", 0xDAA520), ("Gray", 0x808080),
+    ("Green", 0x008000), ("GreenYellow", 0xADFF2F),
+    ("HoneyDew", 0xF0FFF0), ("HotPink", 0xFF69B4),
+    ("IndianRed", 0xCD5C5C), ("Indigo", 0x4B0082), ("Ivory", 0xFFFFF0),
+    ("Khaki", 0xF0E68C), ("Lavender", 0xE6E6FA),
+    ("LavenderBlush", 0xFFF0F5), ("LawnGreen", 0x7CFC00),
+    ("LemonChiffon", 0xFFFACD), ("LightBlue", 0xADD8E6),
+    ("LightCoral", 0xF08080), ("LightCyan", 0xE0FFFF),
+    ("LightGoldenRodYellow", 0xFAFAD2), ("LightGray", 0xD3D3D3),
+    ("LightGreen", 0x90EE90), ("LightPink", 0xFFB6C1),
+    ("LightSalmon", 0xFFA07A), ("LightSeaGreen", 0x20B2AA),
+    ("LightSkyBlue", 0x87CEFA), ("LightSlateGray", 0x778899),
+    ("LightSteelBlue", 0xB0C4DE), ("LightYellow", 0xFFFFE0),
+    ("Lime", 0x00FF00), ("LimeGreen", 0x32CD32), ("Linen", 0xFAF0E6),
+    ("Magenta", 0xFF00FF), ("Maroon", 0x800000),
+    ("MediumAquaMarine", 0x66CDAA), ("MediumBlue", 0x0000CD),
+    ("MediumOrchid", 0xBA55D3), ("MediumPurple", 0x9370DB),
+    ("MediumSeaGreen", 0x3CB371), ("MediumSlateBlue", 0x7B68EE),
+    ("MediumSpringGreen", 0x00FA9A), ("MediumTurquoise", 0x48D1CC),
+    ("MediumVioletRed", 0xC71585), ("MidnightBlue", 0x191970),
+    ("MintCream", 0xF5FFFA), ("MistyRose", 0xFFE4E1),
+    ("Moccasin", 0xFFE4B5), ("NavajoWhite", 0xFFDEAD),
+    ("Navy", 0x000080), ("OldLace", 0xFDF5E6), ("Olive", 0x808000),
+    ("OliveDrab", 0x6B8E23), ("Orange", 0xFFA500),
+    ("OrangeRed", 0xFF4500), ("Orchid", 0xDA70D6),
+    ("PaleGoldenRod", 0xEEE8AA), ("PaleGreen", 0x98FB98),
+    ("PaleTurquoise", 0xAFEEEE), ("PaleVioletRed", 0xDB7093),
+    ("PapayaWhip", 0xFFEFD5), ("PeachPuff", 0xFFDAB9),
+    ("Peru", 0xCD853F), ("Pink", 0xFFC0CB), ("Plum", 0xDDA0DD),
+    ("PowderBlue", 0xB0E0E6), ("Purple", 0x800080),
+    ("RebeccaPurple", 0x663399), ("Red", 0xFF0000),
+    ("RosyBrown", 0xBC8F8F), ("RoyalBlue", 0x4169E1),
+    ("SaddleBrown", 0x8B4513), ("Salmon", 0xFA8072),
+    ("SandyBrown", 0xF4A460), ("SeaGreen", 0x2E8B57),
+    ("SeaShell", 0xFFF5EE), ("Sienna", 0xA0522D), ("Silver", 0xC0C0C0),
+    ("SkyBlue", 0x87CEEB), ("SlateBlue", 0x6A5ACD),
+    ("SlateGray", 0x708090), ("Snow", 0xFFFAFA),
+    ("SpringGreen", 0x00FF7F), ("SteelBlue", 0x4682B4),
+    ("Tan", 0xD2B48C), ("Teal", 0x008080), ("Thistle", 0xD8BFD8),
+    ("Tomato", 0xFF6347), ("Turquoise", 0x40E0D0),
+    ("Violet", 0xEE82EE), ("Wheat", 0xF5DEB3), ("White", 0xFFFFFF),
+    ("WhiteSmoke", 0xF5F5F5), ("Yellow", 0xFFFF00),
+    ("YellowGreen", 0x9ACD32),
+]
+
+# Systematic grid: HSL hue every 12 degrees
+HUE_NAMES = [
+    "Red", "Scarlet", "Flame", "Orange", "Amber", "Yellow", "Lemon",
+    "Pear", "Lime", "Leaf", "Green", "Clover", "Emerald", "Jade", "Mint",
+    "Aqua", "Cerulean", "Sky", "Cobalt", "Sapphire", "Marine",
+    "Indigo", "Violet", "Purple", "Amethyst", "Mauve", "Orchid",
+    "Fuchsia", "Rose", "Crimson",
+]
+LIGHTNESS = [(0.15, "Deep"), (0.27, "Dark"), (0.40, ""), (0.55, "Light"),
+             (0.70, "Pale"), (0.84, "Faint")]
+SATURATION = [(0.15, "Ashy"), (0.30, "Dusty"), (0.48, "Soft"), (0.66, ""),
+              (0.83, "Rich"), (1.00, "Vivid")]
+
+GRAYS = [("Jet", 0.08), ("Charcoal", 0.17), ("Graphite", 0.25),
+         ("Slate Gray", 0.33), ("Iron Gray", 0.42), ("Mid Gray", 0.50),
+         ("Ash Gray", 0.58), ("Pewter", 0.67), ("Pale Gray", 0.75),
+         ("Platinum", 0.83), ("Pearl", 0.92)]
+
+
+def srgb_to_lab(r, g, b):
+    def linear(c):
+        c /= 255.0
+        return c / 12.92 if c <= 0.04045 else ((c + 0.055) / 1.055) ** 2.4
+
+    rl, gl, bl = linear(r), linear(g), linear(b)
+    x = 0.4124564 * rl + 0.3575761 * gl + 0.1804375 * bl
+    y = 0.2126729 * rl + 0.7151522 * gl + 0.0721750 * bl
+    z = 0.0193339 * rl + 0.1191920 * gl + 0.9503041 * bl
+
+    def f(t):
+        return t ** (1.0 / 3.0) if t > 216.0 / 24389.0 else \
+            (24389.0 / 27.0 * t + 16.0) / 116.0
+
+    fx, fy, fz = f(x / 0.95047), f(y / 1.0), f(z / 1.08883)
+    return 116.0 * fy - 16.0, 500.0 * (fx - fy), 200.0 * (fy - fz)
+
+
+def build_palette():
+    entries = []
+    seen = set()
+
+    def add(name, rgb):
+        if rgb in seen:
+            return
+        # Grid names must not shadow a CSS name ("Red" -> "Mid Red")
+        if any(e[0] == name for e in entries):
+            name = "Mid " + name
+        assert len(name) <= MAX_NAME_LEN, name
+        seen.add(rgb)
+        lab = srgb_to_lab(*rgb)
+        entries.append((name, rgb, tuple(int(round(v * LAB_SCALE))
+                                         for v in lab)))
+
+    for name, value in CSS_COLORS:
+        add(name, ((value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF))
+
+    for name, level in GRAYS:
+        v = int(round(level * 255))
+        add(name, (v, v, v))
+
+    for i, hue_name in enumerate(HUE_NAMES):
+        for lightness, l_word in LIGHTNESS:
+            for saturation, s_word in SATURATION:
+                r, g, b = colorsys.hls_to_rgb(i / len(HUE_NAMES), lightness,
+                                              saturation)
+                name = " ".join(w for w in (l_word, s_word, hue_name) if w)
+                add(name, (int(round(r * 255)), int(round(g * 255)),
+                           int(round(b * 255))))
+
+    names = [e[0] for e in entries]
+    assert len(names) == len(set(names)), "duplicate palette names"
+    return entries
+
+
+def box_distances(p, box):
+    dmin = 0.0
+    dmax = 0.0
+    for v, (lo, hi) in zip(p, box):
+        if v < lo:
+            dmin += (lo - v) ** 2
+        elif v > hi:
+            dmin += (v - hi) ** 2
+        dmax += max(abs(v - lo), abs(v - hi)) ** 2
+    return dmin, dmax
+
+
+def candidates_for(entries, box, parent):
+    dists = [(i, box_distances(entries[i][2], box)) for i in parent]
+    limit = min(d[1] for _, d in dists)
+    return [i for i, d in dists if d[0] <= limit]
+
+
+def gamut_samples():
+    levels = list(range(0, 256, GAMUT_STEP))
+    if levels[-1] != 255:
+        levels.append(255)
+    return [tuple(v * LAB_SCALE for v in srgb_to_lab(r, g, b))
+            for r in levels for g in levels for b in levels]
+
+
+def shrink(box, points):
+    """Clip box to the samples it holds, grown by the gamut margin."""
+    if not points:
+        return None
+    margin = GAMUT_MARGIN * LAB_SCALE
+    out = []
+    for axis, (lo, hi) in enumerate(box):
+        plo = min(p[axis] for p in points) - margin
+        phi = max(p[axis] for p in points) + margin
+        lo, hi = max(lo, plo), min(hi, phi)
+        if lo > hi:
+            return None
+        out.append((lo, hi))
+    return out
+
+
+def build_tree(entries):
+    """Returns (nodes, items). Inner node: (axis, split, left); the right
+    child is left + 1. Leaf: (LEAF_AXIS, start, count) into items."""
+    nodes = []
+    items = []
+    points = gamut_samples()
+    root = shrink([(-1e9, 1e9)] * 3, points)
+    nodes.append(None)
+
+    # Breadth-first so both children of a node are adjacent
+    queue = [(0, root, points, list(range(len(entries))))]
+    while queue:
+        index, box, pts, parent = queue.pop(0)
+        cands = candidates_for(entries, box, parent)
+        axis = max(range(3), key=lambda a: box[a][1] - box[a][0])
+        width = box[axis][1] - box[axis][0]
+        if len(cands) <= LEAF_CAP or width < MIN_SPLIT * LAB_SCALE:
+            nodes[index] = (LEAF_AXIS, len(items), len(cands))
+            items.extend(cands)
+            continue
+
+        split = int(round((box[axis][0] + box[axis][1]) / 2))
+        left = len(nodes)
+        nodes.extend([None, None])
+        nodes[index] = (axis, split, left)
+        for child, in_child in ((left, lambda v: v < split),
+                                (left + 1, lambda v: v >= split)):
+            cbox = list(box)
+            lo, hi = box[axis]
+            cbox[axis] = (lo, split) if child == left else (split, hi)
+            cpts = [p for p in pts if in_child(p[axis])]
+            # Unsampled children stay reachable through the margin only
+            sbox = shrink(cbox, cpts) if cpts else cbox
+            if sbox is None:
+                nodes[child] = (LEAF_AXIS, len(items), 0)
+                continue
+            queue.append((child, sbox, cpts, cands))
+    return nodes, items
+
+
+def c_string(s):
+    return '"' + s.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def write_header(entries, nodes, items):
+    max_candidates = max(n[2] for n in nodes if n[0] == LEAF_AXIS)
+    assert len(items) < 65536 and max_candidates < 256
+
+    out = []
+    out.append("// Generated by scripts/gen_palette.py -- do not edit.")
+    out.append("#ifndef COLOR_PALETTE_DATA_H")
+    out.append("#define COLOR_PALETTE_DATA_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("namespace PaletteData {")
+    out.append("")
+    out.append("static constexpr uint16_t SIZE = %d;" % len(entries))
+    out.append("static constexpr int16_t LAB_SCALE = %d;" % LAB_SCALE)
+    out.append("static constexpr uint16_t NODE_COUNT = %d;" % len(nodes))
+    out.append("static constexpr uint8_t LEAF = %d;" % LEAF_AXIS)
+    out.append("static constexpr uint16_t MAX_CANDIDATES = %d;"
+               % max_candidates)
+    out.append("")
+
+    out.append("// L*, a*, b* in hundredths")
+    out.append("static constexpr int16_t LAB[SIZE][3] = {")
+    for name, _, lab in entries:
+        out.append("    {%d, %d, %d}, // %s" % (lab[0], lab[1], lab[2], name))
+    out.append("};")
+    out.append("")
+
+    offsets = []
+    offset = 0
+    for name, _, _ in entries:
+        offsets.append(offset)
+        offset += len(name) + 1
+    out.append("static constexpr uint16_t NAME_OFFSET[SIZE] = {")
+    for i in range(0, len(offsets), 10):
+        out.append("    " + ", ".join(str(o) for o in offsets[i:i + 10]) + ",")
+    out.append("};")
+    out.append("")
+
+    out.append("// NUL-separated names, indexed through NAME_OFFSET")
+    out.append("static constexpr char NAMES[] =")
+    for name, _, _ in entries:
+        out.append("    " + c_string(name)[:-1] + '\\0"')
+    out.append("    ;")
+    out.append("")
+
+    out.append("// Inner node: axis (0 = L*, 1 = a*, 2 = b*), split value, left")
+    out.append("// child (right child = left + 1). Leaf: LEAF, first item, count.")
+    out.append("struct Node {")
+    out.append("  uint8_t axis;")
+    out.append("  int16_t value;")
+    out.append("  uint16_t index;")
+    out.append("};")
+    out.append("")
+    out.append("static constexpr Node NODES[NODE_COUNT] = {")
+    for axis, a, b in nodes:
+        if axis == LEAF_AXIS:
+            out.append("    {LEAF, %d, %d}," % (b, a))
+        else:
+            out.append("    {%d, %d, %d}," % (axis, a, b))
+    out.append("};")
+    out.append("")
+
+    out.append("static constexpr uint16_t ITEMS[%d] = {" % len(items))
+    for i in range(0, len(items), 12):
+        out.append("    " + ", ".join(str(v) for v in items[i:i + 12]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("} // namespace PaletteData")
+    out.append("")
+    out.append("#endif")
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+    leaves = sum(1 for n in nodes if n[0] == LEAF_AXIS)
+    print("palette: %d colors, %d nodes (%d leaves), %d candidate slots, "
+          "max %d per leaf" % (len(entries), len(nodes), leaves, len(items),
+                               max_candidates))
+
+
+if __name__ == "__main__":
+    palette = build_palette()
+    write_header(palette, *build_tree(palette))
@@ -0,0 +1,232 @@
+#include "acquisition_task.h"
+#include "metrics.h"
+
+AcquisitionTask::AcquisitionTask(ColorSensor &sens)
+    : sensor(sens),
+#ifdef ESP_PLATFORM
+      task(nullptr),
+#endif
+      requested(false), streaming(false), streamPeriodMs(20), readings(0),
+      missedSlots(0) {
+#ifndef ESP_PLATFORM
+  inFlight = false;
+  scheduled = false;
+  nextSlot = 0;
+#endif
+}
+
+bool AcquisitionTask::begin() {
+  sensor.onReadingReady(onReadingReady, this);
+
+#ifdef ESP_PLATFORM
+  BaseType_t created = xTaskCreatePinnedToCore(
+      taskEntry, "acquisition", STACK_SIZE, this, PRIORITY, &task, CORE);
+
+  if (created != pdPASS) {
+    Serial.println("Acquisition task create failed!");
+    return false;
+  }
+#endif
+  return true;
+}
+
+// ============================================================================
+// Loop Task Interface
+// ============================================================================
+
+// The task notification is only a wake-up; the flags carry the reason
+void AcquisitionTask::requestSample() {
+  requested = true;
+#ifdef ESP_PLATFORM
+  xTaskNotifyGive(task);
+#endif
+}
+
+void AcquisitionTask::startStreaming(unsigned long periodMs) {
+  streamPeriodMs = periodMs;
+  missedSlots = 0;
+  streaming = true;
+#ifdef ESP_PLATFORM
+  xTaskNotifyGive(task);
+#endif
+}
+
+void AcquisitionTask::stopStreaming() { streaming = false; }
+
+bool AcquisitionTask::pop(SampleRecord &record) { return ring.pop(record); }
+
+void AcquisitionTask::clear() { ring.clear(); }
+
+AcquisitionStats AcquisitionTask::getStats() {
+  AcquisitionStats stats;
+  stats.readings = readings;
+  stats.missedSlots = missedSlots;
+  stats.overflows = ring.overflowCount();
+  stats.highWaterMark = ring.highWaterMark();
+  return stats;
+}
+
+#ifdef ESP_PLATFORM
+
+// ============================================================================
+// Acquisition Task
+// ============================================================================
+
+void AcquisitionTask::taskEntry(void *arg) {
+  static_cast<AcquisitionTask *>(arg)->run();
+}
+
+void AcquisitionTask::onReadingReady(void *context) {
+  AcquisitionTask *self = static_cast<AcquisitionTask *>(context);
+  xTaskNotifyGive(self->task);
+}
+
+void AcquisitionTask::run() {
+  TickType_t lastWake = xTaskGetTickCount();
+
+  for (;;) {
+    if (streaming) {
+      if (streamPeriodMs > 0) {
+        waitForNextSlot(lastWake);
+      }
+      // Back to back, a sensor that will not start must not starve the
+      // loop
+      if (streaming && !acquire(true) && streamPeriodMs == 0) {
+        vTaskDelay(1);
+      }
+      continue;
+    }
+
+    // Idle until the loop asks for a single reading or streaming starts
+    if (!requested) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      lastWake = xTaskGetTickCount(); // Streaming slots count from here
+      continue;
+    }
+
+    requested = false;
+    lastWake = xTaskGetTickCount();
+    acquire(false);
+  }
+}
+
+void AcquisitionTask::waitForNextSlot(TickType_t &lastWake) {
+  TickType_t period = max((TickType_t)1, pdMS_TO_TICKS(streamPeriodMs));
+  TickType_t elapsed = xTaskGetTickCount() - lastWake;
+
+  // Whole slots that passed while the previous reading ran are lost
+  if (elapsed >= 2 * period) {
+    TickType_t skipped = elapsed / period - 1;
+    missedSlots = missedSlots + skipped;
+    lastWake += skipped * period;
+  }
+
+  vTaskDelayUntil(&lastWake, period);
+}
+
+bool AcquisitionTask::acquire(bool streamed) {
+  SampleRecord record;
+  record.timestamp = millis();
+  record.streamed = streamed;
+
+  if (!sensor.startReading())
+    return false;
+
+  // Sleep until the capture callback wakes us (other wake-ups just loop)
+  TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(READ_TIMEOUT_MS);
+  while (!sensor.takeReading(record.color)) {
+    // Ended without a result (unless it completed just now): a capture
+    // step was refused
+    if (!sensor.isReading()) {
+      if (sensor.takeReading(record.color))
+        break;
+      metrics.count(COUNTER_READ_STALLS);
+      return false;
+    }
+    TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(deadline - now) <= 0) {
+      Serial.println("WARNING: Acquisition timed out!");
+      metrics.count(COUNTER_READ_STALLS);
+      sensor.abortReading();
+      return false;
+    }
+    ulTaskNotifyTake(pdTRUE, deadline - now);
+  }
+
+  record.raw = sensor.getLastRaw();
+  readings = readings + 1;
+  ring.push(record);
+  return true;
+}
+
+#else
+
+// ============================================================================
+// Host Simulation (same schedule as the task, stepped by poll())
+// ============================================================================
+
+// poll() notices completion itself, there is no task to wake
+void AcquisitionTask::onReadingReady(void *context) {}
+
+void AcquisitionTask::poll() {
+  if (inFlight) {
+    finish();
+    if (inFlight)
+      return;
+  }
+
+  if (!streaming) {
+    scheduled = false;
+    if (requested) {
+      requested = false;
+      start(false);
+    }
+    return;
+  }
+
+  unsigned long period = streamPeriodMs;
+  if (period == 0) {
+    start(true);
+    return;
+  }
+
+  unsigned long now = millis();
+  if (!scheduled) {
+    nextSlot = now + period; // Slots count from the start request
+    scheduled = true;
+  }
+  if ((long)(now - nextSlot) < 0)
+    return;
+
+  // Whole slots that passed while the previous reading ran are lost
+  unsigned long skipped = (now - nextSlot) / period;
+  missedSlots = missedSlots + skipped;
+  nextSlot += (skipped + 1) * period;
+
+  start(true);
+}
+
+void AcquisitionTask::start(bool streamed) {
+  pending.timestamp = millis();
+  pending.streamed = streamed;
+  inFlight = sensor.startReading();
+}
+
+void AcquisitionTask::finish() {
+  if (sensor.takeReading(pending.color)) {
+    pending.raw = sensor.getLastRaw();
+    readings = readings + 1;
+    ring.push(pending);
+    inFlight = false;
+  } else if (!sensor.isReading()) {
+    metrics.count(COUNTER_READ_STALLS); // A capture step was refused
+    inFlight = false;
+  } else if (millis() - pending.timestamp > READ_TIMEOUT_MS) {
+    Serial.println("WARNING: Acquisition timed out!");
+    metrics.count(COUNTER_READ_STALLS);
+    sensor.abortReading();
+    inFlight = false;
+  }
+}
+
+#endif
@@ -0,0 +1,206 @@
+#include "ble_packet.h"
+
+// ============================================================================
+// Byte Helpers
+// ============================================================================
+
+static void putU16(uint8_t *out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void putU32(uint8_t *out, uint32_t value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = value >> 24;
+}
+
+static uint16_t getU16(const uint8_t *in) {
+  return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t *in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) |
+         ((uint32_t)in[3] << 24);
+}
+
+// ============================================================================
+// Records
+// ============================================================================
+
+void encodeRecord(const ColorRecord &record, uint8_t *out) {
+  putU16(out, record.sequence);
+  putU32(out + 2, record.timestamp);
+  out[6] = record.red;
+  out[7] = record.green;
+  out[8] = record.blue;
+  out[9] = record.flags;
+  putU16(out + 10, record.rawRed);
+  putU16(out + 12, record.rawGreen);
+  putU16(out + 14, record.rawBlue);
+  putU16(out + 16, record.nameId);
+}
+
+void decodeRecord(const uint8_t *in, ColorRecord &record) {
+  record.sequence = getU16(in);
+  record.timestamp = getU32(in + 2);
+  record.red = in[6];
+  record.green = in[7];
+  record.blue = in[8];
+  record.flags = in[9];
+  record.rawRed = getU16(in + 10);
+  record.rawGreen = getU16(in + 12);
+  record.rawBlue = getU16(in + 14);
+  record.nameId = getU16(in + 16);
+}
+
+// ============================================================================
+// Packet Encoder
+// ============================================================================
+
+PacketEncoder::PacketEncoder() : recordCount(0), capacity(1) {
+  buffer[0] = BLE_PACKET_VERSION;
+  buffer[1] = 0;
+}
+
+uint8_t PacketEncoder::capacityForMtu(uint16_t mtu) {
+  size_t payload = mtu > BLE_ATT_OVERHEAD ? mtu - BLE_ATT_OVERHEAD : 0;
+  if (payload > BLE_MAX_PACKET_SIZE)
+    payload = BLE_MAX_PACKET_SIZE;
+
+  size_t records = payload > BLE_PACKET_HEADER_SIZE
+                       ? (payload - BLE_PACKET_HEADER_SIZE) / BLE_RECORD_SIZE
+                       : 0;
+  return records > 0 ? (uint8_t)records : 1;
+}
+
+void PacketEncoder::begin(uint16_t mtu) {
+  capacity = capacityForMtu(mtu);
+  clear();
+}
+
+void PacketEncoder::clear() {
+  recordCount = 0;
+  buffer[0] = BLE_PACKET_VERSION;
+  buffer[1] = 0;
+}
+
+bool PacketEncoder::add(const ColorRecord &record) {
+  if (isFull())
+    return false;
+
+  encodeRecord(record, buffer + size());
+  recordCount++;
+  buffer[1] = recordCount;
+  return true;
+}
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+size_t decodePacket(const uint8_t *data, size_t length, ColorRecord *out,
+                    size_t maxRecords) {
+  if (length < BLE_PACKET_HEADER_SIZE || data[0] != BLE_PACKET_VERSION)
+    return 0;
+
+  size_t count = data[1];
+  if (length != BLE_PACKET_HEADER_SIZE + count * BLE_RECORD_SIZE)
+    return 0;
+
+  if (count > maxRecords)
+    count = maxRecords;
+
+  for (size_t i = 0; i < count; i++) {
+    decodeRecord(data + BLE_PACKET_HEADER_SIZE + i * BLE_RECORD_SIZE, out[i]);
+  }
+  return count;
+}
+
+// ============================================================================
+// Stats Snapshot
+// ============================================================================
+
+void encodeStats(const StatsSnapshot &stats, uint8_t *out) {
+  out[0] = BLE_STATS_VERSION;
+  out[1] = stats.clients;
+  putU32(out + 2, stats.uptime);
+  putU32(out + 6, stats.loopMaxUs);
+  putU32(out + 10, stats.loopOverruns);
+  putU32(out + 14, stats.journalLast);
+  out[18] = COUNTER_COUNT;
+  out[19] = GAUGE_COUNT;
+  out[20] = HISTOGRAM_COUNT;
+  out[21] = METRICS_BUCKETS;
+
+  uint8_t *p = out + 22;
+  const MetricsSnapshot &m = stats.metrics;
+  for (uint8_t i = 0; i < COUNTER_COUNT; i++, p += 4) {
+    putU32(p, m.counters[i]);
+  }
+  for (uint8_t i = 0; i < GAUGE_COUNT; i++, p += 4) {
+    putU32(p, m.gauges[i]);
+  }
+  for (uint8_t i = 0; i < HISTOGRAM_COUNT; i++) {
+    putU32(p, m.histograms[i].max);
+    p += 4;
+    for (uint8_t b = 0; b < METRICS_BUCKETS; b++, p += 4) {
+      putU32(p, m.histograms[i].buckets[b]);
+    }
+  }
+}
+
+// Reads count u32 words into the known ones, zeroing those not sent;
+// returns the position after all of them
+static const uint8_t *readWords(const uint8_t *p, uint8_t count,
+                                uint32_t *out, uint8_t known) {
+  for (uint8_t i = 0; i < known; i++) {
+    out[i] = i < count ? getU32(p + 4 * i) : 0;
+  }
+  return p + 4 * count;
+}
+
+// Goes by the counts in the header, so a snapshot from firmware with more
+// or fewer metrics still decodes: unknown ones are skipped, missing ones
+// read as 0. Buckets past the last known one are above its lower bound,
+// so they are added to it.
+bool decodeStats(const uint8_t *in, size_t length, StatsSnapshot &stats) {
+  if (length < 22 || in[0] != BLE_STATS_VERSION)
+    return false;
+
+  uint8_t counters = in[18];
+  uint8_t gauges = in[19];
+  uint8_t histograms = in[20];
+  uint8_t buckets = in[21];
+  if (length < 22 + 4 * ((size_t)counters + gauges) +
+                   (size_t)histograms * 4 * (1 + buckets))
+    return false;
+
+  stats.clients = in[1];
+  stats.uptime = getU32(in + 2);
+  stats.loopMaxUs = getU32(in + 6);
+  stats.loopOverruns = getU32(in + 10);
+  stats.journalLast = getU32(in + 14);
+
+  const uint8_t *p = in + 22;
+  MetricsSnapshot &m = stats.metrics;
+  p = readWords(p, counters, m.counters, COUNTER_COUNT);
+  p = readWords(p, gauges, m.gauges, GAUGE_COUNT);
+  for (uint8_t i = 0; i < histograms; i++) {
+    if (i >= HISTOGRAM_COUNT) {
+      p += 4 * (1 + buckets);
+      continue;
+    }
+    HistogramSnapshot &h = m.histograms[i];
+    h.max = getU32(p);
+    p = readWords(p + 4, buckets, h.buckets, METRICS_BUCKETS);
+    for (uint8_t b = METRICS_BUCKETS; b < buckets; b++) {
+      h.buckets[METRICS_BUCKETS - 1] += getU32(p - 4 * (buckets - b));
+    }
+  }
+  for (uint8_t i = histograms; i < HISTOGRAM_COUNT; i++) {
+    m.histograms[i] = {};
+  }
+  return true;
+}
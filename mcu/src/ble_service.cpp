@@ -1,24 +1,196 @@
 #include "ble_service.h"
+#include "metrics.h"
 
-static bool _deviceConnected = false;
+// One central; connId is the stack's connection id
+struct BleClient {
+  volatile bool connected;
+  uint16_t connId;
+  esp_bd_addr_t address;
+  volatile uint16_t mtu;
+  volatile uint8_t subscriptions; // Bit per BleChannel, from its CCCD writes
+};
+
+static BleClient _clients[BLE_MAX_CLIENTS];
+static volatile uint32_t _connections = 0;
+static bool _lowPower = false;
+static BLE2902 *_cccd[BLE_CHANNEL_COUNT];
+static BleWriteHandler _writeHandlers[BLE_CHANNEL_COUNT];
+static void *_writeContexts[BLE_CHANNEL_COUNT];
+
+static const struct {
+  const char *uuid;
+  uint32_t properties;
+} CHANNELS[BLE_CHANNEL_COUNT] = {
+    {RESULT_CHARACTERISTIC_UUID, BLECharacteristic::PROPERTY_READ |
+                                     BLECharacteristic::PROPERTY_NOTIFY |
+                                     BLECharacteristic::PROPERTY_INDICATE},
+    {STREAM_CHARACTERISTIC_UUID, BLECharacteristic::PROPERTY_NOTIFY},
+    {CONFIG_CHARACTERISTIC_UUID, BLECharacteristic::PROPERTY_READ |
+                                     BLECharacteristic::PROPERTY_WRITE |
+                                     BLECharacteristic::PROPERTY_NOTIFY},
+    {STATS_CHARACTERISTIC_UUID,
+     BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY},
+    {SYNC_CHARACTERISTIC_UUID, BLECharacteristic::PROPERTY_WRITE |
+                                   BLECharacteristic::PROPERTY_WRITE_NR |
+                                   BLECharacteristic::PROPERTY_NOTIFY},
+};
+
+static BleClient *findClient(uint16_t connId) {
+  for (BleClient &client : _clients) {
+    if (client.connected && client.connId == connId)
+      return &client;
+  }
+  return nullptr;
+}
+
+static uint8_t clientCount() {
+  uint8_t count = 0;
+  for (const BleClient &client : _clients) {
+    if (client.connected)
+      count++;
+  }
+  return count;
+}
+
+static void requestConnParams(BLEServer *pServer, BleClient &client,
+                              bool lowPower) {
+  if (lowPower) {
+    pServer->updateConnParams(client.address, BLE_IDLE_MIN_INTERVAL,
+                              BLE_IDLE_MAX_INTERVAL, BLE_IDLE_LATENCY,
+                              BLE_IDLE_TIMEOUT);
+  } else {
+    pServer->updateConnParams(client.address, BLE_ACTIVE_MIN_INTERVAL,
+                              BLE_ACTIVE_MAX_INTERVAL, BLE_ACTIVE_LATENCY,
+                              BLE_ACTIVE_TIMEOUT);
+  }
+}
 
 class ServerCallbacks : public BLEServerCallbacks {
-  void onConnect(BLEServer *pServer) {
-    _deviceConnected = true;
-    Serial.println("BLE Client connected");
+  void onConnect(BLEServer *pServer, esp_ble_gatts_cb_param_t *param) {
+    BleClient *client = nullptr;
+    for (BleClient &slot : _clients) {
+      if (!slot.connected) {
+        client = &slot;
+        break;
+      }
+    }
+    if (!client) {
+      pServer->disconnect(param->connect.conn_id);
+      return;
+    }
+
+    client->connId = param->connect.conn_id;
+    memcpy(client->address, param->connect.remote_bda,
+           sizeof(client->address));
+    client->mtu = BLE_DEFAULT_MTU;
+    client->subscriptions = 0;
+    client->connected = true;
+    _connections++;
+    Serial.print("BLE Client ");
+    Serial.print(client->connId);
+    Serial.print(" connected (");
+    Serial.print(clientCount());
+    Serial.print(" of ");
+    Serial.print(BLE_MAX_CLIENTS);
+    Serial.println(")");
+
+    if (_lowPower) {
+      requestConnParams(pServer, *client, true);
+    }
+    // The stack stops advertising on every connection
+    if (clientCount() < BLE_MAX_CLIENTS) {
+      pServer->startAdvertising();
+    }
   }
 
-  void onDisconnect(BLEServer *pServer) {
-    _deviceConnected = false;
-    Serial.println("BLE Client disconnected");
+  void onDisconnect(BLEServer *pServer, esp_ble_gatts_cb_param_t *param) {
+    BleClient *client = findClient(param->disconnect.conn_id);
+    if (!client)
+      return;
+
+    client->connected = false;
+    client->subscriptions = 0;
+    Serial.print("BLE Client ");
+    Serial.print(client->connId);
+    Serial.println(" disconnected");
     pServer->startAdvertising();
   }
+
+  void onMtuChanged(BLEServer *pServer, esp_ble_gatts_cb_param_t *param) {
+    BleClient *client = findClient(param->mtu.conn_id);
+    if (!client)
+      return;
+
+    client->mtu = param->mtu.mtu;
+    Serial.print("BLE MTU: ");
+    Serial.print(client->mtu);
+    Serial.print(" (client ");
+    Serial.print(client->connId);
+    Serial.println(")");
+  }
+};
+
+class WriteCallbacks : public BLECharacteristicCallbacks {
+public:
+  explicit WriteCallbacks(BleChannel ch) : channel(ch) {}
+
+  void onWrite(BLECharacteristic *pCharacteristic,
+               esp_ble_gatts_cb_param_t *param) {
+    if (_writeHandlers[channel]) {
+      _writeHandlers[channel](_writeContexts[channel], param->write.conn_id,
+                              pCharacteristic->getData(),
+                              pCharacteristic->getLength());
+    }
+  }
+
+private:
+  BleChannel channel;
 };
 
-Bluetooth::Bluetooth() : pServer(nullptr), pCharacteristic(nullptr) {}
+// The library keeps one CCCD value for all centrals; this tracks each
+// client's own from the descriptor writes
+static void gattsHandler(esp_gatts_cb_event_t event, esp_gatt_if_t gattsIf,
+                         esp_ble_gatts_cb_param_t *param) {
+  if (event != ESP_GATTS_WRITE_EVT || param->write.len < 1)
+    return;
+  BleClient *client = findClient(param->write.conn_id);
+  if (!client)
+    return;
+
+  for (uint8_t channel = 0; channel < BLE_CHANNEL_COUNT; channel++) {
+    if (!_cccd[channel] || _cccd[channel]->getHandle() != param->write.handle)
+      continue;
+    // Bit 0 notifications, bit 1 indications
+    if (param->write.value[0] & 0x03) {
+      client->subscriptions |= 1 << channel;
+    } else {
+      client->subscriptions &= ~(1 << channel);
+    }
+  }
+}
+
+static bool hasCccd(uint32_t properties) {
+  return properties & (BLECharacteristic::PROPERTY_NOTIFY |
+                       BLECharacteristic::PROPERTY_INDICATE);
+}
+
+// Attribute handles the service reserves: 1 for the service, 2 per
+// characteristic (declaration and value), 1 per CCCD. The library default
+// of 15 is one short for five notifying characteristics.
+static uint32_t serviceHandles() {
+  uint32_t handles = 1;
+  for (uint8_t channel = 0; channel < BLE_CHANNEL_COUNT; channel++) {
+    handles += hasCccd(CHANNELS[channel].properties) ? 3 : 2;
+  }
+  return handles;
+}
+
+Bluetooth::Bluetooth() : pServer(nullptr), characteristics{} {}
 
 void Bluetooth::begin(const char *deviceName) {
   BLEDevice::init(deviceName);
+  BLEDevice::setMTU(BLE_PREFERRED_MTU);
+  BLEDevice::setCustomGattsHandler(gattsHandler);
 
   // Set TX power to maximum for better range
   esp_ble_tx_power_set(ESP_BLE_PWR_TYPE_DEFAULT, ESP_PWR_LVL_P9);
@@ -27,15 +199,23 @@ void Bluetooth::begin(const char *deviceName) {
   pServer = BLEDevice::createServer();
   pServer->setCallbacks(new ServerCallbacks());
 
-  BLEService *pService = pServer->createService(SERVICE_UUID);
+  BLEService *pService =
+      pServer->createService(SERVICE_UUID, serviceHandles());
 
-  pCharacteristic = pService->createCharacteristic(
-      CHARACTERISTIC_UUID, BLECharacteristic::PROPERTY_READ |
-                               BLECharacteristic::PROPERTY_WRITE |
-                               BLECharacteristic::PROPERTY_NOTIFY |
-                               BLECharacteristic::PROPERTY_INDICATE);
-
-  pCharacteristic->addDescriptor(new BLE2902());
+  for (uint8_t channel = 0; channel < BLE_CHANNEL_COUNT; channel++) {
+    uint32_t properties = CHANNELS[channel].properties;
+    characteristics[channel] =
+        pService->createCharacteristic(CHANNELS[channel].uuid, properties);
+    if (hasCccd(properties)) {
+      _cccd[channel] = new BLE2902();
+      characteristics[channel]->addDescriptor(_cccd[channel]);
+    }
+    if (properties & (BLECharacteristic::PROPERTY_WRITE |
+                      BLECharacteristic::PROPERTY_WRITE_NR)) {
+      characteristics[channel]->setCallbacks(
+          new WriteCallbacks((BleChannel)channel));
+    }
+  }
   pService->start();
 
   // iOS-compatible advertising settings
@@ -50,14 +230,119 @@ void Bluetooth::begin(const char *deviceName) {
   Serial.println("Waiting for connections...");
 }
 
-void Bluetooth::send(const String &data) {
-  if (_deviceConnected) {
-    pCharacteristic->setValue(data.c_str());
-    pCharacteristic->notify();
+uint8_t Bluetooth::publish(BleChannel channel, const uint8_t *data,
+                           size_t length) {
+  BLECharacteristic *characteristic = characteristics[channel];
+  if (!characteristic)
+    return 0;
 
-    Serial.print("BLE sent: ");
-    Serial.println(data);
+  characteristic->setValue(const_cast<uint8_t *>(data), length);
+  uint8_t sent = 0;
+  for (BleClient &client : _clients) {
+    if (!client.connected || !(client.subscriptions & (1 << channel)))
+      continue;
+    esp_err_t err = esp_ble_gatts_send_indicate(
+        pServer->getGattsIf(), client.connId, characteristic->getHandle(),
+        length, const_cast<uint8_t *>(data), false);
+    if (err == ESP_OK) {
+      metrics.count(COUNTER_BLE_NOTIFIED);
+      sent++;
+    } else {
+      metrics.count(COUNTER_BLE_NOTIFY_FAILED);
+    }
   }
+  return sent;
+}
+
+bool Bluetooth::canSendBulk(uint16_t connId) {
+  return findClient(connId) &&
+         esp_ble_get_cur_sendable_packets_num(connId) > BLE_BULK_RESERVE;
+}
+
+bool Bluetooth::sendBulk(uint16_t connId, BleChannel channel,
+                         const uint8_t *data, size_t length) {
+  BLECharacteristic *characteristic = characteristics[channel];
+  if (!characteristic || !isSubscribed(connId, channel))
+    return false;
+
+  // Not stored as the value: another client may read the characteristic
+  return esp_ble_gatts_send_indicate(pServer->getGattsIf(), connId,
+                                     characteristic->getHandle(), length,
+                                     const_cast<uint8_t *>(data),
+                                     false) == ESP_OK;
+}
+
+void Bluetooth::onWrite(BleChannel channel, BleWriteHandler handler,
+                        void *context) {
+  _writeContexts[channel] = context;
+  _writeHandlers[channel] = handler;
+}
+
+bool Bluetooth::isConnected() { return clientCount() > 0; }
+
+bool Bluetooth::isConnected(uint16_t connId) {
+  return findClient(connId) != nullptr;
+}
+
+bool Bluetooth::isSubscribed(BleChannel channel) {
+  for (const BleClient &client : _clients) {
+    if (client.connected && (client.subscriptions & (1 << channel)))
+      return true;
+  }
+  return false;
+}
+
+bool Bluetooth::isSubscribed(uint16_t connId, BleChannel channel) {
+  BleClient *client = findClient(connId);
+  return client && (client->subscriptions & (1 << channel));
 }
 
-bool Bluetooth::isConnected() { return _deviceConnected; }
+uint16_t Bluetooth::getMtu() {
+  uint16_t mtu = 0;
+  for (const BleClient &client : _clients) {
+    if (client.connected && (mtu == 0 || client.mtu < mtu))
+      mtu = client.mtu;
+  }
+  return mtu ? mtu : BLE_DEFAULT_MTU;
+}
+
+uint16_t Bluetooth::getMtu(uint16_t connId) {
+  BleClient *client = findClient(connId);
+  return client ? client->mtu : BLE_DEFAULT_MTU;
+}
+
+BleStats Bluetooth::getStats() const {
+  BleStats stats;
+  stats.clients = clientCount();
+  stats.connections = _connections;
+  stats.notified = metrics.get(COUNTER_BLE_NOTIFIED);
+  stats.failed = metrics.get(COUNTER_BLE_NOTIFY_FAILED);
+  return stats;
+}
+
+void Bluetooth::setLowPower(bool enabled) {
+  if (enabled == _lowPower)
+    return;
+  _lowPower = enabled;
+  if (!pServer)
+    return;
+  for (BleClient &client : _clients) {
+    if (client.connected)
+      requestConnParams(pServer, client, enabled);
+  }
+}
+
+void Bluetooth::requestFastConnection(uint16_t connId) {
+  BleClient *client = findClient(connId);
+  if (pServer && client) {
+    requestConnParams(pServer, *client, false);
+  }
+}
+
+void Bluetooth::pauseAdvertising() { BLEDevice::stopAdvertising(); }
+
+void Bluetooth::resumeAdvertising() {
+  if (clientCount() < BLE_MAX_CLIENTS) {
+    BLEDevice::startAdvertising();
+  }
+}
@@ -0,0 +1,36 @@
+#include "boot_log.h"
+
+BootLog::BootLog() : phases{}, count(0) {}
+
+void BootLog::mark(const char *phase) {
+  uint32_t now = micros();
+  uint8_t index = count.fetch_add(1);
+  if (index >= MAX_PHASES) {
+    count.store(MAX_PHASES);
+    return;
+  }
+  phases[index].name = phase;
+  phases[index].us = now;
+}
+
+uint32_t BootLog::getLastMs() const {
+  uint8_t n = count.load();
+  uint32_t last = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    last = max(last, phases[i].us);
+  }
+  return last / 1000;
+}
+
+void BootLog::print(Print &out) const {
+  uint8_t n = count.load();
+  out.print("Boot:");
+  for (uint8_t i = 0; i < n; i++) {
+    out.print(i == 0 ? " " : ", ");
+    out.print(phases[i].name);
+    out.print(" ");
+    out.print(phases[i].us / 1000);
+    out.print(" ms");
+  }
+  out.println();
+}
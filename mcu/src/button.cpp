@@ -1,114 +1,146 @@
 #include "button.h"
 
 Button::Button(uint8_t buttonPin)
-    : pin(buttonPin), pressStartTime(0), lastPressDuration(0),
-      lastDebounceTime(0), lastTapTime(0), tapCount(0), wasPressedBefore(false),
-      lastStableState(false) {}
+    : pin(buttonPin), rawPressed(false), rawEdgeUs(0), bounceStartUs(0),
+      stablePressed(false), pressStartUs(0), holdThresholdsUs{}, holdCount(0),
+      nextHold(0), tapCount(0), lastTapUs(0) {}
 
 void Button::begin() {
   pinMode(pin, INPUT_PULLUP);
-  lastStableState = digitalRead(pin) == LOW;
+  rawPressed = stablePressed = digitalRead(pin) == LOW;
+  rawEdgeUs = bounceStartUs = pressStartUs = micros();
+  attachInterruptArg(digitalPinToInterrupt(pin), onEdge, this, CHANGE);
 }
 
+void Button::setHoldThresholds(const unsigned long *ms, uint8_t count) {
+  holdCount = count < MAX_HOLD_THRESHOLDS ? count : MAX_HOLD_THRESHOLDS;
+  for (uint8_t i = 0; i < holdCount; i++) {
+    holdThresholdsUs[i] = ms[i] * 1000;
+  }
+}
+
+unsigned long Button::getPressedDuration() const {
+  return stablePressed ? (micros() - pressStartUs) / 1000 : 0;
+}
+
+bool Button::pollEvent(ButtonEvent &event) { return events.pop(event); }
+
 // ============================================================================
-// Core State
+// Edge Interrupt
 // ============================================================================
 
-void Button::update() {
-  bool currentlyPressed = isPressed();
-
-  if (currentlyPressed && !wasPressedBefore) {
-    // Just pressed
-    pressStartTime = millis();
-    wasPressedBefore = true;
-  } else if (!currentlyPressed && wasPressedBefore) {
-    // Just released
-    lastPressDuration = millis() - pressStartTime;
-    wasPressedBefore = false;
-    pressStartTime = 0;
-  }
+void IRAM_ATTR Button::onEdge(void *arg) {
+  Button *self = static_cast<Button *>(arg);
+  Edge edge = {(uint32_t)micros(), digitalRead(self->pin) == LOW};
+  self->edges.push(edge);
 }
 
-bool Button::isPressed() {
-  bool reading = digitalRead(pin) == LOW;
+// ============================================================================
+// Debouncing
+// ============================================================================
 
-  if (reading != lastStableState) {
-    if (millis() - lastDebounceTime > DEBOUNCE_DELAY) {
-      lastStableState = reading;
-      lastDebounceTime = millis();
-    }
-  } else {
-    lastDebounceTime = millis();
+void Button::update() {
+  Edge edge;
+  while (edges.pop(edge)) {
+    addEdge(edge.timeUs, edge.pressed);
   }
 
-  return lastStableState;
+  // An edge lost to a full queue (or raced with the pop) would leave the
+  // raw level stale; the pin itself is the truth
+  uint32_t nowUs = micros();
+  bool level = digitalRead(pin) == LOW;
+  if (level != rawPressed && edges.isEmpty()) {
+    addEdge(nowUs, level);
+  }
+
+  settle(nowUs);
+  if (stablePressed) {
+    emitHolds(nowUs);
+  }
+  checkTapTimeout(nowUs);
 }
 
-bool Button::isPressedFor(unsigned long durationMs) {
-  if (isPressed() && wasPressedBefore) {
-    return (millis() - pressStartTime) >= durationMs;
+void Button::addEdge(uint32_t timeUs, bool pressed) {
+  // The level before this edge may have held long enough to count
+  settle(timeUs);
+  if (pressed == rawPressed)
+    return; // Two edges coalesced into one interrupt
+
+  // Edges closer together than DEBOUNCE_US belong to the same bounce, even
+  // if it passes through the stable level on the way
+  if (rawPressed == stablePressed &&
+      (int32_t)(timeUs - rawEdgeUs) >= (int32_t)DEBOUNCE_US) {
+    bounceStartUs = timeUs;
   }
-  return false;
+  rawPressed = pressed;
+  rawEdgeUs = timeUs;
 }
 
-unsigned long Button::getPressedDuration() {
-  if (isPressed() && wasPressedBefore) {
-    return millis() - pressStartTime;
+// Accepts the raw level once it has been quiet for DEBOUNCE_US; a bounce
+// that returns to the stable level is ignored
+void Button::settle(uint32_t nowUs) {
+  if (rawPressed == stablePressed ||
+      (int32_t)(nowUs - rawEdgeUs) < (int32_t)DEBOUNCE_US)
+    return;
+
+  stablePressed = rawPressed;
+  if (stablePressed) {
+    onPress(bounceStartUs);
+  } else {
+    onRelease(bounceStartUs);
   }
-  return 0;
 }
 
 // ============================================================================
-// Edge Detection
+// Gesture Recognizer
 // ============================================================================
 
-bool Button::wasJustPressed() {
-  static bool lastState = false;
-  bool currentState = isPressed();
-  bool justPressed = currentState && !lastState;
-  lastState = currentState;
-  return justPressed;
+void Button::onPress(uint32_t timeUs) {
+  pressStartUs = timeUs;
+  nextHold = 0;
+  emit(BUTTON_PRESS, timeUs);
 }
 
-bool Button::wasJustReleased() {
-  static bool lastState = false;
-  bool currentState = isPressed();
-  bool justReleased = !currentState && lastState;
-  lastState = currentState;
-  return justReleased;
-}
+void Button::onRelease(uint32_t timeUs) {
+  emitHolds(timeUs);
 
-// ============================================================================
-// Multi-Tap Detection
-// ============================================================================
+  uint32_t durationUs = timeUs - pressStartUs;
+  emit(BUTTON_RELEASE, timeUs, durationUs);
 
-void Button::updateTapCount() {
-  static bool wasPressed = false;
-  bool currentlyPressed = isPressed();
-
-  // Detect button release (end of tap)
-  if (wasPressed && !currentlyPressed) {
-    // Only count short presses as taps
-    unsigned long pressDuration = millis() - pressStartTime;
-    if (pressDuration < SHORT_PRESS_MAX) {
-      tapCount++;
-      lastTapTime = millis();
-    }
+  // Only short presses count as taps
+  if (durationUs < SHORT_PRESS_MAX * 1000) {
+    tapCount++;
+    lastTapUs = timeUs;
   }
-
-  wasPressed = currentlyPressed;
 }
 
-int Button::getTapCount() {
-  // Return count only after timeout (tapping sequence complete)
-  bool sequenceComplete = (millis() - lastTapTime) > TAP_TIMEOUT;
-  if (tapCount > 0 && sequenceComplete && !isPressed()) {
-    return tapCount;
+void Button::emitHolds(uint32_t untilUs) {
+  while (nextHold < holdCount &&
+         untilUs - pressStartUs >= holdThresholdsUs[nextHold]) {
+    emit(BUTTON_HOLD, pressStartUs + holdThresholdsUs[nextHold],
+         holdThresholdsUs[nextHold], 0, nextHold);
+    nextHold++;
   }
-  return 0;
 }
 
-void Button::resetTapCount() {
+void Button::checkTapTimeout(uint32_t nowUs) {
+  if (tapCount == 0 || stablePressed)
+    return;
+
+  // A press that is still bouncing in before the deadline continues the
+  // sequence
+  uint32_t deadlineUs = lastTapUs + TAP_TIMEOUT * 1000;
+  bool pressPending = rawPressed && !stablePressed;
+  if ((int32_t)(nowUs - deadlineUs) <= 0 ||
+      (pressPending && (int32_t)(bounceStartUs - deadlineUs) <= 0))
+    return;
+
+  emit(BUTTON_TAPS, deadlineUs, 0, tapCount);
   tapCount = 0;
-  lastTapTime = 0;
+}
+
+void Button::emit(ButtonEventType type, uint32_t timeUs, uint32_t durationUs,
+                  uint8_t count, uint8_t threshold) {
+  ButtonEvent event = {type, timeUs, durationUs, count, threshold};
+  events.push(event);
 }
@@ -0,0 +1,25 @@
+#include "calibration.h"
+
+ChannelMap::ChannelMap() : white(0), span(1), table{} {}
+
+bool ChannelMap::build(uint16_t whitePeriod, uint16_t blackPeriod) {
+  if (blackPeriod <= whitePeriod || blackPeriod - whitePeriod > TABLE_SIZE)
+    return false;
+
+  white = whitePeriod;
+  span = blackPeriod - whitePeriod;
+
+  // Same result as constrain(map(p, white, black, 255, 0), 0, 255)
+  for (uint16_t offset = 0; offset < span; offset++) {
+    table[offset] = 255 - (uint32_t)offset * 255 / span;
+  }
+  return true;
+}
+
+bool CalibrationTable::build(const CalibrationProfile &profile) {
+  for (uint8_t i = 0; i < 3; i++) {
+    if (!channels[i].build(profile.white[i], profile.black[i]))
+      return false;
+  }
+  return true;
+}
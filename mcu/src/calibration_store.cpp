@@ -0,0 +1,111 @@
+#include "calibration_store.h"
+
+static const char *PREFS_NAMESPACE = "calibration";
+static const char *ACTIVE_KEY = "active";
+
+// NVS blob layout: version byte followed by the profile
+struct StoredProfile {
+  uint8_t version;
+  CalibrationProfile profile;
+};
+
+CalibrationStore::CalibrationStore()
+    : activeSlot(0), active(defaultProfile(0)) {}
+
+void CalibrationStore::begin() {
+  if (!prefs.begin(PREFS_NAMESPACE, false)) {
+    Serial.println("WARNING: Calibration storage unavailable!");
+    return;
+  }
+
+  activeSlot = prefs.getUChar(ACTIVE_KEY, 0);
+  if (activeSlot >= MAX_PROFILES) {
+    activeSlot = 0;
+  }
+  if (!load(activeSlot, active)) {
+    active = defaultProfile(activeSlot);
+  }
+
+  Serial.print("Calibration profile: ");
+  Serial.println(active.name);
+}
+
+bool CalibrationStore::select(uint8_t slot) {
+  if (slot >= MAX_PROFILES)
+    return false;
+
+  CalibrationProfile profile;
+  if (!load(slot, profile)) {
+    profile = defaultProfile(slot);
+  }
+
+  activeSlot = slot;
+  active = profile;
+  prefs.putUChar(ACTIVE_KEY, slot);
+  return true;
+}
+
+bool CalibrationStore::saveActive(const CalibrationProfile &profile) {
+  if (!save(activeSlot, profile))
+    return false;
+  active = profile;
+  return true;
+}
+
+bool CalibrationStore::load(uint8_t slot, CalibrationProfile &profile) {
+  char key[4];
+  slotKey(slot, key);
+
+  StoredProfile stored;
+  if (prefs.getBytesLength(key) != sizeof(stored))
+    return false;
+  prefs.getBytes(key, &stored, sizeof(stored));
+
+  if (stored.version != PROFILE_VERSION || !isValid(stored.profile))
+    return false;
+
+  profile = stored.profile;
+  profile.name[CALIBRATION_NAME_LEN - 1] = '\0';
+  return true;
+}
+
+bool CalibrationStore::save(uint8_t slot, const CalibrationProfile &profile) {
+  if (slot >= MAX_PROFILES || !isValid(profile))
+    return false;
+
+  char key[4];
+  slotKey(slot, key);
+
+  StoredProfile stored;
+  stored.version = PROFILE_VERSION;
+  stored.profile = profile;
+  return prefs.putBytes(key, &stored, sizeof(stored)) == sizeof(stored);
+}
+
+CalibrationProfile CalibrationStore::defaultProfile(uint8_t slot) {
+  CalibrationProfile profile;
+  snprintf(profile.name, sizeof(profile.name), "Profile %u", slot + 1);
+  profile.white[0] = DEFAULT_WHITE_RED;
+  profile.white[1] = DEFAULT_WHITE_GREEN;
+  profile.white[2] = DEFAULT_WHITE_BLUE;
+  profile.black[0] = DEFAULT_BLACK_RED;
+  profile.black[1] = DEFAULT_BLACK_GREEN;
+  profile.black[2] = DEFAULT_BLACK_BLUE;
+  return profile;
+}
+
+// A profile is usable when every channel fits a ChannelMap table
+bool CalibrationStore::isValid(const CalibrationProfile &profile) {
+  for (uint8_t i = 0; i < 3; i++) {
+    if (profile.white[i] == 0 || profile.black[i] <= profile.white[i] ||
+        profile.black[i] - profile.white[i] > ChannelMap::TABLE_SIZE)
+      return false;
+  }
+  return true;
+}
+
+void CalibrationStore::slotKey(uint8_t slot, char *key) {
+  key[0] = 'p';
+  key[1] = '0' + slot;
+  key[2] = '\0';
+}
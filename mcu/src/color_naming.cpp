@@ -0,0 +1,68 @@
+#include "color_naming.h"
+#include "color_palette_data.h"
+
+static LabColor paletteLab(uint16_t id) {
+  LabColor lab;
+  lab.l = PaletteData::LAB[id][0];
+  lab.a = PaletteData::LAB[id][1];
+  lab.b = PaletteData::LAB[id][2];
+  return lab;
+}
+
+uint16_t ColorNaming::nearest(const LabColor &lab) {
+  const int16_t value[3] = {lab.l, lab.a, lab.b};
+
+  uint16_t node = 0;
+  while (PaletteData::NODES[node].axis != PaletteData::LEAF) {
+    const PaletteData::Node &inner = PaletteData::NODES[node];
+    node = value[inner.axis] < inner.value ? inner.index : inner.index + 1;
+  }
+
+  // Leaves outside the sRGB gamut have no candidates
+  const PaletteData::Node &leaf = PaletteData::NODES[node];
+  if (leaf.value == 0)
+    return nearestExhaustive(lab);
+
+  uint16_t best = PaletteData::ITEMS[leaf.index];
+  uint32_t bestDistance = deltaE2(lab, paletteLab(best));
+  for (int16_t i = 1; i < leaf.value; i++) {
+    uint16_t id = PaletteData::ITEMS[leaf.index + i];
+    uint32_t distance = deltaE2(lab, paletteLab(id));
+    if (distance < bestDistance) {
+      best = id;
+      bestDistance = distance;
+    }
+  }
+  return best;
+}
+
+uint16_t ColorNaming::nearestExhaustive(const LabColor &lab) {
+  uint16_t best = 0;
+  uint32_t bestDistance = UINT32_MAX;
+  for (uint16_t id = 0; id < PaletteData::SIZE; id++) {
+    uint32_t distance = deltaE2(lab, paletteLab(id));
+    if (distance < bestDistance) {
+      best = id;
+      bestDistance = distance;
+    }
+  }
+  return best;
+}
+
+const char *ColorNaming::nameFor(uint16_t id) {
+  if (id >= PaletteData::SIZE)
+    return "UNKNOWN";
+  return &PaletteData::NAMES[PaletteData::NAME_OFFSET[id]];
+}
+
+LabColor ColorNaming::labFor(uint16_t id) {
+  if (id >= PaletteData::SIZE)
+    return {0, 0, 0};
+  return paletteLab(id);
+}
+
+uint16_t ColorNaming::paletteSize() { return PaletteData::SIZE; }
+
+uint16_t ColorNaming::paletteMaxCandidates() {
+  return PaletteData::MAX_CANDIDATES;
+}
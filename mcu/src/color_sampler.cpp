@@ -1,17 +1,172 @@
 #include "color_sampler.h"
 
+// Two-sided 95% Student-t quantiles for 1..30 degrees of freedom
+static const float T_QUANTILES[30] = {
+    12.706f, 4.303f, 3.182f, 2.776f, 2.571f, 2.447f, 2.365f, 2.306f,
+    2.262f,  2.228f, 2.201f, 2.179f, 2.160f, 2.145f, 2.131f, 2.120f,
+    2.110f,  2.101f, 2.093f, 2.086f, 2.080f, 2.074f, 2.069f, 2.064f,
+    2.060f,  2.056f, 2.052f, 2.048f, 2.045f, 2.042f};
+
+// MAD to standard deviation for normally distributed data
+static const float MAD_SCALE = 1.4826f;
+
+static float tQuantile(int degreesOfFreedom)
+{
+  if (degreesOfFreedom < 1)
+    return 0.0f;
+  if (degreesOfFreedom > 30)
+    return 1.96f;
+  return T_QUANTILES[degreesOfFreedom - 1];
+}
+
+static void sortValues(float *values, int count)
+{
+  // Insertion sort; count is at most WINDOW_SIZE
+  for (int i = 1; i < count; i++)
+  {
+    float value = values[i];
+    int j = i - 1;
+    while (j >= 0 && values[j] > value)
+    {
+      values[j + 1] = values[j];
+      j--;
+    }
+    values[j + 1] = value;
+  }
+}
+
+static float median(float *values, int count)
+{
+  sortValues(values, count);
+  if (count % 2 == 1)
+    return values[count / 2];
+  return (values[count / 2 - 1] + values[count / 2]) / 2.0f;
+}
+
+// ============================================================================
+// Color Sampler
+// ============================================================================
+
 ColorSampler::ColorSampler()
-    : totalRed(0), totalGreen(0), totalBlue(0), sampleCount(0), sampling(false)
+    : windowHead(0), windowCount(0), sampleCount(0), rejectedCount(0),
+      confidenceTarget(CONFIDENCE_TARGET), sampling(false)
 {
+  reset();
 }
 
-void ColorSampler::addSample(const RGBColor &color)
+bool ColorSampler::addSample(const RGBColor &color, const RawFrequencies &raw)
 {
-  totalRed += color.red;
-  totalGreen += color.green;
-  totalBlue += color.blue;
-  sampleCount++;
   sampling = true;
+
+  // A capture that saw no edges maps to {0,0,0}; never average it in
+  if (raw.red == 0 || raw.green == 0 || raw.blue == 0 || isOutlier(color))
+  {
+    rejectedCount++;
+    return false;
+  }
+
+  sampleCount++;
+  window[windowHead].color = color;
+  window[windowHead].raw = raw;
+  windowHead = (windowHead + 1) % WINDOW_SIZE;
+  if (windowCount < WINDOW_SIZE)
+    windowCount++;
+
+  return true;
+}
+
+bool ColorSampler::isOutlier(const RGBColor &color)
+{
+  if (windowCount < MIN_SAMPLES_FOR_REJECTION)
+    return false;
+
+  const int value[3] = {color.red, color.green, color.blue};
+  float values[WINDOW_SIZE];
+
+  for (int channel = 0; channel < 3; channel++)
+  {
+    int count = collect(channel, values);
+    float center = median(values, count);
+    for (int i = 0; i < count; i++)
+    {
+      values[i] = fabsf(values[i] - center);
+    }
+    float spread = max(MAD_SCALE * median(values, count), MIN_MAD);
+
+    if (fabsf(value[channel] - center) > OUTLIER_MADS * spread)
+      return true;
+  }
+  return false;
+}
+
+int ColorSampler::collect(int channel, float *values)
+{
+  for (int i = 0; i < windowCount; i++)
+  {
+    const Entry &entry = window[i];
+    switch (channel)
+    {
+    case 0: values[i] = entry.color.red; break;
+    case 1: values[i] = entry.color.green; break;
+    case 2: values[i] = entry.color.blue; break;
+    case 3: values[i] = entry.raw.red; break;
+    case 4: values[i] = entry.raw.green; break;
+    default: values[i] = entry.raw.blue; break;
+    }
+  }
+  return windowCount;
+}
+
+float ColorSampler::trimmedMean(int channel)
+{
+  float values[WINDOW_SIZE];
+  int count = collect(channel, values);
+  if (count == 0)
+    return 0.0f;
+
+  sortValues(values, count);
+  int trim = count / TRIM_DIVISOR;
+  float total = 0.0f;
+  for (int i = trim; i < count - trim; i++)
+  {
+    total += values[i];
+  }
+  return total / (count - 2 * trim);
+}
+
+// Sample variance of one channel of the window. Winsorized, the values the
+// trimmed mean drops are first replaced by the nearest ones it keeps.
+float ColorSampler::variance(int channel, bool winsorized)
+{
+  float values[WINDOW_SIZE];
+  int count = collect(channel, values);
+  if (count < 2)
+    return 0.0f;
+
+  if (winsorized)
+  {
+    sortValues(values, count);
+    int trim = count / TRIM_DIVISOR;
+    for (int i = 0; i < trim; i++)
+    {
+      values[i] = values[trim];
+      values[count - 1 - i] = values[count - 1 - trim];
+    }
+  }
+
+  float mean = 0.0f;
+  for (int i = 0; i < count; i++)
+  {
+    mean += values[i];
+  }
+  mean /= count;
+
+  float squares = 0.0f;
+  for (int i = 0; i < count; i++)
+  {
+    squares += (values[i] - mean) * (values[i] - mean);
+  }
+  return squares / (count - 1);
 }
 
 RGBColor ColorSampler::getAverage()
@@ -20,9 +175,23 @@ RGBColor ColorSampler::getAverage()
 
   if (sampleCount > 0)
   {
-    avg.red = totalRed / sampleCount;
-    avg.green = totalGreen / sampleCount;
-    avg.blue = totalBlue / sampleCount;
+    avg.red = lroundf(trimmedMean(0));
+    avg.green = lroundf(trimmedMean(1));
+    avg.blue = lroundf(trimmedMean(2));
+  }
+
+  return avg;
+}
+
+RawFrequencies ColorSampler::getAverageRaw()
+{
+  RawFrequencies avg = {0, 0, 0};
+
+  if (sampleCount > 0)
+  {
+    avg.red = lroundf(trimmedMean(3));
+    avg.green = lroundf(trimmedMean(4));
+    avg.blue = lroundf(trimmedMean(5));
   }
 
   return avg;
@@ -33,6 +202,58 @@ int ColorSampler::getSampleCount()
   return sampleCount;
 }
 
+int ColorSampler::getRejectedCount()
+{
+  return rejectedCount;
+}
+
+SamplerStats ColorSampler::getStats()
+{
+  SamplerStats stats;
+  stats.accepted = sampleCount;
+  stats.rejected = rejectedCount;
+  for (int i = 0; i < 3; i++)
+  {
+    stats.stdDev[i] = sqrtf(variance(i, false));
+  }
+  stats.ciHalfWidth = getConfidenceHalfWidth();
+  return stats;
+}
+
+// Widest per-channel 95% confidence half-width of the trimmed mean. Yuen's
+// standard error: the winsorized spread of the window, scaled by the share
+// of samples the trim keeps, with one degree of freedom per kept sample
+// less one.
+float ColorSampler::getConfidenceHalfWidth()
+{
+  if (windowCount < MIN_CONFIDENT_SAMPLES)
+    return INFINITY;
+
+  float widest = 0.0f;
+  for (int i = 0; i < 3; i++)
+  {
+    widest = max(widest, variance(i, true));
+  }
+  int kept = windowCount - 2 * (windowCount / TRIM_DIVISOR);
+  float standardError = sqrtf(widest * windowCount) / kept;
+  return tQuantile(kept - 1) * standardError;
+}
+
+bool ColorSampler::isConfident()
+{
+  return getConfidenceHalfWidth() <= confidenceTarget;
+}
+
+void ColorSampler::setConfidenceTarget(float halfWidth)
+{
+  confidenceTarget = halfWidth;
+}
+
+float ColorSampler::getConfidenceTarget()
+{
+  return confidenceTarget;
+}
+
 bool ColorSampler::isSampling()
 {
   return sampling;
@@ -40,10 +261,10 @@ bool ColorSampler::isSampling()
 
 void ColorSampler::reset()
 {
-  totalRed = 0;
-  totalGreen = 0;
-  totalBlue = 0;
+  windowHead = 0;
+  windowCount = 0;
   sampleCount = 0;
+  rejectedCount = 0;
   sampling = false;
 }
 
@@ -56,21 +277,101 @@ void ColorSampler::printSample(const RGBColor &color)
   Serial.print(" G:");
   Serial.print(color.green);
   Serial.print(" B:");
-  Serial.println(color.blue);
+  Serial.print(color.blue);
+  if (windowCount >= MIN_CONFIDENT_SAMPLES)
+  {
+    Serial.print(" CI: +/-");
+    Serial.print(getConfidenceHalfWidth(), 1);
+  }
+  Serial.println();
 }
 
 void ColorSampler::printAverage(const RGBColor &avgColor, const String &colorName)
 {
+  SamplerStats stats = getStats();
   Serial.println("===== AVERAGE COLOR =====");
   Serial.print("Samples: ");
-  Serial.println(sampleCount);
+  Serial.print(stats.accepted);
+  Serial.print(" (rejected ");
+  Serial.print(stats.rejected);
+  Serial.println(")");
   Serial.print("Avg R:");
   Serial.print(avgColor.red);
   Serial.print(" G:");
   Serial.print(avgColor.green);
   Serial.print(" B:");
   Serial.println(avgColor.blue);
+  Serial.print("StdDev R:");
+  Serial.print(stats.stdDev[0], 1);
+  Serial.print(" G:");
+  Serial.print(stats.stdDev[1], 1);
+  Serial.print(" B:");
+  Serial.println(stats.stdDev[2], 1);
+  if (windowCount >= MIN_CONFIDENT_SAMPLES)
+  {
+    Serial.print("95% CI: +/-");
+    Serial.println(stats.ciHalfWidth, 1);
+  }
   Serial.print("Color: ");
   Serial.println(colorName);
   Serial.println("=========================");
 }
+
+// ============================================================================
+// Rolling Average
+// ============================================================================
+
+RollingAverage::RollingAverage()
+    : totalRed(0), totalGreen(0), totalBlue(0), head(0), count(0)
+{
+}
+
+void RollingAverage::add(const RGBColor &color)
+{
+  if (count == WINDOW_SIZE)
+  {
+    // Drop the oldest sample from the sums
+    const RGBColor &oldest = window[head];
+    totalRed -= oldest.red;
+    totalGreen -= oldest.green;
+    totalBlue -= oldest.blue;
+  }
+  else
+  {
+    count++;
+  }
+
+  window[head] = color;
+  totalRed += color.red;
+  totalGreen += color.green;
+  totalBlue += color.blue;
+  head = (head + 1) % WINDOW_SIZE;
+}
+
+RGBColor RollingAverage::getAverage()
+{
+  RGBColor avg = {0, 0, 0};
+
+  if (count > 0)
+  {
+    avg.red = totalRed / count;
+    avg.green = totalGreen / count;
+    avg.blue = totalBlue / count;
+  }
+
+  return avg;
+}
+
+int RollingAverage::getCount()
+{
+  return count;
+}
+
+void RollingAverage::reset()
+{
+  totalRed = 0;
+  totalGreen = 0;
+  totalBlue = 0;
+  head = 0;
+  count = 0;
+}
@@ -1,15 +1,49 @@
 #include "color_sensor.h"
+#include "color_naming.h"
+#include "metrics.h"
 
-// Comment out to disable debug output
+// Comment out to disable debug output (benchmark builds define
+// NO_DEBUG_SENSOR so readings do not print)
+#ifndef NO_DEBUG_SENSOR
 #define DEBUG_SENSOR
+#endif
+
+// Photodiode selection (S2, S3), indexed by SensorFilter
+static const bool FILTER_S2[4] = {false, true, false, true};
+static const bool FILTER_S3[4] = {false, true, true, false};
+
+// Output scaling (S0, S1) and its percentage, indexed by OutputScaling
+static const bool SCALING_S0[3] = {false, true, true};
+static const bool SCALING_S1[3] = {true, false, true};
+static const uint32_t SCALING_PERCENT[3] = {2, 20, 100};
+
+// Half-period at a scaling relative to 20%, times 100 (integer weights for
+// splitting the gate budget)
+static const uint32_t SCALING_WEIGHT[3] = {1000, 100, 20};
 
-static const unsigned long PULSE_TIMEOUT = 100000;
-static const unsigned long FILTER_SETTLING_TIME = 20;
+// Clear-channel ambient changes below this (mHz at 20%, a few edges of an
+// ambient gate) never force a refresh, so count noise in a dark room does
+// not trigger one every reading
+static const uint32_t AMBIENT_CHANGE_FLOOR_MHZ = 100000;
+
+// Blocking reads give up after this long (covers a stalled capture)
+static const unsigned long READ_TIMEOUT_MS = 500;
 
 ColorSensor::ColorSensor(uint8_t s0, uint8_t s1, uint8_t s2, uint8_t s3,
-                         uint8_t out, uint8_t led)
+                         uint8_t out, uint8_t led, FrequencyCapture &cap)
     : s0Pin(s0), s1Pin(s1), s2Pin(s2), s3Pin(s3), outPin(out), ledPin(led),
-      redFreq(0), greenFreq(0), blueFreq(0) {}
+      capture(cap),
+      requested{SETTLE_TIME_US, GATE_TIME_US, true, SCALING_20, false, 0},
+      settleTimeUs(SETTLE_TIME_US), gateTimeUs(GATE_TIME_US),
+      autoRange(true), fixedScaling(SCALING_20), ambientResets(0), plan{},
+      planSize(0),
+      nextPlanSet(false), nextPlan{}, nextPlanSize(0), ledOn(false),
+      ambientCapture(false), ambientMode(false), ambientValid(false),
+      readingsSinceRefresh(0), ambientMhz{0, 0, 0, 0}, ambientClearMhz(0),
+      stepIndex(0), readingStartUs(0), results{}, periods{0, 0, 0},
+      reading(false), readingReady(false), lastRaw({0, 0, 0}),
+      readyCallback(nullptr), readyContext(nullptr), captureObserver(nullptr),
+      captureContext(nullptr), activeTable(0) {}
 
 void ColorSensor::begin() {
   // Configure pins
@@ -20,12 +54,30 @@ void ColorSensor::begin() {
   pinMode(outPin, INPUT);
   pinMode(ledPin, OUTPUT);
 
-  // Set frequency scaling to 20%
-  digitalWrite(s0Pin, HIGH);
-  digitalWrite(s1Pin, LOW);
+  // Frequency scaling until the first reading picks its ranges
+  setScalingPins(requested.scaling);
 
   // Turn on sensor LED by default
-  digitalWrite(ledPin, HIGH);
+  setLed(true);
+
+  capture.onComplete(onCaptureComplete, this);
+  if (!capture.begin(outPin)) {
+    Serial.println("WARNING: Frequency capture init failed!");
+  }
+}
+
+// ============================================================================
+// Calibration
+// ============================================================================
+
+bool ColorSensor::setCalibration(const CalibrationProfile &profile) {
+  uint8_t next = activeTable.load() ^ 1;
+  if (!tables[next].build(profile)) {
+    Serial.println("WARNING: Invalid calibration profile!");
+    return false;
+  }
+  activeTable.store(next);
+  return true;
 }
 
 // ============================================================================
@@ -33,35 +85,426 @@ void ColorSensor::begin() {
 // ============================================================================
 
 void ColorSensor::ensureLedOn() {
-  if (digitalRead(ledPin) != HIGH) {
-    digitalWrite(ledPin, HIGH);
+  if (!ledOn) {
+    setLed(true);
+  }
+}
+
+void ColorSensor::toggleLed() { setLed(!ledOn); }
+
+void ColorSensor::setLed(bool on) {
+  ledOn = on;
+  // An ambient capture in progress keeps the LED off; the next LED-on
+  // capture applies the new state
+  if (!ambientCapture) {
+    digitalWrite(ledPin, on ? HIGH : LOW);
+  }
+}
+
+bool ColorSensor::isLedOn() { return ledOn; }
+
+// ============================================================================
+// Reading Plan
+// ============================================================================
+
+void ColorSensor::setCaptureTiming(uint32_t settleUs, uint32_t gateUs) {
+  requested.settleUs = settleUs;
+  requested.gateUs = gateUs;
+  publishSettings();
+}
+
+void ColorSensor::setAutoRange(bool enabled) {
+  requested.autoRange = enabled;
+  publishSettings();
+}
+
+void ColorSensor::setScaling(OutputScaling scaling) {
+  requested.scaling = scaling;
+  publishSettings();
+}
+
+void ColorSensor::setAmbientMode(bool enabled) {
+  requested.ambientMode = enabled;
+  requested.ambientResets++;
+  publishSettings();
+}
+
+void ColorSensor::publishSettings() {
+  pendingSettings.back() = requested;
+  pendingSettings.publish();
+}
+
+// Reading side, before planning: the whole set changes at once, never in
+// the middle of a reading
+void ColorSensor::applySettings() {
+  const SensorSettings *settings = pendingSettings.take();
+  if (!settings)
+    return;
+
+  settleTimeUs = settings->settleUs;
+  gateTimeUs = settings->gateUs;
+  autoRange = settings->autoRange;
+  fixedScaling = settings->scaling;
+  ambientMode = settings->ambientMode;
+  if (settings->ambientResets != ambientResets) {
+    ambientResets = settings->ambientResets;
+    ambientValid = false; // First reading measures every channel
+  }
+}
+
+bool ColorSensor::setNextPlan(const CaptureStep *steps, uint8_t count) {
+  if (count > MAX_STEPS)
+    return false;
+
+  uint8_t colors = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (steps[i].ambient || steps[i].filter == FILTER_CLEAR)
+      continue;
+    uint8_t bit = 1 << steps[i].filter;
+    if (colors & bit)
+      return false;
+    colors |= bit;
+  }
+  if (colors != 0x07)
+    return false;
+
+  for (uint8_t i = 0; i < count; i++) {
+    nextPlan[i] = steps[i];
+  }
+  nextPlanSize = count;
+  nextPlanSet = true;
+  return true;
+}
+
+// Highest scaling whose edge rate the capture still resolves. Counting
+// more edges only ever helps a gated count, so lower scalings are left for
+// an output near saturation.
+static OutputScaling scalingFor(unsigned long halfPeriod20) {
+  for (int s = SCALING_100; s > SCALING_2; s--) {
+    // Edge rate at scaling s: 1e6 / (halfPeriod20 * 20 / percent)
+    uint64_t rate = 1000000ULL * SCALING_PERCENT[s];
+    if (rate <= (uint64_t)ColorSensor::MAX_EDGE_RATE * 20 * halfPeriod20)
+      return (OutputScaling)s;
+  }
+  return SCALING_2;
+}
+
+// Output frequency at 20% scaling in mHz. Light adds up in frequency (not
+// in period), so ambient light is subtracted in this unit.
+static uint32_t frequencyMhz20(const CaptureResult &result,
+                               OutputScaling scaling) {
+  if (result.gateUs == 0)
+    return 0;
+  return (uint32_t)((uint64_t)result.edges * 500000000ULL * 20 /
+                    ((uint64_t)result.gateUs * SCALING_PERCENT[scaling]));
+}
+
+bool ColorSensor::needsAmbientRefresh() {
+  if (!ambientValid || readingsSinceRefresh >= AMBIENT_REFRESH_READINGS)
+    return true;
+
+  uint32_t reference = ambientMhz[FILTER_CLEAR];
+  uint32_t change = ambientClearMhz > reference ? ambientClearMhz - reference
+                                                : reference - ambientClearMhz;
+  return change > AMBIENT_CHANGE_FLOOR_MHZ &&
+         change > reference / AMBIENT_CHANGE_DIVISOR;
+}
+
+// LED-off captures go first, so the LED switches once per reading, the
+// clear capture sits right before the ones it corrects, and the LED is
+// back on when the reading completes
+void ColorSensor::planReading() {
+  if (nextPlanSet) {
+    nextPlanSet = false;
+    for (uint8_t i = 0; i < nextPlanSize; i++) {
+      plan[i] = nextPlan[i];
+    }
+    planSize = nextPlanSize;
+    return;
+  }
+
+  uint32_t budget = 3 * gateTimeUs;
+  uint32_t ambientGate = gateTimeUs;
+  OutputScaling ambientScaling = fixedScaling;
+  if (autoRange) {
+    ambientGate = budget / AMBIENT_GATE_DIVISOR;
+    if (ambientGate < MIN_GATE_TIME_US) {
+      ambientGate = MIN_GATE_TIME_US;
+    }
+    // The clear channel is the brightest, so its range suits them all
+    ambientScaling = ambientClearMhz == 0
+                         ? SCALING_100
+                         : scalingFor(500000000UL / ambientClearMhz + 1);
+  }
+
+  planSize = 0;
+  if (ambientMode) {
+    if (needsAmbientRefresh()) {
+      for (uint8_t f = FILTER_RED; f <= FILTER_BLUE; f++) {
+        plan[planSize++] = {(SensorFilter)f, ambientScaling, true,
+                            ambientGate};
+      }
+    }
+    plan[planSize++] = {FILTER_CLEAR, ambientScaling, true, ambientGate};
+  }
+
+  uint8_t first = planSize;
+  for (uint8_t f = FILTER_RED; f <= FILTER_BLUE; f++) {
+    plan[planSize++] = {(SensorFilter)f, fixedScaling, false, gateTimeUs};
+  }
+
+  if (autoRange) {
+    uint32_t used = first * ambientGate;
+    planGates(budget > used ? budget - used : 0);
   }
 }
 
-void ColorSensor::toggleLed() { digitalWrite(ledPin, isLedOn() ? LOW : HIGH); }
+// Splits the gate budget over the LED-on captures (the last three steps)
+void ColorSensor::planGates(uint32_t onBudget) {
+  CaptureStep *on = plan + planSize - 3;
+
+  if (periods[0] == 0 || periods[1] == 0 || periods[2] == 0) {
+    // Nothing to go on (first reading, or a channel saw no edges): the most
+    // sensitive range and an even split
+    for (uint8_t i = 0; i < 3; i++) {
+      on[i].scaling = SCALING_100;
+      on[i].gateUs = onBudget / 3;
+    }
+  } else {
+    uint32_t weights[3];
+    uint64_t total = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+      on[i].scaling = scalingFor(periods[i]);
+      weights[i] = periods[i] * SCALING_WEIGHT[on[i].scaling];
+      total += weights[i];
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+      on[i].gateUs = (uint32_t)((uint64_t)onBudget * weights[i] / total);
+    }
+  }
 
-void ColorSensor::setLed(bool on) { digitalWrite(ledPin, on ? HIGH : LOW); }
+  for (uint8_t i = 0; i < 3; i++) {
+    if (on[i].gateUs < MIN_GATE_TIME_US) {
+      on[i].gateUs = MIN_GATE_TIME_US;
+    }
+  }
+}
 
-bool ColorSensor::isLedOn() { return digitalRead(ledPin) == HIGH; }
+// Mirrors planReading(): a refresh adds 4 LED-off steps. The LED-on split
+// never exceeds its budget, but the clamp can raise up to two shares to
+// MIN_GATE_TIME_US (all three when the budget is below 3 of them).
+uint32_t ColorSensor::maxReadingUs(uint32_t settleUs, uint32_t gateUs,
+                                   bool autoRange, bool ambient) {
+  uint8_t ambientSteps = ambient ? 4 : 0;
+  uint32_t gates;
+  if (!autoRange) {
+    gates = (ambientSteps + 3) * gateUs;
+  } else {
+    uint32_t budget = 3 * gateUs;
+    uint32_t ambientGate = budget / AMBIENT_GATE_DIVISOR;
+    if (ambientGate < MIN_GATE_TIME_US) {
+      ambientGate = MIN_GATE_TIME_US;
+    }
+    uint32_t used = ambientSteps * ambientGate;
+    uint32_t onGates = (budget > used ? budget - used : 0) +
+                       2 * MIN_GATE_TIME_US;
+    if (onGates < 3 * MIN_GATE_TIME_US) {
+      onGates = 3 * MIN_GATE_TIME_US;
+    }
+    gates = used + onGates;
+  }
+  return (ambientSteps + 3) * settleUs + gates;
+}
 
 // ============================================================================
 // Color Reading
 // ============================================================================
 
-unsigned long ColorSensor::readFrequency(bool s2State, bool s3State) {
-  digitalWrite(s2Pin, s2State ? HIGH : LOW);
-  digitalWrite(s3Pin, s3State ? HIGH : LOW);
-  delay(FILTER_SETTLING_TIME);
-  return pulseIn(outPin, LOW, PULSE_TIMEOUT);
+void ColorSensor::onReadingReady(void (*callback)(void *), void *context) {
+  readyCallback = callback;
+  readyContext = context;
+}
+
+void ColorSensor::onCapture(CaptureObserver observer, void *context) {
+  captureObserver = observer;
+  captureContext = context;
+}
+
+void ColorSensor::setScalingPins(OutputScaling scaling) {
+  digitalWrite(s0Pin, SCALING_S0[scaling] ? HIGH : LOW);
+  digitalWrite(s1Pin, SCALING_S1[scaling] ? HIGH : LOW);
+}
+
+void ColorSensor::selectStep(const CaptureStep &step) {
+  ambientCapture = step.ambient;
+  digitalWrite(ledPin, ledOn && !step.ambient ? HIGH : LOW);
+  setScalingPins(step.scaling);
+  digitalWrite(s2Pin, FILTER_S2[step.filter] ? HIGH : LOW);
+  digitalWrite(s3Pin, FILTER_S3[step.filter] ? HIGH : LOW);
+}
+
+// A refused capture ends the reading rather than leaving it in flight
+bool ColorSensor::startStep(uint8_t index) {
+  stepIndex = index;
+  selectStep(plan[index]);
+  if (capture.start(settleTimeUs, plan[index].gateUs))
+    return true;
+
+  abortReading();
+  return false;
+}
+
+bool ColorSensor::startReading() {
+  bool expected = false;
+  if (!reading.compare_exchange_strong(expected, true))
+    return false;
+
+  readingReady.store(false);
+  readingStartUs = micros();
+  applySettings();
+  planReading();
+  return startStep(0);
+}
+
+bool ColorSensor::isReading() { return reading.load(); }
+
+void ColorSensor::abortReading() {
+  capture.abort();
+  ambientCapture = false;
+  digitalWrite(ledPin, ledOn ? HIGH : LOW);
+  reading.store(false, std::memory_order_release);
+}
+
+void ColorSensor::onCaptureComplete(void *context,
+                                    const CaptureResult &result) {
+  ColorSensor *self = static_cast<ColorSensor *>(context);
+  // Late completion of an aborted capture
+  if (!self->reading.load(std::memory_order_acquire))
+    return;
+
+  uint8_t index = self->stepIndex;
+  bool last = index + 1 >= self->planSize;
+
+  self->results[index] = result;
+
+  if (self->captureObserver) {
+    self->captureObserver(self->captureContext, self->plan[index], result,
+                          last);
+  }
+
+  if (!last) {
+    // On failure the waiting task is woken to notice the reading ended
+    if (!self->startStep(index + 1) && self->readyCallback) {
+      self->readyCallback(self->readyContext);
+    }
+    return;
+  }
+
+  self->finishReading();
+  metrics.record(HISTOGRAM_READ_US, micros() - self->readingStartUs);
+  self->readingReady.store(true, std::memory_order_release);
+  self->reading.store(false, std::memory_order_release);
+
+  if (self->readyCallback) {
+    self->readyCallback(self->readyContext);
+  }
+}
+
+// Turns the step results into 20%-scale half-periods, less ambient light
+void ColorSensor::finishReading() {
+  uint8_t onStep[3] = {0, 0, 0};
+  uint32_t offMhz[4] = {0, 0, 0, 0};
+  uint8_t offSeen = 0;
+
+  for (uint8_t i = 0; i < planSize; i++) {
+    const CaptureStep &step = plan[i];
+    if (step.ambient) {
+      offMhz[step.filter] = frequencyMhz20(results[i], step.scaling);
+      offSeen |= 1 << step.filter;
+    } else if (step.filter != FILTER_CLEAR) {
+      onStep[step.filter] = i;
+    }
+  }
+
+  bool clearSeen = offSeen & (1 << FILTER_CLEAR);
+  if (clearSeen) {
+    if ((offSeen & 0x0F) == 0x0F) {
+      for (uint8_t f = 0; f < 4; f++) {
+        ambientMhz[f] = offMhz[f];
+      }
+      ambientValid = true;
+      readingsSinceRefresh = 0;
+    } else if (readingsSinceRefresh < 0xFF) {
+      readingsSinceRefresh++;
+    }
+    ambientClearMhz = offMhz[FILTER_CLEAR];
+  }
+
+  for (uint8_t c = 0; c < 3; c++) {
+    const CaptureResult &result = results[onStep[c]];
+    OutputScaling scaling = plan[onStep[c]].scaling;
+
+    if (!clearSeen || !ambientValid || result.edges == 0) {
+      // Normalized to 20%, the range the calibration tables are built for
+      periods[c] =
+          CaptureMath::scaledHalfPeriodUs(result, SCALING_PERCENT[scaling], 20);
+      continue;
+    }
+
+    // Ambient on this channel, following the clear channel since the
+    // last refresh
+    uint64_t ambient = ambientMhz[c];
+    if (ambientMhz[FILTER_CLEAR] > 0) {
+      ambient = ambient * ambientClearMhz / ambientMhz[FILTER_CLEAR];
+    }
+    uint32_t total = frequencyMhz20(result, scaling);
+    uint32_t lit = total > ambient + 1 ? (uint32_t)(total - ambient) : 1;
+    periods[c] = (500000000UL + lit / 2) / lit;
+  }
+
+  if (periods[0] == 0 || periods[1] == 0 || periods[2] == 0) {
+    metrics.count(COUNTER_SENSOR_TIMEOUTS);
+  }
+}
+
+bool ColorSensor::takeReading(RGBColor &color) {
+  if (!readingReady.exchange(false, std::memory_order_acquire))
+    return false;
+
+  lastRaw.red = periods[0];
+  lastRaw.green = periods[1];
+  lastRaw.blue = periods[2];
+  color = toRGB(lastRaw);
+  return true;
 }
 
 RGBColor ColorSensor::readColor() {
   RGBColor color = {0, 0, 0};
 
-  // Read raw frequencies for each channel
-  unsigned long rFreq = readFrequency(false, false); // Red
-  unsigned long gFreq = readFrequency(true, true);   // Green
-  unsigned long bFreq = readFrequency(false, true);  // Blue
+  if (!startReading())
+    return color;
+
+  unsigned long start = millis();
+  while (!takeReading(color)) {
+    if (!isReading()) {
+      takeReading(color); // Completed just now, or a step was refused
+      return color;
+    }
+    if (millis() - start > READ_TIMEOUT_MS) {
+      Serial.println("WARNING: Capture stalled!");
+      abortReading();
+      return color;
+    }
+    delay(1);
+  }
+  return color;
+}
+
+RGBColor ColorSensor::toRGB(const RawFrequencies &raw) {
+  RGBColor color = {0, 0, 0};
+  unsigned long rFreq = raw.red;
+  unsigned long gFreq = raw.green;
+  unsigned long bFreq = raw.blue;
 
   // Check for sensor timeout
   if (rFreq == 0 || gFreq == 0 || bFreq == 0) {
@@ -80,13 +523,11 @@ RGBColor ColorSensor::readColor() {
   Serial.println(bFreq);
 #endif
 
-  // Map frequencies to RGB (0-255) using calibration values
-  color.red =
-      constrain(map(rFreq, WHITE_RED_FREQ, BLACK_RED_FREQ, 255, 0), 0, 255);
-  color.green =
-      constrain(map(gFreq, WHITE_GREEN_FREQ, BLACK_GREEN_FREQ, 255, 0), 0, 255);
-  color.blue =
-      constrain(map(bFreq, WHITE_BLUE_FREQ, BLACK_BLUE_FREQ, 255, 0), 0, 255);
+  // Map periods to RGB (0-255) through the active calibration tables
+  const CalibrationTable &table = tables[activeTable.load()];
+  color.red = table.channels[0].apply(rFreq);
+  color.green = table.channels[1].apply(gFreq);
+  color.blue = table.channels[2].apply(bFreq);
 
   return color;
 }
@@ -95,64 +536,16 @@ RGBColor ColorSensor::readColor() {
 // Color Detection
 // ============================================================================
 
+uint16_t ColorSensor::detectColorId(const RGBColor &color) {
+  return ColorNaming::nearest(rgbToLab(color));
+}
+
 String ColorSensor::detectColorName(const RGBColor &color) {
-  const int r = color.red;
-  const int g = color.green;
-  const int b = color.blue;
-  const int brightness = (r + g + b) / 3;
-
-  // Helper lambdas for readability
-  auto isGrayish = [&](int tolerance) {
-    return abs(r - g) < tolerance && abs(g - b) < tolerance &&
-           abs(r - b) < tolerance;
-  };
-
-  // Grayscale detection (ordered by brightness)
-  if (r < 30 && g < 30 && b < 30)
-    return "BLACK";
-  if (brightness < 50 && isGrayish(20))
-    return "DARK GRAY";
-  if (brightness < 120 && isGrayish(25))
-    return "GRAY";
-  if (brightness < 200 && isGrayish(30))
-    return "LIGHT GRAY";
-  if (r > 200 && g > 200 && b > 200)
-    return "WHITE";
-
-  // Chromatic colors (order matters for proper detection)
-  // Yellow - check before RED (both R and G high)
-  if (r > 120 && g > 120 && b < 80 && abs(r - g) < 50)
-    return "YELLOW";
-
-  // Orange - check before RED
-  if (r > 150 && g > 60 && g < 140 && b < 70)
-    return "ORANGE";
-
-  // Primary colors
-  if (r > g + 25 && r > b + 25) {
-    return brightness < 80 ? "DARK RED" : "RED";
-  }
-  if (g > r + 40 && g > b + 40) {
-    return brightness < 80 ? "DARK GREEN" : "GREEN";
-  }
-  if (b > r + 40 && b > g + 40) {
-    return brightness < 80 ? "DARK BLUE" : "BLUE";
-  }
-
-  // Secondary colors
-  if (r > 80 && r < 180 && g > 40 && g < 120 && b < 80)
-    return "BROWN";
-  if (g > 150 && b > 150 && r < 100)
-    return "CYAN";
-
-  if (r > 120 && b > 120 && g < 100) {
-    return r > b + 30 ? "MAGENTA" : "PURPLE";
-  }
-
-  if (r > 180 && g > 100 && g < 180 && b > 120 && b < 200)
-    return "PINK";
-
-  return "UNKNOWN";
+  return String(colorNameFor(detectColorId(color)));
+}
+
+const char *ColorSensor::colorNameFor(uint16_t id) {
+  return ColorNaming::nameFor(id);
 }
 
 void ColorSensor::printColorData(const RGBColor &color,
@@ -0,0 +1,58 @@
+#include "config_store.h"
+
+static const char *PREFS_NAMESPACE = "config";
+static const char *CONFIG_KEY = "device";
+
+ConfigStore::ConfigStore(Bluetooth &bluetooth)
+    : ble(bluetooth), ready(false) {}
+
+void ConfigStore::begin() {
+  ready = prefs.begin(PREFS_NAMESPACE, false);
+  if (!ready) {
+    Serial.println("WARNING: Config storage unavailable!");
+  }
+  ble.onWrite(BLE_CHANNEL_CONFIG, onWrite, this);
+}
+
+// Same encoding as the characteristic; a blob of another version is ignored
+bool ConfigStore::load(DeviceConfig &config) {
+  if (!ready || prefs.getBytesLength(CONFIG_KEY) != CONFIG_SIZE)
+    return false;
+
+  uint8_t stored[CONFIG_SIZE];
+  prefs.getBytes(CONFIG_KEY, stored, sizeof(stored));
+  uint8_t field;
+  return decodeConfig(stored, sizeof(stored), config, field) == CONFIG_OK;
+}
+
+bool ConfigStore::save(const DeviceConfig &config) {
+  if (!ready || validateConfig(config))
+    return false;
+
+  uint8_t stored[CONFIG_SIZE];
+  encodeConfig(config, CONFIG_OK, 0, stored);
+  return prefs.putBytes(CONFIG_KEY, stored, sizeof(stored)) == sizeof(stored);
+}
+
+bool ConfigStore::takeUpdate(ConfigUpdate &update) {
+  return updates.pop(update);
+}
+
+void ConfigStore::publish(const DeviceConfig &config, uint8_t status,
+                          uint8_t field) {
+  uint8_t value[CONFIG_SIZE];
+  encodeConfig(config, status, field, value);
+  ble.publish(BLE_CHANNEL_CONFIG, value, sizeof(value));
+}
+
+// BLE stack task
+void ConfigStore::onWrite(void *context, uint16_t connId, const uint8_t *data,
+                          size_t length) {
+  ConfigStore *self = static_cast<ConfigStore *>(context);
+  ConfigUpdate update = {};
+  update.connId = connId;
+  update.status = decodeConfig(data, length, update.config, update.field);
+  // A full queue drops the write; the value read back shows it was not
+  // applied
+  self->updates.push(update);
+}
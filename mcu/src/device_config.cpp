@@ -0,0 +1,132 @@
+#include "device_config.h"
+#include "button.h"
+#include "color_sampler.h"
+#include "color_sensor.h"
+
+// Limits beyond what the field types allow
+static const uint16_t MAX_LONG_PRESS_MS = 10000;
+static const uint16_t MAX_LED_TOGGLE_MS = 30000;
+static const uint32_t MIN_AUTO_OFF_MS = 10000;
+static const uint8_t MAX_STREAM_RATE_HZ = 100;
+static const uint16_t MAX_SETTLE_US = 20000;
+static const uint8_t KNOWN_FLAGS =
+    CONFIG_FLAG_AUTO_FINALIZE | CONFIG_FLAG_AUTO_RANGE | CONFIG_FLAG_AMBIENT |
+    CONFIG_FLAG_BOOT_SCREENS;
+
+// ============================================================================
+// Byte Helpers
+// ============================================================================
+
+static void putU16(uint8_t *out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void putU32(uint8_t *out, uint32_t value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = value >> 24;
+}
+
+static uint16_t getU16(const uint8_t *in) {
+  return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t *in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) |
+         ((uint32_t)in[3] << 24);
+}
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+void encodeConfig(const DeviceConfig &config, uint8_t status, uint8_t field,
+                  uint8_t *out) {
+  out[0] = CONFIG_VERSION;
+  out[1] = status;
+  out[2] = field;
+  out[3] = config.flags;
+  putU16(out + 4, config.longPressMs);
+  putU16(out + 6, config.ledToggleMs);
+  putU32(out + 8, config.autoOffMs);
+  out[12] = config.minSamples;
+  out[13] = config.streamRateHz;
+  putU16(out + 14, config.settleUs);
+  putU16(out + 16, config.gateUs);
+  putU16(out + 18, config.streamSettleUs);
+  putU16(out + 20, config.streamGateUs);
+  out[22] = config.scaling;
+  putU16(out + 23, config.ciTargetTenths);
+}
+
+ConfigStatus decodeConfig(const uint8_t *in, size_t length,
+                          DeviceConfig &config, uint8_t &field) {
+  field = 0;
+  if (length < 1 || in[0] != CONFIG_VERSION)
+    return CONFIG_BAD_VERSION;
+  if (length != CONFIG_SIZE)
+    return CONFIG_BAD_LENGTH;
+
+  DeviceConfig decoded;
+  decoded.flags = in[3];
+  decoded.longPressMs = getU16(in + 4);
+  decoded.ledToggleMs = getU16(in + 6);
+  decoded.autoOffMs = getU32(in + 8);
+  decoded.minSamples = in[12];
+  decoded.streamRateHz = in[13];
+  decoded.settleUs = getU16(in + 14);
+  decoded.gateUs = getU16(in + 16);
+  decoded.streamSettleUs = getU16(in + 18);
+  decoded.streamGateUs = getU16(in + 20);
+  decoded.scaling = in[22];
+  decoded.ciTargetTenths = getU16(in + 23);
+
+  field = validateConfig(decoded);
+  if (field)
+    return CONFIG_BAD_VALUE;
+  config = decoded;
+  return CONFIG_OK;
+}
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+uint8_t validateConfig(const DeviceConfig &config) {
+  if (config.flags & ~KNOWN_FLAGS)
+    return 3;
+  // A tap must never count as a hold
+  if (config.longPressMs <= Button::SHORT_PRESS_MAX ||
+      config.longPressMs > MAX_LONG_PRESS_MS)
+    return 4;
+  if (config.ledToggleMs <= config.longPressMs ||
+      config.ledToggleMs > MAX_LED_TOGGLE_MS)
+    return 6;
+  if (config.autoOffMs != 0 && config.autoOffMs < MIN_AUTO_OFF_MS)
+    return 8;
+  if (config.minSamples < 1 || config.minSamples > ColorSampler::WINDOW_SIZE)
+    return 12;
+  // A streamed reading has to fit its schedule slot, ambient refresh and
+  // auto-range clamp included
+  if (config.streamRateHz < 1 || config.streamRateHz > MAX_STREAM_RATE_HZ ||
+      ColorSensor::maxReadingUs(config.streamSettleUs, config.streamGateUs,
+                                config.flags & CONFIG_FLAG_AUTO_RANGE,
+                                config.flags & CONFIG_FLAG_AMBIENT) >
+          1000000UL / config.streamRateHz)
+    return 13;
+  if (config.settleUs > MAX_SETTLE_US)
+    return 14;
+  if (config.gateUs < ColorSensor::MIN_GATE_TIME_US)
+    return 16;
+  if (config.streamSettleUs > MAX_SETTLE_US)
+    return 18;
+  if (config.streamGateUs < ColorSensor::MIN_GATE_TIME_US)
+    return 20;
+  if (config.scaling > SCALING_100)
+    return 22;
+  if (config.ciTargetTenths == 0)
+    return 23;
+  return 0;
+}
@@ -1,11 +1,24 @@
 #include "display.h"
+#include "metrics.h"
 #include <Wire.h>
 
+// SSD1306 control byte: a command stream or display RAM data follows
+static const uint8_t CONTROL_COMMAND = 0x00;
+static const uint8_t CONTROL_DATA = 0x40;
+
 Display::Display(uint8_t width, uint8_t height, uint8_t sda, uint8_t scl,
                  uint8_t address, int8_t reset)
-    : oled(width, height, &Wire, reset), sdaPin(sda), sclPin(scl),
-      screenWidth(width), screenHeight(height), resetPin(reset),
-      i2cAddress(address) {}
+    : oled(width, height, &Wire, reset, I2C_CLOCK_HZ, I2C_CLOCK_HZ),
+      sdaPin(sda), sclPin(scl), screenWidth(width), screenHeight(height),
+      resetPin(reset), i2cAddress(address),
+      frameSize((size_t)width * ((height + 7) / 8)), presentedValid(false),
+      shadowValid(false), lastFlushMs(0), submitted(0), unchanged(0),
+      superseded(0), flushes(0), pagesSent(0), bytesSent(0), i2cUs(0),
+      maxFlushUs(0), latencyUs(0), maxLatencyUs(0) {
+#ifdef ESP_PLATFORM
+  task = nullptr;
+#endif
+}
 
 void Display::prepareDisplay() {
   oled.clearDisplay();
@@ -14,13 +27,29 @@ void Display::prepareDisplay() {
 }
 
 bool Display::begin() {
+  if (frameSize > MAX_FRAME_SIZE) {
+    Serial.println(F("Display larger than 128x64 is not supported"));
+    return false;
+  }
+
   delay(100);
   Wire.begin(sdaPin, sclPin);
   Serial.println("Initializing OLED...");
 
   for (int attempt = 1; attempt <= 3; attempt++) {
     if (oled.begin(SSD1306_SWITCHCAPVCC, i2cAddress)) {
+      // The driver drops the bus back to its default clock after init
+      Wire.setClock(I2C_CLOCK_HZ);
       Serial.println("OLED initialized successfully!");
+#ifdef ESP_PLATFORM
+      // From here on only the flush task touches the bus
+      BaseType_t created = xTaskCreatePinnedToCore(
+          taskEntry, "display", STACK_SIZE, this, PRIORITY, &task, CORE);
+      if (created != pdPASS) {
+        Serial.println("Display task create failed!");
+        return false;
+      }
+#endif
       return true;
     }
     Serial.print("OLED init attempt ");
@@ -39,6 +68,162 @@ bool Display::begin() {
   return false;
 }
 
+DisplayStats Display::getStats() const {
+  DisplayStats stats;
+  stats.submitted = submitted;
+  stats.unchanged = unchanged;
+  stats.superseded = superseded;
+  stats.flushes = flushes;
+  stats.pagesSent = pagesSent;
+  stats.bytesSent = bytesSent;
+  stats.i2cUs = i2cUs;
+  stats.maxFlushUs = maxFlushUs;
+  stats.latencyUs = latencyUs;
+  stats.maxLatencyUs = maxLatencyUs;
+  return stats;
+}
+
+// ============================================================================
+// Loop Side
+// ============================================================================
+
+// Hands the composed frame to the flush task, replacing one it has not
+// taken yet
+void Display::present() {
+  const uint8_t *pixels = oled.getBuffer();
+  if (presentedValid && memcmp(pixels, presented, frameSize) == 0) {
+    unchanged = unchanged + 1;
+    return;
+  }
+  memcpy(presented, pixels, frameSize);
+  presentedValid = true;
+
+  Frame &frame = mailbox.back();
+  memcpy(frame.pixels, pixels, frameSize);
+  frame.presentedUs = micros();
+  submitted = submitted + 1;
+  if (mailbox.publish()) {
+    superseded = superseded + 1;
+  }
+
+#ifdef ESP_PLATFORM
+  if (task) {
+    xTaskNotifyGive(task);
+  }
+#endif
+}
+
+// ============================================================================
+// Flush Side
+// ============================================================================
+
+#ifdef ESP_PLATFORM
+
+void Display::taskEntry(void *arg) { static_cast<Display *>(arg)->run(); }
+
+void Display::run() {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // Frames presented while the cap runs out replace this one
+    unsigned long sinceMs = millis() - lastFlushMs;
+    if (sinceMs < MIN_FRAME_INTERVAL_MS) {
+      vTaskDelay(pdMS_TO_TICKS(MIN_FRAME_INTERVAL_MS - sinceMs));
+    }
+
+    const Frame *frame = mailbox.take();
+    if (frame) {
+      flush(*frame);
+    }
+  }
+}
+
+#else
+
+void Display::poll() {
+  if (!mailbox.hasNew() || millis() - lastFlushMs < MIN_FRAME_INTERVAL_MS)
+    return;
+  flush(*mailbox.take());
+}
+
+#endif
+
+// Sends the changed column range of each page and records it in the shadow
+void Display::flush(const Frame &frame) {
+  uint8_t pages = (screenHeight + 7) / 8;
+  bool ok = true;
+  unsigned long startUs = micros();
+
+  for (uint8_t page = 0; page < pages && ok; page++) {
+    const uint8_t *row = frame.pixels + page * screenWidth;
+    uint8_t *shown = shadow + page * screenWidth;
+    int first = 0;
+    int last = screenWidth - 1;
+    if (shadowValid) {
+      while (first < screenWidth && row[first] == shown[first]) {
+        first++;
+      }
+      if (first == screenWidth)
+        continue;
+      while (row[last] == shown[last]) {
+        last--;
+      }
+    }
+
+    ok = sendPage(page, first, last, row + first);
+    memcpy(shown + first, row + first, last - first + 1);
+  }
+
+  unsigned long endUs = micros();
+  uint32_t elapsedUs = endUs - startUs;
+  uint32_t frameLatencyUs = endUs - frame.presentedUs;
+  flushes = flushes + 1;
+  i2cUs = i2cUs + elapsedUs;
+  metrics.record(HISTOGRAM_DISPLAY_FLUSH_US, elapsedUs);
+  if (elapsedUs > maxFlushUs) {
+    maxFlushUs = elapsedUs;
+  }
+  latencyUs = frameLatencyUs;
+  if (frameLatencyUs > maxLatencyUs) {
+    maxLatencyUs = frameLatencyUs;
+  }
+
+  // After a failed transfer the panel content is unknown; the next frame
+  // is sent in full
+  shadowValid = ok;
+  lastFlushMs = millis();
+}
+
+bool Display::sendPage(uint8_t page, uint8_t first, uint8_t last,
+                       const uint8_t *data) {
+  const uint8_t window[] = {CONTROL_COMMAND,    SSD1306_PAGEADDR, page, page,
+                            SSD1306_COLUMNADDR, first,            last};
+  Wire.beginTransmission(i2cAddress);
+  Wire.write(window, sizeof(window));
+  bool ok = Wire.endTransmission() == 0;
+  uint32_t bytes = sizeof(window) + 1;
+
+  size_t remaining = last - first + 1;
+  while (ok && remaining > 0) {
+    size_t chunk = min(remaining, I2C_CHUNK_SIZE - 1);
+    Wire.beginTransmission(i2cAddress);
+    Wire.write(CONTROL_DATA);
+    Wire.write(data, chunk);
+    ok = Wire.endTransmission() == 0;
+    bytes += chunk + 2;
+    data += chunk;
+    remaining -= chunk;
+  }
+
+  bytesSent = bytesSent + bytes;
+  pagesSent = pagesSent + 1;
+  return ok;
+}
+
+// ============================================================================
+// Screens
+// ============================================================================
+
 void Display::showSplash() {
   prepareDisplay();
 
@@ -48,7 +233,7 @@ void Display::showSplash() {
   oled.setCursor(28, 4);
   oled.print(F("WUST"));
 
-  oled.display();
+  present();
 }
 
 void Display::showWelcome() {
@@ -57,7 +242,7 @@ void Display::showWelcome() {
   oled.println(F("Surface"));
   oled.setCursor(16, 18);
   oled.println(F("Color Detector"));
-  oled.display();
+  present();
 }
 
 void Display::showColorData(int red, int green, int blue,
@@ -81,7 +266,7 @@ void Display::showColorData(int red, int green, int blue,
   oled.setCursor(0, 24);
   oled.print(colorName);
 
-  oled.display();
+  present();
 }
 
 void Display::showSamplingMode(int sampleCount, int red, int green, int blue,
@@ -107,7 +292,35 @@ void Display::showSamplingMode(int sampleCount, int red, int green, int blue,
   oled.setCursor(0, 24);
   oled.print(colorName);
 
-  oled.display();
+  present();
+}
+
+void Display::showStreaming(int samplesPerSec, unsigned long dropped,
+                            int red, int green, int blue,
+                            const String &colorName) {
+  prepareDisplay();
+
+  // Stream rate and drop counter
+  oled.setCursor(0, 0);
+  oled.print(F("STREAM "));
+  oled.print(samplesPerSec);
+  oled.print(F("/s drop:"));
+  oled.println(dropped);
+
+  // Rolling average
+  oled.setCursor(0, 12);
+  oled.print(F("R:"));
+  oled.print(red);
+  oled.print(F(" G:"));
+  oled.print(green);
+  oled.print(F(" B:"));
+  oled.println(blue);
+
+  // Color name
+  oled.setCursor(0, 24);
+  oled.print(colorName);
+
+  present();
 }
 
 void Display::showProgress(int percentage) {
@@ -129,7 +342,7 @@ void Display::showProgress(int percentage) {
   oled.print(percentage);
   oled.print(F("%"));
 
-  oled.display();
+  present();
 }
 
 void Display::showMessage(const String &line1, const String &line2) {
@@ -143,5 +356,5 @@ void Display::showMessage(const String &line1, const String &line2) {
     oled.println(line2);
   }
 
-  oled.display();
+  present();
 }
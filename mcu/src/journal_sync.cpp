@@ -0,0 +1,385 @@
+#include "journal_sync.h"
+
+// step() result when only a client write can make progress
+static const unsigned long WAIT_FOREVER = ~0UL;
+
+// ============================================================================
+// Byte Helpers
+// ============================================================================
+
+static void putU16(uint8_t *out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void putU32(uint8_t *out, uint32_t value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = value >> 24;
+}
+
+static uint32_t getU32(const uint8_t *in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) |
+         ((uint32_t)in[3] << 24);
+}
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+JournalSync::JournalSync(MeasurementJournal &jrnl, Bluetooth &bluetooth)
+    : journal(jrnl), ble(bluetooth), active(false), client(0), rangeEnd(0),
+      nextToSend(0), acked(0), resumePoint(0), window(SYNC_DEFAULT_WINDOW),
+      perPacket(1), packetCounter(0), inFlight(0), endSent(false),
+      refusing(false), refusedSinceMs(0), freshFrom(0), lastProgressMs(0),
+      startMs(0), transferRecords(0), transfers(0), records(0), packets(0),
+      rewinds(0), refused(0), rejected(0), lastRecords(0), lastMs(0) {
+#ifdef ESP_PLATFORM
+  task = nullptr;
+#endif
+}
+
+bool JournalSync::begin() {
+  if (!journal.isReady())
+    return false;
+
+#ifdef ESP_PLATFORM
+  BaseType_t created = xTaskCreatePinnedToCore(taskEntry, "sync", STACK_SIZE,
+                                               this, PRIORITY, &task, CORE);
+  if (created != pdPASS) {
+    Serial.println("Sync task create failed!");
+    return false;
+  }
+#endif
+
+  ble.onWrite(BLE_CHANNEL_SYNC, onWrite, this);
+  return true;
+}
+
+SyncStats JournalSync::getStats() const {
+  SyncStats stats;
+  stats.transfers = transfers;
+  stats.records = records;
+  stats.packets = packets;
+  stats.rewinds = rewinds;
+  stats.refused = refused;
+  stats.rejected = rejected;
+  stats.lastRecords = lastRecords;
+  stats.lastMs = lastMs;
+  return stats;
+}
+
+// ============================================================================
+// Client Writes (BLE stack task)
+// ============================================================================
+
+void JournalSync::onWrite(void *context, uint16_t connId, const uint8_t *data,
+                          size_t length) {
+  JournalSync *self = static_cast<JournalSync *>(context);
+  if (length == 0)
+    return;
+
+  Command command = {};
+  command.type = data[0];
+  command.connId = connId;
+  switch (command.type) {
+  case SYNC_CMD_START:
+    if (length >= 9) {
+      command.from = getU32(data + 1);
+      command.to = getU32(data + 5);
+    }
+    if (length >= 10)
+      command.window = data[9];
+    break;
+  case SYNC_CMD_ACK:
+  case SYNC_CMD_NACK:
+    if (length < 5)
+      return;
+    command.from = getU32(data + 1);
+    break;
+  case SYNC_CMD_STOP:
+  case SYNC_CMD_INFO:
+    break;
+  default:
+    return;
+  }
+
+  // A full queue drops the command; the client's timeout recovers
+  if (!self->commands.push(command))
+    return;
+#ifdef ESP_PLATFORM
+  if (self->task)
+    xTaskNotifyGive(self->task);
+#endif
+}
+
+// ============================================================================
+// Transfer
+// ============================================================================
+
+void JournalSync::handle(const Command &command) {
+  // Only INFO is answered for a client other than the one being served
+  if (active && command.connId != client && command.type != SYNC_CMD_INFO)
+    return;
+
+  switch (command.type) {
+  case SYNC_CMD_START: {
+    // Nothing reaches a client without notifications enabled
+    if (!ble.isSubscribed(command.connId, BLE_CHANNEL_SYNC))
+      break;
+    uint16_t mtu = ble.getMtu(command.connId);
+    if (mtu < SYNC_MIN_MTU) {
+      sendReject(command.connId, SYNC_STATUS_MTU);
+      break;
+    }
+    perPacket = (mtu - BLE_ATT_OVERHEAD - SYNC_DATA_HEADER_SIZE) /
+                MEASUREMENT_RECORD_SIZE;
+    if (perPacket > SYNC_MAX_PACKET_RECORDS)
+      perPacket = SYNC_MAX_PACKET_RECORDS;
+
+    uint32_t from = command.from ? command.from : resumePoint;
+    if (from < journal.getOldestSequence())
+      from = journal.getOldestSequence();
+    rangeEnd = command.to ? command.to : journal.getLastSequence();
+    window = command.window ? command.window : SYNC_DEFAULT_WINDOW;
+    if (window > SYNC_MAX_WINDOW)
+      window = SYNC_MAX_WINDOW;
+
+    // A resume keeps timing and counting the interrupted transfer
+    bool resuming = command.from == 0 && resumePoint != 0 && startMs != 0;
+    if (!resuming) {
+      startMs = millis();
+      transferRecords = 0;
+      freshFrom = from;
+    }
+    nextToSend = from;
+    acked = from;
+    resumePoint = from;
+    packetCounter = 0;
+    inFlight = 0;
+    endSent = false;
+    refusing = false;
+    lastProgressMs = millis();
+    client = command.connId;
+    active = true;
+    ble.requestFastConnection(client);
+
+    Serial.print("Sync: #");
+    Serial.print(from);
+    Serial.print(" to #");
+    Serial.println(rangeEnd);
+    break;
+  }
+  case SYNC_CMD_ACK:
+    acknowledge(command.from);
+    break;
+  case SYNC_CMD_NACK:
+    acknowledge(command.from);
+    if (active)
+      rewind();
+    break;
+  case SYNC_CMD_STOP:
+    active = false;
+    break;
+  case SYNC_CMD_INFO:
+    sendInfo(command.connId);
+    break;
+  }
+}
+
+void JournalSync::acknowledge(uint32_t next) {
+  if (!active || next < acked || next > nextToSend)
+    return;
+
+  acked = next;
+  resumePoint = next;
+  lastProgressMs = millis();
+
+  // Retire every packet the ACK covers (they are in sequence order)
+  uint8_t done = 0;
+  while (done < inFlight && packetEnd[done] <= next) {
+    done++;
+  }
+  for (uint8_t i = done; i < inFlight; i++) {
+    packetEnd[i - done] = packetEnd[i];
+  }
+  inFlight -= done;
+
+  if (endSent && acked == nextToSend) {
+    active = false;
+    transfers++;
+    lastRecords = transferRecords;
+    lastMs = millis() - startMs;
+    startMs = 0;
+
+    Serial.print("Sync: ");
+    Serial.print(transferRecords);
+    Serial.print(" records in ");
+    Serial.print(lastMs);
+    Serial.println(" ms");
+  }
+}
+
+// Go-back-N: everything after the last ACK is sent again
+void JournalSync::rewind() {
+  nextToSend = acked;
+  packetCounter = 0;
+  inFlight = 0;
+  endSent = false;
+  lastProgressMs = millis();
+  rewinds++;
+}
+
+// The resume point survives; the client restarts with from = 0
+void JournalSync::pause() {
+  active = false;
+  Serial.print("Sync: paused at #");
+  Serial.println(resumePoint);
+}
+
+// The stack refused a notification, so nothing went out and nothing more
+// is in flight. Try again shortly, but not for longer than an ACK timeout.
+unsigned long JournalSync::backOff() {
+  refused++;
+  if (!refusing) {
+    refusing = true;
+    refusedSinceMs = millis();
+  } else if (millis() - refusedSinceMs >= SYNC_ACK_TIMEOUT_MS) {
+    pause();
+    return WAIT_FOREVER;
+  }
+  return SYNC_LINK_POLL_MS;
+}
+
+unsigned long JournalSync::step() {
+  Command command;
+  while (commands.pop(command)) {
+    handle(command);
+  }
+  if (!active)
+    return WAIT_FOREVER;
+
+  if (!ble.isConnected(client) ||
+      !ble.isSubscribed(client, BLE_CHANNEL_SYNC)) {
+    pause();
+    return WAIT_FOREVER;
+  }
+
+  bool windowOpen = !endSent && inFlight < window;
+  if (windowOpen && ble.canSendBulk(client)) {
+    SendResult result = sendData();
+    if (result == NOTHING_TO_SEND)
+      result = sendEnd();
+    if (result == REFUSED)
+      return backOff();
+    refusing = false;
+    if (!endSent)
+      return 0;
+    windowOpen = false;
+  }
+
+  unsigned long waited = millis() - lastProgressMs;
+  if (waited >= SYNC_ACK_TIMEOUT_MS) {
+    rewind();
+    return 0;
+  }
+  unsigned long wait = SYNC_ACK_TIMEOUT_MS - waited;
+  // Nothing signals free controller buffers; look again shortly
+  return windowOpen && wait > SYNC_LINK_POLL_MS ? SYNC_LINK_POLL_MS : wait;
+}
+
+JournalSync::SendResult JournalSync::sendData() {
+  if (nextToSend > rangeEnd)
+    return NOTHING_TO_SEND;
+
+  size_t count = journal.read(nextToSend, batch, perPacket);
+  while (count > 0 && batch[count - 1].sequence > rangeEnd) {
+    count--;
+  }
+  if (count == 0)
+    return NOTHING_TO_SEND;
+
+  packet[0] = SYNC_DATA;
+  packet[1] = packetCounter;
+  packet[2] = (uint8_t)count;
+  for (size_t i = 0; i < count; i++) {
+    encodeMeasurement(batch[i],
+                      packet + SYNC_DATA_HEADER_SIZE +
+                          i * MEASUREMENT_RECORD_SIZE);
+  }
+  if (!ble.sendBulk(client, BLE_CHANNEL_SYNC, packet,
+                    SYNC_DATA_HEADER_SIZE + count * MEASUREMENT_RECORD_SIZE))
+    return REFUSED;
+
+  for (size_t i = 0; i < count; i++) {
+    if (batch[i].sequence >= freshFrom)
+      transferRecords++;
+  }
+
+  nextToSend = batch[count - 1].sequence + 1;
+  if (nextToSend > freshFrom)
+    freshFrom = nextToSend;
+  packetEnd[inFlight++] = nextToSend;
+  packetCounter++;
+  packets++;
+  records += count;
+  return SENT;
+}
+
+JournalSync::SendResult JournalSync::sendEnd() {
+  packet[0] = SYNC_END;
+  putU32(packet + 1, nextToSend);
+  if (!ble.sendBulk(client, BLE_CHANNEL_SYNC, packet, 5))
+    return REFUSED;
+  endSent = true;
+  return SENT;
+}
+
+void JournalSync::sendInfo(uint16_t connId) {
+  packet[0] = SYNC_INFO;
+  putU32(packet + 1, journal.getOldestSequence());
+  putU32(packet + 5, journal.getLastSequence());
+  putU32(packet + 9, resumePoint);
+  putU16(packet + 13, journal.getBoot());
+  ble.sendBulk(connId, BLE_CHANNEL_SYNC, packet, 15);
+}
+
+void JournalSync::sendReject(uint16_t connId, uint8_t status) {
+  packet[0] = SYNC_REJECT;
+  packet[1] = status;
+  ble.sendBulk(connId, BLE_CHANNEL_SYNC, packet, 2);
+  rejected++;
+
+  Serial.print("Sync: rejected, status ");
+  Serial.println(status);
+}
+
+// ============================================================================
+// Task
+// ============================================================================
+
+#ifdef ESP_PLATFORM
+
+void JournalSync::taskEntry(void *arg) {
+  static_cast<JournalSync *>(arg)->run();
+}
+
+void JournalSync::run() {
+  for (;;) {
+    unsigned long waitMs = step();
+    if (waitMs == 0)
+      continue;
+    ulTaskNotifyTake(pdTRUE, waitMs == WAIT_FOREVER ? portMAX_DELAY
+                                                    : pdMS_TO_TICKS(waitMs));
+  }
+}
+
+#else
+
+void JournalSync::poll() {
+  while (step() == 0) {
+  }
+}
+
+#endif
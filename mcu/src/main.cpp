@@ -1,29 +1,119 @@
 /*********
   ESP32 TCS3200 Color Sensor with OLED Display
 *********/
+#include "acquisition_task.h"
 #include "ble_service.h"
+#include "boot_log.h"
 #include "button.h"
+#include "calibration_store.h"
 #include "color_sampler.h"
 #include "color_sensor.h"
+#include "config_store.h"
 #include "display.h"
+#include "journal_sync.h"
+#include "measurement_journal.h"
+#include "metrics.h"
+#include "pcnt_frequency_capture.h"
+#include "power_manager.h"
 #include "sampling_controller.h"
+#include "sensor_trace.h"
+#include "serial_link.h"
 #include <Arduino.h>
 #include <Wire.h>
 
+// Raw capture trace (sensor_trace.h): uncomment one to record every gate
+// result, either live on the serial port or into TRACE_PATH on SPIFFS. The
+// flash trace is dumped over serial and cleared when the button is held at
+// power-on. Replay with the native env: program --replay <file>
+// #define SENSOR_TRACE_SERIAL
+// #define SENSOR_TRACE_FLASH
+
+#ifdef SENSOR_TRACE_FLASH
+#include <SPIFFS.h>
+static const char *TRACE_PATH = "/trace.bin";
+#endif
+
 // Hardware configuration
 Display display(128, 32, 21, 22);
-ColorSensor sensor(27, 25, 32, 33, 35, 26);
+PcntFrequencyCapture capture;
+ColorSensor sensor(27, 25, 32, 33, 35, 26, capture);
+AcquisitionTask acquisition(sensor);
+CalibrationStore calibration;
 ColorSampler sampler;
-Button button(13);
+static const uint8_t BUTTON_PIN = 13;
+Button button(BUTTON_PIN);
 Bluetooth ble;
+PowerManager power(BUTTON_PIN, ble);
+MeasurementJournal journal; // "journal" partition, partitions.csv
+JournalSync journalSync(journal, ble);
+ConfigStore settings(ble);
 
 // Controller
-SamplingController controller(display, sensor, sampler, button, ble);
+SamplingController controller(display, sensor, acquisition, calibration,
+                              sampler, button, ble, power, journal,
+                              settings);
+
+TraceRecorder recorder(sensor);
+BootLog bootLog;
+
+// The BLE stack takes a few hundred ms to come up; it does so on core 0
+// while setup() brings up the sensor
+static const uint32_t BLE_INIT_STACK_SIZE = 4096;
+static SemaphoreHandle_t bleStarted = nullptr;
+
+static void startBle()
+{
+  ble.begin("Surface Color Detector");
+  bootLog.mark("ble");
+  xSemaphoreGive(bleStarted);
+}
+
+static void bleInitTask(void *arg)
+{
+  startBle();
+  vTaskDelete(nullptr);
+}
+
+#ifdef SENSOR_TRACE_FLASH
+File traceFile;
+
+static void beginFlashTrace()
+{
+  if (!SPIFFS.begin(true))
+  {
+    Serial.println("SPIFFS mount failed, trace disabled");
+    return;
+  }
+
+  pinMode(BUTTON_PIN, INPUT_PULLUP);
+  if (digitalRead(BUTTON_PIN) == LOW && SPIFFS.exists(TRACE_PATH))
+  {
+    File previous = SPIFFS.open(TRACE_PATH, FILE_READ);
+    uint8_t buffer[256];
+    size_t n;
+    while ((n = previous.read(buffer, sizeof(buffer))) > 0)
+    {
+      Serial.write(buffer, n);
+    }
+    previous.close();
+    SPIFFS.remove(TRACE_PATH);
+  }
+
+  traceFile = SPIFFS.open(TRACE_PATH, FILE_APPEND);
+  if (traceFile)
+  {
+    recorder.begin(traceFile, calibration.getActive());
+  }
+}
+#endif
 
+// No fixed delays: the splash stays up while the rest comes up (in full
+// only with CONFIG_FLAG_BOOT_SCREENS), and the phases are printed once the
+// controller takes input (boot_log.h)
 void setup()
 {
-  Serial.begin(115200);
-  delay(1000);
+  // Fast enough for the binary link (serial_link.h) at any stream rate
+  Serial.begin(LINK_BAUD_RATE);
   Serial.println("Starting...");
 
   if (!display.begin())
@@ -31,23 +121,89 @@ void setup()
     for (;;)
       ;
   }
-
   display.showSplash();
-  delay(2500);
+  unsigned long splashStart = millis();
+  bootLog.mark("display");
 
-  display.showWelcome();
-  delay(1500);
+  calibration.begin();
+  settings.begin();
+  DeviceConfig stored;
+  bool bootScreens =
+      settings.load(stored) && (stored.flags & CONFIG_FLAG_BOOT_SCREENS);
+  bootLog.mark("storage");
+
+  bleStarted = xSemaphoreCreateBinary();
+  if (xTaskCreatePinnedToCore(bleInitTask, "ble_init", BLE_INIT_STACK_SIZE,
+                              nullptr, 1, nullptr, 0) != pdPASS)
+  {
+    startBle();
+  }
 
+  sensor.setCalibration(calibration.getActive());
   sensor.begin();
+#if defined(SENSOR_TRACE_SERIAL)
+  recorder.begin(Serial, calibration.getActive());
+#elif defined(SENSOR_TRACE_FLASH)
+  beginFlashTrace();
+#endif
+  acquisition.begin();
+  // Warm-up reading, taken while the journal mounts: the LED and the
+  // capture unit have settled before the first sample a user asks for
+  acquisition.requestSample();
+  bootLog.mark("sensor");
+
+  journal.begin();
   button.begin();
-  ble.begin("Surface Color Detector");
+  bootLog.mark("journal");
+
+  SampleRecord warmUp;
+  unsigned long warmUpStart = millis();
+  while (!acquisition.pop(warmUp) &&
+         millis() - warmUpStart < AcquisitionTask::READ_TIMEOUT_MS)
+  {
+    delay(1);
+  }
+  bootLog.mark("first reading");
+
+  xSemaphoreTake(bleStarted, portMAX_DELAY);
+  journalSync.begin();
+
+  if (bootScreens)
+  {
+    while (millis() - splashStart < Display::SPLASH_DURATION_MS)
+    {
+      delay(10);
+    }
+    display.showWelcome();
+    delay(Display::WELCOME_DURATION_MS);
+  }
 
   controller.begin();
+  bootLog.mark("ready");
+  bootLog.print(Serial);
+  metrics.set(GAUGE_BOOT_MS, bootLog.getLastMs());
   Serial.println("Setup complete!");
 }
 
 void loop()
 {
   controller.update();
-  delay(30);
+#if defined(SENSOR_TRACE_SERIAL)
+  recorder.flush(Serial);
+#elif defined(SENSOR_TRACE_FLASH)
+  if (traceFile && recorder.flush(traceFile) > 0)
+  {
+    traceFile.flush();
+  }
+#endif
+  // Readings are queued by the acquisition task; the loop only drains them.
+  // In STATE_SLEEP the power manager decides how long to wait (or sleep).
+  if (power.isIdle())
+  {
+    power.idle();
+  }
+  else
+  {
+    delay(30);
+  }
 }
@@ -0,0 +1,535 @@
+#include "measurement_journal.h"
+
+// Slot 0 of every sector (little-endian):
+//   0  u32 magic         JOURNAL_MAGIC
+//   4  u8  version
+//   8  u32 generation    increases each time a sector is opened
+//   12 u32 firstSequence sequence of the sector's first record
+//   16 u32 eraseCount    erases of this sector
+//   20 u16 boot          session that opened the sector
+//   28 u32 crc32         of bytes 0-27
+//
+// Record slots:
+//   0  MeasurementRecord (encodeMeasurement)
+//   28 u32 crc32         of bytes 0-27
+//
+// Unused bytes stay erased (0xFF).
+static const uint32_t JOURNAL_MAGIC = 0x4C4E524A; // "JRNL"
+static const uint8_t JOURNAL_VERSION = 1;
+static const size_t CRC_OFFSET = 28;
+
+// ============================================================================
+// Byte Helpers
+// ============================================================================
+
+static void putU16(uint8_t *out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void putU32(uint8_t *out, uint32_t value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = value >> 24;
+}
+
+static uint16_t getU16(const uint8_t *in) {
+  return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t *in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) |
+         ((uint32_t)in[3] << 24);
+}
+
+// CRC-32 (IEEE, reflected), a nibble at a time
+static uint32_t crc32(const uint8_t *data, size_t length) {
+  static const uint32_t TABLE[16] = {
+      0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+      0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+      0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc = TABLE[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+    crc = TABLE[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+static void sealSlot(uint8_t *slot) {
+  putU32(slot + CRC_OFFSET, crc32(slot, CRC_OFFSET));
+}
+
+static bool isSealed(const uint8_t *slot) {
+  return getU32(slot + CRC_OFFSET) == crc32(slot, CRC_OFFSET);
+}
+
+static bool isBlank(const uint8_t *slot) {
+  for (size_t i = 0; i < MeasurementJournal::SLOT_SIZE; i++) {
+    if (slot[i] != 0xFF)
+      return false;
+  }
+  return true;
+}
+
+// ============================================================================
+// Slot Layout
+// ============================================================================
+
+struct SectorHeader {
+  uint32_t generation;
+  uint32_t firstSequence;
+  uint32_t eraseCount;
+  uint16_t boot;
+};
+
+static void encodeHeader(const SectorHeader &header, uint8_t *out) {
+  memset(out, 0xFF, MeasurementJournal::SLOT_SIZE);
+  putU32(out, JOURNAL_MAGIC);
+  out[4] = JOURNAL_VERSION;
+  putU32(out + 8, header.generation);
+  putU32(out + 12, header.firstSequence);
+  putU32(out + 16, header.eraseCount);
+  putU16(out + 20, header.boot);
+  sealSlot(out);
+}
+
+static bool decodeHeader(const uint8_t *in, SectorHeader &header) {
+  if (getU32(in) != JOURNAL_MAGIC || in[4] != JOURNAL_VERSION ||
+      !isSealed(in))
+    return false;
+  header.generation = getU32(in + 8);
+  header.firstSequence = getU32(in + 12);
+  header.eraseCount = getU32(in + 16);
+  header.boot = getU16(in + 20);
+  return true;
+}
+
+static void encodeRecord(const MeasurementRecord &record, uint8_t *out) {
+  memset(out, 0xFF, MeasurementJournal::SLOT_SIZE);
+  encodeMeasurement(record, out);
+  sealSlot(out);
+}
+
+static bool decodeRecord(const uint8_t *in, MeasurementRecord &record) {
+  if (!isSealed(in))
+    return false;
+  decodeMeasurement(in, record);
+  return record.sequence != 0;
+}
+
+void encodeMeasurement(const MeasurementRecord &record, uint8_t *out) {
+  putU32(out, record.sequence);
+  putU32(out + 4, record.timestamp);
+  putU16(out + 8, record.boot);
+  out[10] = record.red;
+  out[11] = record.green;
+  out[12] = record.blue;
+  out[13] = record.samples;
+  out[14] = record.rejected;
+  out[15] = record.profile;
+  putU16(out + 16, record.rawRed);
+  putU16(out + 18, record.rawGreen);
+  putU16(out + 20, record.rawBlue);
+  putU16(out + 22, record.nameId);
+  putU16(out + 24, record.ciTenths);
+  putU16(out + 26, 0xFFFF); // Reserved
+}
+
+void decodeMeasurement(const uint8_t *in, MeasurementRecord &record) {
+  record.sequence = getU32(in);
+  record.timestamp = getU32(in + 4);
+  record.boot = getU16(in + 8);
+  record.red = in[10];
+  record.green = in[11];
+  record.blue = in[12];
+  record.samples = in[13];
+  record.rejected = in[14];
+  record.profile = in[15];
+  record.rawRed = getU16(in + 16);
+  record.rawGreen = getU16(in + 18);
+  record.rawBlue = getU16(in + 20);
+  record.nameId = getU16(in + 22);
+  record.ciTenths = getU16(in + 24);
+}
+
+// ============================================================================
+// Mount
+// ============================================================================
+
+MeasurementJournal::MeasurementJournal(const char *label)
+    : partitionLabel(label), partition(nullptr), sectorCount(0), boot(0),
+      nextSequence(1), appended(0), writeSector(0), writeSlot(0),
+      generation(0), eraseCount(0), waiting(false), waitStartMs(0),
+      oldestSequence(1), committedSequence(0), written(0), batches(0),
+      erases(0), writeErrors(0), torn(0), maxEraseCount(0), maxBatchUs(0) {
+  for (size_t i = 0; i < MAX_SECTORS; i++) {
+    sectorFirst[i].store(0);
+  }
+#ifdef ESP_PLATFORM
+  task = nullptr;
+#endif
+}
+
+bool MeasurementJournal::begin() {
+  if (!mount()) {
+    partition = nullptr;
+    Serial.println("Journal unavailable, measurements are not stored");
+    return false;
+  }
+
+#ifdef ESP_PLATFORM
+  BaseType_t created = xTaskCreatePinnedToCore(taskEntry, "journal",
+                                               STACK_SIZE, this, PRIORITY,
+                                               &task, CORE);
+  if (created != pdPASS) {
+    Serial.println("Journal task create failed!");
+    partition = nullptr;
+    return false;
+  }
+#endif
+
+  Serial.print("Journal: ");
+  Serial.print(committedSequence.load() + 1 - oldestSequence.load());
+  Serial.print(" of ");
+  Serial.print(getStats().capacity);
+  Serial.print(" records, boot #");
+  Serial.println(boot);
+  return true;
+}
+
+bool MeasurementJournal::readSlot(size_t sector, size_t slot, uint8_t *data) {
+  size_t offset = sector * SECTOR_SIZE + slot * SLOT_SIZE;
+  return esp_partition_read(partition, offset, data, SLOT_SIZE) == ESP_OK;
+}
+
+// Finds the newest sector and the first free slot in it; formats a
+// partition that holds no journal
+bool MeasurementJournal::mount() {
+  partition = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)PARTITION_SUBTYPE,
+      partitionLabel);
+  if (!partition)
+    return false;
+
+  sectorCount = partition->size / SECTOR_SIZE;
+  if (sectorCount > MAX_SECTORS) {
+    sectorCount = MAX_SECTORS;
+  }
+  if (sectorCount < 2)
+    return false;
+
+  uint8_t slot[SLOT_SIZE];
+  SectorHeader newest = {0, 0, 0, 0};
+  bool found = false;
+  for (size_t s = 0; s < sectorCount; s++) {
+    SectorHeader header;
+    if (!readSlot(s, 0, slot) || !decodeHeader(slot, header))
+      continue;
+    sectorFirst[s].store(header.firstSequence);
+    if (header.eraseCount > maxEraseCount) {
+      maxEraseCount = header.eraseCount;
+    }
+    if (!found || header.generation > newest.generation) {
+      newest = header;
+      writeSector = s;
+      found = true;
+    }
+  }
+
+  if (!found) {
+    boot = 1;
+    writeSector = sectorCount - 1; // So sector 0 opens first
+    if (!openSector(0, 1))
+      return false;
+    nextSequence = 1;
+    committedSequence.store(0);
+    return true;
+  }
+
+  uint32_t lastSequence = 0;
+  uint16_t lastBoot = newest.boot;
+  writeSlot = scanSector(writeSector, lastSequence, lastBoot);
+  generation = newest.generation;
+  eraseCount = newest.eraseCount;
+  boot = lastBoot + 1;
+  nextSequence = lastSequence ? lastSequence + 1 : newest.firstSequence;
+  committedSequence.store(nextSequence - 1);
+  updateOldest();
+  return true;
+}
+
+// Returns the slot after the last programmed one
+size_t MeasurementJournal::scanSector(size_t sector, uint32_t &lastSequence,
+                                      uint16_t &lastBoot) {
+  uint8_t slot[SLOT_SIZE];
+  size_t end = 1;
+  for (size_t i = 1; i < SLOTS_PER_SECTOR; i++) {
+    if (!readSlot(sector, i, slot) || isBlank(slot))
+      continue;
+    end = i + 1;
+
+    MeasurementRecord record;
+    if (!decodeRecord(slot, record)) {
+      torn = torn + 1;
+      continue;
+    }
+    lastSequence = record.sequence;
+    lastBoot = record.boot;
+  }
+  return end;
+}
+
+// The oldest sector is the first one with a header after the write sector
+void MeasurementJournal::updateOldest() {
+  for (size_t i = 1; i <= sectorCount; i++) {
+    uint32_t first = sectorFirst[(writeSector + i) % sectorCount].load();
+    if (first != 0) {
+      oldestSequence.store(first);
+      return;
+    }
+  }
+}
+
+// ============================================================================
+// Writer Side
+// ============================================================================
+
+// Erases the sector and writes its header; the records it held are gone
+bool MeasurementJournal::openSector(size_t sector, uint32_t firstSequence) {
+  uint8_t slot[SLOT_SIZE];
+  SectorHeader previous;
+  // Without a header (never used, or torn) assume the wear of its
+  // predecessor in the ring
+  uint32_t count = eraseCount > 0 ? eraseCount : 1;
+  if (readSlot(sector, 0, slot) && decodeHeader(slot, previous)) {
+    count = previous.eraseCount + 1;
+  }
+
+  // Readers stop looking here before the erase starts
+  sectorFirst[sector].store(0);
+  writeSector = sector;
+  writeSlot = SLOTS_PER_SECTOR;
+  updateOldest();
+
+  if (esp_partition_erase_range(partition, sector * SECTOR_SIZE,
+                                SECTOR_SIZE) != ESP_OK) {
+    writeErrors = writeErrors + 1;
+    return false;
+  }
+  erases = erases + 1;
+  if (count > maxEraseCount) {
+    maxEraseCount = count;
+  }
+
+  SectorHeader header = {generation + 1, firstSequence, count, boot};
+  encodeHeader(header, slot);
+  if (esp_partition_write(partition, sector * SECTOR_SIZE, slot,
+                          SLOT_SIZE) != ESP_OK) {
+    writeErrors = writeErrors + 1;
+    return false;
+  }
+
+  generation = header.generation;
+  eraseCount = count;
+  writeSlot = 1;
+  sectorFirst[sector].store(firstSequence);
+  updateOldest();
+  return true;
+}
+
+// Starts the delay on the first queued record; due once a batch is full or
+// the delay has run out
+bool MeasurementJournal::flushDue() {
+  if (queue.isEmpty()) {
+    waiting = false;
+    return false;
+  }
+  if (!waiting) {
+    waiting = true;
+    waitStartMs = millis();
+  }
+  return queue.size() >= BATCH_RECORDS ||
+         millis() - waitStartMs >= FLUSH_DELAY_MS;
+}
+
+// Programs up to one batch of queued records, in as few writes as the
+// sector boundaries allow
+void MeasurementJournal::flush() {
+  unsigned long startUs = micros();
+  MeasurementRecord pending[BATCH_RECORDS];
+  size_t count = 0;
+  while (count < BATCH_RECORDS && queue.pop(pending[count])) {
+    count++;
+  }
+  waiting = false;
+
+  size_t done = 0;
+  while (done < count) {
+    if (writeSlot >= SLOTS_PER_SECTOR &&
+        !openSector((writeSector + 1) % sectorCount, pending[done].sequence))
+      break; // The rest of the batch is lost
+
+    size_t room = SLOTS_PER_SECTOR - writeSlot;
+    size_t chunk = count - done < room ? count - done : room;
+    for (size_t i = 0; i < chunk; i++) {
+      encodeRecord(pending[done + i], batch + i * SLOT_SIZE);
+    }
+    size_t offset = writeSector * SECTOR_SIZE + writeSlot * SLOT_SIZE;
+    esp_err_t err =
+        esp_partition_write(partition, offset, batch, chunk * SLOT_SIZE);
+
+    // A failed write may have programmed part of the range
+    writeSlot += chunk;
+    done += chunk;
+    if (err != ESP_OK) {
+      writeErrors = writeErrors + 1;
+      continue;
+    }
+    written = written + chunk;
+    batches = batches + 1;
+    committedSequence.store(pending[done - 1].sequence);
+  }
+
+  uint32_t elapsedUs = micros() - startUs;
+  if (elapsedUs > maxBatchUs) {
+    maxBatchUs = elapsedUs;
+  }
+}
+
+#ifdef ESP_PLATFORM
+
+void MeasurementJournal::taskEntry(void *arg) {
+  static_cast<MeasurementJournal *>(arg)->run();
+}
+
+void MeasurementJournal::run() {
+  for (;;) {
+    if (flushDue()) {
+      flush();
+      continue;
+    }
+    TickType_t wait = portMAX_DELAY;
+    if (waiting) {
+      wait = pdMS_TO_TICKS(FLUSH_DELAY_MS - (millis() - waitStartMs));
+    }
+    ulTaskNotifyTake(pdTRUE, wait);
+  }
+}
+
+#else
+
+void MeasurementJournal::poll() {
+  if (partition && flushDue()) {
+    flush();
+  }
+}
+
+#endif
+
+// ============================================================================
+// Loop Side
+// ============================================================================
+
+uint32_t MeasurementJournal::append(MeasurementRecord record) {
+  if (!partition)
+    return 0;
+
+  record.sequence = nextSequence;
+  record.boot = boot;
+  if (!queue.push(record))
+    return 0;
+  nextSequence++;
+  appended = appended + 1;
+
+#ifdef ESP_PLATFORM
+  if (task) {
+    xTaskNotifyGive(task);
+  }
+#endif
+  return record.sequence;
+}
+
+size_t MeasurementJournal::read(uint32_t fromSequence, MeasurementRecord *out,
+                                size_t max) {
+  uint32_t last = committedSequence.load();
+  if (!partition || max == 0 || fromSequence > last)
+    return 0;
+
+  // The sector with the highest first sequence not after fromSequence
+  size_t sector = sectorCount;
+  uint32_t sectorStart = 0;
+  for (size_t s = 0; s < sectorCount; s++) {
+    uint32_t first = sectorFirst[s].load();
+    if (first != 0 && first <= fromSequence && first >= sectorStart) {
+      sector = s;
+      sectorStart = first;
+    }
+  }
+  if (sector == sectorCount) {
+    // Older than the ring: start at its oldest record
+    fromSequence = oldestSequence.load();
+    for (size_t s = 0; s < sectorCount; s++) {
+      if (sectorFirst[s].load() == fromSequence) {
+        sector = s;
+        sectorStart = fromSequence;
+      }
+    }
+    if (sector == sectorCount)
+      return 0;
+  }
+
+  // Every sequence in a sector takes at least one slot (torn and failed
+  // writes take a slot without one), so fromSequence is no earlier than
+  // this; sequential reads start right at their record
+  uint8_t slot[SLOT_SIZE];
+  size_t count = 0;
+  size_t index = fromSequence - sectorStart + 1;
+  if (index >= SLOTS_PER_SECTOR) {
+    index = SLOTS_PER_SECTOR;
+  }
+  while (count < max) {
+    if (index >= SLOTS_PER_SECTOR) {
+      // Sectors follow in ring order until the sequence goes backwards
+      size_t next = (sector + 1) % sectorCount;
+      uint32_t first = sectorFirst[next].load();
+      if (first == 0 || first <= sectorStart)
+        break;
+      sector = next;
+      sectorStart = first;
+      index = 1;
+    }
+
+    if (!readSlot(sector, index++, slot))
+      break;
+    if (isBlank(slot)) {
+      index = SLOTS_PER_SECTOR; // Nothing more in this sector
+      continue;
+    }
+
+    MeasurementRecord record;
+    if (!decodeRecord(slot, record) || record.sequence < fromSequence)
+      continue;
+    if (record.sequence > last)
+      break;
+    out[count++] = record;
+  }
+  return count;
+}
+
+JournalStats MeasurementJournal::getStats() const {
+  JournalStats stats;
+  stats.capacity =
+      sectorCount > 1 ? (sectorCount - 1) * (SLOTS_PER_SECTOR - 1) : 0;
+  stats.appended = appended;
+  stats.dropped = queue.overflowCount();
+  stats.written = written;
+  stats.batches = batches;
+  stats.erases = erases;
+  stats.writeErrors = writeErrors;
+  stats.torn = torn;
+  stats.maxEraseCount = maxEraseCount;
+  stats.maxBatchUs = maxBatchUs;
+  return stats;
+}
@@ -0,0 +1,123 @@
+#include "metrics.h"
+#include <Arduino.h>
+
+Metrics metrics;
+
+static const char *COUNTER_NAMES[COUNTER_COUNT] = {
+    "ble_notified", "ble_notify_failed", "sensor_timeouts", "read_stalls"};
+static const char *GAUGE_NAMES[GAUGE_COUNT] = {"heap_free", "heap_min",
+                                               "boot_ms"};
+static const char *HISTOGRAM_NAMES[HISTOGRAM_COUNT] = {
+    "read_us", "loop_period_us", "display_flush_us"};
+
+Metrics::Metrics() {
+  for (auto &counter : counters) {
+    counter.store(0);
+  }
+  for (auto &gauge : gauges) {
+    gauge.store(0);
+  }
+  for (Histogram &h : histograms) {
+    for (auto &bucket : h.buckets) {
+      bucket.store(0);
+    }
+    h.max.store(0);
+  }
+}
+
+void Metrics::snapshot(MetricsSnapshot &out) const {
+  for (uint8_t i = 0; i < COUNTER_COUNT; i++) {
+    out.counters[i] = counters[i].load(std::memory_order_relaxed);
+  }
+  for (uint8_t i = 0; i < GAUGE_COUNT; i++) {
+    out.gauges[i] = gauges[i].load(std::memory_order_relaxed);
+  }
+  for (uint8_t i = 0; i < HISTOGRAM_COUNT; i++) {
+    const Histogram &h = histograms[i];
+    for (uint8_t b = 0; b < METRICS_BUCKETS; b++) {
+      out.histograms[i].buckets[b] =
+          h.buckets[b].load(std::memory_order_relaxed);
+    }
+    out.histograms[i].max = h.max.load(std::memory_order_relaxed);
+  }
+}
+
+uint32_t Metrics::bucketLimit(uint8_t bucket) {
+  if (bucket + 1 >= METRICS_BUCKETS)
+    return 0;
+  return 1UL << (METRICS_FIRST_BUCKET_LOG2 + bucket);
+}
+
+const char *Metrics::counterName(CounterId id) { return COUNTER_NAMES[id]; }
+
+const char *Metrics::gaugeName(GaugeId id) { return GAUGE_NAMES[id]; }
+
+const char *Metrics::histogramName(HistogramId id) {
+  return HISTOGRAM_NAMES[id];
+}
+
+// ============================================================================
+// Text Output
+// ============================================================================
+
+// Upper bound of the bucket holding the given fraction of the events
+static void printPercentile(Print &out, const HistogramSnapshot &h,
+                            uint32_t total, uint8_t percent) {
+  uint32_t target = ((uint64_t)total * percent + 99) / 100;
+  uint32_t seen = 0;
+  uint8_t bucket = 0;
+  while (bucket + 1 < METRICS_BUCKETS) {
+    seen += h.buckets[bucket];
+    if (seen >= target)
+      break;
+    bucket++;
+  }
+
+  out.print(" p");
+  out.print(percent);
+  uint32_t limit = Metrics::bucketLimit(bucket);
+  if (limit) {
+    out.print("<");
+    out.print(limit);
+  } else {
+    out.print(">=");
+    out.print(1UL << (METRICS_FIRST_BUCKET_LOG2 + METRICS_BUCKETS - 2));
+  }
+}
+
+void printMetrics(Print &out, const MetricsSnapshot &snapshot) {
+  for (uint8_t i = 0; i < COUNTER_COUNT; i++) {
+    out.print(Metrics::counterName((CounterId)i));
+    out.print(" ");
+    out.println(snapshot.counters[i]);
+  }
+  for (uint8_t i = 0; i < GAUGE_COUNT; i++) {
+    out.print(Metrics::gaugeName((GaugeId)i));
+    out.print(" ");
+    out.println(snapshot.gauges[i]);
+  }
+  for (uint8_t i = 0; i < HISTOGRAM_COUNT; i++) {
+    const HistogramSnapshot &h = snapshot.histograms[i];
+    uint32_t total = 0;
+    for (uint8_t b = 0; b < METRICS_BUCKETS; b++) {
+      total += h.buckets[b];
+    }
+
+    out.print(Metrics::histogramName((HistogramId)i));
+    out.print(" n=");
+    out.print(total);
+    if (total > 0) {
+      printPercentile(out, h, total, 50);
+      printPercentile(out, h, total, 99);
+      out.print(" max=");
+      out.print(h.max);
+    }
+    out.print(" [");
+    for (uint8_t b = 0; b < METRICS_BUCKETS; b++) {
+      if (b > 0)
+        out.print(" ");
+      out.print(h.buckets[b]);
+    }
+    out.println("]");
+  }
+}
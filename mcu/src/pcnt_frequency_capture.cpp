@@ -0,0 +1,123 @@
+#include "pcnt_frequency_capture.h"
+#include <Arduino.h>
+
+// 16-bit hardware counter; wraps are accumulated in software
+static const int16_t COUNTER_LIMIT = 32767;
+
+// Glitch filter in APB cycles (80 MHz): ignores pulses shorter than ~125 ns
+static const uint16_t GLITCH_FILTER = 10;
+
+PcntFrequencyCapture::PcntFrequencyCapture(pcnt_unit_t pcntUnit)
+    : unit(pcntUnit), timer(nullptr), phase(PHASE_IDLE), overflows(0),
+      gateUs(0), gateStart(0) {}
+
+bool PcntFrequencyCapture::begin(uint8_t pin) {
+  pcnt_config_t config = {};
+  config.pulse_gpio_num = pin;
+  config.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+  config.channel = PCNT_CHANNEL_0;
+  config.unit = unit;
+  config.pos_mode = PCNT_COUNT_INC; // Count both edges
+  config.neg_mode = PCNT_COUNT_INC;
+  config.lctrl_mode = PCNT_MODE_KEEP;
+  config.hctrl_mode = PCNT_MODE_KEEP;
+  config.counter_h_lim = COUNTER_LIMIT;
+  config.counter_l_lim = 0;
+
+  if (pcnt_unit_config(&config) != ESP_OK) {
+    Serial.println("PCNT config failed!");
+    return false;
+  }
+
+  pcnt_set_filter_value(unit, GLITCH_FILTER);
+  pcnt_filter_enable(unit);
+
+  pcnt_event_enable(unit, PCNT_EVT_H_LIM);
+  pcnt_isr_service_install(0);
+  pcnt_isr_handler_add(unit, onOverflow, this);
+
+  pcnt_counter_pause(unit);
+  pcnt_counter_clear(unit);
+
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = onTimer;
+  timerArgs.arg = this;
+  timerArgs.dispatch_method = ESP_TIMER_TASK;
+  timerArgs.name = "capture_gate";
+
+  if (esp_timer_create(&timerArgs, &timer) != ESP_OK) {
+    Serial.println("Capture timer create failed!");
+    return false;
+  }
+
+  return true;
+}
+
+bool PcntFrequencyCapture::start(uint32_t settleUs, uint32_t gate) {
+  bool expected = false;
+  if (!busy.compare_exchange_strong(expected, true))
+    return false;
+
+  gateUs = gate;
+
+  if (settleUs == 0) {
+    openGate();
+  } else {
+    phase = PHASE_SETTLING;
+    esp_timer_start_once(timer, settleUs);
+  }
+  return true;
+}
+
+// A timer callback already running finishes first (esp_timer_stop() does
+// not wait for it); its completion is then ignored by the caller
+void PcntFrequencyCapture::abort() {
+  esp_timer_stop(timer);
+  pcnt_counter_pause(unit);
+  pcnt_counter_clear(unit);
+  phase = PHASE_IDLE;
+  cancel();
+}
+
+// ============================================================================
+// Gate Control
+// ============================================================================
+
+void PcntFrequencyCapture::openGate() {
+  pcnt_counter_clear(unit);
+  overflows = 0;
+  phase = PHASE_GATING;
+  gateStart = esp_timer_get_time();
+  pcnt_counter_resume(unit);
+  esp_timer_start_once(timer, gateUs);
+}
+
+void PcntFrequencyCapture::closeGate() {
+  pcnt_counter_pause(unit);
+  int64_t gateEnd = esp_timer_get_time();
+
+  int16_t count = 0;
+  pcnt_get_counter_value(unit, &count);
+
+  CaptureResult result;
+  result.edges = overflows * (uint32_t)COUNTER_LIMIT + (uint16_t)count;
+  result.gateUs = (uint32_t)(gateEnd - gateStart);
+
+  phase = PHASE_IDLE;
+  complete(result);
+}
+
+void PcntFrequencyCapture::onTimer(void *arg) {
+  PcntFrequencyCapture *self = static_cast<PcntFrequencyCapture *>(arg);
+
+  if (self->phase == PHASE_SETTLING) {
+    self->openGate();
+  } else if (self->phase == PHASE_GATING) {
+    self->closeGate();
+  }
+}
+
+void IRAM_ATTR PcntFrequencyCapture::onOverflow(void *arg) {
+  PcntFrequencyCapture *self = static_cast<PcntFrequencyCapture *>(arg);
+  self->overflows = self->overflows + 1;
+}
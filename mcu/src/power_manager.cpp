@@ -0,0 +1,149 @@
+#include "power_manager.h"
+
+#ifdef ESP_PLATFORM
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#endif
+
+PowerManager::PowerManager(uint8_t wakePin, Bluetooth &bluetooth)
+    : pin(wakePin), ble(bluetooth), idling(false), advertiseUntil(0),
+      buttonWake(false), buttonWakeMs(0), buttonWakeUs(0),
+      wakePending(false), wakeStartUs(0), stats{} {}
+
+// ============================================================================
+// Idle Periods
+// ============================================================================
+
+void PowerManager::enterIdle() {
+  if (idling)
+    return;
+
+  idling = true;
+  // Keep advertising until the first sleep slice
+  advertiseUntil = millis() + IDLE_SETTLE_MS;
+  buttonWake = false;
+  wakePending = false;
+  stats.idlePeriods++;
+
+  ble.setLowPower(true);
+  setCpuMhz(IDLE_CPU_MHZ);
+}
+
+void PowerManager::exitIdle(uint32_t pressUs) {
+  if (!idling)
+    return;
+
+  idling = false;
+  // A press that woke the chip happened while the button interrupt was
+  // off; the wake is the earliest time known for it
+  wakeStartUs = buttonWake ? buttonWakeUs : pressUs;
+  buttonWake = false;
+  wakePending = true;
+  stats.wakes++;
+
+  setCpuMhz(ACTIVE_CPU_MHZ);
+  ble.setLowPower(false);
+  ble.resumeAdvertising();
+}
+
+void PowerManager::recordWakeSample() {
+  if (!wakePending)
+    return;
+
+  wakePending = false;
+  uint32_t latencyUs = micros() - wakeStartUs;
+  stats.wakeLatencyUs = latencyUs;
+  if (latencyUs > stats.maxWakeLatencyUs) {
+    stats.maxWakeLatencyUs = latencyUs;
+  }
+  if (latencyUs > WAKE_LATENCY_BUDGET_US) {
+    stats.overBudget++;
+  }
+
+  Serial.print("Wake to first sample: ");
+  Serial.print(latencyUs);
+  Serial.print("us (budget ");
+  Serial.print(WAKE_LATENCY_BUDGET_US);
+  Serial.println("us)");
+}
+
+void PowerManager::setCpuMhz(uint32_t mhz) {
+#ifdef ESP_PLATFORM
+  if (getCpuFrequencyMhz() != mhz) {
+    setCpuFrequencyMhz(mhz);
+  }
+#endif
+}
+
+// ============================================================================
+// Idle Loop
+// ============================================================================
+
+void PowerManager::idle() {
+#ifdef ESP_PLATFORM
+  unsigned long now = millis();
+
+  // Stay awake while the loop debounces the press that woke us; too short
+  // to count, it was a glitch
+  if (buttonWake) {
+    if (now - buttonWakeMs < WAKE_GRACE_MS) {
+      delay(WAKE_POLL_MS);
+      return;
+    }
+    buttonWake = false;
+  }
+
+  if (ble.isConnected() || (long)(now - advertiseUntil) < 0) {
+    delay(IDLE_POLL_MS);
+    return;
+  }
+
+  ble.pauseAdvertising();
+  lightSleep(IDLE_WAKE_INTERVAL_MS);
+  if (!buttonWake) {
+    ble.resumeAdvertising();
+    advertiseUntil = millis() + ADVERTISE_WINDOW_MS;
+  }
+#else
+  delay(IDLE_POLL_MS);
+#endif
+}
+
+#ifdef ESP_PLATFORM
+void PowerManager::lightSleep(unsigned long ms) {
+  gpio_num_t gpio = (gpio_num_t)pin;
+
+  // Wake on the button level, with its edge interrupt off: a level
+  // interrupt would fire continuously while the button is held after waking
+  gpio_intr_disable(gpio);
+  gpio_wakeup_enable(gpio, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+
+  // The UART stops in light sleep
+  Serial.flush();
+
+  uint32_t startUs = micros();
+  esp_err_t err = esp_light_sleep_start();
+  uint32_t wakeUs = micros();
+
+  gpio_wakeup_disable(gpio);
+  gpio_set_intr_type(gpio, GPIO_INTR_ANYEDGE);
+  gpio_intr_enable(gpio);
+
+  if (err != ESP_OK) {
+    // Refused (e.g. the BT controller is busy); poll this slice instead
+    stats.sleepRejected++;
+    delay(IDLE_POLL_MS);
+    return;
+  }
+
+  stats.sleeps++;
+  stats.sleepMs += (wakeUs - startUs) / 1000;
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO) {
+    buttonWake = true;
+    buttonWakeUs = wakeUs;
+    buttonWakeMs = millis();
+  }
+}
+#endif
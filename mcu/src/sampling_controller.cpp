@@ -1,60 +1,600 @@
 #include "sampling_controller.h"
 
-static const unsigned long BUTTON_WAIT_DELAY = 50;
 static const unsigned long PROGRESS_SHOW_DELAY = 200;
+static const unsigned long MIN_PRESS_DURATION = 50;
+
+// Button hold thresholds, see applyHoldThresholds()
+static const uint8_t HOLD_FINALIZE = 0;
+static const uint8_t HOLD_LED_TOGGLE = 1;
 
 SamplingController::SamplingController(Display &disp, ColorSensor &sens,
+                                       AcquisitionTask &acq,
+                                       CalibrationStore &cal,
                                        ColorSampler &samp, Button &btn,
-                                       Bluetooth &bluetooth)
-    : display(disp), sensor(sens), sampler(samp), button(btn), ble(bluetooth),
-      longPressDuration(LONG_PRESS_DURATION),
+                                       Bluetooth &bluetooth,
+                                       PowerManager &pwr,
+                                       MeasurementJournal &jrnl,
+                                       ConfigStore &cfg)
+    : display(disp), sensor(sens), acquisition(acq), calibration(cal),
+      sampler(samp), button(btn), ble(bluetooth), power(pwr), journal(jrnl),
+      settings(cfg), longPressDuration(LONG_PRESS_DURATION),
       ledToggleDuration(LED_TOGGLE_DURATION),
       autoLedOffTimeout(AUTO_LED_OFF_TIMEOUT),
-      minSamplesRequired(MIN_SAMPLES_REQUIRED), lastButtonState(false),
-      longPressHandled(false), ledToggleHandled(false), lastActivityTime(0),
-      lastAvgColor({0, 0, 0}), lastColorName("") {}
+      minSamplesRequired(MIN_SAMPLES_REQUIRED), autoFinalize(true),
+      bootScreens(false),
+      streamRate(STREAM_RATE_HZ), streamPeriod(1000 / STREAM_RATE_HZ),
+      settleTimeUs(ColorSensor::SETTLE_TIME_US),
+      gateTimeUs(ColorSensor::GATE_TIME_US),
+      streamSettleTimeUs(STREAM_SETTLE_TIME_US),
+      streamGateTimeUs(STREAM_GATE_TIME_US), state(STATE_READY),
+      pendingState(STATE_READY), transitionPending(false), transitionAt(0),
+      pressConsumed(false), longPressHandled(false),
+      ledToggleHandled(false), lastActivityTime(0), lastAvgColor({0, 0, 0}),
+      lastColorName(""), streamOverflowBase(0), lastStreamDisplay(0),
+      statsWindowStart(0), statsWindowSamples(0), streamPacketStart(0),
+      streamStats({0, 0, 0.0f}), calStep(CAL_WHITE), calProfile{},
+      calCapturing(false), calCaptureStart(0), calTotals{0, 0, 0},
+      calCount(0), streamSequence(0), resultSequence(0),
+      loopStats({0, 0, 0, 0, 0}), lastLoopReport(0), lastUpdateUs(0),
+      commandLine{}, commandLength(0), link(Serial), linkStreaming(false),
+      linkReadsPending(0) {}
 
 // ============================================================================
 // Initialization
 // ============================================================================
 
 void SamplingController::begin() {
+  // Stored settings replace the built-in defaults
+  DeviceConfig config = getConfig();
+  if (settings.load(config)) {
+    Serial.println("Config loaded from NVS");
+  }
+  applyConfig(config);
+  settings.publish(getConfig(), CONFIG_OK, 0);
+
   updateActivity();
-  display.showMessage("Ready!", "Press to sample");
+  lastLoopReport = millis();
+  enterState(STATE_READY);
 
   Serial.println("Controls:");
   Serial.println("  Short press: Add sample");
-  Serial.println("  2s hold: Finalize and send");
-  Serial.println("  5s hold: Toggle LED on/off");
+  Serial.print("  ");
+  Serial.print(longPressDuration / 1000.0f, 1);
+  Serial.println("s hold: Finalize and send");
+  Serial.print("  ");
+  Serial.print(ledToggleDuration / 1000.0f, 1);
+  Serial.println("s hold: Toggle LED on/off");
+  Serial.println("  Double tap: Start/stop streaming");
   Serial.println("  Triple tap: Reset samples");
+  Serial.println("  4 taps: Calibrate (white, then black)");
+  Serial.println("  5 taps: Next calibration profile");
   Serial.print("Min samples: ");
-  Serial.println(minSamplesRequired);
+  Serial.print(minSamplesRequired);
+  if (minSamplesRequired > ColorSampler::MIN_CONFIDENT_SAMPLES) {
+    Serial.print(" (");
+    Serial.print(ColorSampler::MIN_CONFIDENT_SAMPLES);
+    Serial.print(" once the 95% CI is tight)");
+  }
+  Serial.println();
 }
 
 void SamplingController::setLongPressDuration(unsigned long ms) {
   longPressDuration = ms;
+  applyHoldThresholds();
 }
 
 void SamplingController::setMinSamplesRequired(int count) {
   minSamplesRequired = count;
 }
 
+void SamplingController::setAutoFinalize(bool enabled) {
+  autoFinalize = enabled;
+}
+
+void SamplingController::setStreamRate(int hz) {
+  if (hz > 0) {
+    streamRate = hz;
+    streamPeriod = max(1UL, 1000UL / hz);
+  }
+  if (state == STATE_STREAMING) {
+    acquisition.startStreaming(streamPeriod);
+  }
+}
+
+// ============================================================================
+// Remote Configuration
+// ============================================================================
+
+DeviceConfig SamplingController::getConfig() {
+  DeviceConfig config;
+  config.flags = 0;
+  if (autoFinalize)
+    config.flags |= CONFIG_FLAG_AUTO_FINALIZE;
+  if (sensor.isAutoRange())
+    config.flags |= CONFIG_FLAG_AUTO_RANGE;
+  if (sensor.isAmbientMode())
+    config.flags |= CONFIG_FLAG_AMBIENT;
+  if (bootScreens)
+    config.flags |= CONFIG_FLAG_BOOT_SCREENS;
+  config.longPressMs = longPressDuration;
+  config.ledToggleMs = ledToggleDuration;
+  config.autoOffMs = autoLedOffTimeout;
+  config.minSamples = minSamplesRequired;
+  config.streamRateHz = streamRate;
+  config.settleUs = settleTimeUs;
+  config.gateUs = gateTimeUs;
+  config.streamSettleUs = streamSettleTimeUs;
+  config.streamGateUs = streamGateTimeUs;
+  config.scaling = sensor.getScaling();
+  config.ciTargetTenths = sampler.getConfidenceTarget() * 10 + 0.5f;
+  return config;
+}
+
+// Takes effect from the next reading and the next press; samples taken so
+// far are kept (raw values do not depend on the capture settings)
+void SamplingController::applyConfig(const DeviceConfig &config) {
+  longPressDuration = config.longPressMs;
+  ledToggleDuration = config.ledToggleMs;
+  applyHoldThresholds();
+  autoLedOffTimeout = config.autoOffMs;
+  minSamplesRequired = config.minSamples;
+  autoFinalize = config.flags & CONFIG_FLAG_AUTO_FINALIZE;
+  bootScreens = config.flags & CONFIG_FLAG_BOOT_SCREENS;
+  sampler.setConfidenceTarget(config.ciTargetTenths / 10.0f);
+
+  settleTimeUs = config.settleUs;
+  gateTimeUs = config.gateUs;
+  streamSettleTimeUs = config.streamSettleUs;
+  streamGateTimeUs = config.streamGateUs;
+  if (state == STATE_STREAMING) {
+    sensor.setCaptureTiming(streamSettleTimeUs, streamGateTimeUs);
+  } else {
+    sensor.setCaptureTiming(settleTimeUs, gateTimeUs);
+  }
+  sensor.setAutoRange(config.flags & CONFIG_FLAG_AUTO_RANGE);
+  sensor.setScaling((OutputScaling)config.scaling);
+  bool ambient = config.flags & CONFIG_FLAG_AMBIENT;
+  if (ambient != sensor.isAmbientMode()) {
+    sensor.setAmbientMode(ambient);
+  }
+  setStreamRate(config.streamRateHz);
+}
+
+// Client writes, already validated on the BLE task
+void SamplingController::serviceConfig() {
+  ConfigUpdate update;
+  while (settings.takeUpdate(update)) {
+    Serial.print("Config from client ");
+    Serial.print(update.connId);
+    if (update.status != CONFIG_OK) {
+      Serial.print(" rejected (status ");
+      Serial.print(update.status);
+      Serial.print(", field ");
+      Serial.print(update.field);
+      Serial.println(")");
+      settings.publish(getConfig(), update.status, update.field);
+      continue;
+    }
+
+    applyConfig(update.config);
+    uint8_t status = CONFIG_OK;
+    if (!settings.save(update.config)) {
+      Serial.println(" applied, NOT saved!");
+      status = CONFIG_NOT_SAVED;
+    } else {
+      Serial.println(" applied and saved");
+    }
+    settings.publish(getConfig(), status, 0);
+  }
+}
+
+// ============================================================================
+// State Machine
+// ============================================================================
+
+void SamplingController::enterState(ControllerState next) {
+  state = next;
+
+  switch (next) {
+  case STATE_READY:
+    showCurrentState();
+    break;
+  case STATE_CALIBRATE:
+    showCalibrationStep();
+    break;
+  case STATE_SLEEP:
+    // Keep whatever message announced the sleep on screen
+    power.enterIdle();
+    break;
+  default:
+    break;
+  }
+}
+
+void SamplingController::showMessageFor(const String &line1,
+                                        const String &line2,
+                                        unsigned long durationMs,
+                                        ControllerState next) {
+  display.showMessage(line1, line2);
+  state = STATE_MESSAGE;
+  pendingState = next;
+  transitionAt = millis() + durationMs;
+  transitionPending = true;
+}
+
+void SamplingController::runScheduledTransition() {
+  if (!transitionPending || (long)(millis() - transitionAt) < 0)
+    return;
+
+  transitionPending = false;
+  enterState(pendingState);
+}
+
+void SamplingController::cancelTransition() {
+  transitionPending = false;
+  if (state == STATE_MESSAGE) {
+    state = STATE_READY;
+  }
+}
+
+// ============================================================================
+// Streaming
+// ============================================================================
+
+void SamplingController::startStreaming() { beginStreaming(streamPeriod); }
+
+// A period of 0 takes readings back to back
+void SamplingController::beginStreaming(unsigned long periodMs) {
+  if (state == STATE_STREAMING)
+    return;
+
+  updateActivity();
+  sensor.ensureLedOn();
+  sensor.setCaptureTiming(streamSettleTimeUs, streamGateTimeUs);
+
+  // Streaming is its own session; drop the samples the taps just took
+  sampler.reset();
+  transitionPending = false;
+  state = STATE_STREAMING;
+  streamAverage.reset();
+  streamStats = {0, 0, 0.0f};
+  statsWindowSamples = 0;
+  statsWindowStart = millis();
+  lastStreamDisplay = 0;
+
+  acquisition.clear();
+  streamOverflowBase = acquisition.getStats().overflows;
+  acquisition.startStreaming(periodMs);
+
+  display.showMessage("Streaming...", "Double tap to stop");
+  if (periodMs == 0) {
+    Serial.println("Streaming started back to back");
+  } else {
+    Serial.print("Streaming started at ");
+    Serial.print(1000 / periodMs);
+    Serial.println(" Hz");
+  }
+}
+
+void SamplingController::stopStreaming() {
+  if (state != STATE_STREAMING)
+    return;
+
+  updateActivity();
+  acquisition.stopStreaming();
+  flushStreamPacket();
+  link.flush();
+  linkStreaming = false;
+  sensor.setCaptureTiming(settleTimeUs, gateTimeUs);
+
+  Serial.print("Streaming stopped. Samples: ");
+  Serial.print(streamStats.samples);
+  Serial.print(" Dropped: ");
+  Serial.println(streamStats.dropped);
+
+  // Late streamed readings are discarded by collectReadings()
+  enterState(STATE_READY);
+}
+
+void SamplingController::serviceStream() {
+  updateStreamStats();
+
+  // Bound the latency of a partially filled packet
+  if (!streamPacket.isEmpty() &&
+      millis() - streamPacketStart >= STREAM_FLUSH_INTERVAL) {
+    flushStreamPacket();
+  }
+}
+
+void SamplingController::flushStreamPacket() {
+  if (streamPacket.isEmpty())
+    return;
+
+  ble.publish(BLE_CHANNEL_STREAM, streamPacket.data(), streamPacket.size());
+  streamPacket.clear();
+}
+
+void SamplingController::updateStreamStats() {
+  unsigned long elapsed = millis() - statsWindowStart;
+  if (elapsed < STREAM_STATS_INTERVAL)
+    return;
+
+  AcquisitionStats acq = acquisition.getStats();
+  streamStats.samplesPerSec = (statsWindowSamples * 1000.0f) / elapsed;
+  streamStats.dropped = acq.missedSlots + (acq.overflows - streamOverflowBase);
+  statsWindowSamples = 0;
+  statsWindowStart = millis();
+
+  Serial.print("Stream: ");
+  Serial.print(streamStats.samplesPerSec, 1);
+  Serial.print(" samples/s, dropped ");
+  Serial.print(streamStats.dropped);
+  Serial.print(", ring high-water ");
+  Serial.print(acq.highWaterMark);
+  Serial.print("/");
+  Serial.println(AcquisitionTask::RING_CAPACITY);
+}
+
+// ============================================================================
+// Calibration
+// ============================================================================
+
+void SamplingController::startCalibration() {
+  if (state == STATE_STREAMING) {
+    stopStreaming();
+  }
+
+  updateActivity();
+  sensor.ensureLedOn();
+
+  // Tap samples belong to no measurement, and the new mapping would
+  // invalidate them anyway
+  sampler.reset();
+  transitionPending = false;
+  calProfile = calibration.getActive();
+  calStep = CAL_WHITE;
+  calCapturing = false;
+
+  Serial.print("Calibrating profile: ");
+  Serial.println(calProfile.name);
+  enterState(STATE_CALIBRATE);
+}
+
+bool SamplingController::selectProfile(uint8_t slot) {
+  if (!calibration.select(slot) ||
+      !sensor.setCalibration(calibration.getActive()))
+    return false;
+
+  sampler.reset();
+  Serial.print("Calibration profile: ");
+  Serial.println(calibration.getActive().name);
+  return true;
+}
+
+void SamplingController::showCalibrationStep() {
+  display.showMessage(calStep == CAL_WHITE ? "Calibrate: WHITE"
+                                           : "Calibrate: BLACK",
+                      "Press on reference");
+}
+
+void SamplingController::finishCalibration() {
+  calCapturing = false;
+
+  if (!CalibrationStore::isValid(calProfile)) {
+    Serial.println("Calibration failed: black must read darker than white");
+    showMessageFor("Calibration failed", "Check references",
+                   ERROR_MESSAGE_DURATION, STATE_READY);
+    return;
+  }
+
+  if (!calibration.saveActive(calProfile)) {
+    Serial.println("WARNING: Calibration not saved!");
+  }
+  sensor.setCalibration(calProfile);
+
+  Serial.print("Calibrated ");
+  Serial.print(calProfile.name);
+  Serial.print(" white ");
+  Serial.print(calProfile.white[0]);
+  Serial.print("/");
+  Serial.print(calProfile.white[1]);
+  Serial.print("/");
+  Serial.print(calProfile.white[2]);
+  Serial.print(" black ");
+  Serial.print(calProfile.black[0]);
+  Serial.print("/");
+  Serial.print(calProfile.black[1]);
+  Serial.print("/");
+  Serial.println(calProfile.black[2]);
+
+  showMessageFor("Calibrated!", calProfile.name, CALIBRATION_MESSAGE_DURATION,
+                 STATE_READY);
+}
+
 // ============================================================================
 // Helper Methods
 // ============================================================================
 
 void SamplingController::updateActivity() { lastActivityTime = millis(); }
 
-void SamplingController::waitForButtonRelease() {
-  while (button.isPressed()) {
-    delay(BUTTON_WAIT_DELAY);
+void SamplingController::sampleHeap() {
+#ifdef ESP_PLATFORM
+  metrics.set(GAUGE_HEAP_FREE, ESP.getFreeHeap());
+  metrics.set(GAUGE_HEAP_MIN, ESP.getMinFreeHeap());
+#endif
+}
+
+// Line commands and link frames on the serial port; the loop never waits
+// for input
+void SamplingController::serviceSerial() {
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    // The sync byte never occurs in a text command
+    if (c == LINK_SYNC || !link.isIdle()) {
+      LinkCommand command;
+      if (link.feed(c, command)) {
+        handleLinkCommand(command);
+      }
+      continue;
+    }
+
+    if (c != '\n' && c != '\r') {
+      if (commandLength < sizeof(commandLine) - 1)
+        commandLine[commandLength++] = c;
+      continue;
+    }
+    if (commandLength == 0)
+      continue;
+
+    commandLine[commandLength] = '\0';
+    commandLength = 0;
+    if (strcmp(commandLine, "metrics") == 0) {
+      sampleHeap();
+      MetricsSnapshot snapshot;
+      metrics.snapshot(snapshot);
+      printMetrics(Serial, snapshot);
+    } else {
+      Serial.print("Unknown command: ");
+      Serial.println(commandLine);
+    }
+  }
+}
+
+void SamplingController::handleLinkCommand(const LinkCommand &command) {
+  uint8_t status = LINK_OK;
+  uint32_t value = 0;
+  bool idle = state == STATE_READY || state == STATE_RESULT ||
+              state == STATE_MESSAGE;
+
+  switch (command.opcode) {
+  case LINK_CMD_START_STREAM: {
+    if (command.length != 1) {
+      status = LINK_BAD_LENGTH;
+      break;
+    }
+    if (!idle && state != STATE_STREAMING) {
+      status = LINK_BUSY;
+      break;
+    }
+    uint8_t hz = command.args[0];
+    unsigned long period = hz > 0 ? max(1UL, 1000UL / hz) : 0;
+    if (state == STATE_STREAMING) {
+      acquisition.startStreaming(period); // Streaming from a double tap
+    } else {
+      beginStreaming(period);
+    }
+    linkStreaming = true;
+    break;
+  }
+
+  case LINK_CMD_STOP_STREAM:
+    if (command.length != 0) {
+      status = LINK_BAD_LENGTH;
+      break;
+    }
+    if (state == STATE_STREAMING) {
+      AcquisitionStats acq = acquisition.getStats();
+      value = acq.missedSlots + (acq.overflows - streamOverflowBase);
+      collectReadings(); // Everything taken so far goes before the ACK
+      stopStreaming();
+    }
+    break;
+
+  case LINK_CMD_SET_SCALING:
+    if (command.length != 1) {
+      status = LINK_BAD_LENGTH;
+    } else if (command.args[0] == LINK_SCALING_AUTO) {
+      sensor.setAutoRange(true);
+    } else if (command.args[0] <= SCALING_100) {
+      sensor.setAutoRange(false);
+      sensor.setScaling((OutputScaling)command.args[0]);
+    } else {
+      status = LINK_BAD_VALUE;
+    }
+    break;
+
+  case LINK_CMD_TRIGGER_READ:
+    if (command.length != 0) {
+      status = LINK_BAD_LENGTH;
+    } else if (!idle || power.isWakePending()) {
+      status = LINK_BUSY;
+    } else {
+      linkReadsPending++;
+      acquisition.requestSample();
+    }
+    break;
+
+  default:
+    status = LINK_BAD_COMMAND;
+    break;
+  }
+
+  if (status == LINK_OK) {
+    updateActivity();
   }
+  link.sendAck(command.opcode, status, value);
+}
+
+// Sensor settings in force, for readings sent on the link
+uint8_t SamplingController::linkInfo() {
+  return (sensor.getScaling() & LINK_INFO_SCALING_MASK) |
+         (sensor.isAutoRange() ? LINK_INFO_AUTO_RANGE : 0) |
+         (sensor.isAmbientMode() ? LINK_INFO_AMBIENT : 0) |
+         (sensor.isLedOn() ? LINK_INFO_LED : 0);
+}
+
+static uint16_t clampRaw(unsigned long value) {
+  return value > 0xFFFF ? 0xFFFF : (uint16_t)value;
 }
 
-void SamplingController::waitForButtonPress() {
-  while (!button.isPressed()) {
-    delay(BUTTON_WAIT_DELAY);
+ColorRecord SamplingController::makeRecord(uint16_t sequence,
+                                           const RGBColor &color,
+                                           const RawFrequencies &raw,
+                                           unsigned long timestamp,
+                                           uint16_t nameId, uint8_t flags) {
+  ColorRecord record;
+  record.sequence = sequence;
+  record.timestamp = timestamp;
+  record.red = color.red;
+  record.green = color.green;
+  record.blue = color.blue;
+  record.flags = flags;
+  if (raw.red == 0 || raw.green == 0 || raw.blue == 0) {
+    record.flags |= RECORD_FLAG_TIMEOUT;
   }
+  record.rawRed = clampRaw(raw.red);
+  record.rawGreen = clampRaw(raw.green);
+  record.rawBlue = clampRaw(raw.blue);
+  record.nameId = nameId;
+  return record;
+}
+
+// Sequence and boot are filled in by the journal
+MeasurementRecord SamplingController::makeJournalRecord(const RGBColor &color,
+                                                        uint16_t nameId) {
+  RawFrequencies raw = sampler.getAverageRaw();
+  float ci = sampler.getConfidenceHalfWidth();
+
+  MeasurementRecord record;
+  record.sequence = 0;
+  record.timestamp = millis();
+  record.boot = 0;
+  record.red = color.red;
+  record.green = color.green;
+  record.blue = color.blue;
+  record.samples = sampler.getSampleCount();
+  record.rejected = sampler.getRejectedCount() > 0xFF
+                        ? 0xFF
+                        : sampler.getRejectedCount();
+  record.profile = calibration.getActiveSlot();
+  record.rawRed = clampRaw(raw.red);
+  record.rawGreen = clampRaw(raw.green);
+  record.rawBlue = clampRaw(raw.blue);
+  record.nameId = nameId;
+  record.ciTenths = ci * 10 < JOURNAL_CI_UNKNOWN
+                        ? (uint16_t)(ci * 10 + 0.5f)
+                        : JOURNAL_CI_UNKNOWN;
+  return record;
 }
 
 void SamplingController::showCurrentState() {
@@ -72,53 +612,193 @@ bool SamplingController::canFinalize() {
 
   if (count == 0) {
     Serial.println("No samples to average!");
-    display.showMessage("No samples!", "Press button first");
-    delay(2000);
+    showMessageFor("No samples!", "Press button first",
+                   ERROR_MESSAGE_DURATION, STATE_READY);
     return false;
   }
 
-  if (count < minSamplesRequired) {
+  // A tight confidence interval waives a minimum above
+  // MIN_CONFIDENT_SAMPLES; below that the interval is not known yet
+  if (count < minSamplesRequired && !sampler.isConfident()) {
     Serial.print("Need at least ");
     Serial.print(minSamplesRequired);
     Serial.println(" samples!");
-    display.showMessage("Need more samples!", String(count) + "/" +
-                                                  String(minSamplesRequired) +
-                                                  " collected");
-    delay(2000);
+    showMessageFor("Need more samples!",
+                   String(count) + "/" + String(minSamplesRequired) +
+                       " collected",
+                   ERROR_MESSAGE_DURATION, STATE_READY);
     return false;
   }
 
   return true;
 }
 
-void SamplingController::checkAutoLedOff() {
-  if (!sensor.isLedOn())
-    return;
+bool SamplingController::checkAutoLedOff() {
+  if (!sensor.isLedOn() || autoLedOffTimeout == 0)
+    return false;
 
   if (millis() - lastActivityTime > autoLedOffTimeout) {
+    if (state == STATE_STREAMING) {
+      stopStreaming();
+    }
     sensor.setLed(false);
+    transitionPending = false;
     display.showMessage("Auto sleep", "Press to wake");
     Serial.println("Auto LED off due to inactivity");
     updateActivity(); // Reset to avoid repeated triggers
+    enterState(STATE_SLEEP);
+    return true;
   }
+  return false;
 }
 
-void SamplingController::handleWakeUp() {
-  sensor.setLed(true);
-  updateActivity();
-  display.showMessage("Waking up...", "");
-  delay(500);
-  display.showMessage("Ready!", "Press to sample");
-  waitForButtonRelease();
+void SamplingController::collectReadings() {
+  // Drain everything the acquisition task queued since the last update
+  SampleRecord sample;
+  while (acquisition.pop(sample)) {
+    if (power.isWakePending() && !sample.streamed) {
+      // The wake probe only times the restart; it is not a sample
+      power.recordWakeSample();
+    } else if (linkReadsPending > 0 && !sample.streamed) {
+      // Asked for over the link: goes to the host, not the sampler
+      linkReadsPending--;
+      link.addReading(sample, linkInfo());
+    } else if (state == STATE_STREAMING) {
+      if (sample.streamed) {
+        onStreamSample(sample);
+      }
+    } else if (state == STATE_CALIBRATE) {
+      if (!sample.streamed) {
+        onCalibrationSample(sample);
+      }
+    } else if (state != STATE_SLEEP && !sample.streamed) {
+      onSampleTaken(sample);
+    }
+  }
+}
+
+void SamplingController::recordLoopTime(unsigned long elapsedUs) {
+  loopStats.lastUs = elapsedUs;
+  loopStats.iterations++;
+  if (elapsedUs > loopStats.maxUs) {
+    loopStats.maxUs = elapsedUs;
+  }
+  if (elapsedUs > loopStats.windowMaxUs) {
+    loopStats.windowMaxUs = elapsedUs;
+  }
+  if (elapsedUs > LOOP_BUDGET_US) {
+    loopStats.overruns++;
+  }
+
+  if (millis() - lastLoopReport < LOOP_REPORT_INTERVAL)
+    return;
+
+  lastLoopReport = millis();
+  Serial.print("Loop: max ");
+  Serial.print(loopStats.windowMaxUs);
+  Serial.print("us (worst ");
+  Serial.print(loopStats.maxUs);
+  Serial.print("us, budget ");
+  Serial.print(LOOP_BUDGET_US);
+  Serial.print("us), overruns ");
+  Serial.println(loopStats.overruns);
+
+  DisplayStats ds = display.getStats();
+  Serial.print("Display: ");
+  Serial.print(ds.flushes);
+  Serial.print(" sent (");
+  Serial.print(ds.pagesSent);
+  Serial.print(" pages, ");
+  Serial.print(ds.bytesSent);
+  Serial.print(" B, ");
+  Serial.print(ds.i2cUs / 1000);
+  Serial.print(" ms I2C, max ");
+  Serial.print(ds.maxFlushUs);
+  Serial.print("us), latency ");
+  Serial.print(ds.latencyUs);
+  Serial.print("us (max ");
+  Serial.print(ds.maxLatencyUs);
+  Serial.print("us), ");
+  Serial.print(ds.unchanged);
+  Serial.print(" unchanged, ");
+  Serial.print(ds.superseded);
+  Serial.println(" superseded");
+
+  PowerStats ps = power.getStats();
+  Serial.print("Power: ");
+  Serial.print(ps.sleeps);
+  Serial.print(" sleeps (");
+  Serial.print(ps.sleepMs);
+  Serial.print(" ms, ");
+  Serial.print(ps.sleepRejected);
+  Serial.print(" rejected), wake ");
+  Serial.print(ps.wakeLatencyUs);
+  Serial.print("us (max ");
+  Serial.print(ps.maxWakeLatencyUs);
+  Serial.print("us), ");
+  Serial.print(ps.overBudget);
+  Serial.println(" over budget");
+
+  JournalStats js = journal.getStats();
+  Serial.print("Journal: ");
+  Serial.print(js.written);
+  Serial.print(" written (");
+  Serial.print(js.batches);
+  Serial.print(" batches, max ");
+  Serial.print(js.maxBatchUs);
+  Serial.print("us), ");
+  Serial.print(js.dropped);
+  Serial.print(" dropped, ");
+  Serial.print(js.writeErrors);
+  Serial.print(" errors, ");
+  Serial.print(js.erases);
+  Serial.print(" erases (sector max ");
+  Serial.print(js.maxEraseCount);
+  Serial.println(")");
+
+  BleStats bs = ble.getStats();
+  Serial.print("BLE: ");
+  Serial.print(bs.clients);
+  Serial.print(" clients (");
+  Serial.print(bs.connections);
+  Serial.print(" connections), ");
+  Serial.print(bs.notified);
+  Serial.print(" notified, ");
+  Serial.print(bs.failed);
+  Serial.println(" failed");
+
+  // Same figures and the metrics registry for clients subscribed to the
+  // stats characteristic
+  sampleHeap();
+  StatsSnapshot snapshot;
+  snapshot.clients = bs.clients;
+  snapshot.uptime = millis();
+  snapshot.loopMaxUs = loopStats.windowMaxUs;
+  snapshot.loopOverruns = loopStats.overruns;
+  snapshot.journalLast = journal.getLastSequence();
+  metrics.snapshot(snapshot.metrics);
+  uint8_t stats[BLE_STATS_SIZE];
+  encodeStats(snapshot, stats);
+  ble.publish(BLE_CHANNEL_STATS, stats, sizeof(stats));
+  loopStats.windowMaxUs = 0;
 }
 
 // ============================================================================
 // Event Handlers
 // ============================================================================
 
-void SamplingController::onSampleTaken(const RGBColor &color) {
+void SamplingController::onSampleTaken(const SampleRecord &sample) {
+  const RGBColor &color = sample.color;
   updateActivity();
-  sampler.addSample(color);
+  if (!sampler.addSample(color, sample.raw)) {
+    Serial.print("Sample rejected (outlier or timeout), total ");
+    Serial.println(sampler.getRejectedCount());
+    if (state == STATE_READY) {
+      showMessageFor("Sample rejected", "Outlier - press again",
+                     ERROR_MESSAGE_DURATION, STATE_READY);
+    }
+    return;
+  }
 
   RGBColor avgColor = sampler.getAverage();
   String avgColorName = sensor.detectColorName(avgColor);
@@ -126,8 +806,11 @@ void SamplingController::onSampleTaken(const RGBColor &color) {
   lastAvgColor = avgColor;
   lastColorName = avgColorName;
 
-  display.showSamplingMode(sampler.getSampleCount(), avgColor.red,
-                           avgColor.green, avgColor.blue, avgColorName);
+  // Leave a pending message alone; it returns to the sampling view anyway
+  if (state == STATE_READY) {
+    display.showSamplingMode(sampler.getSampleCount(), avgColor.red,
+                             avgColor.green, avgColor.blue, avgColorName);
+  }
   sampler.printSample(color);
 
   Serial.print("Sample #");
@@ -135,12 +818,92 @@ void SamplingController::onSampleTaken(const RGBColor &color) {
   Serial.println(" added");
 }
 
+void SamplingController::onStreamSample(const SampleRecord &sample) {
+  const RGBColor &color = sample.color;
+  updateActivity();
+  streamAverage.add(color);
+  streamStats.samples++;
+  statsWindowSamples++;
+  if (linkStreaming) {
+    link.addReading(sample, linkInfo());
+  }
+
+  // Every reading goes out (batched); the display follows the average
+  if (streamPacket.isEmpty()) {
+    streamPacket.begin(ble.getMtu());
+    streamPacketStart = millis();
+  }
+  streamPacket.add(makeRecord(streamSequence++, color, sample.raw,
+                              sample.timestamp, sensor.detectColorId(color),
+                              RECORD_FLAG_STREAM));
+  if (streamPacket.isFull()) {
+    flushStreamPacket();
+  }
+
+  if (millis() - lastStreamDisplay >= STREAM_DISPLAY_INTERVAL) {
+    lastStreamDisplay = millis();
+    RGBColor avg = streamAverage.getAverage();
+    display.showStreaming((int)(streamStats.samplesPerSec + 0.5f),
+                          streamStats.dropped, avg.red, avg.green, avg.blue,
+                          sensor.detectColorName(avg));
+  }
+}
+
+void SamplingController::onCalibrationSample(const SampleRecord &sample) {
+  // Ignore readings started before this capture (e.g. from the taps)
+  if (!calCapturing || (long)(sample.timestamp - calCaptureStart) < 0)
+    return;
+
+  updateActivity();
+  const RawFrequencies &raw = sample.raw;
+  if (raw.red == 0 || raw.green == 0 || raw.blue == 0) {
+    calCapturing = false;
+    display.showMessage("Sensor timeout!", "Press to retry");
+    return;
+  }
+
+  calTotals[0] += raw.red;
+  calTotals[1] += raw.green;
+  calTotals[2] += raw.blue;
+  if (++calCount < CALIBRATION_SAMPLES) {
+    acquisition.requestSample();
+    return;
+  }
+
+  uint16_t *reference =
+      calStep == CAL_WHITE ? calProfile.white : calProfile.black;
+  for (int i = 0; i < 3; i++) {
+    unsigned long average = (calTotals[i] + calCount / 2) / calCount;
+    reference[i] = average > 0xFFFF ? 0xFFFF : average;
+  }
+
+  if (calStep == CAL_WHITE) {
+    calStep = CAL_BLACK;
+    calCapturing = false;
+    showCalibrationStep();
+  } else {
+    finishCalibration();
+  }
+}
+
+void SamplingController::onDoubleTap() {
+  if (state == STATE_STREAMING) {
+    stopStreaming();
+  } else {
+    startStreaming();
+  }
+}
+
 void SamplingController::onLongPress() {
   updateActivity();
 
   if (!canFinalize())
     return;
 
+  finalizeResult();
+}
+
+void SamplingController::finalizeResult() {
   RGBColor avgColor = sampler.getAverage();
   String avgColorName = sensor.detectColorName(avgColor);
   sampler.printAverage(avgColor, avgColorName);
@@ -151,42 +914,44 @@ void SamplingController::onLongPress() {
                           " G:" + String(avgColor.green) +
                           " B:" + String(avgColor.blue));
 
-  // Send via BLE
-  String bleData = String(avgColor.red) + "," + String(avgColor.green) + "," +
-                   String(avgColor.blue) + "," + avgColorName;
-  Serial.println("Sending: " + bleData);
-  ble.send(bleData);
+  // Kept in flash whether or not a phone is listening
+  uint16_t nameId = sensor.detectColorId(avgColor);
+  uint32_t stored = journal.append(makeJournalRecord(avgColor, nameId));
+  if (stored) {
+    Serial.print("Journaled measurement #");
+    Serial.println(stored);
+  }
 
-  // Wait for user acknowledgment
-  waitForButtonRelease();
-  Serial.println("Press button to continue...");
-  waitForButtonPress();
-  waitForButtonRelease();
+  // Send via BLE as a single-record packet
+  PacketEncoder packet;
+  packet.begin(ble.getMtu());
+  uint16_t sequence = resultSequence++;
+  packet.add(makeRecord(sequence, avgColor, sampler.getAverageRaw(), millis(),
+                        nameId, RECORD_FLAG_FINAL));
+  ble.publish(BLE_CHANNEL_RESULT, packet.data(), packet.size());
+  Serial.print("Sent final record #");
+  Serial.println(sequence);
 
-  // Reset for next measurement
-  sampler.reset();
-  display.showMessage("Ready!", "Press to sample");
-  Serial.println("Ready for new samples.");
-  delay(300);
+  // Result stays up until the next press
+  Serial.println("Press button to continue...");
+  enterState(STATE_RESULT);
 }
 
 void SamplingController::onLedToggle() {
   updateActivity();
   sensor.toggleLed();
 
+  // The rest of this hold (and its release) belongs to the toggle
+  pressConsumed = true;
+
   if (sensor.isLedOn()) {
-    display.showMessage("LED ON", "Ready to sample");
     Serial.println("LED ON");
+    showMessageFor("LED ON", "Ready to sample", LED_MESSAGE_DURATION,
+                   STATE_READY);
   } else {
-    display.showMessage("LED OFF", "Power saving mode");
     Serial.println("LED OFF - Power saving");
-  }
-
-  waitForButtonRelease();
-  delay(1000);
-
-  if (sensor.isLedOn()) {
-    showCurrentState();
+    display.showMessage("LED OFF", "Power saving mode");
+    enterState(STATE_SLEEP);
   }
 }
 
@@ -194,120 +959,287 @@ void SamplingController::onTripleTap() {
   updateActivity();
 
   if (sampler.getSampleCount() == 0) {
-    display.showMessage("Nothing to reset", "");
     Serial.println("Nothing to reset");
+    showMessageFor("Nothing to reset", "", RESET_MESSAGE_DURATION,
+                   STATE_READY);
   } else {
     int cleared = sampler.getSampleCount();
     sampler.reset();
-    display.showMessage("Samples cleared!", String(cleared) + " removed");
     Serial.print("Cleared ");
     Serial.print(cleared);
     Serial.println(" samples");
+    showMessageFor("Samples cleared!", String(cleared) + " removed",
+                   RESET_MESSAGE_DURATION, STATE_READY);
   }
+}
 
-  delay(1500);
-  display.showMessage("Ready!", "Press to sample");
+void SamplingController::onNextProfile() {
+  updateActivity();
+  uint8_t next =
+      (calibration.getActiveSlot() + 1) % CalibrationStore::MAX_PROFILES;
+
+  if (!selectProfile(next)) {
+    showMessageFor("Profile invalid", "", ERROR_MESSAGE_DURATION,
+                   STATE_READY);
+    return;
+  }
+  showMessageFor("Profile " + String(next + 1),
+                 calibration.getActive().name, CALIBRATION_MESSAGE_DURATION,
+                 STATE_READY);
 }
 
 // ============================================================================
-// Main Update Loop
+// Button Events
 // ============================================================================
 
-void SamplingController::update() {
-  button.update();
-  button.updateTapCount(); // Keep tap counting logic separate for now, or merge
-                           // later
+void SamplingController::applyHoldThresholds() {
+  const unsigned long holds[] = {longPressDuration, ledToggleDuration};
+  button.setHoldThresholds(holds, sizeof(holds) / sizeof(holds[0]));
+}
 
-  // Handle triple tap
-  int tapCount = button.getTapCount();
-  if (tapCount >= 3) {
-    onTripleTap();
-    button.resetTapCount();
+void SamplingController::handleButtonEvent(const ButtonEvent &event) {
+  // A press that already caused a state change (wake, dismiss, LED toggle)
+  // is swallowed until released, including the release itself
+  if (pressConsumed) {
+    if (event.type == BUTTON_RELEASE) {
+      pressConsumed = false;
+      longPressHandled = false;
+      ledToggleHandled = false;
+      button.cancelTaps();
+    }
     return;
   }
 
-  checkAutoLedOff();
-
-  // Handle wake-up from sleep
-  if (!sensor.isLedOn() && button.isPressed()) {
-    handleWakeUp();
-    return;
+  if (event.type != BUTTON_TAPS) {
+    updateActivity();
   }
 
-  // Skip processing if LED is off (sleep mode)
-  if (!sensor.isLedOn()) {
-    delay(100);
-    return;
-  }
+  switch (state) {
+  case STATE_STREAMING:
+    // Holds and single presses are ignored while streaming
+    if (event.type == BUTTON_TAPS) {
+      handleTaps(event.count);
+    }
+    break;
+
+  case STATE_RESULT:
+    // Any press dismisses the result and starts a new measurement
+    if (event.type == BUTTON_PRESS) {
+      pressConsumed = true;
+      sampler.reset();
+      Serial.println("Ready for new samples.");
+      enterState(STATE_READY);
+    }
+    break;
 
-  bool currentButtonState = button.isPressed();
-  unsigned long duration = 0;
+  case STATE_CALIBRATE:
+    onCalibrationButton(event);
+    break;
 
-  if (currentButtonState) {
-    // BUTTON HOLDING LOGIC
-    updateActivity();
-    duration = button.getPressedDuration();
+  case STATE_SLEEP:
+    if (event.type == BUTTON_PRESS) {
+      power.exitIdle(event.timeUs);
+      sensor.setLed(true);
+      acquisition.requestSample(); // Wake probe, see collectReadings()
+      pressConsumed = true;
+      showMessageFor("Waking up...", "", WAKE_MESSAGE_DURATION, STATE_READY);
+    }
+    break;
+
+  default:
+    onSamplingButton(event);
+    break;
+  }
+}
+
+void SamplingController::onSamplingButton(const ButtonEvent &event) {
+  switch (event.type) {
+  case BUTTON_PRESS:
+    // A new press ends any timed message early
+    if (state == STATE_MESSAGE) {
+      cancelTransition();
+    }
+    break;
 
-    // 1. Check for LED toggle (5s hold) - Trigger IMMEDIATELY
-    if (duration >= ledToggleDuration && !ledToggleHandled) {
+  case BUTTON_HOLD:
+    // LED toggle triggers immediately, without waiting for the release
+    if (event.threshold == HOLD_LED_TOGGLE && !ledToggleHandled) {
       Serial.println("5s hold - LED toggle");
-      onLedToggle();
       ledToggleHandled = true;
       longPressHandled = true; // Prevent finalize on release
-      return;
+      onLedToggle();
     }
+    break;
 
-    // 2. Show progress feedback
-    if (duration > PROGRESS_SHOW_DELAY && !longPressHandled &&
-        !ledToggleHandled) {
-      if (duration < longPressDuration) {
-        // Progress 0-100% for Finalize (2s)
-        int progress = min(100, (int)((duration * 100) / longPressDuration));
-        display.showProgress(progress);
-      } else if (duration < ledToggleDuration) {
-        // Progress for LED Toggle (2s -> 5s)
-        int ledProgress =
-            min(100, (int)(((duration - longPressDuration) * 100) /
-                           (ledToggleDuration - longPressDuration)));
-        display.showMessage("Hold for LED", String(ledProgress) + "%");
-      }
-    }
+  case BUTTON_RELEASE:
+    handleRelease(event.durationUs / 1000);
+    break;
 
-  } else {
-    // BUTTON RELEASE LOGIC
-    if (lastButtonState) { // Just released
-      duration = button.getLastPressDuration();
-
-      if (ledToggleHandled) {
-        // Already handled LED toggle, just reset flags
-        ledToggleHandled = false;
-        longPressHandled = false;
-        showCurrentState();
-      } else if (duration >= longPressDuration) {
-        // Medium press (2s - 5s): Finalize
-        // Only if we haven't already handled a long press action
-        if (!longPressHandled) {
-          Serial.println("2s release - Finalize");
-          onLongPress();
-        }
-        showCurrentState(); // Return to ready state
-      } else {
-        // Short press (< 2s): Take Sample
-        // Only if it wasn't a very short glitch (< 50ms is handled by debounce,
-        // but safe to check)
-        if (duration > 50) {
-          Serial.println("Short release - Sample");
-          RGBColor color = sensor.readColor();
-          onSampleTaken(color);
-        }
-      }
+  case BUTTON_TAPS:
+    handleTaps(event.count);
+    break;
+  }
+}
 
-      // Reset flags for next press
-      longPressHandled = false;
-      ledToggleHandled = false;
+void SamplingController::onCalibrationButton(const ButtonEvent &event) {
+  // Taps have no meaning here; each press only starts a capture
+  button.cancelTaps();
+
+  if (event.type == BUTTON_HOLD && event.threshold == HOLD_FINALIZE) {
+    pressConsumed = true;
+    calCapturing = false;
+    Serial.println("Calibration cancelled");
+    showMessageFor("Calibration", "cancelled", ERROR_MESSAGE_DURATION,
+                   STATE_READY);
+    return;
+  }
+
+  if (event.type != BUTTON_RELEASE || calCapturing ||
+      event.durationUs / 1000 <= MIN_PRESS_DURATION)
+    return;
+
+  calCapturing = true;
+  calCount = 0;
+  calTotals[0] = calTotals[1] = calTotals[2] = 0;
+  calCaptureStart = millis();
+  display.showMessage("Measuring...",
+                      calStep == CAL_WHITE ? "Hold on white" : "Hold on black");
+  acquisition.requestSample();
+}
+
+void SamplingController::handleTaps(int tapCount) {
+  if (tapCount == 2) {
+    onDoubleTap();
+  } else if (state == STATE_STREAMING) {
+    return;
+  } else if (tapCount == 3) {
+    onTripleTap();
+  } else if (tapCount == 4) {
+    startCalibration();
+  } else if (tapCount >= 5) {
+    onNextProfile();
+  }
+}
+
+void SamplingController::handleRelease(unsigned long duration) {
+  bool wasHolding = state == STATE_HOLDING;
+  state = STATE_READY;
+
+  if (duration >= longPressDuration) {
+    // Medium press (2s - 5s): Finalize
+    if (!longPressHandled) {
+      Serial.println("2s release - Finalize");
+      onLongPress();
     }
+  } else if (duration > MIN_PRESS_DURATION) {
+    // Short press (< 2s): Take Sample
+    Serial.println("Short release - Sample");
+    acquisition.requestSample();
+    if (wasHolding) {
+      showCurrentState();
+    }
+  } else if (wasHolding) {
+    showCurrentState();
+  }
+
+  // Reset flags for next press
+  longPressHandled = false;
+  ledToggleHandled = false;
+}
+
+// ============================================================================
+// Per-State Updates
+// ============================================================================
+
+// Progress feedback while the button is held
+void SamplingController::showHoldProgress() {
+  updateActivity();
+  unsigned long duration = button.getPressedDuration();
+  if (duration <= PROGRESS_SHOW_DELAY || longPressHandled || ledToggleHandled)
+    return;
+
+  state = STATE_HOLDING;
+  if (duration < longPressDuration) {
+    // Progress 0-100% for Finalize (2s)
+    int progress = min(100, (int)((duration * 100) / longPressDuration));
+    display.showProgress(progress);
+  } else if (duration < ledToggleDuration) {
+    // Progress for LED Toggle (2s -> 5s)
+    int ledProgress =
+        min(100, (int)(((duration - longPressDuration) * 100) /
+                       (ledToggleDuration - longPressDuration)));
+    display.showMessage("Hold for LED", String(ledProgress) + "%");
+  }
+}
+
+void SamplingController::updateSampling() {
+  if (pressConsumed)
+    return;
+
+  bool pressed = button.isPressed();
+
+  if (!pressed && checkAutoLedOff())
+    return;
+
+  // Finalize on confidence, but only once no tap sequence is pending
+  if (autoFinalize && state == STATE_READY && !pressed &&
+      !button.hasPendingTaps() && sampler.isConfident()) {
+    Serial.println("Confidence reached - auto finalize");
+    updateActivity();
+    finalizeResult();
+    return;
+  }
+
+  if (pressed) {
+    showHoldProgress();
+  }
+}
+
+void SamplingController::updateStreaming() {
+  if (checkAutoLedOff())
+    return;
+
+  serviceStream();
+}
+
+// ============================================================================
+// Main Update Loop
+// ============================================================================
+
+void SamplingController::update() {
+  unsigned long startUs = micros();
+
+  if (lastUpdateUs != 0) {
+    metrics.record(HISTOGRAM_LOOP_PERIOD_US, startUs - lastUpdateUs);
+  }
+  lastUpdateUs = startUs;
+
+  serviceConfig();
+  serviceSerial();
+  button.update();
+
+  collectReadings();
+  link.flush();
+  runScheduledTransition();
+
+  // Gestures in the order they happened, however long the last loop took
+  ButtonEvent event;
+  while (button.pollEvent(event)) {
+    handleButtonEvent(event);
+  }
+
+  switch (state) {
+  case STATE_STREAMING:
+    updateStreaming();
+    break;
+  case STATE_RESULT:
+  case STATE_CALIBRATE:
+  case STATE_SLEEP:
+    break; // Button events only
+  default:
+    updateSampling();
+    break;
   }
 
-  lastButtonState = currentButtonState;
-  delay(10);
+  recordLoopTime(micros() - startUs);
 }
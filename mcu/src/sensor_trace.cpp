@@ -0,0 +1,217 @@
+#include "sensor_trace.h"
+
+// ============================================================================
+// Byte Helpers
+// ============================================================================
+
+static void putU16(uint8_t *out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void putU32(uint8_t *out, uint32_t value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = value >> 24;
+}
+
+static uint16_t getU16(const uint8_t *in) {
+  return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t *in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) |
+         ((uint32_t)in[3] << 24);
+}
+
+static size_t writeChunk(Print &out, uint8_t type, const uint8_t *payload,
+                         uint8_t length) {
+  uint8_t head[3] = {TRACE_SYNC, type, length};
+  uint8_t sum = type + length;
+  for (uint8_t i = 0; i < length; i++) {
+    sum += payload[i];
+  }
+
+  size_t written = out.write(head, sizeof(head));
+  written += out.write(payload, length);
+  written += out.write(&sum, 1);
+  return written;
+}
+
+// ============================================================================
+// Records
+// ============================================================================
+
+void encodeTraceRecord(const TraceRecord &record, uint8_t *out) {
+  putU32(out, record.timeUs);
+  putU16(out + 4, record.edges);
+  putU16(out + 6, record.gateUs);
+  out[8] = record.info;
+}
+
+void decodeTraceRecord(const uint8_t *in, TraceRecord &record) {
+  record.timeUs = getU32(in);
+  record.edges = getU16(in + 4);
+  record.gateUs = getU16(in + 6);
+  record.info = in[8];
+}
+
+// ============================================================================
+// Recorder
+// ============================================================================
+
+TraceRecorder::TraceRecorder(ColorSensor &sens)
+    : sensor(sens), recording(false), startUs(0), recorded(0) {}
+
+void TraceRecorder::begin(Print &out, const CalibrationProfile &profile) {
+  uint8_t header[TRACE_HEADER_SIZE] = {};
+  header[0] = TRACE_VERSION;
+  putU32(header + 1, sensor.getSettleTimeUs());
+  putU32(header + 5, sensor.getGateTimeUs());
+  for (uint8_t i = 0; i < 3; i++) {
+    putU16(header + 9 + i * 2, profile.white[i]);
+    putU16(header + 15 + i * 2, profile.black[i]);
+  }
+  memcpy(header + 21, profile.name, CALIBRATION_NAME_LEN);
+  writeChunk(out, TRACE_CHUNK_HEADER, header, sizeof(header));
+
+  queue.clear();
+  recorded = 0;
+  startUs = micros();
+  sensor.onCapture(onCapture, this);
+  recording = true;
+}
+
+void TraceRecorder::stop() { recording = false; }
+
+void TraceRecorder::onCapture(void *context, const CaptureStep &step,
+                              const CaptureResult &result, bool last) {
+  TraceRecorder *self = static_cast<TraceRecorder *>(context);
+  if (!self->recording)
+    return;
+
+  TraceRecord record;
+  record.timeUs = micros() - self->startUs;
+  record.edges = min(result.edges, (uint32_t)UINT16_MAX);
+  record.gateUs = min(result.gateUs, (uint32_t)UINT16_MAX);
+  record.info = (step.filter & TRACE_INFO_CHANNEL_MASK) |
+                (step.scaling << TRACE_INFO_SCALING_SHIFT) |
+                (step.ambient ? TRACE_INFO_AMBIENT : 0) |
+                (last ? TRACE_INFO_LAST : 0) |
+                (self->sensor.isLedOn() && !step.ambient ? TRACE_INFO_LED : 0);
+  self->queue.push(record);
+}
+
+size_t TraceRecorder::flush(Print &out, bool force) {
+  uint8_t payload[TRACE_RECORDS_PER_CHUNK * TRACE_RECORD_SIZE];
+  size_t written = 0;
+
+  // Partial chunks only when forced, so a steady stream packs full ones
+  while (queue.size() >= TRACE_RECORDS_PER_CHUNK ||
+         (force && queue.size() > 0)) {
+    uint8_t count = 0;
+    TraceRecord record;
+    while (count < TRACE_RECORDS_PER_CHUNK && queue.pop(record)) {
+      encodeTraceRecord(record, payload + count * TRACE_RECORD_SIZE);
+      count++;
+    }
+    written += writeChunk(out, TRACE_CHUNK_SAMPLES, payload,
+                          count * TRACE_RECORD_SIZE);
+    recorded += count;
+  }
+  return written;
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+TraceReader::TraceReader()
+    : state(SYNC), type(0), length(0), received(0), sum(0), header(),
+      headerSeen(false), recordCount(0), skipped(0) {}
+
+TraceReader::Event TraceReader::feed(uint8_t byte) {
+  switch (state) {
+  case SYNC:
+    if (byte == TRACE_SYNC) {
+      state = TYPE;
+    } else {
+      skipped++;
+    }
+    return NONE;
+
+  case TYPE:
+    if (byte != TRACE_CHUNK_HEADER && byte != TRACE_CHUNK_SAMPLES) {
+      // A sync byte here may start the real chunk
+      skipped += byte == TRACE_SYNC ? 1 : 2;
+      state = byte == TRACE_SYNC ? TYPE : SYNC;
+      return NONE;
+    }
+    type = byte;
+    sum = byte;
+    state = LENGTH;
+    return NONE;
+
+  case LENGTH:
+    length = byte;
+    sum += byte;
+    received = 0;
+    state = length > 0 ? PAYLOAD : CHECKSUM;
+    return NONE;
+
+  case PAYLOAD:
+    payload[received++] = byte;
+    sum += byte;
+    if (received == length) {
+      state = CHECKSUM;
+    }
+    return NONE;
+
+  case CHECKSUM:
+    state = SYNC;
+    if (byte != sum) {
+      skipped += TRACE_CHUNK_OVERHEAD + length;
+      return NONE;
+    }
+    return finishChunk();
+  }
+  return NONE;
+}
+
+TraceReader::Event TraceReader::finishChunk() {
+  if (type == TRACE_CHUNK_HEADER) {
+    if (length < TRACE_HEADER_SIZE || payload[0] < 1 ||
+        payload[0] > TRACE_VERSION)
+      return NONE;
+
+    header.version = payload[0];
+    header.settleUs = getU32(payload + 1);
+    header.gateUs = getU32(payload + 5);
+    for (uint8_t i = 0; i < 3; i++) {
+      header.profile.white[i] = getU16(payload + 9 + i * 2);
+      header.profile.black[i] = getU16(payload + 15 + i * 2);
+    }
+    memcpy(header.profile.name, payload + 21, CALIBRATION_NAME_LEN);
+    header.profile.name[CALIBRATION_NAME_LEN - 1] = '\0';
+    headerSeen = true;
+    return HEADER;
+  }
+
+  if (length % TRACE_RECORD_SIZE != 0)
+    return NONE;
+
+  recordCount = length / TRACE_RECORD_SIZE;
+  for (size_t i = 0; i < recordCount; i++) {
+    TraceRecord &record = records[i];
+    decodeTraceRecord(payload + i * TRACE_RECORD_SIZE, record);
+    if (headerSeen && header.version == 1) {
+      record.info = (record.info & ~TRACE_INFO_SCALING_MASK) |
+                    (SCALING_20 << TRACE_INFO_SCALING_SHIFT);
+    }
+    if (headerSeen && header.version <= 2 && record.channel() == 2) {
+      record.info |= TRACE_INFO_LAST;
+    }
+  }
+  return SAMPLES;
+}
@@ -0,0 +1,180 @@
+#include "serial_link.h"
+
+// ============================================================================
+// Byte Helpers
+// ============================================================================
+
+static void putU16(uint8_t *out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void putU32(uint8_t *out, uint32_t value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = value >> 24;
+}
+
+static uint16_t getU16(const uint8_t *in) {
+  return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t *in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) |
+         ((uint32_t)in[3] << 24);
+}
+
+// ============================================================================
+// Frames
+// ============================================================================
+
+size_t writeLinkFrame(Print &out, uint8_t type, const uint8_t *payload,
+                      uint8_t length) {
+  uint8_t head[3] = {LINK_SYNC, type, length};
+  uint8_t sum = type + length;
+  for (uint8_t i = 0; i < length; i++) {
+    sum += payload[i];
+  }
+
+  size_t written = out.write(head, sizeof(head));
+  written += out.write(payload, length);
+  written += out.write(&sum, 1);
+  return written;
+}
+
+void encodeLinkReading(const LinkReading &reading, uint8_t *out) {
+  putU16(out, reading.sequence);
+  putU32(out + 2, reading.timestamp);
+  out[6] = reading.red;
+  out[7] = reading.green;
+  out[8] = reading.blue;
+  out[9] = reading.info;
+  for (uint8_t i = 0; i < 3; i++) {
+    putU32(out + 10 + i * 4, reading.raw[i]);
+  }
+}
+
+void decodeLinkReading(const uint8_t *in, LinkReading &reading) {
+  reading.sequence = getU16(in);
+  reading.timestamp = getU32(in + 2);
+  reading.red = in[6];
+  reading.green = in[7];
+  reading.blue = in[8];
+  reading.info = in[9];
+  for (uint8_t i = 0; i < 3; i++) {
+    reading.raw[i] = getU32(in + 10 + i * 4);
+  }
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+LinkReader::LinkReader()
+    : state(SYNC), type(0), length(0), received(0), sum(0), skipped(0) {}
+
+bool LinkReader::feed(uint8_t byte) {
+  switch (state) {
+  case SYNC:
+    if (byte == LINK_SYNC) {
+      state = TYPE;
+    } else {
+      skipped++;
+    }
+    return false;
+
+  case TYPE:
+    if (byte != LINK_FRAME_COMMAND && byte != LINK_FRAME_ACK &&
+        byte != LINK_FRAME_READINGS) {
+      // A sync byte here may start the real frame
+      skipped += byte == LINK_SYNC ? 1 : 2;
+      state = byte == LINK_SYNC ? TYPE : SYNC;
+      return false;
+    }
+    type = byte;
+    sum = byte;
+    state = LENGTH;
+    return false;
+
+  case LENGTH:
+    length = byte;
+    sum += byte;
+    received = 0;
+    state = length > 0 ? PAYLOAD : CHECKSUM;
+    return false;
+
+  case PAYLOAD:
+    payload[received++] = byte;
+    sum += byte;
+    if (received == length) {
+      state = CHECKSUM;
+    }
+    return false;
+
+  case CHECKSUM:
+    state = SYNC;
+    if (byte != sum) {
+      skipped += LINK_FRAME_OVERHEAD + length;
+      return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+// ============================================================================
+// Device End
+// ============================================================================
+
+SerialLink::SerialLink(Print &port)
+    : out(port), frame{}, frameCount(0), sequence(0), sent(0) {}
+
+bool SerialLink::feed(uint8_t byte, LinkCommand &command) {
+  if (!reader.feed(byte) || reader.getType() != LINK_FRAME_COMMAND ||
+      reader.getLength() < 1)
+    return false;
+
+  // Longer argument lists are cut short; no command takes that many
+  command.opcode = reader.getPayload()[0];
+  command.length = min((size_t)reader.getLength() - 1, LINK_MAX_COMMAND_ARGS);
+  memcpy(command.args, reader.getPayload() + 1, command.length);
+  return true;
+}
+
+void SerialLink::sendAck(uint8_t opcode, uint8_t status, uint32_t value) {
+  uint8_t ack[LINK_ACK_SIZE];
+  ack[0] = opcode;
+  ack[1] = status;
+  putU32(ack + 2, value);
+  writeLinkFrame(out, LINK_FRAME_ACK, ack, sizeof(ack));
+}
+
+void SerialLink::addReading(const SampleRecord &sample, uint8_t info) {
+  LinkReading reading;
+  reading.sequence = sequence++;
+  reading.timestamp = sample.timestamp;
+  reading.red = constrain(sample.color.red, 0, 255);
+  reading.green = constrain(sample.color.green, 0, 255);
+  reading.blue = constrain(sample.color.blue, 0, 255);
+  reading.info = info | (sample.streamed ? LINK_INFO_STREAMED : 0);
+  reading.raw[0] = sample.raw.red;
+  reading.raw[1] = sample.raw.green;
+  reading.raw[2] = sample.raw.blue;
+
+  encodeLinkReading(reading, frame + frameCount * LINK_READING_SIZE);
+  frameCount++;
+  sent++;
+  if (frameCount == LINK_READINGS_PER_FRAME) {
+    flush();
+  }
+}
+
+void SerialLink::flush() {
+  if (frameCount == 0)
+    return;
+
+  writeLinkFrame(out, LINK_FRAME_READINGS, frame,
+                 frameCount * LINK_READING_SIZE);
+  frameCount = 0;
+}
@@ -0,0 +1,306 @@
+#include "ble_packet.h"
+#include <string.h>
+#include <unity.h>
+
+// Record packets and the stats snapshot: encode -> decode round trips and
+// the MTU boundaries (ble_packet.h)
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static ColorRecord makeRecord(uint32_t i) {
+  ColorRecord record;
+  record.sequence = (uint16_t)(65530 + i); // Wraps partway through
+  record.timestamp = 0xFFFFFF00UL + i * 20;
+  record.red = (uint8_t)(i * 37);
+  record.green = (uint8_t)(255 - i);
+  record.blue = (uint8_t)(i * 91);
+  record.flags = (i & 1) ? RECORD_FLAG_STREAM : RECORD_FLAG_FINAL;
+  record.rawRed = (uint16_t)(i * 1000);
+  record.rawGreen = 0xFFFF;
+  record.rawBlue = (uint16_t)i;
+  record.nameId = (uint16_t)(0x8000 | i);
+  return record;
+}
+
+static void assertRecordEqual(const ColorRecord &a, const ColorRecord &b) {
+  TEST_ASSERT_EQUAL_UINT16(a.sequence, b.sequence);
+  TEST_ASSERT_EQUAL_UINT32(a.timestamp, b.timestamp);
+  TEST_ASSERT_EQUAL_UINT8(a.red, b.red);
+  TEST_ASSERT_EQUAL_UINT8(a.green, b.green);
+  TEST_ASSERT_EQUAL_UINT8(a.blue, b.blue);
+  TEST_ASSERT_EQUAL_UINT8(a.flags, b.flags);
+  TEST_ASSERT_EQUAL_UINT16(a.rawRed, b.rawRed);
+  TEST_ASSERT_EQUAL_UINT16(a.rawGreen, b.rawGreen);
+  TEST_ASSERT_EQUAL_UINT16(a.rawBlue, b.rawBlue);
+  TEST_ASSERT_EQUAL_UINT16(a.nameId, b.nameId);
+}
+
+// Fills a packet for the MTU and checks it decodes to the same records
+static void roundTrip(uint16_t mtu) {
+  PacketEncoder encoder;
+  encoder.begin(mtu);
+  uint32_t added = 0;
+  while (encoder.add(makeRecord(added))) {
+    added++;
+  }
+  TEST_ASSERT_EQUAL_UINT32(encoder.getCapacity(), added);
+  TEST_ASSERT_TRUE(encoder.isFull());
+
+  ColorRecord decoded[BLE_MAX_PACKET_SIZE / BLE_RECORD_SIZE];
+  size_t count = decodePacket(encoder.data(), encoder.size(), decoded,
+                              sizeof(decoded) / sizeof(decoded[0]));
+  TEST_ASSERT_EQUAL_size_t(added, count);
+  for (size_t i = 0; i < count; i++) {
+    assertRecordEqual(makeRecord(i), decoded[i]);
+  }
+}
+
+static void test_record_layout(void) {
+  ColorRecord record = {0x0102, 0x03040506, 7, 8, 9, RECORD_FLAG_TIMEOUT,
+                        0x0A0B, 0x0C0D, 0x0E0F, 0x1011};
+  uint8_t out[BLE_RECORD_SIZE];
+  encodeRecord(record, out);
+  const uint8_t expected[BLE_RECORD_SIZE] = {
+      0x02, 0x01, 0x06, 0x05, 0x04, 0x03, 7,    8,    9,
+      0x04, 0x0B, 0x0A, 0x0D, 0x0C, 0x0F, 0x0E, 0x11, 0x10};
+  TEST_ASSERT_EQUAL_MEMORY(expected, out, BLE_RECORD_SIZE);
+
+  ColorRecord decoded;
+  decodeRecord(out, decoded);
+  assertRecordEqual(record, decoded);
+}
+
+static void test_capacity_at_mtu_boundaries(void) {
+  // Payload is MTU - 3; a record needs 18 bytes after the 2-byte header
+  TEST_ASSERT_EQUAL_UINT8(1, PacketEncoder::capacityForMtu(23));
+  TEST_ASSERT_EQUAL_UINT8(1, PacketEncoder::capacityForMtu(40));
+  TEST_ASSERT_EQUAL_UINT8(2, PacketEncoder::capacityForMtu(41));
+  TEST_ASSERT_EQUAL_UINT8(13, PacketEncoder::capacityForMtu(247));
+  TEST_ASSERT_EQUAL_UINT8(13, PacketEncoder::capacityForMtu(239));
+  TEST_ASSERT_EQUAL_UINT8(12, PacketEncoder::capacityForMtu(238));
+  // Capped by the 512-byte attribute limit
+  TEST_ASSERT_EQUAL_UINT8(28, PacketEncoder::capacityForMtu(515));
+  TEST_ASSERT_EQUAL_UINT8(28, PacketEncoder::capacityForMtu(517));
+  TEST_ASSERT_EQUAL_UINT8(28, PacketEncoder::capacityForMtu(0xFFFF));
+}
+
+static void test_full_packet_fits_mtu(void) {
+  for (uint16_t mtu = 23; mtu <= 517; mtu++) {
+    PacketEncoder encoder;
+    encoder.begin(mtu);
+    while (encoder.add(makeRecord(0))) {
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(mtu - BLE_ATT_OVERHEAD, encoder.size());
+    TEST_ASSERT_LESS_OR_EQUAL(BLE_MAX_PACKET_SIZE, encoder.size());
+    // One more record would not have fit
+    if (mtu - BLE_ATT_OVERHEAD < BLE_MAX_PACKET_SIZE) {
+      TEST_ASSERT_GREATER_THAN(mtu - BLE_ATT_OVERHEAD,
+                               encoder.size() + BLE_RECORD_SIZE);
+    }
+  }
+}
+
+static void test_round_trip_default_mtu(void) { roundTrip(23); }
+
+static void test_round_trip_one_below_two_records(void) { roundTrip(40); }
+
+static void test_round_trip_two_records(void) { roundTrip(41); }
+
+static void test_round_trip_common_mtu(void) { roundTrip(247); }
+
+static void test_round_trip_max_mtu(void) { roundTrip(517); }
+
+static void test_partial_packet(void) {
+  PacketEncoder encoder;
+  encoder.begin(247);
+  TEST_ASSERT_TRUE(encoder.isEmpty());
+  encoder.add(makeRecord(0));
+  encoder.add(makeRecord(1));
+  TEST_ASSERT_EQUAL_size_t(BLE_PACKET_HEADER_SIZE + 2 * BLE_RECORD_SIZE,
+                           encoder.size());
+
+  ColorRecord decoded[4];
+  TEST_ASSERT_EQUAL_size_t(2, decodePacket(encoder.data(), encoder.size(),
+                                           decoded, 4));
+  assertRecordEqual(makeRecord(1), decoded[1]);
+
+  encoder.clear();
+  TEST_ASSERT_TRUE(encoder.isEmpty());
+  TEST_ASSERT_EQUAL_size_t(0, decodePacket(encoder.data(), encoder.size(),
+                                           decoded, 4));
+}
+
+static void test_decode_truncates_to_max_records(void) {
+  PacketEncoder encoder;
+  encoder.begin(247);
+  for (uint32_t i = 0; i < 5; i++) {
+    encoder.add(makeRecord(i));
+  }
+  ColorRecord decoded[3];
+  TEST_ASSERT_EQUAL_size_t(3, decodePacket(encoder.data(), encoder.size(),
+                                           decoded, 3));
+  assertRecordEqual(makeRecord(2), decoded[2]);
+}
+
+static void test_decode_rejects_malformed(void) {
+  PacketEncoder encoder;
+  encoder.begin(247);
+  encoder.add(makeRecord(0));
+  encoder.add(makeRecord(1));
+  ColorRecord decoded[4];
+
+  uint8_t packet[BLE_MAX_PACKET_SIZE];
+  memcpy(packet, encoder.data(), encoder.size());
+  TEST_ASSERT_EQUAL_size_t(0, decodePacket(packet, encoder.size() - 1,
+                                           decoded, 4));
+  TEST_ASSERT_EQUAL_size_t(0, decodePacket(packet, encoder.size() + 1,
+                                           decoded, 4));
+  TEST_ASSERT_EQUAL_size_t(0, decodePacket(packet, 1, decoded, 4));
+
+  packet[0] = BLE_PACKET_VERSION + 1;
+  TEST_ASSERT_EQUAL_size_t(0, decodePacket(packet, encoder.size(), decoded,
+                                           4));
+  packet[0] = BLE_PACKET_VERSION;
+  packet[1] = 3; // Count disagrees with the length
+  TEST_ASSERT_EQUAL_size_t(0, decodePacket(packet, encoder.size(), decoded,
+                                           4));
+}
+
+static void test_stats_round_trip(void) {
+  StatsSnapshot stats = {};
+  stats.clients = 3;
+  stats.uptime = 0xDEADBEEF;
+  stats.loopMaxUs = 12345;
+  stats.loopOverruns = 7;
+  stats.journalLast = 0xFFFFFFFF;
+  for (uint8_t i = 0; i < COUNTER_COUNT; i++) {
+    stats.metrics.counters[i] = 1000 + i;
+  }
+  for (uint8_t i = 0; i < GAUGE_COUNT; i++) {
+    stats.metrics.gauges[i] = 2000 + i;
+  }
+  for (uint8_t i = 0; i < HISTOGRAM_COUNT; i++) {
+    stats.metrics.histograms[i].max = 3000 + i;
+    for (uint8_t b = 0; b < METRICS_BUCKETS; b++) {
+      stats.metrics.histograms[i].buckets[b] = i * 100 + b;
+    }
+  }
+
+  uint8_t out[BLE_STATS_SIZE];
+  encodeStats(stats, out);
+  StatsSnapshot decoded = {};
+  TEST_ASSERT_TRUE(decodeStats(out, sizeof(out), decoded));
+  TEST_ASSERT_EQUAL_UINT8(stats.clients, decoded.clients);
+  TEST_ASSERT_EQUAL_UINT32(stats.uptime, decoded.uptime);
+  TEST_ASSERT_EQUAL_UINT32(stats.loopMaxUs, decoded.loopMaxUs);
+  TEST_ASSERT_EQUAL_UINT32(stats.loopOverruns, decoded.loopOverruns);
+  TEST_ASSERT_EQUAL_UINT32(stats.journalLast, decoded.journalLast);
+  TEST_ASSERT_EQUAL_MEMORY(&stats.metrics, &decoded.metrics,
+                           sizeof(MetricsSnapshot));
+
+  // Notifying the snapshot takes the MTU the header promises
+  TEST_ASSERT_EQUAL_size_t(209 - BLE_ATT_OVERHEAD, BLE_STATS_SIZE);
+}
+
+static void test_stats_rejects_unknown_version(void) {
+  StatsSnapshot stats = {};
+  uint8_t out[BLE_STATS_SIZE];
+  encodeStats(stats, out);
+  StatsSnapshot decoded;
+  TEST_ASSERT_FALSE(decodeStats(out, sizeof(out) - 1, decoded));
+  TEST_ASSERT_FALSE(decodeStats(out, 21, decoded));
+  out[19]++; // One more gauge than the packet holds
+  TEST_ASSERT_FALSE(decodeStats(out, sizeof(out), decoded));
+  out[19]--;
+  out[0]++;
+  TEST_ASSERT_FALSE(decodeStats(out, sizeof(out), decoded));
+}
+
+static uint8_t *putWord(uint8_t *p, uint32_t value) {
+  p[0] = value & 0xFF;
+  p[1] = (value >> 8) & 0xFF;
+  p[2] = (value >> 16) & 0xFF;
+  p[3] = value >> 24;
+  return p + 4;
+}
+
+static void test_stats_decodes_by_counts(void) {
+  // Newer firmware: one more counter, histogram and two more buckets, one
+  // gauge less
+  const uint8_t counters = COUNTER_COUNT + 1;
+  const uint8_t gauges = GAUGE_COUNT - 1;
+  const uint8_t histograms = HISTOGRAM_COUNT + 1;
+  const uint8_t buckets = METRICS_BUCKETS + 2;
+  uint8_t packet[22 + 4 * (counters + gauges) +
+                 histograms * 4 * (1 + buckets)];
+  StatsSnapshot stats = {};
+  stats.uptime = 42;
+  encodeStats(stats, packet); // Header fields
+  packet[18] = counters;
+  packet[19] = gauges;
+  packet[20] = histograms;
+  packet[21] = buckets;
+  uint8_t *p = packet + 22;
+  for (uint8_t i = 0; i < counters; i++) {
+    p = putWord(p, 1000 + i);
+  }
+  for (uint8_t i = 0; i < gauges; i++) {
+    p = putWord(p, 2000 + i);
+  }
+  for (uint8_t i = 0; i < histograms; i++) {
+    p = putWord(p, 3000 + i);
+    for (uint8_t b = 0; b < buckets; b++) {
+      p = putWord(p, 1);
+    }
+  }
+
+  StatsSnapshot decoded;
+  memset(&decoded, 0xAA, sizeof(decoded));
+  TEST_ASSERT_TRUE(decodeStats(packet, sizeof(packet), decoded));
+  TEST_ASSERT_EQUAL_UINT32(42, decoded.uptime);
+  const MetricsSnapshot &m = decoded.metrics;
+  for (uint8_t i = 0; i < COUNTER_COUNT; i++) {
+    TEST_ASSERT_EQUAL_UINT32(1000 + i, m.counters[i]);
+  }
+  for (uint8_t i = 0; i < gauges; i++) {
+    TEST_ASSERT_EQUAL_UINT32(2000 + i, m.gauges[i]);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, m.gauges[GAUGE_COUNT - 1]);
+  for (uint8_t i = 0; i < HISTOGRAM_COUNT; i++) {
+    TEST_ASSERT_EQUAL_UINT32(3000 + i, m.histograms[i].max);
+    TEST_ASSERT_EQUAL_UINT32(1, m.histograms[i].buckets[0]);
+    // The open last bucket takes the two it does not know
+    TEST_ASSERT_EQUAL_UINT32(3,
+                             m.histograms[i].buckets[METRICS_BUCKETS - 1]);
+  }
+
+  // Older firmware: fewer histograms and buckets
+  packet[20] = HISTOGRAM_COUNT - 1;
+  packet[21] = METRICS_BUCKETS - 1;
+  memset(&decoded, 0xAA, sizeof(decoded));
+  TEST_ASSERT_TRUE(decodeStats(packet, sizeof(packet), decoded));
+  TEST_ASSERT_EQUAL_UINT32(0, decoded.metrics.histograms[0]
+                                  .buckets[METRICS_BUCKETS - 1]);
+  TEST_ASSERT_EQUAL_UINT32(
+      0, decoded.metrics.histograms[HISTOGRAM_COUNT - 1].max);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_record_layout);
+  RUN_TEST(test_capacity_at_mtu_boundaries);
+  RUN_TEST(test_full_packet_fits_mtu);
+  RUN_TEST(test_round_trip_default_mtu);
+  RUN_TEST(test_round_trip_one_below_two_records);
+  RUN_TEST(test_round_trip_two_records);
+  RUN_TEST(test_round_trip_common_mtu);
+  RUN_TEST(test_round_trip_max_mtu);
+  RUN_TEST(test_partial_packet);
+  RUN_TEST(test_decode_truncates_to_max_records);
+  RUN_TEST(test_decode_rejects_malformed);
+  RUN_TEST(test_stats_round_trip);
+  RUN_TEST(test_stats_rejects_unknown_version);
+  RUN_TEST(test_stats_decodes_by_counts);
+  return UNITY_END();
+}
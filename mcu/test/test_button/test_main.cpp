@@ -0,0 +1,179 @@
+#include "button.h"
+#include "sim_hal.h"
+#include <unity.h>
+
+// Button (button.h) on simulated edges: debouncing, tap sequences, hold
+// thresholds and event times that do not depend on when update() runs
+
+static const uint8_t PIN = 4;
+static const unsigned long HOLDS[] = {2000, 5000};
+
+static Button *button;
+
+static uint32_t nowUs() { return (uint32_t)SimHal::nowMicros(); }
+
+static void setPressed(bool pressed) {
+  SimHal::setInput(PIN, pressed ? LOW : HIGH);
+}
+
+// Calls update() every stepMs, as the loop does
+static void runFor(unsigned long ms, unsigned long stepMs = 10) {
+  for (unsigned long t = 0; t < ms; t += stepMs) {
+    SimHal::advanceMicros(stepMs * 1000);
+    button->update();
+  }
+}
+
+// Contact bounce: a few edges 1 ms apart, ending at the given level
+static void bounceTo(bool pressed) {
+  for (int i = 0; i < 2; i++) {
+    setPressed(pressed);
+    SimHal::advanceMicros(1000);
+    setPressed(!pressed);
+    SimHal::advanceMicros(1000);
+  }
+  setPressed(pressed);
+}
+
+static bool nextEvent(ButtonEvent &event, ButtonEventType type) {
+  if (!button->pollEvent(event))
+    return false;
+  return event.type == type;
+}
+
+void setUp(void) {
+  setPressed(false);
+  button = new Button(PIN);
+  button->begin();
+  button->setHoldThresholds(HOLDS, 2);
+}
+
+void tearDown(void) {
+  setPressed(false);
+  SimHal::attachPinInterrupt(PIN, nullptr, nullptr, CHANGE);
+  delete button;
+}
+
+static void test_bounce_is_one_press(void) {
+  uint32_t startUs = nowUs();
+  bounceTo(true);
+  runFor(50);
+
+  ButtonEvent event;
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_PRESS));
+  TEST_ASSERT_EQUAL_UINT32(startUs, event.timeUs); // The first edge
+  TEST_ASSERT_FALSE(button->pollEvent(event));
+  TEST_ASSERT_TRUE(button->isPressed());
+}
+
+static void test_glitch_is_ignored(void) {
+  setPressed(true);
+  SimHal::advanceMicros(Button::DEBOUNCE_US / 2);
+  setPressed(false);
+  runFor(100);
+
+  ButtonEvent event;
+  TEST_ASSERT_FALSE(button->pollEvent(event));
+  TEST_ASSERT_FALSE(button->isPressed());
+}
+
+static void test_taps_counted_after_timeout(void) {
+  for (int i = 0; i < 2; i++) {
+    bounceTo(true);
+    runFor(100);
+    bounceTo(false);
+    runFor(100);
+  }
+  uint32_t lastReleaseUs = nowUs() - 100000 - 4000;
+  TEST_ASSERT_TRUE(button->hasPendingTaps());
+
+  runFor(Button::TAP_TIMEOUT);
+  ButtonEvent event;
+  for (int i = 0; i < 2; i++) {
+    TEST_ASSERT_TRUE(nextEvent(event, BUTTON_PRESS));
+    TEST_ASSERT_TRUE(nextEvent(event, BUTTON_RELEASE));
+  }
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_TAPS));
+  TEST_ASSERT_EQUAL_UINT8(2, event.count);
+  TEST_ASSERT_EQUAL_UINT32(lastReleaseUs + Button::TAP_TIMEOUT * 1000,
+                           event.timeUs);
+  TEST_ASSERT_FALSE(button->hasPendingTaps());
+}
+
+static void test_holds_and_long_release(void) {
+  uint32_t startUs = nowUs();
+  setPressed(true);
+  runFor(5500);
+  setPressed(false);
+  runFor(Button::TAP_TIMEOUT + 100);
+
+  ButtonEvent event;
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_PRESS));
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_HOLD));
+  TEST_ASSERT_EQUAL_UINT8(0, event.threshold);
+  TEST_ASSERT_EQUAL_UINT32(startUs + HOLDS[0] * 1000, event.timeUs);
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_HOLD));
+  TEST_ASSERT_EQUAL_UINT8(1, event.threshold);
+  TEST_ASSERT_EQUAL_UINT32(HOLDS[1] * 1000, event.durationUs);
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_RELEASE));
+  TEST_ASSERT_EQUAL_UINT32(5500000, event.durationUs);
+  // Too long to be a tap
+  TEST_ASSERT_FALSE(button->pollEvent(event));
+}
+
+static void test_times_survive_a_slow_loop(void) {
+  // The whole press happens while the loop is busy for a second
+  runFor(100);
+  uint32_t pressUs = nowUs();
+  bounceTo(true);
+  SimHal::advanceMicros(300000);
+  uint32_t releaseUs = nowUs();
+  bounceTo(false);
+  SimHal::advanceMicros(700000);
+  button->update();
+
+  ButtonEvent event;
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_PRESS));
+  TEST_ASSERT_EQUAL_UINT32(pressUs, event.timeUs);
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_RELEASE));
+  TEST_ASSERT_EQUAL_UINT32(releaseUs, event.timeUs);
+  TEST_ASSERT_EQUAL_UINT32(releaseUs - pressUs, event.durationUs);
+
+  // The tap deadline passed during the stall as well
+  TEST_ASSERT_TRUE(nextEvent(event, BUTTON_TAPS));
+  TEST_ASSERT_EQUAL_UINT8(1, event.count);
+}
+
+static void test_press_bouncing_in_at_deadline_continues(void) {
+  bounceTo(true);
+  runFor(100);
+  bounceTo(false);
+  runFor(Button::TAP_TIMEOUT - 10);
+
+  // The next press starts just before the deadline; it settles after it
+  bounceTo(true);
+  runFor(100);
+  bounceTo(false);
+  runFor(Button::TAP_TIMEOUT + 100);
+
+  ButtonEvent event;
+  int taps = 0;
+  while (button->pollEvent(event)) {
+    if (event.type == BUTTON_TAPS) {
+      taps++;
+      TEST_ASSERT_EQUAL_UINT8(2, event.count);
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(1, taps);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bounce_is_one_press);
+  RUN_TEST(test_glitch_is_ignored);
+  RUN_TEST(test_taps_counted_after_timeout);
+  RUN_TEST(test_holds_and_long_release);
+  RUN_TEST(test_times_survive_a_slow_loop);
+  RUN_TEST(test_press_bouncing_in_at_deadline_continues);
+  return UNITY_END();
+}
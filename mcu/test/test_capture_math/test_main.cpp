@@ -0,0 +1,92 @@
+#include "frequency_capture.h"
+#include <unity.h>
+
+// CaptureMath: gate result -> half-period / frequency (frequency_capture.h)
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_zero_edges_is_timeout(void) {
+  CaptureResult result = {0, 10000};
+  TEST_ASSERT_EQUAL_UINT32(0, CaptureMath::halfPeriodUs(result));
+  TEST_ASSERT_EQUAL_UINT32(0, CaptureMath::scaledHalfPeriodUs(result, 100, 20));
+  TEST_ASSERT_EQUAL_UINT32(0, CaptureMath::frequencyHz(result));
+}
+
+static void test_zero_gate(void) {
+  CaptureResult result = {10, 0};
+  TEST_ASSERT_EQUAL_UINT32(0, CaptureMath::halfPeriodUs(result));
+  TEST_ASSERT_EQUAL_UINT32(0, CaptureMath::frequencyHz(result));
+}
+
+static void test_exact_half_period(void) {
+  // 10 kHz square wave: 200 edges in 10 ms, 50 us apart
+  CaptureResult result = {200, 10000};
+  TEST_ASSERT_EQUAL_UINT32(50, CaptureMath::halfPeriodUs(result));
+  TEST_ASSERT_EQUAL_UINT32(10000, CaptureMath::frequencyHz(result));
+}
+
+static void test_half_period_rounds_to_nearest(void) {
+  CaptureResult down = {3, 10000}; // 3333.3
+  CaptureResult up = {6, 10000};   // 1666.7
+  CaptureResult tie = {2, 5};      // 2.5
+  TEST_ASSERT_EQUAL_UINT32(3333, CaptureMath::halfPeriodUs(down));
+  TEST_ASSERT_EQUAL_UINT32(1667, CaptureMath::halfPeriodUs(up));
+  TEST_ASSERT_EQUAL_UINT32(3, CaptureMath::halfPeriodUs(tie));
+}
+
+static void test_frequency_rounds_to_nearest(void) {
+  CaptureResult result = {3, 10000}; // 150 Hz
+  TEST_ASSERT_EQUAL_UINT32(150, CaptureMath::frequencyHz(result));
+  CaptureResult odd = {1, 3}; // 166666.67 Hz
+  TEST_ASSERT_EQUAL_UINT32(166667, CaptureMath::frequencyHz(odd));
+}
+
+static void test_scaled_half_period(void) {
+  // A reading at 100% scaling expressed at 20%: 5x longer half-periods
+  CaptureResult result = {400, 10000};
+  TEST_ASSERT_EQUAL_UINT32(125,
+                           CaptureMath::scaledHalfPeriodUs(result, 100, 20));
+  // 2% -> 20%: 10x shorter, rounded (1250 / 3 / 10 = 41.67)
+  CaptureResult slow = {3, 1250};
+  TEST_ASSERT_EQUAL_UINT32(42, CaptureMath::scaledHalfPeriodUs(slow, 2, 20));
+  TEST_ASSERT_EQUAL_UINT32(CaptureMath::halfPeriodUs(result),
+                           CaptureMath::scaledHalfPeriodUs(result, 20, 20));
+}
+
+static void test_long_gate_does_not_wrap(void) {
+  // gateUs + edges / 2 would wrap in 32 bits
+  CaptureResult result = {3, UINT32_MAX};
+  TEST_ASSERT_EQUAL_UINT32(1431655765, CaptureMath::halfPeriodUs(result));
+  CaptureResult single = {1, UINT32_MAX};
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, CaptureMath::halfPeriodUs(single));
+}
+
+static void test_large_results_saturate(void) {
+  CaptureResult slow = {1, UINT32_MAX};
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX,
+                           CaptureMath::scaledHalfPeriodUs(slow, 100, 2));
+  CaptureResult fast = {UINT32_MAX, 1};
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, CaptureMath::frequencyHz(fast));
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX,
+                           CaptureMath::gateForEdges(1000000, 10000));
+}
+
+static void test_gate_for_edges(void) {
+  TEST_ASSERT_EQUAL_UINT32(5000, CaptureMath::gateForEdges(50, 100));
+  TEST_ASSERT_EQUAL_UINT32(0, CaptureMath::gateForEdges(0, 100));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_zero_edges_is_timeout);
+  RUN_TEST(test_zero_gate);
+  RUN_TEST(test_exact_half_period);
+  RUN_TEST(test_half_period_rounds_to_nearest);
+  RUN_TEST(test_frequency_rounds_to_nearest);
+  RUN_TEST(test_scaled_half_period);
+  RUN_TEST(test_long_gate_does_not_wrap);
+  RUN_TEST(test_large_results_saturate);
+  RUN_TEST(test_gate_for_edges);
+  return UNITY_END();
+}
@@ -0,0 +1,103 @@
+#include "color_lab.h"
+#include <math.h>
+#include <unity.h>
+
+// Fixed-point rgbToLab() (color_lab.h) against a double-precision
+// reference over every 24-bit RGB value
+
+void setUp(void) {}
+void tearDown(void) {}
+
+struct LabDouble {
+  double l;
+  double a;
+  double b;
+};
+
+static double srgbToLinear(int value) {
+  double c = value / 255.0;
+  return c <= 0.04045 ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4);
+}
+
+static double labF(double t) {
+  return t > 216.0 / 24389.0 ? cbrt(t) : (24389.0 / 27.0 * t + 16.0) / 116.0;
+}
+
+static LabDouble referenceLab(int red, int green, int blue) {
+  double r = srgbToLinear(red);
+  double g = srgbToLinear(green);
+  double b = srgbToLinear(blue);
+  double x = (0.4124564 * r + 0.3575761 * g + 0.1804375 * b) / 0.95047;
+  double y = 0.2126729 * r + 0.7151522 * g + 0.0721750 * b;
+  double z = (0.0193339 * r + 0.1191920 * g + 0.9503041 * b) / 1.08883;
+  double fx = labF(x);
+  double fy = labF(y);
+  double fz = labF(z);
+  return {116.0 * fy - 16.0, 500.0 * (fx - fy), 200.0 * (fy - fz)};
+}
+
+static void test_error_bounds_over_all_rgb(void) {
+  // The bounds documented in color_lab.h (Lab units)
+  double maxL = 0, maxA = 0, maxB = 0, maxE = 0;
+  for (int r = 0; r < 256; r++) {
+    for (int g = 0; g < 256; g++) {
+      for (int b = 0; b < 256; b++) {
+        LabColor lab = rgbToLab({r, g, b});
+        LabDouble ref = referenceLab(r, g, b);
+        double dl = fabs(lab.l / 100.0 - ref.l);
+        double da = fabs(lab.a / 100.0 - ref.a);
+        double db = fabs(lab.b / 100.0 - ref.b);
+        maxL = fmax(maxL, dl);
+        maxA = fmax(maxA, da);
+        maxB = fmax(maxB, db);
+        maxE = fmax(maxE, sqrt(dl * dl + da * da + db * db));
+      }
+    }
+  }
+  TEST_ASSERT_LESS_OR_EQUAL(0.023, maxL);
+  TEST_ASSERT_LESS_OR_EQUAL(0.101, maxA);
+  TEST_ASSERT_LESS_OR_EQUAL(0.055, maxB);
+  TEST_ASSERT_LESS_OR_EQUAL(0.103, maxE);
+}
+
+static void test_white_and_black(void) {
+  LabColor white = rgbToLab({255, 255, 255});
+  TEST_ASSERT_EQUAL_INT(10000, white.l);
+  TEST_ASSERT_LESS_OR_EQUAL(1, abs(white.a));
+  TEST_ASSERT_LESS_OR_EQUAL(1, abs(white.b));
+
+  LabColor black = rgbToLab({0, 0, 0});
+  TEST_ASSERT_EQUAL_INT(0, black.l);
+  TEST_ASSERT_EQUAL_INT(0, black.a);
+  TEST_ASSERT_EQUAL_INT(0, black.b);
+}
+
+static void test_out_of_range_input_is_clamped(void) {
+  // Calibrated readings can overshoot 0-255
+  LabColor over = rgbToLab({300, -20, 255});
+  LabColor clamped = rgbToLab({255, 0, 255});
+  TEST_ASSERT_EQUAL_INT(clamped.l, over.l);
+  TEST_ASSERT_EQUAL_INT(clamped.a, over.a);
+  TEST_ASSERT_EQUAL_INT(clamped.b, over.b);
+}
+
+static void test_batch_matches_single(void) {
+  RGBColor colors[4] = {{0, 0, 0}, {255, 0, 0}, {12, 200, 99}, {255, 255, 255}};
+  LabColor out[4];
+  rgbToLab(colors, out, 4);
+  for (int i = 0; i < 4; i++) {
+    LabColor single = rgbToLab(colors[i]);
+    TEST_ASSERT_EQUAL_INT(single.l, out[i].l);
+    TEST_ASSERT_EQUAL_INT(single.a, out[i].a);
+    TEST_ASSERT_EQUAL_INT(single.b, out[i].b);
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_white_and_black);
+  RUN_TEST(test_out_of_range_input_is_clamped);
+  RUN_TEST(test_batch_matches_single);
+  RUN_TEST(test_error_bounds_over_all_rgb);
+  return UNITY_END();
+}
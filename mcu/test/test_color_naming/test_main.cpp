@@ -0,0 +1,95 @@
+#include "color_naming_reference.h"
+#include <unity.h>
+
+// Palette namer (color_naming.h) against the exhaustive scan and the RGB
+// threshold chain it replaced (color_naming_reference.h)
+
+using namespace ColorNamingReference;
+
+// RGB grid every GRID_STEP levels per channel, 0 and 255 included
+static const int GRID_STEP = 5;
+
+// Share of the inputs the chain could name where the palette entry picked
+// falls in the chain's class too (86.9% when written)
+static const double MIN_AGREEMENT = 0.85;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_tree_matches_exhaustive_scan(void) {
+  for (int r = 0; r < 256; r += 3 * GRID_STEP) {
+    for (int g = 0; g < 256; g += 3 * GRID_STEP) {
+      for (int b = 0; b < 256; b += 3 * GRID_STEP) {
+        LabColor lab = rgbToLab({r, g, b});
+        TEST_ASSERT_EQUAL_UINT16(ColorNaming::nearestExhaustive(lab),
+                                 ColorNaming::nearest(lab));
+      }
+    }
+  }
+}
+
+static void test_exact_palette_colors(void) {
+  // CSS entries are in the palette; their own RGB names them
+  TEST_ASSERT_EQUAL_STRING("Black",
+                           ColorNaming::nameFor(ColorNaming::nearest(
+                               rgbToLab({0, 0, 0}))));
+  TEST_ASSERT_EQUAL_STRING("White",
+                           ColorNaming::nameFor(ColorNaming::nearest(
+                               rgbToLab({255, 255, 255}))));
+  TEST_ASSERT_EQUAL_STRING("Red", ColorNaming::nameFor(ColorNaming::nearest(
+                                      rgbToLab({255, 0, 0}))));
+}
+
+static void test_every_input_is_named(void) {
+  for (int r = 0; r < 256; r += GRID_STEP) {
+    for (int g = 0; g < 256; g += GRID_STEP) {
+      for (int b = 0; b < 256; b += GRID_STEP) {
+        uint16_t id = ColorNaming::nearest(rgbToLab({r, g, b}));
+        TEST_ASSERT_LESS_THAN(ColorNaming::paletteSize(), id);
+      }
+    }
+  }
+}
+
+static void test_agreement_with_threshold_chain(void) {
+  uint32_t named = 0;
+  uint32_t agreed = 0;
+  for (int r = 0; r < 256; r += GRID_STEP) {
+    for (int g = 0; g < 256; g += GRID_STEP) {
+      for (int b = 0; b < 256; b += GRID_STEP) {
+        RGBColor color = {r, g, b};
+        ChainClass expected = thresholdChain(color);
+        if (expected == CHAIN_UNKNOWN)
+          continue;
+        named++;
+        if (paletteClass(ColorNaming::nearest(rgbToLab(color))) == expected)
+          agreed++;
+      }
+    }
+  }
+  TEST_ASSERT_GREATER_THAN(0, named);
+  TEST_ASSERT_GREATER_OR_EQUAL(MIN_AGREEMENT, (double)agreed / named);
+}
+
+static void test_lab_inverse_round_trips(void) {
+  for (int r = 0; r < 256; r += 3 * GRID_STEP) {
+    for (int g = 0; g < 256; g += 3 * GRID_STEP) {
+      for (int b = 0; b < 256; b += 3 * GRID_STEP) {
+        RGBColor back = labToRgb(rgbToLab({r, g, b}));
+        TEST_ASSERT_LESS_OR_EQUAL(1, abs(back.red - r));
+        TEST_ASSERT_LESS_OR_EQUAL(1, abs(back.green - g));
+        TEST_ASSERT_LESS_OR_EQUAL(1, abs(back.blue - b));
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_tree_matches_exhaustive_scan);
+  RUN_TEST(test_exact_palette_colors);
+  RUN_TEST(test_every_input_is_named);
+  RUN_TEST(test_lab_inverse_round_trips);
+  RUN_TEST(test_agreement_with_threshold_chain);
+  return UNITY_END();
+}
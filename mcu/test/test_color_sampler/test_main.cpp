@@ -0,0 +1,122 @@
+#include "color_sampler.h"
+#include <math.h>
+#include <unity.h>
+
+// ColorSampler (color_sampler.h): the confidence interval needs
+// MIN_CONFIDENT_SAMPLES and describes the same window as the trimmed mean
+
+static ColorSampler *sampler;
+
+void setUp(void) { sampler = new ColorSampler(); }
+void tearDown(void) { delete sampler; }
+
+static bool addGray(int value) {
+  RGBColor color = {value, value, value};
+  RawFrequencies raw = {100, 100, 100};
+  return sampler->addSample(color, raw);
+}
+
+// Yuen's half-width for one channel, in double precision
+static double referenceHalfWidth(const int *values, int count) {
+  static const double T_95[] = {12.706, 4.303, 3.182, 2.776, 2.571,
+                                2.447,  2.365, 2.306, 2.262, 2.228,
+                                2.201,  2.179, 2.160, 2.145, 2.131};
+  double sorted[ColorSampler::WINDOW_SIZE];
+  for (int i = 0; i < count; i++) {
+    int j = i;
+    while (j > 0 && sorted[j - 1] > values[i]) {
+      sorted[j] = sorted[j - 1];
+      j--;
+    }
+    sorted[j] = values[i];
+  }
+  int trim = count / ColorSampler::TRIM_DIVISOR;
+  for (int i = 0; i < trim; i++) {
+    sorted[i] = sorted[trim];
+    sorted[count - 1 - i] = sorted[count - 1 - trim];
+  }
+  double mean = 0;
+  for (int i = 0; i < count; i++) {
+    mean += sorted[i];
+  }
+  mean /= count;
+  double squares = 0;
+  for (int i = 0; i < count; i++) {
+    squares += (sorted[i] - mean) * (sorted[i] - mean);
+  }
+  int kept = count - 2 * trim;
+  double standardError = sqrt(squares / (count - 1) * count) / kept;
+  return T_95[kept - 2] * standardError;
+}
+
+static void test_identical_readings_need_minimum(void) {
+  for (int i = 1; i < ColorSampler::MIN_CONFIDENT_SAMPLES; i++) {
+    addGray(120);
+    TEST_ASSERT_TRUE(isinf(sampler->getConfidenceHalfWidth()));
+    TEST_ASSERT_FALSE(sampler->isConfident());
+  }
+  addGray(120);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, sampler->getConfidenceHalfWidth());
+  TEST_ASSERT_TRUE(sampler->isConfident());
+}
+
+static void test_matches_reference(void) {
+  static const int VALUES[] = {118, 121, 119, 124, 120, 117, 122, 120, 123};
+  const int count = sizeof(VALUES) / sizeof(VALUES[0]);
+  for (int i = 0; i < count; i++) {
+    TEST_ASSERT_TRUE(addGray(VALUES[i]));
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, referenceHalfWidth(VALUES, count),
+                           sampler->getConfidenceHalfWidth());
+}
+
+static void test_trim_bounds_unchecked_extreme(void) {
+  // The first samples are not outlier-checked; the trimmed mean drops the
+  // extreme one, and the interval must not be blown up by it either
+  static const int VALUES[] = {160, 120, 121, 119, 120, 121, 120, 119};
+  const int count = sizeof(VALUES) / sizeof(VALUES[0]);
+  for (int i = 0; i < count; i++) {
+    TEST_ASSERT_TRUE(addGray(VALUES[i]));
+  }
+  TEST_ASSERT_EQUAL_INT(120, sampler->getAverage().red);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, referenceHalfWidth(VALUES, count),
+                           sampler->getConfidenceHalfWidth());
+  TEST_ASSERT_TRUE(sampler->isConfident());
+}
+
+static void test_interval_follows_window(void) {
+  // Early scatter leaves the window; the interval and the average forget it
+  static const int EARLY[] = {110, 130, 112, 128};
+  for (int i = 0; i < 4; i++) {
+    addGray(EARLY[i]);
+  }
+  for (int i = 0; i < ColorSampler::WINDOW_SIZE; i++) {
+    TEST_ASSERT_TRUE(addGray(120));
+  }
+  TEST_ASSERT_EQUAL_INT(ColorSampler::WINDOW_SIZE + 4,
+                        sampler->getSampleCount());
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, sampler->getConfidenceHalfWidth());
+  SamplerStats stats = sampler->getStats();
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, stats.stdDev[0]);
+  TEST_ASSERT_EQUAL_INT(120, sampler->getAverage().red);
+}
+
+static void test_reset_clears_interval(void) {
+  for (int i = 0; i < ColorSampler::MIN_CONFIDENT_SAMPLES; i++) {
+    addGray(120);
+  }
+  TEST_ASSERT_TRUE(sampler->isConfident());
+  sampler->reset();
+  addGray(120);
+  TEST_ASSERT_FALSE(sampler->isConfident());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_identical_readings_need_minimum);
+  RUN_TEST(test_matches_reference);
+  RUN_TEST(test_trim_bounds_unchecked_extreme);
+  RUN_TEST(test_interval_follows_window);
+  RUN_TEST(test_reset_clears_interval);
+  return UNITY_END();
+}
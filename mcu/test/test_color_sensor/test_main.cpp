@@ -0,0 +1,454 @@
+#include "color_sensor.h"
+#include "sim_hal.h"
+#include <unity.h>
+
+// ColorSensor reading lifecycle: a capture that never completes or is
+// refused ends the reading, and the next one goes through. Settings changed
+// during a reading wait for the next one, and maxReadingUs() bounds the
+// capture time the planned steps ask for. Against a modelled light source,
+// auto-ranging picks each channel's scaling and splits the gate budget from
+// the previous reading, and ambient mode subtracts the LED-off light.
+
+static const uint8_t PIN_S0 = 27;
+static const uint8_t PIN_S1 = 25;
+static const uint8_t PIN_S2 = 32;
+static const uint8_t PIN_S3 = 33;
+static const uint8_t PIN_LED = 26;
+
+// Output frequency at 20% scaling per filter (R, G, B, clear), in Hz
+struct Scene {
+  uint32_t ledHz[4];     // Reflected LED light
+  uint32_t ambientHz[4]; // Seen with the LED on or off
+};
+
+// Completes captures only when told to; can refuse start()
+class ManualCapture : public FrequencyCapture {
+public:
+  ManualCapture()
+      : starts(0), aborts(0), refuseFrom(0), requestedUs(0), gateUs(0),
+        scene(nullptr) {}
+
+  bool begin(uint8_t pin) override { return true; }
+
+  bool start(uint32_t settleUs, uint32_t gateUs) override {
+    if (refuseFrom > 0 && starts + 1 >= refuseFrom)
+      return false;
+    bool expected = false;
+    if (!busy.compare_exchange_strong(expected, true))
+      return false;
+    starts++;
+    requestedUs += settleUs + gateUs;
+    this->gateUs = gateUs;
+    return true;
+  }
+
+  void abort() override {
+    aborts++;
+    cancel();
+  }
+
+  // Closes the gate of the capture in flight (or a cancelled one, late).
+  // With a scene, the edges are those of the light the pins select.
+  void finish() {
+    if (!scene) {
+      complete({200, 10000});
+      return;
+    }
+    static const uint8_t FILTERS[2][2] = {{FILTER_RED, FILTER_BLUE},
+                                          {FILTER_CLEAR, FILTER_GREEN}};
+    static const uint64_t PERCENT[2][2] = {{0, 2}, {20, 100}};
+    uint8_t filter =
+        FILTERS[SimHal::getOutput(PIN_S2)][SimHal::getOutput(PIN_S3)];
+    uint64_t percent =
+        PERCENT[SimHal::getOutput(PIN_S0)][SimHal::getOutput(PIN_S1)];
+    uint64_t hz = scene->ambientHz[filter];
+    if (SimHal::getOutput(PIN_LED) == HIGH) {
+      hz += scene->ledHz[filter];
+    }
+    // Both edges of each period are counted
+    uint32_t edges = (uint32_t)(2 * hz * percent * gateUs / (20 * 1000000));
+    complete({edges, gateUs});
+  }
+
+  uint32_t starts;
+  uint32_t aborts;
+  uint32_t refuseFrom; // 1-based start() to refuse from, 0 = none
+  uint32_t requestedUs; // Settle and gate time of every start()
+  uint32_t gateUs;      // Of the last start()
+  const Scene *scene;
+};
+
+static ManualCapture *capture;
+static ColorSensor *sensor;
+static int readyCalls;
+
+// Steps of the last reading, as seen by the capture observer
+static CaptureStep steps[ColorSensor::MAX_STEPS];
+static CaptureResult stepResults[ColorSensor::MAX_STEPS];
+static uint8_t stepCount;
+
+static void onReady(void *context) { readyCalls++; }
+
+static void onStep(void *context, const CaptureStep &step,
+                   const CaptureResult &result, bool last) {
+  if (stepCount >= ColorSensor::MAX_STEPS)
+    return;
+  steps[stepCount] = step;
+  stepResults[stepCount] = result;
+  stepCount++;
+}
+
+// Completes every step of the reading in flight
+static bool finishReading(RGBColor &color) {
+  for (int i = 0; i < ColorSensor::MAX_STEPS && sensor->isReading(); i++) {
+    capture->finish();
+  }
+  return sensor->takeReading(color);
+}
+
+void setUp(void) {
+  capture = new ManualCapture();
+  sensor = new ColorSensor(27, 25, 32, 33, 35, PIN_LED, *capture);
+  sensor->begin();
+  sensor->onReadingReady(onReady, nullptr);
+  sensor->onCapture(onStep, nullptr);
+  readyCalls = 0;
+  stepCount = 0;
+}
+
+void tearDown(void) {
+  delete sensor;
+  delete capture;
+}
+
+static void test_reading_completes(void) {
+  RGBColor color;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_FALSE(sensor->startReading()); // One at a time
+  TEST_ASSERT_TRUE(finishReading(color));
+  TEST_ASSERT_EQUAL_INT(1, readyCalls);
+  TEST_ASSERT_FALSE(capture->isBusy());
+}
+
+static void test_abort_frees_sensor_and_capture(void) {
+  RGBColor color;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_TRUE(capture->isBusy());
+
+  // The gate never closes; the caller gives up
+  sensor->abortReading();
+  TEST_ASSERT_FALSE(sensor->isReading());
+  TEST_ASSERT_FALSE(capture->isBusy());
+  TEST_ASSERT_EQUAL_UINT32(1, capture->aborts);
+  TEST_ASSERT_FALSE(sensor->takeReading(color));
+
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_TRUE(finishReading(color));
+}
+
+static void test_late_completion_is_ignored(void) {
+  RGBColor color;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  sensor->abortReading();
+  capture->finish(); // Timer callback that was already running
+  TEST_ASSERT_FALSE(sensor->isReading());
+  TEST_ASSERT_FALSE(sensor->takeReading(color));
+  TEST_ASSERT_EQUAL_INT(0, readyCalls);
+
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_TRUE(finishReading(color));
+}
+
+static void test_refused_first_step(void) {
+  capture->refuseFrom = 1;
+  TEST_ASSERT_FALSE(sensor->startReading());
+  TEST_ASSERT_FALSE(sensor->isReading());
+
+  capture->refuseFrom = 0;
+  RGBColor color;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_TRUE(finishReading(color));
+}
+
+static void test_refused_later_step(void) {
+  capture->refuseFrom = 2;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  capture->finish(); // Step 0 done, step 1 refused
+  TEST_ASSERT_FALSE(sensor->isReading());
+  TEST_ASSERT_EQUAL_INT(1, readyCalls); // The waiting task is woken
+  RGBColor color;
+  TEST_ASSERT_FALSE(sensor->takeReading(color));
+
+  capture->refuseFrom = 0;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_TRUE(finishReading(color));
+}
+
+static void test_abort_restores_led(void) {
+  // Ambient mode starts with LED-off captures
+  sensor->setAmbientMode(true);
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_EQUAL_UINT8(LOW, SimHal::getOutput(PIN_LED));
+  sensor->abortReading();
+  TEST_ASSERT_EQUAL_UINT8(HIGH, SimHal::getOutput(PIN_LED));
+
+  sensor->setLed(false);
+  TEST_ASSERT_TRUE(sensor->startReading());
+  sensor->abortReading();
+  TEST_ASSERT_EQUAL_UINT8(LOW, SimHal::getOutput(PIN_LED));
+}
+
+// Settle and gate time of the next reading
+static uint32_t readingUs(void) {
+  RGBColor color;
+  capture->requestedUs = 0;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_TRUE(finishReading(color));
+  return capture->requestedUs;
+}
+
+// Runs a whole reading against the scene; its raw half-periods in raw
+static void sceneReading(RawFrequencies &raw) {
+  RGBColor color;
+  stepCount = 0;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  TEST_ASSERT_TRUE(finishReading(color));
+  raw = sensor->getLastRaw();
+}
+
+static void test_max_reading_bounds_plan(void) {
+  sensor->setCaptureTiming(500, 5000);
+  for (int flags = 0; flags < 4; flags++) {
+    bool autoRange = flags & 1;
+    bool ambient = flags & 2;
+    sensor->setAutoRange(autoRange);
+    sensor->setAmbientMode(ambient);
+    uint32_t limit = ColorSensor::maxReadingUs(500, 5000, autoRange, ambient);
+
+    // With ambient on, the first reading is a full refresh
+    uint32_t first = readingUs();
+    uint32_t next = readingUs();
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(limit, first);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(limit, next);
+    if (!autoRange)
+      TEST_ASSERT_EQUAL_UINT32(limit, first);
+  }
+}
+
+static void test_settings_wait_for_next_reading(void) {
+  sensor->setAutoRange(false);
+  sensor->setCaptureTiming(500, 5000);
+  RGBColor color;
+  capture->requestedUs = 0;
+  TEST_ASSERT_TRUE(sensor->startReading());
+  capture->finish();
+
+  // The loop applies a config write while the reading is in flight
+  sensor->setCaptureTiming(1000, 8000);
+  sensor->setAmbientMode(true);
+  TEST_ASSERT_EQUAL_UINT32(1000, sensor->getSettleTimeUs());
+  TEST_ASSERT_TRUE(sensor->isAmbientMode());
+  TEST_ASSERT_TRUE(finishReading(color));
+  TEST_ASSERT_EQUAL_UINT32(3, capture->starts);
+  TEST_ASSERT_EQUAL_UINT32(3 * 5500, capture->requestedUs);
+
+  // The next one is a full ambient refresh with the new timing
+  TEST_ASSERT_EQUAL_UINT32(
+      ColorSensor::maxReadingUs(1000, 8000, false, true), readingUs());
+  TEST_ASSERT_EQUAL_UINT32(3 + 7, capture->starts);
+}
+
+static void test_auto_range_per_channel(void) {
+  // Half-periods at 20%: red 2.5 us (too fast for 100%), green 25, blue 250
+  static const Scene scene = {{200000, 20000, 2000, 0}, {0, 0, 0, 0}};
+  capture->scene = &scene;
+  sensor->setCaptureTiming(500, 5000);
+
+  // Nothing to go on: the most sensitive range and an even split
+  RawFrequencies raw;
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT8(3, stepCount);
+  for (uint8_t i = 0; i < 3; i++) {
+    TEST_ASSERT_EQUAL_UINT8(SCALING_100, steps[i].scaling);
+    TEST_ASSERT_EQUAL_UINT32(5000, steps[i].gateUs);
+  }
+
+  // From then on each channel has its range, and the 15 ms budget goes to
+  // the slow channels in proportion, so they count about as many edges
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT8(SCALING_20, steps[0].scaling);
+  TEST_ASSERT_EQUAL_UINT8(SCALING_100, steps[1].scaling);
+  TEST_ASSERT_EQUAL_UINT8(SCALING_100, steps[2].scaling);
+  TEST_ASSERT_EQUAL_UINT32(ColorSensor::MIN_GATE_TIME_US, steps[0].gateUs);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(15000, steps[1].gateUs + steps[2].gateUs);
+  TEST_ASSERT_UINT32_WITHIN(stepResults[1].edges / 50, stepResults[1].edges,
+                            stepResults[2].edges);
+
+  // Raw half-periods stay at 20% whatever range they were read in (to
+  // within the count resolution of the shorter gates)
+  TEST_ASSERT_UINT32_WITHIN(1, 3, raw.red);
+  TEST_ASSERT_UINT32_WITHIN(1, 25, raw.green);
+  TEST_ASSERT_UINT32_WITHIN(2, 250, raw.blue);
+}
+
+static void test_auto_range_dark_channel(void) {
+  static Scene scene = {{20000, 20000, 20000, 0}, {0, 0, 0, 0}};
+  capture->scene = &scene;
+  sensor->setCaptureTiming(500, 5000);
+  RawFrequencies raw;
+  sceneReading(raw);
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT32(5000, steps[0].gateUs);
+
+  // Blue sees no edges: the next reading starts over from an even split
+  scene.ledHz[FILTER_BLUE] = 0;
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT32(0, raw.blue);
+  sceneReading(raw);
+  for (uint8_t i = 0; i < 3; i++) {
+    TEST_ASSERT_EQUAL_UINT8(SCALING_100, steps[i].scaling);
+    TEST_ASSERT_EQUAL_UINT32(5000, steps[i].gateUs);
+  }
+}
+
+static void test_fixed_range(void) {
+  static const Scene scene = {{200000, 20000, 2000, 0}, {0, 0, 0, 0}};
+  capture->scene = &scene;
+  sensor->setCaptureTiming(500, 5000);
+  sensor->setAutoRange(false);
+  sensor->setScaling(SCALING_2);
+  RawFrequencies raw;
+  sceneReading(raw);
+  sceneReading(raw);
+  for (uint8_t i = 0; i < 3; i++) {
+    TEST_ASSERT_EQUAL_UINT8(SCALING_2, steps[i].scaling);
+    TEST_ASSERT_EQUAL_UINT32(5000, steps[i].gateUs);
+  }
+  TEST_ASSERT_EQUAL_UINT32(25, raw.green);
+}
+
+// LED light only, as half-periods at 20%: 50, 100 and 125 us
+static Scene ambientScene = {{10000, 5000, 4000, 0}, {2000, 1000, 0, 4000}};
+
+static void scaleAmbient(uint32_t percent) {
+  static const uint32_t BASE[4] = {2000, 1000, 0, 4000};
+  for (uint8_t f = 0; f < 4; f++) {
+    ambientScene.ambientHz[f] = BASE[f] * percent / 100;
+  }
+}
+
+static void assertLedOnly(const RawFrequencies &raw) {
+  TEST_ASSERT_EQUAL_UINT32(50, raw.red);
+  TEST_ASSERT_EQUAL_UINT32(100, raw.green);
+  TEST_ASSERT_EQUAL_UINT32(125, raw.blue);
+}
+
+static void test_ambient_subtracted(void) {
+  scaleAmbient(100);
+  capture->scene = &ambientScene;
+  sensor->setCaptureTiming(500, 5000);
+  sensor->setAutoRange(false);
+  sensor->setAmbientMode(true);
+
+  // The first reading measures every channel with the LED off, first
+  RawFrequencies raw;
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT8(7, stepCount);
+  for (uint8_t i = 0; i < 4; i++) {
+    TEST_ASSERT_TRUE(steps[i].ambient);
+  }
+  TEST_ASSERT_EQUAL_UINT8(FILTER_CLEAR, steps[3].filter);
+  TEST_ASSERT_FALSE(steps[4].ambient);
+  TEST_ASSERT_EQUAL_UINT8(HIGH, SimHal::getOutput(PIN_LED));
+  assertLedOnly(raw);
+
+  // Then only the clear channel; the others follow it
+  scaleAmbient(120);
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT8(4, stepCount);
+  TEST_ASSERT_EQUAL_UINT8(FILTER_CLEAR, steps[0].filter);
+  assertLedOnly(raw);
+
+  // Without the subtraction the channels read brighter
+  sensor->setAmbientMode(false);
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT8(3, stepCount);
+  TEST_ASSERT_LESS_THAN_UINT32(50, raw.red);
+  TEST_ASSERT_EQUAL_UINT32(125, raw.blue);
+}
+
+static void test_ambient_refresh(void) {
+  scaleAmbient(100);
+  capture->scene = &ambientScene;
+  sensor->setCaptureTiming(500, 5000);
+  sensor->setAutoRange(false);
+  sensor->setAmbientMode(true);
+  RawFrequencies raw;
+  sceneReading(raw);
+
+  // A clear-channel change of over a quarter refreshes the next reading
+  scaleAmbient(200);
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT8(4, stepCount);
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT8(7, stepCount);
+  assertLedOnly(raw);
+
+  // And so does every AMBIENT_REFRESH_READINGS-th one, however steady
+  uint8_t refreshes = 0;
+  for (uint8_t i = 0; i < ColorSensor::AMBIENT_REFRESH_READINGS + 1; i++) {
+    sceneReading(raw);
+    refreshes += stepCount == 7;
+    assertLedOnly(raw);
+  }
+  TEST_ASSERT_EQUAL_UINT8(1, refreshes);
+}
+
+static void test_ambient_gates_share_budget(void) {
+  scaleAmbient(100);
+  capture->scene = &ambientScene;
+  sensor->setCaptureTiming(500, 5000);
+  sensor->setAmbientMode(true);
+  RawFrequencies raw;
+  sceneReading(raw);
+  sceneReading(raw);
+  sensor->setAmbientMode(true); // Forces a refresh
+  sceneReading(raw);
+  TEST_ASSERT_EQUAL_UINT8(7, stepCount);
+
+  // LED-off captures get 1/8 of the 15 ms budget each, in the clear
+  // channel's range; the LED-on ones split the rest
+  uint32_t ambientUs = 15000 / ColorSensor::AMBIENT_GATE_DIVISOR;
+  uint32_t onUs = 0;
+  for (uint8_t i = 0; i < 7; i++) {
+    if (steps[i].ambient) {
+      TEST_ASSERT_EQUAL_UINT32(ambientUs, steps[i].gateUs);
+      TEST_ASSERT_EQUAL_UINT8(steps[0].scaling, steps[i].scaling);
+    } else {
+      onUs += steps[i].gateUs;
+    }
+  }
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(15000 - 4 * ambientUs, onUs);
+  TEST_ASSERT_UINT32_WITHIN(2, 50, raw.red);
+  TEST_ASSERT_UINT32_WITHIN(2, 100, raw.green);
+  TEST_ASSERT_UINT32_WITHIN(2, 125, raw.blue);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_reading_completes);
+  RUN_TEST(test_abort_frees_sensor_and_capture);
+  RUN_TEST(test_late_completion_is_ignored);
+  RUN_TEST(test_refused_first_step);
+  RUN_TEST(test_refused_later_step);
+  RUN_TEST(test_abort_restores_led);
+  RUN_TEST(test_max_reading_bounds_plan);
+  RUN_TEST(test_settings_wait_for_next_reading);
+  RUN_TEST(test_auto_range_per_channel);
+  RUN_TEST(test_auto_range_dark_channel);
+  RUN_TEST(test_fixed_range);
+  RUN_TEST(test_ambient_subtracted);
+  RUN_TEST(test_ambient_refresh);
+  RUN_TEST(test_ambient_gates_share_budget);
+  return UNITY_END();
+}
@@ -0,0 +1,78 @@
+#include "color_sensor.h"
+#include "device_config.h"
+#include <unity.h>
+
+// validateConfig() (device_config.h): the streamed reading must fit its
+// slot with the ambient refresh and the auto-range clamp counted
+
+static DeviceConfig config;
+
+void setUp(void) {
+  config = {};
+  config.flags = 0;
+  config.longPressMs = 2000;
+  config.ledToggleMs = 5000;
+  config.autoOffMs = 0;
+  config.minSamples = 3;
+  config.streamRateHz = 50;
+  config.settleUs = ColorSensor::SETTLE_TIME_US;
+  config.gateUs = ColorSensor::GATE_TIME_US;
+  config.streamSettleUs = 500;
+  config.streamGateUs = 5000;
+  config.scaling = SCALING_20;
+  config.ciTargetTenths = 30;
+}
+
+void tearDown(void) {}
+
+static void test_defaults_fit(void) {
+  TEST_ASSERT_EQUAL_UINT8(0, validateConfig(config));
+  config.flags = CONFIG_FLAG_AUTO_RANGE;
+  TEST_ASSERT_EQUAL_UINT8(0, validateConfig(config));
+}
+
+static void test_ambient_counts_led_off_steps(void) {
+  // 7 x (500 + 5000) us = 38.5 ms: too long for a 20 ms slot, fits 40 ms
+  config.flags = CONFIG_FLAG_AMBIENT;
+  TEST_ASSERT_EQUAL_UINT32(38500,
+                           ColorSensor::maxReadingUs(500, 5000, false, true));
+  TEST_ASSERT_EQUAL_UINT8(13, validateConfig(config));
+  config.streamRateHz = 25;
+  TEST_ASSERT_EQUAL_UINT8(0, validateConfig(config));
+  config.streamRateHz = 26;
+  TEST_ASSERT_EQUAL_UINT8(13, validateConfig(config));
+}
+
+static void test_auto_range_counts_clamp(void) {
+  // 3 x 500 + 15000 + 2 x 1000 us of clamp headroom = 18.5 ms
+  config.flags = CONFIG_FLAG_AUTO_RANGE;
+  TEST_ASSERT_EQUAL_UINT32(18500,
+                           ColorSensor::maxReadingUs(500, 5000, true, false));
+  config.streamRateHz = 54;
+  TEST_ASSERT_EQUAL_UINT8(0, validateConfig(config));
+  config.streamRateHz = 55;
+  TEST_ASSERT_EQUAL_UINT8(13, validateConfig(config));
+
+  // Fixed gates need no headroom
+  config.flags = 0;
+  TEST_ASSERT_EQUAL_UINT8(0, validateConfig(config));
+}
+
+static void test_ambient_with_auto_range(void) {
+  // LED-off gates get 1/8 of the 15 ms budget, the rest goes to LED-on
+  config.flags = CONFIG_FLAG_AUTO_RANGE | CONFIG_FLAG_AMBIENT;
+  TEST_ASSERT_EQUAL_UINT32(20500,
+                           ColorSensor::maxReadingUs(500, 5000, true, true));
+  TEST_ASSERT_EQUAL_UINT8(13, validateConfig(config));
+  config.streamRateHz = 48;
+  TEST_ASSERT_EQUAL_UINT8(0, validateConfig(config));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_defaults_fit);
+  RUN_TEST(test_ambient_counts_led_off_steps);
+  RUN_TEST(test_auto_range_counts_clamp);
+  RUN_TEST(test_ambient_with_auto_range);
+  return UNITY_END();
+}
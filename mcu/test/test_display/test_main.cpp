@@ -0,0 +1,115 @@
+#include "display.h"
+#include "sim_hal.h"
+#include <string>
+#include <unity.h>
+
+// Display (display.h) against the host panel model: the first frame is sent
+// in full, later ones only as the changed columns of the changed pages, an
+// identical frame is not handed over, and frames presented within the
+// refresh cap are replaced by the latest one
+
+// One page in full: the 7-byte window, then 128 columns in two chunks
+static const uint32_t FULL_PAGE_BYTES = (7 + 1) + (127 + 2) + (1 + 2);
+
+static Display *display;
+static std::string shown; // Text of the frame the panel shows
+
+static void onFrame(void *context, const char *frame) { shown = frame; }
+
+// Lets the refresh cap run out, then does the flush task's work
+static void flushNow(void) {
+  SimHal::advanceMicros(Display::MIN_FRAME_INTERVAL_MS * 1000);
+  display->poll();
+}
+
+void setUp(void) {
+  shown.clear();
+  SimHal::setDisplaySink(onFrame, nullptr);
+  display = new Display(128, 64, 21, 22);
+  TEST_ASSERT_TRUE(display->begin());
+}
+
+void tearDown(void) {
+  SimHal::setDisplaySink(nullptr, nullptr);
+  delete display;
+}
+
+static void test_first_frame_sent_in_full(void) {
+  display->showMessage("Hello", "one");
+  flushNow();
+
+  DisplayStats stats = display->getStats();
+  TEST_ASSERT_EQUAL_UINT32(1, stats.flushes);
+  TEST_ASSERT_EQUAL_UINT32(8, stats.pagesSent);
+  TEST_ASSERT_EQUAL_UINT32(8 * FULL_PAGE_BYTES, stats.bytesSent);
+  TEST_ASSERT_EQUAL_STRING("Hello\none\n", shown.c_str());
+}
+
+static void test_unchanged_frame_not_submitted(void) {
+  display->showMessage("Hello", "one");
+  flushNow();
+  display->showMessage("Hello", "one");
+  flushNow();
+
+  DisplayStats stats = display->getStats();
+  TEST_ASSERT_EQUAL_UINT32(1, stats.submitted);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.unchanged);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.flushes);
+}
+
+static void test_only_changed_columns_sent(void) {
+  display->showMessage("Hello", "one");
+  flushNow();
+  DisplayStats before = display->getStats();
+
+  // The second line (rows 20-26) spans pages 2 and 3, and three characters
+  // are at most 18 columns of each
+  display->showMessage("Hello", "two");
+  flushNow();
+  DisplayStats after = display->getStats();
+  uint32_t pages = after.pagesSent - before.pagesSent;
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, pages);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(2, pages);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(pages * (8 + 18 + 2),
+                                   after.bytesSent - before.bytesSent);
+
+  // The panel model only reports a frame once its RAM matches the buffer
+  TEST_ASSERT_EQUAL_STRING("Hello\ntwo\n", shown.c_str());
+}
+
+static void test_latest_frame_wins(void) {
+  display->showMessage("Hello", "one");
+  flushNow();
+
+  // Three frames before the cap runs out: only the last one is sent
+  uint32_t presentedUs = (uint32_t)SimHal::nowMicros();
+  display->showMessage("Hello", "two");
+  display->poll();
+  display->showMessage("Hello", "three");
+  display->poll();
+  display->showMessage("Hello", "four");
+  display->poll();
+  TEST_ASSERT_EQUAL_UINT32(1, display->getStats().flushes);
+
+  flushNow();
+  DisplayStats stats = display->getStats();
+  TEST_ASSERT_EQUAL_UINT32(4, stats.submitted);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.superseded);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.flushes);
+  TEST_ASSERT_EQUAL_STRING("Hello\nfour\n", shown.c_str());
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(
+      (uint32_t)SimHal::nowMicros() - presentedUs, stats.latencyUs);
+
+  // Nothing new: the next poll sends nothing
+  flushNow();
+  TEST_ASSERT_EQUAL_UINT32(2, display->getStats().flushes);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_first_frame_sent_in_full);
+  RUN_TEST(test_unchanged_frame_not_submitted);
+  RUN_TEST(test_only_changed_columns_sent);
+  RUN_TEST(test_latest_frame_wins);
+  return UNITY_END();
+}
@@ -0,0 +1,324 @@
+#include "journal_sync.h"
+#include "sim_hal.h"
+#include <string.h>
+#include <unity.h>
+
+// JournalSync (journal_sync.h) against simulated centrals: START below the
+// minimum MTU or without notifications, a client that unsubscribes
+// mid-transfer, go-back-N on NACK and on ACK timeout, the window limit,
+// resuming after a disconnect, completion on the final ACK and the packet
+// counter wrapping
+
+// More than 256 single-record packets, so the u8 packet counter wraps
+static const uint32_t RECORDS = 300;
+static const size_t PARTITION_SIZE = 64 * 1024;
+
+static Bluetooth ble;
+static MeasurementJournal journal;
+static JournalSync journalSync(journal, ble);
+static uint16_t central = SimHal::BLE_NO_CONNECTION;
+
+struct Received {
+  uint32_t data;
+  uint32_t rejects;
+  uint8_t status;
+  uint8_t firstCount;
+  uint8_t firstCounter;  // Packet counter of the first DATA
+  uint32_t firstSequence; // First record of the first DATA
+  uint8_t lastCounter;
+  uint32_t next;          // Sequence after the latest DATA
+  uint32_t counterSkips;  // DATA not numbered one after the previous
+  bool ended;
+  uint32_t endNext;
+};
+static Received received;
+static bool autoAck; // ACK every DATA and the END, as a client does
+static uint32_t clientAcked;
+static bool endAcked;
+
+static uint32_t firstSequenceOf(const uint8_t *data) {
+  MeasurementRecord record;
+  decodeMeasurement(data + SYNC_DATA_HEADER_SIZE, record);
+  return record.sequence;
+}
+
+static void onNotification(void *context, uint16_t connId, const char *uuid,
+                           const uint8_t *data, size_t length) {
+  if (strcmp(uuid, SYNC_CHARACTERISTIC_UUID) != 0 || length < 2)
+    return;
+  if (data[0] == SYNC_DATA) {
+    uint8_t count = data[2];
+    MeasurementRecord last;
+    decodeMeasurement(data + SYNC_DATA_HEADER_SIZE +
+                          (count - 1) * MEASUREMENT_RECORD_SIZE,
+                      last);
+    if (received.data++ == 0) {
+      received.firstCount = count;
+      received.firstCounter = data[1];
+      received.firstSequence = firstSequenceOf(data);
+    } else if (data[1] != (uint8_t)(received.lastCounter + 1)) {
+      received.counterSkips++;
+    }
+    received.lastCounter = data[1];
+    received.next = last.sequence + 1;
+  } else if (data[0] == SYNC_END && length >= 5) {
+    received.ended = true;
+    received.endNext = (uint32_t)data[1] | ((uint32_t)data[2] << 8) |
+                       ((uint32_t)data[3] << 16) | ((uint32_t)data[4] << 24);
+  } else if (data[0] == SYNC_REJECT) {
+    received.rejects++;
+    received.status = data[1];
+  }
+}
+
+static void sendAck(uint8_t type, uint32_t next) {
+  uint8_t command[5] = {type, (uint8_t)next, (uint8_t)(next >> 8),
+                        (uint8_t)(next >> 16), (uint8_t)(next >> 24)};
+  SimHal::bleWrite(central, SYNC_CHARACTERISTIC_UUID, command,
+                   sizeof(command));
+}
+
+static void runFor(unsigned long ms) {
+  unsigned long end = millis() + ms;
+  while ((long)(millis() - end) < 0) {
+    journal.poll();
+    journalSync.poll();
+    SimHal::advanceMicros(1000);
+
+    if (!autoAck)
+      continue;
+    if (received.next != clientAcked) {
+      sendAck(SYNC_CMD_ACK, received.next);
+      clientAcked = received.next;
+    }
+    if (received.ended && !endAcked) {
+      sendAck(SYNC_CMD_ACK, received.endNext);
+      endAcked = true;
+    }
+  }
+}
+
+static void startSync(uint32_t from, uint8_t window = SYNC_DEFAULT_WINDOW) {
+  uint8_t command[10] = {SYNC_CMD_START, (uint8_t)from, (uint8_t)(from >> 8),
+                         (uint8_t)(from >> 16), (uint8_t)(from >> 24),
+                         0, 0, 0, 0, window};
+  SimHal::bleWrite(central, SYNC_CHARACTERISTIC_UUID, command,
+                   sizeof(command));
+}
+
+static void connect(uint16_t mtu, bool subscribe) {
+  central = SimHal::bleConnect(mtu);
+  TEST_ASSERT_NOT_EQUAL(SimHal::BLE_NO_CONNECTION, central);
+  if (subscribe)
+    SimHal::bleSubscribe(central, SYNC_CHARACTERISTIC_UUID, true);
+}
+
+void setUp(void) {
+  static bool started = false;
+  if (!started) {
+    ble.begin("test");
+    SimHal::addFlashPartition("journal",
+                              MeasurementJournal::PARTITION_SUBTYPE,
+                              PARTITION_SIZE);
+    TEST_ASSERT_TRUE(journal.begin());
+    for (uint32_t i = 0; i < RECORDS; i++) {
+      MeasurementRecord r = {};
+      r.samples = 5;
+      r.ciTenths = JOURNAL_CI_UNKNOWN;
+      journal.append(r);
+      journal.poll();
+    }
+    runFor(MeasurementJournal::FLUSH_DELAY_MS);
+    TEST_ASSERT_TRUE(journalSync.begin());
+    SimHal::setBleSink(onNotification, nullptr);
+    started = true;
+  }
+  received = {};
+  autoAck = false;
+  clientAcked = 0;
+  endAcked = false;
+}
+
+void tearDown(void) {
+  if (central != SimHal::BLE_NO_CONNECTION)
+    SimHal::bleDisconnect(central);
+  central = SimHal::BLE_NO_CONNECTION;
+  runFor(50);
+}
+
+static void test_small_mtu_rejected(void) {
+  uint32_t rejected = journalSync.getStats().rejected;
+  connect(SYNC_MIN_MTU - 1, true);
+  startSync(journal.getOldestSequence());
+  runFor(100);
+  TEST_ASSERT_FALSE(journalSync.isActive());
+  TEST_ASSERT_EQUAL_UINT32(1, received.rejects);
+  TEST_ASSERT_EQUAL_UINT8(SYNC_STATUS_MTU, received.status);
+  TEST_ASSERT_EQUAL_UINT32(0, received.data);
+  TEST_ASSERT_EQUAL_UINT32(rejected + 1, journalSync.getStats().rejected);
+}
+
+static void test_minimum_mtu_served(void) {
+  connect(SYNC_MIN_MTU, true);
+  startSync(journal.getOldestSequence());
+  runFor(100);
+  TEST_ASSERT_TRUE(journalSync.isActive());
+  TEST_ASSERT_EQUAL_UINT32(0, received.rejects);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, received.data);
+  TEST_ASSERT_EQUAL_UINT8(1, received.firstCount);
+}
+
+static void test_start_needs_subscription(void) {
+  connect(BLE_PREFERRED_MTU, false);
+  startSync(journal.getOldestSequence());
+  runFor(100);
+  TEST_ASSERT_FALSE(journalSync.isActive());
+  TEST_ASSERT_EQUAL_UINT32(0, journalSync.getStats().refused);
+}
+
+static void test_unsubscribe_pauses(void) {
+  // No ACKs: the window fills, then the client stops listening. Nothing is
+  // resent to it, and the ACK timeout does not go back.
+  uint32_t sent = journalSync.getStats().packets;
+  connect(BLE_PREFERRED_MTU, true);
+  startSync(journal.getOldestSequence());
+  runFor(100);
+  TEST_ASSERT_TRUE(journalSync.isActive());
+  SyncStats before = journalSync.getStats();
+  TEST_ASSERT_EQUAL_UINT32(SYNC_DEFAULT_WINDOW, before.packets - sent);
+
+  SimHal::bleSubscribe(central, SYNC_CHARACTERISTIC_UUID, false);
+  runFor(3 * SYNC_ACK_TIMEOUT_MS);
+  SyncStats after = journalSync.getStats();
+  TEST_ASSERT_FALSE(journalSync.isActive());
+  TEST_ASSERT_EQUAL_UINT32(before.packets, after.packets);
+  TEST_ASSERT_EQUAL_UINT32(before.rewinds, after.rewinds);
+  TEST_ASSERT_EQUAL_UINT32(before.refused, after.refused);
+}
+
+// Records per DATA at the preferred MTU
+static const uint32_t PER_PACKET =
+    (BLE_PREFERRED_MTU - BLE_ATT_OVERHEAD - SYNC_DATA_HEADER_SIZE) /
+    MEASUREMENT_RECORD_SIZE;
+
+static void test_nack_goes_back(void) {
+  uint32_t oldest = journal.getOldestSequence();
+  uint32_t rewinds = journalSync.getStats().rewinds;
+  connect(BLE_PREFERRED_MTU, true);
+  startSync(oldest);
+  runFor(100);
+  TEST_ASSERT_EQUAL_UINT32(SYNC_DEFAULT_WINDOW, received.data);
+
+  // Packet 2 went missing: everything from its first record is resent,
+  // numbered from 0 again
+  received = {};
+  sendAck(SYNC_CMD_NACK, oldest + 2 * PER_PACKET);
+  runFor(100);
+  TEST_ASSERT_EQUAL_UINT32(rewinds + 1, journalSync.getStats().rewinds);
+  TEST_ASSERT_EQUAL_UINT32(SYNC_DEFAULT_WINDOW, received.data);
+  TEST_ASSERT_EQUAL_UINT8(0, received.firstCounter);
+  TEST_ASSERT_EQUAL_UINT32(oldest + 2 * PER_PACKET, received.firstSequence);
+  TEST_ASSERT_EQUAL_UINT32(0, received.counterSkips);
+}
+
+static void test_ack_timeout_goes_back(void) {
+  uint32_t oldest = journal.getOldestSequence();
+  uint32_t rewinds = journalSync.getStats().rewinds;
+  connect(BLE_PREFERRED_MTU, true);
+  startSync(oldest);
+  runFor(100);
+  TEST_ASSERT_EQUAL_UINT32(rewinds, journalSync.getStats().rewinds);
+
+  received = {};
+  runFor(SYNC_ACK_TIMEOUT_MS);
+  TEST_ASSERT_EQUAL_UINT32(rewinds + 1, journalSync.getStats().rewinds);
+  TEST_ASSERT_EQUAL_UINT32(SYNC_DEFAULT_WINDOW, received.data);
+  TEST_ASSERT_EQUAL_UINT8(0, received.firstCounter);
+  TEST_ASSERT_EQUAL_UINT32(oldest, received.firstSequence);
+}
+
+static void test_window_limits_unacknowledged(void) {
+  uint32_t oldest = journal.getOldestSequence();
+  uint32_t sent = journalSync.getStats().packets;
+  connect(BLE_PREFERRED_MTU, true);
+  startSync(oldest, 4);
+  runFor(200);
+  TEST_ASSERT_EQUAL_UINT32(4, received.data);
+
+  // Two packets acknowledged open the window by two
+  sendAck(SYNC_CMD_ACK, oldest + 2 * PER_PACKET);
+  runFor(200);
+  TEST_ASSERT_EQUAL_UINT32(6, received.data);
+  TEST_ASSERT_EQUAL_UINT32(6, journalSync.getStats().packets - sent);
+  TEST_ASSERT_EQUAL_UINT32(0, received.counterSkips);
+}
+
+static void test_resume_after_disconnect(void) {
+  uint32_t oldest = journal.getOldestSequence();
+  connect(BLE_PREFERRED_MTU, true);
+  startSync(oldest);
+  runFor(100);
+  uint32_t resumeAt = oldest + 3 * PER_PACKET;
+  sendAck(SYNC_CMD_ACK, resumeAt);
+  runFor(10);
+
+  SimHal::bleDisconnect(central);
+  runFor(50);
+  TEST_ASSERT_FALSE(journalSync.isActive());
+
+  // from = 0 continues after the last ACK, on the new connection
+  received = {};
+  connect(BLE_PREFERRED_MTU, true);
+  startSync(0);
+  runFor(100);
+  TEST_ASSERT_TRUE(journalSync.isActive());
+  TEST_ASSERT_EQUAL_UINT8(0, received.firstCounter);
+  TEST_ASSERT_EQUAL_UINT32(resumeAt, received.firstSequence);
+}
+
+static void test_final_ack_completes(void) {
+  uint32_t last = journal.getLastSequence();
+  uint32_t transfers = journalSync.getStats().transfers;
+  connect(BLE_PREFERRED_MTU, true);
+  autoAck = true;
+  startSync(last - 9);
+  runFor(200);
+  TEST_ASSERT_TRUE(received.ended);
+  TEST_ASSERT_EQUAL_UINT32(last + 1, received.endNext);
+  TEST_ASSERT_FALSE(journalSync.isActive());
+
+  SyncStats stats = journalSync.getStats();
+  TEST_ASSERT_EQUAL_UINT32(transfers + 1, stats.transfers);
+  TEST_ASSERT_EQUAL_UINT32(10, stats.lastRecords);
+}
+
+static void test_packet_counter_wraps(void) {
+  // One record per packet: the whole journal takes more than 256 of them
+  uint32_t oldest = journal.getOldestSequence();
+  uint32_t rewinds = journalSync.getStats().rewinds;
+  connect(SYNC_MIN_MTU, true);
+  autoAck = true;
+  startSync(oldest, SYNC_MAX_WINDOW);
+  runFor(10000);
+  TEST_ASSERT_TRUE(received.ended);
+  TEST_ASSERT_EQUAL_UINT32(RECORDS, received.data);
+  TEST_ASSERT_EQUAL_UINT32(0, received.counterSkips);
+  TEST_ASSERT_EQUAL_UINT32(journal.getLastSequence() + 1, received.endNext);
+  TEST_ASSERT_EQUAL_UINT32(rewinds, journalSync.getStats().rewinds);
+  TEST_ASSERT_EQUAL_UINT32(RECORDS, journalSync.getStats().lastRecords);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_small_mtu_rejected);
+  RUN_TEST(test_minimum_mtu_served);
+  RUN_TEST(test_start_needs_subscription);
+  RUN_TEST(test_unsubscribe_pauses);
+  RUN_TEST(test_nack_goes_back);
+  RUN_TEST(test_ack_timeout_goes_back);
+  RUN_TEST(test_window_limits_unacknowledged);
+  RUN_TEST(test_resume_after_disconnect);
+  RUN_TEST(test_final_ack_completes);
+  RUN_TEST(test_packet_counter_wraps);
+  return UNITY_END();
+}
@@ -0,0 +1,112 @@
+#include "latest_mailbox.h"
+#include <thread>
+#include <unity.h>
+
+// LatestMailbox (latest_mailbox.h): nothing to take until a publish, a newer
+// value replaces an untaken one, a taken value stays put while the producer
+// keeps publishing, and one producer against one consumer thread
+
+struct Value {
+  uint32_t sequence;
+  uint32_t check; // Always ~sequence; a torn value breaks it
+};
+
+typedef LatestMailbox<Value> Mailbox;
+
+static void put(Mailbox &mailbox, uint32_t sequence, bool replaced) {
+  Value &value = mailbox.back();
+  value.sequence = sequence;
+  value.check = ~sequence;
+  TEST_ASSERT_EQUAL(replaced, mailbox.publish());
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_empty_until_published(void) {
+  Mailbox mailbox;
+  TEST_ASSERT_FALSE(mailbox.hasNew());
+  TEST_ASSERT_NULL(mailbox.take());
+
+  put(mailbox, 1, false);
+  TEST_ASSERT_TRUE(mailbox.hasNew());
+  Value *value = mailbox.take();
+  TEST_ASSERT_NOT_NULL(value);
+  TEST_ASSERT_EQUAL_UINT32(1, value->sequence);
+
+  // Taken once only
+  TEST_ASSERT_FALSE(mailbox.hasNew());
+  TEST_ASSERT_NULL(mailbox.take());
+}
+
+static void test_latest_replaces_untaken(void) {
+  Mailbox mailbox;
+  put(mailbox, 1, false);
+  put(mailbox, 2, true);
+  put(mailbox, 3, true);
+
+  Value *value = mailbox.take();
+  TEST_ASSERT_NOT_NULL(value);
+  TEST_ASSERT_EQUAL_UINT32(3, value->sequence);
+  TEST_ASSERT_NULL(mailbox.take());
+
+  // Once taken, the next publish replaces nothing
+  put(mailbox, 4, false);
+}
+
+static void test_taken_value_stays_valid(void) {
+  Mailbox mailbox;
+  put(mailbox, 1, false);
+  Value *taken = mailbox.take();
+
+  // The producer never writes the slot the consumer holds
+  for (uint32_t i = 2; i < 10; i++) {
+    put(mailbox, i, i > 2);
+    TEST_ASSERT_EQUAL_UINT32(1, taken->sequence);
+  }
+  TEST_ASSERT_EQUAL_UINT32(9, mailbox.take()->sequence);
+}
+
+static void test_two_threads(void) {
+  static Mailbox mailbox;
+  const uint32_t COUNT = 200000;
+
+  std::thread producer([&]() {
+    for (uint32_t i = 1; i <= COUNT; i++) {
+      Value &value = mailbox.back();
+      value.sequence = i;
+      value.check = ~i;
+      mailbox.publish();
+    }
+  });
+
+  // Values arrive whole and in order, and the last one always gets through
+  uint32_t last = 0;
+  uint32_t taken = 0;
+  bool torn = false;
+  bool reordered = false;
+  while (last < COUNT) {
+    const Value *value = mailbox.take();
+    if (!value)
+      continue;
+    torn |= value->check != ~value->sequence;
+    reordered |= value->sequence <= last;
+    last = value->sequence;
+    taken++;
+  }
+  producer.join();
+
+  TEST_ASSERT_FALSE(torn);
+  TEST_ASSERT_FALSE(reordered);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, taken);
+  TEST_ASSERT_NULL(mailbox.take());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_empty_until_published);
+  RUN_TEST(test_latest_replaces_untaken);
+  RUN_TEST(test_taken_value_stays_valid);
+  RUN_TEST(test_two_threads);
+  return UNITY_END();
+}
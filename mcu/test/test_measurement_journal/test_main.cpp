@@ -0,0 +1,156 @@
+#include "measurement_journal.h"
+#include "sim_hal.h"
+#include <unity.h>
+
+// MeasurementJournal (measurement_journal.h) mount and read on the host
+// flash: remounting after a torn record and after a sector header cut
+// short, the ring wrapping, and reads from before its oldest record
+
+static const size_t SECTORS = 16;
+static const uint32_t PER_SECTOR = MeasurementJournal::SLOTS_PER_SECTOR - 1;
+
+static const esp_partition_t *partition;
+static MeasurementJournal *journal;
+
+// Writes whatever is still queued
+static void settle(MeasurementJournal &j) {
+  SimHal::advanceMicros(MeasurementJournal::FLUSH_DELAY_MS * 1000);
+  j.poll();
+}
+
+static void appendRecords(MeasurementJournal &j, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    MeasurementRecord r = {};
+    r.samples = 5;
+    r.ciTenths = JOURNAL_CI_UNKNOWN;
+    TEST_ASSERT_NOT_EQUAL(0, j.append(r));
+    j.poll();
+  }
+  settle(j);
+}
+
+// Reads count records from `from` and checks they follow on from `first`
+static void assertReads(MeasurementJournal &j, uint32_t from, uint32_t first,
+                        size_t count) {
+  MeasurementRecord out[16];
+  TEST_ASSERT_EQUAL_UINT32(count, j.read(from, out, count));
+  for (size_t i = 0; i < count; i++) {
+    TEST_ASSERT_EQUAL_UINT32(first + i, out[i].sequence);
+  }
+}
+
+void setUp(void) {
+  static bool added = false;
+  if (!added) {
+    SimHal::addFlashPartition("journal", MeasurementJournal::PARTITION_SUBTYPE,
+                              SECTORS * MeasurementJournal::SECTOR_SIZE);
+    added = true;
+  }
+  partition = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA,
+      (esp_partition_subtype_t)MeasurementJournal::PARTITION_SUBTYPE,
+      "journal");
+  TEST_ASSERT_NOT_NULL(partition);
+  esp_partition_erase_range(partition, 0, partition->size);
+
+  journal = new MeasurementJournal();
+  TEST_ASSERT_TRUE(journal->begin());
+}
+
+void tearDown(void) {
+  SimHal::restoreFlashPower();
+  delete journal;
+}
+
+static void test_remount_after_torn_record(void) {
+  appendRecords(*journal, 10);
+
+  // Power fails 20 bytes into record 11
+  SimHal::cutFlashPowerAfter(20);
+  appendRecords(*journal, 1);
+  SimHal::restoreFlashPower();
+  TEST_ASSERT_EQUAL_UINT32(1, journal->getStats().writeErrors);
+  TEST_ASSERT_EQUAL_UINT32(10, journal->getLastSequence());
+
+  MeasurementJournal rebooted;
+  TEST_ASSERT_TRUE(rebooted.begin());
+  TEST_ASSERT_EQUAL_UINT32(1, rebooted.getStats().torn);
+  TEST_ASSERT_EQUAL_UINT32(10, rebooted.getLastSequence());
+  TEST_ASSERT_EQUAL_UINT16(journal->getBoot() + 1, rebooted.getBoot());
+
+  // The next record goes after the torn slot, which reads skip
+  appendRecords(rebooted, 2);
+  TEST_ASSERT_EQUAL_UINT32(12, rebooted.getLastSequence());
+  assertReads(rebooted, 1, 1, 12);
+  assertReads(rebooted, 10, 10, 3);
+}
+
+static void test_remount_after_torn_sector_header(void) {
+  appendRecords(*journal, PER_SECTOR);
+
+  // The next record opens sector 1: the erase completes, power fails 10
+  // bytes into its header, and the record is lost
+  SimHal::cutFlashPowerAfter(10);
+  appendRecords(*journal, 1);
+  SimHal::restoreFlashPower();
+  TEST_ASSERT_EQUAL_UINT32(1, journal->getStats().writeErrors);
+
+  MeasurementJournal rebooted;
+  TEST_ASSERT_TRUE(rebooted.begin());
+  TEST_ASSERT_EQUAL_UINT32(1, rebooted.getOldestSequence());
+  TEST_ASSERT_EQUAL_UINT32(PER_SECTOR, rebooted.getLastSequence());
+
+  // Sector 1 is opened again, its header rewritten after a fresh erase
+  appendRecords(rebooted, 3);
+  TEST_ASSERT_EQUAL_UINT32(0, rebooted.getStats().writeErrors);
+  TEST_ASSERT_EQUAL_UINT32(PER_SECTOR + 3, rebooted.getLastSequence());
+  assertReads(rebooted, PER_SECTOR - 4, PER_SECTOR - 4, 8);
+
+  MeasurementJournal again;
+  TEST_ASSERT_TRUE(again.begin());
+  TEST_ASSERT_EQUAL_UINT32(PER_SECTOR + 3, again.getLastSequence());
+  assertReads(again, PER_SECTOR - 4, PER_SECTOR - 4, 8);
+}
+
+static void test_ring_wraps(void) {
+  // Every sector full, then 50 records into sector 0 again: its first 127
+  // records are gone and sector 1 holds the oldest
+  uint32_t total = SECTORS * PER_SECTOR + 50;
+  appendRecords(*journal, total);
+  TEST_ASSERT_EQUAL_UINT32(total, journal->getLastSequence());
+  TEST_ASSERT_EQUAL_UINT32(PER_SECTOR + 1, journal->getOldestSequence());
+
+  // Across the wrap, from the last sector into the first
+  uint32_t wrap = SECTORS * PER_SECTOR;
+  assertReads(*journal, wrap - 3, wrap - 3, 10);
+
+  MeasurementJournal rebooted;
+  TEST_ASSERT_TRUE(rebooted.begin());
+  TEST_ASSERT_EQUAL_UINT32(total, rebooted.getLastSequence());
+  TEST_ASSERT_EQUAL_UINT32(PER_SECTOR + 1, rebooted.getOldestSequence());
+  assertReads(rebooted, wrap - 3, wrap - 3, 10);
+  assertReads(rebooted, total - 1, total - 1, 2);
+}
+
+static void test_read_before_oldest(void) {
+  uint32_t total = SECTORS * PER_SECTOR + 50;
+  appendRecords(*journal, total);
+  uint32_t oldest = journal->getOldestSequence();
+  TEST_ASSERT_GREATER_THAN_UINT32(1, oldest);
+
+  // Records that were erased are skipped; the read starts at the oldest
+  assertReads(*journal, 1, oldest, 5);
+  assertReads(*journal, oldest - 1, oldest, 5);
+
+  MeasurementRecord out[4];
+  TEST_ASSERT_EQUAL_UINT32(0, journal->read(total + 1, out, 4));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_remount_after_torn_record);
+  RUN_TEST(test_remount_after_torn_sector_header);
+  RUN_TEST(test_ring_wraps);
+  RUN_TEST(test_read_before_oldest);
+  return UNITY_END();
+}
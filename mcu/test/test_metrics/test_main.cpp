@@ -0,0 +1,51 @@
+#include "metrics.h"
+#include <unity.h>
+
+// Metrics histogram buckets (metrics.h): the bucket edges, and
+// bucketLimit() agreeing with bucketFor()
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_bucket_edges(void) {
+  TEST_ASSERT_EQUAL_UINT8(0, Metrics::bucketFor(0));
+  TEST_ASSERT_EQUAL_UINT8(0, Metrics::bucketFor(63));
+  TEST_ASSERT_EQUAL_UINT8(1, Metrics::bucketFor(64));
+  TEST_ASSERT_EQUAL_UINT8(1, Metrics::bucketFor(127));
+  TEST_ASSERT_EQUAL_UINT8(2, Metrics::bucketFor(128));
+  TEST_ASSERT_EQUAL_UINT8(METRICS_BUCKETS - 2, Metrics::bucketFor(65535));
+  TEST_ASSERT_EQUAL_UINT8(METRICS_BUCKETS - 1, Metrics::bucketFor(65536));
+  TEST_ASSERT_EQUAL_UINT8(METRICS_BUCKETS - 1,
+                          Metrics::bucketFor(0xFFFFFFFF));
+}
+
+static void test_limits_match_buckets(void) {
+  for (uint8_t b = 0; b + 1 < METRICS_BUCKETS; b++) {
+    uint32_t limit = Metrics::bucketLimit(b);
+    TEST_ASSERT_EQUAL_UINT8(b, Metrics::bucketFor(limit - 1));
+    TEST_ASSERT_EQUAL_UINT8(b + 1, Metrics::bucketFor(limit));
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, Metrics::bucketLimit(METRICS_BUCKETS - 1));
+}
+
+static void test_record_counts_and_max(void) {
+  Metrics metrics;
+  metrics.record(HISTOGRAM_READ_US, 63);
+  metrics.record(HISTOGRAM_READ_US, 64);
+  metrics.record(HISTOGRAM_READ_US, 65536);
+  MetricsSnapshot snapshot;
+  metrics.snapshot(snapshot);
+  const HistogramSnapshot &h = snapshot.histograms[HISTOGRAM_READ_US];
+  TEST_ASSERT_EQUAL_UINT32(1, h.buckets[0]);
+  TEST_ASSERT_EQUAL_UINT32(1, h.buckets[1]);
+  TEST_ASSERT_EQUAL_UINT32(1, h.buckets[METRICS_BUCKETS - 1]);
+  TEST_ASSERT_EQUAL_UINT32(65536, h.max);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bucket_edges);
+  RUN_TEST(test_limits_match_buckets);
+  RUN_TEST(test_record_counts_and_max);
+  return UNITY_END();
+}
@@ -0,0 +1,145 @@
+#include "power_manager.h"
+#include "sim_hal.h"
+#include <unity.h>
+
+// PowerManager (power_manager.h) on the host, where there is no light sleep
+// or clock scaling: connection parameters and advertising across an idle
+// period, and the wake to first sample measurement
+
+static const uint8_t PIN_BUTTON = 4;
+
+static Bluetooth ble;
+static PowerManager *power;
+static uint16_t central = SimHal::BLE_NO_CONNECTION;
+
+static uint32_t nowUs() { return (uint32_t)SimHal::nowMicros(); }
+
+static void connect(void) {
+  central = SimHal::bleConnect(23);
+  TEST_ASSERT_NOT_EQUAL(SimHal::BLE_NO_CONNECTION, central);
+}
+
+static void assertConnParams(uint16_t minInterval, uint16_t maxInterval,
+                             uint16_t latency, uint16_t timeout) {
+  SimHal::BleConnParams params = SimHal::bleConnParams(central);
+  TEST_ASSERT_EQUAL_UINT16(minInterval, params.minInterval);
+  TEST_ASSERT_EQUAL_UINT16(maxInterval, params.maxInterval);
+  TEST_ASSERT_EQUAL_UINT16(latency, params.latency);
+  TEST_ASSERT_EQUAL_UINT16(timeout, params.timeout);
+}
+
+void setUp(void) {
+  static bool started = false;
+  if (!started) {
+    ble.begin("test");
+    started = true;
+  }
+  power = new PowerManager(PIN_BUTTON, ble);
+}
+
+void tearDown(void) {
+  power->exitIdle(nowUs());
+  if (central != SimHal::BLE_NO_CONNECTION) {
+    SimHal::bleDisconnect(central);
+    central = SimHal::BLE_NO_CONNECTION;
+  }
+  delete power;
+}
+
+static void test_idle_slows_connection(void) {
+  connect();
+  power->enterIdle();
+  TEST_ASSERT_TRUE(power->isIdle());
+  assertConnParams(BLE_IDLE_MIN_INTERVAL, BLE_IDLE_MAX_INTERVAL,
+                   BLE_IDLE_LATENCY, BLE_IDLE_TIMEOUT);
+
+  power->exitIdle(nowUs());
+  TEST_ASSERT_FALSE(power->isIdle());
+  assertConnParams(BLE_ACTIVE_MIN_INTERVAL, BLE_ACTIVE_MAX_INTERVAL,
+                   BLE_ACTIVE_LATENCY, BLE_ACTIVE_TIMEOUT);
+}
+
+static void test_connecting_while_idle(void) {
+  power->enterIdle();
+  connect();
+  assertConnParams(BLE_IDLE_MIN_INTERVAL, BLE_IDLE_MAX_INTERVAL,
+                   BLE_IDLE_LATENCY, BLE_IDLE_TIMEOUT);
+}
+
+static void test_wake_resumes_advertising(void) {
+  power->enterIdle();
+  TEST_ASSERT_TRUE(SimHal::bleAdvertising());
+
+  // As a sleep slice leaves it when the button wakes the chip
+  ble.pauseAdvertising();
+  TEST_ASSERT_FALSE(SimHal::bleAdvertising());
+  power->exitIdle(nowUs());
+  TEST_ASSERT_TRUE(SimHal::bleAdvertising());
+}
+
+static void test_idle_polls_on_host(void) {
+  power->enterIdle();
+  uint64_t startUs = SimHal::nowMicros();
+  power->idle();
+  TEST_ASSERT_EQUAL_UINT32(PowerManager::IDLE_POLL_MS * 1000,
+                           (uint32_t)(SimHal::nowMicros() - startUs));
+}
+
+static void test_enter_and_exit_once(void) {
+  power->enterIdle();
+  power->enterIdle();
+  power->exitIdle(nowUs());
+  power->exitIdle(nowUs());
+
+  PowerStats stats = power->getStats();
+  TEST_ASSERT_EQUAL_UINT32(1, stats.idlePeriods);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.wakes);
+
+  // Not idle: nothing to wake from
+  power->exitIdle(nowUs());
+  TEST_ASSERT_EQUAL_UINT32(1, power->getStats().wakes);
+}
+
+static void test_wake_latency(void) {
+  // The press was 20 ms before the controller noticed it, the first sample
+  // 30 ms after
+  power->enterIdle();
+  uint32_t pressUs = nowUs();
+  SimHal::advanceMicros(20000);
+  power->exitIdle(pressUs);
+  TEST_ASSERT_TRUE(power->isWakePending());
+  SimHal::advanceMicros(30000);
+  power->recordWakeSample();
+  TEST_ASSERT_FALSE(power->isWakePending());
+
+  PowerStats stats = power->getStats();
+  TEST_ASSERT_EQUAL_UINT32(50000, stats.wakeLatencyUs);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.overBudget);
+
+  // Only the first sample closes the measurement
+  SimHal::advanceMicros(100000);
+  power->recordWakeSample();
+  TEST_ASSERT_EQUAL_UINT32(50000, power->getStats().wakeLatencyUs);
+
+  // A slow wake is counted against the budget
+  power->enterIdle();
+  pressUs = nowUs();
+  power->exitIdle(pressUs);
+  SimHal::advanceMicros(PowerManager::WAKE_LATENCY_BUDGET_US + 1);
+  power->recordWakeSample();
+  stats = power->getStats();
+  TEST_ASSERT_EQUAL_UINT32(PowerManager::WAKE_LATENCY_BUDGET_US + 1,
+                           stats.maxWakeLatencyUs);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.overBudget);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_idle_slows_connection);
+  RUN_TEST(test_connecting_while_idle);
+  RUN_TEST(test_wake_resumes_advertising);
+  RUN_TEST(test_idle_polls_on_host);
+  RUN_TEST(test_enter_and_exit_once);
+  RUN_TEST(test_wake_latency);
+  return UNITY_END();
+}
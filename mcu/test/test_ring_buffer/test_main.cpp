@@ -0,0 +1,162 @@
+#include "spsc_ring_buffer.h"
+#include <thread>
+#include <unity.h>
+
+// SpscRingBuffer (spsc_ring_buffer.h): order, wrap-around, overflow and
+// high-water tracking, and one producer against one consumer thread
+
+typedef SpscRingBuffer<uint32_t, 8> Ring;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_starts_empty(void) {
+  Ring ring;
+  uint32_t value;
+  TEST_ASSERT_TRUE(ring.isEmpty());
+  TEST_ASSERT_FALSE(ring.pop(value));
+  TEST_ASSERT_EQUAL_size_t(8, Ring::capacity());
+  TEST_ASSERT_EQUAL_UINT32(0, ring.overflowCount());
+  TEST_ASSERT_EQUAL_UINT32(0, ring.highWaterMark());
+}
+
+static void test_fifo_order(void) {
+  Ring ring;
+  for (uint32_t i = 0; i < 5; i++) {
+    TEST_ASSERT_TRUE(ring.push(i));
+  }
+  TEST_ASSERT_EQUAL_size_t(5, ring.size());
+  for (uint32_t i = 0; i < 5; i++) {
+    uint32_t value;
+    TEST_ASSERT_TRUE(ring.pop(value));
+    TEST_ASSERT_EQUAL_UINT32(i, value);
+  }
+  TEST_ASSERT_TRUE(ring.isEmpty());
+}
+
+static void test_wraps_around(void) {
+  // Head and tail pass the end of the array many times over
+  Ring ring;
+  uint32_t next = 0;
+  uint32_t expected = 0;
+  for (int round = 0; round < 100; round++) {
+    for (int i = 0; i < 5; i++) {
+      TEST_ASSERT_TRUE(ring.push(next++));
+    }
+    for (int i = 0; i < 5; i++) {
+      uint32_t value;
+      TEST_ASSERT_TRUE(ring.pop(value));
+      TEST_ASSERT_EQUAL_UINT32(expected++, value);
+    }
+  }
+  TEST_ASSERT_TRUE(ring.isEmpty());
+  TEST_ASSERT_EQUAL_UINT32(0, ring.overflowCount());
+}
+
+static void test_full_drops_newest(void) {
+  Ring ring;
+  for (uint32_t i = 0; i < 8; i++) {
+    TEST_ASSERT_TRUE(ring.push(i));
+  }
+  TEST_ASSERT_FALSE(ring.push(100));
+  TEST_ASSERT_FALSE(ring.push(101));
+  TEST_ASSERT_EQUAL_UINT32(2, ring.overflowCount());
+  TEST_ASSERT_EQUAL_size_t(8, ring.size());
+
+  // The oldest data is kept
+  uint32_t value;
+  TEST_ASSERT_TRUE(ring.pop(value));
+  TEST_ASSERT_EQUAL_UINT32(0, value);
+
+  // A freed slot takes the next push
+  TEST_ASSERT_TRUE(ring.push(102));
+  for (uint32_t i = 1; i < 8; i++) {
+    TEST_ASSERT_TRUE(ring.pop(value));
+    TEST_ASSERT_EQUAL_UINT32(i, value);
+  }
+  TEST_ASSERT_TRUE(ring.pop(value));
+  TEST_ASSERT_EQUAL_UINT32(102, value);
+  TEST_ASSERT_EQUAL_UINT32(2, ring.overflowCount());
+}
+
+static void test_high_water_mark(void) {
+  Ring ring;
+  uint32_t value;
+  ring.push(1);
+  ring.push(2);
+  ring.push(3);
+  TEST_ASSERT_EQUAL_UINT32(3, ring.highWaterMark());
+  ring.pop(value);
+  ring.pop(value);
+  ring.push(4);
+  // Peak, not current fill
+  TEST_ASSERT_EQUAL_UINT32(3, ring.highWaterMark());
+  for (uint32_t i = 0; i < 10; i++) {
+    ring.push(i);
+  }
+  TEST_ASSERT_EQUAL_UINT32(8, ring.highWaterMark());
+}
+
+static void test_clear(void) {
+  Ring ring;
+  ring.push(1);
+  ring.push(2);
+  ring.clear();
+  uint32_t value;
+  TEST_ASSERT_TRUE(ring.isEmpty());
+  TEST_ASSERT_FALSE(ring.pop(value));
+  ring.push(3);
+  TEST_ASSERT_TRUE(ring.pop(value));
+  TEST_ASSERT_EQUAL_UINT32(3, value);
+}
+
+// Every value arrives once and in order, or is counted as an overflow
+static void test_two_threads(void) {
+  static SpscRingBuffer<uint32_t, 32> ring;
+  const uint32_t COUNT = 200000;
+  uint32_t pushed = 0;
+
+  std::thread producer([&]() {
+    for (uint32_t i = 0; i < COUNT; i++) {
+      if (ring.push(i)) {
+        pushed++;
+      }
+    }
+  });
+
+  uint32_t received = 0;
+  uint32_t last = 0;
+  bool ordered = true;
+  uint32_t value;
+  auto drain = [&]() {
+    while (ring.pop(value)) {
+      if (received > 0 && value <= last) {
+        ordered = false;
+      }
+      last = value;
+      received++;
+    }
+  };
+  while (received + ring.overflowCount() < COUNT) {
+    drain();
+  }
+  producer.join();
+  drain();
+
+  TEST_ASSERT_TRUE(ordered);
+  TEST_ASSERT_EQUAL_UINT32(pushed, received);
+  TEST_ASSERT_EQUAL_UINT32(COUNT, received + ring.overflowCount());
+  TEST_ASSERT_LESS_OR_EQUAL(32, ring.highWaterMark());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_starts_empty);
+  RUN_TEST(test_fifo_order);
+  RUN_TEST(test_wraps_around);
+  RUN_TEST(test_full_drops_newest);
+  RUN_TEST(test_high_water_mark);
+  RUN_TEST(test_clear);
+  RUN_TEST(test_two_threads);
+  return UNITY_END();
+}
@@ -0,0 +1,194 @@
+#include "sensor_trace.h"
+#include "serial_link.h"
+#include <unity.h>
+#include <vector>
+
+// LinkReader and SerialLink (serial_link.h) on a shared port: frames among
+// text logs and trace chunks, stray and doubled sync bytes, corrupted and
+// torn frames, and commands parsed on the device end
+
+// The port as the other end sees it
+class ByteLog : public Print {
+public:
+  using Print::write;
+  size_t write(uint8_t c) override {
+    bytes.push_back(c);
+    return 1;
+  }
+
+  std::vector<uint8_t> bytes;
+};
+
+// What a reader got out of a byte stream
+struct Parsed {
+  uint32_t frames;
+  uint16_t sequences[16]; // First reading sequence of each READINGS frame
+  uint32_t skipped;
+};
+
+static ByteLog port;
+
+static void text(const char *line) { port.write(line); }
+
+static void readingsFrame(uint16_t sequence) {
+  uint8_t payload[LINK_READINGS_PER_FRAME * LINK_READING_SIZE];
+  for (uint8_t i = 0; i < LINK_READINGS_PER_FRAME; i++) {
+    LinkReading reading = {};
+    reading.sequence = sequence + i;
+    reading.timestamp = 1000 * (sequence + i);
+    reading.red = 0xA5; // Sync bytes inside the payload
+    reading.info = LINK_FRAME_READINGS;
+    reading.raw[0] = 40 + i;
+    encodeLinkReading(reading, payload + i * LINK_READING_SIZE);
+  }
+  writeLinkFrame(port, LINK_FRAME_READINGS, payload, sizeof(payload));
+}
+
+static Parsed parse(const std::vector<uint8_t> &bytes) {
+  LinkReader reader;
+  Parsed parsed = {};
+  for (uint8_t byte : bytes) {
+    if (!reader.feed(byte))
+      continue;
+    TEST_ASSERT_EQUAL_UINT8(LINK_FRAME_READINGS, reader.getType());
+    LinkReading reading;
+    decodeLinkReading(reader.getPayload(), reading);
+    if (parsed.frames < 16) {
+      parsed.sequences[parsed.frames] = reading.sequence;
+    }
+    parsed.frames++;
+  }
+  TEST_ASSERT_TRUE(reader.isIdle());
+  parsed.skipped = reader.getSkippedBytes();
+  return parsed;
+}
+
+void setUp(void) { port.bytes.clear(); }
+void tearDown(void) {}
+
+static void test_frames_among_text(void) {
+  text("Boot\r\n");
+  readingsFrame(0);
+  text("Color: Red\r\n");
+  readingsFrame(11);
+  readingsFrame(22);
+  text("done\r\n");
+
+  Parsed parsed = parse(port.bytes);
+  TEST_ASSERT_EQUAL_UINT32(3, parsed.frames);
+  TEST_ASSERT_EQUAL_UINT16(0, parsed.sequences[0]);
+  TEST_ASSERT_EQUAL_UINT16(11, parsed.sequences[1]);
+  TEST_ASSERT_EQUAL_UINT16(22, parsed.sequences[2]);
+  TEST_ASSERT_EQUAL_UINT32(6 + 12 + 6, parsed.skipped);
+}
+
+static void test_stray_sync_bytes(void) {
+  // A sync byte that starts nothing, then two in a row before a frame
+  port.write(LINK_SYNC);
+  text("x");
+  port.write(LINK_SYNC);
+  readingsFrame(0);
+
+  Parsed parsed = parse(port.bytes);
+  TEST_ASSERT_EQUAL_UINT32(1, parsed.frames);
+  TEST_ASSERT_EQUAL_UINT32(3, parsed.skipped);
+}
+
+static void test_trace_chunks_skipped(void) {
+  // Same sync and layout, a type that is not the link's
+  uint8_t samples[TRACE_RECORDS_PER_CHUNK * TRACE_RECORD_SIZE] = {};
+  uint8_t head[3] = {TRACE_SYNC, TRACE_CHUNK_SAMPLES, sizeof(samples)};
+  port.write(head, sizeof(head));
+  port.write(samples, sizeof(samples));
+  port.write((uint8_t)0);
+  readingsFrame(0);
+
+  Parsed parsed = parse(port.bytes);
+  TEST_ASSERT_EQUAL_UINT32(1, parsed.frames);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(head) + sizeof(samples) + 1,
+                           parsed.skipped);
+}
+
+static void test_corrupted_frame_dropped(void) {
+  readingsFrame(0);
+  size_t frameSize = port.bytes.size();
+  port.bytes[100] ^= 0x01; // A flipped bit: the checksum fails
+  readingsFrame(11);
+
+  Parsed parsed = parse(port.bytes);
+  TEST_ASSERT_EQUAL_UINT32(1, parsed.frames);
+  TEST_ASSERT_EQUAL_UINT16(11, parsed.sequences[0]);
+  TEST_ASSERT_EQUAL_UINT32(frameSize, parsed.skipped);
+}
+
+static void test_torn_frame(void) {
+  // The device resets 50 bytes into a frame. The length it announced
+  // swallows the start of the next frame, whose tail is then skipped; the
+  // frames after that come through.
+  readingsFrame(0);
+  port.bytes.resize(50);
+  text("Boot\r\n");
+  for (uint16_t i = 0; i < 4; i++) {
+    readingsFrame(i * 11);
+  }
+
+  Parsed parsed = parse(port.bytes);
+  TEST_ASSERT_EQUAL_UINT32(3, parsed.frames);
+  TEST_ASSERT_EQUAL_UINT16(11, parsed.sequences[0]);
+  TEST_ASSERT_EQUAL_UINT16(33, parsed.sequences[2]);
+}
+
+static void test_every_cut_recovers(void) {
+  // Wherever the cut falls, at most the frame after it is lost
+  readingsFrame(0);
+  size_t frameSize = port.bytes.size();
+  std::vector<uint8_t> whole = port.bytes;
+  for (size_t cut = 1; cut < frameSize; cut++) {
+    port.bytes.assign(whole.begin(), whole.begin() + cut);
+    for (uint16_t i = 1; i <= 3; i++) {
+      readingsFrame(i * 11);
+    }
+    Parsed parsed = parse(port.bytes);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, parsed.frames);
+    TEST_ASSERT_EQUAL_UINT16(33, parsed.sequences[parsed.frames - 1]);
+  }
+}
+
+static void test_commands_on_device_end(void) {
+  ByteLog acks;
+  SerialLink link(acks);
+  uint8_t start[2] = {LINK_CMD_START_STREAM, 50};
+  uint8_t stop[1] = {LINK_CMD_STOP_STREAM};
+  text("garbage");
+  writeLinkFrame(port, LINK_FRAME_COMMAND, start, sizeof(start));
+  text("\xA5\xA5");
+  writeLinkFrame(port, LINK_FRAME_COMMAND, stop, sizeof(stop));
+
+  LinkCommand commands[2];
+  uint32_t count = 0;
+  for (uint8_t byte : port.bytes) {
+    LinkCommand command;
+    if (link.feed(byte, command) && count < 2) {
+      commands[count++] = command;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(2, count);
+  TEST_ASSERT_EQUAL_UINT8(LINK_CMD_START_STREAM, commands[0].opcode);
+  TEST_ASSERT_EQUAL_UINT8(1, commands[0].length);
+  TEST_ASSERT_EQUAL_UINT8(50, commands[0].args[0]);
+  TEST_ASSERT_EQUAL_UINT8(LINK_CMD_STOP_STREAM, commands[1].opcode);
+  TEST_ASSERT_EQUAL_UINT8(0, commands[1].length);
+  TEST_ASSERT_TRUE(link.isIdle());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_among_text);
+  RUN_TEST(test_stray_sync_bytes);
+  RUN_TEST(test_trace_chunks_skipped);
+  RUN_TEST(test_corrupted_frame_dropped);
+  RUN_TEST(test_torn_frame);
+  RUN_TEST(test_every_cut_recovers);
+  RUN_TEST(test_commands_on_device_end);
+  return UNITY_END();
+}
@@ -28,6 +28,19 @@ interface RGBColor {
   b: number;
 }
 
+// Binary notification format (see mcu/include/ble_packet.h)
+const PACKET_VERSION = 1;
+const PACKET_HEADER_SIZE = 2;
+const RECORD_SIZE = 18;
+
+interface ColorRecord {
+  sequence: number;
+  timestamp: number;
+  color: RGBColor;
+  flags: number;
+  nameId: number;
+}
+
 interface ScannedDevice {
   id: string;
   name: string | null;
@@ -50,6 +63,7 @@ export function useBluetooth() {
   const deviceRef = useRef<any>(null);
   const subscriptionRef = useRef<any>(null);
   const mockIntervalRef = useRef<ReturnType<typeof setInterval> | null>(null);
+  const lastSequenceRef = useRef<number | null>(null);
 
   const [state, setState] = useState<BluetoothState>({
     isScanning: false,
@@ -175,6 +189,49 @@ export function useBluetooth() {
     }
   };
 
+  // Decode a binary packet; null if it is not one (legacy text payload)
+  const decodePacket = (bytes: Buffer): ColorRecord[] | null => {
+    if (bytes.length < PACKET_HEADER_SIZE || bytes[0] !== PACKET_VERSION) {
+      return null;
+    }
+
+    const count = bytes[1];
+    if (bytes.length !== PACKET_HEADER_SIZE + count * RECORD_SIZE) {
+      return null;
+    }
+
+    const records: ColorRecord[] = [];
+    for (let i = 0; i < count; i++) {
+      const offset = PACKET_HEADER_SIZE + i * RECORD_SIZE;
+      records.push({
+        sequence: bytes.readUInt16LE(offset),
+        timestamp: bytes.readUInt32LE(offset + 2),
+        color: {
+          r: bytes[offset + 6],
+          g: bytes[offset + 7],
+          b: bytes[offset + 8],
+        },
+        flags: bytes[offset + 9],
+        nameId: bytes.readUInt16LE(offset + 16),
+      });
+    }
+    return records;
+  };
+
+  // Log gaps in the 16-bit record sequence (lost notifications)
+  const trackSequence = (records: ColorRecord[]) => {
+    for (const record of records) {
+      const last = lastSequenceRef.current;
+      if (last !== null) {
+        const lost = (record.sequence - last - 1 + 0x10000) & 0xffff;
+        if (lost > 0) {
+          console.warn(`Lost ${lost} record(s) before #${record.sequence}`);
+        }
+      }
+      lastSequenceRef.current = record.sequence;
+    }
+  };
+
   // Decode base64 to string
   const decodeBase64 = (base64: string): string => {
     try {
@@ -224,6 +281,8 @@ export function useBluetooth() {
       // Discover services and characteristics
       await connectedDevice.discoverAllServicesAndCharacteristics();
 
+      lastSequenceRef.current = null;
+
       // Setup disconnect listener
       connectedDevice.onDisconnected((error: any, disconnectedDevice: any) => {
         console.log("Device disconnected:", disconnectedDevice?.id);
@@ -248,6 +307,16 @@ export function useBluetooth() {
           }
 
           if (characteristic?.value) {
+            const bytes = Buffer.from(characteristic.value, "base64");
+            const records = decodePacket(bytes);
+
+            if (records && records.length > 0) {
+              trackSequence(records);
+              const latest = records[records.length - 1];
+              setState((prev) => ({ ...prev, currentColor: latest.color }));
+              return;
+            }
+
             const decodedData = decodeBase64(characteristic.value);
             const color = parseColorData(decodedData);
 